@@ -0,0 +1,174 @@
+#ifndef BUFFER_POOL_HPP
+#define BUFFER_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace BufferPool {
+
+/**
+ * This is the bookkeeping of one buffer of a pool. It is kept apart from
+ * the buffer memory itself, so that counting references does not touch the
+ * pages data is read into.
+ */
+struct Descriptor;
+
+/**
+ * This is a counted reference to a fixed size buffer of a pool. Copies share
+ * the buffer, which goes back to its pool when the last of them is
+ * destroyed, so views into data parsed out of the buffer stay valid for as
+ * long as a copy is kept alongside them. An empty reference holds no memory
+ * beyond its own pointer.
+ */
+class Buffer
+{
+public:
+  /** Destructor, copy and move operators */
+  ~Buffer();
+  Buffer(const Buffer &other) noexcept;
+  Buffer(Buffer &&other) noexcept;
+  Buffer &operator=(const Buffer &other) noexcept;
+  Buffer &operator=(Buffer &&other) noexcept;
+
+  /**
+   * This constructs an empty reference
+   */
+  Buffer() noexcept = default;
+
+  /**
+   * This method returns true if the reference holds a buffer
+   */
+  [[nodiscard]] explicit operator bool() const noexcept;
+
+  /**
+   * This method returns the memory of the buffer
+   */
+  [[nodiscard]] char *Data() const noexcept;
+
+  /**
+   * This method returns the size of the buffer in bytes
+   */
+  [[nodiscard]] size_t Capacity() const noexcept;
+
+  /**
+   * This method returns the number of references sharing the buffer
+   */
+  [[nodiscard]] size_t UseCount() const noexcept;
+
+  /**
+   * This method drops the reference, giving the buffer back to its pool if
+   * it was the last one
+   */
+  void Reset() noexcept;
+
+private:
+  friend class BufferPool;
+
+  explicit Buffer(Descriptor *descriptor) noexcept;
+
+  /**
+   * This is the bookkeeping of the referenced buffer, or nullptr
+   */
+  Descriptor *descriptor_ = nullptr;
+};
+
+/**
+ * This is a view into a buffer together with a reference that keeps the
+ * buffer alive, for parsed data that has to outlive the read it came from
+ */
+struct Slice
+{
+  Buffer buffer;
+  std::string_view data;
+};
+
+/**
+ * This hands out fixed size buffers for reading from and writing to
+ * connections. Buffers are carved out of slabs of 2 MB huge pages where the
+ * system has them reserved, and of ordinary pages advised to be backed by
+ * transparent huge pages otherwise, so a reactor thread touching many
+ * buffers misses the TLB far less often.
+ *
+ * Each reactor thread owns its own pool; only the owning thread acquires
+ * buffers. Buffers may be released on any thread: those released elsewhere
+ * are put on a separate lock free list, which the owner collects when it
+ * runs out of buffers. Every buffer must be released before its pool is
+ * destroyed.
+ */
+class BufferPool
+{
+public:
+  /** This is the buffer size used by default */
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 16384;
+
+  /** This is the size of a huge page, and of a slab of buffers */
+  static constexpr size_t SLAB_SIZE = size_t{ 2 } << 20U;
+
+  /** Destructor, copy and move operators */
+  ~BufferPool() noexcept;
+  BufferPool(const BufferPool &) = delete;
+  BufferPool(BufferPool &&) noexcept;
+  BufferPool &operator=(const BufferPool &) = delete;
+  BufferPool &operator=(BufferPool &&) noexcept;
+
+  /**
+   * This constructs an empty pool owned by the calling thread. No memory is
+   * set aside until the first buffer is acquired.
+   *
+   * @param[in] bufferSize
+   *    This is the size of every buffer; it is rounded up to a multiple of
+   *    the cache line size
+   */
+  explicit BufferPool(size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+  /**
+   * This method takes a buffer out of the pool, adding a slab if there is
+   * none free. It must only be called on the owning thread.
+   *
+   * @return
+   *    The only reference to the buffer
+   *
+   * @throws std::bad_alloc
+   *    If no memory could be mapped for a new slab
+   */
+  [[nodiscard]] Buffer Acquire();
+
+  /**
+   * This method returns the size of every buffer
+   */
+  [[nodiscard]] size_t BufferSize() const;
+
+  /**
+   * This method returns the number of slabs mapped so far
+   */
+  [[nodiscard]] size_t SlabCount() const;
+
+  /**
+   * This method returns the number of buffers ready to be acquired, not
+   * counting those released on other threads and not yet collected
+   */
+  [[nodiscard]] size_t FreeCount() const;
+
+  /**
+   * This method returns true if every slab is backed by reserved huge pages
+   */
+  [[nodiscard]] bool UsesHugePages() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace BufferPool
+
+#endif// !BUFFER_POOL_HPP
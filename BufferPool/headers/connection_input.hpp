@@ -0,0 +1,82 @@
+#ifndef CONNECTION_INPUT_HPP
+#define CONNECTION_INPUT_HPP
+
+#include "buffer_pool.hpp"
+
+#include <cstdint>
+#include <string_view>
+#include <sys/types.h>
+
+namespace BufferPool {
+
+/**
+ * This is the data read from one connection and not yet parsed. Unlike
+ * InternetMessage::ConnectionBuffer it owns no memory while the connection
+ * is idle: a buffer is borrowed from the reactor's pool when data arrives
+ * and given back as soon as everything read has been consumed, so a million
+ * idle connections cost sixteen bytes each rather than a buffer each.
+ */
+class ConnectionInput
+{
+public:
+  /**
+   * This method returns the data that has been received but not consumed
+   */
+  [[nodiscard]] std::string_view Readable() const;
+
+  /**
+   * This method returns part of the readable data along with a reference
+   * that keeps it valid after it is consumed
+   *
+   * @param[in] offset
+   *    This is where the part begins, counted from the front of Readable()
+   *
+   * @param[in] length
+   *    This is the length of the part; it is cut short at the end of
+   *    Readable()
+   */
+  [[nodiscard]] Slice Share(size_t offset, size_t length) const;
+
+  /**
+   * This method drops data from the front once it has been parsed, giving
+   * the buffer back to its pool when nothing is left
+   *
+   * @param[in] count
+   *    This is the number of bytes to drop; it must not be more than the
+   *    size of Readable()
+   */
+  void Consume(size_t count);
+
+  /**
+   * This method reads once from the file descriptor, borrowing a buffer
+   * first if none is held. When the buffer is full the unconsumed data is
+   * moved to its front, or to a new buffer if slices of it are still
+   * shared.
+   *
+   * @param[in] pool
+   *    This is the pool of the reactor thread serving the connection
+   *
+   * @param[in] fileDescriptor
+   *    This is the connection to read from
+   *
+   * @return
+   *    The result of read(2): the number of bytes read, 0 at the end of the
+   *    stream or -1 with errno set. errno is ENOBUFS if the unconsumed data
+   *    fills a whole buffer.
+   */
+  ssize_t ReadFrom(BufferPool &pool, int fileDescriptor);
+
+  /**
+   * This method returns true if a buffer is currently borrowed
+   */
+  [[nodiscard]] bool HoldsBuffer() const;
+
+private:
+  Buffer buffer_;
+  uint32_t begin_ = 0;
+  uint32_t end_ = 0;
+};
+
+}// namespace BufferPool
+
+#endif// !CONNECTION_INPUT_HPP
@@ -0,0 +1,236 @@
+#include "buffer_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <sys/mman.h>
+#include <thread>
+#include <vector>
+
+namespace BufferPool {
+
+namespace {
+
+/** Buffers are kept apart by whole cache lines so they never share one */
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+}// namespace
+
+/**
+ * This holds the buffers of a pool that are free to be acquired
+ */
+struct FreeLists
+{
+  /** This is the thread that acquires buffers from the pool */
+  std::thread::id owner = std::this_thread::get_id();
+
+  /** These are the buffers released on the owning thread */
+  Descriptor *local = nullptr;
+  size_t localCount = 0;
+
+  /** These are the buffers released on other threads */
+  std::atomic<Descriptor *> remote = nullptr;
+
+  // Methods
+
+  void Release(Descriptor *descriptor) noexcept;
+};
+
+struct Descriptor
+{
+  FreeLists *freeLists = nullptr;
+  char *data = nullptr;
+  size_t capacity = 0;
+  std::atomic<size_t> references = 0;
+  Descriptor *next = nullptr;
+};
+
+void FreeLists::Release(Descriptor *descriptor) noexcept
+{
+  if (std::this_thread::get_id() == owner) {
+    descriptor->next = local;
+    local = descriptor;
+    ++localCount;
+    return;
+  }
+  auto *head = remote.load(std::memory_order_relaxed);
+  do {
+    descriptor->next = head;
+  } while (!remote.compare_exchange_weak(
+    head, descriptor, std::memory_order_release, std::memory_order_relaxed));
+}
+
+Buffer::Buffer(Descriptor *descriptor) noexcept : descriptor_(descriptor) {}
+
+Buffer::~Buffer() { Reset(); }
+
+Buffer::Buffer(const Buffer &other) noexcept : descriptor_(other.descriptor_)
+{
+  if (descriptor_ != nullptr) { descriptor_->references.fetch_add(1, std::memory_order_relaxed); }
+}
+
+Buffer::Buffer(Buffer &&other) noexcept : descriptor_(other.descriptor_)
+{
+  other.descriptor_ = nullptr;
+}
+
+Buffer &Buffer::operator=(const Buffer &other) noexcept
+{
+  if (this != &other) {
+    Buffer copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+Buffer &Buffer::operator=(Buffer &&other) noexcept
+{
+  if (this != &other) {
+    Reset();
+    descriptor_ = other.descriptor_;
+    other.descriptor_ = nullptr;
+  }
+  return *this;
+}
+
+Buffer::operator bool() const noexcept { return descriptor_ != nullptr; }
+
+char *Buffer::Data() const noexcept
+{
+  return descriptor_ == nullptr ? nullptr : descriptor_->data;
+}
+
+size_t Buffer::Capacity() const noexcept
+{
+  return descriptor_ == nullptr ? 0 : descriptor_->capacity;
+}
+
+size_t Buffer::UseCount() const noexcept
+{
+  return descriptor_ == nullptr ? 0 : descriptor_->references.load(std::memory_order_relaxed);
+}
+
+void Buffer::Reset() noexcept
+{
+  if (descriptor_ == nullptr) { return; }
+  // The last reference takes over every write made through the others
+  if (descriptor_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    descriptor_->freeLists->Release(descriptor_);
+  }
+  descriptor_ = nullptr;
+}
+
+/**
+ * This is the contiguous memory of a number of buffers, with their
+ * bookkeeping
+ */
+struct Slab
+{
+  void *memory = nullptr;
+  size_t size = 0;
+  std::unique_ptr<Descriptor[]> descriptors;
+};
+
+struct BufferPool::Implementation
+{
+  size_t bufferSize = 0;
+  std::vector<Slab> slabs;
+  bool hugePages = true;
+  FreeLists freeLists;
+
+  // Methods
+
+  ~Implementation() noexcept
+  {
+    for (const auto &slab : slabs) { ::munmap(slab.memory, slab.size); }
+  }
+  Implementation(const Implementation &) = delete;
+  Implementation(Implementation &&) = delete;
+  Implementation &operator=(const Implementation &) = delete;
+  Implementation &operator=(Implementation &&) = delete;
+
+  explicit Implementation(size_t size)
+    : bufferSize((std::max(size, size_t{ 1 }) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE
+                 * CACHE_LINE_SIZE)
+  {}
+
+  /**
+   * This method maps a slab of huge pages, or of ordinary pages if none are
+   * reserved, and puts its buffers on the local free list
+   */
+  void AddSlab()
+  {
+    const auto size = (bufferSize + SLAB_SIZE - 1) / SLAB_SIZE * SLAB_SIZE;
+    constexpr int PROTECTION = PROT_READ | PROT_WRITE;
+    constexpr int FLAGS = MAP_PRIVATE | MAP_ANONYMOUS;
+    auto *memory = ::mmap(nullptr, size, PROTECTION, FLAGS | MAP_HUGETLB, -1, 0);
+    if (memory == MAP_FAILED) {
+      hugePages = false;
+      memory = ::mmap(nullptr, size, PROTECTION, FLAGS, -1, 0);
+      if (memory == MAP_FAILED) { throw std::bad_alloc(); }
+      ::madvise(memory, size, MADV_HUGEPAGE);
+    }
+
+    const auto count = size / bufferSize;
+    auto &slab = slabs.emplace_back(Slab{ memory, size, std::make_unique<Descriptor[]>(count) });
+    auto *data = static_cast<char *>(memory);
+    // Pushed in reverse so that buffers are handed out in address order
+    for (size_t index = count; index-- > 0;) {
+      auto &descriptor = slab.descriptors[index];
+      descriptor.freeLists = &freeLists;
+      descriptor.data = data + index * bufferSize;
+      descriptor.capacity = bufferSize;
+      descriptor.next = freeLists.local;
+      freeLists.local = &descriptor;
+    }
+    freeLists.localCount += count;
+  }
+
+  /**
+   * This method moves the buffers released on other threads to the local
+   * free list
+   */
+  void CollectRemote()
+  {
+    auto *descriptor = freeLists.remote.exchange(nullptr, std::memory_order_acquire);
+    while (descriptor != nullptr) {
+      auto *next = descriptor->next;
+      descriptor->next = freeLists.local;
+      freeLists.local = descriptor;
+      ++freeLists.localCount;
+      descriptor = next;
+    }
+  }
+};
+
+BufferPool::~BufferPool() noexcept = default;
+
+BufferPool::BufferPool(BufferPool &&) noexcept = default;
+
+BufferPool &BufferPool::operator=(BufferPool &&) noexcept = default;
+
+BufferPool::BufferPool(size_t bufferSize) : impl_(new Implementation(bufferSize)) {}
+
+Buffer BufferPool::Acquire()
+{
+  auto &freeLists = impl_->freeLists;
+  if (freeLists.local == nullptr) { impl_->CollectRemote(); }
+  if (freeLists.local == nullptr) { impl_->AddSlab(); }
+
+  auto *descriptor = freeLists.local;
+  freeLists.local = descriptor->next;
+  --freeLists.localCount;
+  descriptor->next = nullptr;
+  descriptor->references.store(1, std::memory_order_relaxed);
+  return Buffer(descriptor);
+}
+
+size_t BufferPool::BufferSize() const { return impl_->bufferSize; }
+
+size_t BufferPool::SlabCount() const { return impl_->slabs.size(); }
+
+size_t BufferPool::FreeCount() const { return impl_->freeLists.localCount; }
+
+bool BufferPool::UsesHugePages() const { return !impl_->slabs.empty() && impl_->hugePages; }
+
+}// namespace BufferPool
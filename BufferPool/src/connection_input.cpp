@@ -0,0 +1,72 @@
+#include "connection_input.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+namespace BufferPool {
+
+std::string_view ConnectionInput::Readable() const
+{
+  if (!buffer_) { return {}; }
+  return { buffer_.Data() + begin_, end_ - begin_ };
+}
+
+Slice ConnectionInput::Share(size_t offset, size_t length) const
+{
+  const auto readable = Readable().substr(std::min(offset, size_t{ end_ - begin_ }));
+  return { buffer_, readable.substr(0, length) };
+}
+
+void ConnectionInput::Consume(size_t count)
+{
+  begin_ += static_cast<uint32_t>(std::min(count, size_t{ end_ - begin_ }));
+
+  // Nothing is left to parse, so the connection goes back to holding no
+  // memory until more data arrives
+  if (begin_ == end_) {
+    buffer_.Reset();
+    begin_ = 0;
+    end_ = 0;
+  }
+}
+
+ssize_t ConnectionInput::ReadFrom(BufferPool &pool, int fileDescriptor)
+{
+  if (!buffer_) {
+    buffer_ = pool.Acquire();
+  } else if (end_ == buffer_.Capacity()) {
+    if (begin_ == 0) {
+      errno = ENOBUFS;
+      return -1;
+    }
+    // Slices still refer to the unconsumed data where it is, so it may only
+    // be moved within the buffer if nothing else shares it
+    const auto readable = end_ - begin_;
+    if (buffer_.UseCount() > 1) {
+      auto fresh = pool.Acquire();
+      std::memcpy(fresh.Data(), buffer_.Data() + begin_, readable);
+      buffer_ = std::move(fresh);
+    } else {
+      std::memmove(buffer_.Data(), buffer_.Data() + begin_, readable);
+    }
+    begin_ = 0;
+    end_ = readable;
+  }
+
+  const auto received = ::read(fileDescriptor, buffer_.Data() + end_, buffer_.Capacity() - end_);
+  if (received > 0) {
+    end_ += static_cast<uint32_t>(received);
+  } else if (begin_ == end_) {
+    // Reset does not touch errno, so the caller still sees why nothing came
+    buffer_.Reset();
+    begin_ = 0;
+    end_ = 0;
+  }
+  return received;
+}
+
+bool ConnectionInput::HoldsBuffer() const { return static_cast<bool>(buffer_); }
+
+}// namespace BufferPool
@@ -0,0 +1,90 @@
+#include "../headers/buffer_pool.hpp"
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Buffer pool hands out aligned buffers of its size", "BufferPool")
+{
+  BufferPool::BufferPool pool(1000);
+  REQUIRE(pool.BufferSize() == 1024);
+  REQUIRE(pool.SlabCount() == 0);
+
+  const auto first = pool.Acquire();
+  const auto second = pool.Acquire();
+  REQUIRE(first);
+  REQUIRE(first.Capacity() == 1024);
+  REQUIRE(first.UseCount() == 1);
+  REQUIRE(reinterpret_cast<uintptr_t>(first.Data()) % 64 == 0);
+  REQUIRE(second.Data() == first.Data() + 1024);
+  REQUIRE(pool.SlabCount() == 1);
+  REQUIRE(pool.FreeCount() == BufferPool::BufferPool::SLAB_SIZE / 1024 - 2);
+
+  if (!pool.UsesHugePages()) { WARN("no huge pages are reserved; using ordinary pages"); }
+}
+
+TEST_CASE("Buffer pool takes a buffer back with its last reference", "BufferPool")
+{
+  BufferPool::BufferPool pool;
+  const auto freeBefore = [&] {
+    const auto warmUp = pool.Acquire();
+    return pool.FreeCount() + 1;
+  }();
+
+  auto buffer = pool.Acquire();
+  auto *const data = buffer.Data();
+  auto copy = buffer;
+  REQUIRE(buffer.UseCount() == 2);
+  REQUIRE(pool.FreeCount() == freeBefore - 1);
+
+  buffer.Reset();
+  REQUIRE_FALSE(buffer);
+  REQUIRE(buffer.Data() == nullptr);
+  REQUIRE(copy.UseCount() == 1);
+  REQUIRE(pool.FreeCount() == freeBefore - 1);
+
+  auto moved = std::move(copy);
+  REQUIRE_FALSE(copy);
+  moved = BufferPool::Buffer();
+  REQUIRE(pool.FreeCount() == freeBefore);
+
+  // The most recently released buffer is the next one handed out, while its
+  // memory is still in the cache
+  REQUIRE(pool.Acquire().Data() == data);
+}
+
+TEST_CASE("Buffer pool adds slabs as it runs out", "BufferPool")
+{
+  BufferPool::BufferPool pool(BufferPool::BufferPool::SLAB_SIZE / 4);
+  std::vector<BufferPool::Buffer> buffers;
+  for (int count = 0; count < 5; ++count) { buffers.push_back(pool.Acquire()); }
+  REQUIRE(pool.SlabCount() == 2);
+
+  buffers.clear();
+  REQUIRE(pool.FreeCount() == 8);
+  for (int count = 0; count < 8; ++count) { buffers.push_back(pool.Acquire()); }
+  REQUIRE(pool.SlabCount() == 2);
+}
+
+TEST_CASE("Buffer pool collects buffers released on other threads", "BufferPool")
+{
+  BufferPool::BufferPool pool(BufferPool::BufferPool::SLAB_SIZE / 8);
+  std::vector<BufferPool::Buffer> buffers;
+  for (int count = 0; count < 8; ++count) { buffers.push_back(pool.Acquire()); }
+  REQUIRE(pool.FreeCount() == 0);
+
+  std::vector<std::thread> threads;
+  for (size_t part = 0; part < 4; ++part) {
+    threads.emplace_back([&buffers, part] {
+      buffers[part * 2].Reset();
+      buffers[part * 2 + 1].Reset();
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+
+  // Buffers released elsewhere wait until the owner runs out
+  REQUIRE(pool.FreeCount() == 0);
+  for (auto &buffer : buffers) { buffer = pool.Acquire(); }
+  REQUIRE(pool.SlabCount() == 1);
+}
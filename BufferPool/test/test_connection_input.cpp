@@ -0,0 +1,117 @@
+#include "../headers/connection_input.hpp"
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cerrno>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * This is a connected pair of sockets, the first one non-blocking, that is
+ * closed at the end of a test
+ */
+struct SocketPair
+{
+  SocketPair()
+  {
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockets.data()) == 0);
+  }
+  ~SocketPair()
+  {
+    ::close(sockets[0]);
+    ::close(sockets[1]);
+  }
+  SocketPair(const SocketPair &) = delete;
+  SocketPair(SocketPair &&) = delete;
+  SocketPair &operator=(const SocketPair &) = delete;
+  SocketPair &operator=(SocketPair &&) = delete;
+
+  void Send(const std::string &data) const
+  {
+    REQUIRE(::write(sockets[1], data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+  }
+
+  std::array<int, 2> sockets{};
+};
+
+}// namespace
+
+TEST_CASE("Idle connections hold no buffer", "ConnectionInput")
+{
+  STATIC_REQUIRE(sizeof(BufferPool::ConnectionInput) <= 16);
+
+  BufferPool::BufferPool pool;
+  const SocketPair connection;
+  BufferPool::ConnectionInput input;
+  REQUIRE_FALSE(input.HoldsBuffer());
+  REQUIRE(input.Readable().empty());
+
+  // A wake up with nothing to read gives the buffer straight back
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == -1);
+  REQUIRE(errno == EAGAIN);
+  REQUIRE_FALSE(input.HoldsBuffer());
+
+  connection.Send("GET / HTTP/1.1\r\n\r\nGET /a");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 24);
+  REQUIRE(input.HoldsBuffer());
+  REQUIRE(input.Readable() == "GET / HTTP/1.1\r\n\r\nGET /a");
+
+  input.Consume(18);
+  REQUIRE(input.Readable() == "GET /a");
+  REQUIRE(input.HoldsBuffer());
+  input.Consume(6);
+  REQUIRE_FALSE(input.HoldsBuffer());
+}
+
+TEST_CASE("Shared slices outlive what is consumed", "ConnectionInput")
+{
+  BufferPool::BufferPool pool(64);
+  const SocketPair connection;
+  BufferPool::ConnectionInput input;
+
+  connection.Send("Host: a\r\n");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 9);
+  const auto host = input.Share(6, 1);
+  REQUIRE(host.data == "a");
+  REQUIRE(input.Share(8, 100).data == "\n");
+  input.Consume(9);
+  REQUIRE_FALSE(input.HoldsBuffer());
+  REQUIRE(host.data == "a");
+  REQUIRE(host.buffer.UseCount() == 1);
+
+  // A shared buffer that fills up is not compacted under its slices
+  connection.Send(std::string(60, 'x') + "abcd");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 64);
+  input.Consume(60);
+  const auto tail = input.Share(0, 4);
+  connection.Send("ef");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 2);
+  REQUIRE(input.Readable() == "abcdef");
+  REQUIRE(tail.data == "abcd");
+  REQUIRE(tail.buffer.Data() != input.Share(0, 0).buffer.Data());
+}
+
+TEST_CASE("Unconsumed data is moved to the front when the buffer fills", "ConnectionInput")
+{
+  BufferPool::BufferPool pool(64);
+  const SocketPair connection;
+  BufferPool::ConnectionInput input;
+
+  connection.Send(std::string(62, 'x') + "ab");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 64);
+  const auto *const front = input.Readable().data();
+  input.Consume(62);
+  connection.Send("c");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 1);
+  REQUIRE(input.Readable() == "abc");
+  REQUIRE(input.Readable().data() == front);
+
+  // A message that fills a whole buffer cannot be read further
+  connection.Send(std::string(61, 'y') + "z");
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == 61);
+  REQUIRE(input.ReadFrom(pool, connection.sockets[0]) == -1);
+  REQUIRE(errno == ENOBUFS);
+}
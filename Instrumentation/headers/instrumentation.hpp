@@ -0,0 +1,213 @@
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * This module counts and times the work done by the parsers of this
+ * project. It is only compiled in when WSERVER_INSTRUMENTATION is defined
+ * (the ENABLE_INSTRUMENTATION CMake option); otherwise every hook is an
+ * empty inline function and a snapshot is all zeros.
+ */
+namespace Instrumentation {
+
+#ifdef WSERVER_INSTRUMENTATION
+inline constexpr bool ENABLED = true;
+#else
+inline constexpr bool ENABLED = false;
+#endif
+
+/** These are the libraries whose work is counted separately */
+enum class Library : uint8_t {
+  uri,
+  internet_message,
+  form_body,
+};
+
+inline constexpr size_t LIBRARY_COUNT = 3;
+
+/** These are the reasons why a parse can fail */
+enum class FailureReason : uint8_t {
+  invalid_scheme,
+  invalid_user_info,
+  invalid_host,
+  invalid_port,
+  invalid_path,
+  invalid_query_or_fragment,
+  missing_header_delimiter,
+  invalid_message_framing,
+  invalid_encoding,
+  headers_too_long,
+};
+
+inline constexpr size_t FAILURE_REASON_COUNT = 10;
+
+/**
+ * This is a histogram of latencies in nanoseconds. Bucket i counts the
+ * samples in [2^i, 2^(i+1)), with the first bucket also holding zero and
+ * the last one everything above its lower bound.
+ */
+struct LatencyHistogram
+{
+  static constexpr size_t BUCKET_COUNT = 40;
+
+  std::array<uint64_t, BUCKET_COUNT> buckets{};
+
+  /**
+   * This method returns the bucket a latency falls in
+   *
+   * @param[in] nanoseconds
+   *    This is the latency to place
+   */
+  [[nodiscard]] static size_t BucketOf(uint64_t nanoseconds);
+
+  /**
+   * This method returns the number of samples in the histogram
+   */
+  [[nodiscard]] uint64_t Count() const;
+
+  /**
+   * This method returns an upper bound of the latency below which the given
+   * fraction of the samples fall
+   *
+   * @param[in] fraction
+   *    This is the fraction of the samples, 0.99 for the p99
+   *
+   * @return
+   *    The upper bound of the bucket holding the percentile in nanoseconds,
+   *    or 0 if the histogram is empty
+   */
+  [[nodiscard]] uint64_t Percentile(double fraction) const;
+};
+
+/** These are the figures collected for one library */
+struct LibraryCounters
+{
+  uint64_t parse_calls = 0;
+  uint64_t parse_failures = 0;
+  uint64_t bytes_parsed = 0;
+
+  /** These are the heap allocations made while a parse was running */
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+
+  /** This is the number of percent-encoded characters decoded */
+  uint64_t decoded_escapes = 0;
+
+  std::array<uint64_t, FAILURE_REASON_COUNT> failures{};
+  LatencyHistogram parse_latency;
+};
+
+/** This is a copy of every counter at a point in time */
+struct Snapshot
+{
+  std::array<LibraryCounters, LIBRARY_COUNT> libraries{};
+
+  [[nodiscard]] const LibraryCounters &operator[](Library library) const
+  {
+    return libraries[static_cast<size_t>(library)];
+  }
+};
+
+/**
+ * This function copies the current value of every counter. Counters are
+ * updated with relaxed atomics, so a snapshot taken while parses are
+ * running is consistent per counter but not across counters.
+ */
+[[nodiscard]] Snapshot TakeSnapshot();
+
+/**
+ * This function sets every counter back to zero
+ */
+void Reset();
+
+#ifdef WSERVER_INSTRUMENTATION
+
+/**
+ * These functions add to the counters of the library; the parsers call them
+ * through the hooks below rather than directly
+ */
+void RecordParse(Library library, size_t bytes, bool succeeded, uint64_t nanoseconds);
+void RecordFailure(Library library, FailureReason reason);
+void RecordDecodedEscape(Library library);
+
+/**
+ * This is the library whose parse is running in this thread, if any, so
+ * that heap allocations can be charged to it
+ */
+struct ActiveParse
+{
+  bool active = false;
+  Library library = Library::uri;
+};
+ActiveParse &CurrentParse();
+
+/**
+ * This times a parse from its construction to its destruction and charges
+ * the heap allocations made in between to the library. A parse is counted
+ * as failed unless Succeed is called.
+ */
+class ParseScope
+{
+public:
+  ParseScope(Library library, size_t bytes)
+    : library_(library), bytes_(bytes), outer_(CurrentParse()),
+      start_(std::chrono::steady_clock::now())
+  {
+    CurrentParse() = { true, library };
+  }
+
+  ~ParseScope()
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    CurrentParse() = outer_;
+    RecordParse(library_,
+      bytes_,
+      succeeded_,
+      static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+  }
+
+  ParseScope(const ParseScope &) = delete;
+  ParseScope(ParseScope &&) = delete;
+  ParseScope &operator=(const ParseScope &) = delete;
+  ParseScope &operator=(ParseScope &&) = delete;
+
+  void Succeed() { succeeded_ = true; }
+
+  /** This sets the bytes charged, for a parse that only knows them at the end */
+  void Charge(size_t bytes) { bytes_ = bytes; }
+
+private:
+  Library library_;
+  size_t bytes_;
+  bool succeeded_ = false;
+  ActiveParse outer_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+inline void CountFailure(Library library, FailureReason reason) { RecordFailure(library, reason); }
+
+inline void CountDecodedEscape(Library library) { RecordDecodedEscape(library); }
+
+#else
+
+class ParseScope
+{
+public:
+  ParseScope(Library /*library*/, size_t /*bytes*/) {}
+  void Succeed() {}
+  void Charge(size_t /*bytes*/) {}
+};
+
+inline void CountFailure(Library /*library*/, FailureReason /*reason*/) {}
+
+inline void CountDecodedEscape(Library /*library*/) {}
+
+#endif
+
+}// namespace Instrumentation
+
+#endif// !INSTRUMENTATION_HPP
@@ -0,0 +1,300 @@
+#include "instrumentation.hpp"
+
+#include <bit>
+#include <limits>
+
+#ifdef WSERVER_INSTRUMENTATION
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace Instrumentation {
+
+size_t LatencyHistogram::BucketOf(uint64_t nanoseconds)
+{
+  if (nanoseconds == 0) { return 0; }
+  const auto bucket =
+    static_cast<size_t>(std::numeric_limits<uint64_t>::digits - 1 - std::countl_zero(nanoseconds));
+  return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+}
+
+uint64_t LatencyHistogram::Count() const
+{
+  uint64_t count = 0;
+  for (const auto bucket : buckets) { count += bucket; }
+  return count;
+}
+
+uint64_t LatencyHistogram::Percentile(double fraction) const
+{
+  const auto count = Count();
+  if (count == 0) { return 0; }
+
+  const auto wanted = static_cast<double>(count) * fraction;
+  uint64_t seen = 0;
+  for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+    seen += buckets[bucket];
+    if (static_cast<double>(seen) >= wanted && seen > 0) {
+      return (uint64_t{ 1 } << (bucket + 1)) - 1;
+    }
+  }
+  return (uint64_t{ 1 } << BUCKET_COUNT) - 1;
+}
+
+#ifdef WSERVER_INSTRUMENTATION
+
+namespace {
+
+/** These are the live counters of one library */
+struct AtomicCounters
+{
+  std::atomic<uint64_t> parse_calls{ 0 };
+  std::atomic<uint64_t> parse_failures{ 0 };
+  std::atomic<uint64_t> bytes_parsed{ 0 };
+  std::atomic<uint64_t> allocations{ 0 };
+  std::atomic<uint64_t> allocated_bytes{ 0 };
+  std::atomic<uint64_t> decoded_escapes{ 0 };
+  std::array<std::atomic<uint64_t>, FAILURE_REASON_COUNT> failures{};
+  std::array<std::atomic<uint64_t>, LatencyHistogram::BUCKET_COUNT> parse_latency{};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<AtomicCounters, LIBRARY_COUNT> counters;
+
+AtomicCounters &CountersOf(Library library) { return counters[static_cast<size_t>(library)]; }
+
+void Add(std::atomic<uint64_t> &counter, uint64_t value)
+{
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t Load(const std::atomic<uint64_t> &counter)
+{
+  return counter.load(std::memory_order_relaxed);
+}
+
+/*
+ * This charges a heap allocation to the library whose parse is running in
+ * this thread, if any
+ */
+void CountAllocation(size_t size)
+{
+  const auto &parse = CurrentParse();
+  if (!parse.active) { return; }
+  auto &library_counters = CountersOf(parse.library);
+  Add(library_counters.allocations, 1);
+  Add(library_counters.allocated_bytes, size);
+}
+
+}// namespace
+
+ActiveParse &CurrentParse()
+{
+  thread_local ActiveParse parse;
+  return parse;
+}
+
+void RecordParse(Library library, size_t bytes, bool succeeded, uint64_t nanoseconds)
+{
+  auto &library_counters = CountersOf(library);
+  Add(library_counters.parse_calls, 1);
+  Add(library_counters.bytes_parsed, bytes);
+  if (!succeeded) { Add(library_counters.parse_failures, 1); }
+  Add(library_counters.parse_latency[LatencyHistogram::BucketOf(nanoseconds)], 1);
+}
+
+void RecordFailure(Library library, FailureReason reason)
+{
+  Add(CountersOf(library).failures[static_cast<size_t>(reason)], 1);
+}
+
+void RecordDecodedEscape(Library library) { Add(CountersOf(library).decoded_escapes, 1); }
+
+Snapshot TakeSnapshot()
+{
+  Snapshot snapshot;
+  for (size_t library = 0; library < LIBRARY_COUNT; ++library) {
+    const auto &from = counters[library];
+    auto &to = snapshot.libraries[library];
+    to.parse_calls = Load(from.parse_calls);
+    to.parse_failures = Load(from.parse_failures);
+    to.bytes_parsed = Load(from.bytes_parsed);
+    to.allocations = Load(from.allocations);
+    to.allocated_bytes = Load(from.allocated_bytes);
+    to.decoded_escapes = Load(from.decoded_escapes);
+    for (size_t reason = 0; reason < FAILURE_REASON_COUNT; ++reason) {
+      to.failures[reason] = Load(from.failures[reason]);
+    }
+    for (size_t bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; ++bucket) {
+      to.parse_latency.buckets[bucket] = Load(from.parse_latency[bucket]);
+    }
+  }
+  return snapshot;
+}
+
+void Reset()
+{
+  for (auto &library_counters : counters) {
+    for (auto *counter : { &library_counters.parse_calls,
+           &library_counters.parse_failures,
+           &library_counters.bytes_parsed,
+           &library_counters.allocations,
+           &library_counters.allocated_bytes,
+           &library_counters.decoded_escapes }) {
+      counter->store(0, std::memory_order_relaxed);
+    }
+    for (auto &counter : library_counters.failures) { counter.store(0, std::memory_order_relaxed); }
+    for (auto &counter : library_counters.parse_latency) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+#else
+
+Snapshot TakeSnapshot() { return {}; }
+
+void Reset() {}
+
+#endif
+
+}// namespace Instrumentation
+
+#ifdef WSERVER_INSTRUMENTATION
+
+// The global allocation functions are replaced so that the allocations made
+// while a parse is running can be charged to its library. Every form is
+// replaced, since sanitizers intercept the ones that are left alone.
+
+namespace {
+
+void *Allocate(std::size_t size) noexcept
+{
+  return std::malloc(size == 0 ? 1 : size);// NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void *Allocate(std::size_t size, std::align_val_t alignment) noexcept
+{
+  const auto align = static_cast<std::size_t>(alignment);
+  const auto rounded = (size + align - 1) / align * align;
+  return std::aligned_alloc(align, rounded == 0 ? align : rounded);
+}
+
+/*
+ * This allocates as the standard operator new does: while the memory can
+ * not be had, the new handler is called to free some, and bad_alloc is
+ * thrown once there is no handler left
+ */
+template<typename... Alignment> void *AllocateOrThrow(std::size_t size, Alignment... alignment)
+{
+  Instrumentation::CountAllocation(size);
+  for (;;) {
+    if (auto *memory = Allocate(size, alignment...); memory != nullptr) { return memory; }
+    const auto handler = std::get_new_handler();
+    if (handler == nullptr) { throw std::bad_alloc(); }
+    handler();
+  }
+}
+
+/*
+ * This allocates as the standard nothrow operator new does, which gives
+ * null where the other form throws
+ */
+template<typename... Alignment>
+void *AllocateOrNull(std::size_t size, Alignment... alignment) noexcept
+{
+  try {
+    return AllocateOrThrow(size, alignment...);
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void Free(void *memory) noexcept { std::free(memory); }// NOLINT(cppcoreguidelines-no-malloc)
+
+}// namespace
+
+void *operator new(std::size_t size) { return AllocateOrThrow(size); }
+
+void *operator new[](std::size_t size) { return AllocateOrThrow(size); }
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+  return AllocateOrThrow(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return AllocateOrThrow(size, alignment);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+  return AllocateOrNull(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+  return AllocateOrNull(size);
+}
+
+void *operator new(std::size_t size,
+  std::align_val_t alignment,
+  const std::nothrow_t & /*tag*/) noexcept
+{
+  return AllocateOrNull(size, alignment);
+}
+
+void *operator new[](std::size_t size,
+  std::align_val_t alignment,
+  const std::nothrow_t & /*tag*/) noexcept
+{
+  return AllocateOrNull(size, alignment);
+}
+
+void operator delete(void *memory) noexcept { Free(memory); }
+
+void operator delete[](void *memory) noexcept { Free(memory); }
+
+void operator delete(void *memory, std::size_t /*size*/) noexcept { Free(memory); }
+
+void operator delete[](void *memory, std::size_t /*size*/) noexcept { Free(memory); }
+
+void operator delete(void *memory, std::align_val_t /*alignment*/) noexcept { Free(memory); }
+
+void operator delete[](void *memory, std::align_val_t /*alignment*/) noexcept { Free(memory); }
+
+void operator delete(void *memory,
+  std::size_t /*size*/,
+  std::align_val_t /*alignment*/) noexcept
+{
+  Free(memory);
+}
+
+void operator delete[](void *memory,
+  std::size_t /*size*/,
+  std::align_val_t /*alignment*/) noexcept
+{
+  Free(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t & /*tag*/) noexcept { Free(memory); }
+
+void operator delete[](void *memory, const std::nothrow_t & /*tag*/) noexcept { Free(memory); }
+
+void operator delete(void *memory,
+  std::align_val_t /*alignment*/,
+  const std::nothrow_t & /*tag*/) noexcept
+{
+  Free(memory);
+}
+
+void operator delete[](void *memory,
+  std::align_val_t /*alignment*/,
+  const std::nothrow_t & /*tag*/) noexcept
+{
+  Free(memory);
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "../../InternetMessage/headers/internet_message.hpp"
+#include "form_decoder.hpp"
+#include "instrumentation.hpp"
+#include "uri.hpp"
+#include <catch2/catch.hpp>
+
+TEST_CASE("Latency histogram buckets", "[Instrumentation]")
+{
+  using Instrumentation::LatencyHistogram;
+
+  REQUIRE(LatencyHistogram::BucketOf(0) == 0);
+  REQUIRE(LatencyHistogram::BucketOf(1) == 0);
+  REQUIRE(LatencyHistogram::BucketOf(2) == 1);
+  REQUIRE(LatencyHistogram::BucketOf(3) == 1);
+  REQUIRE(LatencyHistogram::BucketOf(1024) == 10);
+  REQUIRE(LatencyHistogram::BucketOf(UINT64_MAX) == LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST_CASE("Latency histogram percentiles", "[Instrumentation]")
+{
+  Instrumentation::LatencyHistogram histogram;
+  REQUIRE(histogram.Count() == 0);
+  REQUIRE(histogram.Percentile(0.99) == 0);
+
+  // 98 fast samples around 100ns and two slow ones around 1ms
+  histogram.buckets[Instrumentation::LatencyHistogram::BucketOf(100)] = 98;
+  histogram.buckets[Instrumentation::LatencyHistogram::BucketOf(1'000'000)] = 2;
+
+  REQUIRE(histogram.Count() == 100);
+  REQUIRE(histogram.Percentile(0.5) == 127);
+  REQUIRE(histogram.Percentile(0.98) == 127);
+  REQUIRE(histogram.Percentile(0.99) == 1'048'575);
+}
+
+TEST_CASE("Parsers report to the counters", "[Instrumentation]")
+{
+  using Instrumentation::FailureReason;
+  using Instrumentation::Library;
+
+  Instrumentation::Reset();
+
+  Uri::Uri uri;
+  const std::string valid_uri = "http://www.example.com/%7Euser/a%20b";
+  REQUIRE(uri.ParseFromString(valid_uri));
+  REQUIRE_FALSE(uri.ParseFromString("http://www.example.com:false/"));
+  REQUIRE_FALSE(uri.ParseFromString("ht%tp://www.example.com/"));
+
+  InternetMessage::InternetMessage message;
+  REQUIRE_FALSE(message.ParseFromRawMessage("No delimiter here\r\n\r\n"));
+
+  // Only the messages parsed whole from a buffer are charged, once each
+  const std::string pipelined = "Host: a\r\n\r\nHost: b\r\n\r\nHost: c";
+  size_t consumed = 0;
+  REQUIRE(message.ParseFromBuffer(std::string_view(pipelined).substr(0, 5), consumed).error
+          == InternetMessage::ParseError::incomplete);
+  REQUIRE(message.ParseFromBuffer(pipelined, consumed));
+  REQUIRE(message.ParseFromBuffer(std::string_view(pipelined).substr(consumed), consumed));
+
+  // The escapes of form bodies are counted apart from those of URIs
+  Uri::FormDecoder form([](std::string_view, std::string_view) { return true; });
+  REQUIRE(form.Feed("a%20b=c+d%21&e=%7E") == Uri::FormError::none);
+  REQUIRE(form.Finish() == Uri::FormError::none);
+
+  const auto snapshot = Instrumentation::TakeSnapshot();
+  const auto &uri_counters = snapshot[Library::uri];
+  const auto &message_counters = snapshot[Library::internet_message];
+  const auto &form_counters = snapshot[Library::form_body];
+
+  if constexpr (Instrumentation::ENABLED) {
+    REQUIRE(uri_counters.parse_calls == 3);
+    REQUIRE(uri_counters.parse_failures == 2);
+    REQUIRE(uri_counters.bytes_parsed == valid_uri.size() + 29 + 24);
+    REQUIRE(uri_counters.decoded_escapes == 2);
+    REQUIRE(uri_counters.allocations > 0);
+    REQUIRE(uri_counters.failures[static_cast<size_t>(FailureReason::invalid_port)] == 1);
+    REQUIRE(uri_counters.failures[static_cast<size_t>(FailureReason::invalid_scheme)] == 1);
+    REQUIRE(uri_counters.parse_latency.Count() == 3);
+
+    REQUIRE(message_counters.parse_calls == 4);
+    REQUIRE(message_counters.parse_failures == 1);
+    REQUIRE(message_counters.bytes_parsed == 21 + 11 + 11);
+
+    REQUIRE(form_counters.decoded_escapes == 3);
+    REQUIRE(
+      message_counters.failures[static_cast<size_t>(FailureReason::missing_header_delimiter)] == 1);
+  } else {
+    REQUIRE(uri_counters.parse_calls == 0);
+    REQUIRE(uri_counters.parse_latency.Count() == 0);
+    REQUIRE(message_counters.parse_calls == 0);
+  }
+
+  Instrumentation::Reset();
+  REQUIRE(Instrumentation::TakeSnapshot()[Library::uri].parse_calls == 0);
+}
+
+TEST_CASE("Parsers reused for another message do not allocate", "[Instrumentation]")
+{
+  using Instrumentation::Library;
+
+  Uri::Uri uri;
+  InternetMessage::InternetMessage message;
+  const std::string uri_string = "http://www.example.com/products/%7Elist?page=2#top";
+  const std::string raw_message = "Host: www.example.com\r\nAccept: */*\r\n\r\nbody";
+  REQUIRE(uri.ParseFromString(uri_string));
+  REQUIRE(message.ParseFromRawMessage(raw_message));
+
+  Instrumentation::Reset();
+  REQUIRE(uri.ParseFromString("http://www.example.com/products/%7Elist?page=3#end"));
+  REQUIRE(message.ParseFromRawMessage("Host: www.example.org\r\nAccept: */*\r\n\r\nbody"));
+  const auto snapshot = Instrumentation::TakeSnapshot();
+
+  if constexpr (Instrumentation::ENABLED) {
+    REQUIRE(snapshot[Library::uri].parse_calls == 1);
+    REQUIRE(snapshot[Library::uri].allocations == 0);
+    REQUIRE(snapshot[Library::internet_message].parse_calls == 1);
+    REQUIRE(snapshot[Library::internet_message].allocations == 0);
+  }
+}
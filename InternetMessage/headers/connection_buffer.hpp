@@ -0,0 +1,91 @@
+#ifndef CONNECTION_BUFFER_HPP
+#define CONNECTION_BUFFER_HPP
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <sys/types.h>
+#include <vector>
+
+namespace InternetMessage {
+
+/**
+ * This is the buffer that the data read from a connection is kept in until
+ * it has been parsed. Messages are consumed from its front by moving an
+ * offset, so several pipelined messages are parsed out of one read without
+ * copying what follows them. The unconsumed tail is only moved back to the
+ * front when there is no room left for the next read.
+ */
+class ConnectionBuffer
+{
+public:
+  /** This is how much room is made for a read by default */
+  static constexpr size_t DEFAULT_READ_SIZE = 16384;
+
+  /**
+   * This constructs an empty buffer
+   *
+   * @param[in] initialCapacity
+   *    This is how much memory to set aside up front
+   */
+  explicit ConnectionBuffer(size_t initialCapacity = DEFAULT_READ_SIZE);
+
+  /**
+   * This method returns the data that has been received but not consumed
+   */
+  [[nodiscard]] std::string_view Readable() const;
+
+  /**
+   * This method drops data from the front of the buffer once it has been
+   * parsed
+   *
+   * @param[in] count
+   *    This is the number of bytes to drop; it must not be more than the
+   *    size of Readable()
+   */
+  void Consume(size_t count);
+
+  /**
+   * This method makes room at the end of the buffer for new data
+   *
+   * @param[in] minimum
+   *    This is the least number of bytes to make room for
+   *
+   * @return
+   *    The room at the end of the buffer, at least minimum bytes long. It is
+   *    valid until the next call that changes the buffer.
+   */
+  [[nodiscard]] std::span<char> PrepareWrite(size_t minimum = DEFAULT_READ_SIZE);
+
+  /**
+   * This method adds the given number of bytes, written to the room given by
+   * PrepareWrite, to the readable data
+   */
+  void CommitWrite(size_t count);
+
+  /**
+   * This method copies the data to the end of the buffer
+   */
+  void Append(std::string_view data);
+
+  /**
+   * This method reads once from the file descriptor into the buffer
+   *
+   * @param[in] fileDescriptor
+   *    This is the connection to read from
+   *
+   * @return
+   *    The result of read(2): the number of bytes read, 0 at the end of the
+   *    stream or -1 with errno set
+   */
+  ssize_t ReadFrom(int fileDescriptor);
+
+private:
+  std::vector<char> storage_;
+  size_t begin_ = 0;
+  size_t end_ = 0;
+};
+
+}// namespace InternetMessage
+
+#endif// !CONNECTION_BUFFER_HPP
@@ -0,0 +1,173 @@
+#ifndef HEADER_VALUE_HPP
+#define HEADER_VALUE_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace InternetMessage {
+
+/**
+ * These functions and tokenizers take header values apart without copying
+ * them. Every view they return points into the value given to them, so it
+ * is valid for as long as that value is.
+ */
+
+/**
+ * This function returns the text without the optional whitespace, spaces
+ * and horizontal tabs, at its beginning and end (RFC 9110 section 5.6.3)
+ */
+[[nodiscard]] std::string_view TrimWhiteSpace(std::string_view text);
+
+/**
+ * This function checks if two strings are the same when the case of ASCII
+ * letters is not taken into account, as is done with header names, tokens
+ * such as "gzip" and parameter names
+ */
+[[nodiscard]] bool EqualsIgnoringCase(std::string_view lhs, std::string_view rhs);
+
+/**
+ * This function returns the length of the quoted-string at the front of the
+ * text, quotes included (RFC 9110 section 5.6.4)
+ *
+ * @return
+ *    The length, or npos if the text does not begin with a quoted-string or
+ *    it is not closed
+ */
+[[nodiscard]] size_t QuotedStringLength(std::string_view text);
+
+/**
+ * This function appends the content of a quoted-string to a string,
+ * replacing each quoted-pair with the character it escapes. It is only
+ * needed when the content has a backslash in it.
+ *
+ * @param[in] content
+ *    This is the text between the quotes
+ *
+ * @param[in,out] unquoted
+ *    This is where the content is appended
+ */
+void AppendUnquoted(std::string_view content, std::string &unquoted);
+
+/**
+ * This is a "name=value" pair, as found in the parameters of media types and
+ * in Cache-Control directives
+ */
+struct Parameter
+{
+  std::string_view name;
+
+  /**
+   * This is the value, which is empty when there is no "=", without its
+   * quotes if it is a quoted-string
+   */
+  std::string_view value;
+
+  /** This tells if the value was a quoted-string */
+  bool quoted = false;
+};
+
+/**
+ * This function splits "name=value" at the first "=", trimming both parts
+ * and taking off the quotes of a quoted-string value
+ */
+[[nodiscard]] Parameter SplitParameter(std::string_view text);
+
+/**
+ * This goes through the elements of a comma separated list (RFC 9110
+ * section 5.6.1), as found in Connection, Cache-Control and Accept-Encoding.
+ * Elements are trimmed, empty elements are skipped as the RFC requires, and
+ * commas inside quoted-strings do not split.
+ *
+ * @code
+ * ListTokenizer tokenizer(value);
+ * for (std::string_view element; tokenizer.Next(element);) { ... }
+ * @endcode
+ */
+class ListTokenizer
+{
+public:
+  explicit ListTokenizer(std::string_view value);
+
+  /**
+   * This method gives the next element of the list
+   *
+   * @param[out] element
+   *    This is set to the next element when there is one
+   *
+   * @return
+   *    False once the list has no more elements
+   */
+  bool Next(std::string_view &element);
+
+private:
+  std::string_view rest_;
+};
+
+/**
+ * This goes through a value followed by parameters separated by ";", as in
+ * Content-Type ("text/html; charset=utf-8"), Content-Disposition and each
+ * element of Accept-Encoding ("gzip;q=0.8"). Semicolons inside
+ * quoted-strings do not split.
+ */
+class ParameterTokenizer
+{
+public:
+  explicit ParameterTokenizer(std::string_view element);
+
+  /**
+   * This method returns the trimmed part before the first parameter
+   */
+  [[nodiscard]] std::string_view Value() const;
+
+  /**
+   * This method gives the next parameter, skipping empty ones
+   *
+   * @param[out] parameter
+   *    This is set to the next parameter when there is one
+   *
+   * @return
+   *    False once there are no more parameters
+   */
+  bool Next(Parameter &parameter);
+
+private:
+  std::string_view value_;
+  std::string_view rest_;
+};
+
+/**
+ * This function parses a quality value (RFC 9110 section 12.4.2)
+ *
+ * @return
+ *    The weight in thousandths, from 0 to 1000, or nothing if the text is
+ *    not a quality value
+ */
+[[nodiscard]] std::optional<unsigned int> ParseQuality(std::string_view text);
+
+/**
+ * This is an element of a list whose elements are weighted, such as
+ * Accept-Encoding
+ */
+struct WeightedValue
+{
+  std::string_view value;
+
+  /** This is the weight in thousandths; it is 1000 without a "q" parameter */
+  unsigned int quality = 1000;
+};
+
+/**
+ * This function splits an element such as "gzip;q=0.8" into its value and
+ * weight
+ *
+ * @return
+ *    The value and weight, or nothing if the "q" parameter is not a quality
+ *    value
+ */
+[[nodiscard]] std::optional<WeightedValue> ParseWeightedValue(std::string_view element);
+
+}// namespace InternetMessage
+
+#endif// !HEADER_VALUE_HPP
@@ -1,11 +1,50 @@
 #ifndef INTERNET_MESSAGE_HPP
 #define INTERNET_MESSAGE_HPP
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace InternetMessage {
 
+/** These are the reasons why a raw message can not be parsed */
+enum class ParseError : uint8_t {
+  none,
+  missing_header_delimiter,
+  incomplete,
+  invalid_content_length,
+  unsupported_transfer_encoding,
+  invalid_request_line,
+  headers_too_long,
+};
+
+/**
+ * This is the outcome of parsing a raw message. It converts to true when
+ * the message was valid; otherwise it tells what was wrong and the byte of
+ * the message where the problem was found.
+ */
+struct ParseResult
+{
+  ParseError error = ParseError::none;
+  size_t offset = 0;
+
+  [[nodiscard]] constexpr explicit operator bool() const noexcept
+  {
+    return error == ParseError::none;
+  }
+
+  [[nodiscard]] constexpr bool operator==(const ParseResult &other) const noexcept = default;
+};
+
+/**
+ * This function returns a short description of the error, to be used in
+ * logs and error responses
+ */
+[[nodiscard]] std::string_view ToString(ParseError error);
+
 class InternetMessage
 {
 public:
@@ -42,27 +81,78 @@ public:
   };
 
   using Headers = std::vector<Header>;
+
+  /** This is how long the headers of a message may be by default */
+  static constexpr size_t DEFAULT_MAX_HEADER_BYTES = 65536;
+
   /** Default constructor */
   InternetMessage();
 
-  /** Destructor, copy and move operators */
+  /**
+   * Destructor, copy and move operators. A message that has been moved from
+   * may only be assigned to or destroyed.
+   */
   ~InternetMessage();
   InternetMessage(const InternetMessage &) = delete;
-  InternetMessage(InternetMessage &&) = delete;
-  InternetMessage operator=(const InternetMessage &) = delete;
-  InternetMessage operator=(InternetMessage &&) = delete;
+  InternetMessage(InternetMessage &&) noexcept;
+  InternetMessage &operator=(const InternetMessage &) = delete;
+  InternetMessage &operator=(InternetMessage &&) noexcept;
+
+  /**
+   * This method removes the headers and body, keeping the memory they held
+   * so that the next parse into the message can reuse it. Every parse
+   * starts with a reset, so a connection can keep one message for all the
+   * requests it receives.
+   */
+  void Reset();
+
+  /**
+   * This method sets how long the headers of a message parsed with
+   * ParseFromBuffer may be, empty line included, so that a peer that never
+   * ends its headers can not make the buffer grow without bound
+   *
+   * @param[in] maxHeaderBytes
+   *    This is how long the headers may be
+   */
+  void SetMaxHeaderBytes(size_t maxHeaderBytes);
 
   /**
    * This method determines the headers and body of the message by parsing the
-   * raw message from a string
+   * raw message from a string, replacing those of any previous parse
    *
    * @param[in] msgString
    *    This is the string
    *
    * @return
-   *    An indication of wheter or not the string has parsed successfully
+   *    The result of the parse, which is true if the string has parsed
+   *    successfully and otherwise holds the error and where it was found
    */
-  bool ParseFromRawMessage(const std::string &rawMessage);
+  ParseResult ParseFromRawMessage(const std::string &rawMessage);
+
+  /**
+   * This method parses one whole message from the front of a buffer that may
+   * hold several messages back to back, as pipelined HTTP/1.1 requests do.
+   * The headers end with an empty line and the Content-Length header gives
+   * the length of the body; a message without one has no body.
+   *
+   * @param[in] buffer
+   *    This is the data received so far. Only the message itself is copied,
+   *    whatever follows it is left in place for the next call.
+   *
+   * @param[out] consumed
+   *    This is set to the number of bytes the message takes up at the front
+   *    of the buffer when the parse succeeds
+   *
+   * @return
+   *    The result of the parse. ParseError::incomplete means that the buffer
+   *    does not hold the whole message yet and the parse should be retried
+   *    once more data has arrived, with the same buffer grown at its end:
+   *    the bytes already looked at are not scanned again. Any other result,
+   *    or a Reset, starts the next call afresh.
+   *    ParseError::headers_too_long means that the headers are longer than
+   *    SetMaxHeaderBytes allows.
+   */
+  ParseResult ParseFromBuffer(std::string_view buffer, size_t &consumed);
 
   /**
    * @brief This method returns the raw string internet message based on the
@@ -93,6 +183,34 @@ public:
    */
   [[nodiscard]] bool HasHeader(const HeaderName &name) const;
 
+  /**
+   * This method looks up the value of the first header with the given name.
+   * Header names are compared without regard to case.
+   *
+   * @param[in] name
+   *    This is the name of the header to look up
+   *
+   * @return
+   *    The value of the header, or nothing if the message has no header with
+   *    the given name
+   */
+  [[nodiscard]] std::optional<HeaderValue> GetHeaderValue(const HeaderName &name) const;
+
+  /**
+   * This method looks up the value of the first header with the given name,
+   * like GetHeaderValue, without copying it. Tokenizers from
+   * header_value.hpp can take the value apart from there.
+   *
+   * @param[in] name
+   *    This is the name of the header to look up
+   *
+   * @return
+   *    A view of the value, valid until the message is parsed into again,
+   *    reset or destroyed, or nothing if the message has no header with the
+   *    given name
+   */
+  [[nodiscard]] std::optional<std::string_view> GetHeaderView(std::string_view name) const;
+
   /**
    * This method returns the part of the message that follows all the headers,
    * and represent the principal content of the overall message
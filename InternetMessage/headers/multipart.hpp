@@ -0,0 +1,210 @@
+#ifndef MULTIPART_HPP
+#define MULTIPART_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace InternetMessage {
+
+class InternetMessage;
+
+/** These are the reasons why a multipart body can not be parsed */
+enum class MultipartError : uint8_t {
+  none,
+  part_headers_too_long,
+  invalid_part_headers,
+  invalid_delimiter,
+  truncated,
+  aborted,
+};
+
+/**
+ * This function returns the boundary of a multipart media type such as
+ * "multipart/form-data; boundary=xyz" (RFC 2046 section 5.1.1)
+ *
+ * @return
+ *    The boundary, unquoted, or nothing if the media type is not multipart
+ *    or has no valid boundary
+ */
+[[nodiscard]] std::optional<std::string> BoundaryOf(std::string_view contentType);
+
+/**
+ * This parses a multipart body, such as a multipart/form-data upload, as it
+ * arrives, in chunks of any size. Part headers are parsed into an
+ * InternetMessage, and part data is handed on as soon as it is known not to
+ * be part of a delimiter, so memory use does not grow with the size of the
+ * body: at most a delimiter's length of data is carried from one chunk to
+ * the next, plus the headers of the current part.
+ *
+ * Delimiters are searched for with the Boyer-Moore-Horspool algorithm,
+ * which skips over most of the part data without looking at every byte.
+ */
+class MultipartParser
+{
+public:
+  /**
+   * This is called with the headers of each part before its data. The
+   * message is valid until the call returns.
+   */
+  using PartBegin = std::function<bool(const InternetMessage &headers)>;
+
+  /** This is called with each piece of data of the current part */
+  using PartData = std::function<bool(std::string_view data)>;
+
+  /** This is called once all the data of the current part has been given */
+  using PartEnd = std::function<bool()>;
+
+  /** This is how long the headers of a part may be by default */
+  static constexpr size_t DEFAULT_MAX_HEADER_BYTES = 8192;
+
+  /** Destructor, copy and move operators */
+  ~MultipartParser();
+  MultipartParser(const MultipartParser &) = delete;
+  MultipartParser(MultipartParser &&) noexcept;
+  MultipartParser &operator=(const MultipartParser &) = delete;
+  MultipartParser &operator=(MultipartParser &&) noexcept;
+
+  /**
+   * This constructs a parser for a body with the given boundary. Any of the
+   * callbacks may return false to stop the parse.
+   *
+   * @param[in] boundary
+   *    This is the boundary, as returned by BoundaryOf
+   *
+   * @param[in] partBegin
+   *    This is called with the headers of each part
+   *
+   * @param[in] partData
+   *    This is called with the data of the current part, in pieces
+   *
+   * @param[in] partEnd
+   *    This is called at the end of each part
+   *
+   * @param[in] maxHeaderBytes
+   *    This is how long the headers of one part may be
+   */
+  MultipartParser(std::string_view boundary,
+    PartBegin partBegin,
+    PartData partData,
+    PartEnd partEnd,
+    size_t maxHeaderBytes = DEFAULT_MAX_HEADER_BYTES);
+
+  /**
+   * This method parses the next chunk of the body
+   *
+   * @return
+   *    MultipartError::none, or the reason the body can not be parsed, after
+   *    which the parser takes no more chunks
+   */
+  MultipartError Feed(std::string_view chunk);
+
+  /**
+   * This method is called once the whole body has been fed
+   *
+   * @return
+   *    MultipartError::truncated if the close delimiter has not been seen,
+   *    or the error that stopped the parse earlier
+   */
+  [[nodiscard]] MultipartError Finish() const;
+
+  /**
+   * This method returns true once the close delimiter has been parsed
+   */
+  [[nodiscard]] bool Done() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+/**
+ * This is somewhere to put the data of a part. It is kept in memory while it
+ * is small and moved to an anonymous temporary file, which disappears when
+ * it is closed, once it grows past a threshold.
+ */
+class SpooledBody
+{
+public:
+  /** This is how much data is kept in memory by default */
+  static constexpr size_t DEFAULT_MEMORY_THRESHOLD = 65536;
+
+  /** Destructor, copy and move operators */
+  ~SpooledBody();
+  SpooledBody(const SpooledBody &) = delete;
+  SpooledBody(SpooledBody &&) noexcept;
+  SpooledBody &operator=(const SpooledBody &) = delete;
+  SpooledBody &operator=(SpooledBody &&) noexcept;
+
+  /**
+   * This constructs an empty body
+   *
+   * @param[in] memoryThreshold
+   *    This is the most data kept in memory
+   *
+   * @param[in] directory
+   *    This is where the temporary file is made; an empty string means the
+   *    system's temporary directory
+   */
+  explicit SpooledBody(size_t memoryThreshold = DEFAULT_MEMORY_THRESHOLD,
+    std::string directory = "");
+
+  /**
+   * This method appends data to the body
+   *
+   * @return
+   *    True, or false with errno set if the temporary file could not be made
+   *    or written. Once a write fails the body is incomplete, so every later
+   *    write fails too.
+   */
+  bool Write(std::string_view data);
+
+  /**
+   * This method returns the number of bytes written
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * This method returns true if the body has been moved to a file
+   */
+  [[nodiscard]] bool InFile() const;
+
+  /**
+   * This method returns the body while it is in memory
+   */
+  [[nodiscard]] std::string_view Memory() const;
+
+  /**
+   * This method returns the temporary file once the body is in one, or -1
+   */
+  [[nodiscard]] int FileDescriptor() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace InternetMessage
+
+#endif// !MULTIPART_HPP
@@ -0,0 +1,50 @@
+#ifndef REQUEST_LINE_HPP
+#define REQUEST_LINE_HPP
+
+#include "internet_message.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace InternetMessage {
+
+/**
+ * This is the first line of an HTTP/1.1 request, which comes before the
+ * headers: method SP request-target SP HTTP-version CRLF (RFC 7230 section
+ * 3.1.1)
+ */
+struct RequestLine
+{
+  /** This is the method of the request, such as "GET" */
+  std::string method;
+
+  /** This is the target of the request, usually an origin-form URI */
+  std::string target;
+
+  /** This is the protocol version, such as "HTTP/1.1" */
+  std::string version;
+};
+
+/**
+ * This function parses the request line at the front of the buffer. Empty
+ * lines before it are skipped, as RFC 7230 section 3.5 recommends.
+ *
+ * @param[in] buffer
+ *    This is the data received so far
+ *
+ * @param[out] requestLine
+ *    This is where the parts of the request line are stored
+ *
+ * @param[out] consumed
+ *    This is set to the number of bytes the request line, with its line
+ *    terminator, takes up at the front of the buffer when the parse succeeds
+ *
+ * @return
+ *    The result of the parse. ParseError::incomplete means that the line
+ *    has not been received whole yet.
+ */
+ParseResult ParseRequestLine(std::string_view buffer, RequestLine &requestLine, size_t &consumed);
+
+}// namespace InternetMessage
+
+#endif// !REQUEST_LINE_HPP
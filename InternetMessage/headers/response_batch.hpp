@@ -0,0 +1,65 @@
+#ifndef RESPONSE_BATCH_HPP
+#define RESPONSE_BATCH_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace InternetMessage {
+
+/**
+ * This collects the responses to pipelined requests so that they are sent
+ * together with as few writev(2) calls as possible, rather than with one
+ * system call per response
+ */
+class ResponseBatch
+{
+public:
+  /**
+   * This method queues a response to be sent by the next flush
+   *
+   * @param[in] response
+   *    This is the whole response, as generated by the message
+   */
+  void Add(std::string response);
+
+  /**
+   * This method checks if there is nothing left to send
+   */
+  [[nodiscard]] bool Empty() const;
+
+  /**
+   * This method returns the number of bytes queued but not yet sent
+   */
+  [[nodiscard]] size_t PendingBytes() const;
+
+  /**
+   * This method sends the queued responses, in order, to the file
+   * descriptor, gathering them into writev(2) calls
+   *
+   * @param[in] fileDescriptor
+   *    This is the connection to write to
+   *
+   * @return
+   *    True if everything was sent, or false if the file descriptor is non
+   *    blocking and would block, in which case what was not sent stays
+   *    queued for the next flush
+   *
+   * @throws std::system_error
+   *    If writing fails for any other reason
+   */
+  bool Flush(int fileDescriptor);
+
+private:
+  std::vector<std::string> responses_;
+
+  /** This is the first response that has not been sent whole */
+  size_t first_ = 0;
+
+  /** This is how much of the first response has already been sent */
+  size_t firstOffset_ = 0;
+};
+
+}// namespace InternetMessage
+
+#endif// !RESPONSE_BATCH_HPP
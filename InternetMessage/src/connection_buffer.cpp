@@ -0,0 +1,61 @@
+#include "connection_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+
+namespace InternetMessage {
+
+ConnectionBuffer::ConnectionBuffer(size_t initialCapacity) : storage_(initialCapacity) {}
+
+std::string_view ConnectionBuffer::Readable() const
+{
+  return { storage_.data() + begin_, end_ - begin_ };
+}
+
+void ConnectionBuffer::Consume(size_t count)
+{
+  begin_ += std::min(count, end_ - begin_);
+
+  // Once everything has been consumed the next read can start at the front
+  // for free
+  if (begin_ == end_) {
+    begin_ = 0;
+    end_ = 0;
+  }
+}
+
+std::span<char> ConnectionBuffer::PrepareWrite(size_t minimum)
+{
+  if (storage_.size() - end_ < minimum) {
+    const auto readable = end_ - begin_;
+    if (readable + minimum > storage_.size()) {
+      storage_.resize(std::max(storage_.size() * 2, readable + minimum));
+    }
+    if (begin_ > 0) {
+      std::memmove(storage_.data(), storage_.data() + begin_, readable);
+      begin_ = 0;
+      end_ = readable;
+    }
+  }
+  return { storage_.data() + end_, storage_.size() - end_ };
+}
+
+void ConnectionBuffer::CommitWrite(size_t count) { end_ = std::min(end_ + count, storage_.size()); }
+
+void ConnectionBuffer::Append(std::string_view data)
+{
+  const auto room = PrepareWrite(data.size());
+  std::copy(data.begin(), data.end(), room.begin());
+  CommitWrite(data.size());
+}
+
+ssize_t ConnectionBuffer::ReadFrom(int fileDescriptor)
+{
+  const auto room = PrepareWrite();
+  const auto received = ::read(fileDescriptor, room.data(), room.size());
+  if (received > 0) { CommitWrite(static_cast<size_t>(received)); }
+  return received;
+}
+
+}// namespace InternetMessage
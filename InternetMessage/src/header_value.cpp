@@ -0,0 +1,162 @@
+#include "header_value.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/** These are the characters of optional whitespace */
+constexpr std::string_view OPTIONAL_WHITESPACE = " \t";
+
+/**
+ * This function finds the first delimiter in the text that is not inside a
+ * quoted-string
+ *
+ * @return
+ *    The position of the delimiter, or npos if there is none
+ */
+size_t FindOutsideQuotes(std::string_view text, char delimiter)
+{
+  for (size_t position = 0; position < text.size(); ++position) {
+    if (text[position] == '"') {
+      const auto length = InternetMessage::QuotedStringLength(text.substr(position));
+      if (length == std::string_view::npos) { return std::string_view::npos; }
+      position += length - 1;
+    } else if (text[position] == delimiter) {
+      return position;
+    }
+  }
+  return std::string_view::npos;
+}
+
+/**
+ * This function takes the next non-empty part, trimmed, off the front of a
+ * text separated by the delimiter
+ */
+bool NextPart(std::string_view &rest, char delimiter, std::string_view &part)
+{
+  while (!rest.empty()) {
+    const auto end = FindOutsideQuotes(rest, delimiter);
+    const auto candidate = InternetMessage::TrimWhiteSpace(rest.substr(0, end));
+    rest = end == std::string_view::npos ? std::string_view() : rest.substr(end + 1);
+    if (!candidate.empty()) {
+      part = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+}// namespace
+
+namespace InternetMessage {
+
+std::string_view TrimWhiteSpace(std::string_view text)
+{
+  const auto begin = text.find_first_not_of(OPTIONAL_WHITESPACE);
+  if (begin == std::string_view::npos) { return {}; }
+  const auto end = text.find_last_not_of(OPTIONAL_WHITESPACE);
+  return text.substr(begin, end - begin + 1);
+}
+
+bool EqualsIgnoringCase(std::string_view lhs, std::string_view rhs)
+{
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char left, char right) {
+    const auto lower = [](char character) {
+      return (character >= 'A' && character <= 'Z') ? static_cast<char>(character - 'A' + 'a')
+                                                     : character;
+    };
+    return lower(left) == lower(right);
+  });
+}
+
+size_t QuotedStringLength(std::string_view text)
+{
+  if (text.empty() || text.front() != '"') { return std::string_view::npos; }
+  for (size_t position = 1; position < text.size(); ++position) {
+    if (text[position] == '\\') {
+      ++position;
+    } else if (text[position] == '"') {
+      return position + 1;
+    }
+  }
+  return std::string_view::npos;
+}
+
+void AppendUnquoted(std::string_view content, std::string &unquoted)
+{
+  for (size_t position = 0; position < content.size(); ++position) {
+    if (content[position] == '\\' && position + 1 < content.size()) { ++position; }
+    unquoted.push_back(content[position]);
+  }
+}
+
+Parameter SplitParameter(std::string_view text)
+{
+  Parameter parameter;
+  const auto equals = text.find('=');
+  parameter.name = TrimWhiteSpace(text.substr(0, equals));
+  if (equals == std::string_view::npos) { return parameter; }
+
+  parameter.value = TrimWhiteSpace(text.substr(equals + 1));
+  if (!parameter.value.empty() && QuotedStringLength(parameter.value) == parameter.value.size()) {
+    parameter.value = parameter.value.substr(1, parameter.value.size() - 2);
+    parameter.quoted = true;
+  }
+  return parameter;
+}
+
+ListTokenizer::ListTokenizer(std::string_view value) : rest_(value) {}
+
+bool ListTokenizer::Next(std::string_view &element) { return NextPart(rest_, ',', element); }
+
+ParameterTokenizer::ParameterTokenizer(std::string_view element)
+{
+  const auto semicolon = FindOutsideQuotes(element, ';');
+  value_ = TrimWhiteSpace(element.substr(0, semicolon));
+  if (semicolon != std::string_view::npos) { rest_ = element.substr(semicolon + 1); }
+}
+
+std::string_view ParameterTokenizer::Value() const { return value_; }
+
+bool ParameterTokenizer::Next(Parameter &parameter)
+{
+  std::string_view part;
+  if (!NextPart(rest_, ';', part)) { return false; }
+  parameter = SplitParameter(part);
+  return true;
+}
+
+std::optional<unsigned int> ParseQuality(std::string_view text)
+{
+  constexpr unsigned int MOST = 1000;
+  constexpr size_t MOST_DECIMALS = 3;
+  if (text.empty() || (text.front() != '0' && text.front() != '1')) { return std::nullopt; }
+  const bool one = text.front() == '1';
+  if (text.size() == 1) { return one ? MOST : 0; }
+  if (text[1] != '.' || text.size() - 2 > MOST_DECIMALS) { return std::nullopt; }
+
+  unsigned int quality = 0;
+  unsigned int scale = MOST;
+  for (const auto digit : text.substr(2)) {
+    if (digit < '0' || digit > '9') { return std::nullopt; }
+    scale /= 10;
+    quality += static_cast<unsigned int>(digit - '0') * scale;
+  }
+  if (one) { return quality == 0 ? std::optional(MOST) : std::nullopt; }
+  return quality;
+}
+
+std::optional<WeightedValue> ParseWeightedValue(std::string_view element)
+{
+  ParameterTokenizer tokenizer(element);
+  WeightedValue weighted{ tokenizer.Value() };
+  for (Parameter parameter; tokenizer.Next(parameter);) {
+    if (!EqualsIgnoringCase(parameter.name, "q")) { continue; }
+    const auto quality = ParseQuality(parameter.value);
+    if (!quality) { return std::nullopt; }
+    weighted.quality = *quality;
+  }
+  return weighted;
+}
+
+}// namespace InternetMessage
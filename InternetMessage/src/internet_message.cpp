@@ -1,5 +1,8 @@
 #include "internet_message.hpp"
+#include "header_value.hpp"
+#include "instrumentation.hpp"
 #include <algorithm>
+#include <charconv>
 #include <sstream>
 
 namespace {
@@ -7,8 +10,8 @@ namespace {
 /** These are the characters thar are considered whitespace*/
 constexpr const char *WHITESPACE = " \r\n\t";
 /**
- * This function returns a copy of the given string, whith any whitespace
- * at the begging and end stripped off.
+ * This function returns the part of the given string left once any
+ * whitespace at the begging and end is stripped off.
  *
  * @param[in] rawString
  *  This is the string to strip.
@@ -16,22 +19,142 @@ constexpr const char *WHITESPACE = " \r\n\t";
  * @return
  *  The stripped string is reutrned.
  */
-std::string StripWhiteSpaceMargins(const std::string &rawString)
+std::string_view StripWhiteSpaceMargins(std::string_view rawString)
 {
   const auto marginLeft = rawString.find_first_not_of(WHITESPACE);
   const auto marginRight = rawString.find_last_not_of(WHITESPACE);
 
   if (marginLeft == std::string::npos) {
-    return "";
+    return {};
   } else {
     return rawString.substr(marginLeft, marginRight - marginLeft + 1);
   }
 }
 
+/**
+ * This function parses the header lines at the front of a message, stopping
+ * after the empty line that ends them or where the lines run out
+ *
+ * @param[in] rawMessage
+ *  This is the message to parse
+ *
+ * @param[out] headers
+ *  This is where the headers are appended
+ *
+ * @param[in,out] spareHeaders
+ *  These are cleared headers whose strings are reused for the new headers
+ *  before any memory is allocated
+ *
+ * @param[in,out] offset
+ *  This is where the header lines begin; it is left just past the empty line
+ *  or at the first line without a line terminator, or at the line without a
+ *  colon if there is one
+ *
+ * @return
+ *  An indication of whether or not every header line had a colon
+ */
+bool ParseHeaderLines(std::string_view rawMessage,
+  InternetMessage::InternetMessage::Headers &headers,
+  InternetMessage::InternetMessage::Headers &spareHeaders,
+  size_t &offset)
+{
+  while (offset < rawMessage.size()) {
+    auto lineTerminator = rawMessage.find("\r\n", offset);
+    if (lineTerminator == std::string::npos) { break; }
+    if (lineTerminator == offset) {
+      offset = lineTerminator + 2;
+      break;
+    }
+    auto nameValueDelimiter = rawMessage.find(':', offset);
+    if (nameValueDelimiter == std::string::npos || nameValueDelimiter > lineTerminator) {
+      return false;
+    }
+
+    const auto name = rawMessage.substr(offset, nameValueDelimiter - offset);
+    const auto value = StripWhiteSpaceMargins(
+      rawMessage.substr(nameValueDelimiter + 1, lineTerminator - nameValueDelimiter));
+    if (spareHeaders.empty()) {
+      headers.emplace_back(std::string(name), std::string(value));
+    } else {
+      auto &header = headers.emplace_back(std::move(spareHeaders.back()));
+      spareHeaders.pop_back();
+      header.name.assign(name);
+      header.value.assign(value);
+    }
+    offset = lineTerminator + 2;
+  }
+
+  // Make room for the headers to be recycled by the next parse
+  spareHeaders.reserve(spareHeaders.size() + headers.size());
+  return true;
+}
+
+/**
+ * This function works out how long the body of a message is from its
+ * headers, as described in RFC 7230 section 3.3.3 for requests: the
+ * Content-Length header gives the length and a message without one has no
+ * body
+ *
+ * @param[in] headers
+ *  These are the headers of the message
+ *
+ * @param[out] bodyLength
+ *  This is where the length of the body is stored
+ *
+ * @return
+ *  ParseError::none if the length could be worked out, or the reason why
+ *  it could not
+ */
+InternetMessage::ParseError FindBodyLength(const InternetMessage::InternetMessage::Headers &headers,
+  size_t &bodyLength)
+{
+  bool hasContentLength = false;
+  bodyLength = 0;
+
+  for (const auto &header : headers) {
+    if (InternetMessage::EqualsIgnoringCase(header.name, "Transfer-Encoding")) {
+      return InternetMessage::ParseError::unsupported_transfer_encoding;
+    }
+    if (!InternetMessage::EqualsIgnoringCase(header.name, "Content-Length")) { continue; }
+
+    size_t length = 0;
+    const auto *const valueEnd = header.value.data() + header.value.size();
+    const auto [end, error] = std::from_chars(header.value.data(), valueEnd, length);
+    if (header.value.empty() || error != std::errc() || end != valueEnd
+        || (hasContentLength && length != bodyLength)) {
+      return InternetMessage::ParseError::invalid_content_length;
+    }
+    hasContentLength = true;
+    bodyLength = length;
+  }
+  return InternetMessage::ParseError::none;
+}
+
 };// namespace
 
 namespace InternetMessage {
 
+std::string_view ToString(ParseError error)
+{
+  switch (error) {
+  case ParseError::none:
+    return "no error";
+  case ParseError::missing_header_delimiter:
+    return "header line without a colon";
+  case ParseError::incomplete:
+    return "incomplete message";
+  case ParseError::invalid_content_length:
+    return "invalid Content-Length";
+  case ParseError::unsupported_transfer_encoding:
+    return "unsupported Transfer-Encoding";
+  case ParseError::invalid_request_line:
+    return "invalid request line";
+  case ParseError::headers_too_long:
+    return "headers too long";
+  }
+  return "unknown error";
+}
+
 InternetMessage::Header::Header(HeaderName newName, HeaderValue newValue)
   : name(std::move(newName)), value(std::move(newValue))
 {}
@@ -40,35 +163,145 @@ struct InternetMessage::Implementation
 {
   Headers headers;
   std::string body;
+
+  /**
+   * These are the headers of previous messages, cleared and kept so that
+   * their strings can be reused by the next parse
+   */
+  Headers spareHeaders;
+
+  /** This is how long the headers given to ParseFromBuffer may be */
+  size_t maxHeaderBytes = DEFAULT_MAX_HEADER_BYTES;
+
+  /**
+   * These carry an incomplete ParseFromBuffer over to the next call: how
+   * much of the buffer was searched for the end of the headers, and where
+   * the headers end and how long the body is once they have been parsed
+   */
+  size_t scannedBytes = 0;
+  size_t headersEnd = 0;
+  size_t bodyLength = 0;
+
+  // Methods
+
+  void Reset()
+  {
+    scannedBytes = 0;
+    headersEnd = 0;
+    bodyLength = 0;
+    for (auto &header : headers) {
+      header.name.clear();
+      header.value.clear();
+      spareHeaders.push_back(std::move(header));
+    }
+    headers.clear();
+    body.clear();
+  }
 };
 
 InternetMessage::~InternetMessage() = default;
 
+InternetMessage::InternetMessage(InternetMessage &&) noexcept = default;
+
+InternetMessage &InternetMessage::operator=(InternetMessage &&) noexcept = default;
+
 InternetMessage::InternetMessage() : impl_(new Implementation) {}
 
-bool InternetMessage::ParseFromRawMessage(const std::string &rawMessage)
+void InternetMessage::Reset() { impl_->Reset(); }
+
+void InternetMessage::SetMaxHeaderBytes(size_t maxHeaderBytes)
 {
+  impl_->maxHeaderBytes = maxHeaderBytes;
+}
+
+ParseResult InternetMessage::ParseFromRawMessage(const std::string &rawMessage)
+{
+  Instrumentation::ParseScope parseScope(
+    Instrumentation::Library::internet_message, rawMessage.size());
   size_t offset = 0;
 
-  while (offset < rawMessage.size()) {
-    auto lineTerminator = rawMessage.find("\r\n", offset);
-    if (lineTerminator == std::string::npos) { break; }
-    if (lineTerminator == offset) {
-      offset = lineTerminator + 2;
-      break;
+  impl_->Reset();
+  if (!ParseHeaderLines(rawMessage, impl_->headers, impl_->spareHeaders, offset)) {
+    Instrumentation::CountFailure(Instrumentation::Library::internet_message,
+      Instrumentation::FailureReason::missing_header_delimiter);
+    return { ParseError::missing_header_delimiter, offset };
+  }
+
+  impl_->body.assign(rawMessage, offset);
+  parseScope.Succeed();
+  return {};
+}
+
+ParseResult InternetMessage::ParseFromBuffer(std::string_view buffer, size_t &consumed)
+{
+  // Only the bytes of a message that is parsed whole are charged, not those
+  // of the calls that find it incomplete nor of the messages behind it
+  Instrumentation::ParseScope parseScope(Instrumentation::Library::internet_message, 0);
+
+  // Nothing is parsed until the empty line ending the headers has arrived,
+  // and each call only searches the bytes added since the last one, so a
+  // message received in many small reads is not scanned over and over
+  if (impl_->headersEnd == 0) {
+    constexpr std::string_view EMPTY_LINE = "\r\n\r\n";
+    size_t headersEnd = 2;
+    if (buffer.substr(0, 2) != "\r\n") {
+      const auto searchFrom =
+        impl_->scannedBytes < EMPTY_LINE.size() ? 0 : impl_->scannedBytes - EMPTY_LINE.size() + 1;
+      const auto emptyLine =
+        searchFrom > buffer.size() ? std::string_view::npos : buffer.find(EMPTY_LINE, searchFrom);
+      if (emptyLine == std::string_view::npos) {
+        if (buffer.size() > impl_->maxHeaderBytes) {
+          impl_->Reset();
+          Instrumentation::CountFailure(Instrumentation::Library::internet_message,
+            Instrumentation::FailureReason::headers_too_long);
+          return { ParseError::headers_too_long, impl_->maxHeaderBytes };
+        }
+        impl_->scannedBytes = buffer.size();
+        parseScope.Succeed();
+        return { ParseError::incomplete, buffer.size() };
+      }
+      headersEnd = emptyLine + EMPTY_LINE.size();
     }
-    auto nameValueDelimiter = rawMessage.find(':', offset);
-    if (nameValueDelimiter == std::string::npos) { return false; }
 
-    HeaderName name = rawMessage.substr(offset, nameValueDelimiter - offset);
-    HeaderValue value =
-      rawMessage.substr(nameValueDelimiter + 1, lineTerminator - nameValueDelimiter);
-    impl_->headers.emplace_back(name, StripWhiteSpaceMargins(value));
-    offset = lineTerminator + 2;
+    impl_->Reset();
+    if (headersEnd > impl_->maxHeaderBytes) {
+      Instrumentation::CountFailure(Instrumentation::Library::internet_message,
+        Instrumentation::FailureReason::headers_too_long);
+      return { ParseError::headers_too_long, impl_->maxHeaderBytes };
+    }
+
+    size_t offset = 0;
+    const auto headerLines = buffer.substr(0, headersEnd);
+    if (!ParseHeaderLines(headerLines, impl_->headers, impl_->spareHeaders, offset)) {
+      Instrumentation::CountFailure(Instrumentation::Library::internet_message,
+        Instrumentation::FailureReason::missing_header_delimiter);
+      return { ParseError::missing_header_delimiter, offset };
+    }
+
+    size_t bodyLength = 0;
+    if (const auto error = FindBodyLength(impl_->headers, bodyLength);
+        error != ParseError::none) {
+      Instrumentation::CountFailure(Instrumentation::Library::internet_message,
+        Instrumentation::FailureReason::invalid_message_framing);
+      return { error, headersEnd };
+    }
+    impl_->headersEnd = headersEnd;
+    impl_->bodyLength = bodyLength;
   }
 
-  impl_->body = rawMessage.substr(offset);
-  return true;
+  if (buffer.size() < impl_->headersEnd + impl_->bodyLength) {
+    parseScope.Succeed();
+    return { ParseError::incomplete, buffer.size() };
+  }
+
+  impl_->body.assign(buffer.substr(impl_->headersEnd, impl_->bodyLength));
+  consumed = impl_->headersEnd + impl_->bodyLength;
+  impl_->scannedBytes = 0;
+  impl_->headersEnd = 0;
+  impl_->bodyLength = 0;
+  parseScope.Charge(consumed);
+  parseScope.Succeed();
+  return {};
 }
 
 std::string InternetMessage::GenerateRawMessage() const
@@ -89,9 +322,29 @@ auto InternetMessage::GetHeaders() const -> Headers { return impl_->headers; }
 
 std::string InternetMessage::GetBody() const { return impl_->body; }
 
+auto InternetMessage::GetHeaderValue(const HeaderName &name) const -> std::optional<HeaderValue>
+{
+  const auto header =
+    std::find_if(impl_->headers.begin(), impl_->headers.end(), [&name](const Header &candidate) {
+      return EqualsIgnoringCase(candidate.name, name);
+    });
+  if (header == impl_->headers.end()) { return std::nullopt; }
+  return header->value;
+}
+
+std::optional<std::string_view> InternetMessage::GetHeaderView(std::string_view name) const
+{
+  const auto header =
+    std::find_if(impl_->headers.begin(), impl_->headers.end(), [name](const Header &candidate) {
+      return EqualsIgnoringCase(candidate.name, name);
+    });
+  if (header == impl_->headers.end()) { return std::nullopt; }
+  return header->value;
+}
+
 bool InternetMessage::HasHeader(const HeaderName &name) const
 {
-  return std::any_of(impl_->headers.begin(), impl_->headers.end(), [name](const Header &header) {
+  return std::any_of(impl_->headers.begin(), impl_->headers.end(), [&name](const Header &header) {
     return header.name == name;
   });
 }
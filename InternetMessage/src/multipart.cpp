@@ -0,0 +1,394 @@
+#include "multipart.hpp"
+#include "header_value.hpp"
+#include "internet_message.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <functional>
+#include <unistd.h>
+
+namespace {
+
+/** This is the longest boundary allowed (RFC 2046 section 5.1.1) */
+constexpr size_t MAX_BOUNDARY_LENGTH = 70;
+
+/**
+ * This function checks if the character may be part of a boundary
+ */
+bool IsBoundaryCharacter(char character)
+{
+  constexpr std::string_view OTHERS = "'()+_,-./:=? ";
+  return (character >= '0' && character <= '9') || (character >= 'a' && character <= 'z')
+         || (character >= 'A' && character <= 'Z')
+         || OTHERS.find(character) != std::string_view::npos;
+}
+
+/** These are the parts of a multipart body */
+enum class State {
+  preamble,
+  delimiter_end,
+  headers,
+  body,
+  epilogue,
+};
+
+}// namespace
+
+namespace InternetMessage {
+
+std::optional<std::string> BoundaryOf(std::string_view contentType)
+{
+  ParameterTokenizer tokenizer(contentType);
+  const auto type = tokenizer.Value();
+  const auto slash = type.find('/');
+  if (slash == std::string_view::npos || !EqualsIgnoringCase(type.substr(0, slash), "multipart")) {
+    return std::nullopt;
+  }
+
+  for (Parameter parameter; tokenizer.Next(parameter);) {
+    if (!EqualsIgnoringCase(parameter.name, "boundary")) { continue; }
+    std::string boundary;
+    if (parameter.quoted) {
+      AppendUnquoted(parameter.value, boundary);
+    } else {
+      boundary.assign(parameter.value);
+    }
+    if (boundary.empty() || boundary.size() > MAX_BOUNDARY_LENGTH || boundary.back() == ' '
+        || !std::all_of(boundary.begin(), boundary.end(), IsBoundaryCharacter)) {
+      return std::nullopt;
+    }
+    return boundary;
+  }
+  return std::nullopt;
+}
+
+struct MultipartParser::Implementation
+{
+  /**
+   * This is what comes before every boundary, line break included. The body
+   * is parsed as if it started with a line break, so that a boundary on the
+   * first line is found like any other.
+   */
+  std::string delimiter;
+  std::boyer_moore_horspool_searcher<const char *> searcher;
+
+  PartBegin partBegin;
+  PartData partData;
+  PartEnd partEnd;
+  size_t maxHeaderBytes = 0;
+
+  State state = State::preamble;
+  MultipartError error = MultipartError::none;
+
+  /**
+   * This is the end of the previous chunk that may be the beginning of a
+   * delimiter, so could not be handed on yet
+   */
+  std::string pending = "\r\n";
+
+  /** These are the headers of the current part, as they are collected */
+  std::string headerBlock;
+  InternetMessage partHeaders;
+
+  // Methods
+
+  ~Implementation() = default;
+  Implementation(const Implementation &) = delete;
+  Implementation(Implementation &&) = delete;
+  Implementation &operator=(const Implementation &) = delete;
+  Implementation &operator=(Implementation &&) = delete;
+
+  Implementation(std::string_view boundary,
+    PartBegin &&newPartBegin,
+    PartData &&newPartData,
+    PartEnd &&newPartEnd,
+    size_t newMaxHeaderBytes)
+    : delimiter("\r\n--" + std::string(boundary)),
+      searcher(delimiter.data(), delimiter.data() + delimiter.size()),
+      partBegin(std::move(newPartBegin)), partData(std::move(newPartData)),
+      partEnd(std::move(newPartEnd)), maxHeaderBytes(newMaxHeaderBytes)
+  {}
+
+  size_t Fail(MultipartError newError)
+  {
+    error = newError;
+    return 0;
+  }
+
+  /**
+   * This method parses as much of the data as it can
+   *
+   * @return
+   *    The number of bytes used. What is left needs more data to be parsed.
+   */
+  size_t Process(std::string_view data)
+  {
+    size_t offset = 0;
+    while (offset < data.size() && error == MultipartError::none) {
+      const auto rest = data.substr(offset);
+      size_t used = 0;
+      switch (state) {
+      case State::preamble:
+      case State::body:
+        used = ScanForDelimiter(rest);
+        break;
+      case State::delimiter_end:
+        used = ParseDelimiterEnd(rest);
+        break;
+      case State::headers:
+        used = CollectHeaders(rest);
+        break;
+      case State::epilogue:
+        used = rest.size();
+        break;
+      }
+      if (used == 0) { break; }
+      offset += used;
+    }
+    return offset;
+  }
+
+  /**
+   * This method hands on the data up to the next delimiter, or up to where
+   * a delimiter might begin
+   */
+  size_t ScanForDelimiter(std::string_view rest)
+  {
+    const auto inBody = state == State::body;
+    const auto *const end = rest.data() + rest.size();
+    const auto *const found = std::search(rest.data(), end, searcher);
+    if (found != end) {
+      const auto length = static_cast<size_t>(found - rest.data());
+      if (inBody && length > 0 && partData && !partData(rest.substr(0, length))) {
+        return Fail(MultipartError::aborted);
+      }
+      if (inBody && partEnd && !partEnd()) { return Fail(MultipartError::aborted); }
+      state = State::delimiter_end;
+      return length + delimiter.size();
+    }
+
+    // Only a line break near the end may be the beginning of a delimiter
+    const auto tail = rest.size() - std::min(rest.size(), delimiter.size() - 1);
+    const auto safe = std::min(rest.find('\r', tail), rest.size());
+    if (safe > 0 && inBody && partData && !partData(rest.substr(0, safe))) {
+      return Fail(MultipartError::aborted);
+    }
+    return safe;
+  }
+
+  /**
+   * This method parses what follows a boundary: "--" after the last one,
+   * or optional whitespace and a line break before the headers of a part
+   */
+  size_t ParseDelimiterEnd(std::string_view rest)
+  {
+    if (rest.size() < 2) { return 0; }
+    if (rest.starts_with("--")) {
+      state = State::epilogue;
+      return 2;
+    }
+    const auto padding = std::min(rest.find_first_not_of(" \t"), rest.size());
+    if (rest.size() - padding < 2) { return padding; }
+    if (rest.substr(padding, 2) != "\r\n") { return Fail(MultipartError::invalid_delimiter); }
+    state = State::headers;
+    headerBlock.clear();
+    return padding + 2;
+  }
+
+  /**
+   * This method collects the headers of a part up to the empty line that
+   * ends them, and then parses them
+   */
+  size_t CollectHeaders(std::string_view rest)
+  {
+    constexpr std::string_view END_OF_HEADERS = "\r\n\r\n";
+    const auto previous = headerBlock.size();
+    const auto room = maxHeaderBytes + END_OF_HEADERS.size() - previous;
+    headerBlock.append(rest.substr(0, room));
+
+    auto end = std::string::npos;
+    if (headerBlock.starts_with("\r\n")) {
+      end = 2;
+    } else {
+      const auto from = previous - std::min(previous, END_OF_HEADERS.size() - 1);
+      const auto found = headerBlock.find(END_OF_HEADERS, from);
+      if (found != std::string::npos) { end = found + END_OF_HEADERS.size(); }
+    }
+    if (end == std::string::npos) {
+      if (headerBlock.size() >= maxHeaderBytes + END_OF_HEADERS.size()) {
+        return Fail(MultipartError::part_headers_too_long);
+      }
+      return headerBlock.size() - previous;
+    }
+
+    headerBlock.resize(end);
+    if (!partHeaders.ParseFromRawMessage(headerBlock)) {
+      return Fail(MultipartError::invalid_part_headers);
+    }
+    if (partBegin && !partBegin(partHeaders)) { return Fail(MultipartError::aborted); }
+    state = State::body;
+    return end - previous;
+  }
+};
+
+MultipartParser::~MultipartParser() = default;
+
+MultipartParser::MultipartParser(MultipartParser &&) noexcept = default;
+
+MultipartParser &MultipartParser::operator=(MultipartParser &&) noexcept = default;
+
+MultipartParser::MultipartParser(std::string_view boundary,
+  PartBegin partBegin,
+  PartData partData,
+  PartEnd partEnd,
+  size_t maxHeaderBytes)
+  : impl_(new Implementation(boundary,
+    std::move(partBegin),
+    std::move(partData),
+    std::move(partEnd),
+    maxHeaderBytes))
+{}
+
+MultipartError MultipartParser::Feed(std::string_view chunk)
+{
+  auto &pending = impl_->pending;
+
+  // What was carried over is resolved first, a delimiter's length of the
+  // new chunk at a time, before the rest of the chunk is parsed in place
+  while (!pending.empty() && !chunk.empty() && impl_->error == MultipartError::none) {
+    const auto taken = std::min(chunk.size(), impl_->delimiter.size());
+    pending.append(chunk.substr(0, taken));
+    chunk.remove_prefix(taken);
+    pending.erase(0, impl_->Process(pending));
+  }
+  if (impl_->error != MultipartError::none || chunk.empty()) { return impl_->error; }
+
+  const auto used = impl_->Process(chunk);
+  if (impl_->error == MultipartError::none) { pending.assign(chunk.substr(used)); }
+  return impl_->error;
+}
+
+MultipartError MultipartParser::Finish() const
+{
+  if (impl_->error != MultipartError::none) { return impl_->error; }
+  return Done() ? MultipartError::none : MultipartError::truncated;
+}
+
+bool MultipartParser::Done() const { return impl_->state == State::epilogue; }
+
+struct SpooledBody::Implementation
+{
+  size_t memoryThreshold = 0;
+  std::string directory;
+  std::string memory;
+  int fileDescriptor = -1;
+  size_t size = 0;
+
+  /** This tells if a write failed, after which the body is incomplete */
+  bool failed = false;
+
+  // Methods
+
+  ~Implementation()
+  {
+    if (fileDescriptor >= 0) { ::close(fileDescriptor); }
+  }
+  Implementation(const Implementation &) = delete;
+  Implementation(Implementation &&) = delete;
+  Implementation &operator=(const Implementation &) = delete;
+  Implementation &operator=(Implementation &&) = delete;
+
+  Implementation(size_t newMemoryThreshold, std::string &&newDirectory)
+    : memoryThreshold(newMemoryThreshold), directory(std::move(newDirectory))
+  {}
+
+  /**
+   * This method makes a file that has no name, so that it is removed as
+   * soon as it is closed, whatever happens to the process
+   */
+  bool OpenFile()
+  {
+    if (directory.empty()) {
+      std::error_code error;
+      directory = std::filesystem::temp_directory_path(error).string();
+      if (error) { directory = "/tmp"; }
+    }
+    constexpr mode_t OWNER_ONLY = 0600;
+    fileDescriptor = ::open(directory.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, OWNER_ONLY);
+    if (fileDescriptor < 0 && (errno == EOPNOTSUPP || errno == EISDIR)) {
+      // Without O_TMPFILE the file is named and unlinked straight away
+      auto pattern = directory + "/spool_XXXXXX";
+      fileDescriptor = ::mkostemp(pattern.data(), O_CLOEXEC);
+      if (fileDescriptor >= 0) { ::unlink(pattern.c_str()); }
+    }
+    return fileDescriptor >= 0;
+  }
+
+  bool WriteAll(std::string_view data) const
+  {
+    while (!data.empty()) {
+      const auto written = ::write(fileDescriptor, data.data(), data.size());
+      if (written < 0) {
+        if (errno == EINTR) { continue; }
+        return false;
+      }
+      data.remove_prefix(static_cast<size_t>(written));
+    }
+    return true;
+  }
+};
+
+SpooledBody::~SpooledBody() = default;
+
+SpooledBody::SpooledBody(SpooledBody &&) noexcept = default;
+
+SpooledBody &SpooledBody::operator=(SpooledBody &&) noexcept = default;
+
+SpooledBody::SpooledBody(size_t memoryThreshold, std::string directory)
+  : impl_(new Implementation(memoryThreshold, std::move(directory)))
+{}
+
+bool SpooledBody::Write(std::string_view data)
+{
+  if (impl_->failed) { return false; }
+  if (impl_->fileDescriptor < 0) {
+    if (impl_->memory.size() + data.size() <= impl_->memoryThreshold) {
+      impl_->memory.append(data);
+      impl_->size += data.size();
+      return true;
+    }
+    if (!impl_->OpenFile()) {
+      impl_->failed = true;
+      return false;
+    }
+    if (!impl_->WriteAll(impl_->memory)) {
+      // The file holds only part of the body, so it is not used
+      const auto error = errno;
+      ::close(impl_->fileDescriptor);
+      impl_->fileDescriptor = -1;
+      impl_->failed = true;
+      errno = error;
+      return false;
+    }
+    std::string().swap(impl_->memory);
+  }
+  if (!impl_->WriteAll(data)) {
+    impl_->failed = true;
+    return false;
+  }
+  impl_->size += data.size();
+  return true;
+}
+
+size_t SpooledBody::Size() const { return impl_->size; }
+
+bool SpooledBody::InFile() const { return impl_->fileDescriptor >= 0; }
+
+std::string_view SpooledBody::Memory() const { return impl_->memory; }
+
+int SpooledBody::FileDescriptor() const { return impl_->fileDescriptor; }
+
+}// namespace InternetMessage
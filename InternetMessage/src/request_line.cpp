@@ -0,0 +1,78 @@
+#include "request_line.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/**
+ * This function checks if the character may appear in a token, such as the
+ * method of a request (RFC 7230 section 3.2.6)
+ */
+bool IsTokenCharacter(char character)
+{
+  constexpr std::string_view TOKEN_SYMBOLS = "!#$%&'*+-.^_`|~";
+  return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z')
+         || (character >= '0' && character <= '9')
+         || TOKEN_SYMBOLS.find(character) != std::string_view::npos;
+}
+
+/**
+ * This function checks if the character may appear in a request target,
+ * which is any visible character
+ */
+bool IsTargetCharacter(char character) { return character > ' ' && character < '\x7F'; }
+
+/**
+ * This function checks if the string is an HTTP version: "HTTP/" DIGIT "." DIGIT
+ */
+bool IsHttpVersion(std::string_view version)
+{
+  const auto isDigit = [](char character) { return character >= '0' && character <= '9'; };
+  return version.size() == 8 && version.substr(0, 5) == "HTTP/" && isDigit(version[5])
+         && version[6] == '.' && isDigit(version[7]);
+}
+
+}// namespace
+
+namespace InternetMessage {
+
+ParseResult ParseRequestLine(std::string_view buffer, RequestLine &requestLine, size_t &consumed)
+{
+  size_t lineBegin = 0;
+  while (buffer.substr(lineBegin, 2) == "\r\n") { lineBegin += 2; }
+
+  const auto lineEnd = buffer.find("\r\n", lineBegin);
+  if (lineEnd == std::string_view::npos) { return { ParseError::incomplete, buffer.size() }; }
+  const auto line = buffer.substr(lineBegin, lineEnd - lineBegin);
+
+  const auto methodEnd = line.find(' ');
+  if (methodEnd == std::string_view::npos) {
+    return { ParseError::invalid_request_line, lineBegin + line.size() };
+  }
+  const auto targetEnd = line.find(' ', methodEnd + 1);
+  if (targetEnd == std::string_view::npos) {
+    return { ParseError::invalid_request_line, lineBegin + line.size() };
+  }
+
+  const auto method = line.substr(0, methodEnd);
+  const auto target = line.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+  const auto version = line.substr(targetEnd + 1);
+
+  if (method.empty() || !std::all_of(method.begin(), method.end(), IsTokenCharacter)) {
+    return { ParseError::invalid_request_line, lineBegin };
+  }
+  if (target.empty() || !std::all_of(target.begin(), target.end(), IsTargetCharacter)) {
+    return { ParseError::invalid_request_line, lineBegin + methodEnd + 1 };
+  }
+  if (!IsHttpVersion(version)) {
+    return { ParseError::invalid_request_line, lineBegin + targetEnd + 1 };
+  }
+
+  requestLine.method.assign(method);
+  requestLine.target.assign(target);
+  requestLine.version.assign(version);
+  consumed = lineEnd + 2;
+  return {};
+}
+
+}// namespace InternetMessage
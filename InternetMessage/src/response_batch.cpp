@@ -0,0 +1,83 @@
+#include "response_batch.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <system_error>
+#include <sys/uio.h>
+
+namespace {
+
+/**
+ * This function checks if the error means that a non blocking write would
+ * have blocked
+ */
+bool WouldBlock(int error)
+{
+#if EAGAIN == EWOULDBLOCK
+  return error == EAGAIN;
+#else
+  return error == EAGAIN || error == EWOULDBLOCK;
+#endif
+}
+
+}// namespace
+
+namespace InternetMessage {
+
+void ResponseBatch::Add(std::string response)
+{
+  if (!response.empty()) { responses_.push_back(std::move(response)); }
+}
+
+bool ResponseBatch::Empty() const { return first_ == responses_.size(); }
+
+size_t ResponseBatch::PendingBytes() const
+{
+  size_t pending = 0;
+  for (auto index = first_; index < responses_.size(); ++index) {
+    pending += responses_[index].size();
+  }
+  return pending - firstOffset_;
+}
+
+bool ResponseBatch::Flush(int fileDescriptor)
+{
+  std::vector<iovec> buffers;
+
+  while (!Empty()) {
+    buffers.clear();
+    for (auto index = first_; index < responses_.size() && buffers.size() < IOV_MAX; ++index) {
+      auto &response = responses_[index];
+      const auto offset = index == first_ ? firstOffset_ : 0;
+      buffers.push_back({ response.data() + offset, response.size() - offset });
+    }
+
+    const auto written = ::writev(fileDescriptor, buffers.data(), static_cast<int>(buffers.size()));
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      if (WouldBlock(errno)) { return false; }
+      throw std::system_error(errno, std::generic_category(), "writev");
+    }
+
+    // Skip past every response sent whole and remember how much of the
+    // next one went out
+    auto remaining = static_cast<size_t>(written);
+    while (remaining > 0) {
+      const auto left = responses_[first_].size() - firstOffset_;
+      if (remaining < left) {
+        firstOffset_ += remaining;
+        break;
+      }
+      remaining -= left;
+      ++first_;
+      firstOffset_ = 0;
+    }
+  }
+
+  responses_.clear();
+  first_ = 0;
+  firstOffset_ = 0;
+  return true;
+}
+
+}// namespace InternetMessage
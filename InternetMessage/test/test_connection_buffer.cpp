@@ -0,0 +1,57 @@
+#include "../headers/connection_buffer.hpp"
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <unistd.h>
+
+TEST_CASE("Connection buffer consumes from the front", "ConnectionBuffer")
+{
+  InternetMessage::ConnectionBuffer buffer(16);
+  REQUIRE(buffer.Readable().empty());
+
+  buffer.Append("first;second;");
+  REQUIRE(buffer.Readable() == "first;second;");
+  const auto *const data = buffer.Readable().data();
+
+  buffer.Consume(6);
+  REQUIRE(buffer.Readable() == "second;");
+  REQUIRE(buffer.Readable().data() == data + 6);
+
+  buffer.Consume(7);
+  REQUIRE(buffer.Readable().empty());
+}
+
+TEST_CASE("Connection buffer moves the tail only when out of room", "ConnectionBuffer")
+{
+  InternetMessage::ConnectionBuffer buffer(16);
+  buffer.Append("0123456789ab");
+  buffer.Consume(10);
+
+  // The tail is moved to the front to make room
+  const auto room = buffer.PrepareWrite(8);
+  REQUIRE(room.size() >= 8);
+  REQUIRE(buffer.Readable() == "ab");
+  buffer.Append("cdefghij");
+  REQUIRE(buffer.Readable() == "abcdefghij");
+
+  // The buffer grows when moving the tail is not enough
+  buffer.Append(std::string(100, 'x'));
+  REQUIRE(buffer.Readable().size() == 110);
+  REQUIRE(buffer.Readable().substr(0, 10) == "abcdefghij");
+}
+
+TEST_CASE("Connection buffer reads from a file descriptor", "ConnectionBuffer")
+{
+  std::array<int, 2> pipeEnds{};
+  REQUIRE(::pipe(pipeEnds.data()) == 0);
+  const std::string message = "GET / HTTP/1.1\r\n\r\n";
+  REQUIRE(
+    ::write(pipeEnds[1], message.data(), message.size()) == static_cast<ssize_t>(message.size()));
+  ::close(pipeEnds[1]);
+
+  InternetMessage::ConnectionBuffer buffer;
+  REQUIRE(buffer.ReadFrom(pipeEnds[0]) == static_cast<ssize_t>(message.size()));
+  REQUIRE(buffer.Readable() == message);
+  REQUIRE(buffer.ReadFrom(pipeEnds[0]) == 0);
+  ::close(pipeEnds[0]);
+}
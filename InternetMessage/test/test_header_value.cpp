@@ -0,0 +1,121 @@
+#include "../headers/header_value.hpp"
+#include <catch2/catch.hpp>
+
+#include "../headers/internet_message.hpp"
+
+#include <vector>
+
+namespace {
+
+/**
+ * This function collects every element of a comma separated list
+ */
+std::vector<std::string_view> Elements(std::string_view value)
+{
+  std::vector<std::string_view> elements;
+  InternetMessage::ListTokenizer tokenizer(value);
+  for (std::string_view element; tokenizer.Next(element);) { elements.push_back(element); }
+  return elements;
+}
+
+}// namespace
+
+TEST_CASE("Comma separated lists are split into trimmed elements", "[HeaderValue]")
+{
+  using List = std::vector<std::string_view>;
+  REQUIRE(Elements("keep-alive, Upgrade") == List{ "keep-alive", "Upgrade" });
+  REQUIRE(Elements("  no-cache ,\tmax-age=0  ") == List{ "no-cache", "max-age=0" });
+  REQUIRE(Elements(", ,a,,  b ,") == List{ "a", "b" });
+  REQUIRE(Elements("").empty());
+  REQUIRE(Elements(" , ").empty());
+
+  // Commas inside quoted-strings do not split
+  REQUIRE(Elements(R"("a,b", W/"c\",d", e)") == List{ R"("a,b")", R"(W/"c\",d")", "e" });
+  REQUIRE(Elements(R"(private="Set-Cookie, Vary", no-store)")
+          == List{ R"(private="Set-Cookie, Vary")", "no-store" });
+
+  // An unclosed quoted-string takes the rest of the list
+  REQUIRE(Elements(R"(a, "b, c)") == List{ "a", R"("b, c)" });
+}
+
+TEST_CASE("Parameters are split from their value", "[HeaderValue]")
+{
+  InternetMessage::ParameterTokenizer tokenizer(
+    R"(text/html ; charset=UTF-8;; format="fl;owed" ; flag)");
+  REQUIRE(tokenizer.Value() == "text/html");
+
+  InternetMessage::Parameter parameter;
+  REQUIRE(tokenizer.Next(parameter));
+  REQUIRE(parameter.name == "charset");
+  REQUIRE(parameter.value == "UTF-8");
+  REQUIRE_FALSE(parameter.quoted);
+  REQUIRE(tokenizer.Next(parameter));
+  REQUIRE(parameter.name == "format");
+  REQUIRE(parameter.value == "fl;owed");
+  REQUIRE(parameter.quoted);
+  REQUIRE(tokenizer.Next(parameter));
+  REQUIRE(parameter.name == "flag");
+  REQUIRE(parameter.value.empty());
+  REQUIRE_FALSE(tokenizer.Next(parameter));
+
+  REQUIRE(InternetMessage::ParameterTokenizer("gzip").Value() == "gzip");
+  const auto directive = InternetMessage::SplitParameter(" max-age = 60 ");
+  REQUIRE(directive.name == "max-age");
+  REQUIRE(directive.value == "60");
+}
+
+TEST_CASE("Quoted strings are measured and unescaped", "[HeaderValue]")
+{
+  REQUIRE(InternetMessage::QuotedStringLength(R"("abc" rest)") == 5);
+  REQUIRE(InternetMessage::QuotedStringLength(R"("a\"b")") == 6);
+  REQUIRE(InternetMessage::QuotedStringLength(R"("")") == 2);
+  REQUIRE(InternetMessage::QuotedStringLength(R"("open)") == std::string_view::npos);
+  REQUIRE(InternetMessage::QuotedStringLength("abc") == std::string_view::npos);
+
+  const auto parameter = InternetMessage::SplitParameter(R"(filename="a \"b\".txt")");
+  REQUIRE(parameter.value == R"(a \"b\".txt)");
+  std::string unquoted;
+  InternetMessage::AppendUnquoted(parameter.value, unquoted);
+  REQUIRE(unquoted == R"(a "b".txt)");
+}
+
+TEST_CASE("Quality values weigh list elements", "[HeaderValue]")
+{
+  REQUIRE(InternetMessage::ParseQuality("1") == 1000U);
+  REQUIRE(InternetMessage::ParseQuality("1.000") == 1000U);
+  REQUIRE(InternetMessage::ParseQuality("0") == 0U);
+  REQUIRE(InternetMessage::ParseQuality("0.8") == 800U);
+  REQUIRE(InternetMessage::ParseQuality("0.125") == 125U);
+  REQUIRE(InternetMessage::ParseQuality("0.") == 0U);
+  REQUIRE_FALSE(InternetMessage::ParseQuality("1.001"));
+  REQUIRE_FALSE(InternetMessage::ParseQuality("0.1234"));
+  REQUIRE_FALSE(InternetMessage::ParseQuality("2"));
+  REQUIRE_FALSE(InternetMessage::ParseQuality(".5"));
+  REQUIRE_FALSE(InternetMessage::ParseQuality(""));
+
+  std::vector<InternetMessage::WeightedValue> weighted;
+  InternetMessage::ListTokenizer tokenizer("gzip;q=0.8, br, identity; Q=0");
+  for (std::string_view element; tokenizer.Next(element);) {
+    const auto value = InternetMessage::ParseWeightedValue(element);
+    REQUIRE(value);
+    weighted.push_back(*value);
+  }
+  REQUIRE(weighted.size() == 3);
+  REQUIRE(weighted[0].value == "gzip");
+  REQUIRE(weighted[0].quality == 800);
+  REQUIRE(weighted[1].value == "br");
+  REQUIRE(weighted[1].quality == 1000);
+  REQUIRE(weighted[2].value == "identity");
+  REQUIRE(weighted[2].quality == 0);
+  REQUIRE_FALSE(InternetMessage::ParseWeightedValue("gzip;q=high"));
+}
+
+TEST_CASE("Header values are looked up without copies", "[HeaderValue]")
+{
+  InternetMessage::InternetMessage message;
+  REQUIRE(message.ParseFromRawMessage("Accept-Encoding: gzip, br\r\n\r\n"));
+  const auto value = message.GetHeaderView("accept-encoding");
+  REQUIRE(value == "gzip, br");
+  REQUIRE(Elements(*value) == std::vector<std::string_view>{ "gzip", "br" });
+  REQUIRE_FALSE(message.GetHeaderView("Connection"));
+}
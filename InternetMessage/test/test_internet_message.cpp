@@ -98,3 +98,185 @@ TEST_CASE("Initialization of internet message with server response",// NOLINT
   REQUIRE("Hello World! My payload includes a trailing CRLF.\r\n" == msg.GetBody());
   REQUIRE(rawMessage == msg.GenerateRawMessage());
 }
+
+TEST_CASE("Parse errors tell where the message went wrong",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  const std::string rawMessage =
+    "Host: www.example.com\r\n"
+    "Not a header\r\n"
+    "\r\n";
+
+  const auto result = msg.ParseFromRawMessage(rawMessage);
+  REQUIRE_FALSE(result);
+  REQUIRE(result.error == InternetMessage::ParseError::missing_header_delimiter);
+  REQUIRE(result.offset == 23);
+  REQUIRE(InternetMessage::ToString(result.error) == "header line without a colon");
+
+  InternetMessage::InternetMessage valid;
+  REQUIRE(
+    valid.ParseFromRawMessage("Host: www.example.com\r\n\r\n") == InternetMessage::ParseResult{});
+}
+
+TEST_CASE("Pipelined messages are parsed one after another from a buffer",// NOLINT
+  "InternetMessage")
+{
+  const std::string buffer =
+    "Host: www.example.com\r\n"
+    "Content-Length: 5\r\n"
+    "\r\n"
+    "hello"
+    "Host: www.example.com\r\n"
+    "\r\n"
+    "content-length: 3\r\n"
+    "\r\n"
+    "bye"
+    "Host: www.exa";
+
+  InternetMessage::InternetMessage msg;
+  std::string_view rest = buffer;
+  std::vector<std::string> bodies;
+
+  for (;;) {
+    size_t consumed = 0;
+    const auto result = msg.ParseFromBuffer(rest, consumed);
+    if (result.error == InternetMessage::ParseError::incomplete) { break; }
+    REQUIRE(result);
+    bodies.push_back(msg.GetBody());
+    rest.remove_prefix(consumed);
+  }
+
+  REQUIRE(bodies == std::vector<std::string>{ "hello", "", "bye" });
+  REQUIRE(rest == "Host: www.exa");
+  REQUIRE(msg.GetHeaderValue("Content-Length") == "3");
+  REQUIRE(msg.GetHeaders().size() == 1);
+}
+
+TEST_CASE("A body that has not arrived whole is incomplete",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  size_t consumed = 0;
+  const std::string buffer = "Content-Length: 10\r\n\r\nhello";
+
+  const auto result = msg.ParseFromBuffer(buffer, consumed);
+  REQUIRE(result.error == InternetMessage::ParseError::incomplete);
+  REQUIRE(consumed == 0);
+}
+
+TEST_CASE("A message can arrive one byte at a time",// NOLINT
+  "InternetMessage")
+{
+  const std::string message =
+    "Host: www.example.com\r\n"
+    "Content-Length: 5\r\n"
+    "\r\n"
+    "hello";
+
+  InternetMessage::InternetMessage msg;
+  for (size_t size = 0; size < message.size(); ++size) {
+    size_t consumed = 0;
+    INFO(size);
+    REQUIRE(msg.ParseFromBuffer(std::string_view(message).substr(0, size), consumed).error
+            == InternetMessage::ParseError::incomplete);
+  }
+  size_t consumed = 0;
+  REQUIRE(msg.ParseFromBuffer(message + "Host: b", consumed));
+  REQUIRE(consumed == message.size());
+  REQUIRE(msg.GetHeaderValue("Host") == "www.example.com");
+  REQUIRE(msg.GetBody() == "hello");
+}
+
+TEST_CASE("Headers longer than the limit are rejected",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  msg.SetMaxHeaderBytes(32);
+  size_t consumed = 0;
+
+  // Headers that have not ended are rejected as soon as they are too long
+  const std::string unended = "Host: www.example.com\r\nAccept: */";
+  REQUIRE(msg.ParseFromBuffer(unended.substr(0, 32), consumed).error
+          == InternetMessage::ParseError::incomplete);
+  REQUIRE(msg.ParseFromBuffer(unended, consumed).error
+          == InternetMessage::ParseError::headers_too_long);
+
+  REQUIRE(msg.ParseFromBuffer("Host: www.example.com\r\nAccept: *\r\n\r\n", consumed).error
+          == InternetMessage::ParseError::headers_too_long);
+  REQUIRE(msg.ParseFromBuffer("Host: www.example.com\r\nA: *\r\n\r\n", consumed));
+  REQUIRE(InternetMessage::ToString(InternetMessage::ParseError::headers_too_long)
+          == "headers too long");
+}
+
+TEST_CASE("Messages whose body length can not be worked out are rejected",// NOLINT
+  "InternetMessage")
+{
+  struct TestVector
+  {
+    std::string buffer;
+    InternetMessage::ParseError error;
+  };
+  const std::vector<TestVector> testVectors{
+    { "Content-Length: x\r\n\r\n", InternetMessage::ParseError::invalid_content_length },
+    { "Content-Length: -1\r\n\r\n", InternetMessage::ParseError::invalid_content_length },
+    { "Content-Length:\r\n\r\n", InternetMessage::ParseError::invalid_content_length },
+    { "Content-Length: 1\r\nContent-Length: 2\r\n\r\nab",
+      InternetMessage::ParseError::invalid_content_length },
+    { "Transfer-Encoding: chunked\r\n\r\n",
+      InternetMessage::ParseError::unsupported_transfer_encoding },
+    { "No colon\r\n\r\n", InternetMessage::ParseError::missing_header_delimiter },
+  };
+
+  for (const auto &testVector : testVectors) {
+    InternetMessage::InternetMessage msg;
+    size_t consumed = 0;
+    INFO(testVector.buffer);
+    REQUIRE(msg.ParseFromBuffer(testVector.buffer, consumed).error == testVector.error);
+  }
+}
+
+TEST_CASE("Header values are looked up without regard to case",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  REQUIRE(msg.ParseFromRawMessage("Content-Type: text/plain\r\nHost: a\r\nhost: b\r\n\r\n"));
+  REQUIRE(msg.GetHeaderValue("content-type") == "text/plain");
+  REQUIRE(msg.GetHeaderValue("HOST") == "a");
+  REQUIRE_FALSE(msg.GetHeaderValue("Accept").has_value());
+}
+
+TEST_CASE("Parsing again replaces the previous message",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  REQUIRE(msg.ParseFromRawMessage("Host: a\r\nAccept: */*\r\n\r\nfirst body"));
+  REQUIRE(msg.ParseFromRawMessage("Host: b\r\n\r\nsecond"));
+  REQUIRE(msg.GetHeaders().size() == 1);
+  REQUIRE(msg.GetHeaderValue("Host") == "b");
+  REQUIRE_FALSE(msg.HasHeader("Accept"));
+  REQUIRE(msg.GetBody() == "second");
+
+  msg.Reset();
+  REQUIRE(msg.GetHeaders().empty());
+  REQUIRE(msg.GetBody().empty());
+
+  size_t consumed = 0;
+  REQUIRE(msg.ParseFromBuffer("Host: c\r\nContent-Length: 1\r\n\r\nx", consumed));
+  REQUIRE(msg.GetHeaders().size() == 2);
+  REQUIRE(msg.GetHeaderValue("Host") == "c");
+}
+
+TEST_CASE("Messages can be moved",// NOLINT
+  "InternetMessage")
+{
+  InternetMessage::InternetMessage msg;
+  REQUIRE(msg.ParseFromRawMessage("Host: a\r\n\r\nbody"));
+
+  InternetMessage::InternetMessage moved(std::move(msg));
+  REQUIRE(moved.GetHeaderValue("Host") == "a");
+  REQUIRE(moved.GetBody() == "body");
+
+  msg = std::move(moved);
+  REQUIRE(msg.GetBody() == "body");
+}
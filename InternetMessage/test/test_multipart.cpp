@@ -0,0 +1,178 @@
+#include "../headers/multipart.hpp"
+#include <catch2/catch.hpp>
+
+#include "../headers/internet_message.hpp"
+
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+/**
+ * This is what a parse gave for one part
+ */
+struct Part
+{
+  std::string name;
+  std::string data;
+  bool ended = false;
+};
+
+/**
+ * This parses a multipart body fed in chunks of the given size and collects
+ * its parts
+ */
+struct Collector
+{
+  explicit Collector(std::string_view boundary = "XyZ")
+    : parser(
+      boundary,
+      [this](const InternetMessage::InternetMessage &headers) {
+        parts.push_back(
+          Part{ headers.GetHeaderValue("Content-Disposition").value_or(""), {}, false });
+        return true;
+      },
+      [this](std::string_view data) {
+        parts.back().data += data;
+        ++pieces;
+        return true;
+      },
+      [this] {
+        parts.back().ended = true;
+        return true;
+      })
+  {}
+
+  InternetMessage::MultipartError Feed(std::string_view body, size_t chunkSize)
+  {
+    for (size_t offset = 0; offset < body.size(); offset += chunkSize) {
+      const auto error = parser.Feed(body.substr(offset, chunkSize));
+      if (error != InternetMessage::MultipartError::none) { return error; }
+    }
+    return parser.Finish();
+  }
+
+  std::vector<Part> parts;
+  size_t pieces = 0;
+  InternetMessage::MultipartParser parser;
+};
+
+const std::string FORM = "This is the preamble\r\n"
+                         "--XyZ\r\n"
+                         "Content-Disposition: form-data; name=\"field\"\r\n"
+                         "\r\n"
+                         "value\r\n"
+                         "--XyZ  \r\n"
+                         "Content-Disposition: form-data; name=\"file\"; filename=\"a.txt\"\r\n"
+                         "Content-Type: text/plain\r\n"
+                         "\r\n"
+                         "line one\r\n--XyX\r\n-\r\n--Xy\r\n\r\r\n"
+                         "--XyZ\r\n"
+                         "\r\n"
+                         "\r\n"
+                         "--XyZ--\r\n"
+                         "This is the epilogue\r\n";
+
+}// namespace
+
+TEST_CASE("Boundaries are taken from multipart media types", "[Multipart]")
+{
+  REQUIRE(InternetMessage::BoundaryOf("multipart/form-data; boundary=XyZ") == "XyZ");
+  REQUIRE(InternetMessage::BoundaryOf("Multipart/Mixed; charset=x; Boundary=\"a b:c\"")
+          == "a b:c");
+  REQUIRE_FALSE(InternetMessage::BoundaryOf("text/plain; boundary=XyZ"));
+  REQUIRE_FALSE(InternetMessage::BoundaryOf("multipart/form-data"));
+  REQUIRE_FALSE(InternetMessage::BoundaryOf("multipart/form-data; boundary=\"\""));
+  REQUIRE_FALSE(InternetMessage::BoundaryOf("multipart/form-data; boundary=\"ends \""));
+  REQUIRE_FALSE(InternetMessage::BoundaryOf("multipart/form-data; boundary=a{b"));
+  REQUIRE_FALSE(
+    InternetMessage::BoundaryOf("multipart/form-data; boundary=" + std::string(71, 'a')));
+}
+
+TEST_CASE("Multipart bodies are parsed in chunks of any size", "[Multipart]")
+{
+  for (size_t chunkSize = 1; chunkSize <= FORM.size(); ++chunkSize) {
+    INFO("Chunk size: " + std::to_string(chunkSize));
+    Collector collector;
+    REQUIRE(collector.Feed(FORM, chunkSize) == InternetMessage::MultipartError::none);
+    REQUIRE(collector.parser.Done());
+    REQUIRE(collector.parts.size() == 3);
+    REQUIRE(collector.parts[0].name == "form-data; name=\"field\"");
+    REQUIRE(collector.parts[0].data == "value");
+    REQUIRE(collector.parts[1].name == "form-data; name=\"file\"; filename=\"a.txt\"");
+    REQUIRE(collector.parts[1].data == "line one\r\n--XyX\r\n-\r\n--Xy\r\n\r");
+    REQUIRE(collector.parts[2].name.empty());
+    REQUIRE(collector.parts[2].data.empty());
+    for (const auto &part : collector.parts) { REQUIRE(part.ended); }
+  }
+}
+
+TEST_CASE("Part data is handed on before the body ends", "[Multipart]")
+{
+  Collector collector;
+  const std::string chunk(65536, 'x');
+  REQUIRE(collector.parser.Feed("--XyZ\r\n\r\n") == InternetMessage::MultipartError::none);
+  for (size_t count = 1; count <= 64; ++count) {
+    REQUIRE(collector.parser.Feed(chunk) == InternetMessage::MultipartError::none);
+    REQUIRE(collector.parts.back().data.size() == chunk.size() * count);
+  }
+  REQUIRE(collector.pieces == 64);
+  REQUIRE(collector.parser.Finish() == InternetMessage::MultipartError::truncated);
+  REQUIRE(collector.parser.Feed("\r\n--XyZ--") == InternetMessage::MultipartError::none);
+  REQUIRE(collector.parser.Finish() == InternetMessage::MultipartError::none);
+}
+
+TEST_CASE("Bad multipart bodies are reported", "[Multipart]")
+{
+  using InternetMessage::MultipartError;
+  REQUIRE(Collector().Feed("--XyZ\r\nno colon\r\n\r\n--XyZ--", 4)
+          == MultipartError::invalid_part_headers);
+  REQUIRE(Collector().Feed("--XyZ\r\n\r\ndata\r\n--XyZ!\r\n", 4)
+          == MultipartError::invalid_delimiter);
+  REQUIRE(Collector().Feed("--XyZ\r\n\r\ndata\r\n--XyZ\r\n\r\nmore", 4)
+          == MultipartError::truncated);
+  REQUIRE(Collector().Feed("no boundary at all", 4) == MultipartError::truncated);
+
+  InternetMessage::MultipartParser small("XyZ", nullptr, nullptr, nullptr, 16);
+  REQUIRE(small.Feed("--XyZ\r\nName: a value that is too long\r\n\r\n")
+          == MultipartError::part_headers_too_long);
+  REQUIRE(small.Feed("--XyZ--") == MultipartError::part_headers_too_long);
+
+  InternetMessage::MultipartParser stopped(
+    "XyZ", nullptr, [](std::string_view) { return false; }, nullptr);
+  REQUIRE(stopped.Feed("--XyZ\r\n\r\ndata\r\n--XyZ--") == MultipartError::aborted);
+}
+
+TEST_CASE("Spooled bodies move to a file past the threshold", "[Multipart]")
+{
+  InternetMessage::SpooledBody body(8);
+  REQUIRE(body.Write("1234"));
+  REQUIRE(body.Write("5678"));
+  REQUIRE_FALSE(body.InFile());
+  REQUIRE(body.Memory() == "12345678");
+  REQUIRE(body.FileDescriptor() == -1);
+
+  REQUIRE(body.Write("9"));
+  REQUIRE(body.InFile());
+  REQUIRE(body.Memory().empty());
+  REQUIRE(body.Size() == 9);
+  REQUIRE(body.Write("0"));
+
+  std::string content(16, '\0');
+  const auto read = ::pread(body.FileDescriptor(), content.data(), content.size(), 0);
+  REQUIRE(read == 10);
+  content.resize(10);
+  REQUIRE(content == "1234567890");
+}
+
+TEST_CASE("Spooled bodies keep failing after a write fails", "[Multipart]")
+{
+  InternetMessage::SpooledBody body(4, "/nonexistent/spool/directory");
+  REQUIRE(body.Write("1234"));
+  REQUIRE_FALSE(body.Write("5"));
+  REQUIRE(body.FileDescriptor() == -1);
+
+  // A write that would fit in memory must not hide the lost data
+  REQUIRE_FALSE(body.Write(""));
+  REQUIRE(body.Size() == 4);
+}
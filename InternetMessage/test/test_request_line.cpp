@@ -0,0 +1,54 @@
+#include "../headers/request_line.hpp"
+#include <catch2/catch.hpp>
+
+TEST_CASE("Parse a request line", "RequestLine")
+{
+  InternetMessage::RequestLine requestLine;
+  size_t consumed = 0;
+  const std::string buffer = "GET /index.html?x=1 HTTP/1.1\r\nHost: www.example.com\r\n\r\n";
+
+  REQUIRE(InternetMessage::ParseRequestLine(buffer, requestLine, consumed));
+  REQUIRE(requestLine.method == "GET");
+  REQUIRE(requestLine.target == "/index.html?x=1");
+  REQUIRE(requestLine.version == "HTTP/1.1");
+  REQUIRE(consumed == 30);
+}
+
+TEST_CASE("Empty lines before a request line are skipped", "RequestLine")
+{
+  InternetMessage::RequestLine requestLine;
+  size_t consumed = 0;
+
+  REQUIRE(InternetMessage::ParseRequestLine("\r\n\r\nPOST * HTTP/1.0\r\n", requestLine, consumed));
+  REQUIRE(requestLine.method == "POST");
+  REQUIRE(requestLine.target == "*");
+  REQUIRE(consumed == 21);
+}
+
+TEST_CASE("Bad or partial request lines", "RequestLine")
+{
+  struct TestVector
+  {
+    std::string buffer;
+    InternetMessage::ParseError error;
+    size_t offset;
+  };
+  const std::vector<TestVector> testVectors{
+    { "GET / HTTP/1.1", InternetMessage::ParseError::incomplete, 14 },
+    { "GET /\r\n", InternetMessage::ParseError::invalid_request_line, 5 },
+    { "G(T / HTTP/1.1\r\n", InternetMessage::ParseError::invalid_request_line, 0 },
+    { " / HTTP/1.1\r\n", InternetMessage::ParseError::invalid_request_line, 0 },
+    { "GET  HTTP/1.1\r\n", InternetMessage::ParseError::invalid_request_line, 4 },
+    { "GET / HTTP/11\r\n", InternetMessage::ParseError::invalid_request_line, 6 },
+    { "GET / FTP/1.1\r\n", InternetMessage::ParseError::invalid_request_line, 6 },
+  };
+
+  for (const auto &testVector : testVectors) {
+    InternetMessage::RequestLine requestLine;
+    size_t consumed = 0;
+    INFO(testVector.buffer);
+    const auto result = InternetMessage::ParseRequestLine(testVector.buffer, requestLine, consumed);
+    REQUIRE(result.error == testVector.error);
+    REQUIRE(result.offset == testVector.offset);
+  }
+}
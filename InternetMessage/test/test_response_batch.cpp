@@ -0,0 +1,78 @@
+#include "../headers/response_batch.hpp"
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+std::string ReadAll(int fileDescriptor)
+{
+  std::string received;
+  std::array<char, 4096> chunk{};
+  for (;;) {
+    const auto count = ::read(fileDescriptor, chunk.data(), chunk.size());
+    if (count <= 0) { break; }
+    received.append(chunk.data(), static_cast<size_t>(count));
+  }
+  return received;
+}
+
+}// namespace
+
+TEST_CASE("Response batch sends every response in order", "ResponseBatch")
+{
+  std::array<int, 2> pipeEnds{};
+  REQUIRE(::pipe(pipeEnds.data()) == 0);
+
+  InternetMessage::ResponseBatch batch;
+  REQUIRE(batch.Empty());
+  batch.Add("HTTP/1.1 200 OK\r\nContent-Length: 1\r\n\r\na");
+  batch.Add("");
+  batch.Add("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+  REQUIRE(batch.PendingBytes() == 84);
+
+  REQUIRE(batch.Flush(pipeEnds[1]));
+  REQUIRE(batch.Empty());
+  REQUIRE(batch.PendingBytes() == 0);
+  ::close(pipeEnds[1]);
+
+  REQUIRE(ReadAll(pipeEnds[0])
+          == "HTTP/1.1 200 OK\r\nContent-Length: 1\r\n\r\na"
+             "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+  ::close(pipeEnds[0]);
+}
+
+TEST_CASE("Response batch keeps what a full connection did not take", "ResponseBatch")
+{
+  std::array<int, 2> pipeEnds{};
+  REQUIRE(::pipe(pipeEnds.data()) == 0);
+  REQUIRE(::fcntl(pipeEnds[1], F_SETFL, O_NONBLOCK) == 0);
+  const auto capacity = static_cast<size_t>(::fcntl(pipeEnds[1], F_GETPIPE_SZ));
+
+  // More than the pipe holds, spread over many responses
+  InternetMessage::ResponseBatch batch;
+  std::string expected;
+  for (size_t index = 0; expected.size() < capacity * 2; ++index) {
+    auto response = std::string(1000, static_cast<char>('a' + index % 26));
+    expected += response;
+    batch.Add(std::move(response));
+  }
+
+  REQUIRE_FALSE(batch.Flush(pipeEnds[1]));
+  REQUIRE(batch.PendingBytes() == expected.size() - capacity);
+
+  std::string received(capacity, '\0');
+  REQUIRE(::read(pipeEnds[0], received.data(), capacity) == static_cast<ssize_t>(capacity));
+  while (!batch.Flush(pipeEnds[1])) {
+    std::array<char, 4096> chunk{};
+    const auto count = ::read(pipeEnds[0], chunk.data(), chunk.size());
+    received.append(chunk.data(), static_cast<size_t>(count));
+  }
+  ::close(pipeEnds[1]);
+  received += ReadAll(pipeEnds[0]);
+  ::close(pipeEnds[0]);
+
+  REQUIRE(received == expected);
+}
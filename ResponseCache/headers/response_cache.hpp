@@ -0,0 +1,135 @@
+#ifndef RESPONSE_CACHE_HPP
+#define RESPONSE_CACHE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InternetMessage {
+class InternetMessage;
+}
+
+namespace Uri {
+class Uri;
+}
+
+namespace ResponseCache {
+
+/**
+ * This caches whole responses, ready to be written to a connection, in front
+ * of request handlers. A response is found by the canonical form of the
+ * request target, so equivalent targets such as "http://EXAMPLE.com/a/./b"
+ * and "http://example.com/a/b" share it, and by the values of the request
+ * headers the responses vary on.
+ *
+ * The cache is split into shards, each with its own lock and an equal part
+ * of the byte budget. Within a shard, responses are evicted with the CLOCK
+ * policy: a hit only marks its response as referenced, under a shared lock,
+ * so concurrent hits do not contend, and the clock hand evicts the first
+ * response not referenced since it last went by.
+ */
+class ResponseCache
+{
+public:
+  using Response = std::shared_ptr<const std::string>;
+
+  /** This is the number of shards used by default */
+  static constexpr size_t DEFAULT_SHARD_COUNT = 16;
+
+  /** Destructor, copy and move operators */
+  ~ResponseCache();
+  ResponseCache(const ResponseCache &) = delete;
+  ResponseCache(ResponseCache &&) noexcept;
+  ResponseCache &operator=(const ResponseCache &) = delete;
+  ResponseCache &operator=(ResponseCache &&) noexcept;
+
+  /**
+   * This constructs an empty cache
+   *
+   * @param[in] byteBudget
+   *    This is the most bytes of responses kept at once
+   *
+   * @param[in] varyHeaders
+   *    These are the names of the request headers whose values select
+   *    between the responses for one target, such as "Accept-Encoding"
+   *
+   * @param[in] shardCount
+   *    This is the number of independently locked parts of the cache
+   */
+  explicit ResponseCache(size_t byteBudget,
+    std::vector<std::string> varyHeaders = {},
+    size_t shardCount = DEFAULT_SHARD_COUNT);
+
+  /**
+   * This method looks up the response to a request
+   *
+   * @param[in] target
+   *    This is the request target
+   *
+   * @param[in] request
+   *    This is the request, for the values of the vary headers
+   *
+   * @return
+   *    The response, or nullptr if it is not cached. A response stays valid
+   *    for as long as it is referenced, even once evicted.
+   */
+  [[nodiscard]] Response Lookup(const Uri::Uri &target,
+    const InternetMessage::InternetMessage &request);
+
+  /**
+   * This method caches the response to a request, replacing any response
+   * already cached for it
+   *
+   * @param[in] target
+   *    This is the request target
+   *
+   * @param[in] request
+   *    This is the request, for the values of the vary headers
+   *
+   * @param[in] response
+   *    This is the whole response, as it is written to a connection
+   *
+   * @return
+   *    True if the response was cached, or false if it is larger than a
+   *    shard can hold
+   */
+  bool Insert(const Uri::Uri &target,
+    const InternetMessage::InternetMessage &request,
+    std::string response);
+
+  /**
+   * This method drops every cached response for a target
+   *
+   * @return
+   *    The number of responses dropped
+   */
+  size_t Invalidate(const Uri::Uri &target);
+
+  /**
+   * This method returns the number of cached responses
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * This method returns the number of bytes of cached responses
+   */
+  [[nodiscard]] size_t Bytes() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace ResponseCache
+
+#endif// !RESPONSE_CACHE_HPP
@@ -0,0 +1,226 @@
+#include "response_cache.hpp"
+#include "internet_message.hpp"
+#include "uri.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace {
+
+using VaryValues = std::vector<std::optional<std::string>>;
+
+/**
+ * This is one cached response, with the key it is found by
+ */
+struct Entry
+{
+  uint64_t hash = 0;
+  Uri::Uri target;
+  VaryValues varyValues;
+  ResponseCache::ResponseCache::Response response;
+
+  /** This is set by every hit and cleared as the clock hand goes by */
+  std::atomic<bool> referenced = false;
+};
+
+/**
+ * This is one independently locked part of the cache. Its entries sit in a
+ * ring that the clock hand goes around, with free places in the ring
+ * reused before it grows.
+ */
+struct Shard
+{
+  std::shared_mutex mutex;
+  std::vector<std::unique_ptr<Entry>> ring;
+  std::vector<size_t> freePlaces;
+  std::unordered_multimap<uint64_t, size_t> placesOfHash;
+  size_t hand = 0;
+  size_t bytes = 0;
+  size_t count = 0;
+
+  // Methods
+
+  [[nodiscard]] std::optional<size_t>
+    Find(uint64_t hash, const Uri::Uri &target, const VaryValues &values) const
+  {
+    const auto [begin, end] = placesOfHash.equal_range(hash);
+    for (auto place = begin; place != end; ++place) {
+      const auto &entry = *ring[place->second];
+      if (entry.varyValues == values && entry.target == target) { return place->second; }
+    }
+    return std::nullopt;
+  }
+
+  void Remove(size_t place)
+  {
+    const auto &entry = *ring[place];
+    const auto [begin, end] = placesOfHash.equal_range(entry.hash);
+    for (auto candidate = begin; candidate != end; ++candidate) {
+      if (candidate->second == place) {
+        placesOfHash.erase(candidate);
+        break;
+      }
+    }
+    bytes -= entry.response->size();
+    --count;
+    ring[place].reset();
+    freePlaces.push_back(place);
+  }
+
+  /**
+   * This method moves the clock hand around the ring, giving referenced
+   * entries a second chance and evicting the others, until the new entry
+   * fits within the budget
+   */
+  void MakeRoom(size_t needed, size_t budget)
+  {
+    while (count > 0 && bytes + needed > budget) {
+      if (hand >= ring.size()) { hand = 0; }
+      const auto &entry = ring[hand];
+      if (entry != nullptr && !entry->referenced.exchange(false, std::memory_order_relaxed)) {
+        Remove(hand);
+      }
+      ++hand;
+    }
+  }
+
+  void Add(std::unique_ptr<Entry> entry)
+  {
+    bytes += entry->response->size();
+    ++count;
+    const auto hash = entry->hash;
+    size_t place = ring.size();
+    if (freePlaces.empty()) {
+      ring.push_back(std::move(entry));
+    } else {
+      place = freePlaces.back();
+      freePlaces.pop_back();
+      ring[place] = std::move(entry);
+    }
+    placesOfHash.emplace(hash, place);
+  }
+};
+
+}// namespace
+
+namespace ResponseCache {
+
+struct ResponseCache::Implementation
+{
+  size_t shardBudget = 0;
+  std::vector<std::string> varyHeaders;
+  std::vector<Shard> shards;
+
+  // Methods
+
+  Implementation(size_t byteBudget, std::vector<std::string> headers, size_t shardCount)
+    : varyHeaders(std::move(headers)), shards(std::max(shardCount, size_t{ 1 }))
+  {
+    shardBudget = byteBudget / shards.size();
+  }
+
+  [[nodiscard]] VaryValues ValuesOf(const InternetMessage::InternetMessage &request) const
+  {
+    VaryValues values;
+    values.reserve(varyHeaders.size());
+    for (const auto &name : varyHeaders) { values.push_back(request.GetHeaderValue(name)); }
+    return values;
+  }
+
+  Shard &ShardOf(uint64_t hash)
+  {
+    constexpr unsigned int HALF_BITS = 32;
+    return shards[(hash ^ (hash >> HALF_BITS)) % shards.size()];
+  }
+};
+
+ResponseCache::~ResponseCache() = default;
+
+ResponseCache::ResponseCache(ResponseCache &&) noexcept = default;
+
+ResponseCache &ResponseCache::operator=(ResponseCache &&) noexcept = default;
+
+ResponseCache::ResponseCache(size_t byteBudget,
+  std::vector<std::string> varyHeaders,
+  size_t shardCount)
+  : impl_(new Implementation(byteBudget, std::move(varyHeaders), shardCount))
+{}
+
+auto ResponseCache::Lookup(const Uri::Uri &target, const InternetMessage::InternetMessage &request)
+  -> Response
+{
+  const auto values = impl_->ValuesOf(request);
+  const auto hash = target.GetHash();
+  auto &shard = impl_->ShardOf(hash);
+
+  const std::shared_lock lock(shard.mutex);
+  const auto place = shard.Find(hash, target, values);
+  if (!place) { return nullptr; }
+  auto &entry = *shard.ring[*place];
+  entry.referenced.store(true, std::memory_order_relaxed);
+  return entry.response;
+}
+
+bool ResponseCache::Insert(const Uri::Uri &target,
+  const InternetMessage::InternetMessage &request,
+  std::string response)
+{
+  if (response.size() > impl_->shardBudget) { return false; }
+
+  // The key keeps its own copy of the target, made outside the lock
+  auto entry = std::make_unique<Entry>();
+  if (!entry->target.ParseFromString(target.GenerateString())) { return false; }
+  entry->hash = target.GetHash();
+  entry->varyValues = impl_->ValuesOf(request);
+  entry->response = std::make_shared<const std::string>(std::move(response));
+
+  auto &shard = impl_->ShardOf(entry->hash);
+  const std::unique_lock lock(shard.mutex);
+  if (const auto existing = shard.Find(entry->hash, target, entry->varyValues)) {
+    shard.Remove(*existing);
+  }
+  shard.MakeRoom(entry->response->size(), impl_->shardBudget);
+  shard.Add(std::move(entry));
+  return true;
+}
+
+size_t ResponseCache::Invalidate(const Uri::Uri &target)
+{
+  const auto hash = target.GetHash();
+  auto &shard = impl_->ShardOf(hash);
+
+  const std::unique_lock lock(shard.mutex);
+  std::vector<size_t> places;
+  const auto [begin, end] = shard.placesOfHash.equal_range(hash);
+  for (auto place = begin; place != end; ++place) {
+    if (shard.ring[place->second]->target == target) { places.push_back(place->second); }
+  }
+  for (const auto place : places) { shard.Remove(place); }
+  return places.size();
+}
+
+size_t ResponseCache::Size() const
+{
+  size_t size = 0;
+  for (auto &shard : impl_->shards) {
+    const std::shared_lock lock(shard.mutex);
+    size += shard.count;
+  }
+  return size;
+}
+
+size_t ResponseCache::Bytes() const
+{
+  size_t bytes = 0;
+  for (auto &shard : impl_->shards) {
+    const std::shared_lock lock(shard.mutex);
+    bytes += shard.bytes;
+  }
+  return bytes;
+}
+
+}// namespace ResponseCache
@@ -0,0 +1,148 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "../headers/response_cache.hpp"
+#include <catch2/catch.hpp>
+
+#include "internet_message.hpp"
+#include "uri.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+Uri::Uri MakeUri(const std::string &uriString)
+{
+  Uri::Uri uri;
+  REQUIRE(uri.ParseFromString(uriString));
+  return uri;
+}
+
+std::unique_ptr<InternetMessage::InternetMessage> MakeRequest(const std::string &headerLines = "")
+{
+  auto request = std::make_unique<InternetMessage::InternetMessage>();
+  REQUIRE(request->ParseFromRawMessage(headerLines + "\r\n"));
+  return request;
+}
+
+}// namespace
+
+TEST_CASE("Response cache finds responses by canonical target", "ResponseCache")
+{
+  ResponseCache::ResponseCache cache(1024);
+  const auto request = MakeRequest();
+
+  REQUIRE(cache.Lookup(MakeUri("http://example.com/a/b"), *request) == nullptr);
+  REQUIRE(cache.Insert(MakeUri("http://example.com/a/b"), *request, "HTTP/1.1 200 OK\r\n\r\n"));
+  REQUIRE(cache.Size() == 1);
+  REQUIRE(cache.Bytes() == 19);
+
+  const auto hit = cache.Lookup(MakeUri("HTTP://EXAMPLE.com:80/a/./c/../b"), *request);
+  REQUIRE(hit != nullptr);
+  REQUIRE(*hit == "HTTP/1.1 200 OK\r\n\r\n");
+  REQUIRE(cache.Lookup(MakeUri("http://example.com/a/b?x"), *request) == nullptr);
+  REQUIRE(cache.Lookup(MakeUri("https://example.com/a/b"), *request) == nullptr);
+
+  // Inserting again replaces the response, while the old one stays valid
+  REQUIRE(cache.Insert(MakeUri("http://example.com/a/b"), *request, "new"));
+  REQUIRE(cache.Size() == 1);
+  REQUIRE(*cache.Lookup(MakeUri("http://example.com/a/b"), *request) == "new");
+  REQUIRE(*hit == "HTTP/1.1 200 OK\r\n\r\n");
+}
+
+TEST_CASE("Response cache keeps a response per value of the vary headers", "ResponseCache")
+{
+  ResponseCache::ResponseCache cache(1024, { "Accept-Encoding" });
+  const auto target = MakeUri("http://example.com/");
+  const auto plain = MakeRequest();
+  const auto gzip = MakeRequest("Accept-Encoding: gzip\r\n");
+  const auto gzipOtherCase = MakeRequest("accept-encoding: gzip\r\nUser-Agent: test\r\n");
+  const auto brotli = MakeRequest("Accept-Encoding: br\r\n");
+
+  REQUIRE(cache.Insert(target, *plain, "plain"));
+  REQUIRE(cache.Insert(target, *gzip, "gzip"));
+  REQUIRE(*cache.Lookup(target, *plain) == "plain");
+  REQUIRE(*cache.Lookup(target, *gzip) == "gzip");
+  REQUIRE(*cache.Lookup(target, *gzipOtherCase) == "gzip");
+  REQUIRE(cache.Lookup(target, *brotli) == nullptr);
+
+  REQUIRE(cache.Invalidate(target) == 2);
+  REQUIRE(cache.Size() == 0);
+  REQUIRE(cache.Lookup(target, *gzip) == nullptr);
+}
+
+TEST_CASE("Response cache evicts within its byte budget", "ResponseCache")
+{
+  ResponseCache::ResponseCache cache(30, {}, 1);
+  const auto request = MakeRequest();
+  const std::string response(10, 'x');
+
+  REQUIRE(cache.Insert(MakeUri("/a"), *request, response));
+  REQUIRE(cache.Insert(MakeUri("/b"), *request, response));
+  REQUIRE(cache.Insert(MakeUri("/c"), *request, response));
+  REQUIRE(cache.Lookup(MakeUri("/a"), *request) != nullptr);
+
+  // The clock hand passes over the referenced response and evicts the next
+  REQUIRE(cache.Insert(MakeUri("/d"), *request, response));
+  REQUIRE(cache.Size() == 3);
+  REQUIRE(cache.Bytes() == 30);
+  REQUIRE(cache.Lookup(MakeUri("/a"), *request) != nullptr);
+  REQUIRE(cache.Lookup(MakeUri("/b"), *request) == nullptr);
+  REQUIRE(cache.Lookup(MakeUri("/c"), *request) != nullptr);
+  REQUIRE(cache.Lookup(MakeUri("/d"), *request) != nullptr);
+
+  // A response larger than the budget is not cached
+  REQUIRE_FALSE(cache.Insert(MakeUri("/e"), *request, std::string(31, 'x')));
+  REQUIRE(cache.Size() == 3);
+}
+
+TEST_CASE("Response cache is safe to share between threads", "ResponseCache")
+{
+  ResponseCache::ResponseCache cache(4096, {}, 4);
+  const auto request = MakeRequest();
+  std::vector<Uri::Uri> targets;
+  for (int index = 0; index < 64; ++index) {
+    targets.push_back(MakeUri("/" + std::to_string(index)));
+  }
+
+  std::vector<std::thread> threads;
+  std::atomic<size_t> wrongResponses = 0;
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([&] {
+      for (int round = 0; round < 200; ++round) {
+        for (size_t index = 0; index < targets.size(); ++index) {
+          const auto expected = std::to_string(index) + std::string(32, '.');
+          if (const auto hit = cache.Lookup(targets[index], *request)) {
+            if (*hit != expected) { ++wrongResponses; }
+          } else {
+            cache.Insert(targets[index], *request, expected);
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+
+  REQUIRE(wrongResponses == 0);
+  REQUIRE(cache.Bytes() <= 4096);
+}
+
+TEST_CASE("Response cache benchmark", "[.benchmark]")
+{
+  const std::string target = "http://www.example.com/products/list?page=2&sort=price";
+  const std::string headers = "Host: www.example.com\r\nAccept-Encoding: gzip\r\n"
+                              "User-Agent: benchmark\r\nAccept: */*\r\n\r\n";
+  ResponseCache::ResponseCache cache(1 << 20, { "Accept-Encoding" });
+  const auto uri = MakeUri(target);
+  const auto request = MakeRequest("Accept-Encoding: gzip\r\n");
+  cache.Insert(uri, *request, std::string(2048, 'x'));
+
+  BENCHMARK("parse the request")
+  {
+    Uri::Uri parsedUri;
+    InternetMessage::InternetMessage parsedRequest;
+    return static_cast<bool>(parsedUri.ParseFromString(target))
+           && static_cast<bool>(parsedRequest.ParseFromRawMessage(headers));
+  };
+
+  BENCHMARK("cache hit") { return cache.Lookup(uri, *request); };
+}
@@ -0,0 +1,132 @@
+#ifndef FILE_CACHE_HPP
+#define FILE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <string>
+
+namespace StaticFiles {
+
+/**
+ * This is a file of the document root held open, along with what a response
+ * needs to know about it without touching the file system again
+ */
+struct CachedFile
+{
+  /** Destructor, copy and move operators */
+  ~CachedFile();
+  CachedFile(const CachedFile &) = delete;
+  CachedFile(CachedFile &&) = delete;
+  CachedFile &operator=(const CachedFile &) = delete;
+  CachedFile &operator=(CachedFile &&) = delete;
+
+  /**
+   * This takes ownership of an open file
+   *
+   * @param[in] newFileDescriptor
+   *    This is the file, opened for reading
+   */
+  explicit CachedFile(int newFileDescriptor);
+
+  int fileDescriptor = -1;
+  uint64_t size = 0;
+  timespec modified{};
+
+  /** This is the entity tag, quotes included, derived from the inode, size and time */
+  std::string etag;
+
+  /** This is the time of the last modification as an HTTP date */
+  std::string lastModified;
+};
+
+/**
+ * This keeps the most recently served files of a document root open, so
+ * that serving a file again needs no path lookup, open or stat. The
+ * directories of cached files are watched with inotify(7) and any change to
+ * a file, or to a directory on its path, drops it from the cache.
+ *
+ * The cache is not thread safe; each reactor thread owns its own.
+ */
+class FileCache
+{
+public:
+  /** This is how many files are kept open by default */
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  /** Destructor, copy and move operators */
+  ~FileCache();
+  FileCache(const FileCache &) = delete;
+  FileCache(FileCache &&) noexcept;
+  FileCache &operator=(const FileCache &) = delete;
+  FileCache &operator=(FileCache &&) noexcept;
+
+  /**
+   * This constructs an empty cache of the files of a document root
+   *
+   * @param[in] documentRoot
+   *    This is the directory that files are served from
+   *
+   * @param[in] capacity
+   *    This is the most files kept open at once
+   *
+   * @throws std::system_error
+   *    If the document root cannot be opened
+   */
+  explicit FileCache(const std::string &documentRoot, size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * This method returns a file of the document root, opening it if it is
+   * not cached
+   *
+   * @param[in] relativePath
+   *    This is the path of the file within the document root. It must
+   *    already be free of "." and ".." segments.
+   *
+   * @return
+   *    The file, or nullptr if there is no regular file at the path. A file
+   *    stays open for as long as it is referenced, even once dropped from
+   *    the cache.
+   */
+  [[nodiscard]] std::shared_ptr<const CachedFile> Open(const std::string &relativePath);
+
+  /**
+   * This method returns the inotify(7) file descriptor, for the reactor to
+   * poll for reading, or -1 if inotify is not available, in which case
+   * nothing is cached
+   */
+  [[nodiscard]] int NotificationFileDescriptor() const;
+
+  /**
+   * This method drops the files that have changed since the last call. It
+   * does not block, and should be called when the notification file
+   * descriptor is readable.
+   *
+   * @return
+   *    The number of files dropped from the cache
+   */
+  size_t ProcessNotifications();
+
+  /**
+   * This method returns the number of files in the cache
+   */
+  [[nodiscard]] size_t Size() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace StaticFiles
+
+#endif// !FILE_CACHE_HPP
@@ -0,0 +1,135 @@
+#ifndef FILE_SERVER_HPP
+#define FILE_SERVER_HPP
+
+#include "file_cache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace InternetMessage {
+class InternetMessage;
+}
+
+namespace Uri {
+class Uri;
+}
+
+namespace StaticFiles {
+
+/**
+ * This is the answer to a request for a file: the status line and headers,
+ * and the part of the file that follows them as the body, if any
+ */
+struct FileResponse
+{
+  unsigned int status = 0;
+
+  /** This is what is left to send of the status line and headers */
+  std::string head;
+
+  /** This is the file the body is taken from, or nullptr if there is no body */
+  std::shared_ptr<const CachedFile> file;
+
+  /** These are the part of the file left to send */
+  uint64_t offset = 0;
+  uint64_t length = 0;
+};
+
+/**
+ * This function maps the path of a request target to a path within the
+ * document root. The path is normalized first, so ".." segments cannot
+ * climb out of the document root, and paths ending in a slash map to the
+ * index file of the directory.
+ *
+ * @param[in] target
+ *    This is the request target
+ *
+ * @return
+ *    The relative path of the file, or std::nullopt if the target does not
+ *    have an absolute path or has a segment that cannot name a file
+ */
+[[nodiscard]] std::optional<std::string> MapPath(const Uri::Uri &target);
+
+/**
+ * This serves the files of a document root. Requests are answered from the
+ * cached size, time and entity tag of the file, so range requests and
+ * conditional requests never read the file, and bodies are sent with
+ * sendfile(2) so that their data never passes through user space.
+ */
+class FileServer
+{
+public:
+  /** This is the file served for a path that ends in a slash */
+  static constexpr std::string_view INDEX_FILE = "index.html";
+
+  /**
+   * This constructs a server of the files of a document root
+   *
+   * @param[in] documentRoot
+   *    This is the directory that files are served from
+   *
+   * @param[in] cacheCapacity
+   *    This is the most files kept open at once
+   *
+   * @throws std::system_error
+   *    If the document root cannot be opened
+   */
+  explicit FileServer(const std::string &documentRoot,
+    size_t cacheCapacity = FileCache::DEFAULT_CAPACITY);
+
+  /**
+   * This method answers a request, honouring the If-None-Match,
+   * If-Modified-Since, Range and If-Range headers
+   *
+   * @param[in] method
+   *    This is the method of the request; only GET and HEAD are allowed
+   *
+   * @param[in] target
+   *    This is the request target
+   *
+   * @param[in] request
+   *    This is the request, for its headers
+   *
+   * @return
+   *    The response, ready to be sent
+   */
+  [[nodiscard]] FileResponse Respond(std::string_view method,
+    const Uri::Uri &target,
+    const InternetMessage::InternetMessage &request);
+
+  /**
+   * This method sends what is left of a response, the head with write(2)
+   * and the body with sendfile(2)
+   *
+   * @param[in] socket
+   *    This is the connection to send to
+   *
+   * @param[in,out] response
+   *    This is the response; what has been sent is removed from it
+   *
+   * @return
+   *    True if everything was sent, or false if the socket is non blocking
+   *    and would block, in which case the rest is left in the response
+   *
+   * @throws std::system_error
+   *    If sending fails for any other reason
+   */
+  static bool Send(int socket, FileResponse &response);
+
+  /**
+   * This method returns the cache of open files, for the reactor to poll
+   * its notification file descriptor
+   */
+  [[nodiscard]] FileCache &Cache();
+
+private:
+  FileCache cache_;
+};
+
+}// namespace StaticFiles
+
+#endif// !FILE_SERVER_HPP
@@ -0,0 +1,306 @@
+#include "file_cache.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <list>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace {
+
+/** These are the changes to a directory that make its cached files stale */
+constexpr uint32_t WATCHED_EVENTS = IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE
+                                    | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF
+                                    | IN_MOVE_SELF;
+
+/**
+ * This function formats a time as an HTTP date (RFC 7231 section 7.1.1.1)
+ */
+std::string FormatHttpDate(time_t time)
+{
+  tm parts{};
+  gmtime_r(&time, &parts);
+  std::array<char, 32> formatted{};
+  const auto length =
+    std::strftime(formatted.data(), formatted.size(), "%a, %d %b %Y %H:%M:%S GMT", &parts);
+  return { formatted.data(), length };
+}
+
+/**
+ * This function derives an entity tag that changes whenever the file is
+ * replaced or written to
+ */
+std::string MakeEntityTag(const struct stat &status)
+{
+  constexpr int64_t NANOSECONDS_PER_SECOND = 1'000'000'000;
+  const auto modified = static_cast<uint64_t>(
+    status.st_mtim.tv_sec * NANOSECONDS_PER_SECOND + status.st_mtim.tv_nsec);
+  std::array<char, 64> formatted{};
+  const auto length = std::snprintf(formatted.data(),
+    formatted.size(),
+    "\"%llx-%llx-%llx\"",
+    static_cast<unsigned long long>(status.st_ino),
+    static_cast<unsigned long long>(status.st_size),
+    static_cast<unsigned long long>(modified));
+  return { formatted.data(), static_cast<size_t>(length) };
+}
+
+/**
+ * This function returns the directory part of a relative path, which is
+ * empty for the files at the top of the document root
+ */
+std::string ParentOf(const std::string &relativePath)
+{
+  const auto slash = relativePath.rfind('/');
+  return slash == std::string::npos ? std::string() : relativePath.substr(0, slash);
+}
+
+}// namespace
+
+namespace StaticFiles {
+
+CachedFile::CachedFile(int newFileDescriptor) : fileDescriptor(newFileDescriptor) {}
+
+CachedFile::~CachedFile()
+{
+  if (fileDescriptor >= 0) { ::close(fileDescriptor); }
+}
+
+struct FileCache::Implementation
+{
+  struct Entry
+  {
+    std::string path;
+    std::shared_ptr<const CachedFile> file;
+  };
+
+  std::string documentRoot;
+  int rootFileDescriptor = -1;
+  int inotifyFileDescriptor = -1;
+  size_t capacity = 0;
+
+  /** These are the cached files, the most recently used first */
+  std::list<Entry> entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entryOfPath;
+
+  /** These map between the watched directories and their watch descriptors */
+  std::unordered_map<int, std::string> directoryOfWatch;
+  std::unordered_map<std::string, int> watchOfDirectory;
+
+  // Methods
+
+  ~Implementation()
+  {
+    if (inotifyFileDescriptor >= 0) { ::close(inotifyFileDescriptor); }
+    if (rootFileDescriptor >= 0) { ::close(rootFileDescriptor); }
+  }
+  Implementation(const Implementation &) = delete;
+  Implementation(Implementation &&) = delete;
+  Implementation &operator=(const Implementation &) = delete;
+  Implementation &operator=(Implementation &&) = delete;
+
+  Implementation(const std::string &root, size_t maximumFiles)
+    : documentRoot(root), capacity(maximumFiles)
+  {
+    rootFileDescriptor = ::open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (rootFileDescriptor < 0) {
+      throw std::system_error(errno, std::generic_category(), "open " + root);
+    }
+    inotifyFileDescriptor = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  }
+
+  /**
+   * This method makes sure the directory and every directory above it up to
+   * the document root are watched, so that renaming any of them is seen,
+   * returning false if they cannot be
+   */
+  bool Watch(const std::string &directory)
+  {
+    if (watchOfDirectory.contains(directory)) { return true; }
+    if (!directory.empty() && !Watch(ParentOf(directory))) { return false; }
+    const auto path = directory.empty() ? documentRoot : documentRoot + "/" + directory;
+    const auto watch = ::inotify_add_watch(inotifyFileDescriptor, path.c_str(), WATCHED_EVENTS);
+    if (watch < 0) { return false; }
+    directoryOfWatch[watch] = directory;
+    watchOfDirectory[directory] = watch;
+    return true;
+  }
+
+  /**
+   * This method drops a file from the cache, along with everything under it
+   * if it is a directory
+   */
+  size_t Evict(const std::string &path, bool isDirectory)
+  {
+    size_t evicted = 0;
+    if (const auto entry = entryOfPath.find(path); entry != entryOfPath.end()) {
+      entries.erase(entry->second);
+      entryOfPath.erase(entry);
+      ++evicted;
+    }
+    if (isDirectory) {
+      const auto prefix = path.empty() ? path : path + "/";
+      for (auto entry = entries.begin(); entry != entries.end();) {
+        if (entry->path.starts_with(prefix)) {
+          entryOfPath.erase(entry->path);
+          entry = entries.erase(entry);
+          ++evicted;
+        } else {
+          ++entry;
+        }
+      }
+    }
+    return evicted;
+  }
+
+  /**
+   * This method stops watching a directory that is gone or has moved, along
+   * with every directory under it, which would otherwise stay watched under
+   * their old paths
+   */
+  void Forget(const std::string &directory)
+  {
+    const auto prefix = directory.empty() ? directory : directory + "/";
+    for (auto watched = watchOfDirectory.begin(); watched != watchOfDirectory.end();) {
+      if (watched->first == directory || watched->first.starts_with(prefix)) {
+        // The kernel may have dropped the watch already, which is harmless
+        ::inotify_rm_watch(inotifyFileDescriptor, watched->second);
+        directoryOfWatch.erase(watched->second);
+        watched = watchOfDirectory.erase(watched);
+      } else {
+        ++watched;
+      }
+    }
+  }
+
+  /**
+   * This method opens a file of the document root one segment at a time, as
+   * O_NOFOLLOW only holds for the last one, so that no symbolic link or ".."
+   * anywhere on the path can lead out of the root
+   */
+  std::shared_ptr<const CachedFile> OpenUncached(const std::string &relativePath) const
+  {
+    auto directoryFileDescriptor = rootFileDescriptor;
+    size_t segmentBegin = 0;
+    for (auto slash = relativePath.find('/'); slash != std::string::npos;
+         slash = relativePath.find('/', segmentBegin)) {
+      const auto segment = relativePath.substr(segmentBegin, slash - segmentBegin);
+      segmentBegin = slash + 1;
+      if (segment.empty()) { continue; }
+      const auto next = segment == ".."
+                          ? -1
+                          : ::openat(directoryFileDescriptor,
+                            segment.c_str(),
+                            O_PATH | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+      if (directoryFileDescriptor != rootFileDescriptor) { ::close(directoryFileDescriptor); }
+      if (next < 0) { return nullptr; }
+      directoryFileDescriptor = next;
+    }
+
+    const auto name = relativePath.substr(segmentBegin);
+    const auto fileDescriptor = name == ".." ? -1
+                                             : ::openat(directoryFileDescriptor,
+                                               name.c_str(),
+                                               O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (directoryFileDescriptor != rootFileDescriptor) { ::close(directoryFileDescriptor); }
+    if (fileDescriptor < 0) { return nullptr; }
+    auto file = std::make_shared<CachedFile>(fileDescriptor);
+
+    struct stat status{};
+    if (::fstat(fileDescriptor, &status) != 0 || !S_ISREG(status.st_mode)) { return nullptr; }
+    file->size = static_cast<uint64_t>(status.st_size);
+    file->modified = status.st_mtim;
+    file->etag = MakeEntityTag(status);
+    file->lastModified = FormatHttpDate(status.st_mtim.tv_sec);
+    return file;
+  }
+};
+
+FileCache::~FileCache() = default;
+
+FileCache::FileCache(FileCache &&) noexcept = default;
+
+FileCache &FileCache::operator=(FileCache &&) noexcept = default;
+
+FileCache::FileCache(const std::string &documentRoot, size_t capacity)
+  : impl_(new Implementation(documentRoot, capacity))
+{}
+
+std::shared_ptr<const CachedFile> FileCache::Open(const std::string &relativePath)
+{
+  if (const auto entry = impl_->entryOfPath.find(relativePath); entry != impl_->entryOfPath.end()) {
+    impl_->entries.splice(impl_->entries.begin(), impl_->entries, entry->second);
+    return entry->second->file;
+  }
+
+  // The directories are watched before the file is opened, so that a change
+  // made in between is not missed
+  const auto cacheable = impl_->capacity > 0 && impl_->inotifyFileDescriptor >= 0
+                         && impl_->Watch(ParentOf(relativePath));
+  auto file = impl_->OpenUncached(relativePath);
+  if (file == nullptr || !cacheable) { return file; }
+
+  if (impl_->entries.size() >= impl_->capacity) {
+    impl_->entryOfPath.erase(impl_->entries.back().path);
+    impl_->entries.pop_back();
+  }
+  impl_->entries.push_front({ relativePath, file });
+  impl_->entryOfPath[relativePath] = impl_->entries.begin();
+  return file;
+}
+
+int FileCache::NotificationFileDescriptor() const { return impl_->inotifyFileDescriptor; }
+
+size_t FileCache::ProcessNotifications()
+{
+  if (impl_->inotifyFileDescriptor < 0) { return 0; }
+
+  size_t evicted = 0;
+  alignas(inotify_event) std::array<char, 4096> events{};
+  while (true) {
+    const auto received = ::read(impl_->inotifyFileDescriptor, events.data(), events.size());
+    if (received <= 0) { break; }
+
+    for (size_t offset = 0; offset < static_cast<size_t>(received);) {
+      inotify_event event{};
+      std::memcpy(&event, events.data() + offset, sizeof(event));
+      const auto *const nameBegin = events.data() + offset + sizeof(event);
+      const std::string name(nameBegin, ::strnlen(nameBegin, event.len));
+      offset += sizeof(event) + event.len;
+
+      if ((event.mask & IN_Q_OVERFLOW) != 0) {
+        evicted += impl_->entries.size();
+        impl_->entries.clear();
+        impl_->entryOfPath.clear();
+        continue;
+      }
+      const auto directory = impl_->directoryOfWatch.find(event.wd);
+      if (directory == impl_->directoryOfWatch.end()) { continue; }
+
+      // A directory that is gone or has moved is watched again under its new
+      // path if a file under it is asked for
+      if ((event.mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) != 0) {
+        const auto gone = directory->second;
+        evicted += impl_->Evict(gone, true);
+        impl_->Forget(gone);
+        continue;
+      }
+      const auto path = directory->second.empty() ? name : directory->second + "/" + name;
+      const auto isDirectory = (event.mask & IN_ISDIR) != 0;
+      evicted += impl_->Evict(path, isDirectory);
+      if (isDirectory && (event.mask & (IN_MOVED_FROM | IN_DELETE)) != 0) { impl_->Forget(path); }
+    }
+  }
+  return evicted;
+}
+
+size_t FileCache::Size() const { return impl_->entries.size(); }
+
+}// namespace StaticFiles
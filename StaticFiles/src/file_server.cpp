@@ -0,0 +1,318 @@
+#include "file_server.hpp"
+#include "header_value.hpp"
+#include "internet_message.hpp"
+#include "uri.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <ctime>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <system_error>
+
+namespace {
+
+/** This is the most sendfile(2) transfers in one call on Linux */
+constexpr uint64_t MAX_SENDFILE_CHUNK = 0x7FFFF000;
+
+/**
+ * This function checks if the error means that a non blocking write would
+ * have blocked
+ */
+bool WouldBlock(int error)
+{
+#if EAGAIN == EWOULDBLOCK
+  return error == EAGAIN;
+#else
+  return error == EAGAIN || error == EWOULDBLOCK;
+#endif
+}
+
+std::string_view StatusText(unsigned int status)
+{
+  switch (status) {
+  case 200:
+    return "OK";
+  case 206:
+    return "Partial Content";
+  case 304:
+    return "Not Modified";
+  case 404:
+    return "Not Found";
+  case 405:
+    return "Method Not Allowed";
+  case 416:
+    return "Range Not Satisfiable";
+  default:
+    return "Unknown";
+  }
+}
+
+/**
+ * This function guesses the media type of a file from its extension
+ */
+std::string_view ContentTypeOf(std::string_view path)
+{
+  struct MediaType
+  {
+    std::string_view extension;
+    std::string_view type;
+  };
+  constexpr std::array<MediaType, 15> MEDIA_TYPES{ {
+    { ".html", "text/html; charset=utf-8" },
+    { ".htm", "text/html; charset=utf-8" },
+    { ".css", "text/css; charset=utf-8" },
+    { ".js", "text/javascript; charset=utf-8" },
+    { ".json", "application/json" },
+    { ".txt", "text/plain; charset=utf-8" },
+    { ".xml", "application/xml" },
+    { ".svg", "image/svg+xml" },
+    { ".png", "image/png" },
+    { ".jpg", "image/jpeg" },
+    { ".jpeg", "image/jpeg" },
+    { ".gif", "image/gif" },
+    { ".ico", "image/x-icon" },
+    { ".wasm", "application/wasm" },
+    { ".pdf", "application/pdf" },
+  } };
+
+  for (const auto &mediaType : MEDIA_TYPES) {
+    if (path.ends_with(mediaType.extension)) { return mediaType.type; }
+  }
+  return "application/octet-stream";
+}
+
+/**
+ * This function parses an HTTP date in the preferred format, such as
+ * "Sun, 06 Nov 1994 08:49:37 GMT" (RFC 7231 section 7.1.1.1)
+ */
+std::optional<time_t> ParseHttpDate(const std::string &date)
+{
+  tm parts{};
+  const auto *const end = ::strptime(date.c_str(), "%a, %d %b %Y %H:%M:%S GMT", &parts);
+  if (end == nullptr || *end != '\0') { return std::nullopt; }
+  return ::timegm(&parts);
+}
+
+/**
+ * This function checks if the entity tag is in the list of an If-None-Match
+ * header, using the weak comparison (RFC 7232 section 2.3.2)
+ */
+bool MatchesAnyEntityTag(std::string_view list, std::string_view etag)
+{
+  const auto opaque = [](std::string_view tag) {
+    return tag.starts_with("W/") ? tag.substr(2) : tag;
+  };
+
+  InternetMessage::ListTokenizer tokenizer(list);
+  for (std::string_view candidate; tokenizer.Next(candidate);) {
+    if (candidate == "*" || opaque(candidate) == opaque(etag)) { return true; }
+  }
+  return false;
+}
+
+std::optional<uint64_t> ParseNumber(std::string_view digits)
+{
+  uint64_t number = 0;
+  const auto *const end = digits.data() + digits.size();
+  const auto [parsed, error] = std::from_chars(digits.data(), end, number);
+  if (digits.empty() || error != std::errc() || parsed != end) { return std::nullopt; }
+  return number;
+}
+
+struct ByteRange
+{
+  uint64_t first = 0;
+  uint64_t last = 0;
+  bool satisfiable = true;
+};
+
+/**
+ * This function parses a Range header asking for a single range of bytes
+ * (RFC 7233 section 2.1). Anything else is ignored, as the RFC allows, and
+ * the whole file is sent.
+ */
+std::optional<ByteRange> ParseRange(std::string_view value, uint64_t size)
+{
+  constexpr std::string_view UNIT = "bytes=";
+  if (!value.starts_with(UNIT)) { return std::nullopt; }
+  const auto spec = InternetMessage::TrimWhiteSpace(value.substr(UNIT.size()));
+  const auto dash = spec.find('-');
+  if (dash == std::string_view::npos || spec.find(',') != std::string_view::npos) {
+    return std::nullopt;
+  }
+
+  if (dash == 0) {
+    const auto suffix = ParseNumber(spec.substr(1));
+    if (!suffix) { return std::nullopt; }
+    if (*suffix == 0 || size == 0) { return ByteRange{ 0, 0, false }; }
+    return ByteRange{ size - std::min(*suffix, size), size - 1 };
+  }
+
+  const auto first = ParseNumber(spec.substr(0, dash));
+  if (!first) { return std::nullopt; }
+  auto last = size == 0 ? 0 : size - 1;
+  if (dash + 1 < spec.size()) {
+    const auto parsedLast = ParseNumber(spec.substr(dash + 1));
+    if (!parsedLast || *parsedLast < *first) { return std::nullopt; }
+    last = std::min(last, *parsedLast);
+  }
+  if (*first >= size) { return ByteRange{ 0, 0, false }; }
+  return ByteRange{ *first, last };
+}
+
+std::string MakeHead(unsigned int status, const std::string &fields)
+{
+  return "HTTP/1.1 " + std::to_string(status) + " " + std::string(StatusText(status)) + "\r\n"
+         + fields + "\r\n";
+}
+
+}// namespace
+
+namespace StaticFiles {
+
+std::optional<std::string> MapPath(const Uri::Uri &target)
+{
+  Uri::Uri normalized;
+  normalized.SetPath(target.GetPath());
+  normalized.NormalizePath();
+  const auto segments = normalized.GetPath();
+  if (segments.empty() || !segments.front().empty()) { return std::nullopt; }
+
+  std::string path;
+  for (size_t index = 1; index < segments.size(); ++index) {
+    const auto &segment = segments[index];
+    if (segment.empty()) {
+      if (index + 1 < segments.size()) { return std::nullopt; }
+      break;
+    }
+    if (segment == "." || segment == ".." || segment.find('/') != std::string::npos
+        || segment.find('\0') != std::string::npos) {
+      return std::nullopt;
+    }
+    if (!path.empty()) { path += '/'; }
+    path += segment;
+  }
+  if (segments.size() == 1 || segments.back().empty()) {
+    if (!path.empty()) { path += '/'; }
+    path += FileServer::INDEX_FILE;
+  }
+  return path;
+}
+
+FileServer::FileServer(const std::string &documentRoot, size_t cacheCapacity)
+  : cache_(documentRoot, cacheCapacity)
+{}
+
+FileResponse FileServer::Respond(std::string_view method,
+  const Uri::Uri &target,
+  const InternetMessage::InternetMessage &request)
+{
+  FileResponse response;
+  const auto isHead = method == "HEAD";
+  if (method != "GET" && !isHead) {
+    response.status = 405;
+    response.head = MakeHead(response.status, "Allow: GET, HEAD\r\nContent-Length: 0\r\n");
+    return response;
+  }
+
+  const auto path = MapPath(target);
+  auto file = path ? cache_.Open(*path) : nullptr;
+  if (file == nullptr) {
+    response.status = 404;
+    response.head = MakeHead(response.status, "Content-Length: 0\r\n");
+    return response;
+  }
+
+  std::string fields = "ETag: " + file->etag + "\r\nLast-Modified: " + file->lastModified
+                       + "\r\nAccept-Ranges: bytes\r\n";
+
+  // If-Modified-Since is only looked at without If-None-Match (RFC 7232
+  // section 6)
+  auto notModified = false;
+  if (const auto entityTags = request.GetHeaderView("If-None-Match")) {
+    notModified = MatchesAnyEntityTag(*entityTags, file->etag);
+  } else if (const auto since = request.GetHeaderView("If-Modified-Since")) {
+    const auto sinceTime = ParseHttpDate(std::string(*since));
+    notModified = sinceTime && file->modified.tv_sec <= *sinceTime;
+  }
+  if (notModified) {
+    response.status = 304;
+    response.head = MakeHead(response.status, fields);
+    return response;
+  }
+
+  response.status = 200;
+  response.length = file->size;
+  const auto range = isHead ? std::nullopt : request.GetHeaderView("Range");
+  const auto ifRange = request.GetHeaderView("If-Range");
+  if (range && (!ifRange || *ifRange == file->etag || *ifRange == file->lastModified)) {
+    if (const auto byteRange = ParseRange(*range, file->size)) {
+      if (!byteRange->satisfiable) {
+        response.status = 416;
+        response.length = 0;
+        response.head = MakeHead(response.status,
+          fields + "Content-Range: bytes */" + std::to_string(file->size)
+            + "\r\nContent-Length: 0\r\n");
+        return response;
+      }
+      response.status = 206;
+      response.offset = byteRange->first;
+      response.length = byteRange->last - byteRange->first + 1;
+      fields += "Content-Range: bytes " + std::to_string(byteRange->first) + "-"
+                + std::to_string(byteRange->last) + "/" + std::to_string(file->size) + "\r\n";
+    }
+  }
+
+  fields += "Content-Type: " + std::string(ContentTypeOf(*path))
+            + "\r\nContent-Length: " + std::to_string(response.length) + "\r\n";
+  response.head = MakeHead(response.status, fields);
+  if (isHead) {
+    response.length = 0;
+  } else if (response.length > 0) {
+    response.file = std::move(file);
+  }
+  return response;
+}
+
+bool FileServer::Send(int socket, FileResponse &response)
+{
+  while (!response.head.empty()) {
+    // Ask for the head to be held back for the body, so that both leave in
+    // as few packets as possible
+    const auto flags = MSG_NOSIGNAL | (response.length > 0 ? MSG_MORE : 0);
+    const auto sent = ::send(socket, response.head.data(), response.head.size(), flags);
+    if (sent < 0) {
+      if (errno == EINTR) { continue; }
+      if (WouldBlock(errno)) { return false; }
+      throw std::system_error(errno, std::generic_category(), "send");
+    }
+    response.head.erase(0, static_cast<size_t>(sent));
+  }
+
+  while (response.length > 0) {
+    auto offset = static_cast<off_t>(response.offset);
+    const auto chunk = std::min(response.length, MAX_SENDFILE_CHUNK);
+    const auto sent = ::sendfile(socket, response.file->fileDescriptor, &offset, chunk);
+    if (sent < 0) {
+      if (errno == EINTR) { continue; }
+      if (WouldBlock(errno)) { return false; }
+      throw std::system_error(errno, std::generic_category(), "sendfile");
+    }
+    if (sent == 0) {
+      // The file was truncated after the response was made
+      throw std::system_error(EIO, std::generic_category(), "sendfile");
+    }
+    response.offset += static_cast<uint64_t>(sent);
+    response.length -= static_cast<uint64_t>(sent);
+  }
+
+  response.file.reset();
+  return true;
+}
+
+FileCache &FileServer::Cache() { return cache_; }
+
+}// namespace StaticFiles
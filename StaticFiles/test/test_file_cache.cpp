@@ -0,0 +1,151 @@
+#include "../headers/file_cache.hpp"
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * This is a document root that is removed with everything in it at the end
+ * of a test
+ */
+struct TemporaryDirectory
+{
+  TemporaryDirectory()
+  {
+    std::string pattern = (std::filesystem::temp_directory_path() / "file_cache_XXXXXX").string();
+    path = ::mkdtemp(pattern.data());
+  }
+  ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+  TemporaryDirectory(const TemporaryDirectory &) = delete;
+  TemporaryDirectory(TemporaryDirectory &&) = delete;
+  TemporaryDirectory &operator=(const TemporaryDirectory &) = delete;
+  TemporaryDirectory &operator=(TemporaryDirectory &&) = delete;
+
+  void Write(const std::string &relativePath, const std::string &content) const
+  {
+    const auto filePath = path / relativePath;
+    std::filesystem::create_directories(filePath.parent_path());
+    std::ofstream(filePath, std::ios::binary | std::ios::trunc) << content;
+  }
+
+  std::filesystem::path path;
+};
+
+}// namespace
+
+TEST_CASE("File cache opens regular files only", "FileCache")
+{
+  const TemporaryDirectory root;
+  root.Write("a.txt", "hello");
+  root.Write("dir/b.txt", "hi");
+  std::filesystem::create_symlink(root.path / "a.txt", root.path / "link.txt");
+  const TemporaryDirectory outside;
+  outside.Write("secret.txt", "secret");
+  std::filesystem::create_directory_symlink(outside.path, root.path / "escape");
+
+  StaticFiles::FileCache cache(root.path.string());
+  const auto file = cache.Open("a.txt");
+  REQUIRE(file != nullptr);
+  REQUIRE(file->size == 5);
+  REQUIRE(file->etag.front() == '"');
+  REQUIRE(file->etag.back() == '"');
+  REQUIRE(file->lastModified.ends_with(" GMT"));
+  REQUIRE(cache.Open("dir/b.txt") != nullptr);
+
+  REQUIRE(cache.Open("missing.txt") == nullptr);
+  REQUIRE(cache.Open("dir") == nullptr);
+  REQUIRE(cache.Open("link.txt") == nullptr);
+
+  // Links to directories are not followed either, nor ".." out of the root
+  REQUIRE(cache.Open("escape/secret.txt") == nullptr);
+  REQUIRE(cache.Open("dir/../a.txt") == nullptr);
+  REQUIRE(cache.Open("../" + outside.path.filename().string() + "/secret.txt") == nullptr);
+  REQUIRE(cache.Size() == 2);
+
+  REQUIRE_THROWS_AS(StaticFiles::FileCache((root.path / "missing").string()), std::system_error);
+}
+
+TEST_CASE("File cache serves repeated opens from the cache", "FileCache")
+{
+  const TemporaryDirectory root;
+  root.Write("a.txt", "hello");
+  root.Write("b.txt", "hello");
+  root.Write("c.txt", "hello");
+
+  StaticFiles::FileCache cache(root.path.string(), 2);
+  if (cache.NotificationFileDescriptor() < 0) {
+    WARN("inotify is not available");
+    return;
+  }
+
+  const auto first = cache.Open("a.txt");
+  REQUIRE(cache.Open("a.txt") == first);
+
+  // The least recently used file is dropped to make room
+  REQUIRE(cache.Open("b.txt") != nullptr);
+  REQUIRE(cache.Open("a.txt") == first);
+  REQUIRE(cache.Open("c.txt") != nullptr);
+  REQUIRE(cache.Size() == 2);
+  REQUIRE(cache.Open("a.txt") == first);
+}
+
+TEST_CASE("File cache drops files that change", "FileCache")
+{
+  const TemporaryDirectory root;
+  root.Write("a.txt", "hello");
+  root.Write("dir/sub/b.txt", "hi");
+
+  StaticFiles::FileCache cache(root.path.string());
+  if (cache.NotificationFileDescriptor() < 0) {
+    WARN("inotify is not available");
+    return;
+  }
+
+  const auto before = cache.Open("a.txt");
+  REQUIRE(cache.Open("dir/sub/b.txt") != nullptr);
+  REQUIRE(cache.ProcessNotifications() == 0);
+
+  root.Write("a.txt", "hello, world");
+  REQUIRE(cache.ProcessNotifications() >= 1);
+  const auto after = cache.Open("a.txt");
+  REQUIRE(after != before);
+  REQUIRE(after->size == 12);
+  REQUIRE(after->etag != before->etag);
+
+  // A file stays readable by whoever still holds it
+  REQUIRE(before->size == 5);
+  REQUIRE(::lseek(before->fileDescriptor, 0, SEEK_END) >= 0);
+
+  // Renaming a directory above a file drops it too
+  std::filesystem::rename(root.path / "dir", root.path / "moved");
+  REQUIRE(cache.ProcessNotifications() >= 1);
+  REQUIRE(cache.Open("dir/sub/b.txt") == nullptr);
+  REQUIRE(cache.Open("moved/sub/b.txt") != nullptr);
+}
+
+TEST_CASE("File cache watches directories made again after a rename", "FileCache")
+{
+  const TemporaryDirectory root;
+  root.Write("a/b/x", "old!");
+
+  StaticFiles::FileCache cache(root.path.string());
+  if (cache.NotificationFileDescriptor() < 0) {
+    WARN("inotify is not available");
+    return;
+  }
+
+  REQUIRE(cache.Open("a/b/x") != nullptr);
+  std::filesystem::rename(root.path / "a", root.path / "c");
+  REQUIRE(cache.ProcessNotifications() >= 1);
+
+  // The watch of "a/b" moved away with it, so the new "a/b" needs its own
+  root.Write("a/b/x", "new");
+  cache.ProcessNotifications();
+  REQUIRE(cache.Open("a/b/x")->size == 3);
+  root.Write("a/b/x", "newer and much longer");
+  REQUIRE(cache.ProcessNotifications() >= 1);
+  REQUIRE(cache.Open("a/b/x")->size == 21);
+}
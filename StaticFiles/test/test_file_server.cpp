@@ -0,0 +1,220 @@
+#include "../headers/file_server.hpp"
+#include <catch2/catch.hpp>
+
+#include "internet_message.hpp"
+#include "uri.hpp"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * This is a document root that is removed with everything in it at the end
+ * of a test
+ */
+struct TemporaryDirectory
+{
+  TemporaryDirectory()
+  {
+    std::string pattern = (std::filesystem::temp_directory_path() / "file_server_XXXXXX").string();
+    path = ::mkdtemp(pattern.data());
+  }
+  ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+  TemporaryDirectory(const TemporaryDirectory &) = delete;
+  TemporaryDirectory(TemporaryDirectory &&) = delete;
+  TemporaryDirectory &operator=(const TemporaryDirectory &) = delete;
+  TemporaryDirectory &operator=(TemporaryDirectory &&) = delete;
+
+  void Write(const std::string &relativePath, const std::string &content) const
+  {
+    const auto filePath = path / relativePath;
+    std::filesystem::create_directories(filePath.parent_path());
+    std::ofstream(filePath, std::ios::binary | std::ios::trunc) << content;
+  }
+
+  std::filesystem::path path;
+};
+
+/**
+ * This function answers a request made of a target and header lines
+ */
+StaticFiles::FileResponse Request(StaticFiles::FileServer &server,
+  std::string_view method,
+  const std::string &target,
+  const std::string &headerLines = "")
+{
+  Uri::Uri uri;
+  REQUIRE(uri.ParseFromString(target));
+  InternetMessage::InternetMessage request;
+  REQUIRE(request.ParseFromRawMessage(headerLines + "\r\n"));
+  return server.Respond(method, uri, request);
+}
+
+/**
+ * This function sends a response over a socket pair and returns what
+ * arrives at the other end
+ */
+std::string SendAndReceive(StaticFiles::FileResponse &response)
+{
+  std::array<int, 2> sockets{};
+  REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets.data()) == 0);
+  REQUIRE(StaticFiles::FileServer::Send(sockets[0], response));
+  ::close(sockets[0]);
+
+  std::string received;
+  std::array<char, 4096> chunk{};
+  ssize_t count = 0;
+  while ((count = ::read(sockets[1], chunk.data(), chunk.size())) > 0) {
+    received.append(chunk.data(), static_cast<size_t>(count));
+  }
+  ::close(sockets[1]);
+  return received;
+}
+
+}// namespace
+
+TEST_CASE("File server maps targets into the document root", "FileServer")
+{
+  struct TestVector
+  {
+    std::string target;
+    std::optional<std::string> path;
+  };
+
+  const std::vector<TestVector> testVectors{
+    { "/a/b.txt", "a/b.txt" },
+    { "/", "index.html" },
+    { "/a/", "a/index.html" },
+    { "/a/../b.txt", "b.txt" },
+    { "/../../etc/passwd", "etc/passwd" },
+    { "/%2e%2e/secret", "secret" },
+    { "/a%2Fb", std::nullopt },
+    { "/a//b", std::nullopt },
+    { "a/b.txt", std::nullopt },
+  };
+
+  for (const auto &testVector : testVectors) {
+    INFO("Target: " + testVector.target);
+    Uri::Uri uri;
+    REQUIRE(uri.ParseFromString(testVector.target));
+    REQUIRE(StaticFiles::MapPath(uri) == testVector.path);
+  }
+}
+
+TEST_CASE("File server sends whole files", "FileServer")
+{
+  const TemporaryDirectory root;
+  root.Write("index.html", "<p>home</p>");
+  StaticFiles::FileServer server(root.path.string());
+
+  auto response = Request(server, "GET", "/");
+  REQUIRE(response.status == 200);
+  REQUIRE(response.length == 11);
+  const auto received = SendAndReceive(response);
+  REQUIRE(received.starts_with("HTTP/1.1 200 OK\r\n"));
+  REQUIRE(received.find("Content-Type: text/html; charset=utf-8\r\n") != std::string::npos);
+  REQUIRE(received.find("Content-Length: 11\r\n") != std::string::npos);
+  REQUIRE(received.ends_with("\r\n\r\n<p>home</p>"));
+  REQUIRE(response.head.empty());
+  REQUIRE(response.length == 0);
+
+  auto head = Request(server, "HEAD", "/index.html");
+  REQUIRE(head.status == 200);
+  REQUIRE(head.file == nullptr);
+  const auto headReceived = SendAndReceive(head);
+  REQUIRE(headReceived.find("Content-Length: 11\r\n") != std::string::npos);
+  REQUIRE(headReceived.ends_with("\r\n\r\n"));
+}
+
+TEST_CASE("File server rejects what it cannot serve", "FileServer")
+{
+  const TemporaryDirectory root;
+  root.Write("a.txt", "a");
+  StaticFiles::FileServer server(root.path.string());
+
+  REQUIRE(Request(server, "GET", "/missing.txt").status == 404);
+  REQUIRE(Request(server, "GET", "/a.txt/").status == 404);
+  const auto post = Request(server, "POST", "/a.txt");
+  REQUIRE(post.status == 405);
+  REQUIRE(post.head.find("Allow: GET, HEAD\r\n") != std::string::npos);
+}
+
+TEST_CASE("File server answers conditional requests", "FileServer")
+{
+  const TemporaryDirectory root;
+  root.Write("a.txt", "content");
+  StaticFiles::FileServer server(root.path.string());
+
+  const auto etag = server.Cache().Open("a.txt")->etag;
+  const auto lastModified = server.Cache().Open("a.txt")->lastModified;
+
+  REQUIRE(Request(server, "GET", "/a.txt", "If-None-Match: " + etag + "\r\n").status == 304);
+  REQUIRE(Request(server, "GET", "/a.txt", "If-None-Match: \"x\", W/" + etag + "\r\n").status
+          == 304);
+  REQUIRE(Request(server, "GET", "/a.txt", "If-None-Match: *\r\n").status == 304);
+  REQUIRE(Request(server, "GET", "/a.txt", "If-None-Match: \"x\"\r\n").status == 200);
+
+  REQUIRE(
+    Request(server, "GET", "/a.txt", "If-Modified-Since: " + lastModified + "\r\n").status == 304);
+  REQUIRE(
+    Request(server, "GET", "/a.txt", "If-Modified-Since: Sun, 06 Nov 1994 08:49:37 GMT\r\n").status
+    == 200);
+  REQUIRE(Request(server, "GET", "/a.txt", "If-Modified-Since: yesterday\r\n").status == 200);
+
+  // If-None-Match takes precedence over If-Modified-Since
+  REQUIRE(Request(server,
+            "GET",
+            "/a.txt",
+            "If-None-Match: \"x\"\r\nIf-Modified-Since: " + lastModified + "\r\n")
+            .status
+          == 200);
+
+  const auto notModified = Request(server, "GET", "/a.txt", "If-None-Match: " + etag + "\r\n");
+  REQUIRE(notModified.file == nullptr);
+  REQUIRE(notModified.head.find("ETag: " + etag + "\r\n") != std::string::npos);
+}
+
+TEST_CASE("File server answers range requests", "FileServer")
+{
+  const TemporaryDirectory root;
+  root.Write("digits.txt", "0123456789");
+  StaticFiles::FileServer server(root.path.string());
+
+  auto middle = Request(server, "GET", "/digits.txt", "Range: bytes=2-5\r\n");
+  REQUIRE(middle.status == 206);
+  const auto received = SendAndReceive(middle);
+  REQUIRE(received.find("Content-Range: bytes 2-5/10\r\n") != std::string::npos);
+  REQUIRE(received.find("Content-Length: 4\r\n") != std::string::npos);
+  REQUIRE(received.ends_with("\r\n\r\n2345"));
+
+  auto suffix = Request(server, "GET", "/digits.txt", "Range: bytes=-3\r\n");
+  REQUIRE(suffix.status == 206);
+  REQUIRE(SendAndReceive(suffix).ends_with("\r\n\r\n789"));
+
+  auto open = Request(server, "GET", "/digits.txt", "Range: bytes=7-100\r\n");
+  REQUIRE(open.status == 206);
+  REQUIRE(open.head.find("Content-Range: bytes 7-9/10\r\n") != std::string::npos);
+  REQUIRE(SendAndReceive(open).ends_with("\r\n\r\n789"));
+
+  const auto unsatisfiable = Request(server, "GET", "/digits.txt", "Range: bytes=10-\r\n");
+  REQUIRE(unsatisfiable.status == 416);
+  REQUIRE(unsatisfiable.head.find("Content-Range: bytes */10\r\n") != std::string::npos);
+
+  // Ranges that cannot be parsed, several ranges and stale If-Range are
+  // answered with the whole file
+  REQUIRE(Request(server, "GET", "/digits.txt", "Range: bytes=5-2\r\n").status == 200);
+  REQUIRE(Request(server, "GET", "/digits.txt", "Range: bytes=0-1,4-5\r\n").status == 200);
+  REQUIRE(Request(server, "GET", "/digits.txt", "Range: lines=1-2\r\n").status == 200);
+  REQUIRE(
+    Request(server, "GET", "/digits.txt", "Range: bytes=2-5\r\nIf-Range: \"stale\"\r\n").status
+    == 200);
+  const auto etag = server.Cache().Open("digits.txt")->etag;
+  REQUIRE(
+    Request(server, "GET", "/digits.txt", "Range: bytes=2-5\r\nIf-Range: " + etag + "\r\n").status
+    == 206);
+  REQUIRE(Request(server, "HEAD", "/digits.txt", "Range: bytes=2-5\r\n").status == 200);
+}
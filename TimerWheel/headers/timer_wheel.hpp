@@ -0,0 +1,161 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace TimerWheel {
+
+/**
+ * This identifies a timer of a wheel. It stays safe to use after the timer
+ * has fired or been cancelled: the wheel then simply does not find it.
+ */
+struct TimerId
+{
+  uint32_t index = UINT32_MAX;
+  uint32_t generation = 0;
+
+  [[nodiscard]] bool operator==(const TimerId &other) const = default;
+};
+
+/**
+ * This is a hashed hierarchical timing wheel (Varghese and Lauck), meant to
+ * hold the idle, header and body deadlines of every connection of one
+ * reactor thread. Scheduling, cancelling and rescheduling a timer take
+ * constant time no matter how many timers there are, and time only costs
+ * work for the ticks that have timers due.
+ *
+ * Time is counted in ticks of the resolution given at construction. A
+ * timer fires on the first call to Advance at or after the tick of its
+ * deadline, so it is never early and at most one tick plus the time between
+ * calls to Advance late.
+ *
+ * The wheel is not thread safe; each reactor thread owns its own.
+ */
+class TimerWheel
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using Callback = std::function<void()>;
+
+  /** Destructor, copy and move operators */
+  ~TimerWheel();
+  TimerWheel(const TimerWheel &) = delete;
+  TimerWheel(TimerWheel &&) noexcept;
+  TimerWheel &operator=(const TimerWheel &) = delete;
+  TimerWheel &operator=(TimerWheel &&) noexcept;
+
+  /**
+   * This constructs an empty wheel
+   *
+   * @param[in] resolution
+   *    This is the length of one tick
+   *
+   * @param[in] start
+   *    This is the time of tick zero
+   */
+  explicit TimerWheel(Clock::duration resolution = std::chrono::milliseconds(1),
+    Clock::time_point start = Clock::now());
+
+  /**
+   * This method adds a timer
+   *
+   * @param[in] delay
+   *    This is how long from the current tick until the timer fires. It is
+   *    rounded up to whole ticks, and to at least one.
+   *
+   * @param[in] callback
+   *    This is called from Advance when the timer fires. It may schedule,
+   *    cancel and reschedule other timers.
+   *
+   * @return
+   *    The identifier of the timer
+   */
+  TimerId Schedule(Clock::duration delay, Callback callback);
+
+  /**
+   * This method removes a timer before it fires
+   *
+   * @return
+   *    True if the timer was pending, false if it has already fired or been
+   *    cancelled
+   */
+  bool Cancel(TimerId timer);
+
+  /**
+   * This method moves the deadline of a pending timer, keeping its
+   * callback, as is done every time a keep-alive connection sees activity
+   *
+   * @param[in] delay
+   *    This is how long from the current tick until the timer fires
+   *
+   * @return
+   *    True if the timer was pending, false if it has already fired or been
+   *    cancelled
+   */
+  bool Reschedule(TimerId timer, Clock::duration delay);
+
+  /**
+   * This method moves the wheel forward to the given time, calling the
+   * callbacks of every timer that is due, in order of their deadlines
+   *
+   * @param[in] now
+   *    This is the current time
+   *
+   * @return
+   *    The number of timers that fired
+   */
+  size_t Advance(Clock::time_point now);
+
+  /**
+   * This method moves the wheel forward by the given number of ticks
+   *
+   * @return
+   *    The number of timers that fired
+   */
+  size_t AdvanceTicks(uint64_t ticks);
+
+  /**
+   * This method returns how long a reactor may wait before Advance has work
+   * to do, suited to the timeout of epoll_wait. It is exact for timers due
+   * within the next 256 ticks and otherwise an early estimate.
+   *
+   * @param[in] now
+   *    This is the current time
+   *
+   * @return
+   *    The time until the next timer may be due, or Clock::duration::max()
+   *    if there are no timers
+   */
+  [[nodiscard]] Clock::duration TimeUntilNextTimer(Clock::time_point now) const;
+
+  /**
+   * This method returns the number of pending timers
+   */
+  [[nodiscard]] size_t Size() const;
+
+  /**
+   * This method returns the tick the wheel is at
+   */
+  [[nodiscard]] uint64_t CurrentTick() const;
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace TimerWheel
+
+#endif// !TIMER_WHEEL_HPP
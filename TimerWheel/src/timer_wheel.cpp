@@ -0,0 +1,300 @@
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+namespace {
+
+/** These give the shape of the wheel: four levels of 256 slots each */
+constexpr unsigned int SLOT_BITS = 8;
+constexpr size_t SLOTS = size_t{ 1 } << SLOT_BITS;
+constexpr uint64_t SLOT_MASK = SLOTS - 1;
+constexpr size_t LEVELS = 4;
+
+/** This is the furthest a timer can be placed from the current tick */
+constexpr uint64_t MAX_DELTA = (uint64_t{ 1 } << (SLOT_BITS * LEVELS)) - 1;
+
+/** This marks the end of a list and a node that is not in any slot */
+constexpr uint32_t NIL = UINT32_MAX;
+
+constexpr size_t WORD_BITS = 64;
+constexpr size_t WORDS_PER_LEVEL = SLOTS / WORD_BITS;
+
+/**
+ * This is one timer. Timers live in a pool and are linked into the slot
+ * they wait in by index, so that moving one between slots or out of the
+ * wheel touches only its neighbours.
+ */
+struct Node
+{
+  uint64_t expiry = 0;
+  uint32_t previous = NIL;
+  uint32_t next = NIL;
+  uint32_t generation = 0;
+  uint32_t slot = NIL;
+  TimerWheel::TimerWheel::Callback callback;
+};
+
+}// namespace
+
+namespace TimerWheel {
+
+struct TimerWheel::Implementation
+{
+  Clock::duration resolution;
+  Clock::time_point start;
+  uint64_t currentTick = 0;
+  size_t size = 0;
+
+  std::vector<Node> nodes;
+
+  /** This is the first node of the pool that is not in use */
+  uint32_t firstFree = NIL;
+
+  /** These are the first node of every slot, level after level */
+  std::array<uint32_t, LEVELS * SLOTS> slots{};
+
+  /**
+   * These have a bit set for every slot that is not empty, so that idle
+   * ticks can be skipped without visiting their slots
+   */
+  std::array<uint64_t, LEVELS * WORDS_PER_LEVEL> occupied{};
+
+  // Methods
+
+  Implementation(Clock::duration tickResolution, Clock::time_point startTime)
+    : resolution(std::max(tickResolution, Clock::duration{ 1 })), start(startTime)
+  {
+    slots.fill(NIL);
+  }
+
+  /**
+   * This method converts a delay into the number of ticks to wait, rounding
+   * up so that no timer fires early
+   */
+  [[nodiscard]] uint64_t TicksOf(Clock::duration delay) const
+  {
+    if (delay <= Clock::duration::zero()) { return 1; }
+    const auto whole = delay / resolution;
+    const auto ticks = whole + (delay % resolution == Clock::duration::zero() ? 0 : 1);
+    return std::max(static_cast<uint64_t>(ticks), uint64_t{ 1 });
+  }
+
+  /**
+   * This method checks if the identifier names a pending timer
+   */
+  [[nodiscard]] bool IsPending(TimerId timer) const
+  {
+    return timer.index < nodes.size() && nodes[timer.index].generation == timer.generation
+           && nodes[timer.index].slot != NIL;
+  }
+
+  /**
+   * This method returns the slot a timer waits in: the lowest level whose
+   * span covers the distance to its expiry, at the position of the expiry
+   * within that level
+   */
+  [[nodiscard]] uint32_t SlotOf(uint64_t expiry) const
+  {
+    const auto delta = std::min(expiry - currentTick, MAX_DELTA);
+    const auto placed = currentTick + delta;
+    size_t level = 0;
+    while (level + 1 < LEVELS && delta >= (uint64_t{ 1 } << (SLOT_BITS * (level + 1)))) {
+      ++level;
+    }
+    const auto position = (placed >> (SLOT_BITS * level)) & SLOT_MASK;
+    return static_cast<uint32_t>(level * SLOTS + position);
+  }
+
+  void Link(uint32_t index)
+  {
+    auto &node = nodes[index];
+    const auto slot = SlotOf(node.expiry);
+    node.slot = slot;
+    node.previous = NIL;
+    node.next = slots[slot];
+    if (node.next != NIL) { nodes[node.next].previous = index; }
+    slots[slot] = index;
+    occupied[slot / WORD_BITS] |= uint64_t{ 1 } << (slot % WORD_BITS);
+  }
+
+  void Unlink(uint32_t index)
+  {
+    auto &node = nodes[index];
+    if (node.previous != NIL) {
+      nodes[node.previous].next = node.next;
+    } else {
+      slots[node.slot] = node.next;
+    }
+    if (node.next != NIL) { nodes[node.next].previous = node.previous; }
+    if (slots[node.slot] == NIL) {
+      occupied[node.slot / WORD_BITS] &= ~(uint64_t{ 1 } << (node.slot % WORD_BITS));
+    }
+    node.slot = NIL;
+  }
+
+  uint32_t Acquire()
+  {
+    if (firstFree != NIL) {
+      const auto index = firstFree;
+      firstFree = nodes[index].next;
+      return index;
+    }
+    nodes.emplace_back();
+    return static_cast<uint32_t>(nodes.size() - 1);
+  }
+
+  /**
+   * This method returns a node that is no longer in any slot to the pool,
+   * making every identifier of it stale
+   */
+  void Release(uint32_t index)
+  {
+    auto &node = nodes[index];
+    node.callback = nullptr;
+    ++node.generation;
+    node.next = firstFree;
+    firstFree = index;
+    --size;
+  }
+
+  /**
+   * This method returns the first slot of the level at or after the given
+   * position that has timers, or SLOTS if there is none
+   */
+  [[nodiscard]] uint64_t NextOccupied(size_t level, uint64_t position) const
+  {
+    while (position < SLOTS) {
+      const auto word = occupied[level * WORDS_PER_LEVEL + position / WORD_BITS]
+                        >> (position % WORD_BITS);
+      if (word != 0) { return position + static_cast<unsigned int>(std::countr_zero(word)); }
+      position = (position / WORD_BITS + 1) * WORD_BITS;
+    }
+    return SLOTS;
+  }
+
+  /**
+   * This method moves the timers of the slots of the upper levels whose
+   * turn has come down to the levels below. It is called every time the
+   * lowest level wraps around.
+   */
+  void Cascade()
+  {
+    for (size_t level = 1; level < LEVELS; ++level) {
+      const auto position = (currentTick >> (SLOT_BITS * level)) & SLOT_MASK;
+      const auto slot = level * SLOTS + position;
+      while (slots[slot] != NIL) {
+        const auto index = slots[slot];
+        Unlink(index);
+        Link(index);
+      }
+      if (position != 0) { break; }
+    }
+  }
+
+  /**
+   * This method fires every timer of the current tick
+   */
+  size_t Expire()
+  {
+    size_t fired = 0;
+    const auto slot = currentTick & SLOT_MASK;
+    while (slots[slot] != NIL) {
+      const auto index = slots[slot];
+      Unlink(index);
+      auto callback = std::move(nodes[index].callback);
+      Release(index);
+      ++fired;
+      if (callback) { callback(); }
+    }
+    return fired;
+  }
+
+  size_t AdvanceTicks(uint64_t ticks)
+  {
+    size_t fired = 0;
+    while (ticks > 0) {
+      // Jump straight to the next tick with something to do: a slot of the
+      // lowest level with timers, or the wrap around that cascades
+      const auto position = currentTick & SLOT_MASK;
+      const auto gap = NextOccupied(0, position + 1) - position;
+      if (gap > ticks) {
+        currentTick += ticks;
+        break;
+      }
+      currentTick += gap;
+      ticks -= gap;
+      if ((currentTick & SLOT_MASK) == 0) { Cascade(); }
+      fired += Expire();
+    }
+    return fired;
+  }
+};
+
+TimerWheel::~TimerWheel() = default;
+
+TimerWheel::TimerWheel(TimerWheel &&) noexcept = default;
+
+TimerWheel &TimerWheel::operator=(TimerWheel &&) noexcept = default;
+
+TimerWheel::TimerWheel(Clock::duration resolution, Clock::time_point start)
+  : impl_(new Implementation(resolution, start))
+{}
+
+TimerId TimerWheel::Schedule(Clock::duration delay, Callback callback)
+{
+  const auto index = impl_->Acquire();
+  auto &node = impl_->nodes[index];
+  node.expiry = impl_->currentTick + impl_->TicksOf(delay);
+  node.callback = std::move(callback);
+  impl_->Link(index);
+  ++impl_->size;
+  return { index, node.generation };
+}
+
+bool TimerWheel::Cancel(TimerId timer)
+{
+  if (!impl_->IsPending(timer)) { return false; }
+  impl_->Unlink(timer.index);
+  impl_->Release(timer.index);
+  return true;
+}
+
+bool TimerWheel::Reschedule(TimerId timer, Clock::duration delay)
+{
+  if (!impl_->IsPending(timer)) { return false; }
+  impl_->Unlink(timer.index);
+  impl_->nodes[timer.index].expiry = impl_->currentTick + impl_->TicksOf(delay);
+  impl_->Link(timer.index);
+  return true;
+}
+
+size_t TimerWheel::Advance(Clock::time_point now)
+{
+  if (now < impl_->start) { return 0; }
+  const auto target = static_cast<uint64_t>((now - impl_->start) / impl_->resolution);
+  if (target <= impl_->currentTick) { return 0; }
+  return impl_->AdvanceTicks(target - impl_->currentTick);
+}
+
+size_t TimerWheel::AdvanceTicks(uint64_t ticks) { return impl_->AdvanceTicks(ticks); }
+
+TimerWheel::Clock::duration TimerWheel::TimeUntilNextTimer(Clock::time_point now) const
+{
+  if (impl_->size == 0) { return Clock::duration::max(); }
+
+  // Past the lowest level nothing can be due before it wraps around
+  const auto position = impl_->currentTick & SLOT_MASK;
+  const auto gap = impl_->NextOccupied(0, position + 1) - position;
+  const auto due = impl_->start
+                   + impl_->resolution * static_cast<Clock::rep>(impl_->currentTick + gap);
+  return std::max(due - now, Clock::duration::zero());
+}
+
+size_t TimerWheel::Size() const { return impl_->size; }
+
+uint64_t TimerWheel::CurrentTick() const { return impl_->currentTick; }
+
+}// namespace TimerWheel
@@ -0,0 +1,186 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "../headers/timer_wheel.hpp"
+#include <catch2/catch.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Timer wheel fires timers on their tick", "TimerWheel")
+{
+  TimerWheel::TimerWheel wheel(1ms, {});
+  std::vector<uint64_t> fired;
+  wheel.Schedule(3ms, [&] { fired.push_back(wheel.CurrentTick()); });
+  wheel.Schedule(1ms, [&] { fired.push_back(wheel.CurrentTick()); });
+  wheel.Schedule(2500us, [&] { fired.push_back(wheel.CurrentTick()); });
+  REQUIRE(wheel.Size() == 3);
+
+  REQUIRE(wheel.AdvanceTicks(1) == 1);
+  REQUIRE(fired == std::vector<uint64_t>{ 1 });
+  REQUIRE(wheel.AdvanceTicks(1) == 0);
+  REQUIRE(wheel.AdvanceTicks(5) == 2);
+  REQUIRE(fired == std::vector<uint64_t>{ 1, 3, 3 });
+  REQUIRE(wheel.Size() == 0);
+}
+
+TEST_CASE("Timer wheel rounds delays up to at least one tick", "TimerWheel")
+{
+  TimerWheel::TimerWheel wheel(10ms, {});
+  size_t fired = 0;
+  wheel.Schedule(0ms, [&] { ++fired; });
+  wheel.Schedule(-5ms, [&] { ++fired; });
+  wheel.Schedule(11ms, [&] { ++fired; });
+
+  REQUIRE(wheel.AdvanceTicks(1) == 2);
+  REQUIRE(wheel.AdvanceTicks(1) == 1);
+  REQUIRE(fired == 3);
+}
+
+TEST_CASE("Timer wheel cancels and reschedules timers", "TimerWheel")
+{
+  TimerWheel::TimerWheel wheel(1ms, {});
+  size_t fired = 0;
+  const auto cancelled = wheel.Schedule(10ms, [&] { ++fired; });
+  const auto moved = wheel.Schedule(10ms, [&] { ++fired; });
+
+  REQUIRE(wheel.Cancel(cancelled));
+  REQUIRE_FALSE(wheel.Cancel(cancelled));
+  REQUIRE_FALSE(wheel.Reschedule(cancelled, 1ms));
+  REQUIRE(wheel.Size() == 1);
+
+  REQUIRE(wheel.Reschedule(moved, 1000ms));
+  REQUIRE(wheel.AdvanceTicks(999) == 0);
+  REQUIRE(wheel.AdvanceTicks(1) == 1);
+  REQUIRE(fired == 1);
+
+  // An identifier stays stale after its node is reused by a new timer
+  REQUIRE_FALSE(wheel.Cancel(moved));
+  const auto reused = wheel.Schedule(1ms, [] {});
+  REQUIRE(reused.index == moved.index);
+  REQUIRE_FALSE(wheel.Cancel(moved));
+  REQUIRE(wheel.Cancel(reused));
+}
+
+TEST_CASE("Timer wheel fires timers of every level exactly on time", "TimerWheel")
+{
+  TimerWheel::TimerWheel wheel(1ms, {});
+  std::mt19937_64 generator(42);
+  std::vector<std::pair<uint64_t, uint64_t>> expectedAndActual;
+  expectedAndActual.reserve(2000);
+
+  // Start off a level boundary so that placing timers has to account for it
+  wheel.AdvanceTicks(300);
+  for (size_t timer = 0; timer < 2000; ++timer) {
+    const auto shift = std::uniform_int_distribution<unsigned int>(0, 24)(generator);
+    const auto delay =
+      std::uniform_int_distribution<uint64_t>(1, uint64_t{ 1 } << shift)(generator);
+    const auto slot = expectedAndActual.size();
+    expectedAndActual.emplace_back(wheel.CurrentTick() + delay, 0);
+    wheel.Schedule(std::chrono::milliseconds(delay),
+      [&, slot] { expectedAndActual[slot].second = wheel.CurrentTick(); });
+  }
+
+  size_t fired = 0;
+  while (wheel.Size() > 0) { fired += wheel.AdvanceTicks(uint64_t{ 1 } << 20); }
+  REQUIRE(fired == 2000);
+  for (const auto &[expected, actual] : expectedAndActual) { REQUIRE(actual == expected); }
+}
+
+TEST_CASE("Timer wheel callbacks may change the wheel", "TimerWheel")
+{
+  TimerWheel::TimerWheel wheel(1ms, {});
+  std::vector<int> fired;
+  TimerWheel::TimerId victim;
+  wheel.Schedule(5ms, [&] {
+    fired.push_back(1);
+    REQUIRE(wheel.Cancel(victim));
+    wheel.Schedule(1ms, [&] { fired.push_back(3); });
+  });
+  victim = wheel.Schedule(6ms, [&] { fired.push_back(2); });
+
+  REQUIRE(wheel.AdvanceTicks(5) == 1);
+  REQUIRE(wheel.Size() == 1);
+  REQUIRE(wheel.AdvanceTicks(1) == 1);
+  REQUIRE(fired == std::vector<int>{ 1, 3 });
+}
+
+TEST_CASE("Timer wheel follows the clock", "TimerWheel")
+{
+  const TimerWheel::TimerWheel::Clock::time_point start{};
+  TimerWheel::TimerWheel wheel(10ms, start);
+  REQUIRE(wheel.TimeUntilNextTimer(start) == TimerWheel::TimerWheel::Clock::duration::max());
+
+  size_t fired = 0;
+  wheel.Schedule(30ms, [&] { ++fired; });
+  REQUIRE(wheel.TimeUntilNextTimer(start + 5ms) == 25ms);
+
+  REQUIRE(wheel.Advance(start + 29ms) == 0);
+  REQUIRE(wheel.CurrentTick() == 2);
+  REQUIRE(wheel.TimeUntilNextTimer(start + 29ms) == 1ms);
+  REQUIRE(wheel.Advance(start + 30ms) == 1);
+  REQUIRE(fired == 1);
+
+  // Time going backwards is ignored
+  REQUIRE(wheel.Advance(start) == 0);
+  REQUIRE(wheel.CurrentTick() == 3);
+
+  // Far timers give an early estimate, never a late one
+  wheel.Schedule(10s, [] {});
+  const auto estimate = wheel.TimeUntilNextTimer(start + 30ms);
+  REQUIRE(estimate > 0ms);
+  REQUIRE(estimate <= 10s);
+}
+
+TEST_CASE("Timer wheel benchmark", "[.benchmark]")
+{
+  constexpr size_t TIMERS = 1'000'000;
+  std::mt19937_64 generator(7);
+  std::uniform_int_distribution<int64_t> delays(1'000, 120'000);
+  std::vector<std::chrono::milliseconds> schedule;
+  schedule.reserve(TIMERS);
+  for (size_t timer = 0; timer < TIMERS; ++timer) { schedule.emplace_back(delays(generator)); }
+
+  BENCHMARK_ADVANCED("schedule 1M timers")(Catch::Benchmark::Chronometer meter)
+  {
+    TimerWheel::TimerWheel wheel(1ms, {});
+    meter.measure([&] {
+      for (const auto delay : schedule) { wheel.Schedule(delay, [] {}); }
+      return wheel.Size();
+    });
+  };
+
+  BENCHMARK_ADVANCED("reschedule 1M timers")(Catch::Benchmark::Chronometer meter)
+  {
+    TimerWheel::TimerWheel wheel(1ms, {});
+    std::vector<TimerWheel::TimerId> timers;
+    timers.reserve(TIMERS);
+    for (const auto delay : schedule) { timers.push_back(wheel.Schedule(delay, [] {})); }
+    meter.measure([&] {
+      for (size_t timer = 0; timer < TIMERS; ++timer) {
+        wheel.Reschedule(timers[timer], schedule[TIMERS - 1 - timer]);
+      }
+      return wheel.Size();
+    });
+  };
+
+  BENCHMARK_ADVANCED("cancel 1M timers")(Catch::Benchmark::Chronometer meter)
+  {
+    TimerWheel::TimerWheel wheel(1ms, {});
+    std::vector<TimerWheel::TimerId> timers;
+    timers.reserve(TIMERS);
+    for (const auto delay : schedule) { timers.push_back(wheel.Schedule(delay, [] {})); }
+    meter.measure([&] {
+      for (const auto timer : timers) { wheel.Cancel(timer); }
+      return wheel.Size();
+    });
+  };
+
+  BENCHMARK_ADVANCED("expire 1M timers")(Catch::Benchmark::Chronometer meter)
+  {
+    TimerWheel::TimerWheel wheel(1ms, {});
+    size_t fired = 0;
+    for (const auto delay : schedule) { wheel.Schedule(delay, [&fired] { ++fired; }); }
+    meter.measure([&] { return wheel.AdvanceTicks(120'000); });
+  };
+}
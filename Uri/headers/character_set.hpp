@@ -0,0 +1,110 @@
+#ifndef URI_CHARACTER_IN_SET
+#define URI_CHARACTER_IN_SET
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+namespace Uri {
+
+/*
+ * This is a set of characters, stored as a 256-bit map so that it can be
+ * built at compile time and looking a character up is a shift and a mask
+ */
+class CharacterSet
+{
+public:
+  constexpr CharacterSet() = default;
+
+  /*
+   * This construcs a character set that contains only the character given
+   *
+   * @param[in] character
+   * This is the only character to put int the set
+   *
+   */
+  // cppcheck-suppress noExplicitConstructor
+  constexpr CharacterSet(char character) { Insert(character); }// NOLINT
+
+  /*
+   * This construcs a character set that contains all the characters
+   * betweem the given "first" and "last" characters inclusive
+   *
+   * @param[in] first
+   * This is the first of the range of the characters to put in the set;
+   *
+   * @param[in] last
+   * This is the last of the range of the characters to put in the set;
+   */
+  constexpr CharacterSet(char first, char last)
+  {
+    auto first_value = static_cast<unsigned char>(first);
+    auto last_value = static_cast<unsigned char>(last);
+    if (first_value > last_value) { std::swap(first_value, last_value); }
+    for (unsigned int value = first_value; value <= last_value; ++value) {
+      Insert(static_cast<char>(value));
+    }
+  }
+
+  /*
+   * This construcs a character set with all the sets given
+   *
+   * @param[in] character_sets
+   * This is the list of character sets to merge
+   */
+  // cppcheck-suppress noExplicitConstructor
+  constexpr CharacterSet(std::initializer_list<const CharacterSet> character_sets)// NOLINT
+  {
+    for (const auto &set : character_sets) {
+      for (std::size_t word = 0; word < bits_.size(); ++word) { bits_[word] |= set.bits_[word]; }
+    }
+  }
+
+  /*
+   * This checks if the character is in the set
+   *
+   * @param[in] character
+   * This is the character to look up
+   *
+   * @return
+   * An indication of whether or not the character is in the set
+   */
+  [[nodiscard]] constexpr bool Contains(char character) const
+  {
+    const auto value = static_cast<unsigned char>(character);
+    return ((bits_[value / WORD_BITS] >> (value % WORD_BITS)) & 1U) != 0;
+  }
+
+private:
+  static constexpr unsigned int WORD_BITS = 64;
+
+  constexpr void Insert(char character)
+  {
+    const auto value = static_cast<unsigned char>(character);
+    bits_[value / WORD_BITS] |= uint64_t{ 1 } << (value % WORD_BITS);
+  }
+
+  std::array<uint64_t, 4> bits_{};
+};
+
+inline constexpr CharacterSet DIGITS{ CharacterSet('0', '9') };
+inline constexpr CharacterSet ALPHA{ CharacterSet('A', 'Z'), CharacterSet('a', 'z') };
+inline constexpr CharacterSet HEX_DIGIT{ CharacterSet('A', 'F'),
+  CharacterSet('a', 'f'),
+  CharacterSet('0', '9') };
+inline constexpr CharacterSet UNRESERVED{ ALPHA, DIGITS, '-', '.', '_', '~' };
+inline constexpr CharacterSet SUB_DELIMS =
+  CharacterSet{ '!', '$', '&', '\'', '(', ')', '*', '+', ',', ';', '=' };
+inline constexpr CharacterSet SCHEME_NOT_FIRST{ ALPHA, DIGITS, '+', '-', '.' };
+inline constexpr CharacterSet PCHAR_NOT_PCT_ENCODED{ UNRESERVED, SUB_DELIMS, ':', '@' };
+inline constexpr CharacterSet SEGMENT_NZ_NC{ UNRESERVED, SUB_DELIMS, '@' };
+inline constexpr CharacterSet REG_NAME_NOT_PCT_ENCODED{ UNRESERVED, SUB_DELIMS };
+inline constexpr CharacterSet USER_NAME{ UNRESERVED, SUB_DELIMS, ':' };
+inline constexpr CharacterSet IPVFUTURE_LAST{ UNRESERVED, SUB_DELIMS, ':', ']' };
+inline constexpr CharacterSet QUERY_OR_FRAGMENT{ PCHAR_NOT_PCT_ENCODED, ':', '?', '/' };
+
+}// namespace Uri
+
+#endif// !URI_IS_CHARACTER_IN_SET
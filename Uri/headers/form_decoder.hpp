@@ -0,0 +1,95 @@
+#ifndef URI_FORM_DECODER_HPP
+#define URI_FORM_DECODER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace Uri {
+
+/** These are the reasons why a form body can not be decoded */
+enum class FormError : uint8_t {
+  none,
+  invalid_character,
+  field_too_long,
+  aborted,
+};
+
+/**
+ * This decodes an application/x-www-form-urlencoded body, such as that of a
+ * form POST, as it arrives, in chunks of any size. Fields are separated by
+ * "&", names from values by the first "=", and both are percent-decoded
+ * like the query of a URI, with "+" standing for a space. Empty fields are
+ * skipped.
+ *
+ * The body is never gathered in one string: a field is given to the
+ * callback straight from the chunk it is in when it needs no decoding, and
+ * otherwise from buffers holding that field only. Only a field cut by the
+ * end of a chunk is kept until the next one.
+ */
+class FormDecoder
+{
+public:
+  /**
+   * This is called with the decoded name and value of each field. The views
+   * are valid until it returns. It may return false to stop decoding.
+   */
+  using FieldCallback = std::function<bool(std::string_view name, std::string_view value)>;
+
+  /** This is how long a field may be by default, before it is decoded */
+  static constexpr size_t DEFAULT_MAX_FIELD_SIZE = 65536;
+
+  /** Destructor, copy and move operators */
+  ~FormDecoder();
+  FormDecoder(const FormDecoder &) = delete;
+  FormDecoder(FormDecoder &&) noexcept;
+  FormDecoder &operator=(const FormDecoder &) = delete;
+  FormDecoder &operator=(FormDecoder &&) noexcept;
+
+  /**
+   * This constructs a decoder
+   *
+   * @param[in] on_field
+   *    This is called with each field
+   *
+   * @param[in] max_field_size
+   *    This is how long one field may be, before it is decoded
+   */
+  explicit FormDecoder(FieldCallback on_field, size_t max_field_size = DEFAULT_MAX_FIELD_SIZE);
+
+  /**
+   * This method decodes the next chunk of the body
+   *
+   * @return
+   *    FormError::none, or the reason the body can not be decoded, after
+   *    which the decoder takes no more chunks
+   */
+  FormError Feed(std::string_view chunk);
+
+  /**
+   * This method is called once the whole body has been fed, to decode the
+   * field at its end
+   *
+   * @return
+   *    FormError::none, or the reason the body can not be decoded
+   */
+  FormError Finish();
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace Uri
+
+#endif// !URI_FORM_DECODER_HPP
@@ -0,0 +1,111 @@
+#ifndef URI_IDNA_HPP
+#define URI_IDNA_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Uri {
+
+/** These are the reasons why a domain name can not be converted */
+enum class IdnaError : uint8_t {
+  none,
+  invalid_utf8,
+  prohibited_character,
+  invalid_punycode,
+  empty_label,
+  label_too_long,
+  domain_too_long,
+};
+
+/**
+ * This function returns a short description of the error, such as
+ * "empty label", to be used in logs and error responses
+ */
+[[nodiscard]] std::string_view ToString(IdnaError error);
+
+/**
+ * This function encodes code points with Punycode (RFC 3492), the way the
+ * labels of internationalized domain names are written in ASCII. Basic code
+ * points are copied as they are and the others are encoded with lower case
+ * letters and digits.
+ *
+ * @param[in] code_points
+ *    These are the code points to encode
+ *
+ * @param[out] encoded
+ *    This is where the encoding is appended
+ *
+ * @return
+ *    An indication of whether or not the code points could be encoded,
+ *    which only fails if they are too many
+ */
+bool PunycodeEncode(std::u32string_view code_points, std::string &encoded);
+
+/**
+ * This function decodes Punycode (RFC 3492)
+ *
+ * @param[in] encoded
+ *    This is the encoding, without an "xn--" prefix
+ *
+ * @param[out] code_points
+ *    This is where the code points are written, reusing its memory
+ *
+ * @return
+ *    An indication of whether or not the encoding is valid and decodes to
+ *    code points that are not surrogates
+ */
+bool PunycodeDecode(std::string_view encoded, std::u32string &code_points);
+
+/**
+ * This function converts a domain name in UTF-8 to the ASCII form used by
+ * DNS, following the ToASCII operation of UTS #46 with nontransitional
+ * processing, as the URL Standard does:
+ *
+ *  - characters are mapped with the IDNA mapping table of UTS #46, which
+ *    folds case and compatibility forms (NFKC_Casefold), maps the full stops
+ *    of other scripts to "." and rejects those that are disallowed; the
+ *    sharp s, final sigma and zero width joiners are kept
+ *  - the name is put in normalization form C, so composed and decomposed
+ *    letters give the same name
+ *  - a label may not start with a combining mark, every code point of it
+ *    must be valid, ASCII ones must be allowed in a host of RFC 3986 and the
+ *    zero width joiners must be where RFC 5892 allows them, after a virama
+ *    or between joining letters
+ *  - every label that is not ASCII is written "xn--" and its Punycode, and
+ *    an ASCII label starting with "xn--" must decode to a valid label
+ *
+ * The tables are compiled in, so nothing is loaded at startup. The
+ * bidirectional rules are not applied. A domain that is all ASCII is only
+ * lowered.
+ *
+ * @param[in] domain
+ *    This is the domain name to convert, which may end with a "."
+ *
+ * @param[out] ascii
+ *    This is where the ASCII form is written, reusing its memory
+ *
+ * @return
+ *    IdnaError::none, or the reason the domain can not be converted
+ */
+IdnaError DomainToAscii(std::string_view domain, std::string &ascii);
+
+/**
+ * This function converts a domain name in ASCII form back to UTF-8,
+ * decoding every label that starts with "xn--", following the ToUnicode
+ * operation of IDNA (RFC 3490). Other labels are copied as they are.
+ *
+ * @param[in] domain
+ *    This is the domain name to convert
+ *
+ * @param[out] unicode
+ *    This is where the domain name is written in UTF-8, reusing its memory
+ *
+ * @return
+ *    IdnaError::none, or the reason the domain can not be converted
+ */
+IdnaError DomainToUnicode(std::string_view domain, std::string &unicode);
+
+}// namespace Uri
+
+#endif// !URI_IDNA_HPP
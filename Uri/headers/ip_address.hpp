@@ -0,0 +1,185 @@
+#ifndef URI_IP_ADDRESS_HPP
+#define URI_IP_ADDRESS_HPP
+
+#include <array>
+#include <cstdint>
+#include <netinet/in.h>
+#include <string_view>
+
+namespace Uri {
+
+/* This function returns the value of the given hexadecimal digit, or a
+ * value above 15 if the character is not one
+ */
+constexpr unsigned int HexDigitValue(char character)
+{
+  const auto value = static_cast<unsigned int>(static_cast<unsigned char>(character));
+  if (value - '0' < 10) { return value - '0'; }
+  // Setting bit 5 folds upper case letters onto lower case ones
+  const auto lower = value | 0x20U;
+  if (lower - 'a' < 6) { return lower - 'a' + 10; }
+  return 16;
+}
+
+/* This function parses a dotted-decimal IPv4 address (the "IPv4address"
+ * rule of RFC 3986) into four octets, in the order they are written. It is
+ * constexpr so that the hosts of URI literals are checked when the program
+ * is built.
+ *
+ * @param[in] address
+ *  This is the text of the address, without anything around it
+ *
+ * @param[out] octets
+ *  This is where the octets are stored
+ *
+ * @return
+ *  An indication of whether or not the text is a valid IPv4 address
+ */
+constexpr bool ParseIpv4Octets(std::string_view address, std::array<uint8_t, 4> &octets)
+{
+  constexpr unsigned int MAX_OCTET = 255;
+  size_t position = 0;
+
+  for (size_t octet_index = 0; octet_index < octets.size(); ++octet_index) {
+    if (octet_index > 0) {
+      if (position >= address.size() || address[position] != '.') { return false; }
+      ++position;
+    }
+
+    unsigned int octet = 0;
+    size_t digits = 0;
+    while (position < address.size()) {
+      const auto digit =
+        static_cast<unsigned int>(static_cast<unsigned char>(address[position])) - '0';
+      if (digit > 9) { break; }
+      // dec-octet does not allow leading zeros
+      if (digits == 1 && octet == 0) { return false; }
+      octet = octet * 10 + digit;
+      if (++digits > 3 || octet > MAX_OCTET) { return false; }
+      ++position;
+    }
+    if (digits == 0) { return false; }
+    octets[octet_index] = static_cast<uint8_t>(octet);
+  }
+
+  return position == address.size();
+}
+
+/* This function parses an IPv6 address (the "IPv6address" rule of RFC 3986,
+ * including "::" compression and a trailing IPv4 address) into sixteen
+ * bytes, in network byte order. It is constexpr for the same reason as
+ * ParseIpv4Octets.
+ *
+ * @param[in] address
+ *  This is the text of the address, without the square brackets
+ *
+ * @param[out] bytes
+ *  This is where the address is stored
+ *
+ * @return
+ *  An indication of whether or not the text is a valid IPv6 address
+ */
+constexpr bool ParseIpv6Bytes(std::string_view address, std::array<uint8_t, 16> &bytes)
+{
+  constexpr size_t IPV6_GROUPS = 8;
+  bytes = {};
+  size_t group_count = 0;
+  size_t compression_at = IPV6_GROUPS + 1;
+  size_t position = 0;
+
+  if (address.substr(0, 2) == "::") {
+    compression_at = 0;
+    position = 2;
+  } else if (!address.empty() && address[0] == ':') {
+    return false;
+  }
+
+  while (position < address.size()) {
+    if (group_count == IPV6_GROUPS) { return false; }
+
+    const auto group_begin = position;
+    unsigned int group = 0;
+    while (position < address.size() && position - group_begin < 4) {
+      const auto digit = HexDigitValue(address[position]);
+      if (digit > 15) { break; }
+      group = (group << 4U) | digit;
+      ++position;
+    }
+    if (position == group_begin) { return false; }
+
+    if (position < address.size() && address[position] == '.') {
+      // The last 32 bits may be written as an IPv4 address
+      if (group_count > IPV6_GROUPS - 2) { return false; }
+      std::array<uint8_t, 4> octets{};
+      if (!ParseIpv4Octets(address.substr(group_begin), octets)) { return false; }
+      for (size_t index = 0; index < octets.size(); ++index) {
+        bytes[group_count * 2 + index] = octets[index];
+      }
+      group_count += 2;
+      position = address.size();
+      break;
+    }
+
+    bytes[group_count * 2] = static_cast<uint8_t>(group >> 8U);
+    bytes[group_count * 2 + 1] = static_cast<uint8_t>(group & 0xFFU);
+    ++group_count;
+
+    if (position == address.size()) { break; }
+    if (address[position] != ':') { return false; }
+    ++position;
+    if (position < address.size() && address[position] == ':') {
+      if (compression_at <= IPV6_GROUPS) { return false; }
+      compression_at = group_count;
+      ++position;
+    } else if (position == address.size()) {
+      // A single colon can not end the address
+      return false;
+    }
+  }
+
+  if (compression_at <= IPV6_GROUPS) {
+    if (group_count == IPV6_GROUPS) { return false; }
+    // Slide the groups after "::" to the end and zero the gap
+    const auto gap_bytes = (IPV6_GROUPS - group_count) * 2;
+    for (auto index = group_count * 2; index-- > compression_at * 2;) {
+      bytes[index + gap_bytes] = bytes[index];
+      bytes[index] = 0;
+    }
+  } else if (group_count != IPV6_GROUPS) {
+    return false;
+  }
+  return true;
+}
+
+/* This function parses a dotted-decimal IPv4 address straight into its
+ * binary form, as ParseIpv4Octets does
+ *
+ * @param[in] address
+ *  This is the text of the address, without anything around it
+ *
+ * @param[out] binary
+ *  This is where the address is stored, in network byte order. It is only
+ *  written if the address is valid.
+ *
+ * @return
+ *  An indication of whether or not the text is a valid IPv4 address
+ */
+bool ParseIpv4Address(std::string_view address, in_addr &binary);
+
+/* This function parses an IPv6 address straight into its binary form, as
+ * ParseIpv6Bytes does
+ *
+ * @param[in] address
+ *  This is the text of the address, without the square brackets
+ *
+ * @param[out] binary
+ *  This is where the address is stored, in network byte order. It is only
+ *  written if the address is valid.
+ *
+ * @return
+ *  An indication of whether or not the text is a valid IPv6 address
+ */
+bool ParseIpv6Address(std::string_view address, in6_addr &binary);
+}// namespace Uri
+
+#endif// !URI_IP_ADDRESS_HPP
@@ -0,0 +1,104 @@
+#ifndef URI_PREPARED_BASE_HPP
+#define URI_PREPARED_BASE_HPP
+
+#include "uri.hpp"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Uri {
+
+/**
+ * This resolves many references against the same base URI, such as the
+ * links of a page, writing each target straight into a string. The pieces
+ * of the base that every target starts with are serialized once, when the
+ * base is prepared, and a reference whose path has no dot segments is
+ * appended to them without making a Uri for the target or normalizing its
+ * path. Other references are resolved with Uri::Resolve.
+ *
+ * Every target is the same string as that of Uri::Resolve followed by
+ * Uri::GenerateString. References given as strings are parsed into the
+ * same Uri every time, so a prepared base is meant to be used by one thread
+ * at a time.
+ */
+class PreparedBase
+{
+public:
+  /** Destructor, copy and move operators */
+  ~PreparedBase();
+  PreparedBase(const PreparedBase &) = delete;
+  PreparedBase(PreparedBase &&) noexcept;
+  PreparedBase &operator=(const PreparedBase &) = delete;
+  PreparedBase &operator=(PreparedBase &&) noexcept;
+
+  /**
+   * This prepares the given base, which is copied and not used afterwards
+   *
+   * @param[in] base
+   *    This is the URI references are resolved against
+   */
+  explicit PreparedBase(const Uri &base);
+
+  /**
+   * This method resolves a parsed reference against the base
+   *
+   * @param[in] reference
+   *    This describes how to get to the target starting at the base
+   *
+   * @param[out] target
+   *    This is where the string of the target is written, reusing its memory
+   */
+  void Resolve(const Uri &reference, std::string &target) const;
+
+  /**
+   * This method parses a reference and resolves it against the base
+   *
+   * @param[in] reference
+   *    This describes how to get to the target starting at the base
+   *
+   * @param[out] target
+   *    This is where the string of the target is written, reusing its
+   *    memory; it is left empty if the reference is not valid
+   *
+   * @return
+   *    An indication of whether or not the reference is valid
+   */
+  bool Resolve(std::string_view reference, std::string &target);
+
+  /**
+   * This method resolves every reference of a batch against the base
+   *
+   * @param[in] references
+   *    These are the references to resolve
+   *
+   * @param[out] targets
+   *    This is resized to the batch size and gets the target of each
+   *    reference at its position, or an empty string for a reference that
+   *    is not valid. The strings are reused between calls.
+   *
+   * @return
+   *    The number of references that were resolved
+   */
+  size_t ResolveBatch(std::span<const std::string_view> references,
+    std::vector<std::string> &targets);
+
+private:
+  /**
+   * This is the type of structure that contains the private properties of the
+   * instance. It is defined in the implmentation and declared here to
+   * ensure that it is scoped inside the class.
+   */
+  struct Implementation;
+
+  /**
+   * This constains the private properties of the instance
+   */
+  std::unique_ptr<Implementation> impl_;
+};
+
+}// namespace Uri
+
+#endif// !URI_PREPARED_BASE_HPP
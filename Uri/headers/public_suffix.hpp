@@ -0,0 +1,47 @@
+#ifndef URI_PUBLIC_SUFFIX_HPP
+#define URI_PUBLIC_SUFFIX_HPP
+
+#include <string_view>
+
+namespace Uri {
+
+/**
+ * This function finds the public suffix of a host, the part under which
+ * anyone may register names, such as "com" or "co.uk", following the rules
+ * of the Public Suffix List (https://publicsuffix.org/), including the
+ * wildcard and exception rules. A host that no rule matches has its last
+ * label as its public suffix.
+ *
+ * The list is compiled in as a graph of about 50 KB, walked from the end of
+ * the host, so nothing is allocated or loaded at startup. Letters are
+ * compared ignoring case and a trailing "." is ignored. Hosts are expected
+ * in their ASCII form, as Uri::NormalizeHost leaves them, since the names of
+ * the list are written with "xn--".
+ *
+ * @param[in] host
+ *    This is the host, such as the one given by Uri::GetHost
+ *
+ * @return
+ *    The public suffix, which is a view of the end of the host, or an empty
+ *    view if the host is empty or an IP address
+ */
+[[nodiscard]] std::string_view GetPublicSuffix(std::string_view host);
+
+/**
+ * This function finds the registrable domain of a host, its public suffix
+ * and the label before it, such as "example.co.uk" for "www.example.co.uk".
+ * This is the part of the host used to scope cookies and to group the hosts
+ * that belong to the same site.
+ *
+ * @param[in] host
+ *    This is the host, such as the one given by Uri::GetHost
+ *
+ * @return
+ *    The registrable domain, which is a view of the end of the host, or an
+ *    empty view if the host is a public suffix itself, empty or an IP address
+ */
+[[nodiscard]] std::string_view GetRegistrableDomain(std::string_view host);
+
+}// namespace Uri
+
+#endif// !URI_PUBLIC_SUFFIX_HPP
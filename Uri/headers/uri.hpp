@@ -1,15 +1,76 @@
 #ifndef URI_HPP
 #define URI_HPP
 
+#include "idna.hpp"
+
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <netinet/in.h>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <sys/types.h>
 #include <vector>
 
 namespace Uri {
 
+/** These are the schemes that are recognized when a URI is parsed */
+enum class KnownScheme {
+  unknown,
+  http,
+  https,
+  ws,
+  wss,
+  ftp,
+  file,
+};
+
+/** This is the kind of host a URI has, following the "host" rule of RFC 3986 */
+enum class HostKind {
+  reg_name,
+  ipv4,
+  ipv6,
+  ipv_future,
+};
+
+/** These are the reasons why a string is not a valid URI */
+enum class ParseError : uint8_t {
+  none,
+  invalid_scheme,
+  invalid_user_info,
+  invalid_host,
+  invalid_port,
+  invalid_path,
+  invalid_query,
+  invalid_fragment,
+  invalid_utf8,
+};
+
+/**
+ * This is the outcome of parsing a URI. It converts to true when the string
+ * was valid; otherwise it tells what was wrong and the byte of the string
+ * where the problem was found.
+ */
+struct ParseResult
+{
+  ParseError error = ParseError::none;
+  size_t offset = 0;
+
+  [[nodiscard]] constexpr explicit operator bool() const noexcept
+  {
+    return error == ParseError::none;
+  }
+
+  [[nodiscard]] constexpr bool operator==(const ParseResult &other) const noexcept = default;
+};
+
+/**
+ * This function returns a short description of the error, such as
+ * "invalid port", to be used in logs and error responses
+ */
+[[nodiscard]] std::string_view ToString(ParseError error);
+
 class Uri
 {
 public:
@@ -21,6 +82,11 @@ public:
 
   Uri();
 
+  /*
+   * These operators compare the canonical forms of the URIs, as described in
+   * RFC 3986 section 6: case of the scheme and host, percent-encoding, dot
+   * segments and default ports are not taken into account
+   * */
   bool operator==(const Uri &other) const;
   bool operator!=(const Uri &other) const;
 
@@ -32,9 +98,41 @@ public:
    * std::string uri_string
    *
    * @output
-   * bool if it fails or not
+   * ParseResult true if the string is a valid URI, otherwise the reason
+   * why it is not and the offset in the string where it was found
+   *
+   * @note
+   * Every component is replaced. The memory held for the components of the
+   * previous URI is reused, so one instance can parse request after request
+   * without allocating once its strings have grown to size.
+   * */
+  ParseResult ParseFromString(const std::string &uri_string);
+
+  /*
+   * This method parses an IRI (RFC 3987), a URI that may hold characters
+   * other than ASCII, written in UTF-8. They are percent-encoded as the IRI
+   * is mapped to a URI, so the components hold them decoded as they would
+   * hold any percent-encoded character, and GenerateString writes the URI.
+   *
+   * An IRI that is all ASCII is parsed as a URI without being copied.
+   *
+   * @input
+   * std::string iri_string
+   *
+   * @output
+   * ParseResult true if the string is a valid IRI, otherwise the reason why
+   * it is not and the offset in the string where it was found. Bytes that
+   * are not well formed UTF-8, or characters an IRI may not hold, are
+   * reported as invalid_utf8.
+   * */
+  ParseResult ParseFromIriString(const std::string &iri_string);
+
+  /*
+   * This method clears every component, leaving an empty relative reference
+   * as a newly constructed instance holds, but keeps the memory of the
+   * components for the next parse
    * */
-  bool ParseFromString(const std::string &uri_string);
+  void Reset();
 
   /*
    * This method returns the scheme
@@ -47,6 +145,17 @@ public:
    * */
   [[nodiscard]] std::string GetScheme() const;
 
+  /*
+   * This method returns the scheme as one of the common schemes
+   *
+   * @output
+   * KnownScheme the scheme
+   *
+   * @note
+   * if the scheme is not one of the common ones it returns KnownScheme::unknown
+   * */
+  [[nodiscard]] KnownScheme GetKnownScheme() const;
+
   /*
    * This method returns the user name
    *
@@ -66,6 +175,39 @@ public:
    * */
   [[nodiscard]] std::string GetHost() const;
 
+  /*
+   * This method returns which kind of host the URI has
+   *
+   * @output
+   * HostKind the kind of host
+   *
+   * @note
+   * a dotted-decimal reg-name is reported as an IPv4 address
+   * */
+  [[nodiscard]] HostKind GetHostKind() const;
+
+  /*
+   * This method returns the binary form of the host, in network byte order
+   *
+   * @output
+   * in_addr the IPv4 address
+   *
+   * @note
+   * it is only meaningful if the kind of host is HostKind::ipv4
+   * */
+  [[nodiscard]] in_addr GetIpv4Address() const;
+
+  /*
+   * This method returns the binary form of the host, in network byte order
+   *
+   * @output
+   * in6_addr the IPv6 address
+   *
+   * @note
+   * it is only meaningful if the kind of host is HostKind::ipv6
+   * */
+  [[nodiscard]] in6_addr GetIpv6Address() const;
+
   /*
    * This method returns a vector of string for the values of the path
    *
@@ -142,6 +284,18 @@ public:
    */
   void NormalizePath();
 
+  /*
+   * This method converts a registered name host to the ASCII form DNS uses,
+   * as DomainToAscii does, so a host parsed from an IRI, such as
+   * "bücher.example", becomes "xn--bcher-kva.example" and compares equal to
+   * it. Hosts that are IP addresses are left as they are.
+   *
+   * @return
+   *    IdnaError::none, or the reason the host can not be converted, in
+   *    which case it is left as it is
+   */
+  IdnaError NormalizeHost();
+
   /*
    * This method resolves the given relative reference based on the
    * base URI returning the resolverd target URI
@@ -154,6 +308,32 @@ public:
    */
   [[nodiscard]] Uri Resolve(const Uri &relative_reference) const;
 
+  /*
+   * This method does the opposite of Resolve, returning the shortest
+   * reference that resolves to the given target from this URI. Paths are
+   * compared segment by segment: the reference goes up with ".." from where
+   * the two part, or gives the whole path when that is shorter. A target
+   * with another scheme is returned as it is, and one with another authority
+   * as a network-path reference.
+   *
+   * @param[in] target
+   *    This is the URI the reference has to lead to
+   *
+   * @return
+   *    A reference such that Resolve gives back a URI equal to the target
+   */
+  [[nodiscard]] Uri MakeRelative(const Uri &target) const;
+
+  /*
+   * This method returns a hash of the canonical form of the URI. It is
+   * computed when the URI is parsed or changed, so it is free to call and
+   * stable between runs, and equal URIs always have the same hash
+   *
+   * @return
+   *    The hash of the canonical form of the URI
+   */
+  [[nodiscard]] uint64_t GetHash() const;
+
   /**
    * This method sets the scheme of Uri to the given string
    *
@@ -268,6 +448,18 @@ public:
    *
    */
   [[nodiscard]] std::string GenerateString() const;
+
+  /*
+   * This method returns the canonical form of the URI, the one equality and
+   * GetHash go by: the scheme and the host in lower case, no port when it is
+   * the default one of the scheme, the path without dot segments, or "/" when
+   * it is empty and there is an authority, and IPv6 addresses written as
+   * RFC 5952 recommends. Equal URIs give the same string.
+   *
+   * @return
+   *    The canonical form of the URI
+   */
+  [[nodiscard]] std::string GenerateCanonicalString() const;
 private:
   struct Implementation;
 
@@ -278,8 +470,54 @@ private:
   void CopyAndNormalizePath(const Uri &other);
   void CopyQuery(const Uri &other);
   void CopyFragment(const Uri &other);
+
+  /*
+   * These let a prepared base write the pieces of resolved targets
+   * straight into strings, without making a Uri for each
+   */
+  friend class PreparedBase;
+
+  /*
+   * This method returns the path a relative path reference is appended to
+   * when resolved against this URI: all but the last segment of the path,
+   * or the root if there is an authority and no path
+   */
+  [[nodiscard]] std::vector<std::string> GetBaseDirectory() const;
+
+  /*
+   * This method checks if the path has no segments at all
+   */
+  [[nodiscard]] bool IsPathEmpty() const;
+
+  /*
+   * This method checks that the path has no "." or ".." segment and no
+   * adjacent empty segments, so NormalizePath would leave it as it is
+   */
+  [[nodiscard]] bool IsPathNormalized() const;
+
+  /*
+   * These methods append the encoded components of the URI to the target
+   * the way GenerateString writes them
+   *
+   * @param[in] after_authority
+   *    This tells that the path is written after a scheme and an
+   *    authority other than those of this URI
+   */
+  void AppendSchemeAndAuthority(std::string &target) const;
+  void AppendPath(std::string &target, bool after_authority) const;
+  void AppendQuery(std::string &target) const;
+  void AppendFragment(std::string &target) const;
 };
 
 }// namespace Uri
 
+/*
+ * This allows Uris to be used as keys of unordered containers, hashing them
+ * by their canonical form
+ * */
+template<> struct std::hash<Uri::Uri>
+{
+  size_t operator()(const Uri::Uri &uri) const noexcept { return uri.GetHash(); }
+};
+
 #endif
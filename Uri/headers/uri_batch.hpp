@@ -0,0 +1,122 @@
+#ifndef URI_BATCH_HPP
+#define URI_BATCH_HPP
+
+#include "uri.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Uri {
+
+/** This is the reason why an input of a batch was rejected */
+enum class BatchParseError : uint8_t {
+  none,
+  invalid,
+  too_long,
+};
+
+/**
+ * This holds where one component of every URI of a batch is located, as
+ * offsets from the beginning of each input. A component that is not present
+ * in an input has its begin set to ABSENT.
+ */
+struct ComponentOffsets
+{
+  static constexpr uint32_t ABSENT = UINT32_MAX;
+
+  std::vector<uint32_t> begin;
+  std::vector<uint32_t> length;
+
+  /**
+   * This method checks if the component is present in the given input
+   *
+   * @param[in] index
+   *    This is the position of the input in the batch
+   */
+  [[nodiscard]] bool IsPresent(size_t index) const { return begin[index] != ABSENT; }
+
+  /**
+   * This method returns the component of the given input as a view into it
+   *
+   * @param[in] input
+   *    This is the input of the batch at the given position
+   *
+   * @param[in] index
+   *    This is the position of the input in the batch
+   */
+  [[nodiscard]] std::string_view Get(std::string_view input, size_t index) const
+  {
+    if (!IsPresent(index)) { return {}; }
+    return input.substr(begin[index], length[index]);
+  }
+};
+
+/**
+ * This is the result of parsing a batch of URIs, laid out as one array per
+ * field so that passes over a single field stay in cache. Components are
+ * kept encoded; they are the exact slices of the input that the URI
+ * parser would decode.
+ */
+struct BatchParseResults
+{
+  ComponentOffsets scheme;
+  ComponentOffsets user_info;
+  ComponentOffsets host;
+  ComponentOffsets port;
+  ComponentOffsets path;
+  ComponentOffsets query;
+  ComponentOffsets fragment;
+
+  /** This holds a 1 for every input that is a valid URI and a 0 otherwise */
+  std::vector<uint8_t> valid;
+
+  /** This holds why each input was rejected */
+  std::vector<BatchParseError> errors;
+
+  /**
+   * These hold, for every input rejected as invalid, what the URI parser
+   * found wrong with it and at which byte; they are none and 0 otherwise
+   */
+  std::vector<ParseError> parse_errors;
+  std::vector<uint32_t> error_offsets;
+
+  /**
+   * This method returns the number of inputs in the batch
+   */
+  [[nodiscard]] size_t Size() const { return valid.size(); }
+
+  /**
+   * This method sizes every array for the given number of inputs
+   *
+   * @param[in] size
+   *    This is the number of inputs in the batch
+   */
+  void Resize(size_t size);
+};
+
+/**
+ * This function parses every string of the batch as a URI, filling the
+ * results with where the components of each one are and whether or not it
+ * is valid.
+ *
+ * @param[in] inputs
+ *    These are the strings to parse
+ *
+ * @param[out] results
+ *    This is where the results are stored, it is resized to the batch size
+ *    and its storage is reused between calls
+ *
+ * @param[in] thread_count
+ *    This is the number of threads to split the work across. One parses
+ *    the batch in the calling thread and zero uses as many threads as the
+ *    hardware supports. Small batches are not split no matter the value.
+ */
+void ParseBatch(std::span<const std::string_view> inputs,
+  BatchParseResults &results,
+  size_t thread_count = 1);
+
+}// namespace Uri
+
+#endif// !URI_BATCH_HPP
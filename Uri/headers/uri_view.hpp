@@ -0,0 +1,294 @@
+#ifndef URI_VIEW_HPP
+#define URI_VIEW_HPP
+
+#include "ip_address.hpp"
+#include "uri.hpp"
+#include "validation_policy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Uri {
+
+/*
+ * This is a URI that is known when the program is built, such as the base
+ * URI of a service, held as views of the string it was parsed from. Parsing
+ * is constexpr and accepts exactly the strings Uri::ParseFromString accepts,
+ * reporting the same errors at the same offsets, but the components are
+ * left as they are written, percent-encoding and case included.
+ *
+ * Views are made with the _uri literal, which parses at compile time, so an
+ * invalid literal stops the build and a valid one is constant initialized:
+ *
+ *   using namespace Uri::Literals;
+ *   constexpr auto API_BASE = "https://api.example.com/v1/"_uri;
+ *
+ * A view does not own its string, which a literal keeps for the whole run.
+ * Its string always parses with Uri::ParseFromString when a Uri is needed.
+ */
+class UriView
+{
+public:
+  constexpr UriView() = default;
+
+  /*
+   * This method parses the components from a string, without copying it
+   *
+   * @input
+   * std::string_view uri_string, which must outlive the view
+   *
+   * @output
+   * ParseResult true if the string is a valid URI, otherwise the reason why
+   * it is not and the offset in the string where it was found, the same as
+   * Uri::ParseFromString gives
+   * */
+  constexpr ParseResult ParseFromString(std::string_view uri_string)
+  {
+    *this = UriView();
+    text_ = uri_string;
+
+    auto rest = uri_string;
+    const auto scheme_end = uri_string.find(':');
+    if (scheme_end != std::string_view::npos && scheme_end <= uri_string.find_first_of("/?#")) {
+      scheme_ = uri_string.substr(0, scheme_end);
+      const auto error_position = FirstMismatch<SchemePolicy>(scheme_);
+      if (error_position != std::string_view::npos) {
+        return { ParseError::invalid_scheme, error_position };
+      }
+      rest.remove_prefix(scheme_end + 1);
+    }
+
+    if (rest.substr(0, 2) == "//") {
+      if (auto result = ParseAuthority(rest, uri_string.size() - rest.size()); !result) {
+        return result;
+      }
+    }
+
+    const auto path_end = std::min(rest.find_first_of("?#"), rest.size());
+    path_ = rest.substr(0, path_end);
+    if (auto result = ParsePath(uri_string.size() - rest.size()); !result) { return result; }
+    rest.remove_prefix(path_end);
+
+    return ParseQueryAndFragment(rest, uri_string.size() - rest.size());
+  }
+
+  /*
+   * These methods return the string the view was parsed from and its
+   * components, as they are written. The host of an IP literal is given
+   * without its square brackets, and the path is given whole.
+   * */
+  [[nodiscard]] constexpr std::string_view GetString() const { return text_; }
+  [[nodiscard]] constexpr std::string_view GetScheme() const { return scheme_; }
+  [[nodiscard]] constexpr std::string_view GetUserName() const { return user_name_; }
+  [[nodiscard]] constexpr std::string_view GetHost() const { return host_; }
+  [[nodiscard]] constexpr std::string_view GetPath() const { return path_; }
+  [[nodiscard]] constexpr std::string_view GetQuery() const { return query_; }
+  [[nodiscard]] constexpr std::string_view GetFragment() const { return fragment_; }
+
+  /*
+   * These methods tell which of the optional components the URI has
+   * */
+  [[nodiscard]] constexpr bool IsRelativeReference() const { return scheme_.empty(); }
+  [[nodiscard]] constexpr bool HasAuthority() const { return has_authority_; }
+  [[nodiscard]] constexpr bool HasPort() const { return has_port_; }
+  [[nodiscard]] constexpr bool HasQuery() const { return has_query_; }
+  [[nodiscard]] constexpr bool HasFragment() const { return has_fragment_; }
+
+  /*
+   * This method returns the kind of host, reporting a dotted-decimal
+   * reg-name as an IPv4 address as Uri::GetHostKind does
+   * */
+  [[nodiscard]] constexpr HostKind GetHostKind() const { return host_kind_; }
+
+  /*
+   * This method returns the port, or zero if the URI does not have one
+   * */
+  [[nodiscard]] constexpr uint16_t GetPort() const { return port_; }
+
+private:
+  /*
+   * The parse methods below follow those of Uri, returning the result of
+   * parsing their part of the URI. The offset of an error is counted from
+   * the start of the whole string, which begins "base" bytes before the
+   * part they are given.
+   */
+
+  constexpr ParseResult ParseAuthority(std::string_view &rest, size_t base)
+  {
+    has_authority_ = true;
+    auto authority_end = rest.find_first_of("/?#", 2);
+    if (authority_end == std::string_view::npos) { authority_end = rest.size(); }
+    auto authority = rest.substr(2, authority_end - 2);
+    auto host_base = base + 2;
+    rest.remove_prefix(authority_end);
+
+    const auto user_delimiter = authority.find('@');
+    if (user_delimiter != std::string_view::npos) {
+      user_name_ = authority.substr(0, user_delimiter);
+      const auto error_position = FirstInvalidEncoded<UserInfoPolicy>(user_name_);
+      if (error_position != std::string_view::npos) {
+        return { ParseError::invalid_user_info, host_base + error_position };
+      }
+      authority.remove_prefix(user_delimiter + 1);
+      host_base += user_delimiter + 1;
+    }
+
+    auto port_delimiter = std::string_view::npos;
+    if (!authority.empty() && authority[0] == '[') {
+      const auto literal_end = authority.find(']');
+      if (literal_end != std::string_view::npos) {
+        port_delimiter = authority.find(':', literal_end);
+      }
+    } else {
+      port_delimiter = authority.find(':');
+    }
+
+    const auto error_position = ParseHost(authority.substr(0, port_delimiter));
+    if (error_position != std::string_view::npos) {
+      return { ParseError::invalid_host, host_base + error_position };
+    }
+    if (port_delimiter != std::string_view::npos) {
+      if (!ParsePort(authority.substr(port_delimiter + 1))) {
+        return { ParseError::invalid_port, host_base + port_delimiter + 1 };
+      }
+      has_port_ = true;
+    }
+    return {};
+  }
+
+  /*
+   * This method checks the host, returning the position of the first
+   * character that is not valid, or npos if the host is valid. An IP
+   * literal that is not valid is reported at its opening bracket.
+   */
+  constexpr size_t ParseHost(std::string_view coded_host)
+  {
+    if (coded_host.empty() || coded_host[0] != '[') {
+      host_ = coded_host;
+      std::array<uint8_t, 4> octets{};
+      host_kind_ = ParseIpv4Octets(host_, octets) ? HostKind::ipv4 : HostKind::reg_name;
+      return FirstInvalidEncoded<RegNamePolicy>(host_);
+    }
+
+    if (coded_host.size() < 2 || coded_host.back() != ']') { return 0; }
+    host_ = coded_host.substr(1, coded_host.size() - 2);
+    if (!host_.empty() && host_[0] == 'v') {
+      // IPvFuture is "v", one hexadecimal digit, "." and the rest
+      host_kind_ = HostKind::ipv_future;
+      const bool valid = host_.size() >= 3 && HEX_DIGIT.Contains(host_[1]) && host_[2] == '.'
+                         && Matches<CharacterClassPolicy<IPVFUTURE_LAST>>(host_.substr(3));
+      return valid ? std::string_view::npos : 0;
+    }
+    std::array<uint8_t, 16> bytes{};
+    host_kind_ = HostKind::ipv6;
+    return ParseIpv6Bytes(host_, bytes) ? std::string_view::npos : 0;
+  }
+
+  /*
+   * This method parses the port, which has to be one or more digits and at
+   * most 65535, as Uri checks it with std::from_chars
+   */
+  constexpr bool ParsePort(std::string_view digits)
+  {
+    constexpr uint32_t MAX_PORT = 65535;
+    if (digits.empty()) { return false; }
+    uint32_t value = 0;
+    for (const auto character : digits) {
+      if (!DIGITS.Contains(character)) { return false; }
+      value = value * 10 + static_cast<uint32_t>(character - '0');
+      if (value > MAX_PORT) { return false; }
+    }
+    port_ = static_cast<uint16_t>(value);
+    return true;
+  }
+
+  constexpr ParseResult ParsePath(size_t base) const
+  {
+    if (path_ == "/") { return {}; }
+    size_t segment_begin = 0;
+    while (segment_begin <= path_.size() && !path_.empty()) {
+      const auto segment_end = std::min(path_.find('/', segment_begin), path_.size());
+      const auto error_position = FirstInvalidEncoded<PathSegmentPolicy>(
+        path_.substr(segment_begin, segment_end - segment_begin));
+      if (error_position != std::string_view::npos) {
+        return { ParseError::invalid_path, base + segment_begin + error_position };
+      }
+      segment_begin = segment_end + 1;
+    }
+    return {};
+  }
+
+  constexpr ParseResult ParseQueryAndFragment(std::string_view rest, size_t base)
+  {
+    const auto fragment_delimiter = rest.find('#');
+
+    // A '?' after the fragment delimiter is part of the fragment
+    auto query_delimiter = rest.find('?');
+    if (query_delimiter > fragment_delimiter) { query_delimiter = std::string_view::npos; }
+
+    if (query_delimiter != std::string_view::npos) {
+      has_query_ = true;
+      const auto query_end = std::min(fragment_delimiter, rest.size());
+      query_ = rest.substr(query_delimiter + 1, query_end - query_delimiter - 1);
+      const auto error_position = FirstInvalidEncoded<QueryOrFragmentPolicy>(query_);
+      if (error_position != std::string_view::npos) {
+        return { ParseError::invalid_query, base + query_delimiter + 1 + error_position };
+      }
+    }
+
+    if (fragment_delimiter != std::string_view::npos) {
+      has_fragment_ = true;
+      fragment_ = rest.substr(fragment_delimiter + 1);
+      const auto error_position = FirstInvalidEncoded<QueryOrFragmentPolicy>(fragment_);
+      if (error_position != std::string_view::npos) {
+        return { ParseError::invalid_fragment, base + fragment_delimiter + 1 + error_position };
+      }
+    }
+    return {};
+  }
+
+  std::string_view text_;
+  std::string_view scheme_;
+  std::string_view user_name_;
+  std::string_view host_;
+  std::string_view path_;
+  std::string_view query_;
+  std::string_view fragment_;
+  HostKind host_kind_ = HostKind::reg_name;
+  uint16_t port_ = 0;
+  bool has_authority_ = false;
+  bool has_port_ = false;
+  bool has_query_ = false;
+  bool has_fragment_ = false;
+};
+
+/*
+ * This function is not constexpr, so reaching it while a literal is parsed
+ * at compile time stops the build, with its name in the error
+ */
+inline void UriLiteralIsNotValid(ParseError /*error*/, size_t /*offset*/) {}
+
+namespace Literals {
+
+  /*
+   * This literal parses a URI when the program is built, so that
+   * "https://api.example.com/v1/"_uri is a constant UriView and a URI that
+   * is not valid does not compile
+   */
+  consteval UriView operator""_uri(const char *text, size_t size)
+  {
+    UriView view;
+    if (const auto result = view.ParseFromString({ text, size }); !result) {
+      UriLiteralIsNotValid(result.error, result.offset);
+    }
+    return view;
+  }
+
+}// namespace Literals
+
+}// namespace Uri
+
+#endif// !URI_VIEW_HPP
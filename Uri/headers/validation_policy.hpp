@@ -0,0 +1,124 @@
+#ifndef URI_VALIDATION_POLICY_HPP
+#define URI_VALIDATION_POLICY_HPP
+
+#include "character_set.hpp"
+
+#include <string_view>
+
+namespace Uri {
+
+/*
+ * A validation policy describes which characters may appear in an element of
+ * a URI. It is a type with:
+ *
+ *  - static constexpr bool ALLOW_EMPTY, whether the element may be empty
+ *  - static constexpr bool First(char), checking the first character
+ *  - static constexpr bool Rest(char), checking every other character
+ *
+ * Policies are passed as template arguments so that the checks inline into
+ * the loop that walks the element.
+ */
+
+/*
+ * This is the policy for elements that allow the same characters all along
+ *
+ * @param[in] ALLOWED
+ *  This is the set of characters allowed
+ */
+template<const CharacterSet &ALLOWED> struct CharacterClassPolicy
+{
+  static constexpr bool ALLOW_EMPTY = true;
+  static constexpr bool First(char character) { return ALLOWED.Contains(character); }
+  static constexpr bool Rest(char character) { return ALLOWED.Contains(character); }
+};
+
+/* This is the policy for the scheme: ALPHA *( ALPHA / DIGIT / "+" / "-" / "." ) */
+struct SchemePolicy
+{
+  static constexpr bool ALLOW_EMPTY = false;
+  static constexpr bool First(char character) { return ALPHA.Contains(character); }
+  static constexpr bool Rest(char character) { return SCHEME_NOT_FIRST.Contains(character); }
+};
+
+using UserInfoPolicy = CharacterClassPolicy<USER_NAME>;
+using RegNamePolicy = CharacterClassPolicy<REG_NAME_NOT_PCT_ENCODED>;
+using PathSegmentPolicy = CharacterClassPolicy<PCHAR_NOT_PCT_ENCODED>;
+using QueryOrFragmentPolicy = CharacterClassPolicy<QUERY_OR_FRAGMENT>;
+
+/*
+ * This function finds the first character of the candidate that the policy
+ * does not allow
+ *
+ * @param [in] candidate
+ *  This is the string to test
+ *
+ * @return
+ * The position of the character, 0 for an empty candidate when the policy
+ * does not allow empty elements, or npos if the candidate passes the test
+ */
+template<typename Policy> constexpr size_t FirstMismatch(std::string_view candidate)
+{
+  if (candidate.empty()) { return Policy::ALLOW_EMPTY ? std::string_view::npos : 0; }
+  if (!Policy::First(candidate.front())) { return 0; }
+  for (size_t position = 1; position < candidate.size(); ++position) {
+    if (!Policy::Rest(candidate[position])) { return position; }
+  }
+  return std::string_view::npos;
+}
+
+/*
+ * This function checks if every character of the candidate is allowed by
+ * the policy
+ *
+ * @param [in] candidate
+ *  This is the string to test
+ *
+ * @return
+ * An indication if the candidate passes the test
+ */
+template<typename Policy> constexpr bool Matches(std::string_view candidate)
+{
+  return FirstMismatch<Policy>(candidate) == std::string_view::npos;
+}
+
+/*
+ * This function checks if any character of the candidate breaks the policy
+ */
+template<typename Policy> constexpr bool FailsMatch(std::string_view candidate)
+{
+  return !Matches<Policy>(candidate);
+}
+
+/*
+ * This function finds the first character of an element that is not valid,
+ * checking every character that is not percent-encoded against the policy,
+ * as DecodeInPlace does but without decoding, so it can run at compile time
+ *
+ * @param [in] element
+ *  This is the element to test, as it is written in the URI
+ *
+ * @return
+ * The position of the first character that is not valid, or of the "%"
+ * of an escape cut short by the end of the element, or npos if the
+ * element is valid
+ */
+template<typename Policy> constexpr size_t FirstInvalidEncoded(std::string_view element)
+{
+  constexpr size_t ESCAPE_DIGITS = 2;
+  for (size_t position = 0; position < element.size(); ++position) {
+    if (element[position] != '%') {
+      if (!Policy::Rest(element[position])) { return position; }
+      continue;
+    }
+    for (size_t digit = 1; digit <= ESCAPE_DIGITS; ++digit) {
+      if (position + digit >= element.size()) { return position; }
+      if (!HEX_DIGIT.Contains(element[position + digit])) { return position + digit; }
+    }
+    position += ESCAPE_DIGITS;
+  }
+  return std::string_view::npos;
+}
+
+}// namespace Uri
+
+#endif// !URI_VALIDATION_POLICY_HPP
@@ -0,0 +1,73 @@
+#ifndef URI_DECODE_IN_PLACE_HPP
+#define URI_DECODE_IN_PLACE_HPP
+
+#include "instrumentation.hpp"
+#include "percent_encoded_character_decoder.hpp"
+
+#include <string>
+
+namespace Uri {
+
+/*
+ * This function decodes the percent-encoded characters of an element in
+ * place, checking every character that is not encoded against the policy.
+ * It is shared by the elements of a URI and the fields of form bodies.
+ *
+ * Decoding never makes the element longer, so it is written over itself
+ * and keeps its memory.
+ *
+ * @param LIBRARY
+ *  This is the library the decoded escapes are counted for
+ *
+ * @param PLUS_IS_SPACE
+ *  This tells if "+" stands for a space, as it does in
+ *  application/x-www-form-urlencoded data
+ *
+ * @param[in,out] element
+ *  This is the element to decode
+ *
+ * @param[in,out] percent_decoder
+ *  This is the decoder to use, kept by the caller so that it is not made
+ *  again for every element
+ *
+ * @return
+ * The position of the first character that is not valid, or of the "%"
+ * of an escape cut short by the end of the element, or npos if the
+ * element is valid
+ */
+template<typename Policy, Instrumentation::Library LIBRARY, bool PLUS_IS_SPACE = false>
+size_t DecodeInPlace(std::string &element, PercentEncodedCharacterDecoder &percent_decoder)
+{
+  bool decoding_percent_charcater = false;
+  size_t percent_position = 0;
+  size_t decoded_size = 0;
+
+  for (size_t position = 0; position < element.size(); ++position) {
+    const auto character = element[position];
+
+    if (decoding_percent_charcater) {
+      if (!percent_decoder.NextEncodedCharacter(character)) { return position; }
+      if (percent_decoder.Done()) {
+        decoding_percent_charcater = false;
+        element[decoded_size++] = percent_decoder.GetDecodedCharacter();
+        Instrumentation::CountDecodedEscape(LIBRARY);
+      }
+    } else {
+      if (character == '%') {
+        percent_decoder.Reset();
+        decoding_percent_charcater = true;
+        percent_position = position;
+      } else {
+        if (!Policy::Rest(character)) { return position; }
+        element[decoded_size++] = (PLUS_IS_SPACE && character == '+') ? ' ' : character;
+      }
+    }
+  }
+
+  element.resize(decoded_size);
+  return decoding_percent_charcater ? percent_position : std::string::npos;
+}
+
+}// namespace Uri
+
+#endif// !URI_DECODE_IN_PLACE_HPP
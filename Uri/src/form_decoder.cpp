@@ -0,0 +1,120 @@
+#include "form_decoder.hpp"
+#include "decode_in_place.hpp"
+#include "percent_encoded_character_decoder.hpp"
+#include "validation_policy.hpp"
+
+#include <string>
+
+namespace Uri {
+
+struct FormDecoder::Implementation
+{
+  FieldCallback on_field;
+  size_t max_field_size = 0;
+  FormError error = FormError::none;
+
+  /** This is the beginning of a field cut by the end of the last chunk */
+  std::string partial;
+
+  /** These hold the name and value of a field while it is decoded */
+  std::string name;
+  std::string value;
+  PercentEncodedCharacterDecoder percent_decoder;
+
+  // Methods
+
+  FormError Fail(FormError new_error)
+  {
+    error = new_error;
+    return error;
+  }
+
+  /**
+   * This method decodes one whole field and gives it to the callback
+   */
+  FormError Decode(std::string_view field)
+  {
+    if (field.empty()) { return error; }
+    if (field.size() > max_field_size) { return Fail(FormError::field_too_long); }
+
+    const auto equals = field.find('=');
+    const auto raw_name = field.substr(0, equals);
+    const auto raw_value =
+      equals == std::string_view::npos ? std::string_view() : field.substr(equals + 1);
+
+    // Most fields need no decoding and are given as they are
+    if (field.find_first_of("%+") == std::string_view::npos) {
+      if (FailsMatch<QueryOrFragmentPolicy>(field)) { return Fail(FormError::invalid_character); }
+      return Deliver(raw_name, raw_value);
+    }
+
+    name.assign(raw_name);
+    value.assign(raw_value);
+    if (!DecodeField(name) || !DecodeField(value)) { return Fail(FormError::invalid_character); }
+    return Deliver(name, value);
+  }
+
+  /** This decodes a field name or value in place, telling if it is valid */
+  bool DecodeField(std::string &element)
+  {
+    return DecodeInPlace<QueryOrFragmentPolicy, Instrumentation::Library::form_body, true>(
+             element, percent_decoder)
+           == std::string::npos;
+  }
+
+  FormError Deliver(std::string_view field_name, std::string_view field_value)
+  {
+    if (!on_field(field_name, field_value)) { return Fail(FormError::aborted); }
+    return error;
+  }
+};
+
+FormDecoder::~FormDecoder() = default;
+
+FormDecoder::FormDecoder(FormDecoder &&) noexcept = default;
+
+FormDecoder &FormDecoder::operator=(FormDecoder &&) noexcept = default;
+
+FormDecoder::FormDecoder(FieldCallback on_field, size_t max_field_size)
+  : impl_(new Implementation)
+{
+  impl_->on_field = std::move(on_field);
+  impl_->max_field_size = max_field_size;
+}
+
+FormError FormDecoder::Feed(std::string_view chunk)
+{
+  auto &partial = impl_->partial;
+  while (!chunk.empty() && impl_->error == FormError::none) {
+    const auto separator = chunk.find('&');
+    const auto field = chunk.substr(0, separator);
+    if (partial.size() + field.size() > impl_->max_field_size) {
+      return impl_->Fail(FormError::field_too_long);
+    }
+    if (separator == std::string_view::npos) {
+      partial.append(field);
+      break;
+    }
+    chunk.remove_prefix(separator + 1);
+
+    if (partial.empty()) {
+      impl_->Decode(field);
+    } else {
+      partial.append(field);
+      impl_->Decode(partial);
+      partial.clear();
+    }
+  }
+  return impl_->error;
+}
+
+FormError FormDecoder::Finish()
+{
+  if (impl_->error == FormError::none && !impl_->partial.empty()) {
+    impl_->Decode(impl_->partial);
+    impl_->partial.clear();
+  }
+  return impl_->error;
+}
+
+}// namespace Uri
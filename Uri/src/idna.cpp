@@ -0,0 +1,560 @@
+#include "idna.hpp"
+#include "character_set.hpp"
+#include "idna_tables.hpp"
+#include "normalize_case_insensitive_string.hpp"
+#include "utf8.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace {
+
+/** These are the parameters of Punycode for IDNA (RFC 3492 section 5) */
+constexpr uint32_t BASE = 36;
+constexpr uint32_t T_MIN = 1;
+constexpr uint32_t T_MAX = 26;
+constexpr uint32_t SKEW = 38;
+constexpr uint32_t DAMP = 700;
+constexpr uint32_t INITIAL_BIAS = 72;
+constexpr uint32_t INITIAL_N = 0x80;
+constexpr uint32_t MAX_VALUE = std::numeric_limits<uint32_t>::max();
+
+/** These are the number of letters and the value of the first digit */
+constexpr uint32_t LETTERS = 26;
+
+/** This is the prefix of labels encoded with Punycode */
+constexpr std::string_view ACE_PREFIX = "xn--";
+
+/** These are the limits of DNS names, without the trailing "." */
+constexpr size_t MAX_LABEL_SIZE = 63;
+constexpr size_t MAX_DOMAIN_SIZE = 253;
+
+/** These are the zero width joiners and the combining class of the viramas */
+constexpr char32_t ZERO_WIDTH_NON_JOINER = 0x200C;
+constexpr char32_t ZERO_WIDTH_JOINER = 0x200D;
+constexpr uint8_t VIRAMA_CLASS = 9;
+
+/** These lay out the Hangul syllables (Unicode section 3.12) */
+constexpr char32_t HANGUL_S_BASE = 0xAC00;
+constexpr char32_t HANGUL_L_BASE = 0x1100;
+constexpr char32_t HANGUL_V_BASE = 0x1161;
+constexpr char32_t HANGUL_T_BASE = 0x11A7;
+constexpr char32_t HANGUL_L_COUNT = 19;
+constexpr char32_t HANGUL_V_COUNT = 21;
+constexpr char32_t HANGUL_T_COUNT = 28;
+constexpr char32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+constexpr char32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+/** These are the limits of the code points Punycode may decode to */
+constexpr char32_t SURROGATES_BEGIN = 0xD800;
+constexpr char32_t SURROGATES_END = 0xDFFF;
+constexpr char32_t MAX_CODE_POINT = 0x10FFFF;
+
+/*
+ * This function returns the threshold of the digit at the given position
+ */
+uint32_t Threshold(uint32_t k, uint32_t bias)
+{
+  if (k <= bias) { return T_MIN; }
+  if (k >= bias + T_MAX) { return T_MAX; }
+  return k - bias;
+}
+
+/*
+ * This function adapts the bias after a code point (RFC 3492 section 6.1)
+ */
+uint32_t Adapt(uint32_t delta, uint32_t point_count, bool first_time)
+{
+  delta = first_time ? delta / DAMP : delta / 2;
+  delta += delta / point_count;
+  uint32_t k = 0;
+  while (delta > ((BASE - T_MIN) * T_MAX) / 2) {
+    delta /= BASE - T_MIN;
+    k += BASE;
+  }
+  return k + (BASE - T_MIN + 1) * delta / (delta + SKEW);
+}
+
+char EncodeDigit(uint32_t digit)
+{
+  return static_cast<char>(digit < LETTERS ? 'a' + digit : '0' + digit - LETTERS);
+}
+
+/*
+ * This function returns the value of the digit, or BASE if it is not one
+ */
+uint32_t DecodeDigit(char character)
+{
+  if (character >= 'a' && character <= 'z') { return static_cast<uint32_t>(character - 'a'); }
+  if (character >= 'A' && character <= 'Z') { return static_cast<uint32_t>(character - 'A'); }
+  if (character >= '0' && character <= '9') {
+    return static_cast<uint32_t>(character - '0') + LETTERS;
+  }
+  return BASE;
+}
+
+/*
+ * This function checks if the code point is in one of the sorted ranges
+ */
+template<size_t SIZE>
+bool InRanges(const Uri::IdnaTables::Range (&ranges)[SIZE], char32_t code_point)
+{
+  const auto *after = std::upper_bound(std::begin(ranges),
+    std::end(ranges),
+    code_point,
+    [](char32_t value, const Uri::IdnaTables::Range &range) { return value < range.first; });
+  return after != std::begin(ranges) && code_point <= std::prev(after)->last;
+}
+
+/*
+ * This function finds the expansion of the code point, or returns nullptr
+ * if it has none
+ */
+template<size_t SIZE>
+const Uri::IdnaTables::Expansion *FindExpansion(
+  const Uri::IdnaTables::Expansion (&expansions)[SIZE], char32_t code_point)
+{
+  const auto *expansion = std::lower_bound(std::begin(expansions),
+    std::end(expansions),
+    code_point,
+    [](const Uri::IdnaTables::Expansion &entry, char32_t value) {
+      return entry.code_point < value;
+    });
+  if (expansion == std::end(expansions) || expansion->code_point != code_point) { return nullptr; }
+  return expansion;
+}
+
+/*
+ * This function appends the mapping of the code point of UTS #46 to the
+ * label, returning false if the code point is disallowed
+ */
+bool AppendMapped(std::u32string &label, char32_t code_point)
+{
+  using namespace Uri::IdnaTables;
+  if (InRanges(IGNORED, code_point)) { return true; }
+  if (InRanges(DISALLOWED, code_point)) { return false; }
+
+  if (const auto *expansion = FindExpansion(EXPANSIONS, code_point)) {
+    label.append(std::next(std::begin(EXPANDED), expansion->offset), expansion->size);
+    return true;
+  }
+
+  const auto *after = std::upper_bound(std::begin(RUNS),
+    std::end(RUNS),
+    code_point,
+    [](char32_t value, const Run &run) { return value < run.first; });
+  if (after != std::begin(RUNS)) {
+    const auto &run = *std::prev(after);
+    const auto offset = code_point - run.first;
+    if (offset % run.stride == 0 && offset / run.stride < run.count) {
+      label.push_back(static_cast<char32_t>(static_cast<int64_t>(code_point) + run.delta));
+      return true;
+    }
+  }
+  label.push_back(code_point);
+  return true;
+}
+
+/*
+ * This function checks if the code point is valid as it is, that is if the
+ * mapping leaves it alone
+ */
+bool IsValid(char32_t code_point)
+{
+  std::u32string mapped;
+  return AppendMapped(mapped, code_point) && mapped.size() == 1 && mapped[0] == code_point;
+}
+
+/*
+ * This function returns the canonical combining class of a code point that
+ * is valid once mapped
+ */
+uint8_t CombiningClassOf(char32_t code_point)
+{
+  using namespace Uri::IdnaTables;
+  const auto *after = std::upper_bound(std::begin(COMBINING_CLASSES),
+    std::end(COMBINING_CLASSES),
+    code_point,
+    [](char32_t value, const CombiningClass &range) { return value < range.first; });
+  if (after == std::begin(COMBINING_CLASSES) || code_point > std::prev(after)->last) { return 0; }
+  return std::prev(after)->value;
+}
+
+/*
+ * This function returns the joining type of a code point that is valid once
+ * mapped, 'L', 'D', 'R' or 'T', or zero if it does not join
+ */
+char JoiningTypeOf(char32_t code_point)
+{
+  using namespace Uri::IdnaTables;
+  const auto *after = std::upper_bound(std::begin(JOINING_TYPES),
+    std::end(JOINING_TYPES),
+    code_point,
+    [](char32_t value, const JoiningType &range) { return value < range.first; });
+  if (after == std::begin(JOINING_TYPES) || code_point > std::prev(after)->last) { return 0; }
+  return std::prev(after)->value;
+}
+
+/*
+ * This function checks if a zero width joiner or non-joiner is where it is
+ * allowed (RFC 5892 appendix A.1 and A.2): after a virama, or for the
+ * non-joiner also between a letter joining on its right and one joining on
+ * its left, with only transparent code points in between
+ */
+bool JoinerIsAllowed(std::u32string_view label, size_t index)
+{
+  if (index > 0 && CombiningClassOf(label[index - 1]) == VIRAMA_CLASS) { return true; }
+  if (label[index] != ZERO_WIDTH_NON_JOINER) { return false; }
+
+  auto before = index;
+  while (before > 0 && JoiningTypeOf(label[before - 1]) == 'T') { --before; }
+  if (before == 0 || (JoiningTypeOf(label[before - 1]) != 'L'
+                       && JoiningTypeOf(label[before - 1]) != 'D')) {
+    return false;
+  }
+  auto after = index + 1;
+  while (after < label.size() && JoiningTypeOf(label[after]) == 'T') { ++after; }
+  return after < label.size()
+         && (JoiningTypeOf(label[after]) == 'R' || JoiningTypeOf(label[after]) == 'D');
+}
+
+/*
+ * This function returns the primary composite of the two code points, or
+ * zero if they do not compose
+ */
+char32_t Compose(char32_t first, char32_t second)
+{
+  using namespace Uri::IdnaTables;
+  if (first - HANGUL_L_BASE < HANGUL_L_COUNT && second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+    return HANGUL_S_BASE
+           + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+  }
+  if (first - HANGUL_S_BASE < HANGUL_S_COUNT && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+      && second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+    return first + second - HANGUL_T_BASE;
+  }
+
+  const auto *composition = std::lower_bound(std::begin(COMPOSITIONS),
+    std::end(COMPOSITIONS),
+    std::make_pair(first, second),
+    [](const Composition &entry, const std::pair<char32_t, char32_t> &value) {
+      return std::make_pair(entry.first, entry.second) < value;
+    });
+  if (composition == std::end(COMPOSITIONS) || composition->first != first
+      || composition->second != second) {
+    return 0;
+  }
+  return composition->composite;
+}
+
+/*
+ * This function puts code points that are valid once mapped in
+ * normalization form C (Unicode section 3.11): they are decomposed, their
+ * marks are put in canonical order and they are composed again
+ */
+void NormalizeToNfc(std::u32string &code_points)
+{
+  using namespace Uri::IdnaTables;
+  std::u32string decomposed;
+  decomposed.reserve(code_points.size());
+  for (const auto code_point : code_points) {
+    if (code_point - HANGUL_S_BASE < HANGUL_S_COUNT) {
+      const auto index = code_point - HANGUL_S_BASE;
+      decomposed.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+      decomposed.push_back(HANGUL_V_BASE + index % HANGUL_N_COUNT / HANGUL_T_COUNT);
+      if (index % HANGUL_T_COUNT != 0) {
+        decomposed.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+      }
+    } else if (const auto *expansion = FindExpansion(DECOMPOSITIONS, code_point)) {
+      decomposed.append(std::next(std::begin(DECOMPOSED), expansion->offset), expansion->size);
+    } else {
+      decomposed.push_back(code_point);
+    }
+  }
+
+  // Marks are sorted by class, keeping the order of those of the same class
+  for (size_t index = 1; index < decomposed.size(); ++index) {
+    const auto value = CombiningClassOf(decomposed[index]);
+    if (value == 0) { continue; }
+    for (auto at = index; at > 0 && CombiningClassOf(decomposed[at - 1]) > value; --at) {
+      std::swap(decomposed[at - 1], decomposed[at]);
+    }
+  }
+
+  // A code point composes with the last starter unless a code point in
+  // between is a starter or of the same class or higher
+  code_points.clear();
+  auto starter = std::u32string::npos;
+  uint8_t last_class = 0;
+  for (const auto code_point : decomposed) {
+    const auto value = CombiningClassOf(code_point);
+    if (starter != std::u32string::npos
+        && (starter + 1 == code_points.size() || (last_class != 0 && last_class < value))) {
+      if (const auto composite = Compose(code_points[starter], code_point); composite != 0) {
+        code_points[starter] = composite;
+        continue;
+      }
+    }
+    if (value == 0) { starter = code_points.size(); }
+    last_class = value;
+    code_points.push_back(code_point);
+  }
+}
+
+/*
+ * This function checks a label that is mapped and normalized: it may not
+ * start with a mark, every code point must be valid as it is and ASCII ones
+ * must be allowed in a host of RFC 3986, and the zero width joiners must be
+ * where they are allowed (the CheckJoiners rule of UTS #46).
+ */
+bool IsValidLabel(std::u32string_view label)
+{
+  if (!label.empty() && InRanges(Uri::IdnaTables::MARKS, label.front())) { return false; }
+  for (size_t index = 0; index < label.size(); ++index) {
+    const auto code_point = label[index];
+    if (!IsValid(code_point)
+        || (code_point < INITIAL_N
+            && !Uri::REG_NAME_NOT_PCT_ENCODED.Contains(static_cast<char>(code_point)))) {
+      return false;
+    }
+    if ((code_point == ZERO_WIDTH_NON_JOINER || code_point == ZERO_WIDTH_JOINER)
+        && !JoinerIsAllowed(label, index)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * This function checks if the label holds only ASCII code points
+ */
+bool IsAscii(std::u32string_view label)
+{
+  return std::all_of(
+    label.begin(), label.end(), [](char32_t code_point) { return code_point < INITIAL_N; });
+}
+
+/*
+ * This function checks if the label starts with the ACE prefix, in any case
+ */
+template<typename Label> bool HasAcePrefix(const Label &label)
+{
+  if (label.size() < ACE_PREFIX.size()) { return false; }
+  for (size_t index = 0; index < ACE_PREFIX.size(); ++index) {
+    const auto character = label[index];
+    if (character != static_cast<typename Label::value_type>(ACE_PREFIX[index])
+        && character != static_cast<typename Label::value_type>(ACE_PREFIX[index] - 'a' + 'A')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}// namespace
+
+namespace Uri {
+
+std::string_view ToString(IdnaError error)
+{
+  switch (error) {
+  case IdnaError::none:
+    return "no error";
+  case IdnaError::invalid_utf8:
+    return "invalid UTF-8";
+  case IdnaError::prohibited_character:
+    return "prohibited character";
+  case IdnaError::invalid_punycode:
+    return "invalid Punycode";
+  case IdnaError::empty_label:
+    return "empty label";
+  case IdnaError::label_too_long:
+    return "label too long";
+  case IdnaError::domain_too_long:
+    return "domain too long";
+  }
+  return "unknown error";
+}
+
+bool PunycodeEncode(std::u32string_view code_points, std::string &encoded)
+{
+  if (code_points.size() >= MAX_VALUE) { return false; }
+
+  uint32_t basic_count = 0;
+  for (const auto code_point : code_points) {
+    if (code_point < INITIAL_N) {
+      encoded.push_back(static_cast<char>(code_point));
+      ++basic_count;
+    }
+  }
+  if (basic_count > 0) { encoded.push_back('-'); }
+
+  uint32_t n = INITIAL_N;
+  uint32_t delta = 0;
+  uint32_t bias = INITIAL_BIAS;
+  for (uint32_t handled = basic_count; handled < code_points.size(); ++delta, ++n) {
+    // The next code point to insert is the smallest one not handled yet
+    uint32_t next = MAX_VALUE;
+    for (const auto code_point : code_points) {
+      if (code_point >= n && code_point < next) { next = code_point; }
+    }
+    if (next - n > (MAX_VALUE - delta) / (handled + 1)) { return false; }
+    delta += (next - n) * (handled + 1);
+    n = next;
+
+    for (const auto code_point : code_points) {
+      if (code_point < n && ++delta == 0) { return false; }
+      if (code_point != n) { continue; }
+
+      uint32_t q = delta;
+      for (uint32_t k = BASE;; k += BASE) {
+        const auto t = Threshold(k, bias);
+        if (q < t) { break; }
+        encoded.push_back(EncodeDigit(t + (q - t) % (BASE - t)));
+        q = (q - t) / (BASE - t);
+      }
+      encoded.push_back(EncodeDigit(q));
+      bias = Adapt(delta, handled + 1, handled == basic_count);
+      delta = 0;
+      ++handled;
+    }
+  }
+  return true;
+}
+
+bool PunycodeDecode(std::string_view encoded, std::u32string &code_points)
+{
+  code_points.clear();
+
+  // The basic code points are before the last delimiter, if there is one
+  const auto delimiter = encoded.rfind('-');
+  size_t position = 0;
+  if (delimiter != std::string_view::npos) {
+    for (const auto character : encoded.substr(0, delimiter)) {
+      if (static_cast<unsigned char>(character) >= INITIAL_N) { return false; }
+      code_points.push_back(static_cast<char32_t>(character));
+    }
+    position = delimiter + 1;
+  }
+
+  uint32_t n = INITIAL_N;
+  uint32_t i = 0;
+  uint32_t bias = INITIAL_BIAS;
+  while (position < encoded.size()) {
+    const auto old_i = i;
+    uint32_t w = 1;
+    for (uint32_t k = BASE;; k += BASE) {
+      if (position >= encoded.size()) { return false; }
+      const auto digit = DecodeDigit(encoded[position++]);
+      if (digit >= BASE || digit > (MAX_VALUE - i) / w) { return false; }
+      i += digit * w;
+      const auto t = Threshold(k, bias);
+      if (digit < t) { break; }
+      if (w > MAX_VALUE / (BASE - t)) { return false; }
+      w *= BASE - t;
+    }
+
+    const auto length = static_cast<uint32_t>(code_points.size()) + 1;
+    bias = Adapt(i - old_i, length, old_i == 0);
+    if (i / length > MAX_VALUE - n) { return false; }
+    n += i / length;
+    i %= length;
+    if (n > MAX_CODE_POINT || (n >= SURROGATES_BEGIN && n <= SURROGATES_END)) { return false; }
+    code_points.insert(code_points.begin() + i, static_cast<char32_t>(n));
+    ++i;
+  }
+  return true;
+}
+
+IdnaError DomainToAscii(std::string_view domain, std::string &ascii)
+{
+  ascii.clear();
+
+  // Names that are all ASCII only need their letters lowered, and their
+  // encoded labels checked
+  if (FindNonAscii(domain) == std::string_view::npos) {
+    ascii.assign(domain);
+    AsciiToLower(ascii);
+  } else {
+    // The whole name is mapped before it is split, as the full stops of other
+    // scripts are mapped to "."
+    std::u32string mapped;
+    for (size_t position = 0; position < domain.size();) {
+      char32_t code_point = 0;
+      const auto length = DecodeUtf8(domain, position, code_point);
+      if (length == 0) { return IdnaError::invalid_utf8; }
+      position += length;
+      if (!AppendMapped(mapped, code_point)) { return IdnaError::prohibited_character; }
+    }
+    NormalizeToNfc(mapped);
+
+    std::u32string_view rest = mapped;
+    while (true) {
+      const auto end = rest.find('.');
+      const auto label = rest.substr(0, end);
+      if (!IsValidLabel(label)) { return IdnaError::prohibited_character; }
+      if (IsAscii(label)) {
+        for (const auto code_point : label) { ascii.push_back(static_cast<char>(code_point)); }
+      } else {
+        if (HasAcePrefix(label)) { return IdnaError::invalid_punycode; }
+        ascii.append(ACE_PREFIX);
+        if (!PunycodeEncode(label, ascii)) { return IdnaError::label_too_long; }
+      }
+      if (end == std::u32string_view::npos) { break; }
+      ascii.push_back('.');
+      rest.remove_prefix(end + 1);
+    }
+  }
+
+  // Every label is checked once written, "xn--" ones by decoding them to a
+  // label that is not ASCII, not "xn--" again, valid and normalized
+  std::string_view rest = ascii;
+  if (!rest.empty() && rest.back() == '.') { rest.remove_suffix(1); }
+  if (rest.size() > MAX_DOMAIN_SIZE) { return IdnaError::domain_too_long; }
+  std::u32string decoded;
+  while (true) {
+    const auto end = rest.find('.');
+    const auto written = rest.substr(0, end);
+    if (written.empty()) { return IdnaError::empty_label; }
+    if (written.size() > MAX_LABEL_SIZE) { return IdnaError::label_too_long; }
+    if (HasAcePrefix(written)) {
+      if (!PunycodeDecode(written.substr(ACE_PREFIX.size()), decoded) || IsAscii(decoded)
+          || HasAcePrefix(decoded) || !IsValidLabel(decoded)) {
+        return IdnaError::invalid_punycode;
+      }
+      auto normalized = decoded;
+      NormalizeToNfc(normalized);
+      if (normalized != decoded) { return IdnaError::invalid_punycode; }
+    }
+    if (end == std::string_view::npos) { break; }
+    rest.remove_prefix(end + 1);
+  }
+  return IdnaError::none;
+}
+
+IdnaError DomainToUnicode(std::string_view domain, std::string &unicode)
+{
+  unicode.clear();
+  std::u32string decoded;
+  while (true) {
+    const auto end = domain.find('.');
+    const auto label = domain.substr(0, end);
+    if (HasAcePrefix(label)) {
+      if (!PunycodeDecode(label.substr(ACE_PREFIX.size()), decoded)) {
+        return IdnaError::invalid_punycode;
+      }
+      for (const auto code_point : decoded) { AppendUtf8(unicode, code_point); }
+    } else {
+      unicode.append(label);
+    }
+    if (end == std::string_view::npos) { break; }
+    unicode.push_back('.');
+    domain.remove_prefix(end + 1);
+  }
+  return IdnaError::none;
+}
+
+}// namespace Uri
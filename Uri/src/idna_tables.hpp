@@ -0,0 +1,2312 @@
+#ifndef URI_IDNA_TABLES_HPP
+#define URI_IDNA_TABLES_HPP
+
+// This file is generated by Uri/tools/generate_idna_tables.py from the IDNA
+// mapping table of UTS #46 (Unicode 15.1.0). Do not edit it by hand.
+
+#include <cstdint>
+
+namespace Uri::IdnaTables {
+
+/** This is a range of code points, both ends included */
+struct Range
+{
+  char32_t first;
+  char32_t last;
+};
+
+/**
+ * This is a run of code points mapped by adding the same offset, every
+ * code point or every other one
+ */
+struct Run
+{
+  char32_t first;
+  uint16_t count;
+  uint8_t stride;
+  int32_t delta;
+};
+
+/** This is a code point mapped to many, kept in a slice of another array */
+struct Expansion
+{
+  char32_t code_point;
+  uint16_t offset;
+  uint8_t size;
+};
+
+/** This is a range of code points of the same canonical combining class */
+struct CombiningClass
+{
+  char32_t first;
+  char32_t last;
+  uint8_t value;
+};
+
+/** This is a range of code points of the same joining type */
+struct JoiningType
+{
+  char32_t first;
+  char32_t last;
+  char value;
+};
+
+/** This is a pair of code points that normalization form C composes */
+struct Composition
+{
+  char32_t first;
+  char32_t second;
+  char32_t composite;
+};
+
+/** These are mapped to nothing */
+inline constexpr Range IGNORED[] = {
+  { 0xAD, 0xAD }, { 0x34F, 0x34F }, { 0x180B, 0x180D }, { 0x180F, 0x180F }, { 0x200B, 0x200B },
+  { 0x2060, 0x2060 }, { 0x2064, 0x2064 }, { 0xFE00, 0xFE0F }, { 0xFEFF, 0xFEFF },
+  { 0x1BCA0, 0x1BCA3 }, { 0xE0100, 0xE01EF },
+};
+
+/** These may not be in a domain name */
+inline constexpr Range DISALLOWED[] = {
+  { 0x80, 0x9F }, { 0x378, 0x379 }, { 0x380, 0x383 }, { 0x38B, 0x38B }, { 0x38D, 0x38D },
+  { 0x3A2, 0x3A2 }, { 0x4C0, 0x4C0 }, { 0x530, 0x530 }, { 0x557, 0x558 }, { 0x58B, 0x58C },
+  { 0x590, 0x590 }, { 0x5C8, 0x5CF }, { 0x5EB, 0x5EE }, { 0x5F5, 0x605 }, { 0x61C, 0x61C },
+  { 0x6DD, 0x6DD }, { 0x70E, 0x70F }, { 0x74B, 0x74C }, { 0x7B2, 0x7BF }, { 0x7FB, 0x7FC },
+  { 0x82E, 0x82F }, { 0x83F, 0x83F }, { 0x85C, 0x85D }, { 0x85F, 0x85F }, { 0x86B, 0x86F },
+  { 0x88F, 0x897 }, { 0x8E2, 0x8E2 }, { 0x984, 0x984 }, { 0x98D, 0x98E }, { 0x991, 0x992 },
+  { 0x9A9, 0x9A9 }, { 0x9B1, 0x9B1 }, { 0x9B3, 0x9B5 }, { 0x9BA, 0x9BB }, { 0x9C5, 0x9C6 },
+  { 0x9C9, 0x9CA }, { 0x9CF, 0x9D6 }, { 0x9D8, 0x9DB }, { 0x9DE, 0x9DE }, { 0x9E4, 0x9E5 },
+  { 0x9FF, 0xA00 }, { 0xA04, 0xA04 }, { 0xA0B, 0xA0E }, { 0xA11, 0xA12 }, { 0xA29, 0xA29 },
+  { 0xA31, 0xA31 }, { 0xA34, 0xA34 }, { 0xA37, 0xA37 }, { 0xA3A, 0xA3B }, { 0xA3D, 0xA3D },
+  { 0xA43, 0xA46 }, { 0xA49, 0xA4A }, { 0xA4E, 0xA50 }, { 0xA52, 0xA58 }, { 0xA5D, 0xA5D },
+  { 0xA5F, 0xA65 }, { 0xA77, 0xA80 }, { 0xA84, 0xA84 }, { 0xA8E, 0xA8E }, { 0xA92, 0xA92 },
+  { 0xAA9, 0xAA9 }, { 0xAB1, 0xAB1 }, { 0xAB4, 0xAB4 }, { 0xABA, 0xABB }, { 0xAC6, 0xAC6 },
+  { 0xACA, 0xACA }, { 0xACE, 0xACF }, { 0xAD1, 0xADF }, { 0xAE4, 0xAE5 }, { 0xAF2, 0xAF8 },
+  { 0xB00, 0xB00 }, { 0xB04, 0xB04 }, { 0xB0D, 0xB0E }, { 0xB11, 0xB12 }, { 0xB29, 0xB29 },
+  { 0xB31, 0xB31 }, { 0xB34, 0xB34 }, { 0xB3A, 0xB3B }, { 0xB45, 0xB46 }, { 0xB49, 0xB4A },
+  { 0xB4E, 0xB54 }, { 0xB58, 0xB5B }, { 0xB5E, 0xB5E }, { 0xB64, 0xB65 }, { 0xB78, 0xB81 },
+  { 0xB84, 0xB84 }, { 0xB8B, 0xB8D }, { 0xB91, 0xB91 }, { 0xB96, 0xB98 }, { 0xB9B, 0xB9B },
+  { 0xB9D, 0xB9D }, { 0xBA0, 0xBA2 }, { 0xBA5, 0xBA7 }, { 0xBAB, 0xBAD }, { 0xBBA, 0xBBD },
+  { 0xBC3, 0xBC5 }, { 0xBC9, 0xBC9 }, { 0xBCE, 0xBCF }, { 0xBD1, 0xBD6 }, { 0xBD8, 0xBE5 },
+  { 0xBFB, 0xBFF }, { 0xC0D, 0xC0D }, { 0xC11, 0xC11 }, { 0xC29, 0xC29 }, { 0xC3A, 0xC3B },
+  { 0xC45, 0xC45 }, { 0xC49, 0xC49 }, { 0xC4E, 0xC54 }, { 0xC57, 0xC57 }, { 0xC5B, 0xC5C },
+  { 0xC5E, 0xC5F }, { 0xC64, 0xC65 }, { 0xC70, 0xC76 }, { 0xC8D, 0xC8D }, { 0xC91, 0xC91 },
+  { 0xCA9, 0xCA9 }, { 0xCB4, 0xCB4 }, { 0xCBA, 0xCBB }, { 0xCC5, 0xCC5 }, { 0xCC9, 0xCC9 },
+  { 0xCCE, 0xCD4 }, { 0xCD7, 0xCDC }, { 0xCDF, 0xCDF }, { 0xCE4, 0xCE5 }, { 0xCF0, 0xCF0 },
+  { 0xCF4, 0xCFF }, { 0xD0D, 0xD0D }, { 0xD11, 0xD11 }, { 0xD45, 0xD45 }, { 0xD49, 0xD49 },
+  { 0xD50, 0xD53 }, { 0xD64, 0xD65 }, { 0xD80, 0xD80 }, { 0xD84, 0xD84 }, { 0xD97, 0xD99 },
+  { 0xDB2, 0xDB2 }, { 0xDBC, 0xDBC }, { 0xDBE, 0xDBF }, { 0xDC7, 0xDC9 }, { 0xDCB, 0xDCE },
+  { 0xDD5, 0xDD5 }, { 0xDD7, 0xDD7 }, { 0xDE0, 0xDE5 }, { 0xDF0, 0xDF1 }, { 0xDF5, 0xE00 },
+  { 0xE3B, 0xE3E }, { 0xE5C, 0xE80 }, { 0xE83, 0xE83 }, { 0xE85, 0xE85 }, { 0xE8B, 0xE8B },
+  { 0xEA4, 0xEA4 }, { 0xEA6, 0xEA6 }, { 0xEBE, 0xEBF }, { 0xEC5, 0xEC5 }, { 0xEC7, 0xEC7 },
+  { 0xECF, 0xECF }, { 0xEDA, 0xEDB }, { 0xEE0, 0xEFF }, { 0xF48, 0xF48 }, { 0xF6D, 0xF70 },
+  { 0xF98, 0xF98 }, { 0xFBD, 0xFBD }, { 0xFCD, 0xFCD }, { 0xFDB, 0xFFF }, { 0x10A0, 0x10C6 },
+  { 0x10C8, 0x10CC }, { 0x10CE, 0x10CF }, { 0x115F, 0x1160 }, { 0x1249, 0x1249 },
+  { 0x124E, 0x124F }, { 0x1257, 0x1257 }, { 0x1259, 0x1259 }, { 0x125E, 0x125F },
+  { 0x1289, 0x1289 }, { 0x128E, 0x128F }, { 0x12B1, 0x12B1 }, { 0x12B6, 0x12B7 },
+  { 0x12BF, 0x12BF }, { 0x12C1, 0x12C1 }, { 0x12C6, 0x12C7 }, { 0x12D7, 0x12D7 },
+  { 0x1311, 0x1311 }, { 0x1316, 0x1317 }, { 0x135B, 0x135C }, { 0x137D, 0x137F },
+  { 0x139A, 0x139F }, { 0x13F6, 0x13F7 }, { 0x13FE, 0x13FF }, { 0x1680, 0x1680 },
+  { 0x169D, 0x169F }, { 0x16F9, 0x16FF }, { 0x1716, 0x171E }, { 0x1737, 0x173F },
+  { 0x1754, 0x175F }, { 0x176D, 0x176D }, { 0x1771, 0x1771 }, { 0x1774, 0x177F },
+  { 0x17B4, 0x17B5 }, { 0x17DE, 0x17DF }, { 0x17EA, 0x17EF }, { 0x17FA, 0x17FF },
+  { 0x1806, 0x1806 }, { 0x180E, 0x180E }, { 0x181A, 0x181F }, { 0x1879, 0x187F },
+  { 0x18AB, 0x18AF }, { 0x18F6, 0x18FF }, { 0x191F, 0x191F }, { 0x192C, 0x192F },
+  { 0x193C, 0x193F }, { 0x1941, 0x1943 }, { 0x196E, 0x196F }, { 0x1975, 0x197F },
+  { 0x19AC, 0x19AF }, { 0x19CA, 0x19CF }, { 0x19DB, 0x19DD }, { 0x1A1C, 0x1A1D },
+  { 0x1A5F, 0x1A5F }, { 0x1A7D, 0x1A7E }, { 0x1A8A, 0x1A8F }, { 0x1A9A, 0x1A9F },
+  { 0x1AAE, 0x1AAF }, { 0x1ACF, 0x1AFF }, { 0x1B4D, 0x1B4F }, { 0x1B7F, 0x1B7F },
+  { 0x1BF4, 0x1BFB }, { 0x1C38, 0x1C3A }, { 0x1C4A, 0x1C4C }, { 0x1C89, 0x1C8F },
+  { 0x1CBB, 0x1CBC }, { 0x1CC8, 0x1CCF }, { 0x1CFB, 0x1CFF }, { 0x1F16, 0x1F17 },
+  { 0x1F1E, 0x1F1F }, { 0x1F46, 0x1F47 }, { 0x1F4E, 0x1F4F }, { 0x1F58, 0x1F58 },
+  { 0x1F5A, 0x1F5A }, { 0x1F5C, 0x1F5C }, { 0x1F5E, 0x1F5E }, { 0x1F7E, 0x1F7F },
+  { 0x1FB5, 0x1FB5 }, { 0x1FC5, 0x1FC5 }, { 0x1FD4, 0x1FD5 }, { 0x1FDC, 0x1FDC },
+  { 0x1FF0, 0x1FF1 }, { 0x1FF5, 0x1FF5 }, { 0x1FFF, 0x1FFF }, { 0x200E, 0x200F },
+  { 0x2024, 0x2026 }, { 0x2028, 0x202E }, { 0x2061, 0x2063 }, { 0x2065, 0x206F },
+  { 0x2072, 0x2073 }, { 0x208F, 0x208F }, { 0x209D, 0x209F }, { 0x20C1, 0x20CF },
+  { 0x20F1, 0x20FF }, { 0x2132, 0x2132 }, { 0x2183, 0x2183 }, { 0x218C, 0x218F },
+  { 0x2427, 0x243F }, { 0x244B, 0x245F }, { 0x2488, 0x249B }, { 0x2B74, 0x2B75 },
+  { 0x2B96, 0x2B96 }, { 0x2CF4, 0x2CF8 }, { 0x2D26, 0x2D26 }, { 0x2D28, 0x2D2C },
+  { 0x2D2E, 0x2D2F }, { 0x2D68, 0x2D6E }, { 0x2D71, 0x2D7E }, { 0x2D97, 0x2D9F },
+  { 0x2DA7, 0x2DA7 }, { 0x2DAF, 0x2DAF }, { 0x2DB7, 0x2DB7 }, { 0x2DBF, 0x2DBF },
+  { 0x2DC7, 0x2DC7 }, { 0x2DCF, 0x2DCF }, { 0x2DD7, 0x2DD7 }, { 0x2DDF, 0x2DDF },
+  { 0x2E5E, 0x2E7F }, { 0x2E9A, 0x2E9A }, { 0x2EF4, 0x2EFF }, { 0x2FD6, 0x2FFF },
+  { 0x3040, 0x3040 }, { 0x3097, 0x3098 }, { 0x3100, 0x3104 }, { 0x3130, 0x3130 },
+  { 0x3164, 0x3164 }, { 0x318F, 0x318F }, { 0x31E4, 0x31EF }, { 0x321F, 0x321F },
+  { 0x33C2, 0x33C2 }, { 0x33C7, 0x33C7 }, { 0x33D8, 0x33D8 }, { 0xA48D, 0xA48F },
+  { 0xA4C7, 0xA4CF }, { 0xA62C, 0xA63F }, { 0xA6F8, 0xA6FF }, { 0xA7CB, 0xA7CF },
+  { 0xA7D2, 0xA7D2 }, { 0xA7D4, 0xA7D4 }, { 0xA7DA, 0xA7F1 }, { 0xA82D, 0xA82F },
+  { 0xA83A, 0xA83F }, { 0xA878, 0xA87F }, { 0xA8C6, 0xA8CD }, { 0xA8DA, 0xA8DF },
+  { 0xA954, 0xA95E }, { 0xA97D, 0xA97F }, { 0xA9CE, 0xA9CE }, { 0xA9DA, 0xA9DD },
+  { 0xA9FF, 0xA9FF }, { 0xAA37, 0xAA3F }, { 0xAA4E, 0xAA4F }, { 0xAA5A, 0xAA5B },
+  { 0xAAC3, 0xAADA }, { 0xAAF7, 0xAB00 }, { 0xAB07, 0xAB08 }, { 0xAB0F, 0xAB10 },
+  { 0xAB17, 0xAB1F }, { 0xAB27, 0xAB27 }, { 0xAB2F, 0xAB2F }, { 0xAB6C, 0xAB6F },
+  { 0xABEE, 0xABEF }, { 0xABFA, 0xABFF }, { 0xD7A4, 0xD7AF }, { 0xD7C7, 0xD7CA },
+  { 0xD7FC, 0xF8FF }, { 0xFA6E, 0xFA6F }, { 0xFADA, 0xFAFF }, { 0xFB07, 0xFB12 },
+  { 0xFB18, 0xFB1C }, { 0xFB37, 0xFB37 }, { 0xFB3D, 0xFB3D }, { 0xFB3F, 0xFB3F },
+  { 0xFB42, 0xFB42 }, { 0xFB45, 0xFB45 }, { 0xFBC3, 0xFBD2 }, { 0xFD90, 0xFD91 },
+  { 0xFDC8, 0xFDCE }, { 0xFDD0, 0xFDEF }, { 0xFE12, 0xFE12 }, { 0xFE19, 0xFE1F },
+  { 0xFE30, 0xFE30 }, { 0xFE52, 0xFE53 }, { 0xFE67, 0xFE67 }, { 0xFE6C, 0xFE6F },
+  { 0xFE75, 0xFE75 }, { 0xFEFD, 0xFEFE }, { 0xFF00, 0xFF00 }, { 0xFFA0, 0xFFA0 },
+  { 0xFFBF, 0xFFC1 }, { 0xFFC8, 0xFFC9 }, { 0xFFD0, 0xFFD1 }, { 0xFFD8, 0xFFD9 },
+  { 0xFFDD, 0xFFDF }, { 0xFFE7, 0xFFE7 }, { 0xFFEF, 0xFFFF }, { 0x1000C, 0x1000C },
+  { 0x10027, 0x10027 }, { 0x1003B, 0x1003B }, { 0x1003E, 0x1003E }, { 0x1004E, 0x1004F },
+  { 0x1005E, 0x1007F }, { 0x100FB, 0x100FF }, { 0x10103, 0x10106 }, { 0x10134, 0x10136 },
+  { 0x1018F, 0x1018F }, { 0x1019D, 0x1019F }, { 0x101A1, 0x101CF }, { 0x101FE, 0x1027F },
+  { 0x1029D, 0x1029F }, { 0x102D1, 0x102DF }, { 0x102FC, 0x102FF }, { 0x10324, 0x1032C },
+  { 0x1034B, 0x1034F }, { 0x1037B, 0x1037F }, { 0x1039E, 0x1039E }, { 0x103C4, 0x103C7 },
+  { 0x103D6, 0x103FF }, { 0x1049E, 0x1049F }, { 0x104AA, 0x104AF }, { 0x104D4, 0x104D7 },
+  { 0x104FC, 0x104FF }, { 0x10528, 0x1052F }, { 0x10564, 0x1056E }, { 0x1057B, 0x1057B },
+  { 0x1058B, 0x1058B }, { 0x10593, 0x10593 }, { 0x10596, 0x10596 }, { 0x105A2, 0x105A2 },
+  { 0x105B2, 0x105B2 }, { 0x105BA, 0x105BA }, { 0x105BD, 0x105FF }, { 0x10737, 0x1073F },
+  { 0x10756, 0x1075F }, { 0x10768, 0x1077F }, { 0x10786, 0x10786 }, { 0x107B1, 0x107B1 },
+  { 0x107BB, 0x107FF }, { 0x10806, 0x10807 }, { 0x10809, 0x10809 }, { 0x10836, 0x10836 },
+  { 0x10839, 0x1083B }, { 0x1083D, 0x1083E }, { 0x10856, 0x10856 }, { 0x1089F, 0x108A6 },
+  { 0x108B0, 0x108DF }, { 0x108F3, 0x108F3 }, { 0x108F6, 0x108FA }, { 0x1091C, 0x1091E },
+  { 0x1093A, 0x1093E }, { 0x10940, 0x1097F }, { 0x109B8, 0x109BB }, { 0x109D0, 0x109D1 },
+  { 0x10A04, 0x10A04 }, { 0x10A07, 0x10A0B }, { 0x10A14, 0x10A14 }, { 0x10A18, 0x10A18 },
+  { 0x10A36, 0x10A37 }, { 0x10A3B, 0x10A3E }, { 0x10A49, 0x10A4F }, { 0x10A59, 0x10A5F },
+  { 0x10AA0, 0x10ABF }, { 0x10AE7, 0x10AEA }, { 0x10AF7, 0x10AFF }, { 0x10B36, 0x10B38 },
+  { 0x10B56, 0x10B57 }, { 0x10B73, 0x10B77 }, { 0x10B92, 0x10B98 }, { 0x10B9D, 0x10BA8 },
+  { 0x10BB0, 0x10BFF }, { 0x10C49, 0x10C7F }, { 0x10CB3, 0x10CBF }, { 0x10CF3, 0x10CF9 },
+  { 0x10D28, 0x10D2F }, { 0x10D3A, 0x10E5F }, { 0x10E7F, 0x10E7F }, { 0x10EAA, 0x10EAA },
+  { 0x10EAE, 0x10EAF }, { 0x10EB2, 0x10EFC }, { 0x10F28, 0x10F2F }, { 0x10F5A, 0x10F6F },
+  { 0x10F8A, 0x10FAF }, { 0x10FCC, 0x10FDF }, { 0x10FF7, 0x10FFF }, { 0x1104E, 0x11051 },
+  { 0x11076, 0x1107E }, { 0x110BD, 0x110BD }, { 0x110C3, 0x110CF }, { 0x110E9, 0x110EF },
+  { 0x110FA, 0x110FF }, { 0x11135, 0x11135 }, { 0x11148, 0x1114F }, { 0x11177, 0x1117F },
+  { 0x111E0, 0x111E0 }, { 0x111F5, 0x111FF }, { 0x11212, 0x11212 }, { 0x11242, 0x1127F },
+  { 0x11287, 0x11287 }, { 0x11289, 0x11289 }, { 0x1128E, 0x1128E }, { 0x1129E, 0x1129E },
+  { 0x112AA, 0x112AF }, { 0x112EB, 0x112EF }, { 0x112FA, 0x112FF }, { 0x11304, 0x11304 },
+  { 0x1130D, 0x1130E }, { 0x11311, 0x11312 }, { 0x11329, 0x11329 }, { 0x11331, 0x11331 },
+  { 0x11334, 0x11334 }, { 0x1133A, 0x1133A }, { 0x11345, 0x11346 }, { 0x11349, 0x1134A },
+  { 0x1134E, 0x1134F }, { 0x11351, 0x11356 }, { 0x11358, 0x1135C }, { 0x11364, 0x11365 },
+  { 0x1136D, 0x1136F }, { 0x11375, 0x113FF }, { 0x1145C, 0x1145C }, { 0x11462, 0x1147F },
+  { 0x114C8, 0x114CF }, { 0x114DA, 0x1157F }, { 0x115B6, 0x115B7 }, { 0x115DE, 0x115FF },
+  { 0x11645, 0x1164F }, { 0x1165A, 0x1165F }, { 0x1166D, 0x1167F }, { 0x116BA, 0x116BF },
+  { 0x116CA, 0x116FF }, { 0x1171B, 0x1171C }, { 0x1172C, 0x1172F }, { 0x11747, 0x117FF },
+  { 0x1183C, 0x1189F }, { 0x118F3, 0x118FE }, { 0x11907, 0x11908 }, { 0x1190A, 0x1190B },
+  { 0x11914, 0x11914 }, { 0x11917, 0x11917 }, { 0x11936, 0x11936 }, { 0x11939, 0x1193A },
+  { 0x11947, 0x1194F }, { 0x1195A, 0x1199F }, { 0x119A8, 0x119A9 }, { 0x119D8, 0x119D9 },
+  { 0x119E5, 0x119FF }, { 0x11A48, 0x11A4F }, { 0x11AA3, 0x11AAF }, { 0x11AF9, 0x11AFF },
+  { 0x11B0A, 0x11BFF }, { 0x11C09, 0x11C09 }, { 0x11C37, 0x11C37 }, { 0x11C46, 0x11C4F },
+  { 0x11C6D, 0x11C6F }, { 0x11C90, 0x11C91 }, { 0x11CA8, 0x11CA8 }, { 0x11CB7, 0x11CFF },
+  { 0x11D07, 0x11D07 }, { 0x11D0A, 0x11D0A }, { 0x11D37, 0x11D39 }, { 0x11D3B, 0x11D3B },
+  { 0x11D3E, 0x11D3E }, { 0x11D48, 0x11D4F }, { 0x11D5A, 0x11D5F }, { 0x11D66, 0x11D66 },
+  { 0x11D69, 0x11D69 }, { 0x11D8F, 0x11D8F }, { 0x11D92, 0x11D92 }, { 0x11D99, 0x11D9F },
+  { 0x11DAA, 0x11EDF }, { 0x11EF9, 0x11EFF }, { 0x11F11, 0x11F11 }, { 0x11F3B, 0x11F3D },
+  { 0x11F5A, 0x11FAF }, { 0x11FB1, 0x11FBF }, { 0x11FF2, 0x11FFE }, { 0x1239A, 0x123FF },
+  { 0x1246F, 0x1246F }, { 0x12475, 0x1247F }, { 0x12544, 0x12F8F }, { 0x12FF3, 0x12FFF },
+  { 0x13430, 0x1343F }, { 0x13456, 0x143FF }, { 0x14647, 0x167FF }, { 0x16A39, 0x16A3F },
+  { 0x16A5F, 0x16A5F }, { 0x16A6A, 0x16A6D }, { 0x16ABF, 0x16ABF }, { 0x16ACA, 0x16ACF },
+  { 0x16AEE, 0x16AEF }, { 0x16AF6, 0x16AFF }, { 0x16B46, 0x16B4F }, { 0x16B5A, 0x16B5A },
+  { 0x16B62, 0x16B62 }, { 0x16B78, 0x16B7C }, { 0x16B90, 0x16E3F }, { 0x16E9B, 0x16EFF },
+  { 0x16F4B, 0x16F4E }, { 0x16F88, 0x16F8E }, { 0x16FA0, 0x16FDF }, { 0x16FE5, 0x16FEF },
+  { 0x16FF2, 0x16FFF }, { 0x187F8, 0x187FF }, { 0x18CD6, 0x18CFF }, { 0x18D09, 0x1AFEF },
+  { 0x1AFF4, 0x1AFF4 }, { 0x1AFFC, 0x1AFFC }, { 0x1AFFF, 0x1AFFF }, { 0x1B123, 0x1B131 },
+  { 0x1B133, 0x1B14F }, { 0x1B153, 0x1B154 }, { 0x1B156, 0x1B163 }, { 0x1B168, 0x1B16F },
+  { 0x1B2FC, 0x1BBFF }, { 0x1BC6B, 0x1BC6F }, { 0x1BC7D, 0x1BC7F }, { 0x1BC89, 0x1BC8F },
+  { 0x1BC9A, 0x1BC9B }, { 0x1BCA4, 0x1CEFF }, { 0x1CF2E, 0x1CF2F }, { 0x1CF47, 0x1CF4F },
+  { 0x1CFC4, 0x1CFFF }, { 0x1D0F6, 0x1D0FF }, { 0x1D127, 0x1D128 }, { 0x1D173, 0x1D17A },
+  { 0x1D1EB, 0x1D1FF }, { 0x1D246, 0x1D2BF }, { 0x1D2D4, 0x1D2DF }, { 0x1D2F4, 0x1D2FF },
+  { 0x1D357, 0x1D35F }, { 0x1D379, 0x1D3FF }, { 0x1D455, 0x1D455 }, { 0x1D49D, 0x1D49D },
+  { 0x1D4A0, 0x1D4A1 }, { 0x1D4A3, 0x1D4A4 }, { 0x1D4A7, 0x1D4A8 }, { 0x1D4AD, 0x1D4AD },
+  { 0x1D4BA, 0x1D4BA }, { 0x1D4BC, 0x1D4BC }, { 0x1D4C4, 0x1D4C4 }, { 0x1D506, 0x1D506 },
+  { 0x1D50B, 0x1D50C }, { 0x1D515, 0x1D515 }, { 0x1D51D, 0x1D51D }, { 0x1D53A, 0x1D53A },
+  { 0x1D53F, 0x1D53F }, { 0x1D545, 0x1D545 }, { 0x1D547, 0x1D549 }, { 0x1D551, 0x1D551 },
+  { 0x1D6A6, 0x1D6A7 }, { 0x1D7CC, 0x1D7CD }, { 0x1DA8C, 0x1DA9A }, { 0x1DAA0, 0x1DAA0 },
+  { 0x1DAB0, 0x1DEFF }, { 0x1DF1F, 0x1DF24 }, { 0x1DF2B, 0x1DFFF }, { 0x1E007, 0x1E007 },
+  { 0x1E019, 0x1E01A }, { 0x1E022, 0x1E022 }, { 0x1E025, 0x1E025 }, { 0x1E02B, 0x1E02F },
+  { 0x1E06E, 0x1E08E }, { 0x1E090, 0x1E0FF }, { 0x1E12D, 0x1E12F }, { 0x1E13E, 0x1E13F },
+  { 0x1E14A, 0x1E14D }, { 0x1E150, 0x1E28F }, { 0x1E2AF, 0x1E2BF }, { 0x1E2FA, 0x1E2FE },
+  { 0x1E300, 0x1E4CF }, { 0x1E4FA, 0x1E7DF }, { 0x1E7E7, 0x1E7E7 }, { 0x1E7EC, 0x1E7EC },
+  { 0x1E7EF, 0x1E7EF }, { 0x1E7FF, 0x1E7FF }, { 0x1E8C5, 0x1E8C6 }, { 0x1E8D7, 0x1E8FF },
+  { 0x1E94C, 0x1E94F }, { 0x1E95A, 0x1E95D }, { 0x1E960, 0x1EC70 }, { 0x1ECB5, 0x1ED00 },
+  { 0x1ED3E, 0x1EDFF }, { 0x1EE04, 0x1EE04 }, { 0x1EE20, 0x1EE20 }, { 0x1EE23, 0x1EE23 },
+  { 0x1EE25, 0x1EE26 }, { 0x1EE28, 0x1EE28 }, { 0x1EE33, 0x1EE33 }, { 0x1EE38, 0x1EE38 },
+  { 0x1EE3A, 0x1EE3A }, { 0x1EE3C, 0x1EE41 }, { 0x1EE43, 0x1EE46 }, { 0x1EE48, 0x1EE48 },
+  { 0x1EE4A, 0x1EE4A }, { 0x1EE4C, 0x1EE4C }, { 0x1EE50, 0x1EE50 }, { 0x1EE53, 0x1EE53 },
+  { 0x1EE55, 0x1EE56 }, { 0x1EE58, 0x1EE58 }, { 0x1EE5A, 0x1EE5A }, { 0x1EE5C, 0x1EE5C },
+  { 0x1EE5E, 0x1EE5E }, { 0x1EE60, 0x1EE60 }, { 0x1EE63, 0x1EE63 }, { 0x1EE65, 0x1EE66 },
+  { 0x1EE6B, 0x1EE6B }, { 0x1EE73, 0x1EE73 }, { 0x1EE78, 0x1EE78 }, { 0x1EE7D, 0x1EE7D },
+  { 0x1EE7F, 0x1EE7F }, { 0x1EE8A, 0x1EE8A }, { 0x1EE9C, 0x1EEA0 }, { 0x1EEA4, 0x1EEA4 },
+  { 0x1EEAA, 0x1EEAA }, { 0x1EEBC, 0x1EEEF }, { 0x1EEF2, 0x1EFFF }, { 0x1F02C, 0x1F02F },
+  { 0x1F094, 0x1F09F }, { 0x1F0AF, 0x1F0B0 }, { 0x1F0C0, 0x1F0C0 }, { 0x1F0D0, 0x1F0D0 },
+  { 0x1F0F6, 0x1F100 }, { 0x1F1AE, 0x1F1E5 }, { 0x1F203, 0x1F20F }, { 0x1F23C, 0x1F23F },
+  { 0x1F249, 0x1F24F }, { 0x1F252, 0x1F25F }, { 0x1F266, 0x1F2FF }, { 0x1F6D8, 0x1F6DB },
+  { 0x1F6ED, 0x1F6EF }, { 0x1F6FD, 0x1F6FF }, { 0x1F777, 0x1F77A }, { 0x1F7DA, 0x1F7DF },
+  { 0x1F7EC, 0x1F7EF }, { 0x1F7F1, 0x1F7FF }, { 0x1F80C, 0x1F80F }, { 0x1F848, 0x1F84F },
+  { 0x1F85A, 0x1F85F }, { 0x1F888, 0x1F88F }, { 0x1F8AE, 0x1F8AF }, { 0x1F8B2, 0x1F8FF },
+  { 0x1FA54, 0x1FA5F }, { 0x1FA6E, 0x1FA6F }, { 0x1FA7D, 0x1FA7F }, { 0x1FA89, 0x1FA8F },
+  { 0x1FABE, 0x1FABE }, { 0x1FAC6, 0x1FACD }, { 0x1FADC, 0x1FADF }, { 0x1FAE9, 0x1FAEF },
+  { 0x1FAF9, 0x1FAFF }, { 0x1FB93, 0x1FB93 }, { 0x1FBCB, 0x1FBEF }, { 0x1FBFA, 0x1FFFF },
+  { 0x2A6E0, 0x2A6FF }, { 0x2B73A, 0x2B73F }, { 0x2B81E, 0x2B81F }, { 0x2CEA2, 0x2CEAF },
+  { 0x2EBE1, 0x2EBEF }, { 0x2EE5E, 0x2F7FF }, { 0x2F868, 0x2F868 }, { 0x2F874, 0x2F874 },
+  { 0x2F91F, 0x2F91F }, { 0x2F95F, 0x2F95F }, { 0x2F9BF, 0x2F9BF }, { 0x2FA1E, 0x2FFFF },
+  { 0x3134B, 0x3134F }, { 0x323B0, 0xE00FF }, { 0xE01F0, 0x10FFFF },
+};
+
+/** These are the marks, which may not start a label, of the valid code points */
+inline constexpr Range MARKS[] = {
+  { 0x300, 0x33F }, { 0x342, 0x342 }, { 0x346, 0x34E }, { 0x350, 0x36F }, { 0x483, 0x489 },
+  { 0x591, 0x5BD }, { 0x5BF, 0x5BF }, { 0x5C1, 0x5C2 }, { 0x5C4, 0x5C5 }, { 0x5C7, 0x5C7 },
+  { 0x610, 0x61A }, { 0x64B, 0x65F }, { 0x670, 0x670 }, { 0x6D6, 0x6DC }, { 0x6DF, 0x6E4 },
+  { 0x6E7, 0x6E8 }, { 0x6EA, 0x6ED }, { 0x711, 0x711 }, { 0x730, 0x74A }, { 0x7A6, 0x7B0 },
+  { 0x7EB, 0x7F3 }, { 0x7FD, 0x7FD }, { 0x816, 0x819 }, { 0x81B, 0x823 }, { 0x825, 0x827 },
+  { 0x829, 0x82D }, { 0x859, 0x85B }, { 0x898, 0x89F }, { 0x8CA, 0x8E1 }, { 0x8E3, 0x903 },
+  { 0x93A, 0x93C }, { 0x93E, 0x94F }, { 0x951, 0x957 }, { 0x962, 0x963 }, { 0x981, 0x983 },
+  { 0x9BC, 0x9BC }, { 0x9BE, 0x9C4 }, { 0x9C7, 0x9C8 }, { 0x9CB, 0x9CD }, { 0x9D7, 0x9D7 },
+  { 0x9E2, 0x9E3 }, { 0x9FE, 0x9FE }, { 0xA01, 0xA03 }, { 0xA3C, 0xA3C }, { 0xA3E, 0xA42 },
+  { 0xA47, 0xA48 }, { 0xA4B, 0xA4D }, { 0xA51, 0xA51 }, { 0xA70, 0xA71 }, { 0xA75, 0xA75 },
+  { 0xA81, 0xA83 }, { 0xABC, 0xABC }, { 0xABE, 0xAC5 }, { 0xAC7, 0xAC9 }, { 0xACB, 0xACD },
+  { 0xAE2, 0xAE3 }, { 0xAFA, 0xAFF }, { 0xB01, 0xB03 }, { 0xB3C, 0xB3C }, { 0xB3E, 0xB44 },
+  { 0xB47, 0xB48 }, { 0xB4B, 0xB4D }, { 0xB55, 0xB57 }, { 0xB62, 0xB63 }, { 0xB82, 0xB82 },
+  { 0xBBE, 0xBC2 }, { 0xBC6, 0xBC8 }, { 0xBCA, 0xBCD }, { 0xBD7, 0xBD7 }, { 0xC00, 0xC04 },
+  { 0xC3C, 0xC3C }, { 0xC3E, 0xC44 }, { 0xC46, 0xC48 }, { 0xC4A, 0xC4D }, { 0xC55, 0xC56 },
+  { 0xC62, 0xC63 }, { 0xC81, 0xC83 }, { 0xCBC, 0xCBC }, { 0xCBE, 0xCC4 }, { 0xCC6, 0xCC8 },
+  { 0xCCA, 0xCCD }, { 0xCD5, 0xCD6 }, { 0xCE2, 0xCE3 }, { 0xCF3, 0xCF3 }, { 0xD00, 0xD03 },
+  { 0xD3B, 0xD3C }, { 0xD3E, 0xD44 }, { 0xD46, 0xD48 }, { 0xD4A, 0xD4D }, { 0xD57, 0xD57 },
+  { 0xD62, 0xD63 }, { 0xD81, 0xD83 }, { 0xDCA, 0xDCA }, { 0xDCF, 0xDD4 }, { 0xDD6, 0xDD6 },
+  { 0xDD8, 0xDDF }, { 0xDF2, 0xDF3 }, { 0xE31, 0xE31 }, { 0xE34, 0xE3A }, { 0xE47, 0xE4E },
+  { 0xEB1, 0xEB1 }, { 0xEB4, 0xEBC }, { 0xEC8, 0xECE }, { 0xF18, 0xF19 }, { 0xF35, 0xF35 },
+  { 0xF37, 0xF37 }, { 0xF39, 0xF39 }, { 0xF3E, 0xF3F }, { 0xF71, 0xF72 }, { 0xF74, 0xF74 },
+  { 0xF7A, 0xF80 }, { 0xF82, 0xF84 }, { 0xF86, 0xF87 }, { 0xF8D, 0xF92 }, { 0xF94, 0xF97 },
+  { 0xF99, 0xF9C }, { 0xF9E, 0xFA1 }, { 0xFA3, 0xFA6 }, { 0xFA8, 0xFAB }, { 0xFAD, 0xFB8 },
+  { 0xFBA, 0xFBC }, { 0xFC6, 0xFC6 }, { 0x102B, 0x103E }, { 0x1056, 0x1059 }, { 0x105E, 0x1060 },
+  { 0x1062, 0x1064 }, { 0x1067, 0x106D }, { 0x1071, 0x1074 }, { 0x1082, 0x108D },
+  { 0x108F, 0x108F }, { 0x109A, 0x109D }, { 0x135D, 0x135F }, { 0x1712, 0x1715 },
+  { 0x1732, 0x1734 }, { 0x1752, 0x1753 }, { 0x1772, 0x1773 }, { 0x17B6, 0x17D3 },
+  { 0x17DD, 0x17DD }, { 0x1885, 0x1886 }, { 0x18A9, 0x18A9 }, { 0x1920, 0x192B },
+  { 0x1930, 0x193B }, { 0x1A17, 0x1A1B }, { 0x1A55, 0x1A5E }, { 0x1A60, 0x1A7C },
+  { 0x1A7F, 0x1A7F }, { 0x1AB0, 0x1ACE }, { 0x1B00, 0x1B04 }, { 0x1B34, 0x1B44 },
+  { 0x1B6B, 0x1B73 }, { 0x1B80, 0x1B82 }, { 0x1BA1, 0x1BAD }, { 0x1BE6, 0x1BF3 },
+  { 0x1C24, 0x1C37 }, { 0x1CD0, 0x1CD2 }, { 0x1CD4, 0x1CE8 }, { 0x1CED, 0x1CED },
+  { 0x1CF4, 0x1CF4 }, { 0x1CF7, 0x1CF9 }, { 0x1DC0, 0x1DFF }, { 0x20D0, 0x20F0 },
+  { 0x2CEF, 0x2CF1 }, { 0x2D7F, 0x2D7F }, { 0x2DE0, 0x2DFF }, { 0x302A, 0x302F },
+  { 0x3099, 0x309A }, { 0xA66F, 0xA672 }, { 0xA674, 0xA67D }, { 0xA69E, 0xA69F },
+  { 0xA6F0, 0xA6F1 }, { 0xA802, 0xA802 }, { 0xA806, 0xA806 }, { 0xA80B, 0xA80B },
+  { 0xA823, 0xA827 }, { 0xA82C, 0xA82C }, { 0xA880, 0xA881 }, { 0xA8B4, 0xA8C5 },
+  { 0xA8E0, 0xA8F1 }, { 0xA8FF, 0xA8FF }, { 0xA926, 0xA92D }, { 0xA947, 0xA953 },
+  { 0xA980, 0xA983 }, { 0xA9B3, 0xA9C0 }, { 0xA9E5, 0xA9E5 }, { 0xAA29, 0xAA36 },
+  { 0xAA43, 0xAA43 }, { 0xAA4C, 0xAA4D }, { 0xAA7B, 0xAA7D }, { 0xAAB0, 0xAAB0 },
+  { 0xAAB2, 0xAAB4 }, { 0xAAB7, 0xAAB8 }, { 0xAABE, 0xAABF }, { 0xAAC1, 0xAAC1 },
+  { 0xAAEB, 0xAAEF }, { 0xAAF5, 0xAAF6 }, { 0xABE3, 0xABEA }, { 0xABEC, 0xABED },
+  { 0xFB1E, 0xFB1E }, { 0xFE20, 0xFE2F }, { 0x101FD, 0x101FD }, { 0x102E0, 0x102E0 },
+  { 0x10376, 0x1037A }, { 0x10A01, 0x10A03 }, { 0x10A05, 0x10A06 }, { 0x10A0C, 0x10A0F },
+  { 0x10A38, 0x10A3A }, { 0x10A3F, 0x10A3F }, { 0x10AE5, 0x10AE6 }, { 0x10D24, 0x10D27 },
+  { 0x10EAB, 0x10EAC }, { 0x10EFD, 0x10EFF }, { 0x10F46, 0x10F50 }, { 0x10F82, 0x10F85 },
+  { 0x11000, 0x11002 }, { 0x11038, 0x11046 }, { 0x11070, 0x11070 }, { 0x11073, 0x11074 },
+  { 0x1107F, 0x11082 }, { 0x110B0, 0x110BA }, { 0x110C2, 0x110C2 }, { 0x11100, 0x11102 },
+  { 0x11127, 0x11134 }, { 0x11145, 0x11146 }, { 0x11173, 0x11173 }, { 0x11180, 0x11182 },
+  { 0x111B3, 0x111C0 }, { 0x111C9, 0x111CC }, { 0x111CE, 0x111CF }, { 0x1122C, 0x11237 },
+  { 0x1123E, 0x1123E }, { 0x11241, 0x11241 }, { 0x112DF, 0x112EA }, { 0x11300, 0x11303 },
+  { 0x1133B, 0x1133C }, { 0x1133E, 0x11344 }, { 0x11347, 0x11348 }, { 0x1134B, 0x1134D },
+  { 0x11357, 0x11357 }, { 0x11362, 0x11363 }, { 0x11366, 0x1136C }, { 0x11370, 0x11374 },
+  { 0x11435, 0x11446 }, { 0x1145E, 0x1145E }, { 0x114B0, 0x114C3 }, { 0x115AF, 0x115B5 },
+  { 0x115B8, 0x115C0 }, { 0x115DC, 0x115DD }, { 0x11630, 0x11640 }, { 0x116AB, 0x116B7 },
+  { 0x1171D, 0x1172B }, { 0x1182C, 0x1183A }, { 0x11930, 0x11935 }, { 0x11937, 0x11938 },
+  { 0x1193B, 0x1193E }, { 0x11940, 0x11940 }, { 0x11942, 0x11943 }, { 0x119D1, 0x119D7 },
+  { 0x119DA, 0x119E0 }, { 0x119E4, 0x119E4 }, { 0x11A01, 0x11A0A }, { 0x11A33, 0x11A39 },
+  { 0x11A3B, 0x11A3E }, { 0x11A47, 0x11A47 }, { 0x11A51, 0x11A5B }, { 0x11A8A, 0x11A99 },
+  { 0x11C2F, 0x11C36 }, { 0x11C38, 0x11C3F }, { 0x11C92, 0x11CA7 }, { 0x11CA9, 0x11CB6 },
+  { 0x11D31, 0x11D36 }, { 0x11D3A, 0x11D3A }, { 0x11D3C, 0x11D3D }, { 0x11D3F, 0x11D45 },
+  { 0x11D47, 0x11D47 }, { 0x11D8A, 0x11D8E }, { 0x11D90, 0x11D91 }, { 0x11D93, 0x11D97 },
+  { 0x11EF3, 0x11EF6 }, { 0x11F00, 0x11F01 }, { 0x11F03, 0x11F03 }, { 0x11F34, 0x11F3A },
+  { 0x11F3E, 0x11F42 }, { 0x13440, 0x13440 }, { 0x13447, 0x13455 }, { 0x16AF0, 0x16AF4 },
+  { 0x16B30, 0x16B36 }, { 0x16F4F, 0x16F4F }, { 0x16F51, 0x16F87 }, { 0x16F8F, 0x16F92 },
+  { 0x16FE4, 0x16FE4 }, { 0x16FF0, 0x16FF1 }, { 0x1BC9D, 0x1BC9E }, { 0x1CF00, 0x1CF2D },
+  { 0x1CF30, 0x1CF46 }, { 0x1D165, 0x1D169 }, { 0x1D16D, 0x1D172 }, { 0x1D17B, 0x1D182 },
+  { 0x1D185, 0x1D18B }, { 0x1D1AA, 0x1D1AD }, { 0x1D242, 0x1D244 }, { 0x1DA00, 0x1DA36 },
+  { 0x1DA3B, 0x1DA6C }, { 0x1DA75, 0x1DA75 }, { 0x1DA84, 0x1DA84 }, { 0x1DA9B, 0x1DA9F },
+  { 0x1DAA1, 0x1DAAF }, { 0x1E000, 0x1E006 }, { 0x1E008, 0x1E018 }, { 0x1E01B, 0x1E021 },
+  { 0x1E023, 0x1E024 }, { 0x1E026, 0x1E02A }, { 0x1E08F, 0x1E08F }, { 0x1E130, 0x1E136 },
+  { 0x1E2AE, 0x1E2AE }, { 0x1E2EC, 0x1E2EF }, { 0x1E4EC, 0x1E4EF }, { 0x1E8D0, 0x1E8D6 },
+  { 0x1E944, 0x1E94A },
+};
+
+/** These are the mappings of code points mapped to one */
+inline constexpr Run RUNS[] = {
+  { 0x41, 26, 1, 32 }, { 0xA0, 1, 1, -128 }, { 0xAA, 1, 1, -73 }, { 0xB2, 2, 1, -128 },
+  { 0xB5, 1, 1, 775 }, { 0xB9, 1, 1, -136 }, { 0xBA, 1, 1, -75 }, { 0xC0, 23, 1, 32 },
+  { 0xD8, 7, 1, 32 }, { 0x100, 24, 2, 1 }, { 0x134, 2, 2, 1 }, { 0x139, 3, 2, 1 },
+  { 0x141, 4, 2, 1 }, { 0x14A, 23, 2, 1 }, { 0x178, 1, 1, -121 }, { 0x179, 3, 2, 1 },
+  { 0x17F, 1, 1, -268 }, { 0x181, 1, 1, 210 }, { 0x182, 2, 2, 1 }, { 0x186, 1, 1, 206 },
+  { 0x187, 1, 1, 1 }, { 0x189, 2, 1, 205 }, { 0x18B, 1, 1, 1 }, { 0x18E, 1, 1, 79 },
+  { 0x18F, 1, 1, 202 }, { 0x190, 1, 1, 203 }, { 0x191, 1, 1, 1 }, { 0x193, 1, 1, 205 },
+  { 0x194, 1, 1, 207 }, { 0x196, 1, 1, 211 }, { 0x197, 1, 1, 209 }, { 0x198, 1, 1, 1 },
+  { 0x19C, 1, 1, 211 }, { 0x19D, 1, 1, 213 }, { 0x19F, 1, 1, 214 }, { 0x1A0, 3, 2, 1 },
+  { 0x1A6, 1, 1, 218 }, { 0x1A7, 1, 1, 1 }, { 0x1A9, 1, 1, 218 }, { 0x1AC, 1, 1, 1 },
+  { 0x1AE, 1, 1, 218 }, { 0x1AF, 1, 1, 1 }, { 0x1B1, 2, 1, 217 }, { 0x1B3, 2, 2, 1 },
+  { 0x1B7, 1, 1, 219 }, { 0x1B8, 1, 1, 1 }, { 0x1BC, 1, 1, 1 }, { 0x1CD, 8, 2, 1 },
+  { 0x1DE, 9, 2, 1 }, { 0x1F4, 1, 1, 1 }, { 0x1F6, 1, 1, -97 }, { 0x1F7, 1, 1, -56 },
+  { 0x1F8, 20, 2, 1 }, { 0x220, 1, 1, -130 }, { 0x222, 9, 2, 1 }, { 0x23A, 1, 1, 10795 },
+  { 0x23B, 1, 1, 1 }, { 0x23D, 1, 1, -163 }, { 0x23E, 1, 1, 10792 }, { 0x241, 1, 1, 1 },
+  { 0x243, 1, 1, -195 }, { 0x244, 1, 1, 69 }, { 0x245, 1, 1, 71 }, { 0x246, 5, 2, 1 },
+  { 0x2B0, 1, 1, -584 }, { 0x2B1, 1, 1, -75 }, { 0x2B2, 1, 1, -584 }, { 0x2B3, 1, 1, -577 },
+  { 0x2B4, 1, 1, -59 }, { 0x2B5, 1, 1, -58 }, { 0x2B6, 1, 1, -53 }, { 0x2B7, 1, 1, -576 },
+  { 0x2B8, 1, 1, -575 }, { 0x2E0, 1, 1, -125 }, { 0x2E1, 1, 1, -629 }, { 0x2E2, 1, 1, -623 },
+  { 0x2E3, 1, 1, -619 }, { 0x2E4, 1, 1, -79 }, { 0x340, 2, 1, -64 }, { 0x343, 1, 1, -48 },
+  { 0x345, 1, 1, 116 }, { 0x370, 2, 2, 1 }, { 0x374, 1, 1, -187 }, { 0x376, 1, 1, 1 },
+  { 0x37E, 1, 1, -835 }, { 0x37F, 1, 1, 116 }, { 0x386, 1, 1, 38 }, { 0x387, 1, 1, -720 },
+  { 0x388, 3, 1, 37 }, { 0x38C, 1, 1, 64 }, { 0x38E, 2, 1, 63 }, { 0x391, 17, 1, 32 },
+  { 0x3A3, 9, 1, 32 }, { 0x3CF, 1, 1, 8 }, { 0x3D0, 1, 1, -30 }, { 0x3D1, 1, 1, -25 },
+  { 0x3D2, 1, 1, -13 }, { 0x3D3, 1, 1, -6 }, { 0x3D4, 1, 1, -9 }, { 0x3D5, 1, 1, -15 },
+  { 0x3D6, 1, 1, -22 }, { 0x3D8, 12, 2, 1 }, { 0x3F0, 1, 1, -54 }, { 0x3F1, 1, 1, -48 },
+  { 0x3F2, 1, 1, -47 }, { 0x3F4, 1, 1, -60 }, { 0x3F5, 1, 1, -64 }, { 0x3F7, 1, 1, 1 },
+  { 0x3F9, 1, 1, -54 }, { 0x3FA, 1, 1, 1 }, { 0x3FD, 3, 1, -130 }, { 0x400, 16, 1, 80 },
+  { 0x410, 32, 1, 32 }, { 0x460, 17, 2, 1 }, { 0x48A, 27, 2, 1 }, { 0x4C1, 7, 2, 1 },
+  { 0x4D0, 48, 2, 1 }, { 0x531, 38, 1, 48 }, { 0xF0C, 1, 1, -1 }, { 0x10C7, 1, 1, 7264 },
+  { 0x10CD, 1, 1, 7264 }, { 0x10FC, 1, 1, -32 }, { 0x13F8, 6, 1, -8 }, { 0x1C80, 1, 1, -6222 },
+  { 0x1C81, 1, 1, -6221 }, { 0x1C82, 1, 1, -6212 }, { 0x1C83, 2, 1, -6210 },
+  { 0x1C85, 1, 1, -6211 }, { 0x1C86, 1, 1, -6204 }, { 0x1C87, 1, 1, -6180 },
+  { 0x1C88, 1, 1, 35267 }, { 0x1C90, 43, 1, -3008 }, { 0x1CBD, 3, 1, -3008 },
+  { 0x1D2C, 1, 1, -7371 }, { 0x1D2D, 1, 1, -7239 }, { 0x1D2E, 2, 2, -7372 },
+  { 0x1D31, 1, 1, -7372 }, { 0x1D32, 1, 1, -6997 }, { 0x1D33, 8, 1, -7372 },
+  { 0x1D3C, 1, 1, -7373 }, { 0x1D3D, 1, 1, -6938 }, { 0x1D3E, 1, 1, -7374 },
+  { 0x1D3F, 1, 1, -7373 }, { 0x1D40, 2, 1, -7372 }, { 0x1D42, 1, 1, -7371 },
+  { 0x1D43, 1, 1, -7394 }, { 0x1D44, 2, 1, -6900 }, { 0x1D46, 1, 1, -68 }, { 0x1D47, 1, 1, -7397 },
+  { 0x1D48, 2, 1, -7396 }, { 0x1D4A, 1, 1, -6897 }, { 0x1D4B, 2, 1, -6896 },
+  { 0x1D4D, 1, 1, -7398 }, { 0x1D4F, 1, 1, -7396 }, { 0x1D50, 1, 1, -7395 },
+  { 0x1D51, 1, 1, -7174 }, { 0x1D52, 1, 1, -7395 }, { 0x1D53, 1, 1, -6911 }, { 0x1D54, 2, 1, -62 },
+  { 0x1D56, 1, 1, -7398 }, { 0x1D57, 2, 1, -7395 }, { 0x1D59, 1, 1, -60 }, { 0x1D5A, 1, 1, -6891 },
+  { 0x1D5B, 1, 1, -7397 }, { 0x1D5C, 1, 1, -55 }, { 0x1D5D, 3, 1, -6571 }, { 0x1D60, 2, 1, -6554 },
+  { 0x1D62, 1, 1, -7417 }, { 0x1D63, 1, 1, -7409 }, { 0x1D64, 2, 1, -7407 },
+  { 0x1D66, 2, 1, -6580 }, { 0x1D68, 1, 1, -6567 }, { 0x1D69, 2, 1, -6563 },
+  { 0x1D78, 1, 1, -6459 }, { 0x1D9B, 1, 1, -6985 }, { 0x1D9C, 1, 1, -7481 },
+  { 0x1D9D, 1, 1, -6984 }, { 0x1D9E, 1, 1, -7342 }, { 0x1D9F, 1, 1, -6979 },
+  { 0x1DA0, 1, 1, -7482 }, { 0x1DA1, 1, 1, -6978 }, { 0x1DA2, 1, 1, -6977 },
+  { 0x1DA3, 1, 1, -6974 }, { 0x1DA4, 3, 1, -6972 }, { 0x1DA7, 1, 1, -44 }, { 0x1DA8, 1, 1, -6923 },
+  { 0x1DA9, 1, 1, -6972 }, { 0x1DAA, 1, 1, -37 }, { 0x1DAB, 1, 1, -6924 }, { 0x1DAC, 1, 1, -6971 },
+  { 0x1DAD, 1, 1, -6973 }, { 0x1DAE, 4, 1, -6972 }, { 0x1DB2, 1, 1, -6970 },
+  { 0x1DB3, 2, 1, -6961 }, { 0x1DB5, 1, 1, -7178 }, { 0x1DB6, 2, 1, -6957 }, { 0x1DB8, 1, 1, -156 },
+  { 0x1DB9, 2, 1, -6958 }, { 0x1DBB, 1, 1, -7489 }, { 0x1DBC, 3, 1, -6956 },
+  { 0x1DBF, 1, 1, -6663 }, { 0x1E00, 75, 2, 1 }, { 0x1E9B, 1, 1, -58 }, { 0x1E9E, 1, 1, -7615 },
+  { 0x1EA0, 48, 2, 1 }, { 0x1F08, 8, 1, -8 }, { 0x1F18, 6, 1, -8 }, { 0x1F28, 8, 1, -8 },
+  { 0x1F38, 8, 1, -8 }, { 0x1F48, 6, 1, -8 }, { 0x1F59, 4, 2, -8 }, { 0x1F68, 8, 1, -8 },
+  { 0x1F71, 1, 1, -7109 }, { 0x1F73, 1, 1, -7110 }, { 0x1F75, 1, 1, -7111 },
+  { 0x1F77, 1, 1, -7112 }, { 0x1F79, 1, 1, -7085 }, { 0x1F7B, 1, 1, -7086 },
+  { 0x1F7D, 1, 1, -7087 }, { 0x1FB8, 2, 1, -8 }, { 0x1FBA, 1, 1, -74 }, { 0x1FBB, 1, 1, -7183 },
+  { 0x1FBE, 1, 1, -7173 }, { 0x1FC8, 1, 1, -86 }, { 0x1FC9, 1, 1, -7196 }, { 0x1FCA, 1, 1, -86 },
+  { 0x1FCB, 1, 1, -7197 }, { 0x1FD3, 1, 1, -7235 }, { 0x1FD8, 2, 1, -8 }, { 0x1FDA, 1, 1, -100 },
+  { 0x1FDB, 1, 1, -7212 }, { 0x1FE3, 1, 1, -7219 }, { 0x1FE8, 2, 1, -8 }, { 0x1FEA, 1, 1, -112 },
+  { 0x1FEB, 1, 1, -7198 }, { 0x1FEC, 1, 1, -7 }, { 0x1FEF, 1, 1, -8079 }, { 0x1FF8, 1, 1, -128 },
+  { 0x1FF9, 1, 1, -7213 }, { 0x1FFA, 1, 1, -126 }, { 0x1FFB, 1, 1, -7213 }, { 0x2000, 1, 1, -8160 },
+  { 0x2001, 1, 1, -8161 }, { 0x2002, 1, 1, -8162 }, { 0x2003, 1, 1, -8163 },
+  { 0x2004, 1, 1, -8164 }, { 0x2005, 1, 1, -8165 }, { 0x2006, 1, 1, -8166 },
+  { 0x2007, 1, 1, -8167 }, { 0x2008, 1, 1, -8168 }, { 0x2009, 1, 1, -8169 },
+  { 0x200A, 1, 1, -8170 }, { 0x2011, 1, 1, -1 }, { 0x202F, 1, 1, -8207 }, { 0x205F, 1, 1, -8255 },
+  { 0x2070, 1, 1, -8256 }, { 0x2071, 1, 1, -8200 }, { 0x2074, 6, 1, -8256 },
+  { 0x207A, 1, 1, -8271 }, { 0x207B, 1, 1, 407 }, { 0x207C, 1, 1, -8255 }, { 0x207D, 2, 1, -8277 },
+  { 0x207F, 1, 1, -8209 }, { 0x2080, 10, 1, -8272 }, { 0x208A, 1, 1, -8287 }, { 0x208B, 1, 1, 391 },
+  { 0x208C, 1, 1, -8271 }, { 0x208D, 2, 1, -8293 }, { 0x2090, 1, 1, -8239 },
+  { 0x2091, 1, 1, -8236 }, { 0x2092, 1, 1, -8227 }, { 0x2093, 1, 1, -8219 },
+  { 0x2094, 1, 1, -7739 }, { 0x2095, 1, 1, -8237 }, { 0x2096, 4, 1, -8235 },
+  { 0x209A, 1, 1, -8234 }, { 0x209B, 2, 1, -8232 }, { 0x2102, 1, 1, -8351 },
+  { 0x2107, 1, 1, -7852 }, { 0x210A, 2, 1, -8355 }, { 0x210C, 1, 1, -8356 },
+  { 0x210D, 1, 1, -8357 }, { 0x210E, 1, 1, -8358 }, { 0x210F, 1, 1, -8168 },
+  { 0x2110, 1, 1, -8359 }, { 0x2111, 1, 1, -8360 }, { 0x2112, 1, 1, -8358 },
+  { 0x2113, 2, 2, -8359 }, { 0x2119, 3, 1, -8361 }, { 0x211C, 1, 1, -8362 },
+  { 0x211D, 1, 1, -8363 }, { 0x2124, 1, 1, -8362 }, { 0x2126, 1, 1, -7517 },
+  { 0x2128, 1, 1, -8366 }, { 0x212A, 1, 1, -8383 }, { 0x212B, 1, 1, -8262 },
+  { 0x212C, 2, 1, -8394 }, { 0x212F, 1, 1, -8394 }, { 0x2130, 2, 1, -8395 },
+  { 0x2133, 1, 1, -8390 }, { 0x2134, 1, 1, -8389 }, { 0x2135, 4, 1, -7013 },
+  { 0x2139, 1, 1, -8400 }, { 0x213C, 1, 1, -7548 }, { 0x213D, 1, 1, -7562 },
+  { 0x213E, 1, 1, -7563 }, { 0x213F, 1, 1, -7551 }, { 0x2140, 1, 1, 209 }, { 0x2145, 1, 1, -8417 },
+  { 0x2146, 2, 1, -8418 }, { 0x2148, 2, 1, -8415 }, { 0x2160, 1, 1, -8439 },
+  { 0x2164, 1, 1, -8430 }, { 0x2169, 1, 1, -8433 }, { 0x216C, 1, 1, -8448 },
+  { 0x216D, 2, 1, -8458 }, { 0x216F, 1, 1, -8450 }, { 0x2170, 1, 1, -8455 },
+  { 0x2174, 1, 1, -8446 }, { 0x2179, 1, 1, -8449 }, { 0x217C, 1, 1, -8464 },
+  { 0x217D, 2, 1, -8474 }, { 0x217F, 1, 1, -8466 }, { 0x2329, 2, 1, 3295 }, { 0x2460, 9, 1, -9263 },
+  { 0x24B6, 26, 1, -9301 }, { 0x24D0, 26, 1, -9327 }, { 0x24EA, 1, 1, -9402 },
+  { 0x2C00, 48, 1, 48 }, { 0x2C60, 1, 1, 1 }, { 0x2C62, 1, 1, -10743 }, { 0x2C63, 1, 1, -3814 },
+  { 0x2C64, 1, 1, -10727 }, { 0x2C67, 3, 2, 1 }, { 0x2C6D, 1, 1, -10780 }, { 0x2C6E, 1, 1, -10749 },
+  { 0x2C6F, 1, 1, -10783 }, { 0x2C70, 1, 1, -10782 }, { 0x2C72, 1, 1, 1 }, { 0x2C75, 1, 1, 1 },
+  { 0x2C7C, 1, 1, -11282 }, { 0x2C7D, 1, 1, -11271 }, { 0x2C7E, 2, 1, -10815 },
+  { 0x2C80, 50, 2, 1 }, { 0x2CEB, 2, 2, 1 }, { 0x2CF2, 1, 1, 1 }, { 0x2D6F, 1, 1, -14 },
+  { 0x2E9F, 1, 1, 15662 }, { 0x2EF3, 1, 1, 28844 }, { 0x2F00, 1, 1, 7936 }, { 0x2F01, 1, 1, 7975 },
+  { 0x2F02, 1, 1, 7988 }, { 0x2F03, 1, 1, 7996 }, { 0x2F04, 1, 1, 8021 }, { 0x2F05, 1, 1, 8064 },
+  { 0x2F06, 1, 1, 8070 }, { 0x2F07, 1, 1, 8089 }, { 0x2F08, 1, 1, 8114 }, { 0x2F09, 1, 1, 8758 },
+  { 0x2F0A, 1, 1, 8795 }, { 0x2F0B, 1, 1, 8800 }, { 0x2F0C, 1, 1, 8822 }, { 0x2F0D, 1, 1, 8841 },
+  { 0x2F0E, 1, 1, 8861 }, { 0x2F0F, 1, 1, 8913 }, { 0x2F10, 1, 1, 8933 }, { 0x2F11, 1, 1, 8943 },
+  { 0x2F12, 1, 1, 9097 }, { 0x2F13, 1, 1, 9190 }, { 0x2F14, 1, 1, 9217 }, { 0x2F15, 1, 1, 9221 },
+  { 0x2F16, 1, 1, 9250 }, { 0x2F17, 1, 1, 9258 }, { 0x2F18, 1, 1, 9284 }, { 0x2F19, 1, 1, 9296 },
+  { 0x2F1A, 1, 1, 9320 }, { 0x2F1B, 1, 1, 9371 }, { 0x2F1C, 1, 1, 9388 }, { 0x2F1D, 1, 1, 9414 },
+  { 0x2F1E, 1, 1, 10169 }, { 0x2F1F, 1, 1, 10240 }, { 0x2F20, 1, 1, 10699 },
+  { 0x2F21, 1, 1, 10721 }, { 0x2F22, 1, 1, 10728 }, { 0x2F23, 1, 1, 10738 },
+  { 0x2F24, 1, 1, 10755 }, { 0x2F25, 1, 1, 10830 }, { 0x2F26, 1, 1, 11306 },
+  { 0x2F27, 1, 1, 11353 }, { 0x2F28, 1, 1, 11472 }, { 0x2F29, 1, 1, 11494 },
+  { 0x2F2A, 1, 1, 11512 }, { 0x2F2B, 1, 1, 11533 }, { 0x2F2C, 1, 1, 11586 },
+  { 0x2F2D, 1, 1, 11588 }, { 0x2F2E, 1, 1, 11949 }, { 0x2F2F, 1, 1, 11958 },
+  { 0x2F30, 1, 1, 11969 }, { 0x2F31, 1, 1, 11981 }, { 0x2F32, 1, 1, 12096 },
+  { 0x2F33, 1, 1, 12103 }, { 0x2F34, 1, 1, 12107 }, { 0x2F35, 1, 1, 12223 },
+  { 0x2F36, 1, 1, 12232 }, { 0x2F37, 1, 1, 12244 }, { 0x2F38, 1, 1, 12251 },
+  { 0x2F39, 1, 1, 12311 }, { 0x2F3A, 1, 1, 12327 }, { 0x2F3B, 1, 1, 12344 },
+  { 0x2F3C, 1, 1, 12423 }, { 0x2F3D, 1, 1, 13003 }, { 0x2F3E, 1, 1, 13048 },
+  { 0x2F3F, 1, 1, 13068 }, { 0x2F40, 1, 1, 13807 }, { 0x2F41, 1, 1, 13811 },
+  { 0x2F42, 1, 1, 13893 }, { 0x2F43, 1, 1, 13908 }, { 0x2F44, 1, 1, 13920 },
+  { 0x2F45, 1, 1, 13940 }, { 0x2F46, 1, 1, 13978 }, { 0x2F47, 1, 1, 13982 },
+  { 0x2F48, 1, 1, 14248 }, { 0x2F49, 1, 1, 14271 }, { 0x2F4A, 1, 1, 14302 },
+  { 0x2F4B, 1, 1, 15317 }, { 0x2F4C, 1, 1, 15382 }, { 0x2F4D, 1, 1, 15404 },
+  { 0x2F4E, 1, 1, 15461 }, { 0x2F4F, 1, 1, 15484 }, { 0x2F50, 1, 1, 15492 },
+  { 0x2F51, 1, 1, 15498 }, { 0x2F52, 1, 1, 15549 }, { 0x2F53, 1, 1, 15553 },
+  { 0x2F54, 1, 1, 15584 }, { 0x2F55, 1, 1, 16662 }, { 0x2F56, 1, 1, 17108 },
+  { 0x2F57, 1, 1, 17119 }, { 0x2F58, 1, 1, 17123 }, { 0x2F59, 1, 1, 17126 },
+  { 0x2F5A, 1, 1, 17133 }, { 0x2F5B, 1, 1, 17150 }, { 0x2F5C, 1, 1, 17151 },
+  { 0x2F5D, 1, 1, 17231 }, { 0x2F5E, 1, 1, 17446 }, { 0x2F5F, 1, 1, 17450 },
+  { 0x2F60, 1, 1, 17788 }, { 0x2F61, 1, 1, 17797 }, { 0x2F62, 1, 1, 17846 },
+  { 0x2F63, 1, 1, 17852 }, { 0x2F64, 1, 1, 17860 }, { 0x2F65, 1, 1, 17867 },
+  { 0x2F66, 1, 1, 17957 }, { 0x2F67, 1, 1, 17963 }, { 0x2F68, 1, 1, 18190 },
+  { 0x2F69, 1, 1, 18196 }, { 0x2F6A, 1, 1, 18244 }, { 0x2F6B, 1, 1, 18260 },
+  { 0x2F6C, 1, 1, 18306 }, { 0x2F6D, 1, 1, 18542 }, { 0x2F6E, 1, 1, 18548 },
+  { 0x2F6F, 1, 1, 18564 }, { 0x2F70, 1, 1, 18890 }, { 0x2F71, 1, 1, 19015 },
+  { 0x2F72, 1, 1, 19020 }, { 0x2F73, 1, 1, 19201 }, { 0x2F74, 1, 1, 19287 },
+  { 0x2F75, 1, 1, 19332 }, { 0x2F76, 1, 1, 19709 }, { 0x2F77, 1, 1, 19841 },
+  { 0x2F78, 1, 1, 20414 }, { 0x2F79, 1, 1, 20440 }, { 0x2F7A, 1, 1, 20496 },
+  { 0x2F7B, 1, 1, 20546 }, { 0x2F7C, 1, 1, 20613 }, { 0x2F7D, 1, 1, 20623 },
+  { 0x2F7E, 1, 1, 20628 }, { 0x2F7F, 1, 1, 20660 }, { 0x2F80, 1, 1, 20735 },
+  { 0x2F81, 1, 1, 20744 }, { 0x2F82, 1, 1, 21089 }, { 0x2F83, 1, 1, 21095 },
+  { 0x2F84, 1, 1, 21103 }, { 0x2F85, 1, 1, 21111 }, { 0x2F86, 1, 1, 21126 },
+  { 0x2F87, 1, 1, 21140 }, { 0x2F88, 1, 1, 21143 }, { 0x2F89, 1, 1, 21221 },
+  { 0x2F8A, 1, 1, 21224 }, { 0x2F8B, 1, 1, 21229 }, { 0x2F8C, 1, 1, 22209 },
+  { 0x2F8D, 1, 1, 22238 }, { 0x2F8E, 1, 1, 22706 }, { 0x2F8F, 1, 1, 22717 },
+  { 0x2F90, 1, 1, 22739 }, { 0x2F91, 1, 1, 23021 }, { 0x2F92, 1, 1, 23033 },
+  { 0x2F93, 1, 1, 23103 }, { 0x2F94, 1, 1, 23148 }, { 0x2F95, 1, 1, 23714 },
+  { 0x2F96, 1, 1, 23728 }, { 0x2F97, 1, 1, 23742 }, { 0x2F98, 1, 1, 23776 },
+  { 0x2F99, 1, 1, 23812 }, { 0x2F9A, 1, 1, 24010 }, { 0x2F9B, 1, 1, 24021 },
+  { 0x2F9C, 1, 1, 24087 }, { 0x2F9D, 1, 1, 24334 }, { 0x2F9E, 1, 1, 24364 },
+  { 0x2F9F, 1, 1, 24572 }, { 0x2FA0, 1, 1, 24592 }, { 0x2FA1, 1, 1, 24596 },
+  { 0x2FA2, 1, 1, 24815 }, { 0x2FA3, 1, 1, 24998 }, { 0x2FA4, 1, 1, 25122 },
+  { 0x2FA5, 1, 1, 25127 }, { 0x2FA6, 1, 1, 25131 }, { 0x2FA7, 1, 1, 26064 },
+  { 0x2FA8, 1, 1, 26072 }, { 0x2FA9, 1, 1, 26227 }, { 0x2FAA, 1, 1, 26380 },
+  { 0x2FAB, 1, 1, 26382 }, { 0x2FAC, 1, 1, 26428 }, { 0x2FAD, 1, 1, 26532 },
+  { 0x2FAE, 1, 1, 26544 }, { 0x2FAF, 1, 1, 26547 }, { 0x2FB0, 1, 1, 26553 },
+  { 0x2FB1, 1, 1, 26650 }, { 0x2FB2, 1, 1, 26683 }, { 0x2FB3, 1, 1, 26688 },
+  { 0x2FB4, 1, 1, 26701 }, { 0x2FB5, 1, 1, 26867 }, { 0x2FB6, 1, 1, 26917 },
+  { 0x2FB7, 1, 1, 26920 }, { 0x2FB8, 1, 1, 27102 }, { 0x2FB9, 1, 1, 27104 },
+  { 0x2FBA, 1, 1, 27122 }, { 0x2FBB, 1, 1, 27373 }, { 0x2FBC, 1, 1, 27420 },
+  { 0x2FBD, 1, 1, 27426 }, { 0x2FBE, 1, 1, 27495 }, { 0x2FBF, 1, 1, 27504 },
+  { 0x2FC0, 1, 1, 27506 }, { 0x2FC1, 1, 1, 27515 }, { 0x2FC2, 1, 1, 27544 },
+  { 0x2FC3, 1, 1, 27938 }, { 0x2FC4, 1, 1, 28337 }, { 0x2FC5, 1, 1, 28346 },
+  { 0x2FC6, 1, 1, 28383 }, { 0x2FC7, 1, 1, 28404 }, { 0x2FC8, 1, 1, 28411 },
+  { 0x2FC9, 1, 1, 28420 }, { 0x2FCA, 1, 1, 28423 }, { 0x2FCB, 1, 1, 28462 },
+  { 0x2FCC, 1, 1, 28465 }, { 0x2FCD, 1, 1, 28481 }, { 0x2FCE, 1, 1, 28485 },
+  { 0x2FCF, 1, 1, 28497 }, { 0x2FD0, 1, 1, 28523 }, { 0x2FD1, 1, 1, 28537 },
+  { 0x2FD2, 1, 1, 28544 }, { 0x2FD3, 1, 1, 28602 }, { 0x2FD4, 1, 1, 28616 },
+  { 0x2FD5, 1, 1, 28619 }, { 0x3000, 1, 1, -12256 }, { 0x3002, 1, 1, -12244 },
+  { 0x3036, 1, 1, -36 }, { 0x3038, 1, 1, 8969 }, { 0x3039, 2, 1, 8971 }, { 0x3131, 2, 1, -8241 },
+  { 0x3133, 1, 1, -8073 }, { 0x3134, 1, 1, -8242 }, { 0x3135, 2, 1, -8073 },
+  { 0x3137, 3, 1, -8244 }, { 0x313A, 6, 1, -8074 }, { 0x3140, 1, 1, -8230 },
+  { 0x3141, 3, 1, -8251 }, { 0x3144, 1, 1, -8227 }, { 0x3145, 10, 1, -8252 },
+  { 0x314F, 21, 1, -8174 }, { 0x3165, 2, 1, -8273 }, { 0x3167, 2, 1, -8096 },
+  { 0x3169, 1, 1, -8093 }, { 0x316A, 1, 1, -8092 }, { 0x316B, 1, 1, -8088 },
+  { 0x316C, 1, 1, -8085 }, { 0x316D, 1, 1, -8084 }, { 0x316E, 1, 1, -8274 },
+  { 0x316F, 1, 1, -8082 }, { 0x3170, 1, 1, -8081 }, { 0x3171, 2, 1, -8276 },
+  { 0x3173, 1, 1, -8275 }, { 0x3174, 2, 1, -8274 }, { 0x3176, 1, 1, -8271 },
+  { 0x3177, 1, 1, -8270 }, { 0x3178, 5, 1, -8269 }, { 0x317D, 1, 1, -8267 },
+  { 0x317E, 1, 1, -8264 }, { 0x317F, 1, 1, -8255 }, { 0x3180, 1, 1, -8249 },
+  { 0x3181, 1, 1, -8245 }, { 0x3182, 2, 1, -8081 }, { 0x3184, 3, 1, -8237 },
+  { 0x3187, 2, 1, -8195 }, { 0x3189, 1, 1, -8193 }, { 0x318A, 2, 1, -8185 },
+  { 0x318C, 1, 1, -8184 }, { 0x318D, 1, 1, -8175 }, { 0x318E, 1, 1, -8173 }, { 0x3192, 1, 1, 7278 },
+  { 0x3193, 1, 1, 7417 }, { 0x3194, 1, 1, 7285 }, { 0x3195, 1, 1, 9542 }, { 0x3196, 1, 1, 7284 },
+  { 0x3197, 1, 1, 7318 }, { 0x3198, 1, 1, 7283 }, { 0x3199, 1, 1, 17305 }, { 0x319A, 1, 1, 7359 },
+  { 0x319B, 1, 1, 7294 }, { 0x319C, 1, 1, 7269 }, { 0x319D, 1, 1, 10124 }, { 0x319E, 1, 1, 9618 },
+  { 0x319F, 1, 1, 7451 }, { 0x3244, 1, 1, 8971 }, { 0x3245, 1, 1, 11319 }, { 0x3246, 1, 1, 13121 },
+  { 0x3247, 1, 1, 18760 }, { 0x3260, 1, 1, -8544 }, { 0x3261, 2, 1, -8543 },
+  { 0x3263, 3, 1, -8542 }, { 0x3266, 1, 1, -8541 }, { 0x3267, 2, 1, -8540 },
+  { 0x3269, 5, 1, -8539 }, { 0x326E, 1, 1, 31122 }, { 0x326F, 1, 1, 32297 },
+  { 0x3270, 1, 1, 32884 }, { 0x3271, 1, 1, 34059 }, { 0x3272, 1, 1, 34646 },
+  { 0x3273, 1, 1, 35233 }, { 0x3274, 1, 1, 36408 }, { 0x3275, 1, 1, 37583 },
+  { 0x3276, 1, 1, 38170 }, { 0x3277, 1, 1, 39345 }, { 0x3278, 1, 1, 39932 },
+  { 0x3279, 1, 1, 40519 }, { 0x327A, 1, 1, 41106 }, { 0x327B, 1, 1, 41693 },
+  { 0x327E, 1, 1, 37938 }, { 0x3280, 1, 1, 7040 }, { 0x3281, 1, 1, 7179 }, { 0x3282, 1, 1, 7047 },
+  { 0x3283, 1, 1, 9304 }, { 0x3284, 1, 1, 7184 }, { 0x3285, 1, 1, 7912 }, { 0x3286, 1, 1, 7037 },
+  { 0x3287, 1, 1, 7908 }, { 0x3288, 1, 1, 7125 }, { 0x3289, 1, 1, 8376 }, { 0x328A, 1, 1, 13438 },
+  { 0x328B, 1, 1, 15840 }, { 0x328C, 1, 1, 14760 }, { 0x328D, 1, 1, 13467 },
+  { 0x328E, 1, 1, 24387 }, { 0x328F, 1, 1, 9360 }, { 0x3290, 1, 1, 13141 }, { 0x3291, 1, 1, 13721 },
+  { 0x3292, 1, 1, 13431 }, { 0x3293, 1, 1, 18091 }, { 0x3294, 1, 1, 8569 }, { 0x3295, 1, 1, 16356 },
+  { 0x3296, 1, 1, 23051 }, { 0x3297, 1, 1, 18118 }, { 0x3298, 1, 1, 8220 }, { 0x3299, 1, 1, 18239 },
+  { 0x329A, 1, 1, 17053 }, { 0x329B, 1, 1, 9944 }, { 0x329C, 1, 1, 24013 }, { 0x329D, 1, 1, 7821 },
+  { 0x329E, 1, 1, 8402 }, { 0x329F, 1, 1, 14921 }, { 0x32A0, 1, 1, 25957 }, { 0x32A1, 1, 1, 7280 },
+  { 0x32A2, 1, 1, 7927 }, { 0x32A3, 1, 1, 14528 }, { 0x32A4, 1, 1, 7014 }, { 0x32A5, 1, 1, 7048 },
+  { 0x32A6, 1, 1, 7013 }, { 0x32A7, 1, 1, 11071 }, { 0x32A8, 1, 1, 8523 }, { 0x32A9, 1, 1, 8338 },
+  { 0x32AA, 1, 1, 10477 }, { 0x32AB, 1, 1, 10427 }, { 0x32AC, 1, 1, 17463 }, { 0x32AD, 1, 1, 7252 },
+  { 0x32AE, 1, 1, 23065 }, { 0x32AF, 1, 1, 8357 }, { 0x32B0, 1, 1, 9836 }, { 0x32D0, 1, 1, -558 },
+  { 0x32D1, 1, 1, -557 }, { 0x32D2, 1, 1, -556 }, { 0x32D3, 1, 1, -555 }, { 0x32D4, 2, 1, -554 },
+  { 0x32D6, 1, 1, -553 }, { 0x32D7, 1, 1, -552 }, { 0x32D8, 1, 1, -551 }, { 0x32D9, 1, 1, -550 },
+  { 0x32DA, 1, 1, -549 }, { 0x32DB, 1, 1, -548 }, { 0x32DC, 1, 1, -547 }, { 0x32DD, 1, 1, -546 },
+  { 0x32DE, 1, 1, -545 }, { 0x32DF, 1, 1, -544 }, { 0x32E0, 1, 1, -543 }, { 0x32E1, 1, 1, -541 },
+  { 0x32E2, 1, 1, -540 }, { 0x32E3, 1, 1, -539 }, { 0x32E4, 6, 1, -538 }, { 0x32EA, 1, 1, -536 },
+  { 0x32EB, 1, 1, -534 }, { 0x32EC, 1, 1, -532 }, { 0x32ED, 1, 1, -530 }, { 0x32EE, 5, 1, -528 },
+  { 0x32F3, 1, 1, -527 }, { 0x32F4, 1, 1, -526 }, { 0x32F5, 6, 1, -525 }, { 0x32FB, 4, 1, -524 },
+  { 0xA640, 23, 2, 1 }, { 0xA680, 14, 2, 1 }, { 0xA69C, 1, 1, -41554 }, { 0xA69D, 1, 1, -41553 },
+  { 0xA722, 7, 2, 1 }, { 0xA732, 31, 2, 1 }, { 0xA770, 1, 1, -1 }, { 0xA779, 2, 2, 1 },
+  { 0xA77D, 1, 1, -35332 }, { 0xA77E, 5, 2, 1 }, { 0xA78B, 1, 1, 1 }, { 0xA78D, 1, 1, -42280 },
+  { 0xA790, 2, 2, 1 }, { 0xA796, 10, 2, 1 }, { 0xA7AA, 1, 1, -42308 }, { 0xA7AB, 1, 1, -42319 },
+  { 0xA7AC, 1, 1, -42315 }, { 0xA7AD, 1, 1, -42305 }, { 0xA7AE, 1, 1, -42308 },
+  { 0xA7B0, 1, 1, -42258 }, { 0xA7B1, 1, 1, -42282 }, { 0xA7B2, 1, 1, -42261 },
+  { 0xA7B3, 1, 1, 928 }, { 0xA7B4, 8, 2, 1 }, { 0xA7C4, 1, 1, -48 }, { 0xA7C5, 1, 1, -42307 },
+  { 0xA7C6, 1, 1, -35384 }, { 0xA7C7, 2, 2, 1 }, { 0xA7D0, 1, 1, 1 }, { 0xA7D6, 2, 2, 1 },
+  { 0xA7F2, 1, 1, -42895 }, { 0xA7F3, 1, 1, -42893 }, { 0xA7F4, 1, 1, -42883 }, { 0xA7F5, 1, 1, 1 },
+  { 0xA7F8, 1, 1, -42705 }, { 0xA7F9, 1, 1, -42662 }, { 0xAB5C, 1, 1, -1077 },
+  { 0xAB5D, 1, 1, -38 }, { 0xAB5E, 1, 1, -43251 }, { 0xAB5F, 1, 1, -13 }, { 0xAB69, 1, 1, -43228 },
+  { 0xAB70, 80, 1, -38864 }, { 0xF900, 1, 1, -27832 }, { 0xF901, 1, 1, -37389 },
+  { 0xF902, 1, 1, -27192 }, { 0xF903, 1, 1, -27707 }, { 0xF904, 1, 1, -35379 },
+  { 0xF905, 1, 1, -43731 }, { 0xF906, 1, 1, -42273 }, { 0xF907, 1, 1, -22891 },
+  { 0xF908, 1, 1, -22892 }, { 0xF909, 1, 1, -40888 }, { 0xF90A, 1, 1, -26425 },
+  { 0xF90B, 1, 1, -41860 }, { 0xF90C, 1, 1, -40900 }, { 0xF90D, 1, 1, -38679 },
+  { 0xF90E, 1, 1, -33445 }, { 0xF90F, 1, 1, -31114 }, { 0xF910, 1, 1, -29393 },
+  { 0xF911, 1, 1, -29015 }, { 0xF912, 1, 1, -28698 }, { 0xF913, 1, 1, -26756 },
+  { 0xF914, 1, 1, -36626 }, { 0xF915, 1, 1, -35834 }, { 0xF916, 1, 1, -34877 },
+  { 0xF917, 1, 1, -34105 }, { 0xF918, 1, 1, -29915 }, { 0xF919, 1, 1, -26543 },
+  { 0xF91A, 1, 1, -24361 }, { 0xF91B, 1, 1, -43673 }, { 0xF91C, 1, 1, -42407 },
+  { 0xF91D, 1, 1, -36377 }, { 0xF91E, 1, 1, -34563 }, { 0xF91F, 1, 1, -29426 },
+  { 0xF920, 1, 1, -23298 }, { 0xF921, 1, 1, -39889 }, { 0xF922, 1, 1, -35127 },
+  { 0xF923, 1, 1, -29526 }, { 0xF924, 1, 1, -28608 }, { 0xF925, 1, 1, -38492 },
+  { 0xF926, 1, 1, -30542 }, { 0xF927, 1, 1, -28936 }, { 0xF928, 1, 1, -39518 },
+  { 0xF929, 1, 1, -37394 }, { 0xF92A, 1, 1, -35776 }, { 0xF92B, 1, 1, -34351 },
+  { 0xF92C, 1, 1, -26718 }, { 0xF92D, 1, 1, -43431 }, { 0xF92E, 1, 1, -42871 },
+  { 0xF92F, 1, 1, -42577 }, { 0xF930, 1, 1, -37996 }, { 0xF931, 1, 1, -36446 },
+  { 0xF932, 1, 1, -34594 }, { 0xF933, 1, 1, -33356 }, { 0xF934, 1, 1, -31027 },
+  { 0xF935, 1, 1, -29487 }, { 0xF936, 1, 1, -29402 }, { 0xF937, 1, 1, -27464 },
+  { 0xF938, 1, 1, -25094 }, { 0xF939, 1, 1, -24010 }, { 0xF93A, 1, 1, -23360 },
+  { 0xF93B, 1, 1, -32943 }, { 0xF93C, 1, 1, -32701 }, { 0xF93D, 1, 1, -31645 },
+  { 0xF93E, 1, 1, -30069 }, { 0xF93F, 1, 1, -26171 }, { 0xF940, 1, 1, -23233 },
+  { 0xF941, 1, 1, -28267 }, { 0xF942, 1, 1, -41059 }, { 0xF943, 1, 1, -39487 },
+  { 0xF944, 1, 1, -31972 }, { 0xF945, 1, 1, -30919 }, { 0xF946, 1, 1, -34532 },
+  { 0xF947, 1, 1, -32893 }, { 0xF948, 1, 1, -27782 }, { 0xF949, 1, 1, -25170 },
+  { 0xF94A, 1, 1, -41074 }, { 0xF94B, 1, 1, -40169 }, { 0xF94C, 1, 1, -36665 },
+  { 0xF94D, 1, 1, -35699 }, { 0xF94E, 1, 1, -35391 }, { 0xF94F, 1, 1, -31776 },
+  { 0xF950, 1, 1, -31513 }, { 0xF951, 1, 1, -25350 }, { 0xF952, 1, 1, -42624 },
+  { 0xF953, 1, 1, -30920 }, { 0xF954, 1, 1, -42872 }, { 0xF955, 1, 1, -42889 },
+  { 0xF956, 1, 1, -32570 }, { 0xF957, 1, 1, -31641 }, { 0xF958, 1, 1, -30055 },
+  { 0xF959, 1, 1, -25316 }, { 0xF95A, 1, 1, -28122 }, { 0xF95B, 1, 1, -38540 },
+  { 0xF95C, 1, 1, -36698 }, { 0xF95D, 1, 1, -28255 }, { 0xF95E, 1, 1, -43813 },
+  { 0xF95F, 1, 1, -40312 }, { 0xF960, 1, 1, -39246 }, { 0xF961, 1, 1, -34266 },
+  { 0xF962, 1, 1, -33778 }, { 0xF963, 1, 1, -42572 }, { 0xF964, 1, 1, -32873 },
+  { 0xF965, 1, 1, -43430 }, { 0xF966, 1, 1, -39357 }, { 0xF967, 1, 1, -43866 },
+  { 0xF968, 1, 1, -35996 }, { 0xF969, 1, 1, -37873 }, { 0xF96A, 1, 1, -31816 },
+  { 0xF96B, 1, 1, -42408 }, { 0xF96C, 1, 1, -41230 }, { 0xF96D, 1, 1, -33388 },
+  { 0xF96E, 1, 1, -29989 }, { 0xF96F, 1, 1, -28357 }, { 0xF970, 1, 1, -36278 },
+  { 0xF971, 1, 1, -27073 }, { 0xF972, 1, 1, -36074 }, { 0xF973, 1, 1, -38517 },
+  { 0xF974, 1, 1, -30351 }, { 0xF975, 1, 1, -38357 }, { 0xF976, 1, 1, -33809 },
+  { 0xF977, 1, 1, -43721 }, { 0xF978, 1, 1, -43023 }, { 0xF979, 1, 1, -42928 },
+  { 0xF97A, 1, 1, -37113 }, { 0xF97B, 1, 1, -31892 }, { 0xF97C, 1, 1, -30477 },
+  { 0xF97D, 1, 1, -28331 }, { 0xF97E, 1, 1, -26543 }, { 0xF97F, 1, 1, -42634 },
+  { 0xF980, 1, 1, -42302 }, { 0xF981, 1, 1, -40974 }, { 0xF982, 1, 1, -39574 },
+  { 0xF983, 1, 1, -37822 }, { 0xF984, 1, 1, -35206 }, { 0xF985, 1, 1, -32859 },
+  { 0xF986, 1, 1, -25561 }, { 0xF987, 1, 1, -24349 }, { 0xF988, 1, 1, -23281 },
+  { 0xF989, 1, 1, -23227 }, { 0xF98A, 1, 1, -42735 }, { 0xF98B, 1, 1, -37573 },
+  { 0xF98C, 1, 1, -36373 }, { 0xF98D, 1, 1, -27179 }, { 0xF98E, 1, 1, -39706 },
+  { 0xF98F, 1, 1, -38911 }, { 0xF990, 1, 1, -38800 }, { 0xF991, 1, 1, -38135 },
+  { 0xF992, 1, 1, -35439 }, { 0xF993, 1, 1, -34890 }, { 0xF994, 1, 1, -34059 },
+  { 0xF995, 1, 1, -32715 }, { 0xF996, 1, 1, -31650 }, { 0xF997, 1, 1, -31016 },
+  { 0xF998, 1, 1, -27250 }, { 0xF999, 1, 1, -29867 }, { 0xF99A, 1, 1, -26999 },
+  { 0xF99B, 1, 1, -26193 }, { 0xF99C, 1, 1, -42885 }, { 0xF99D, 1, 1, -42746 },
+  { 0xF99E, 1, 1, -42209 }, { 0xF99F, 1, 1, -35031 }, { 0xF9A0, 1, 1, -28894 },
+  { 0xF9A1, 1, 1, -28407 }, { 0xF9A2, 1, 1, -39641 }, { 0xF9A3, 1, 1, -39342 },
+  { 0xF9A4, 1, 1, -38441 }, { 0xF9A5, 1, 1, -36343 }, { 0xF9A6, 1, 1, -32104 },
+  { 0xF9A7, 1, 1, -34354 }, { 0xF9A8, 1, 1, -43716 }, { 0xF9A9, 1, 1, -41648 },
+  { 0xF9AA, 1, 1, -40387 }, { 0xF9AB, 1, 1, -39921 }, { 0xF9AC, 1, 1, -39312 },
+  { 0xF9AD, 1, 1, -34299 }, { 0xF9AE, 1, 1, -34117 }, { 0xF9AF, 1, 1, -31253 },
+  { 0xF9B0, 1, 1, -31082 }, { 0xF9B1, 1, 1, -26493 }, { 0xF9B2, 1, 1, -25276 },
+  { 0xF9B3, 1, 1, -25195 }, { 0xF9B4, 1, 1, -24988 }, { 0xF9B5, 1, 1, -43562 },
+  { 0xF9B6, 1, 1, -32776 }, { 0xF9B7, 1, 1, -26627 }, { 0xF9B8, 1, 1, -25344 },
+  { 0xF9B9, 1, 1, -39128 }, { 0xF9BA, 1, 1, -43828 }, { 0xF9BB, 1, 1, -43233 },
+  { 0xF9BC, 1, 1, -40398 }, { 0xF9BD, 1, 1, -40318 }, { 0xF9BE, 1, 1, -37925 },
+  { 0xF9BF, 1, 1, -36797 }, { 0xF9C0, 1, 1, -34802 }, { 0xF9C1, 1, 1, -33663 },
+  { 0xF9C2, 1, 1, -29894 }, { 0xF9C3, 1, 1, -26951 }, { 0xF9C4, 1, 1, -23095 },
+  { 0xF9C5, 1, 1, -37693 }, { 0xF9C6, 1, 1, -25496 }, { 0xF9C7, 1, 1, -42814 },
+  { 0xF9C8, 1, 1, -37453 }, { 0xF9C9, 1, 1, -37334 }, { 0xF9CA, 1, 1, -35977 },
+  { 0xF9CB, 1, 1, -35631 }, { 0xF9CC, 1, 1, -34243 }, { 0xF9CD, 1, 1, -33908 },
+  { 0xF9CE, 1, 1, -33123 }, { 0xF9CF, 1, 1, -31935 }, { 0xF9D0, 1, 1, -24946 },
+  { 0xF9D1, 1, 1, -43108 }, { 0xF9D2, 1, 1, -38820 }, { 0xF9D3, 1, 1, -25435 },
+  { 0xF9D4, 1, 1, -43433 }, { 0xF9D5, 1, 1, -40124 }, { 0xF9D6, 1, 1, -35820 },
+  { 0xF9D7, 1, 1, -27309 }, { 0xF9D8, 1, 1, -39501 }, { 0xF9D9, 1, 1, -39061 },
+  { 0xF9DA, 1, 1, -37315 }, { 0xF9DB, 1, 1, -34388 }, { 0xF9DC, 1, 1, -25430 },
+  { 0xF9DD, 1, 1, -42932 }, { 0xF9DE, 1, 1, -42447 }, { 0xF9DF, 1, 1, -40314 },
+  { 0xF9E0, 1, 1, -37837 }, { 0xF9E1, 1, 1, -37523 }, { 0xF9E2, 1, 1, -37178 },
+  { 0xF9E3, 1, 1, -36094 }, { 0xF9E4, 1, 1, -34270 }, { 0xF9E5, 1, 1, -33795 },
+  { 0xF9E6, 1, 1, -31341 }, { 0xF9E7, 1, 1, -28952 }, { 0xF9E8, 1, 1, -28935 },
+  { 0xF9E9, 1, 1, -26653 }, { 0xF9EA, 1, 1, -25352 }, { 0xF9EB, 1, 1, -42668 },
+  { 0xF9EC, 1, 1, -35634 }, { 0xF9ED, 1, 1, -42448 }, { 0xF9EE, 1, 1, -34846 },
+  { 0xF9EF, 1, 1, -34135 }, { 0xF9F0, 1, 1, -29686 }, { 0xF9F1, 1, 1, -25422 },
+  { 0xF9F2, 1, 1, -23963 }, { 0xF9F3, 1, 1, -23380 }, { 0xF9F4, 1, 1, -37469 },
+  { 0xF9F5, 1, 1, -35882 }, { 0xF9F6, 1, 1, -30734 }, { 0xF9F7, 1, 1, -32556 },
+  { 0xF9F8, 1, 1, -32472 }, { 0xF9F9, 1, 1, -32103 }, { 0xF9FA, 1, 1, -34618 },
+  { 0xF9FB, 1, 1, -35170 }, { 0xF9FC, 1, 1, -28324 }, { 0xF9FD, 1, 1, -43837 },
+  { 0xF9FE, 1, 1, -30408 }, { 0xF9FF, 1, 1, -42949 }, { 0xFA00, 1, 1, -43001 },
+  { 0xFA01, 1, 1, -39771 }, { 0xFA02, 1, 1, -38703 }, { 0xFA03, 1, 1, -32045 },
+  { 0xFA04, 1, 1, -40575 }, { 0xFA05, 1, 1, -36071 }, { 0xFA06, 1, 1, -37714 },
+  { 0xFA07, 1, 1, -27340 }, { 0xFA08, 1, 1, -29116 }, { 0xFA09, 1, 1, -25532 },
+  { 0xFA0A, 1, 1, -28799 }, { 0xFA0B, 1, 1, -39736 }, { 0xFA0C, 1, 1, -43212 },
+  { 0xFA0D, 1, 1, -42061 }, { 0xFA10, 1, 1, -41398 }, { 0xFA12, 1, 1, -37790 },
+  { 0xFA15, 1, 1, -43063 }, { 0xFA16, 1, 1, -34540 }, { 0xFA17, 1, 1, -33613 },
+  { 0xFA18, 1, 1, -32988 }, { 0xFA19, 1, 1, -32955 }, { 0xFA1A, 1, 1, -32949 },
+  { 0xFA1B, 1, 1, -32908 }, { 0xFA1C, 1, 1, -25286 }, { 0xFA1D, 1, 1, -32095 },
+  { 0xFA1E, 1, 1, -31329 }, { 0xFA20, 1, 1, -29710 }, { 0xFA22, 1, 1, -28458 },
+  { 0xFA25, 1, 1, -27117 }, { 0xFA26, 1, 1, -26921 }, { 0xFA2A, 1, 1, -24891 },
+  { 0xFA2B, 1, 1, -24879 }, { 0xFA2C, 1, 1, -24836 }, { 0xFA2D, 1, 1, -23673 },
+  { 0xFA2E, 1, 1, -26960 }, { 0xFA2F, 1, 1, -25464 }, { 0xFA30, 1, 1, -43650 },
+  { 0xFA31, 1, 1, -43338 }, { 0xFA32, 1, 1, -43237 }, { 0xFA33, 1, 1, -42858 },
+  { 0xFA34, 1, 1, -42832 }, { 0xFA35, 1, 1, -42724 }, { 0xFA36, 1, 1, -42137 },
+  { 0xFA37, 1, 1, -42033 }, { 0xFA38, 1, 1, -41936 }, { 0xFA39, 1, 1, -41465 },
+  { 0xFA3A, 1, 1, -41362 }, { 0xFA3B, 1, 1, -40407 }, { 0xFA3C, 1, 1, -40398 },
+  { 0xFA3D, 1, 1, -39337 }, { 0xFA3E, 1, 1, -39126 }, { 0xFA3F, 1, 1, -39089 },
+  { 0xFA40, 1, 1, -38990 }, { 0xFA41, 1, 1, -38130 }, { 0xFA42, 1, 1, -37984 },
+  { 0xFA43, 1, 1, -37810 }, { 0xFA44, 1, 1, -37311 }, { 0xFA45, 1, 1, -36046 },
+  { 0xFA46, 1, 1, -35884 }, { 0xFA47, 1, 1, -35621 }, { 0xFA48, 1, 1, -35034 },
+  { 0xFA49, 1, 1, -34846 }, { 0xFA4A, 1, 1, -34344 }, { 0xFA4B, 1, 1, -33210 },
+  { 0xFA4C, 1, 1, -33038 }, { 0xFA4D, 1, 1, -33028 }, { 0xFA4E, 1, 1, -33030 },
+  { 0xFA4F, 1, 1, -33023 }, { 0xFA50, 1, 1, -33018 }, { 0xFA51, 1, 1, -33012 },
+  { 0xFA52, 2, 1, -32965 }, { 0xFA54, 1, 1, -32788 }, { 0xFA55, 1, 1, -32724 },
+  { 0xFA56, 1, 1, -32406 }, { 0xFA57, 1, 1, -31843 }, { 0xFA58, 1, 1, -31823 },
+  { 0xFA59, 1, 1, -31768 }, { 0xFA5A, 1, 1, -31464 }, { 0xFA5B, 1, 1, -31318 },
+  { 0xFA5C, 1, 1, -30831 }, { 0xFA5D, 1, 1, -30692 }, { 0xFA5E, 1, 1, -30693 },
+  { 0xFA5F, 1, 1, -30216 }, { 0xFA60, 1, 1, -29008 }, { 0xFA61, 1, 1, -28875 },
+  { 0xFA62, 1, 1, -28513 }, { 0xFA63, 1, 1, -28458 }, { 0xFA64, 1, 1, -28049 },
+  { 0xFA65, 1, 1, -27997 }, { 0xFA66, 1, 1, -27312 }, { 0xFA67, 1, 1, -27183 },
+  { 0xFA68, 1, 1, -25477 }, { 0xFA69, 1, 1, -25194 }, { 0xFA6A, 1, 1, -25135 },
+  { 0xFA6B, 1, 1, -39414 }, { 0xFA6C, 1, 1, 84098 }, { 0xFA6D, 1, 1, -30805 },
+  { 0xFA70, 1, 1, -44106 }, { 0xFA71, 1, 1, -43196 }, { 0xFA72, 1, 1, -43274 },
+  { 0xFA73, 1, 1, -43763 }, { 0xFA74, 1, 1, -43311 }, { 0xFA75, 1, 1, -43253 },
+  { 0xFA76, 1, 1, -42927 }, { 0xFA77, 1, 1, -42877 }, { 0xFA78, 1, 1, -42203 },
+  { 0xFA79, 1, 1, -42276 }, { 0xFA7A, 1, 1, -42209 }, { 0xFA7B, 1, 1, -42137 },
+  { 0xFA7C, 1, 1, -41506 }, { 0xFA7D, 1, 1, -41418 }, { 0xFA7E, 1, 1, -41274 },
+  { 0xFA7F, 1, 1, -41259 }, { 0xFA80, 1, 1, -40990 }, { 0xFA81, 1, 1, -40793 },
+  { 0xFA82, 1, 1, -39856 }, { 0xFA83, 1, 1, -39850 }, { 0xFA84, 1, 1, -39707 },
+  { 0xFA85, 1, 1, -39640 }, { 0xFA86, 1, 1, -39342 }, { 0xFA87, 1, 1, -39225 },
+  { 0xFA88, 1, 1, -39296 }, { 0xFA89, 1, 1, -39163 }, { 0xFA8A, 1, 1, -39210 },
+  { 0xFA8B, 1, 1, -39065 }, { 0xFA8C, 1, 1, -39000 }, { 0xFA8D, 1, 1, -38601 },
+  { 0xFA8E, 1, 1, -38514 }, { 0xFA8F, 1, 1, -38461 }, { 0xFA90, 1, 1, -38202 },
+  { 0xFA91, 1, 1, -37917 }, { 0xFA92, 1, 1, -37755 }, { 0xFA93, 1, 1, -37752 },
+  { 0xFA94, 1, 1, -37694 }, { 0xFA95, 1, 1, -36636 }, { 0xFA96, 1, 1, -36572 },
+  { 0xFA97, 1, 1, -36182 }, { 0xFA98, 1, 1, -35773 }, { 0xFA99, 1, 1, -35790 },
+  { 0xFA9A, 1, 1, -35704 }, { 0xFA9B, 1, 1, -35453 }, { 0xFA9C, 1, 1, -35118 },
+  { 0xFA9D, 1, 1, -33526 }, { 0xFA9E, 1, 1, -34921 }, { 0xFA9F, 1, 1, -34800 },
+  { 0xFAA0, 1, 1, -34678 }, { 0xFAA1, 1, 1, -34352 }, { 0xFAA2, 1, 1, -34204 },
+  { 0xFAA3, 1, 1, -34152 }, { 0xFAA4, 1, 1, -33927 }, { 0xFAA5, 1, 1, -33926 },
+  { 0xFAA6, 1, 1, -33756 }, { 0xFAA7, 1, 1, -33740 }, { 0xFAA8, 1, 1, -33716 },
+  { 0xFAA9, 1, 1, -33631 }, { 0xFAAA, 1, 1, -33642 }, { 0xFAAB, 1, 1, -33247 },
+  { 0xFAAC, 1, 1, -32763 }, { 0xFAAD, 1, 1, -32493 }, { 0xFAAE, 1, 1, -32307 },
+  { 0xFAAF, 1, 1, -32084 }, { 0xFAB0, 1, 1, -31932 }, { 0xFAB1, 1, 1, -31603 },
+  { 0xFAB2, 1, 1, -31405 }, { 0xFAB3, 1, 1, -30561 }, { 0xFAB4, 1, 1, -30405 },
+  { 0xFAB5, 1, 1, -29500 }, { 0xFAB6, 1, 1, -29045 }, { 0xFAB7, 1, 1, -28977 },
+  { 0xFAB8, 1, 1, -28962 }, { 0xFAB9, 1, 1, -28666 }, { 0xFABA, 1, 1, -28610 },
+  { 0xFABB, 1, 1, -28656 }, { 0xFABC, 1, 1, -28603 }, { 0xFABD, 1, 1, -28607 },
+  { 0xFABE, 1, 1, -28625 }, { 0xFABF, 1, 1, -28550 }, { 0xFAC0, 1, 1, -28470 },
+  { 0xFAC1, 1, 1, -28089 }, { 0xFAC2, 1, 1, -27530 }, { 0xFAC3, 1, 1, -27217 },
+  { 0xFAC4, 1, 1, -26923 }, { 0xFAC5, 1, 1, -26703 }, { 0xFAC6, 1, 1, -25674 },
+  { 0xFAC7, 1, 1, -25572 }, { 0xFAC8, 1, 1, -25458 }, { 0xFAC9, 1, 1, -25326 },
+  { 0xFACA, 1, 1, -25291 }, { 0xFACB, 1, 1, -25280 }, { 0xFACC, 1, 1, -25233 },
+  { 0xFACD, 1, 1, -24507 }, { 0xFACE, 1, 1, -23346 }, { 0xFACF, 1, 1, 77179 },
+  { 0xFAD0, 1, 1, 77172 }, { 0xFAD1, 1, 1, 80132 }, { 0xFAD2, 1, 1, -48949 },
+  { 0xFAD3, 1, 1, -47803 }, { 0xFAD4, 1, 1, -47771 }, { 0xFAD5, 1, 1, 87924 },
+  { 0xFAD6, 1, 1, 90618 }, { 0xFAD7, 1, 1, 99324 }, { 0xFAD8, 1, 1, -23445 },
+  { 0xFAD9, 1, 1, -23371 }, { 0xFB20, 1, 1, -62782 }, { 0xFB21, 1, 1, -62801 },
+  { 0xFB22, 2, 1, -62799 }, { 0xFB24, 3, 1, -62793 }, { 0xFB27, 1, 1, -62783 },
+  { 0xFB28, 1, 1, -62782 }, { 0xFB29, 1, 1, -64254 }, { 0xFB50, 1, 1, -62687 },
+  { 0xFB51, 1, 1, -62688 }, { 0xFB52, 1, 1, -62679 }, { 0xFB53, 1, 1, -62680 },
+  { 0xFB54, 1, 1, -62681 }, { 0xFB55, 1, 1, -62682 }, { 0xFB56, 1, 1, -62680 },
+  { 0xFB57, 1, 1, -62681 }, { 0xFB58, 1, 1, -62682 }, { 0xFB59, 1, 1, -62683 },
+  { 0xFB5A, 1, 1, -62682 }, { 0xFB5B, 1, 1, -62683 }, { 0xFB5C, 1, 1, -62684 },
+  { 0xFB5D, 1, 1, -62685 }, { 0xFB5E, 1, 1, -62692 }, { 0xFB5F, 1, 1, -62693 },
+  { 0xFB60, 1, 1, -62694 }, { 0xFB61, 1, 1, -62695 }, { 0xFB62, 1, 1, -62691 },
+  { 0xFB63, 1, 1, -62692 }, { 0xFB64, 1, 1, -62693 }, { 0xFB65, 1, 1, -62694 },
+  { 0xFB66, 1, 1, -62701 }, { 0xFB67, 1, 1, -62702 }, { 0xFB68, 1, 1, -62703 },
+  { 0xFB69, 1, 1, -62704 }, { 0xFB6A, 1, 1, -62662 }, { 0xFB6B, 1, 1, -62663 },
+  { 0xFB6C, 1, 1, -62664 }, { 0xFB6D, 1, 1, -62665 }, { 0xFB6E, 1, 1, -62664 },
+  { 0xFB6F, 1, 1, -62665 }, { 0xFB70, 1, 1, -62666 }, { 0xFB71, 1, 1, -62667 },
+  { 0xFB72, 1, 1, -62702 }, { 0xFB73, 1, 1, -62703 }, { 0xFB74, 1, 1, -62704 },
+  { 0xFB75, 1, 1, -62705 }, { 0xFB76, 1, 1, -62707 }, { 0xFB77, 1, 1, -62708 },
+  { 0xFB78, 1, 1, -62709 }, { 0xFB79, 1, 1, -62710 }, { 0xFB7A, 1, 1, -62708 },
+  { 0xFB7B, 1, 1, -62709 }, { 0xFB7C, 1, 1, -62710 }, { 0xFB7D, 2, 1, -62711 },
+  { 0xFB7F, 1, 1, -62712 }, { 0xFB80, 1, 1, -62713 }, { 0xFB81, 1, 1, -62714 },
+  { 0xFB82, 1, 1, -62709 }, { 0xFB83, 1, 1, -62710 }, { 0xFB84, 1, 1, -62712 },
+  { 0xFB85, 1, 1, -62713 }, { 0xFB86, 1, 1, -62712 }, { 0xFB87, 1, 1, -62713 },
+  { 0xFB88, 1, 1, -62720 }, { 0xFB89, 1, 1, -62721 }, { 0xFB8A, 1, 1, -62706 },
+  { 0xFB8B, 1, 1, -62707 }, { 0xFB8C, 1, 1, -62715 }, { 0xFB8D, 1, 1, -62716 },
+  { 0xFB8E, 1, 1, -62693 }, { 0xFB8F, 1, 1, -62694 }, { 0xFB90, 1, 1, -62695 },
+  { 0xFB91, 1, 1, -62696 }, { 0xFB92, 1, 1, -62691 }, { 0xFB93, 1, 1, -62692 },
+  { 0xFB94, 1, 1, -62693 }, { 0xFB95, 1, 1, -62694 }, { 0xFB96, 1, 1, -62691 },
+  { 0xFB97, 1, 1, -62692 }, { 0xFB98, 1, 1, -62693 }, { 0xFB99, 1, 1, -62694 },
+  { 0xFB9A, 1, 1, -62697 }, { 0xFB9B, 1, 1, -62698 }, { 0xFB9C, 1, 1, -62699 },
+  { 0xFB9D, 1, 1, -62700 }, { 0xFB9E, 1, 1, -62692 }, { 0xFB9F, 2, 1, -62693 },
+  { 0xFBA1, 1, 1, -62694 }, { 0xFBA2, 1, 1, -62695 }, { 0xFBA3, 1, 1, -62696 },
+  { 0xFBA4, 1, 1, -62692 }, { 0xFBA5, 2, 1, -62693 }, { 0xFBA7, 1, 1, -62694 },
+  { 0xFBA8, 1, 1, -62695 }, { 0xFBA9, 1, 1, -62696 }, { 0xFBAA, 1, 1, -62700 },
+  { 0xFBAB, 1, 1, -62701 }, { 0xFBAC, 1, 1, -62702 }, { 0xFBAD, 1, 1, -62703 },
+  { 0xFBAE, 1, 1, -62684 }, { 0xFBAF, 2, 1, -62685 }, { 0xFBB1, 1, 1, -62686 },
+  { 0xFBD3, 1, 1, -62758 }, { 0xFBD4, 1, 1, -62759 }, { 0xFBD5, 1, 1, -62760 },
+  { 0xFBD6, 1, 1, -62761 }, { 0xFBD7, 1, 1, -62736 }, { 0xFBD8, 1, 1, -62737 },
+  { 0xFBD9, 1, 1, -62739 }, { 0xFBDA, 1, 1, -62740 }, { 0xFBDB, 1, 1, -62739 },
+  { 0xFBDC, 1, 1, -62740 }, { 0xFBDE, 1, 1, -62739 }, { 0xFBDF, 1, 1, -62740 },
+  { 0xFBE0, 1, 1, -62747 }, { 0xFBE1, 1, 1, -62748 }, { 0xFBE2, 1, 1, -62745 },
+  { 0xFBE3, 1, 1, -62746 }, { 0xFBE4, 1, 1, -62740 }, { 0xFBE5, 1, 1, -62741 },
+  { 0xFBE6, 1, 1, -62742 }, { 0xFBE7, 1, 1, -62743 }, { 0xFBE8, 1, 1, -62879 },
+  { 0xFBE9, 1, 1, -62880 }, { 0xFBFC, 1, 1, -62768 }, { 0xFBFD, 1, 1, -62769 },
+  { 0xFBFE, 1, 1, -62770 }, { 0xFBFF, 1, 1, -62771 }, { 0xFE10, 1, 1, -64996 },
+  { 0xFE11, 1, 1, -52752 }, { 0xFE13, 2, 1, -64985 }, { 0xFE15, 1, 1, -65012 },
+  { 0xFE16, 1, 1, -64983 }, { 0xFE17, 2, 1, -52737 }, { 0xFE31, 1, 1, -56861 },
+  { 0xFE32, 1, 1, -56863 }, { 0xFE33, 1, 1, -64980 }, { 0xFE34, 1, 1, -64981 },
+  { 0xFE35, 2, 1, -65037 }, { 0xFE37, 1, 1, -64956 }, { 0xFE38, 1, 1, -64955 },
+  { 0xFE39, 2, 1, -52773 }, { 0xFE3B, 2, 1, -52779 }, { 0xFE3D, 2, 1, -52787 },
+  { 0xFE3F, 2, 1, -52791 }, { 0xFE41, 4, 1, -52789 }, { 0xFE47, 1, 1, -65004 },
+  { 0xFE48, 1, 1, -65003 }, { 0xFE4D, 1, 1, -65006 }, { 0xFE4E, 1, 1, -65007 },
+  { 0xFE4F, 1, 1, -65008 }, { 0xFE50, 1, 1, -65060 }, { 0xFE51, 1, 1, -52816 },
+  { 0xFE54, 1, 1, -65049 }, { 0xFE55, 1, 1, -65051 }, { 0xFE56, 1, 1, -65047 },
+  { 0xFE57, 1, 1, -65078 }, { 0xFE58, 1, 1, -56900 }, { 0xFE59, 2, 1, -65073 },
+  { 0xFE5B, 1, 1, -64992 }, { 0xFE5C, 1, 1, -64991 }, { 0xFE5D, 2, 1, -52809 },
+  { 0xFE5F, 1, 1, -65084 }, { 0xFE60, 1, 1, -65082 }, { 0xFE61, 2, 1, -65079 },
+  { 0xFE63, 1, 1, -65078 }, { 0xFE64, 1, 1, -65064 }, { 0xFE65, 1, 1, -65063 },
+  { 0xFE66, 1, 1, -65065 }, { 0xFE68, 1, 1, -65036 }, { 0xFE69, 2, 1, -65093 },
+  { 0xFE6B, 1, 1, -65067 }, { 0xFE80, 2, 1, -63583 }, { 0xFE82, 2, 1, -63584 },
+  { 0xFE84, 2, 1, -63585 }, { 0xFE86, 2, 1, -63586 }, { 0xFE88, 2, 1, -63587 },
+  { 0xFE8A, 1, 1, -63588 }, { 0xFE8B, 1, 1, -63589 }, { 0xFE8C, 2, 1, -63590 },
+  { 0xFE8E, 2, 1, -63591 }, { 0xFE90, 1, 1, -63592 }, { 0xFE91, 1, 1, -63593 },
+  { 0xFE92, 2, 1, -63594 }, { 0xFE94, 2, 1, -63595 }, { 0xFE96, 1, 1, -63596 },
+  { 0xFE97, 1, 1, -63597 }, { 0xFE98, 2, 1, -63598 }, { 0xFE9A, 1, 1, -63599 },
+  { 0xFE9B, 1, 1, -63600 }, { 0xFE9C, 2, 1, -63601 }, { 0xFE9E, 1, 1, -63602 },
+  { 0xFE9F, 1, 1, -63603 }, { 0xFEA0, 2, 1, -63604 }, { 0xFEA2, 1, 1, -63605 },
+  { 0xFEA3, 1, 1, -63606 }, { 0xFEA4, 2, 1, -63607 }, { 0xFEA6, 1, 1, -63608 },
+  { 0xFEA7, 1, 1, -63609 }, { 0xFEA8, 2, 1, -63610 }, { 0xFEAA, 2, 1, -63611 },
+  { 0xFEAC, 2, 1, -63612 }, { 0xFEAE, 2, 1, -63613 }, { 0xFEB0, 2, 1, -63614 },
+  { 0xFEB2, 1, 1, -63615 }, { 0xFEB3, 1, 1, -63616 }, { 0xFEB4, 2, 1, -63617 },
+  { 0xFEB6, 1, 1, -63618 }, { 0xFEB7, 1, 1, -63619 }, { 0xFEB8, 2, 1, -63620 },
+  { 0xFEBA, 1, 1, -63621 }, { 0xFEBB, 1, 1, -63622 }, { 0xFEBC, 2, 1, -63623 },
+  { 0xFEBE, 1, 1, -63624 }, { 0xFEBF, 1, 1, -63625 }, { 0xFEC0, 2, 1, -63626 },
+  { 0xFEC2, 1, 1, -63627 }, { 0xFEC3, 1, 1, -63628 }, { 0xFEC4, 2, 1, -63629 },
+  { 0xFEC6, 1, 1, -63630 }, { 0xFEC7, 1, 1, -63631 }, { 0xFEC8, 2, 1, -63632 },
+  { 0xFECA, 1, 1, -63633 }, { 0xFECB, 1, 1, -63634 }, { 0xFECC, 2, 1, -63635 },
+  { 0xFECE, 1, 1, -63636 }, { 0xFECF, 1, 1, -63637 }, { 0xFED0, 1, 1, -63638 },
+  { 0xFED1, 1, 1, -63632 }, { 0xFED2, 1, 1, -63633 }, { 0xFED3, 1, 1, -63634 },
+  { 0xFED4, 2, 1, -63635 }, { 0xFED6, 1, 1, -63636 }, { 0xFED7, 1, 1, -63637 },
+  { 0xFED8, 2, 1, -63638 }, { 0xFEDA, 1, 1, -63639 }, { 0xFEDB, 1, 1, -63640 },
+  { 0xFEDC, 2, 1, -63641 }, { 0xFEDE, 1, 1, -63642 }, { 0xFEDF, 1, 1, -63643 },
+  { 0xFEE0, 2, 1, -63644 }, { 0xFEE2, 1, 1, -63645 }, { 0xFEE3, 1, 1, -63646 },
+  { 0xFEE4, 2, 1, -63647 }, { 0xFEE6, 1, 1, -63648 }, { 0xFEE7, 1, 1, -63649 },
+  { 0xFEE8, 2, 1, -63650 }, { 0xFEEA, 1, 1, -63651 }, { 0xFEEB, 1, 1, -63652 },
+  { 0xFEEC, 2, 1, -63653 }, { 0xFEEE, 2, 1, -63654 }, { 0xFEF0, 2, 1, -63655 },
+  { 0xFEF2, 1, 1, -63656 }, { 0xFEF3, 1, 1, -63657 }, { 0xFEF4, 1, 1, -63658 },
+  { 0xFF01, 32, 1, -65248 }, { 0xFF21, 26, 1, -65216 }, { 0xFF3B, 36, 1, -65248 },
+  { 0xFF5F, 2, 1, -54746 }, { 0xFF61, 1, 1, -65331 }, { 0xFF62, 2, 1, -53078 },
+  { 0xFF64, 1, 1, -53091 }, { 0xFF65, 1, 1, -52842 }, { 0xFF66, 1, 1, -52852 },
+  { 0xFF67, 1, 1, -52934 }, { 0xFF68, 1, 1, -52933 }, { 0xFF69, 1, 1, -52932 },
+  { 0xFF6A, 1, 1, -52931 }, { 0xFF6B, 1, 1, -52930 }, { 0xFF6C, 1, 1, -52873 },
+  { 0xFF6D, 1, 1, -52872 }, { 0xFF6E, 1, 1, -52871 }, { 0xFF6F, 1, 1, -52908 },
+  { 0xFF70, 1, 1, -52852 }, { 0xFF71, 1, 1, -52943 }, { 0xFF72, 1, 1, -52942 },
+  { 0xFF73, 1, 1, -52941 }, { 0xFF74, 1, 1, -52940 }, { 0xFF75, 2, 1, -52939 },
+  { 0xFF77, 1, 1, -52938 }, { 0xFF78, 1, 1, -52937 }, { 0xFF79, 1, 1, -52936 },
+  { 0xFF7A, 1, 1, -52935 }, { 0xFF7B, 1, 1, -52934 }, { 0xFF7C, 1, 1, -52933 },
+  { 0xFF7D, 1, 1, -52932 }, { 0xFF7E, 1, 1, -52931 }, { 0xFF7F, 1, 1, -52930 },
+  { 0xFF80, 1, 1, -52929 }, { 0xFF81, 1, 1, -52928 }, { 0xFF82, 1, 1, -52926 },
+  { 0xFF83, 1, 1, -52925 }, { 0xFF84, 1, 1, -52924 }, { 0xFF85, 6, 1, -52923 },
+  { 0xFF8B, 1, 1, -52921 }, { 0xFF8C, 1, 1, -52919 }, { 0xFF8D, 1, 1, -52917 },
+  { 0xFF8E, 1, 1, -52915 }, { 0xFF8F, 5, 1, -52913 }, { 0xFF94, 1, 1, -52912 },
+  { 0xFF95, 1, 1, -52911 }, { 0xFF96, 6, 1, -52910 }, { 0xFF9C, 1, 1, -52909 },
+  { 0xFF9D, 1, 1, -52906 }, { 0xFF9E, 2, 1, -52997 }, { 0xFFA1, 2, 1, -61089 },
+  { 0xFFA3, 1, 1, -60921 }, { 0xFFA4, 1, 1, -61090 }, { 0xFFA5, 2, 1, -60921 },
+  { 0xFFA7, 3, 1, -61092 }, { 0xFFAA, 6, 1, -60922 }, { 0xFFB0, 1, 1, -61078 },
+  { 0xFFB1, 3, 1, -61099 }, { 0xFFB4, 1, 1, -61075 }, { 0xFFB5, 10, 1, -61100 },
+  { 0xFFC2, 6, 1, -61025 }, { 0xFFCA, 6, 1, -61027 }, { 0xFFD2, 6, 1, -61029 },
+  { 0xFFDA, 3, 1, -61031 }, { 0xFFE0, 2, 1, -65342 }, { 0xFFE2, 1, 1, -65334 },
+  { 0xFFE4, 1, 1, -65342 }, { 0xFFE5, 1, 1, -65344 }, { 0xFFE6, 1, 1, -57149 },
+  { 0xFFE8, 1, 1, -56038 }, { 0xFFE9, 4, 1, -56921 }, { 0xFFED, 1, 1, -55885 },
+  { 0xFFEE, 1, 1, -55843 }, { 0x10400, 40, 1, 40 }, { 0x104B0, 36, 1, 40 }, { 0x10570, 11, 1, 39 },
+  { 0x1057C, 15, 1, 39 }, { 0x1058C, 7, 1, 39 }, { 0x10594, 2, 1, 39 }, { 0x10781, 2, 1, -66737 },
+  { 0x10783, 1, 1, -67229 }, { 0x10784, 1, 1, -66795 }, { 0x10785, 1, 1, -66866 },
+  { 0x10787, 1, 1, -66788 }, { 0x10788, 1, 1, -23586 }, { 0x10789, 1, 1, -66788 },
+  { 0x1078A, 1, 1, -66790 }, { 0x1078B, 2, 1, -66869 }, { 0x1078D, 1, 1, -59900 },
+  { 0x1078E, 1, 1, -66870 }, { 0x1078F, 1, 1, -66865 }, { 0x10790, 1, 1, -66791 },
+  { 0x10791, 1, 1, -66861 }, { 0x10792, 1, 1, -66864 }, { 0x10793, 1, 1, -66867 },
+  { 0x10794, 1, 1, -66809 }, { 0x10795, 1, 1, -67182 }, { 0x10796, 1, 1, -66810 },
+  { 0x10797, 1, 1, -66864 }, { 0x10798, 1, 1, -66836 }, { 0x10799, 2, 1, -66799 },
+  { 0x1079B, 1, 1, -66863 }, { 0x1079C, 1, 1, 55144 }, { 0x1079D, 1, 1, -24591 },
+  { 0x1079E, 1, 1, -66864 }, { 0x1079F, 1, 1, 55142 }, { 0x107A0, 1, 1, -66834 },
+  { 0x107A1, 1, 1, 55141 }, { 0x107A2, 1, 1, -67242 }, { 0x107A3, 2, 1, -66861 },
+  { 0x107A5, 1, 1, -67380 }, { 0x107A6, 1, 1, -66860 }, { 0x107A7, 1, 1, 55137 },
+  { 0x107A8, 2, 1, -66859 }, { 0x107AA, 1, 1, -66858 }, { 0x107AB, 1, 1, -66819 },
+  { 0x107AC, 1, 1, -66822 }, { 0x107AD, 1, 1, -23622 }, { 0x107AE, 1, 1, -66823 },
+  { 0x107AF, 1, 1, -66855 }, { 0x107B0, 1, 1, -56127 }, { 0x107B2, 1, 1, -66851 },
+  { 0x107B3, 2, 1, -66834 }, { 0x107B5, 1, 1, -66845 }, { 0x107B6, 3, 1, -67062 },
+  { 0x107B9, 1, 1, 55121 }, { 0x107BA, 1, 1, 55140 }, { 0x10C80, 51, 1, 64 },
+  { 0x118A0, 32, 1, 32 }, { 0x16E40, 32, 1, 32 }, { 0x1D400, 26, 1, -119711 },
+  { 0x1D41A, 26, 1, -119737 }, { 0x1D434, 26, 1, -119763 }, { 0x1D44E, 7, 1, -119789 },
+  { 0x1D456, 18, 1, -119789 }, { 0x1D468, 26, 1, -119815 }, { 0x1D482, 26, 1, -119841 },
+  { 0x1D49C, 2, 2, -119867 }, { 0x1D49F, 1, 1, -119867 }, { 0x1D4A2, 1, 1, -119867 },
+  { 0x1D4A5, 2, 1, -119867 }, { 0x1D4A9, 4, 1, -119867 }, { 0x1D4AE, 8, 1, -119867 },
+  { 0x1D4B6, 4, 1, -119893 }, { 0x1D4BB, 2, 2, -119893 }, { 0x1D4BE, 6, 1, -119893 },
+  { 0x1D4C5, 11, 1, -119893 }, { 0x1D4D0, 26, 1, -119919 }, { 0x1D4EA, 26, 1, -119945 },
+  { 0x1D504, 2, 1, -119971 }, { 0x1D507, 4, 1, -119971 }, { 0x1D50D, 8, 1, -119971 },
+  { 0x1D516, 7, 1, -119971 }, { 0x1D51E, 26, 1, -119997 }, { 0x1D538, 2, 1, -120023 },
+  { 0x1D53B, 4, 1, -120023 }, { 0x1D540, 5, 1, -120023 }, { 0x1D546, 1, 1, -120023 },
+  { 0x1D54A, 7, 1, -120023 }, { 0x1D552, 26, 1, -120049 }, { 0x1D56C, 26, 1, -120075 },
+  { 0x1D586, 26, 1, -120101 }, { 0x1D5A0, 26, 1, -120127 }, { 0x1D5BA, 26, 1, -120153 },
+  { 0x1D5D4, 26, 1, -120179 }, { 0x1D5EE, 26, 1, -120205 }, { 0x1D608, 26, 1, -120231 },
+  { 0x1D622, 26, 1, -120257 }, { 0x1D63C, 26, 1, -120283 }, { 0x1D656, 26, 1, -120309 },
+  { 0x1D670, 26, 1, -120335 }, { 0x1D68A, 26, 1, -120361 }, { 0x1D6A4, 1, 1, -120179 },
+  { 0x1D6A5, 1, 1, -119918 }, { 0x1D6A8, 17, 1, -119543 }, { 0x1D6B9, 1, 1, -119553 },
+  { 0x1D6BA, 7, 1, -119543 }, { 0x1D6C1, 1, 1, -111802 }, { 0x1D6C2, 17, 1, -119569 },
+  { 0x1D6D3, 1, 1, -119568 }, { 0x1D6D4, 7, 1, -119569 }, { 0x1D6DB, 1, 1, -111833 },
+  { 0x1D6DC, 1, 1, -119591 }, { 0x1D6DD, 1, 1, -119589 }, { 0x1D6DE, 1, 1, -119588 },
+  { 0x1D6DF, 1, 1, -119577 }, { 0x1D6E0, 1, 1, -119583 }, { 0x1D6E1, 1, 1, -119585 },
+  { 0x1D6E2, 17, 1, -119601 }, { 0x1D6F3, 1, 1, -119611 }, { 0x1D6F4, 7, 1, -119601 },
+  { 0x1D6FB, 1, 1, -111860 }, { 0x1D6FC, 17, 1, -119627 }, { 0x1D70D, 1, 1, -119626 },
+  { 0x1D70E, 7, 1, -119627 }, { 0x1D715, 1, 1, -111891 }, { 0x1D716, 1, 1, -119649 },
+  { 0x1D717, 1, 1, -119647 }, { 0x1D718, 1, 1, -119646 }, { 0x1D719, 1, 1, -119635 },
+  { 0x1D71A, 1, 1, -119641 }, { 0x1D71B, 1, 1, -119643 }, { 0x1D71C, 17, 1, -119659 },
+  { 0x1D72D, 1, 1, -119669 }, { 0x1D72E, 7, 1, -119659 }, { 0x1D735, 1, 1, -111918 },
+  { 0x1D736, 17, 1, -119685 }, { 0x1D747, 1, 1, -119684 }, { 0x1D748, 7, 1, -119685 },
+  { 0x1D74F, 1, 1, -111949 }, { 0x1D750, 1, 1, -119707 }, { 0x1D751, 1, 1, -119705 },
+  { 0x1D752, 1, 1, -119704 }, { 0x1D753, 1, 1, -119693 }, { 0x1D754, 1, 1, -119699 },
+  { 0x1D755, 1, 1, -119701 }, { 0x1D756, 17, 1, -119717 }, { 0x1D767, 1, 1, -119727 },
+  { 0x1D768, 7, 1, -119717 }, { 0x1D76F, 1, 1, -111976 }, { 0x1D770, 17, 1, -119743 },
+  { 0x1D781, 1, 1, -119742 }, { 0x1D782, 7, 1, -119743 }, { 0x1D789, 1, 1, -112007 },
+  { 0x1D78A, 1, 1, -119765 }, { 0x1D78B, 1, 1, -119763 }, { 0x1D78C, 1, 1, -119762 },
+  { 0x1D78D, 1, 1, -119751 }, { 0x1D78E, 1, 1, -119757 }, { 0x1D78F, 1, 1, -119759 },
+  { 0x1D790, 17, 1, -119775 }, { 0x1D7A1, 1, 1, -119785 }, { 0x1D7A2, 7, 1, -119775 },
+  { 0x1D7A9, 1, 1, -112034 }, { 0x1D7AA, 17, 1, -119801 }, { 0x1D7BB, 1, 1, -119800 },
+  { 0x1D7BC, 7, 1, -119801 }, { 0x1D7C3, 1, 1, -112065 }, { 0x1D7C4, 1, 1, -119823 },
+  { 0x1D7C5, 1, 1, -119821 }, { 0x1D7C6, 1, 1, -119820 }, { 0x1D7C7, 1, 1, -119809 },
+  { 0x1D7C8, 1, 1, -119815 }, { 0x1D7C9, 1, 1, -119817 }, { 0x1D7CA, 1, 1, -119789 },
+  { 0x1D7CB, 1, 1, -119790 }, { 0x1D7CE, 10, 1, -120734 }, { 0x1D7D8, 10, 1, -120744 },
+  { 0x1D7E2, 10, 1, -120754 }, { 0x1D7EC, 10, 1, -120764 }, { 0x1D7F6, 10, 1, -120774 },
+  { 0x1E030, 9, 1, -121856 }, { 0x1E039, 3, 1, -121855 }, { 0x1E03C, 11, 1, -121854 },
+  { 0x1E047, 1, 1, -121852 }, { 0x1E048, 2, 1, -121851 }, { 0x1E04A, 1, 1, -80321 },
+  { 0x1E04B, 1, 1, -121714 }, { 0x1E04C, 1, 1, -121846 }, { 0x1E04D, 1, 1, -121845 },
+  { 0x1E04E, 1, 1, -121701 }, { 0x1E04F, 1, 1, -121760 }, { 0x1E050, 1, 1, -121729 },
+  { 0x1E051, 9, 1, -121889 }, { 0x1E05A, 2, 1, -121888 }, { 0x1E05C, 2, 1, -121886 },
+  { 0x1E05E, 1, 1, -121885 }, { 0x1E05F, 6, 1, -121884 }, { 0x1E065, 2, 1, -121883 },
+  { 0x1E067, 1, 1, -121814 }, { 0x1E068, 1, 1, -121874 }, { 0x1E069, 1, 1, -121876 },
+  { 0x1E06A, 1, 1, -121867 }, { 0x1E06B, 1, 1, -121792 }, { 0x1E06C, 1, 1, -80411 },
+  { 0x1E06D, 1, 1, -121788 }, { 0x1E900, 34, 1, 34 }, { 0x1EE00, 2, 1, -124889 },
+  { 0x1EE02, 1, 1, -124886 }, { 0x1EE03, 1, 1, -124884 }, { 0x1EE05, 1, 1, -124861 },
+  { 0x1EE06, 1, 1, -124884 }, { 0x1EE07, 1, 1, -124890 }, { 0x1EE08, 1, 1, -124881 },
+  { 0x1EE09, 1, 1, -124863 }, { 0x1EE0A, 4, 1, -124871 }, { 0x1EE0E, 1, 1, -124891 },
+  { 0x1EE0F, 1, 1, -124886 }, { 0x1EE10, 1, 1, -124879 }, { 0x1EE11, 1, 1, -124892 },
+  { 0x1EE12, 1, 1, -124880 }, { 0x1EE13, 1, 1, -124898 }, { 0x1EE14, 1, 1, -124896 },
+  { 0x1EE15, 2, 1, -124907 }, { 0x1EE17, 1, 1, -124905 }, { 0x1EE18, 1, 1, -124904 },
+  { 0x1EE19, 1, 1, -124899 }, { 0x1EE1A, 1, 1, -124898 }, { 0x1EE1B, 1, 1, -124897 },
+  { 0x1EE1C, 1, 1, -124846 }, { 0x1EE1D, 1, 1, -124771 }, { 0x1EE1E, 1, 1, -124797 },
+  { 0x1EE1F, 1, 1, -124848 }, { 0x1EE21, 1, 1, -124921 }, { 0x1EE22, 1, 1, -124918 },
+  { 0x1EE24, 1, 1, -124893 }, { 0x1EE27, 1, 1, -124922 }, { 0x1EE29, 1, 1, -124895 },
+  { 0x1EE2A, 4, 1, -124903 }, { 0x1EE2E, 1, 1, -124923 }, { 0x1EE2F, 1, 1, -124918 },
+  { 0x1EE30, 1, 1, -124911 }, { 0x1EE31, 1, 1, -124924 }, { 0x1EE32, 1, 1, -124912 },
+  { 0x1EE34, 1, 1, -124928 }, { 0x1EE35, 2, 1, -124939 }, { 0x1EE37, 1, 1, -124937 },
+  { 0x1EE39, 1, 1, -124931 }, { 0x1EE3B, 1, 1, -124929 }, { 0x1EE42, 1, 1, -124950 },
+  { 0x1EE47, 1, 1, -124954 }, { 0x1EE49, 1, 1, -124927 }, { 0x1EE4B, 2, 2, -124935 },
+  { 0x1EE4E, 1, 1, -124955 }, { 0x1EE4F, 1, 1, -124950 }, { 0x1EE51, 1, 1, -124956 },
+  { 0x1EE52, 1, 1, -124944 }, { 0x1EE54, 1, 1, -124960 }, { 0x1EE57, 1, 1, -124969 },
+  { 0x1EE59, 1, 1, -124963 }, { 0x1EE5B, 1, 1, -124961 }, { 0x1EE5D, 1, 1, -124835 },
+  { 0x1EE5F, 1, 1, -124912 }, { 0x1EE61, 1, 1, -124985 }, { 0x1EE62, 1, 1, -124982 },
+  { 0x1EE64, 1, 1, -124957 }, { 0x1EE67, 1, 1, -124986 }, { 0x1EE68, 1, 1, -124977 },
+  { 0x1EE69, 1, 1, -124959 }, { 0x1EE6A, 2, 2, -124967 }, { 0x1EE6D, 1, 1, -124967 },
+  { 0x1EE6E, 1, 1, -124987 }, { 0x1EE6F, 1, 1, -124982 }, { 0x1EE70, 1, 1, -124975 },
+  { 0x1EE71, 1, 1, -124988 }, { 0x1EE72, 1, 1, -124976 }, { 0x1EE74, 1, 1, -124992 },
+  { 0x1EE75, 2, 1, -125003 }, { 0x1EE77, 1, 1, -125001 }, { 0x1EE79, 1, 1, -124995 },
+  { 0x1EE7A, 1, 1, -124994 }, { 0x1EE7B, 1, 1, -124993 }, { 0x1EE7C, 1, 1, -124942 },
+  { 0x1EE7E, 1, 1, -124893 }, { 0x1EE80, 2, 1, -125017 }, { 0x1EE82, 1, 1, -125014 },
+  { 0x1EE83, 1, 1, -125012 }, { 0x1EE84, 2, 1, -124989 }, { 0x1EE86, 1, 1, -125012 },
+  { 0x1EE87, 1, 1, -125018 }, { 0x1EE88, 1, 1, -125009 }, { 0x1EE89, 1, 1, -124991 },
+  { 0x1EE8B, 3, 1, -124999 }, { 0x1EE8E, 1, 1, -125019 }, { 0x1EE8F, 1, 1, -125014 },
+  { 0x1EE90, 1, 1, -125007 }, { 0x1EE91, 1, 1, -125020 }, { 0x1EE92, 1, 1, -125008 },
+  { 0x1EE93, 1, 1, -125026 }, { 0x1EE94, 1, 1, -125024 }, { 0x1EE95, 2, 1, -125035 },
+  { 0x1EE97, 1, 1, -125033 }, { 0x1EE98, 1, 1, -125032 }, { 0x1EE99, 1, 1, -125027 },
+  { 0x1EE9A, 1, 1, -125026 }, { 0x1EE9B, 1, 1, -125025 }, { 0x1EEA1, 1, 1, -125049 },
+  { 0x1EEA2, 1, 1, -125046 }, { 0x1EEA3, 1, 1, -125044 }, { 0x1EEA5, 1, 1, -125021 },
+  { 0x1EEA6, 1, 1, -125044 }, { 0x1EEA7, 1, 1, -125050 }, { 0x1EEA8, 1, 1, -125041 },
+  { 0x1EEA9, 1, 1, -125023 }, { 0x1EEAB, 3, 1, -125031 }, { 0x1EEAE, 1, 1, -125051 },
+  { 0x1EEAF, 1, 1, -125046 }, { 0x1EEB0, 1, 1, -125039 }, { 0x1EEB1, 1, 1, -125052 },
+  { 0x1EEB2, 1, 1, -125040 }, { 0x1EEB3, 1, 1, -125058 }, { 0x1EEB4, 1, 1, -125056 },
+  { 0x1EEB5, 2, 1, -125067 }, { 0x1EEB7, 1, 1, -125065 }, { 0x1EEB8, 1, 1, -125064 },
+  { 0x1EEB9, 1, 1, -125059 }, { 0x1EEBA, 1, 1, -125058 }, { 0x1EEBB, 1, 1, -125057 },
+  { 0x1F12B, 1, 1, -127176 }, { 0x1F12C, 1, 1, -127162 }, { 0x1F130, 26, 1, -127183 },
+  { 0x1F202, 1, 1, -115021 }, { 0x1F210, 1, 1, -102341 }, { 0x1F211, 1, 1, -104122 },
+  { 0x1F212, 1, 1, -106054 }, { 0x1F213, 1, 1, -115020 }, { 0x1F214, 1, 1, -107400 },
+  { 0x1F215, 1, 1, -104699 }, { 0x1F216, 1, 1, -92211 }, { 0x1F217, 1, 1, -104686 },
+  { 0x1F218, 1, 1, -107380 }, { 0x1F219, 1, 1, -101369 }, { 0x1F21A, 1, 1, -98553 },
+  { 0x1F21B, 1, 1, -101506 }, { 0x1F21C, 1, 1, -106447 }, { 0x1F21D, 1, 1, -103057 },
+  { 0x1F21E, 1, 1, -106641 }, { 0x1F21F, 1, 1, -101487 }, { 0x1F220, 1, 1, -106499 },
+  { 0x1F221, 1, 1, -95455 }, { 0x1F222, 1, 1, -97539 }, { 0x1F223, 1, 1, -91514 },
+  { 0x1F224, 1, 1, -104756 }, { 0x1F225, 1, 1, -105964 }, { 0x1F226, 1, 1, -99090 },
+  { 0x1F227, 1, 1, -102290 }, { 0x1F228, 1, 1, -102099 }, { 0x1F229, 1, 1, -107561 },
+  { 0x1F22A, 1, 1, -107553 }, { 0x1F22B, 1, 1, -90593 }, { 0x1F22C, 1, 1, -103494 },
+  { 0x1F22D, 1, 1, -107520 }, { 0x1F22E, 1, 1, -106043 }, { 0x1F22F, 1, 1, -102184 },
+  { 0x1F230, 1, 1, -91328 }, { 0x1F231, 1, 1, -102366 }, { 0x1F232, 1, 1, -96433 },
+  { 0x1F233, 1, 1, -96185 }, { 0x1F234, 1, 1, -106028 }, { 0x1F235, 1, 1, -99253 },
+  { 0x1F236, 1, 1, -101165 }, { 0x1F237, 1, 1, -101167 }, { 0x1F238, 1, 1, -97541 },
+  { 0x1F239, 1, 1, -106439 }, { 0x1F23A, 1, 1, -105604 }, { 0x1F23B, 1, 1, -90350 },
+  { 0x1F250, 1, 1, -103097 }, { 0x1F251, 1, 1, -106082 }, { 0x1FBF0, 10, 1, -129984 },
+  { 0x2F800, 1, 1, -174531 }, { 0x2F801, 1, 1, -174537 }, { 0x2F802, 1, 1, -174529 },
+  { 0x2F803, 1, 1, -63201 }, { 0x2F804, 1, 1, -174244 }, { 0x2F805, 1, 1, -174167 },
+  { 0x2F806, 1, 1, -174155 }, { 0x2F807, 1, 1, -174085 }, { 0x2F808, 1, 1, -173966 },
+  { 0x2F809, 1, 1, -173936 }, { 0x2F80A, 1, 1, -173859 }, { 0x2F80B, 1, 1, -173884 },
+  { 0x2F80C, 1, 1, -181102 }, { 0x2F80D, 1, 1, -61907 }, { 0x2F80E, 1, 1, -173761 },
+  { 0x2F80F, 1, 1, -173755 }, { 0x2F810, 1, 1, -173740 }, { 0x2F811, 1, 1, -173722 },
+  { 0x2F812, 1, 1, -62198 }, { 0x2F813, 1, 1, -181082 }, { 0x2F814, 1, 1, -173741 },
+  { 0x2F815, 1, 1, -173704 }, { 0x2F816, 1, 1, -62155 }, { 0x2F817, 1, 1, -173696 },
+  { 0x2F818, 1, 1, -173684 }, { 0x2F819, 1, 1, -174413 }, { 0x2F81A, 1, 1, -173678 },
+  { 0x2F81B, 1, 1, -173670 }, { 0x2F81C, 1, 1, -26173 }, { 0x2F81D, 1, 1, -173608 },
+  { 0x2F81E, 1, 1, -173595 }, { 0x2F81F, 1, 1, -181056 }, { 0x2F820, 1, 1, -173541 },
+  { 0x2F821, 1, 1, -173531 }, { 0x2F822, 1, 1, -173488 }, { 0x2F823, 1, 1, -173484 },
+  { 0x2F824, 1, 1, -181007 }, { 0x2F825, 1, 1, -173406 }, { 0x2F826, 1, 1, -173405 },
+  { 0x2F827, 1, 1, -173379 }, { 0x2F828, 1, 1, -173358 }, { 0x2F829, 2, 1, -173348 },
+  { 0x2F82B, 1, 1, -173332 }, { 0x2F82C, 1, 1, -173283 }, { 0x2F82D, 1, 1, -173276 },
+  { 0x2F82E, 1, 1, -173268 }, { 0x2F82F, 1, 1, -173244 }, { 0x2F830, 1, 1, -173235 },
+  { 0x2F831, 1, 1, -173234 }, { 0x2F832, 1, 1, -173235 }, { 0x2F833, 1, 1, -173236 },
+  { 0x2F834, 1, 1, -60936 }, { 0x2F835, 1, 1, -165829 }, { 0x2F836, 1, 1, -173164 },
+  { 0x2F837, 1, 1, -173144 }, { 0x2F838, 1, 1, -60629 }, { 0x2F839, 1, 1, -173134 },
+  { 0x2F83A, 1, 1, -173129 }, { 0x2F83B, 1, 1, -173109 }, { 0x2F83C, 1, 1, -172958 },
+  { 0x2F83D, 1, 1, -173061 }, { 0x2F83E, 1, 1, -173046 }, { 0x2F83F, 1, 1, -173015 },
+  { 0x2F840, 1, 1, -172958 }, { 0x2F841, 1, 1, -172875 }, { 0x2F842, 1, 1, -172850 },
+  { 0x2F843, 1, 1, -172784 }, { 0x2F844, 1, 1, -172769 }, { 0x2F845, 1, 1, -172737 },
+  { 0x2F846, 1, 1, -172738 }, { 0x2F847, 1, 1, -172718 }, { 0x2F848, 1, 1, -172701 },
+  { 0x2F849, 1, 1, -172694 }, { 0x2F84A, 1, 1, -172680 }, { 0x2F84B, 1, 1, -172341 },
+  { 0x2F84C, 1, 1, -172614 }, { 0x2F84D, 1, 1, -172342 }, { 0x2F84E, 1, 1, -172541 },
+  { 0x2F84F, 1, 1, -172507 }, { 0x2F850, 1, 1, -173641 }, { 0x2F851, 1, 1, -171875 },
+  { 0x2F852, 1, 1, -172164 }, { 0x2F853, 1, 1, -172127 }, { 0x2F854, 1, 1, -172103 },
+  { 0x2F855, 1, 1, -172234 }, { 0x2F856, 1, 1, -172068 }, { 0x2F857, 1, 1, -172070 },
+  { 0x2F858, 1, 1, -171948 }, { 0x2F859, 1, 1, -58229 }, { 0x2F85A, 1, 1, -171880 },
+  { 0x2F85B, 1, 1, -171876 }, { 0x2F85C, 1, 1, -171862 }, { 0x2F85D, 1, 1, -171843 },
+  { 0x2F85E, 1, 1, -171836 }, { 0x2F85F, 1, 1, -171773 }, { 0x2F860, 1, 1, -57784 },
+  { 0x2F861, 1, 1, -57719 }, { 0x2F862, 1, 1, -171638 }, { 0x2F863, 1, 1, -171592 },
+  { 0x2F864, 1, 1, -171581 }, { 0x2F865, 1, 1, -171661 }, { 0x2F866, 1, 1, -171520 },
+  { 0x2F867, 1, 1, -180601 }, { 0x2F869, 1, 1, -171361 }, { 0x2F86A, 1, 1, -171308 },
+  { 0x2F86B, 1, 1, -171309 }, { 0x2F86C, 1, 1, -56996 }, { 0x2F86D, 1, 1, -171178 },
+  { 0x2F86E, 1, 1, -171158 }, { 0x2F86F, 1, 1, -171144 }, { 0x2F870, 1, 1, -171133 },
+  { 0x2F871, 1, 1, -56665 }, { 0x2F872, 1, 1, -171123 }, { 0x2F873, 1, 1, -171117 },
+  { 0x2F875, 1, 1, -171091 }, { 0x2F876, 1, 1, -180469 }, { 0x2F877, 1, 1, -171031 },
+  { 0x2F878, 1, 1, -171018 }, { 0x2F879, 1, 1, -170937 }, { 0x2F87A, 1, 1, -170989 },
+  { 0x2F87B, 1, 1, -55959 }, { 0x2F87C, 1, 1, -170809 }, { 0x2F87D, 1, 1, -55959 },
+  { 0x2F87E, 1, 1, -170768 }, { 0x2F87F, 1, 1, -170772 }, { 0x2F880, 1, 1, -170756 },
+  { 0x2F881, 2, 1, -170656 }, { 0x2F883, 1, 1, -180308 }, { 0x2F884, 1, 1, -170631 },
+  { 0x2F885, 1, 1, -170589 }, { 0x2F886, 1, 1, -170569 }, { 0x2F887, 1, 1, -170526 },
+  { 0x2F888, 1, 1, -180262 }, { 0x2F889, 1, 1, -55046 }, { 0x2F88A, 1, 1, -180238 },
+  { 0x2F88B, 1, 1, -170459 }, { 0x2F88C, 1, 1, -170457 }, { 0x2F88D, 1, 1, -170455 },
+  { 0x2F88E, 1, 1, -170436 }, { 0x2F88F, 1, 1, -21757 }, { 0x2F890, 1, 1, -170386 },
+  { 0x2F891, 1, 1, -54624 }, { 0x2F892, 1, 1, -54625 }, { 0x2F893, 1, 1, -161426 },
+  { 0x2F894, 1, 1, -170354 }, { 0x2F895, 1, 1, -170355 }, { 0x2F896, 1, 1, -180175 },
+  { 0x2F897, 1, 1, -50655 }, { 0x2F898, 1, 1, -38590 }, { 0x2F899, 1, 1, -170295 },
+  { 0x2F89A, 1, 1, -170287 }, { 0x2F89B, 1, 1, -180152 }, { 0x2F89C, 1, 1, -170242 },
+  { 0x2F89D, 1, 1, -170192 }, { 0x2F89E, 1, 1, -170183 }, { 0x2F89F, 1, 1, -170150 },
+  { 0x2F8A0, 1, 1, -170015 }, { 0x2F8A1, 1, 1, -180071 }, { 0x2F8A2, 1, 1, -180102 },
+  { 0x2F8A3, 1, 1, -169999 }, { 0x2F8A4, 1, 1, -53712 }, { 0x2F8A5, 1, 1, -169950 },
+  { 0x2F8A6, 1, 1, -169822 }, { 0x2F8A7, 1, 1, -169819 }, { 0x2F8A8, 1, 1, -169818 },
+  { 0x2F8A9, 1, 1, -169821 }, { 0x2F8AA, 1, 1, -169776 }, { 0x2F8AB, 1, 1, -169757 },
+  { 0x2F8AC, 1, 1, -169722 }, { 0x2F8AD, 1, 1, -169737 }, { 0x2F8AE, 1, 1, -169727 },
+  { 0x2F8AF, 1, 1, -169681 }, { 0x2F8B0, 1, 1, -169662 }, { 0x2F8B1, 1, 1, -169659 },
+  { 0x2F8B2, 1, 1, -169634 }, { 0x2F8B3, 1, 1, -169624 }, { 0x2F8B4, 1, 1, -169559 },
+  { 0x2F8B5, 1, 1, -169476 }, { 0x2F8B6, 1, 1, -169442 }, { 0x2F8B7, 1, 1, -169319 },
+  { 0x2F8B8, 1, 1, -52652 }, { 0x2F8B9, 1, 1, -169340 }, { 0x2F8BA, 1, 1, -169406 },
+  { 0x2F8BB, 1, 1, -169299 }, { 0x2F8BC, 1, 1, -169273 }, { 0x2F8BD, 1, 1, -169177 },
+  { 0x2F8BE, 1, 1, -52429 }, { 0x2F8BF, 1, 1, -169117 }, { 0x2F8C0, 1, 1, -169211 },
+  { 0x2F8C1, 1, 1, -169240 }, { 0x2F8C2, 1, 1, -179860 }, { 0x2F8C3, 1, 1, -169050 },
+  { 0x2F8C4, 1, 1, -169030 }, { 0x2F8C5, 1, 1, -169000 }, { 0x2F8C6, 1, 1, -169039 },
+  { 0x2F8C7, 1, 1, -179803 }, { 0x2F8C8, 1, 1, -168825 }, { 0x2F8C9, 1, 1, -168797 },
+  { 0x2F8CA, 1, 1, -51392 }, { 0x2F8CB, 1, 1, -168680 }, { 0x2F8CC, 1, 1, -168404 },
+  { 0x2F8CD, 1, 1, -168580 }, { 0x2F8CE, 1, 1, -179637 }, { 0x2F8CF, 1, 1, -168510 },
+  { 0x2F8D0, 1, 1, -179656 }, { 0x2F8D1, 1, 1, -179693 }, { 0x2F8D2, 1, 1, -173888 },
+  { 0x2F8D3, 1, 1, -173886 }, { 0x2F8D4, 1, 1, -168404 }, { 0x2F8D5, 1, 1, -168505 },
+  { 0x2F8D6, 1, 1, -161833 }, { 0x2F8D7, 1, 1, -177406 }, { 0x2F8D8, 1, 1, -168385 },
+  { 0x2F8D9, 1, 1, -168382 }, { 0x2F8DA, 1, 1, -168377 }, { 0x2F8DB, 1, 1, -168317 },
+  { 0x2F8DC, 1, 1, -168329 }, { 0x2F8DD, 1, 1, -50458 }, { 0x2F8DE, 1, 1, -179605 },
+  { 0x2F8DF, 1, 1, -168165 }, { 0x2F8E0, 1, 1, -168283 }, { 0x2F8E1, 1, 1, -168079 },
+  { 0x2F8E2, 1, 1, -168029 }, { 0x2F8E3, 1, 1, -50294 }, { 0x2F8E4, 1, 1, -168022 },
+  { 0x2F8E5, 1, 1, -168134 }, { 0x2F8E6, 1, 1, -167890 }, { 0x2F8E7, 1, 1, -179530 },
+  { 0x2F8E8, 1, 1, -167846 }, { 0x2F8E9, 1, 1, -167750 }, { 0x2F8EA, 1, 1, -167680 },
+  { 0x2F8EB, 1, 1, -167491 }, { 0x2F8EC, 1, 1, -49737 }, { 0x2F8ED, 1, 1, -167442 },
+  { 0x2F8EE, 1, 1, -179414 }, { 0x2F8EF, 1, 1, -167374 }, { 0x2F8F0, 1, 1, -49225 },
+  { 0x2F8F1, 1, 1, -167325 }, { 0x2F8F2, 1, 1, -179364 }, { 0x2F8F3, 1, 1, -167297 },
+  { 0x2F8F4, 1, 1, -167253 }, { 0x2F8F5, 2, 1, -167227 }, { 0x2F8F7, 1, 1, -48746 },
+  { 0x2F8F8, 1, 1, -56301 }, { 0x2F8F9, 1, 1, -48639 }, { 0x2F8FA, 1, 1, -167084 },
+  { 0x2F8FB, 1, 1, -48191 }, { 0x2F8FC, 1, 1, -166973 }, { 0x2F8FD, 1, 1, -166960 },
+  { 0x2F8FE, 1, 1, -167063 }, { 0x2F8FF, 1, 1, -166889 }, { 0x2F900, 1, 1, -166850 },
+  { 0x2F901, 1, 1, -166794 }, { 0x2F902, 1, 1, -166849 }, { 0x2F903, 1, 1, -166810 },
+  { 0x2F904, 1, 1, -166796 }, { 0x2F905, 1, 1, -166784 }, { 0x2F906, 1, 1, -48104 },
+  { 0x2F907, 1, 1, -166867 }, { 0x2F908, 1, 1, -166617 }, { 0x2F909, 1, 1, -166555 },
+  { 0x2F90A, 1, 1, -179159 }, { 0x2F90B, 1, 1, -166464 }, { 0x2F90C, 1, 1, -166469 },
+  { 0x2F90D, 1, 1, -47676 }, { 0x2F90E, 1, 1, -166677 }, { 0x2F90F, 1, 1, -166305 },
+  { 0x2F910, 1, 1, -47538 }, { 0x2F911, 1, 1, -47491 }, { 0x2F912, 1, 1, -166220 },
+  { 0x2F913, 1, 1, -166106 }, { 0x2F914, 1, 1, -166134 }, { 0x2F915, 1, 1, -166138 },
+  { 0x2F916, 1, 1, -179072 }, { 0x2F917, 1, 1, -166093 }, { 0x2F918, 1, 1, -166043 },
+  { 0x2F919, 1, 1, -166050 }, { 0x2F91A, 1, 1, -165997 }, { 0x2F91B, 1, 1, -62454 },
+  { 0x2F91C, 1, 1, -165847 }, { 0x2F91D, 1, 1, -46778 }, { 0x2F91E, 1, 1, -165762 },
+  { 0x2F920, 1, 1, -165624 }, { 0x2F921, 1, 1, -165612 }, { 0x2F922, 1, 1, -165586 },
+  { 0x2F923, 1, 1, -45851 }, { 0x2F924, 1, 1, -165540 }, { 0x2F925, 1, 1, -165520 },
+  { 0x2F926, 1, 1, -45553 }, { 0x2F927, 1, 1, -45331 }, { 0x2F928, 1, 1, -165294 },
+  { 0x2F929, 1, 1, -165278 }, { 0x2F92A, 1, 1, -178814 }, { 0x2F92B, 1, 1, -165254 },
+  { 0x2F92C, 1, 1, -178804 }, { 0x2F92D, 1, 1, -178805 }, { 0x2F92E, 1, 1, -165095 },
+  { 0x2F92F, 1, 1, -165075 }, { 0x2F930, 1, 1, -165055 }, { 0x2F931, 1, 1, -165036 },
+  { 0x2F932, 1, 1, -164968 }, { 0x2F933, 1, 1, -178712 }, { 0x2F934, 1, 1, -164880 },
+  { 0x2F935, 1, 1, -44287 }, { 0x2F936, 1, 1, -164856 }, { 0x2F937, 1, 1, -44197 },
+  { 0x2F938, 1, 1, -164808 }, { 0x2F939, 1, 1, -55194 }, { 0x2F93A, 1, 1, -164650 },
+  { 0x2F93B, 1, 1, -43418 }, { 0x2F93C, 1, 1, -43396 }, { 0x2F93D, 1, 1, -43257 },
+  { 0x2F93E, 1, 1, -178498 }, { 0x2F93F, 1, 1, -178487 }, { 0x2F940, 1, 1, -164428 },
+  { 0x2F941, 1, 1, -43086 }, { 0x2F942, 1, 1, -43088 }, { 0x2F943, 1, 1, -43050 },
+  { 0x2F944, 1, 1, -43025 }, { 0x2F945, 2, 1, -164391 }, { 0x2F947, 1, 1, -164392 },
+  { 0x2F948, 1, 1, -164350 }, { 0x2F949, 1, 1, -178448 }, { 0x2F94A, 1, 1, -164287 },
+  { 0x2F94B, 1, 1, -178437 }, { 0x2F94C, 1, 1, -178358 }, { 0x2F94D, 1, 1, -42288 },
+  { 0x2F94E, 1, 1, -164096 }, { 0x2F94F, 1, 1, -164035 }, { 0x2F950, 1, 1, -163972 },
+  { 0x2F951, 1, 1, -178286 }, { 0x2F952, 1, 1, -41772 }, { 0x2F953, 1, 1, -163837 },
+  { 0x2F954, 1, 1, -41658 }, { 0x2F955, 1, 1, -41616 }, { 0x2F956, 1, 1, -163783 },
+  { 0x2F957, 1, 1, -163692 }, { 0x2F958, 1, 1, -178217 }, { 0x2F959, 1, 1, -163609 },
+  { 0x2F95A, 1, 1, -163600 }, { 0x2F95B, 1, 1, -163596 }, { 0x2F95C, 1, 1, -40928 },
+  { 0x2F95D, 1, 1, -40630 }, { 0x2F95E, 1, 1, -40631 }, { 0x2F960, 1, 1, -178014 },
+  { 0x2F961, 1, 1, -40374 }, { 0x2F962, 1, 1, -163228 }, { 0x2F963, 1, 1, -163226 },
+  { 0x2F964, 1, 1, -177981 }, { 0x2F965, 1, 1, -40165 }, { 0x2F966, 1, 1, -162964 },
+  { 0x2F967, 1, 1, -177863 }, { 0x2F968, 1, 1, -162944 }, { 0x2F969, 1, 1, -162950 },
+  { 0x2F96A, 1, 1, -162922 }, { 0x2F96B, 1, 1, -39397 }, { 0x2F96C, 1, 1, -162825 },
+  { 0x2F96D, 1, 1, -177772 }, { 0x2F96E, 1, 1, -162727 }, { 0x2F96F, 1, 1, -162669 },
+  { 0x2F970, 1, 1, -162603 }, { 0x2F971, 1, 1, -177725 }, { 0x2F972, 1, 1, -38730 },
+  { 0x2F973, 1, 1, -38700 }, { 0x2F974, 1, 1, -177691 }, { 0x2F975, 1, 1, -38556 },
+  { 0x2F976, 1, 1, -162300 }, { 0x2F977, 1, 1, -38457 }, { 0x2F978, 1, 1, -162275 },
+  { 0x2F979, 1, 1, -162175 }, { 0x2F97A, 1, 1, -162165 }, { 0x2F97B, 1, 1, -38049 },
+  { 0x2F97C, 1, 1, -37977 }, { 0x2F97D, 1, 1, -162077 }, { 0x2F97E, 1, 1, -37846 },
+  { 0x2F97F, 1, 1, -162063 }, { 0x2F980, 1, 1, -50721 }, { 0x2F981, 1, 1, -177580 },
+  { 0x2F982, 1, 1, -162000 }, { 0x2F983, 1, 1, -161920 }, { 0x2F984, 1, 1, -177529 },
+  { 0x2F985, 1, 1, -161863 }, { 0x2F986, 1, 1, -171729 }, { 0x2F987, 1, 1, -37344 },
+  { 0x2F988, 1, 1, -37331 }, { 0x2F989, 1, 1, -50678 }, { 0x2F98A, 1, 1, -50670 },
+  { 0x2F98B, 1, 1, -161674 }, { 0x2F98C, 1, 1, -161672 }, { 0x2F98D, 1, 1, -158191 },
+  { 0x2F98E, 1, 1, -177443 }, { 0x2F98F, 1, 1, -161534 }, { 0x2F990, 1, 1, -161541 },
+  { 0x2F991, 1, 1, -161524 }, { 0x2F992, 1, 1, -173791 }, { 0x2F993, 1, 1, -161506 },
+  { 0x2F994, 1, 1, -161505 }, { 0x2F995, 1, 1, -161496 }, { 0x2F996, 1, 1, -161456 },
+  { 0x2F997, 1, 1, -36443 }, { 0x2F998, 1, 1, -161459 }, { 0x2F999, 1, 1, -161404 },
+  { 0x2F99A, 1, 1, -161335 }, { 0x2F99B, 1, 1, -161262 }, { 0x2F99C, 1, 1, -161401 },
+  { 0x2F99D, 1, 1, -161248 }, { 0x2F99E, 1, 1, -161207 }, { 0x2F99F, 1, 1, -161096 },
+  { 0x2F9A0, 1, 1, -161357 }, { 0x2F9A1, 1, 1, -161239 }, { 0x2F9A2, 1, 1, -161238 },
+  { 0x2F9A3, 1, 1, -161223 }, { 0x2F9A4, 1, 1, -36206 }, { 0x2F9A5, 1, 1, -35898 },
+  { 0x2F9A6, 1, 1, -36049 }, { 0x2F9A7, 1, 1, -177276 }, { 0x2F9A8, 1, 1, -160951 },
+  { 0x2F9A9, 1, 1, -160950 }, { 0x2F9AA, 1, 1, -160916 }, { 0x2F9AB, 1, 1, -34273 },
+  { 0x2F9AC, 1, 1, -160840 }, { 0x2F9AD, 1, 1, -35457 }, { 0x2F9AE, 1, 1, -177233 },
+  { 0x2F9AF, 1, 1, -177230 }, { 0x2F9B0, 1, 1, -35327 }, { 0x2F9B1, 1, 1, -35039 },
+  { 0x2F9B2, 1, 1, -177223 }, { 0x2F9B3, 1, 1, -160611 }, { 0x2F9B4, 1, 1, -160600 },
+  { 0x2F9B5, 1, 1, -160590 }, { 0x2F9B6, 1, 1, -160589 }, { 0x2F9B7, 1, 1, -160526 },
+  { 0x2F9B8, 1, 1, -160560 }, { 0x2F9B9, 1, 1, -160427 }, { 0x2F9BA, 1, 1, -160472 },
+  { 0x2F9BB, 1, 1, -160322 }, { 0x2F9BC, 1, 1, -160404 }, { 0x2F9BD, 1, 1, -160338 },
+  { 0x2F9BE, 1, 1, -160312 }, { 0x2F9C0, 1, 1, -160223 }, { 0x2F9C1, 1, 1, -160192 },
+  { 0x2F9C2, 1, 1, -177097 }, { 0x2F9C3, 1, 1, -160099 }, { 0x2F9C4, 1, 1, -160097 },
+  { 0x2F9C5, 1, 1, -33630 }, { 0x2F9C6, 1, 1, -159983 }, { 0x2F9C7, 1, 1, -159977 },
+  { 0x2F9C8, 1, 1, -177043 }, { 0x2F9C9, 1, 1, -159951 }, { 0x2F9CA, 1, 1, -181519 },
+  { 0x2F9CB, 1, 1, -33053 }, { 0x2F9CC, 1, 1, -32870 }, { 0x2F9CD, 1, 1, -176911 },
+  { 0x2F9CE, 1, 1, -176903 }, { 0x2F9CF, 1, 1, -159535 }, { 0x2F9D0, 1, 1, -159459 },
+  { 0x2F9D1, 1, 1, -159303 }, { 0x2F9D2, 1, 1, -159101 }, { 0x2F9D3, 1, 1, -32043 },
+  { 0x2F9D4, 1, 1, -159017 }, { 0x2F9D5, 1, 1, -158996 }, { 0x2F9D6, 1, 1, -158907 },
+  { 0x2F9D7, 1, 1, -158816 }, { 0x2F9D8, 1, 1, -31401 }, { 0x2F9D9, 1, 1, -61909 },
+  { 0x2F9DA, 1, 1, -158735 }, { 0x2F9DB, 1, 1, -158751 }, { 0x2F9DC, 1, 1, -158700 },
+  { 0x2F9DD, 1, 1, -61695 }, { 0x2F9DE, 1, 1, -158474 }, { 0x2F9DF, 1, 1, -158375 },
+  { 0x2F9E0, 1, 1, -29710 }, { 0x2F9E1, 1, 1, -29684 }, { 0x2F9E2, 1, 1, -158030 },
+  { 0x2F9E3, 1, 1, -157938 }, { 0x2F9E4, 1, 1, -157907 }, { 0x2F9E5, 1, 1, -29367 },
+  { 0x2F9E6, 1, 1, -157899 }, { 0x2F9E7, 1, 1, -157615 }, { 0x2F9E8, 2, 1, -157457 },
+  { 0x2F9EA, 1, 1, -157550 }, { 0x2F9EB, 1, 1, -157170 }, { 0x2F9EC, 1, 1, -157143 },
+  { 0x2F9ED, 1, 1, -28147 }, { 0x2F9EE, 1, 1, -156771 }, { 0x2F9EF, 1, 1, -176218 },
+  { 0x2F9F0, 1, 1, -156729 }, { 0x2F9F1, 1, 1, -27770 }, { 0x2F9F2, 1, 1, -176140 },
+  { 0x2F9F3, 1, 1, -156464 }, { 0x2F9F4, 1, 1, -171074 }, { 0x2F9F5, 1, 1, -156370 },
+  { 0x2F9F6, 1, 1, -26801 }, { 0x2F9F7, 1, 1, -26589 }, { 0x2F9F8, 1, 1, -176010 },
+  { 0x2F9F9, 1, 1, -176003 }, { 0x2F9FA, 1, 1, -156186 }, { 0x2F9FB, 1, 1, -26097 },
+  { 0x2F9FC, 1, 1, -175946 }, { 0x2F9FD, 1, 1, -25959 }, { 0x2F9FE, 1, 1, -156147 },
+  { 0x2F9FF, 1, 1, -156148 }, { 0x2FA00, 1, 1, -156119 }, { 0x2FA01, 1, 1, -25675 },
+  { 0x2FA02, 1, 1, -155936 }, { 0x2FA03, 1, 1, -175824 }, { 0x2FA04, 1, 1, -155867 },
+  { 0x2FA05, 1, 1, -155742 }, { 0x2FA06, 1, 1, -155716 }, { 0x2FA07, 1, 1, -155657 },
+  { 0x2FA08, 1, 1, -175674 }, { 0x2FA09, 1, 1, -24281 }, { 0x2FA0A, 1, 1, -155384 },
+  { 0x2FA0B, 1, 1, -155083 }, { 0x2FA0C, 1, 1, -154895 }, { 0x2FA0D, 1, 1, -175423 },
+  { 0x2FA0E, 1, 1, -175393 }, { 0x2FA0F, 1, 1, -154792 }, { 0x2FA10, 1, 1, -22850 },
+  { 0x2FA11, 1, 1, -175385 }, { 0x2FA12, 1, 1, -22797 }, { 0x2FA13, 1, 1, -22533 },
+  { 0x2FA14, 1, 1, -22403 }, { 0x2FA15, 1, 1, -154458 }, { 0x2FA16, 1, 1, -175296 },
+  { 0x2FA17, 1, 1, -154398 }, { 0x2FA18, 1, 1, -154394 }, { 0x2FA19, 1, 1, -154388 },
+  { 0x2FA1A, 1, 1, -154379 }, { 0x2FA1B, 1, 1, -154373 }, { 0x2FA1C, 1, 1, -154337 },
+  { 0x2FA1D, 1, 1, -21533 },
+};
+
+/** These are the mappings of code points mapped to many */
+inline constexpr Expansion EXPANSIONS[] = {
+  { 0xA8, 0, 2 }, { 0xAF, 2, 2 }, { 0xB4, 4, 2 }, { 0xB8, 6, 2 }, { 0xBC, 8, 3 }, { 0xBD, 11, 3 },
+  { 0xBE, 14, 3 }, { 0x130, 17, 2 }, { 0x132, 19, 2 }, { 0x133, 21, 2 }, { 0x13F, 23, 2 },
+  { 0x140, 25, 2 }, { 0x149, 27, 2 }, { 0x1C4, 29, 2 }, { 0x1C5, 31, 2 }, { 0x1C6, 33, 2 },
+  { 0x1C7, 35, 2 }, { 0x1C8, 37, 2 }, { 0x1C9, 39, 2 }, { 0x1CA, 41, 2 }, { 0x1CB, 43, 2 },
+  { 0x1CC, 45, 2 }, { 0x1F1, 47, 2 }, { 0x1F2, 49, 2 }, { 0x1F3, 51, 2 }, { 0x2D8, 53, 2 },
+  { 0x2D9, 55, 2 }, { 0x2DA, 57, 2 }, { 0x2DB, 59, 2 }, { 0x2DC, 61, 2 }, { 0x2DD, 63, 2 },
+  { 0x344, 65, 2 }, { 0x37A, 67, 2 }, { 0x384, 69, 2 }, { 0x385, 71, 3 }, { 0x587, 74, 2 },
+  { 0x675, 76, 2 }, { 0x676, 78, 2 }, { 0x677, 80, 2 }, { 0x678, 82, 2 }, { 0x958, 84, 2 },
+  { 0x959, 86, 2 }, { 0x95A, 88, 2 }, { 0x95B, 90, 2 }, { 0x95C, 92, 2 }, { 0x95D, 94, 2 },
+  { 0x95E, 96, 2 }, { 0x95F, 98, 2 }, { 0x9DC, 100, 2 }, { 0x9DD, 102, 2 }, { 0x9DF, 104, 2 },
+  { 0xA33, 106, 2 }, { 0xA36, 108, 2 }, { 0xA59, 110, 2 }, { 0xA5A, 112, 2 }, { 0xA5B, 114, 2 },
+  { 0xA5E, 116, 2 }, { 0xB5C, 118, 2 }, { 0xB5D, 120, 2 }, { 0xE33, 122, 2 }, { 0xEB3, 124, 2 },
+  { 0xEDC, 126, 2 }, { 0xEDD, 128, 2 }, { 0xF43, 130, 2 }, { 0xF4D, 132, 2 }, { 0xF52, 134, 2 },
+  { 0xF57, 136, 2 }, { 0xF5C, 138, 2 }, { 0xF69, 140, 2 }, { 0xF73, 142, 2 }, { 0xF75, 144, 2 },
+  { 0xF76, 146, 2 }, { 0xF77, 148, 3 }, { 0xF78, 151, 2 }, { 0xF79, 153, 3 }, { 0xF81, 156, 2 },
+  { 0xF93, 158, 2 }, { 0xF9D, 160, 2 }, { 0xFA2, 162, 2 }, { 0xFA7, 164, 2 }, { 0xFAC, 166, 2 },
+  { 0xFB9, 168, 2 }, { 0x1E9A, 170, 2 }, { 0x1F80, 172, 2 }, { 0x1F81, 174, 2 }, { 0x1F82, 176, 2 },
+  { 0x1F83, 178, 2 }, { 0x1F84, 180, 2 }, { 0x1F85, 182, 2 }, { 0x1F86, 184, 2 },
+  { 0x1F87, 186, 2 }, { 0x1F88, 188, 2 }, { 0x1F89, 190, 2 }, { 0x1F8A, 192, 2 },
+  { 0x1F8B, 194, 2 }, { 0x1F8C, 196, 2 }, { 0x1F8D, 198, 2 }, { 0x1F8E, 200, 2 },
+  { 0x1F8F, 202, 2 }, { 0x1F90, 204, 2 }, { 0x1F91, 206, 2 }, { 0x1F92, 208, 2 },
+  { 0x1F93, 210, 2 }, { 0x1F94, 212, 2 }, { 0x1F95, 214, 2 }, { 0x1F96, 216, 2 },
+  { 0x1F97, 218, 2 }, { 0x1F98, 220, 2 }, { 0x1F99, 222, 2 }, { 0x1F9A, 224, 2 },
+  { 0x1F9B, 226, 2 }, { 0x1F9C, 228, 2 }, { 0x1F9D, 230, 2 }, { 0x1F9E, 232, 2 },
+  { 0x1F9F, 234, 2 }, { 0x1FA0, 236, 2 }, { 0x1FA1, 238, 2 }, { 0x1FA2, 240, 2 },
+  { 0x1FA3, 242, 2 }, { 0x1FA4, 244, 2 }, { 0x1FA5, 246, 2 }, { 0x1FA6, 248, 2 },
+  { 0x1FA7, 250, 2 }, { 0x1FA8, 252, 2 }, { 0x1FA9, 254, 2 }, { 0x1FAA, 256, 2 },
+  { 0x1FAB, 258, 2 }, { 0x1FAC, 260, 2 }, { 0x1FAD, 262, 2 }, { 0x1FAE, 264, 2 },
+  { 0x1FAF, 266, 2 }, { 0x1FB2, 268, 2 }, { 0x1FB3, 270, 2 }, { 0x1FB4, 272, 2 },
+  { 0x1FB7, 274, 2 }, { 0x1FBC, 276, 2 }, { 0x1FBD, 278, 2 }, { 0x1FBF, 280, 2 },
+  { 0x1FC0, 282, 2 }, { 0x1FC1, 284, 3 }, { 0x1FC2, 287, 2 }, { 0x1FC3, 289, 2 },
+  { 0x1FC4, 291, 2 }, { 0x1FC7, 293, 2 }, { 0x1FCC, 295, 2 }, { 0x1FCD, 297, 3 },
+  { 0x1FCE, 300, 3 }, { 0x1FCF, 303, 3 }, { 0x1FDD, 306, 3 }, { 0x1FDE, 309, 3 },
+  { 0x1FDF, 312, 3 }, { 0x1FED, 315, 3 }, { 0x1FEE, 318, 3 }, { 0x1FF2, 321, 2 },
+  { 0x1FF3, 323, 2 }, { 0x1FF4, 325, 2 }, { 0x1FF7, 327, 2 }, { 0x1FFC, 329, 2 },
+  { 0x1FFD, 331, 2 }, { 0x1FFE, 333, 2 }, { 0x2017, 335, 2 }, { 0x2033, 337, 2 },
+  { 0x2034, 339, 3 }, { 0x2036, 342, 2 }, { 0x2037, 344, 3 }, { 0x203C, 347, 2 },
+  { 0x203E, 349, 2 }, { 0x2047, 351, 2 }, { 0x2048, 353, 2 }, { 0x2049, 355, 2 },
+  { 0x2057, 357, 4 }, { 0x20A8, 361, 2 }, { 0x2100, 363, 3 }, { 0x2101, 366, 3 },
+  { 0x2103, 369, 2 }, { 0x2105, 371, 3 }, { 0x2106, 374, 3 }, { 0x2109, 377, 2 },
+  { 0x2116, 379, 2 }, { 0x2120, 381, 2 }, { 0x2121, 383, 3 }, { 0x2122, 386, 2 },
+  { 0x213B, 388, 3 }, { 0x2150, 391, 3 }, { 0x2151, 394, 3 }, { 0x2152, 397, 4 },
+  { 0x2153, 401, 3 }, { 0x2154, 404, 3 }, { 0x2155, 407, 3 }, { 0x2156, 410, 3 },
+  { 0x2157, 413, 3 }, { 0x2158, 416, 3 }, { 0x2159, 419, 3 }, { 0x215A, 422, 3 },
+  { 0x215B, 425, 3 }, { 0x215C, 428, 3 }, { 0x215D, 431, 3 }, { 0x215E, 434, 3 },
+  { 0x215F, 437, 2 }, { 0x2161, 439, 2 }, { 0x2162, 441, 3 }, { 0x2163, 444, 2 },
+  { 0x2165, 446, 2 }, { 0x2166, 448, 3 }, { 0x2167, 451, 4 }, { 0x2168, 455, 2 },
+  { 0x216A, 457, 2 }, { 0x216B, 459, 3 }, { 0x2171, 462, 2 }, { 0x2172, 464, 3 },
+  { 0x2173, 467, 2 }, { 0x2175, 469, 2 }, { 0x2176, 471, 3 }, { 0x2177, 474, 4 },
+  { 0x2178, 478, 2 }, { 0x217A, 480, 2 }, { 0x217B, 482, 3 }, { 0x2189, 485, 3 },
+  { 0x222C, 488, 2 }, { 0x222D, 490, 3 }, { 0x222F, 493, 2 }, { 0x2230, 495, 3 },
+  { 0x2469, 498, 2 }, { 0x246A, 500, 2 }, { 0x246B, 502, 2 }, { 0x246C, 504, 2 },
+  { 0x246D, 506, 2 }, { 0x246E, 508, 2 }, { 0x246F, 510, 2 }, { 0x2470, 512, 2 },
+  { 0x2471, 514, 2 }, { 0x2472, 516, 2 }, { 0x2473, 518, 2 }, { 0x2474, 520, 3 },
+  { 0x2475, 523, 3 }, { 0x2476, 526, 3 }, { 0x2477, 529, 3 }, { 0x2478, 532, 3 },
+  { 0x2479, 535, 3 }, { 0x247A, 538, 3 }, { 0x247B, 541, 3 }, { 0x247C, 544, 3 },
+  { 0x247D, 547, 4 }, { 0x247E, 551, 4 }, { 0x247F, 555, 4 }, { 0x2480, 559, 4 },
+  { 0x2481, 563, 4 }, { 0x2482, 567, 4 }, { 0x2483, 571, 4 }, { 0x2484, 575, 4 },
+  { 0x2485, 579, 4 }, { 0x2486, 583, 4 }, { 0x2487, 587, 4 }, { 0x249C, 591, 3 },
+  { 0x249D, 594, 3 }, { 0x249E, 597, 3 }, { 0x249F, 600, 3 }, { 0x24A0, 603, 3 },
+  { 0x24A1, 606, 3 }, { 0x24A2, 609, 3 }, { 0x24A3, 612, 3 }, { 0x24A4, 615, 3 },
+  { 0x24A5, 618, 3 }, { 0x24A6, 621, 3 }, { 0x24A7, 624, 3 }, { 0x24A8, 627, 3 },
+  { 0x24A9, 630, 3 }, { 0x24AA, 633, 3 }, { 0x24AB, 636, 3 }, { 0x24AC, 639, 3 },
+  { 0x24AD, 642, 3 }, { 0x24AE, 645, 3 }, { 0x24AF, 648, 3 }, { 0x24B0, 651, 3 },
+  { 0x24B1, 654, 3 }, { 0x24B2, 657, 3 }, { 0x24B3, 660, 3 }, { 0x24B4, 663, 3 },
+  { 0x24B5, 666, 3 }, { 0x2A0C, 669, 4 }, { 0x2A74, 673, 3 }, { 0x2A75, 676, 2 },
+  { 0x2A76, 678, 3 }, { 0x2ADC, 681, 2 }, { 0x309B, 683, 2 }, { 0x309C, 685, 2 },
+  { 0x309F, 687, 2 }, { 0x30FF, 689, 2 }, { 0x3200, 691, 3 }, { 0x3201, 694, 3 },
+  { 0x3202, 697, 3 }, { 0x3203, 700, 3 }, { 0x3204, 703, 3 }, { 0x3205, 706, 3 },
+  { 0x3206, 709, 3 }, { 0x3207, 712, 3 }, { 0x3208, 715, 3 }, { 0x3209, 718, 3 },
+  { 0x320A, 721, 3 }, { 0x320B, 724, 3 }, { 0x320C, 727, 3 }, { 0x320D, 730, 3 },
+  { 0x320E, 733, 3 }, { 0x320F, 736, 3 }, { 0x3210, 739, 3 }, { 0x3211, 742, 3 },
+  { 0x3212, 745, 3 }, { 0x3213, 748, 3 }, { 0x3214, 751, 3 }, { 0x3215, 754, 3 },
+  { 0x3216, 757, 3 }, { 0x3217, 760, 3 }, { 0x3218, 763, 3 }, { 0x3219, 766, 3 },
+  { 0x321A, 769, 3 }, { 0x321B, 772, 3 }, { 0x321C, 775, 3 }, { 0x321D, 778, 4 },
+  { 0x321E, 782, 4 }, { 0x3220, 786, 3 }, { 0x3221, 789, 3 }, { 0x3222, 792, 3 },
+  { 0x3223, 795, 3 }, { 0x3224, 798, 3 }, { 0x3225, 801, 3 }, { 0x3226, 804, 3 },
+  { 0x3227, 807, 3 }, { 0x3228, 810, 3 }, { 0x3229, 813, 3 }, { 0x322A, 816, 3 },
+  { 0x322B, 819, 3 }, { 0x322C, 822, 3 }, { 0x322D, 825, 3 }, { 0x322E, 828, 3 },
+  { 0x322F, 831, 3 }, { 0x3230, 834, 3 }, { 0x3231, 837, 3 }, { 0x3232, 840, 3 },
+  { 0x3233, 843, 3 }, { 0x3234, 846, 3 }, { 0x3235, 849, 3 }, { 0x3236, 852, 3 },
+  { 0x3237, 855, 3 }, { 0x3238, 858, 3 }, { 0x3239, 861, 3 }, { 0x323A, 864, 3 },
+  { 0x323B, 867, 3 }, { 0x323C, 870, 3 }, { 0x323D, 873, 3 }, { 0x323E, 876, 3 },
+  { 0x323F, 879, 3 }, { 0x3240, 882, 3 }, { 0x3241, 885, 3 }, { 0x3242, 888, 3 },
+  { 0x3243, 891, 3 }, { 0x3250, 894, 3 }, { 0x3251, 897, 2 }, { 0x3252, 899, 2 },
+  { 0x3253, 901, 2 }, { 0x3254, 903, 2 }, { 0x3255, 905, 2 }, { 0x3256, 907, 2 },
+  { 0x3257, 909, 2 }, { 0x3258, 911, 2 }, { 0x3259, 913, 2 }, { 0x325A, 915, 2 },
+  { 0x325B, 917, 2 }, { 0x325C, 919, 2 }, { 0x325D, 921, 2 }, { 0x325E, 923, 2 },
+  { 0x325F, 925, 2 }, { 0x327C, 927, 2 }, { 0x327D, 929, 2 }, { 0x32B1, 931, 2 },
+  { 0x32B2, 933, 2 }, { 0x32B3, 935, 2 }, { 0x32B4, 937, 2 }, { 0x32B5, 939, 2 },
+  { 0x32B6, 941, 2 }, { 0x32B7, 943, 2 }, { 0x32B8, 945, 2 }, { 0x32B9, 947, 2 },
+  { 0x32BA, 949, 2 }, { 0x32BB, 951, 2 }, { 0x32BC, 953, 2 }, { 0x32BD, 955, 2 },
+  { 0x32BE, 957, 2 }, { 0x32BF, 959, 2 }, { 0x32C0, 961, 2 }, { 0x32C1, 963, 2 },
+  { 0x32C2, 965, 2 }, { 0x32C3, 967, 2 }, { 0x32C4, 969, 2 }, { 0x32C5, 971, 2 },
+  { 0x32C6, 973, 2 }, { 0x32C7, 975, 2 }, { 0x32C8, 977, 2 }, { 0x32C9, 979, 3 },
+  { 0x32CA, 982, 3 }, { 0x32CB, 985, 3 }, { 0x32CC, 988, 2 }, { 0x32CD, 990, 3 },
+  { 0x32CE, 993, 2 }, { 0x32CF, 995, 3 }, { 0x32FF, 998, 2 }, { 0x3300, 1000, 4 },
+  { 0x3301, 1004, 4 }, { 0x3302, 1008, 4 }, { 0x3303, 1012, 3 }, { 0x3304, 1015, 4 },
+  { 0x3305, 1019, 3 }, { 0x3306, 1022, 3 }, { 0x3307, 1025, 5 }, { 0x3308, 1030, 4 },
+  { 0x3309, 1034, 3 }, { 0x330A, 1037, 3 }, { 0x330B, 1040, 3 }, { 0x330C, 1043, 4 },
+  { 0x330D, 1047, 4 }, { 0x330E, 1051, 3 }, { 0x330F, 1054, 3 }, { 0x3310, 1057, 2 },
+  { 0x3311, 1059, 3 }, { 0x3312, 1062, 4 }, { 0x3313, 1066, 4 }, { 0x3314, 1070, 2 },
+  { 0x3315, 1072, 5 }, { 0x3316, 1077, 6 }, { 0x3317, 1083, 5 }, { 0x3318, 1088, 3 },
+  { 0x3319, 1091, 5 }, { 0x331A, 1096, 5 }, { 0x331B, 1101, 4 }, { 0x331C, 1105, 3 },
+  { 0x331D, 1108, 3 }, { 0x331E, 1111, 3 }, { 0x331F, 1114, 4 }, { 0x3320, 1118, 5 },
+  { 0x3321, 1123, 4 }, { 0x3322, 1127, 3 }, { 0x3323, 1130, 3 }, { 0x3324, 1133, 3 },
+  { 0x3325, 1136, 2 }, { 0x3326, 1138, 2 }, { 0x3327, 1140, 2 }, { 0x3328, 1142, 2 },
+  { 0x3329, 1144, 3 }, { 0x332A, 1147, 3 }, { 0x332B, 1150, 5 }, { 0x332C, 1155, 3 },
+  { 0x332D, 1158, 4 }, { 0x332E, 1162, 5 }, { 0x332F, 1167, 3 }, { 0x3330, 1170, 2 },
+  { 0x3331, 1172, 2 }, { 0x3332, 1174, 5 }, { 0x3333, 1179, 4 }, { 0x3334, 1183, 5 },
+  { 0x3335, 1188, 3 }, { 0x3336, 1191, 5 }, { 0x3337, 1196, 2 }, { 0x3338, 1198, 3 },
+  { 0x3339, 1201, 3 }, { 0x333A, 1204, 3 }, { 0x333B, 1207, 3 }, { 0x333C, 1210, 3 },
+  { 0x333D, 1213, 4 }, { 0x333E, 1217, 3 }, { 0x333F, 1220, 2 }, { 0x3340, 1222, 3 },
+  { 0x3341, 1225, 3 }, { 0x3342, 1228, 3 }, { 0x3343, 1231, 4 }, { 0x3344, 1235, 3 },
+  { 0x3345, 1238, 3 }, { 0x3346, 1241, 3 }, { 0x3347, 1244, 5 }, { 0x3348, 1249, 4 },
+  { 0x3349, 1253, 2 }, { 0x334A, 1255, 5 }, { 0x334B, 1260, 2 }, { 0x334C, 1262, 4 },
+  { 0x334D, 1266, 4 }, { 0x334E, 1270, 3 }, { 0x334F, 1273, 3 }, { 0x3350, 1276, 3 },
+  { 0x3351, 1279, 4 }, { 0x3352, 1283, 2 }, { 0x3353, 1285, 3 }, { 0x3354, 1288, 4 },
+  { 0x3355, 1292, 2 }, { 0x3356, 1294, 5 }, { 0x3357, 1299, 3 }, { 0x3358, 1302, 2 },
+  { 0x3359, 1304, 2 }, { 0x335A, 1306, 2 }, { 0x335B, 1308, 2 }, { 0x335C, 1310, 2 },
+  { 0x335D, 1312, 2 }, { 0x335E, 1314, 2 }, { 0x335F, 1316, 2 }, { 0x3360, 1318, 2 },
+  { 0x3361, 1320, 2 }, { 0x3362, 1322, 3 }, { 0x3363, 1325, 3 }, { 0x3364, 1328, 3 },
+  { 0x3365, 1331, 3 }, { 0x3366, 1334, 3 }, { 0x3367, 1337, 3 }, { 0x3368, 1340, 3 },
+  { 0x3369, 1343, 3 }, { 0x336A, 1346, 3 }, { 0x336B, 1349, 3 }, { 0x336C, 1352, 3 },
+  { 0x336D, 1355, 3 }, { 0x336E, 1358, 3 }, { 0x336F, 1361, 3 }, { 0x3370, 1364, 3 },
+  { 0x3371, 1367, 3 }, { 0x3372, 1370, 2 }, { 0x3373, 1372, 2 }, { 0x3374, 1374, 3 },
+  { 0x3375, 1377, 2 }, { 0x3376, 1379, 2 }, { 0x3377, 1381, 2 }, { 0x3378, 1383, 3 },
+  { 0x3379, 1386, 3 }, { 0x337A, 1389, 2 }, { 0x337B, 1391, 2 }, { 0x337C, 1393, 2 },
+  { 0x337D, 1395, 2 }, { 0x337E, 1397, 2 }, { 0x337F, 1399, 4 }, { 0x3380, 1403, 2 },
+  { 0x3381, 1405, 2 }, { 0x3382, 1407, 2 }, { 0x3383, 1409, 2 }, { 0x3384, 1411, 2 },
+  { 0x3385, 1413, 2 }, { 0x3386, 1415, 2 }, { 0x3387, 1417, 2 }, { 0x3388, 1419, 3 },
+  { 0x3389, 1422, 4 }, { 0x338A, 1426, 2 }, { 0x338B, 1428, 2 }, { 0x338C, 1430, 2 },
+  { 0x338D, 1432, 2 }, { 0x338E, 1434, 2 }, { 0x338F, 1436, 2 }, { 0x3390, 1438, 2 },
+  { 0x3391, 1440, 3 }, { 0x3392, 1443, 3 }, { 0x3393, 1446, 3 }, { 0x3394, 1449, 3 },
+  { 0x3395, 1452, 2 }, { 0x3396, 1454, 2 }, { 0x3397, 1456, 2 }, { 0x3398, 1458, 2 },
+  { 0x3399, 1460, 2 }, { 0x339A, 1462, 2 }, { 0x339B, 1464, 2 }, { 0x339C, 1466, 2 },
+  { 0x339D, 1468, 2 }, { 0x339E, 1470, 2 }, { 0x339F, 1472, 3 }, { 0x33A0, 1475, 3 },
+  { 0x33A1, 1478, 2 }, { 0x33A2, 1480, 3 }, { 0x33A3, 1483, 3 }, { 0x33A4, 1486, 3 },
+  { 0x33A5, 1489, 2 }, { 0x33A6, 1491, 3 }, { 0x33A7, 1494, 3 }, { 0x33A8, 1497, 4 },
+  { 0x33A9, 1501, 2 }, { 0x33AA, 1503, 3 }, { 0x33AB, 1506, 3 }, { 0x33AC, 1509, 3 },
+  { 0x33AD, 1512, 3 }, { 0x33AE, 1515, 5 }, { 0x33AF, 1520, 6 }, { 0x33B0, 1526, 2 },
+  { 0x33B1, 1528, 2 }, { 0x33B2, 1530, 2 }, { 0x33B3, 1532, 2 }, { 0x33B4, 1534, 2 },
+  { 0x33B5, 1536, 2 }, { 0x33B6, 1538, 2 }, { 0x33B7, 1540, 2 }, { 0x33B8, 1542, 2 },
+  { 0x33B9, 1544, 2 }, { 0x33BA, 1546, 2 }, { 0x33BB, 1548, 2 }, { 0x33BC, 1550, 2 },
+  { 0x33BD, 1552, 2 }, { 0x33BE, 1554, 2 }, { 0x33BF, 1556, 2 }, { 0x33C0, 1558, 2 },
+  { 0x33C1, 1560, 2 }, { 0x33C3, 1562, 2 }, { 0x33C4, 1564, 2 }, { 0x33C5, 1566, 2 },
+  { 0x33C6, 1568, 4 }, { 0x33C8, 1572, 2 }, { 0x33C9, 1574, 2 }, { 0x33CA, 1576, 2 },
+  { 0x33CB, 1578, 2 }, { 0x33CC, 1580, 2 }, { 0x33CD, 1582, 2 }, { 0x33CE, 1584, 2 },
+  { 0x33CF, 1586, 2 }, { 0x33D0, 1588, 2 }, { 0x33D1, 1590, 2 }, { 0x33D2, 1592, 3 },
+  { 0x33D3, 1595, 2 }, { 0x33D4, 1597, 2 }, { 0x33D5, 1599, 3 }, { 0x33D6, 1602, 3 },
+  { 0x33D7, 1605, 2 }, { 0x33D9, 1607, 3 }, { 0x33DA, 1610, 2 }, { 0x33DB, 1612, 2 },
+  { 0x33DC, 1614, 2 }, { 0x33DD, 1616, 2 }, { 0x33DE, 1618, 3 }, { 0x33DF, 1621, 3 },
+  { 0x33E0, 1624, 2 }, { 0x33E1, 1626, 2 }, { 0x33E2, 1628, 2 }, { 0x33E3, 1630, 2 },
+  { 0x33E4, 1632, 2 }, { 0x33E5, 1634, 2 }, { 0x33E6, 1636, 2 }, { 0x33E7, 1638, 2 },
+  { 0x33E8, 1640, 2 }, { 0x33E9, 1642, 3 }, { 0x33EA, 1645, 3 }, { 0x33EB, 1648, 3 },
+  { 0x33EC, 1651, 3 }, { 0x33ED, 1654, 3 }, { 0x33EE, 1657, 3 }, { 0x33EF, 1660, 3 },
+  { 0x33F0, 1663, 3 }, { 0x33F1, 1666, 3 }, { 0x33F2, 1669, 3 }, { 0x33F3, 1672, 3 },
+  { 0x33F4, 1675, 3 }, { 0x33F5, 1678, 3 }, { 0x33F6, 1681, 3 }, { 0x33F7, 1684, 3 },
+  { 0x33F8, 1687, 3 }, { 0x33F9, 1690, 3 }, { 0x33FA, 1693, 3 }, { 0x33FB, 1696, 3 },
+  { 0x33FC, 1699, 3 }, { 0x33FD, 1702, 3 }, { 0x33FE, 1705, 3 }, { 0x33FF, 1708, 3 },
+  { 0xFB00, 1711, 2 }, { 0xFB01, 1713, 2 }, { 0xFB02, 1715, 2 }, { 0xFB03, 1717, 3 },
+  { 0xFB04, 1720, 3 }, { 0xFB05, 1723, 2 }, { 0xFB06, 1725, 2 }, { 0xFB13, 1727, 2 },
+  { 0xFB14, 1729, 2 }, { 0xFB15, 1731, 2 }, { 0xFB16, 1733, 2 }, { 0xFB17, 1735, 2 },
+  { 0xFB1D, 1737, 2 }, { 0xFB1F, 1739, 2 }, { 0xFB2A, 1741, 2 }, { 0xFB2B, 1743, 2 },
+  { 0xFB2C, 1745, 3 }, { 0xFB2D, 1748, 3 }, { 0xFB2E, 1751, 2 }, { 0xFB2F, 1753, 2 },
+  { 0xFB30, 1755, 2 }, { 0xFB31, 1757, 2 }, { 0xFB32, 1759, 2 }, { 0xFB33, 1761, 2 },
+  { 0xFB34, 1763, 2 }, { 0xFB35, 1765, 2 }, { 0xFB36, 1767, 2 }, { 0xFB38, 1769, 2 },
+  { 0xFB39, 1771, 2 }, { 0xFB3A, 1773, 2 }, { 0xFB3B, 1775, 2 }, { 0xFB3C, 1777, 2 },
+  { 0xFB3E, 1779, 2 }, { 0xFB40, 1781, 2 }, { 0xFB41, 1783, 2 }, { 0xFB43, 1785, 2 },
+  { 0xFB44, 1787, 2 }, { 0xFB46, 1789, 2 }, { 0xFB47, 1791, 2 }, { 0xFB48, 1793, 2 },
+  { 0xFB49, 1795, 2 }, { 0xFB4A, 1797, 2 }, { 0xFB4B, 1799, 2 }, { 0xFB4C, 1801, 2 },
+  { 0xFB4D, 1803, 2 }, { 0xFB4E, 1805, 2 }, { 0xFB4F, 1807, 2 }, { 0xFBDD, 1809, 2 },
+  { 0xFBEA, 1811, 2 }, { 0xFBEB, 1813, 2 }, { 0xFBEC, 1815, 2 }, { 0xFBED, 1817, 2 },
+  { 0xFBEE, 1819, 2 }, { 0xFBEF, 1821, 2 }, { 0xFBF0, 1823, 2 }, { 0xFBF1, 1825, 2 },
+  { 0xFBF2, 1827, 2 }, { 0xFBF3, 1829, 2 }, { 0xFBF4, 1831, 2 }, { 0xFBF5, 1833, 2 },
+  { 0xFBF6, 1835, 2 }, { 0xFBF7, 1837, 2 }, { 0xFBF8, 1839, 2 }, { 0xFBF9, 1841, 2 },
+  { 0xFBFA, 1843, 2 }, { 0xFBFB, 1845, 2 }, { 0xFC00, 1847, 2 }, { 0xFC01, 1849, 2 },
+  { 0xFC02, 1851, 2 }, { 0xFC03, 1853, 2 }, { 0xFC04, 1855, 2 }, { 0xFC05, 1857, 2 },
+  { 0xFC06, 1859, 2 }, { 0xFC07, 1861, 2 }, { 0xFC08, 1863, 2 }, { 0xFC09, 1865, 2 },
+  { 0xFC0A, 1867, 2 }, { 0xFC0B, 1869, 2 }, { 0xFC0C, 1871, 2 }, { 0xFC0D, 1873, 2 },
+  { 0xFC0E, 1875, 2 }, { 0xFC0F, 1877, 2 }, { 0xFC10, 1879, 2 }, { 0xFC11, 1881, 2 },
+  { 0xFC12, 1883, 2 }, { 0xFC13, 1885, 2 }, { 0xFC14, 1887, 2 }, { 0xFC15, 1889, 2 },
+  { 0xFC16, 1891, 2 }, { 0xFC17, 1893, 2 }, { 0xFC18, 1895, 2 }, { 0xFC19, 1897, 2 },
+  { 0xFC1A, 1899, 2 }, { 0xFC1B, 1901, 2 }, { 0xFC1C, 1903, 2 }, { 0xFC1D, 1905, 2 },
+  { 0xFC1E, 1907, 2 }, { 0xFC1F, 1909, 2 }, { 0xFC20, 1911, 2 }, { 0xFC21, 1913, 2 },
+  { 0xFC22, 1915, 2 }, { 0xFC23, 1917, 2 }, { 0xFC24, 1919, 2 }, { 0xFC25, 1921, 2 },
+  { 0xFC26, 1923, 2 }, { 0xFC27, 1925, 2 }, { 0xFC28, 1927, 2 }, { 0xFC29, 1929, 2 },
+  { 0xFC2A, 1931, 2 }, { 0xFC2B, 1933, 2 }, { 0xFC2C, 1935, 2 }, { 0xFC2D, 1937, 2 },
+  { 0xFC2E, 1939, 2 }, { 0xFC2F, 1941, 2 }, { 0xFC30, 1943, 2 }, { 0xFC31, 1945, 2 },
+  { 0xFC32, 1947, 2 }, { 0xFC33, 1949, 2 }, { 0xFC34, 1951, 2 }, { 0xFC35, 1953, 2 },
+  { 0xFC36, 1955, 2 }, { 0xFC37, 1957, 2 }, { 0xFC38, 1959, 2 }, { 0xFC39, 1961, 2 },
+  { 0xFC3A, 1963, 2 }, { 0xFC3B, 1965, 2 }, { 0xFC3C, 1967, 2 }, { 0xFC3D, 1969, 2 },
+  { 0xFC3E, 1971, 2 }, { 0xFC3F, 1973, 2 }, { 0xFC40, 1975, 2 }, { 0xFC41, 1977, 2 },
+  { 0xFC42, 1979, 2 }, { 0xFC43, 1981, 2 }, { 0xFC44, 1983, 2 }, { 0xFC45, 1985, 2 },
+  { 0xFC46, 1987, 2 }, { 0xFC47, 1989, 2 }, { 0xFC48, 1991, 2 }, { 0xFC49, 1993, 2 },
+  { 0xFC4A, 1995, 2 }, { 0xFC4B, 1997, 2 }, { 0xFC4C, 1999, 2 }, { 0xFC4D, 2001, 2 },
+  { 0xFC4E, 2003, 2 }, { 0xFC4F, 2005, 2 }, { 0xFC50, 2007, 2 }, { 0xFC51, 2009, 2 },
+  { 0xFC52, 2011, 2 }, { 0xFC53, 2013, 2 }, { 0xFC54, 2015, 2 }, { 0xFC55, 2017, 2 },
+  { 0xFC56, 2019, 2 }, { 0xFC57, 2021, 2 }, { 0xFC58, 2023, 2 }, { 0xFC59, 2025, 2 },
+  { 0xFC5A, 2027, 2 }, { 0xFC5B, 2029, 2 }, { 0xFC5C, 2031, 2 }, { 0xFC5D, 2033, 2 },
+  { 0xFC5E, 2035, 3 }, { 0xFC5F, 2038, 3 }, { 0xFC60, 2041, 3 }, { 0xFC61, 2044, 3 },
+  { 0xFC62, 2047, 3 }, { 0xFC63, 2050, 3 }, { 0xFC64, 2053, 2 }, { 0xFC65, 2055, 2 },
+  { 0xFC66, 2057, 2 }, { 0xFC67, 2059, 2 }, { 0xFC68, 2061, 2 }, { 0xFC69, 2063, 2 },
+  { 0xFC6A, 2065, 2 }, { 0xFC6B, 2067, 2 }, { 0xFC6C, 2069, 2 }, { 0xFC6D, 2071, 2 },
+  { 0xFC6E, 2073, 2 }, { 0xFC6F, 2075, 2 }, { 0xFC70, 2077, 2 }, { 0xFC71, 2079, 2 },
+  { 0xFC72, 2081, 2 }, { 0xFC73, 2083, 2 }, { 0xFC74, 2085, 2 }, { 0xFC75, 2087, 2 },
+  { 0xFC76, 2089, 2 }, { 0xFC77, 2091, 2 }, { 0xFC78, 2093, 2 }, { 0xFC79, 2095, 2 },
+  { 0xFC7A, 2097, 2 }, { 0xFC7B, 2099, 2 }, { 0xFC7C, 2101, 2 }, { 0xFC7D, 2103, 2 },
+  { 0xFC7E, 2105, 2 }, { 0xFC7F, 2107, 2 }, { 0xFC80, 2109, 2 }, { 0xFC81, 2111, 2 },
+  { 0xFC82, 2113, 2 }, { 0xFC83, 2115, 2 }, { 0xFC84, 2117, 2 }, { 0xFC85, 2119, 2 },
+  { 0xFC86, 2121, 2 }, { 0xFC87, 2123, 2 }, { 0xFC88, 2125, 2 }, { 0xFC89, 2127, 2 },
+  { 0xFC8A, 2129, 2 }, { 0xFC8B, 2131, 2 }, { 0xFC8C, 2133, 2 }, { 0xFC8D, 2135, 2 },
+  { 0xFC8E, 2137, 2 }, { 0xFC8F, 2139, 2 }, { 0xFC90, 2141, 2 }, { 0xFC91, 2143, 2 },
+  { 0xFC92, 2145, 2 }, { 0xFC93, 2147, 2 }, { 0xFC94, 2149, 2 }, { 0xFC95, 2151, 2 },
+  { 0xFC96, 2153, 2 }, { 0xFC97, 2155, 2 }, { 0xFC98, 2157, 2 }, { 0xFC99, 2159, 2 },
+  { 0xFC9A, 2161, 2 }, { 0xFC9B, 2163, 2 }, { 0xFC9C, 2165, 2 }, { 0xFC9D, 2167, 2 },
+  { 0xFC9E, 2169, 2 }, { 0xFC9F, 2171, 2 }, { 0xFCA0, 2173, 2 }, { 0xFCA1, 2175, 2 },
+  { 0xFCA2, 2177, 2 }, { 0xFCA3, 2179, 2 }, { 0xFCA4, 2181, 2 }, { 0xFCA5, 2183, 2 },
+  { 0xFCA6, 2185, 2 }, { 0xFCA7, 2187, 2 }, { 0xFCA8, 2189, 2 }, { 0xFCA9, 2191, 2 },
+  { 0xFCAA, 2193, 2 }, { 0xFCAB, 2195, 2 }, { 0xFCAC, 2197, 2 }, { 0xFCAD, 2199, 2 },
+  { 0xFCAE, 2201, 2 }, { 0xFCAF, 2203, 2 }, { 0xFCB0, 2205, 2 }, { 0xFCB1, 2207, 2 },
+  { 0xFCB2, 2209, 2 }, { 0xFCB3, 2211, 2 }, { 0xFCB4, 2213, 2 }, { 0xFCB5, 2215, 2 },
+  { 0xFCB6, 2217, 2 }, { 0xFCB7, 2219, 2 }, { 0xFCB8, 2221, 2 }, { 0xFCB9, 2223, 2 },
+  { 0xFCBA, 2225, 2 }, { 0xFCBB, 2227, 2 }, { 0xFCBC, 2229, 2 }, { 0xFCBD, 2231, 2 },
+  { 0xFCBE, 2233, 2 }, { 0xFCBF, 2235, 2 }, { 0xFCC0, 2237, 2 }, { 0xFCC1, 2239, 2 },
+  { 0xFCC2, 2241, 2 }, { 0xFCC3, 2243, 2 }, { 0xFCC4, 2245, 2 }, { 0xFCC5, 2247, 2 },
+  { 0xFCC6, 2249, 2 }, { 0xFCC7, 2251, 2 }, { 0xFCC8, 2253, 2 }, { 0xFCC9, 2255, 2 },
+  { 0xFCCA, 2257, 2 }, { 0xFCCB, 2259, 2 }, { 0xFCCC, 2261, 2 }, { 0xFCCD, 2263, 2 },
+  { 0xFCCE, 2265, 2 }, { 0xFCCF, 2267, 2 }, { 0xFCD0, 2269, 2 }, { 0xFCD1, 2271, 2 },
+  { 0xFCD2, 2273, 2 }, { 0xFCD3, 2275, 2 }, { 0xFCD4, 2277, 2 }, { 0xFCD5, 2279, 2 },
+  { 0xFCD6, 2281, 2 }, { 0xFCD7, 2283, 2 }, { 0xFCD8, 2285, 2 }, { 0xFCD9, 2287, 2 },
+  { 0xFCDA, 2289, 2 }, { 0xFCDB, 2291, 2 }, { 0xFCDC, 2293, 2 }, { 0xFCDD, 2295, 2 },
+  { 0xFCDE, 2297, 2 }, { 0xFCDF, 2299, 2 }, { 0xFCE0, 2301, 2 }, { 0xFCE1, 2303, 2 },
+  { 0xFCE2, 2305, 2 }, { 0xFCE3, 2307, 2 }, { 0xFCE4, 2309, 2 }, { 0xFCE5, 2311, 2 },
+  { 0xFCE6, 2313, 2 }, { 0xFCE7, 2315, 2 }, { 0xFCE8, 2317, 2 }, { 0xFCE9, 2319, 2 },
+  { 0xFCEA, 2321, 2 }, { 0xFCEB, 2323, 2 }, { 0xFCEC, 2325, 2 }, { 0xFCED, 2327, 2 },
+  { 0xFCEE, 2329, 2 }, { 0xFCEF, 2331, 2 }, { 0xFCF0, 2333, 2 }, { 0xFCF1, 2335, 2 },
+  { 0xFCF2, 2337, 3 }, { 0xFCF3, 2340, 3 }, { 0xFCF4, 2343, 3 }, { 0xFCF5, 2346, 2 },
+  { 0xFCF6, 2348, 2 }, { 0xFCF7, 2350, 2 }, { 0xFCF8, 2352, 2 }, { 0xFCF9, 2354, 2 },
+  { 0xFCFA, 2356, 2 }, { 0xFCFB, 2358, 2 }, { 0xFCFC, 2360, 2 }, { 0xFCFD, 2362, 2 },
+  { 0xFCFE, 2364, 2 }, { 0xFCFF, 2366, 2 }, { 0xFD00, 2368, 2 }, { 0xFD01, 2370, 2 },
+  { 0xFD02, 2372, 2 }, { 0xFD03, 2374, 2 }, { 0xFD04, 2376, 2 }, { 0xFD05, 2378, 2 },
+  { 0xFD06, 2380, 2 }, { 0xFD07, 2382, 2 }, { 0xFD08, 2384, 2 }, { 0xFD09, 2386, 2 },
+  { 0xFD0A, 2388, 2 }, { 0xFD0B, 2390, 2 }, { 0xFD0C, 2392, 2 }, { 0xFD0D, 2394, 2 },
+  { 0xFD0E, 2396, 2 }, { 0xFD0F, 2398, 2 }, { 0xFD10, 2400, 2 }, { 0xFD11, 2402, 2 },
+  { 0xFD12, 2404, 2 }, { 0xFD13, 2406, 2 }, { 0xFD14, 2408, 2 }, { 0xFD15, 2410, 2 },
+  { 0xFD16, 2412, 2 }, { 0xFD17, 2414, 2 }, { 0xFD18, 2416, 2 }, { 0xFD19, 2418, 2 },
+  { 0xFD1A, 2420, 2 }, { 0xFD1B, 2422, 2 }, { 0xFD1C, 2424, 2 }, { 0xFD1D, 2426, 2 },
+  { 0xFD1E, 2428, 2 }, { 0xFD1F, 2430, 2 }, { 0xFD20, 2432, 2 }, { 0xFD21, 2434, 2 },
+  { 0xFD22, 2436, 2 }, { 0xFD23, 2438, 2 }, { 0xFD24, 2440, 2 }, { 0xFD25, 2442, 2 },
+  { 0xFD26, 2444, 2 }, { 0xFD27, 2446, 2 }, { 0xFD28, 2448, 2 }, { 0xFD29, 2450, 2 },
+  { 0xFD2A, 2452, 2 }, { 0xFD2B, 2454, 2 }, { 0xFD2C, 2456, 2 }, { 0xFD2D, 2458, 2 },
+  { 0xFD2E, 2460, 2 }, { 0xFD2F, 2462, 2 }, { 0xFD30, 2464, 2 }, { 0xFD31, 2466, 2 },
+  { 0xFD32, 2468, 2 }, { 0xFD33, 2470, 2 }, { 0xFD34, 2472, 2 }, { 0xFD35, 2474, 2 },
+  { 0xFD36, 2476, 2 }, { 0xFD37, 2478, 2 }, { 0xFD38, 2480, 2 }, { 0xFD39, 2482, 2 },
+  { 0xFD3A, 2484, 2 }, { 0xFD3B, 2486, 2 }, { 0xFD3C, 2488, 2 }, { 0xFD3D, 2490, 2 },
+  { 0xFD50, 2492, 3 }, { 0xFD51, 2495, 3 }, { 0xFD52, 2498, 3 }, { 0xFD53, 2501, 3 },
+  { 0xFD54, 2504, 3 }, { 0xFD55, 2507, 3 }, { 0xFD56, 2510, 3 }, { 0xFD57, 2513, 3 },
+  { 0xFD58, 2516, 3 }, { 0xFD59, 2519, 3 }, { 0xFD5A, 2522, 3 }, { 0xFD5B, 2525, 3 },
+  { 0xFD5C, 2528, 3 }, { 0xFD5D, 2531, 3 }, { 0xFD5E, 2534, 3 }, { 0xFD5F, 2537, 3 },
+  { 0xFD60, 2540, 3 }, { 0xFD61, 2543, 3 }, { 0xFD62, 2546, 3 }, { 0xFD63, 2549, 3 },
+  { 0xFD64, 2552, 3 }, { 0xFD65, 2555, 3 }, { 0xFD66, 2558, 3 }, { 0xFD67, 2561, 3 },
+  { 0xFD68, 2564, 3 }, { 0xFD69, 2567, 3 }, { 0xFD6A, 2570, 3 }, { 0xFD6B, 2573, 3 },
+  { 0xFD6C, 2576, 3 }, { 0xFD6D, 2579, 3 }, { 0xFD6E, 2582, 3 }, { 0xFD6F, 2585, 3 },
+  { 0xFD70, 2588, 3 }, { 0xFD71, 2591, 3 }, { 0xFD72, 2594, 3 }, { 0xFD73, 2597, 3 },
+  { 0xFD74, 2600, 3 }, { 0xFD75, 2603, 3 }, { 0xFD76, 2606, 3 }, { 0xFD77, 2609, 3 },
+  { 0xFD78, 2612, 3 }, { 0xFD79, 2615, 3 }, { 0xFD7A, 2618, 3 }, { 0xFD7B, 2621, 3 },
+  { 0xFD7C, 2624, 3 }, { 0xFD7D, 2627, 3 }, { 0xFD7E, 2630, 3 }, { 0xFD7F, 2633, 3 },
+  { 0xFD80, 2636, 3 }, { 0xFD81, 2639, 3 }, { 0xFD82, 2642, 3 }, { 0xFD83, 2645, 3 },
+  { 0xFD84, 2648, 3 }, { 0xFD85, 2651, 3 }, { 0xFD86, 2654, 3 }, { 0xFD87, 2657, 3 },
+  { 0xFD88, 2660, 3 }, { 0xFD89, 2663, 3 }, { 0xFD8A, 2666, 3 }, { 0xFD8B, 2669, 3 },
+  { 0xFD8C, 2672, 3 }, { 0xFD8D, 2675, 3 }, { 0xFD8E, 2678, 3 }, { 0xFD8F, 2681, 3 },
+  { 0xFD92, 2684, 3 }, { 0xFD93, 2687, 3 }, { 0xFD94, 2690, 3 }, { 0xFD95, 2693, 3 },
+  { 0xFD96, 2696, 3 }, { 0xFD97, 2699, 3 }, { 0xFD98, 2702, 3 }, { 0xFD99, 2705, 3 },
+  { 0xFD9A, 2708, 3 }, { 0xFD9B, 2711, 3 }, { 0xFD9C, 2714, 3 }, { 0xFD9D, 2717, 3 },
+  { 0xFD9E, 2720, 3 }, { 0xFD9F, 2723, 3 }, { 0xFDA0, 2726, 3 }, { 0xFDA1, 2729, 3 },
+  { 0xFDA2, 2732, 3 }, { 0xFDA3, 2735, 3 }, { 0xFDA4, 2738, 3 }, { 0xFDA5, 2741, 3 },
+  { 0xFDA6, 2744, 3 }, { 0xFDA7, 2747, 3 }, { 0xFDA8, 2750, 3 }, { 0xFDA9, 2753, 3 },
+  { 0xFDAA, 2756, 3 }, { 0xFDAB, 2759, 3 }, { 0xFDAC, 2762, 3 }, { 0xFDAD, 2765, 3 },
+  { 0xFDAE, 2768, 3 }, { 0xFDAF, 2771, 3 }, { 0xFDB0, 2774, 3 }, { 0xFDB1, 2777, 3 },
+  { 0xFDB2, 2780, 3 }, { 0xFDB3, 2783, 3 }, { 0xFDB4, 2786, 3 }, { 0xFDB5, 2789, 3 },
+  { 0xFDB6, 2792, 3 }, { 0xFDB7, 2795, 3 }, { 0xFDB8, 2798, 3 }, { 0xFDB9, 2801, 3 },
+  { 0xFDBA, 2804, 3 }, { 0xFDBB, 2807, 3 }, { 0xFDBC, 2810, 3 }, { 0xFDBD, 2813, 3 },
+  { 0xFDBE, 2816, 3 }, { 0xFDBF, 2819, 3 }, { 0xFDC0, 2822, 3 }, { 0xFDC1, 2825, 3 },
+  { 0xFDC2, 2828, 3 }, { 0xFDC3, 2831, 3 }, { 0xFDC4, 2834, 3 }, { 0xFDC5, 2837, 3 },
+  { 0xFDC6, 2840, 3 }, { 0xFDC7, 2843, 3 }, { 0xFDF0, 2846, 3 }, { 0xFDF1, 2849, 3 },
+  { 0xFDF2, 2852, 4 }, { 0xFDF3, 2856, 4 }, { 0xFDF4, 2860, 4 }, { 0xFDF5, 2864, 4 },
+  { 0xFDF6, 2868, 4 }, { 0xFDF7, 2872, 4 }, { 0xFDF8, 2876, 4 }, { 0xFDF9, 2880, 3 },
+  { 0xFDFA, 2883, 18 }, { 0xFDFB, 2901, 8 }, { 0xFDFC, 2909, 4 }, { 0xFE49, 2913, 2 },
+  { 0xFE4A, 2915, 2 }, { 0xFE4B, 2917, 2 }, { 0xFE4C, 2919, 2 }, { 0xFE70, 2921, 2 },
+  { 0xFE71, 2923, 2 }, { 0xFE72, 2925, 2 }, { 0xFE74, 2927, 2 }, { 0xFE76, 2929, 2 },
+  { 0xFE77, 2931, 2 }, { 0xFE78, 2933, 2 }, { 0xFE79, 2935, 2 }, { 0xFE7A, 2937, 2 },
+  { 0xFE7B, 2939, 2 }, { 0xFE7C, 2941, 2 }, { 0xFE7D, 2943, 2 }, { 0xFE7E, 2945, 2 },
+  { 0xFE7F, 2947, 2 }, { 0xFEF5, 2949, 2 }, { 0xFEF6, 2951, 2 }, { 0xFEF7, 2953, 2 },
+  { 0xFEF8, 2955, 2 }, { 0xFEF9, 2957, 2 }, { 0xFEFA, 2959, 2 }, { 0xFEFB, 2961, 2 },
+  { 0xFEFC, 2963, 2 }, { 0xFFE3, 2965, 2 }, { 0x1D15E, 2967, 2 }, { 0x1D15F, 2969, 2 },
+  { 0x1D160, 2971, 3 }, { 0x1D161, 2974, 3 }, { 0x1D162, 2977, 3 }, { 0x1D163, 2980, 3 },
+  { 0x1D164, 2983, 3 }, { 0x1D1BB, 2986, 2 }, { 0x1D1BC, 2988, 2 }, { 0x1D1BD, 2990, 3 },
+  { 0x1D1BE, 2993, 3 }, { 0x1D1BF, 2996, 3 }, { 0x1D1C0, 2999, 3 }, { 0x1F101, 3002, 2 },
+  { 0x1F102, 3004, 2 }, { 0x1F103, 3006, 2 }, { 0x1F104, 3008, 2 }, { 0x1F105, 3010, 2 },
+  { 0x1F106, 3012, 2 }, { 0x1F107, 3014, 2 }, { 0x1F108, 3016, 2 }, { 0x1F109, 3018, 2 },
+  { 0x1F10A, 3020, 2 }, { 0x1F110, 3022, 3 }, { 0x1F111, 3025, 3 }, { 0x1F112, 3028, 3 },
+  { 0x1F113, 3031, 3 }, { 0x1F114, 3034, 3 }, { 0x1F115, 3037, 3 }, { 0x1F116, 3040, 3 },
+  { 0x1F117, 3043, 3 }, { 0x1F118, 3046, 3 }, { 0x1F119, 3049, 3 }, { 0x1F11A, 3052, 3 },
+  { 0x1F11B, 3055, 3 }, { 0x1F11C, 3058, 3 }, { 0x1F11D, 3061, 3 }, { 0x1F11E, 3064, 3 },
+  { 0x1F11F, 3067, 3 }, { 0x1F120, 3070, 3 }, { 0x1F121, 3073, 3 }, { 0x1F122, 3076, 3 },
+  { 0x1F123, 3079, 3 }, { 0x1F124, 3082, 3 }, { 0x1F125, 3085, 3 }, { 0x1F126, 3088, 3 },
+  { 0x1F127, 3091, 3 }, { 0x1F128, 3094, 3 }, { 0x1F129, 3097, 3 }, { 0x1F12A, 3100, 3 },
+  { 0x1F12D, 3103, 2 }, { 0x1F12E, 3105, 2 }, { 0x1F14A, 3107, 2 }, { 0x1F14B, 3109, 2 },
+  { 0x1F14C, 3111, 2 }, { 0x1F14D, 3113, 2 }, { 0x1F14E, 3115, 3 }, { 0x1F14F, 3118, 2 },
+  { 0x1F16A, 3120, 2 }, { 0x1F16B, 3122, 2 }, { 0x1F16C, 3124, 2 }, { 0x1F190, 3126, 2 },
+  { 0x1F200, 3128, 2 }, { 0x1F201, 3130, 2 }, { 0x1F240, 3132, 3 }, { 0x1F241, 3135, 3 },
+  { 0x1F242, 3138, 3 }, { 0x1F243, 3141, 3 }, { 0x1F244, 3144, 3 }, { 0x1F245, 3147, 3 },
+  { 0x1F246, 3150, 3 }, { 0x1F247, 3153, 3 }, { 0x1F248, 3156, 3 },
+};
+
+inline constexpr char32_t EXPANDED[] = {
+  0x20, 0x308, 0x20, 0x304, 0x20, 0x301, 0x20, 0x327, 0x31, 0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33,
+  0x2044, 0x34, 0x69, 0x307, 0x69, 0x6A, 0x69, 0x6A, 0x6C, 0xB7, 0x6C, 0xB7, 0x2BC, 0x6E, 0x64,
+  0x17E, 0x64, 0x17E, 0x64, 0x17E, 0x6C, 0x6A, 0x6C, 0x6A, 0x6C, 0x6A, 0x6E, 0x6A, 0x6E, 0x6A, 0x6E,
+  0x6A, 0x64, 0x7A, 0x64, 0x7A, 0x64, 0x7A, 0x20, 0x306, 0x20, 0x307, 0x20, 0x30A, 0x20, 0x328,
+  0x20, 0x303, 0x20, 0x30B, 0x308, 0x301, 0x20, 0x3B9, 0x20, 0x301, 0x20, 0x308, 0x301, 0x565,
+  0x582, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A, 0x674, 0x915, 0x93C, 0x916, 0x93C, 0x917,
+  0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9A1, 0x9BC, 0x9A2,
+  0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C, 0xA2B,
+  0xA3C, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xE4D, 0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99, 0xEAB, 0xEA1, 0xF42,
+  0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71,
+  0xF74, 0xFB2, 0xF80, 0xFB2, 0xF71, 0xF80, 0xFB3, 0xF80, 0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92,
+  0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x61, 0x2BE, 0x1F00,
+  0x3B9, 0x1F01, 0x3B9, 0x1F02, 0x3B9, 0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05, 0x3B9, 0x1F06, 0x3B9,
+  0x1F07, 0x3B9, 0x1F00, 0x3B9, 0x1F01, 0x3B9, 0x1F02, 0x3B9, 0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05,
+  0x3B9, 0x1F06, 0x3B9, 0x1F07, 0x3B9, 0x1F20, 0x3B9, 0x1F21, 0x3B9, 0x1F22, 0x3B9, 0x1F23, 0x3B9,
+  0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27, 0x3B9, 0x1F20, 0x3B9, 0x1F21, 0x3B9, 0x1F22,
+  0x3B9, 0x1F23, 0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27, 0x3B9, 0x1F60, 0x3B9,
+  0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9, 0x1F66, 0x3B9, 0x1F67,
+  0x3B9, 0x1F60, 0x3B9, 0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9,
+  0x1F66, 0x3B9, 0x1F67, 0x3B9, 0x1F70, 0x3B9, 0x3B1, 0x3B9, 0x3AC, 0x3B9, 0x1FB6, 0x3B9, 0x3B1,
+  0x3B9, 0x20, 0x313, 0x20, 0x313, 0x20, 0x342, 0x20, 0x308, 0x342, 0x1F74, 0x3B9, 0x3B7, 0x3B9,
+  0x3AE, 0x3B9, 0x1FC6, 0x3B9, 0x3B7, 0x3B9, 0x20, 0x313, 0x300, 0x20, 0x313, 0x301, 0x20, 0x313,
+  0x342, 0x20, 0x314, 0x300, 0x20, 0x314, 0x301, 0x20, 0x314, 0x342, 0x20, 0x308, 0x300, 0x20,
+  0x308, 0x301, 0x1F7C, 0x3B9, 0x3C9, 0x3B9, 0x3CE, 0x3B9, 0x1FF6, 0x3B9, 0x3C9, 0x3B9, 0x20, 0x301,
+  0x20, 0x314, 0x20, 0x333, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035,
+  0x2035, 0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032, 0x2032,
+  0x2032, 0x72, 0x73, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73, 0xB0, 0x63, 0x63, 0x2F, 0x6F, 0x63, 0x2F,
+  0x75, 0xB0, 0x66, 0x6E, 0x6F, 0x73, 0x6D, 0x74, 0x65, 0x6C, 0x74, 0x6D, 0x66, 0x61, 0x78, 0x31,
+  0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31, 0x30, 0x31, 0x2044, 0x33, 0x32, 0x2044,
+  0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34, 0x2044, 0x35, 0x31,
+  0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044, 0x38,
+  0x37, 0x2044, 0x38, 0x31, 0x2044, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x69, 0x76,
+  0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x69, 0x69, 0x69,
+  0x69, 0x69, 0x69, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69, 0x78, 0x78,
+  0x69, 0x78, 0x69, 0x69, 0x30, 0x2044, 0x33, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E,
+  0x222E, 0x222E, 0x222E, 0x222E, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34, 0x31,
+  0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30, 0x28, 0x31, 0x29, 0x28, 0x32,
+  0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29,
+  0x28, 0x38, 0x29, 0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28, 0x31,
+  0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31, 0x35, 0x29, 0x28, 0x31,
+  0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28, 0x32,
+  0x30, 0x29, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65,
+  0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29,
+  0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28,
+  0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75,
+  0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29,
+  0x222B, 0x222B, 0x222B, 0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x2ADD, 0x338,
+  0x20, 0x3099, 0x20, 0x309A, 0x3088, 0x308A, 0x30B3, 0x30C8, 0x28, 0x1100, 0x29, 0x28, 0x1102,
+  0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28,
+  0x1109, 0x29, 0x28, 0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29,
+  0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28, 0xAC00, 0x29, 0x28, 0xB098,
+  0x29, 0x28, 0xB2E4, 0x29, 0x28, 0xB77C, 0x29, 0x28, 0xB9C8, 0x29, 0x28, 0xBC14, 0x29, 0x28,
+  0xC0AC, 0x29, 0x28, 0xC544, 0x29, 0x28, 0xC790, 0x29, 0x28, 0xCC28, 0x29, 0x28, 0xCE74, 0x29,
+  0x28, 0xD0C0, 0x29, 0x28, 0xD30C, 0x29, 0x28, 0xD558, 0x29, 0x28, 0xC8FC, 0x29, 0x28, 0xC624,
+  0xC804, 0x29, 0x28, 0xC624, 0xD6C4, 0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09,
+  0x29, 0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28,
+  0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B, 0x29,
+  0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28, 0x65E5,
+  0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28,
+  0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29,
+  0x28, 0x547C, 0x29, 0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7,
+  0x29, 0x28, 0x5354, 0x29, 0x28, 0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28,
+  0x81F3, 0x29, 0x70, 0x74, 0x65, 0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32, 0x35, 0x32,
+  0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31, 0x33, 0x32, 0x33, 0x33, 0x33,
+  0x34, 0x33, 0x35, 0xCC38, 0xACE0, 0xC8FC, 0xC758, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39,
+  0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+  0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708, 0x33, 0x6708, 0x34, 0x6708, 0x35,
+  0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31, 0x30, 0x6708, 0x31, 0x31,
+  0x6708, 0x31, 0x32, 0x6708, 0x68, 0x67, 0x65, 0x72, 0x67, 0x65, 0x76, 0x6C, 0x74, 0x64, 0x4EE4,
+  0x548C, 0x30A2, 0x30D1, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30DA,
+  0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30B0, 0x30A4, 0x30F3, 0x30C1, 0x30A6,
+  0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C9, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA,
+  0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8,
+  0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AC, 0x30ED, 0x30F3, 0x30AC, 0x30F3, 0x30DE, 0x30AE, 0x30AC,
+  0x30AE, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AE, 0x30EB, 0x30C0, 0x30FC, 0x30AD,
+  0x30ED, 0x30AD, 0x30ED, 0x30B0, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB,
+  0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30B0, 0x30E9, 0x30E0, 0x30B0, 0x30E9, 0x30E0, 0x30C8,
+  0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC,
+  0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DD, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5,
+  0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30B0, 0x30BB, 0x30F3, 0x30C1, 0x30BB,
+  0x30F3, 0x30C8, 0x30C0, 0x30FC, 0x30B9, 0x30C7, 0x30B7, 0x30C9, 0x30EB, 0x30C8, 0x30F3, 0x30CA,
+  0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8,
+  0x30D1, 0x30FC, 0x30C4, 0x30D0, 0x30FC, 0x30EC, 0x30EB, 0x30D4, 0x30A2, 0x30B9, 0x30C8, 0x30EB,
+  0x30D4, 0x30AF, 0x30EB, 0x30D4, 0x30B3, 0x30D3, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9,
+  0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3,
+  0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30DA, 0x30BD, 0x30DA, 0x30CB, 0x30D2, 0x30D8, 0x30EB,
+  0x30C4, 0x30DA, 0x30F3, 0x30B9, 0x30DA, 0x30FC, 0x30B8, 0x30D9, 0x30FC, 0x30BF, 0x30DD, 0x30A4,
+  0x30F3, 0x30C8, 0x30DC, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DD, 0x30F3, 0x30C9, 0x30DB, 0x30FC,
+  0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE,
+  0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF,
+  0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30D0, 0x30FC, 0x30EB, 0x30E1, 0x30AC, 0x30E1,
+  0x30AC, 0x30C8, 0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C9, 0x30E4, 0x30FC,
+  0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D4,
+  0x30FC, 0x30EB, 0x30FC, 0x30D6, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3,
+  0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9, 0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9,
+  0x35, 0x70B9, 0x36, 0x70B9, 0x37, 0x70B9, 0x38, 0x70B9, 0x39, 0x70B9, 0x31, 0x30, 0x70B9, 0x31,
+  0x31, 0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34, 0x70B9, 0x31, 0x35, 0x70B9,
+  0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9, 0x32, 0x30,
+  0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9, 0x32, 0x34, 0x70B9, 0x68,
+  0x70, 0x61, 0x64, 0x61, 0x61, 0x75, 0x62, 0x61, 0x72, 0x6F, 0x76, 0x70, 0x63, 0x64, 0x6D, 0x64,
+  0x6D, 0x32, 0x64, 0x6D, 0x33, 0x69, 0x75, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E,
+  0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x70, 0x61, 0x6E, 0x61, 0x3BC, 0x61, 0x6D, 0x61, 0x6B,
+  0x61, 0x6B, 0x62, 0x6D, 0x62, 0x67, 0x62, 0x63, 0x61, 0x6C, 0x6B, 0x63, 0x61, 0x6C, 0x70, 0x66,
+  0x6E, 0x66, 0x3BC, 0x66, 0x3BC, 0x67, 0x6D, 0x67, 0x6B, 0x67, 0x68, 0x7A, 0x6B, 0x68, 0x7A, 0x6D,
+  0x68, 0x7A, 0x67, 0x68, 0x7A, 0x74, 0x68, 0x7A, 0x3BC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C,
+  0x66, 0x6D, 0x6E, 0x6D, 0x3BC, 0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D, 0x6D, 0x6D, 0x32, 0x63,
+  0x6D, 0x32, 0x6D, 0x32, 0x6B, 0x6D, 0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B,
+  0x6D, 0x33, 0x6D, 0x2215, 0x73, 0x6D, 0x2215, 0x73, 0x32, 0x70, 0x61, 0x6B, 0x70, 0x61, 0x6D,
+  0x70, 0x61, 0x67, 0x70, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x72, 0x61, 0x64,
+  0x2215, 0x73, 0x32, 0x70, 0x73, 0x6E, 0x73, 0x3BC, 0x73, 0x6D, 0x73, 0x70, 0x76, 0x6E, 0x76,
+  0x3BC, 0x76, 0x6D, 0x76, 0x6B, 0x76, 0x6D, 0x76, 0x70, 0x77, 0x6E, 0x77, 0x3BC, 0x77, 0x6D, 0x77,
+  0x6B, 0x77, 0x6D, 0x77, 0x6B, 0x3C9, 0x6D, 0x3C9, 0x62, 0x71, 0x63, 0x63, 0x63, 0x64, 0x63,
+  0x2215, 0x6B, 0x67, 0x64, 0x62, 0x67, 0x79, 0x68, 0x61, 0x68, 0x70, 0x69, 0x6E, 0x6B, 0x6B, 0x6B,
+  0x6D, 0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x62, 0x6D, 0x69,
+  0x6C, 0x6D, 0x6F, 0x6C, 0x70, 0x68, 0x70, 0x70, 0x6D, 0x70, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77,
+  0x62, 0x76, 0x2215, 0x6D, 0x61, 0x2215, 0x6D, 0x31, 0x65E5, 0x32, 0x65E5, 0x33, 0x65E5, 0x34,
+  0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37, 0x65E5, 0x38, 0x65E5, 0x39, 0x65E5, 0x31, 0x30, 0x65E5,
+  0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35,
+  0x65E5, 0x31, 0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32,
+  0x30, 0x65E5, 0x32, 0x31, 0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5,
+  0x32, 0x35, 0x65E5, 0x32, 0x36, 0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39,
+  0x65E5, 0x33, 0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67, 0x61, 0x6C, 0x66, 0x66, 0x66, 0x69, 0x66,
+  0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73, 0x74, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565,
+  0x574, 0x56B, 0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E9, 0x5C1, 0x5E9, 0x5C2,
+  0x5E9, 0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC,
+  0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC,
+  0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC,
+  0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9,
+  0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0x5D0, 0x5DC, 0x6C7, 0x674, 0x626, 0x627, 0x626, 0x627,
+  0x626, 0x6D5, 0x626, 0x6D5, 0x626, 0x648, 0x626, 0x648, 0x626, 0x6C7, 0x626, 0x6C7, 0x626, 0x6C6,
+  0x626, 0x6C6, 0x626, 0x6C8, 0x626, 0x6C8, 0x626, 0x6D0, 0x626, 0x6D0, 0x626, 0x6D0, 0x626, 0x649,
+  0x626, 0x649, 0x626, 0x649, 0x626, 0x62C, 0x626, 0x62D, 0x626, 0x645, 0x626, 0x649, 0x626, 0x64A,
+  0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x62C,
+  0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645,
+  0x62B, 0x649, 0x62B, 0x64A, 0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C,
+  0x62E, 0x62D, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645, 0x635, 0x62D,
+  0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645, 0x637, 0x62D, 0x637, 0x645,
+  0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D,
+  0x641, 0x62E, 0x641, 0x645, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x62D, 0x642, 0x645, 0x642, 0x649,
+  0x642, 0x64A, 0x643, 0x627, 0x643, 0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645,
+  0x643, 0x649, 0x643, 0x64A, 0x644, 0x62C, 0x644, 0x62D, 0x644, 0x62E, 0x644, 0x645, 0x644, 0x649,
+  0x644, 0x64A, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x645, 0x649, 0x645, 0x64A,
+  0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x649, 0x646, 0x64A, 0x647, 0x62C,
+  0x647, 0x645, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645,
+  0x64A, 0x649, 0x64A, 0x64A, 0x630, 0x670, 0x631, 0x670, 0x649, 0x670, 0x20, 0x64C, 0x651, 0x20,
+  0x64D, 0x651, 0x20, 0x64E, 0x651, 0x20, 0x64F, 0x651, 0x20, 0x650, 0x651, 0x20, 0x651, 0x670,
+  0x626, 0x631, 0x626, 0x632, 0x626, 0x645, 0x626, 0x646, 0x626, 0x649, 0x626, 0x64A, 0x628, 0x631,
+  0x628, 0x632, 0x628, 0x645, 0x628, 0x646, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x631, 0x62A, 0x632,
+  0x62A, 0x645, 0x62A, 0x646, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x631, 0x62B, 0x632, 0x62B, 0x645,
+  0x62B, 0x646, 0x62B, 0x649, 0x62B, 0x64A, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x649, 0x642, 0x64A,
+  0x643, 0x627, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649, 0x643, 0x64A, 0x644, 0x645, 0x644, 0x649,
+  0x644, 0x64A, 0x645, 0x627, 0x645, 0x645, 0x646, 0x631, 0x646, 0x632, 0x646, 0x645, 0x646, 0x646,
+  0x646, 0x649, 0x646, 0x64A, 0x649, 0x670, 0x64A, 0x631, 0x64A, 0x632, 0x64A, 0x645, 0x64A, 0x646,
+  0x64A, 0x649, 0x64A, 0x64A, 0x626, 0x62C, 0x626, 0x62D, 0x626, 0x62E, 0x626, 0x645, 0x626, 0x647,
+  0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x647, 0x62A, 0x62C, 0x62A, 0x62D,
+  0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C,
+  0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645,
+  0x635, 0x62D, 0x635, 0x62E, 0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645,
+  0x637, 0x62D, 0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A, 0x645, 0x641, 0x62C,
+  0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x642, 0x62D, 0x642, 0x645, 0x643, 0x62C, 0x643, 0x62D,
+  0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x644, 0x62C, 0x644, 0x62D, 0x644, 0x62E, 0x644, 0x645,
+  0x644, 0x647, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x646, 0x62C, 0x646, 0x62D,
+  0x646, 0x62E, 0x646, 0x645, 0x646, 0x647, 0x647, 0x62C, 0x647, 0x645, 0x647, 0x670, 0x64A, 0x62C,
+  0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A, 0x647, 0x626, 0x645, 0x626, 0x647, 0x628, 0x645,
+  0x628, 0x647, 0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62B, 0x647, 0x633, 0x645, 0x633, 0x647,
+  0x634, 0x645, 0x634, 0x647, 0x643, 0x644, 0x643, 0x645, 0x644, 0x645, 0x646, 0x645, 0x646, 0x647,
+  0x64A, 0x645, 0x64A, 0x647, 0x640, 0x64E, 0x651, 0x640, 0x64F, 0x651, 0x640, 0x650, 0x651, 0x637,
+  0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A, 0x633, 0x649, 0x633,
+  0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A, 0x62E,
+  0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634,
+  0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x637,
+  0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A, 0x633, 0x649, 0x633,
+  0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A, 0x62E,
+  0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634,
+  0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x634,
+  0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x633, 0x647, 0x634, 0x647, 0x637, 0x645, 0x633,
+  0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x637, 0x645, 0x638,
+  0x645, 0x627, 0x64B, 0x627, 0x64B, 0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D, 0x62C,
+  0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A, 0x645, 0x62C, 0x62A, 0x645, 0x62D, 0x62A, 0x645,
+  0x62E, 0x62C, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x62D, 0x645, 0x64A, 0x62D, 0x645, 0x649, 0x633,
+  0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633, 0x62C, 0x649, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62D,
+  0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635, 0x62D,
+  0x62D, 0x635, 0x645, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634,
+  0x645, 0x62E, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x634, 0x645, 0x645, 0x636, 0x62D, 0x649,
+  0x636, 0x62E, 0x645, 0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637, 0x645, 0x62D, 0x637, 0x645,
+  0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x645, 0x639,
+  0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645, 0x64A, 0x63A, 0x645, 0x649, 0x641, 0x62E, 0x645,
+  0x641, 0x62E, 0x645, 0x642, 0x645, 0x62D, 0x642, 0x645, 0x645, 0x644, 0x62D, 0x645, 0x644, 0x62D,
+  0x64A, 0x644, 0x62D, 0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62C, 0x62C, 0x644, 0x62E, 0x645, 0x644,
+  0x62E, 0x645, 0x644, 0x645, 0x62D, 0x644, 0x645, 0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x645,
+  0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645, 0x645, 0x62E, 0x62C, 0x645, 0x62E,
+  0x645, 0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645, 0x645, 0x646, 0x62D, 0x645, 0x646,
+  0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646, 0x62C, 0x645, 0x646, 0x62C, 0x649, 0x646, 0x645, 0x64A,
+  0x646, 0x645, 0x649, 0x64A, 0x645, 0x645, 0x64A, 0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C,
+  0x64A, 0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A,
+  0x645, 0x649, 0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C, 0x645, 0x649, 0x633, 0x62E, 0x649,
+  0x635, 0x62D, 0x64A, 0x634, 0x62D, 0x64A, 0x636, 0x62D, 0x64A, 0x644, 0x62C, 0x64A, 0x644, 0x645,
+  0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C, 0x64A, 0x64A, 0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642,
+  0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x642, 0x645, 0x62D, 0x644, 0x62D, 0x645, 0x639, 0x645, 0x64A,
+  0x643, 0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A, 0x644, 0x62C, 0x645, 0x643, 0x645,
+  0x645, 0x644, 0x62C, 0x645, 0x646, 0x62C, 0x62D, 0x62C, 0x62D, 0x64A, 0x62D, 0x62C, 0x64A, 0x645,
+  0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D, 0x64A, 0x643, 0x645, 0x645, 0x639, 0x62C, 0x645,
+  0x635, 0x645, 0x645, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A, 0x635, 0x644, 0x6D2, 0x642, 0x644,
+  0x6D2, 0x627, 0x644, 0x644, 0x647, 0x627, 0x643, 0x628, 0x631, 0x645, 0x62D, 0x645, 0x62F, 0x635,
+  0x644, 0x639, 0x645, 0x631, 0x633, 0x648, 0x644, 0x639, 0x644, 0x64A, 0x647, 0x648, 0x633, 0x644,
+  0x645, 0x635, 0x644, 0x649, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639,
+  0x644, 0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627,
+  0x644, 0x647, 0x631, 0x6CC, 0x627, 0x644, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305,
+  0x20, 0x64B, 0x640, 0x64B, 0x20, 0x64C, 0x20, 0x64D, 0x20, 0x64E, 0x640, 0x64E, 0x20, 0x64F,
+  0x640, 0x64F, 0x20, 0x650, 0x640, 0x650, 0x20, 0x651, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652,
+  0x644, 0x622, 0x644, 0x622, 0x644, 0x623, 0x644, 0x623, 0x644, 0x625, 0x644, 0x625, 0x644, 0x627,
+  0x644, 0x627, 0x20, 0x304, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158,
+  0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+  0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9,
+  0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34,
+  0x2C, 0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x28, 0x61, 0x29, 0x28, 0x62,
+  0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29,
+  0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28,
+  0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72,
+  0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29,
+  0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x3014, 0x73, 0x3015, 0x63, 0x64, 0x77,
+  0x7A, 0x68, 0x76, 0x6D, 0x76, 0x73, 0x64, 0x73, 0x73, 0x70, 0x70, 0x76, 0x77, 0x63, 0x6D, 0x63,
+  0x6D, 0x64, 0x6D, 0x72, 0x64, 0x6A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x3014, 0x672C, 0x3015,
+  0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015,
+  0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015,
+};
+
+/**
+ * These are the canonical combining classes other than zero of the code
+ * points that are valid once mapped
+ */
+inline constexpr CombiningClass COMBINING_CLASSES[] = {
+  { 0x300, 0x314, 230 }, { 0x315, 0x315, 232 }, { 0x316, 0x319, 220 }, { 0x31A, 0x31A, 232 },
+  { 0x31B, 0x31B, 216 }, { 0x31C, 0x320, 220 }, { 0x321, 0x322, 202 }, { 0x323, 0x326, 220 },
+  { 0x327, 0x328, 202 }, { 0x329, 0x333, 220 }, { 0x334, 0x338, 1 }, { 0x339, 0x33C, 220 },
+  { 0x33D, 0x33F, 230 }, { 0x342, 0x342, 230 }, { 0x346, 0x346, 230 }, { 0x347, 0x349, 220 },
+  { 0x34A, 0x34C, 230 }, { 0x34D, 0x34E, 220 }, { 0x350, 0x352, 230 }, { 0x353, 0x356, 220 },
+  { 0x357, 0x357, 230 }, { 0x358, 0x358, 232 }, { 0x359, 0x35A, 220 }, { 0x35B, 0x35B, 230 },
+  { 0x35C, 0x35C, 233 }, { 0x35D, 0x35E, 234 }, { 0x35F, 0x35F, 233 }, { 0x360, 0x361, 234 },
+  { 0x362, 0x362, 233 }, { 0x363, 0x36F, 230 }, { 0x483, 0x487, 230 }, { 0x591, 0x591, 220 },
+  { 0x592, 0x595, 230 }, { 0x596, 0x596, 220 }, { 0x597, 0x599, 230 }, { 0x59A, 0x59A, 222 },
+  { 0x59B, 0x59B, 220 }, { 0x59C, 0x5A1, 230 }, { 0x5A2, 0x5A7, 220 }, { 0x5A8, 0x5A9, 230 },
+  { 0x5AA, 0x5AA, 220 }, { 0x5AB, 0x5AC, 230 }, { 0x5AD, 0x5AD, 222 }, { 0x5AE, 0x5AE, 228 },
+  { 0x5AF, 0x5AF, 230 }, { 0x5B0, 0x5B0, 10 }, { 0x5B1, 0x5B1, 11 }, { 0x5B2, 0x5B2, 12 },
+  { 0x5B3, 0x5B3, 13 }, { 0x5B4, 0x5B4, 14 }, { 0x5B5, 0x5B5, 15 }, { 0x5B6, 0x5B6, 16 },
+  { 0x5B7, 0x5B7, 17 }, { 0x5B8, 0x5B8, 18 }, { 0x5B9, 0x5BA, 19 }, { 0x5BB, 0x5BB, 20 },
+  { 0x5BC, 0x5BC, 21 }, { 0x5BD, 0x5BD, 22 }, { 0x5BF, 0x5BF, 23 }, { 0x5C1, 0x5C1, 24 },
+  { 0x5C2, 0x5C2, 25 }, { 0x5C4, 0x5C4, 230 }, { 0x5C5, 0x5C5, 220 }, { 0x5C7, 0x5C7, 18 },
+  { 0x610, 0x617, 230 }, { 0x618, 0x618, 30 }, { 0x619, 0x619, 31 }, { 0x61A, 0x61A, 32 },
+  { 0x64B, 0x64B, 27 }, { 0x64C, 0x64C, 28 }, { 0x64D, 0x64D, 29 }, { 0x64E, 0x64E, 30 },
+  { 0x64F, 0x64F, 31 }, { 0x650, 0x650, 32 }, { 0x651, 0x651, 33 }, { 0x652, 0x652, 34 },
+  { 0x653, 0x654, 230 }, { 0x655, 0x656, 220 }, { 0x657, 0x65B, 230 }, { 0x65C, 0x65C, 220 },
+  { 0x65D, 0x65E, 230 }, { 0x65F, 0x65F, 220 }, { 0x670, 0x670, 35 }, { 0x6D6, 0x6DC, 230 },
+  { 0x6DF, 0x6E2, 230 }, { 0x6E3, 0x6E3, 220 }, { 0x6E4, 0x6E4, 230 }, { 0x6E7, 0x6E8, 230 },
+  { 0x6EA, 0x6EA, 220 }, { 0x6EB, 0x6EC, 230 }, { 0x6ED, 0x6ED, 220 }, { 0x711, 0x711, 36 },
+  { 0x730, 0x730, 230 }, { 0x731, 0x731, 220 }, { 0x732, 0x733, 230 }, { 0x734, 0x734, 220 },
+  { 0x735, 0x736, 230 }, { 0x737, 0x739, 220 }, { 0x73A, 0x73A, 230 }, { 0x73B, 0x73C, 220 },
+  { 0x73D, 0x73D, 230 }, { 0x73E, 0x73E, 220 }, { 0x73F, 0x741, 230 }, { 0x742, 0x742, 220 },
+  { 0x743, 0x743, 230 }, { 0x744, 0x744, 220 }, { 0x745, 0x745, 230 }, { 0x746, 0x746, 220 },
+  { 0x747, 0x747, 230 }, { 0x748, 0x748, 220 }, { 0x749, 0x74A, 230 }, { 0x7EB, 0x7F1, 230 },
+  { 0x7F2, 0x7F2, 220 }, { 0x7F3, 0x7F3, 230 }, { 0x7FD, 0x7FD, 220 }, { 0x816, 0x819, 230 },
+  { 0x81B, 0x823, 230 }, { 0x825, 0x827, 230 }, { 0x829, 0x82D, 230 }, { 0x859, 0x85B, 220 },
+  { 0x898, 0x898, 230 }, { 0x899, 0x89B, 220 }, { 0x89C, 0x89F, 230 }, { 0x8CA, 0x8CE, 230 },
+  { 0x8CF, 0x8D3, 220 }, { 0x8D4, 0x8E1, 230 }, { 0x8E3, 0x8E3, 220 }, { 0x8E4, 0x8E5, 230 },
+  { 0x8E6, 0x8E6, 220 }, { 0x8E7, 0x8E8, 230 }, { 0x8E9, 0x8E9, 220 }, { 0x8EA, 0x8EC, 230 },
+  { 0x8ED, 0x8EF, 220 }, { 0x8F0, 0x8F0, 27 }, { 0x8F1, 0x8F1, 28 }, { 0x8F2, 0x8F2, 29 },
+  { 0x8F3, 0x8F5, 230 }, { 0x8F6, 0x8F6, 220 }, { 0x8F7, 0x8F8, 230 }, { 0x8F9, 0x8FA, 220 },
+  { 0x8FB, 0x8FF, 230 }, { 0x93C, 0x93C, 7 }, { 0x94D, 0x94D, 9 }, { 0x951, 0x951, 230 },
+  { 0x952, 0x952, 220 }, { 0x953, 0x954, 230 }, { 0x9BC, 0x9BC, 7 }, { 0x9CD, 0x9CD, 9 },
+  { 0x9FE, 0x9FE, 230 }, { 0xA3C, 0xA3C, 7 }, { 0xA4D, 0xA4D, 9 }, { 0xABC, 0xABC, 7 },
+  { 0xACD, 0xACD, 9 }, { 0xB3C, 0xB3C, 7 }, { 0xB4D, 0xB4D, 9 }, { 0xBCD, 0xBCD, 9 },
+  { 0xC3C, 0xC3C, 7 }, { 0xC4D, 0xC4D, 9 }, { 0xC55, 0xC55, 84 }, { 0xC56, 0xC56, 91 },
+  { 0xCBC, 0xCBC, 7 }, { 0xCCD, 0xCCD, 9 }, { 0xD3B, 0xD3C, 9 }, { 0xD4D, 0xD4D, 9 },
+  { 0xDCA, 0xDCA, 9 }, { 0xE38, 0xE39, 103 }, { 0xE3A, 0xE3A, 9 }, { 0xE48, 0xE4B, 107 },
+  { 0xEB8, 0xEB9, 118 }, { 0xEBA, 0xEBA, 9 }, { 0xEC8, 0xECB, 122 }, { 0xF18, 0xF19, 220 },
+  { 0xF35, 0xF35, 220 }, { 0xF37, 0xF37, 220 }, { 0xF39, 0xF39, 216 }, { 0xF71, 0xF71, 129 },
+  { 0xF72, 0xF72, 130 }, { 0xF74, 0xF74, 132 }, { 0xF7A, 0xF7D, 130 }, { 0xF80, 0xF80, 130 },
+  { 0xF82, 0xF83, 230 }, { 0xF84, 0xF84, 9 }, { 0xF86, 0xF87, 230 }, { 0xFC6, 0xFC6, 220 },
+  { 0x1037, 0x1037, 7 }, { 0x1039, 0x103A, 9 }, { 0x108D, 0x108D, 220 }, { 0x135D, 0x135F, 230 },
+  { 0x1714, 0x1715, 9 }, { 0x1734, 0x1734, 9 }, { 0x17D2, 0x17D2, 9 }, { 0x17DD, 0x17DD, 230 },
+  { 0x18A9, 0x18A9, 228 }, { 0x1939, 0x1939, 222 }, { 0x193A, 0x193A, 230 },
+  { 0x193B, 0x193B, 220 }, { 0x1A17, 0x1A17, 230 }, { 0x1A18, 0x1A18, 220 }, { 0x1A60, 0x1A60, 9 },
+  { 0x1A75, 0x1A7C, 230 }, { 0x1A7F, 0x1A7F, 220 }, { 0x1AB0, 0x1AB4, 230 },
+  { 0x1AB5, 0x1ABA, 220 }, { 0x1ABB, 0x1ABC, 230 }, { 0x1ABD, 0x1ABD, 220 },
+  { 0x1ABF, 0x1AC0, 220 }, { 0x1AC1, 0x1AC2, 230 }, { 0x1AC3, 0x1AC4, 220 },
+  { 0x1AC5, 0x1AC9, 230 }, { 0x1ACA, 0x1ACA, 220 }, { 0x1ACB, 0x1ACE, 230 }, { 0x1B34, 0x1B34, 7 },
+  { 0x1B44, 0x1B44, 9 }, { 0x1B6B, 0x1B6B, 230 }, { 0x1B6C, 0x1B6C, 220 }, { 0x1B6D, 0x1B73, 230 },
+  { 0x1BAA, 0x1BAB, 9 }, { 0x1BE6, 0x1BE6, 7 }, { 0x1BF2, 0x1BF3, 9 }, { 0x1C37, 0x1C37, 7 },
+  { 0x1CD0, 0x1CD2, 230 }, { 0x1CD4, 0x1CD4, 1 }, { 0x1CD5, 0x1CD9, 220 }, { 0x1CDA, 0x1CDB, 230 },
+  { 0x1CDC, 0x1CDF, 220 }, { 0x1CE0, 0x1CE0, 230 }, { 0x1CE2, 0x1CE8, 1 }, { 0x1CED, 0x1CED, 220 },
+  { 0x1CF4, 0x1CF4, 230 }, { 0x1CF8, 0x1CF9, 230 }, { 0x1DC0, 0x1DC1, 230 },
+  { 0x1DC2, 0x1DC2, 220 }, { 0x1DC3, 0x1DC9, 230 }, { 0x1DCA, 0x1DCA, 220 },
+  { 0x1DCB, 0x1DCC, 230 }, { 0x1DCD, 0x1DCD, 234 }, { 0x1DCE, 0x1DCE, 214 },
+  { 0x1DCF, 0x1DCF, 220 }, { 0x1DD0, 0x1DD0, 202 }, { 0x1DD1, 0x1DF5, 230 },
+  { 0x1DF6, 0x1DF6, 232 }, { 0x1DF7, 0x1DF8, 228 }, { 0x1DF9, 0x1DF9, 220 },
+  { 0x1DFA, 0x1DFA, 218 }, { 0x1DFB, 0x1DFB, 230 }, { 0x1DFC, 0x1DFC, 233 },
+  { 0x1DFD, 0x1DFD, 220 }, { 0x1DFE, 0x1DFE, 230 }, { 0x1DFF, 0x1DFF, 220 },
+  { 0x20D0, 0x20D1, 230 }, { 0x20D2, 0x20D3, 1 }, { 0x20D4, 0x20D7, 230 }, { 0x20D8, 0x20DA, 1 },
+  { 0x20DB, 0x20DC, 230 }, { 0x20E1, 0x20E1, 230 }, { 0x20E5, 0x20E6, 1 }, { 0x20E7, 0x20E7, 230 },
+  { 0x20E8, 0x20E8, 220 }, { 0x20E9, 0x20E9, 230 }, { 0x20EA, 0x20EB, 1 }, { 0x20EC, 0x20EF, 220 },
+  { 0x20F0, 0x20F0, 230 }, { 0x2CEF, 0x2CF1, 230 }, { 0x2D7F, 0x2D7F, 9 }, { 0x2DE0, 0x2DFF, 230 },
+  { 0x302A, 0x302A, 218 }, { 0x302B, 0x302B, 228 }, { 0x302C, 0x302C, 232 },
+  { 0x302D, 0x302D, 222 }, { 0x302E, 0x302F, 224 }, { 0x3099, 0x309A, 8 }, { 0xA66F, 0xA66F, 230 },
+  { 0xA674, 0xA67D, 230 }, { 0xA69E, 0xA69F, 230 }, { 0xA6F0, 0xA6F1, 230 }, { 0xA806, 0xA806, 9 },
+  { 0xA82C, 0xA82C, 9 }, { 0xA8C4, 0xA8C4, 9 }, { 0xA8E0, 0xA8F1, 230 }, { 0xA92B, 0xA92D, 220 },
+  { 0xA953, 0xA953, 9 }, { 0xA9B3, 0xA9B3, 7 }, { 0xA9C0, 0xA9C0, 9 }, { 0xAAB0, 0xAAB0, 230 },
+  { 0xAAB2, 0xAAB3, 230 }, { 0xAAB4, 0xAAB4, 220 }, { 0xAAB7, 0xAAB8, 230 },
+  { 0xAABE, 0xAABF, 230 }, { 0xAAC1, 0xAAC1, 230 }, { 0xAAF6, 0xAAF6, 9 }, { 0xABED, 0xABED, 9 },
+  { 0xFB1E, 0xFB1E, 26 }, { 0xFE20, 0xFE26, 230 }, { 0xFE27, 0xFE2D, 220 }, { 0xFE2E, 0xFE2F, 230 },
+  { 0x101FD, 0x101FD, 220 }, { 0x102E0, 0x102E0, 220 }, { 0x10376, 0x1037A, 230 },
+  { 0x10A0D, 0x10A0D, 220 }, { 0x10A0F, 0x10A0F, 230 }, { 0x10A38, 0x10A38, 230 },
+  { 0x10A39, 0x10A39, 1 }, { 0x10A3A, 0x10A3A, 220 }, { 0x10A3F, 0x10A3F, 9 },
+  { 0x10AE5, 0x10AE5, 230 }, { 0x10AE6, 0x10AE6, 220 }, { 0x10D24, 0x10D27, 230 },
+  { 0x10EAB, 0x10EAC, 230 }, { 0x10EFD, 0x10EFF, 220 }, { 0x10F46, 0x10F47, 220 },
+  { 0x10F48, 0x10F4A, 230 }, { 0x10F4B, 0x10F4B, 220 }, { 0x10F4C, 0x10F4C, 230 },
+  { 0x10F4D, 0x10F50, 220 }, { 0x10F82, 0x10F82, 230 }, { 0x10F83, 0x10F83, 220 },
+  { 0x10F84, 0x10F84, 230 }, { 0x10F85, 0x10F85, 220 }, { 0x11046, 0x11046, 9 },
+  { 0x11070, 0x11070, 9 }, { 0x1107F, 0x1107F, 9 }, { 0x110B9, 0x110B9, 9 },
+  { 0x110BA, 0x110BA, 7 }, { 0x11100, 0x11102, 230 }, { 0x11133, 0x11134, 9 },
+  { 0x11173, 0x11173, 7 }, { 0x111C0, 0x111C0, 9 }, { 0x111CA, 0x111CA, 7 },
+  { 0x11235, 0x11235, 9 }, { 0x11236, 0x11236, 7 }, { 0x112E9, 0x112E9, 7 },
+  { 0x112EA, 0x112EA, 9 }, { 0x1133B, 0x1133C, 7 }, { 0x1134D, 0x1134D, 9 },
+  { 0x11366, 0x1136C, 230 }, { 0x11370, 0x11374, 230 }, { 0x11442, 0x11442, 9 },
+  { 0x11446, 0x11446, 7 }, { 0x1145E, 0x1145E, 230 }, { 0x114C2, 0x114C2, 9 },
+  { 0x114C3, 0x114C3, 7 }, { 0x115BF, 0x115BF, 9 }, { 0x115C0, 0x115C0, 7 },
+  { 0x1163F, 0x1163F, 9 }, { 0x116B6, 0x116B6, 9 }, { 0x116B7, 0x116B7, 7 },
+  { 0x1172B, 0x1172B, 9 }, { 0x11839, 0x11839, 9 }, { 0x1183A, 0x1183A, 7 },
+  { 0x1193D, 0x1193E, 9 }, { 0x11943, 0x11943, 7 }, { 0x119E0, 0x119E0, 9 },
+  { 0x11A34, 0x11A34, 9 }, { 0x11A47, 0x11A47, 9 }, { 0x11A99, 0x11A99, 9 },
+  { 0x11C3F, 0x11C3F, 9 }, { 0x11D42, 0x11D42, 7 }, { 0x11D44, 0x11D45, 9 },
+  { 0x11D97, 0x11D97, 9 }, { 0x11F41, 0x11F42, 9 }, { 0x16AF0, 0x16AF4, 1 },
+  { 0x16B30, 0x16B36, 230 }, { 0x16FF0, 0x16FF1, 6 }, { 0x1BC9E, 0x1BC9E, 1 },
+  { 0x1D165, 0x1D166, 216 }, { 0x1D167, 0x1D169, 1 }, { 0x1D16D, 0x1D16D, 226 },
+  { 0x1D16E, 0x1D172, 216 }, { 0x1D17B, 0x1D182, 220 }, { 0x1D185, 0x1D189, 230 },
+  { 0x1D18A, 0x1D18B, 220 }, { 0x1D1AA, 0x1D1AD, 230 }, { 0x1D242, 0x1D244, 230 },
+  { 0x1E000, 0x1E006, 230 }, { 0x1E008, 0x1E018, 230 }, { 0x1E01B, 0x1E021, 230 },
+  { 0x1E023, 0x1E024, 230 }, { 0x1E026, 0x1E02A, 230 }, { 0x1E08F, 0x1E08F, 230 },
+  { 0x1E130, 0x1E136, 230 }, { 0x1E2AE, 0x1E2AE, 230 }, { 0x1E2EC, 0x1E2EF, 230 },
+  { 0x1E4EC, 0x1E4ED, 232 }, { 0x1E4EE, 0x1E4EE, 220 }, { 0x1E4EF, 0x1E4EF, 230 },
+  { 0x1E8D0, 0x1E8D6, 220 }, { 0x1E944, 0x1E949, 230 }, { 0x1E94A, 0x1E94A, 7 },
+};
+
+/**
+ * These are the full canonical decompositions of the code points that are
+ * valid once mapped, but for the Hangul syllables
+ */
+inline constexpr Expansion DECOMPOSITIONS[] = {
+  { 0xE0, 0, 2 }, { 0xE1, 2, 2 }, { 0xE2, 4, 2 }, { 0xE3, 6, 2 }, { 0xE4, 8, 2 }, { 0xE5, 10, 2 },
+  { 0xE7, 12, 2 }, { 0xE8, 14, 2 }, { 0xE9, 16, 2 }, { 0xEA, 18, 2 }, { 0xEB, 20, 2 },
+  { 0xEC, 22, 2 }, { 0xED, 24, 2 }, { 0xEE, 26, 2 }, { 0xEF, 28, 2 }, { 0xF1, 30, 2 },
+  { 0xF2, 32, 2 }, { 0xF3, 34, 2 }, { 0xF4, 36, 2 }, { 0xF5, 38, 2 }, { 0xF6, 40, 2 },
+  { 0xF9, 42, 2 }, { 0xFA, 44, 2 }, { 0xFB, 46, 2 }, { 0xFC, 48, 2 }, { 0xFD, 50, 2 },
+  { 0xFF, 52, 2 }, { 0x101, 54, 2 }, { 0x103, 56, 2 }, { 0x105, 58, 2 }, { 0x107, 60, 2 },
+  { 0x109, 62, 2 }, { 0x10B, 64, 2 }, { 0x10D, 66, 2 }, { 0x10F, 68, 2 }, { 0x113, 70, 2 },
+  { 0x115, 72, 2 }, { 0x117, 74, 2 }, { 0x119, 76, 2 }, { 0x11B, 78, 2 }, { 0x11D, 80, 2 },
+  { 0x11F, 82, 2 }, { 0x121, 84, 2 }, { 0x123, 86, 2 }, { 0x125, 88, 2 }, { 0x129, 90, 2 },
+  { 0x12B, 92, 2 }, { 0x12D, 94, 2 }, { 0x12F, 96, 2 }, { 0x135, 98, 2 }, { 0x137, 100, 2 },
+  { 0x13A, 102, 2 }, { 0x13C, 104, 2 }, { 0x13E, 106, 2 }, { 0x144, 108, 2 }, { 0x146, 110, 2 },
+  { 0x148, 112, 2 }, { 0x14D, 114, 2 }, { 0x14F, 116, 2 }, { 0x151, 118, 2 }, { 0x155, 120, 2 },
+  { 0x157, 122, 2 }, { 0x159, 124, 2 }, { 0x15B, 126, 2 }, { 0x15D, 128, 2 }, { 0x15F, 130, 2 },
+  { 0x161, 132, 2 }, { 0x163, 134, 2 }, { 0x165, 136, 2 }, { 0x169, 138, 2 }, { 0x16B, 140, 2 },
+  { 0x16D, 142, 2 }, { 0x16F, 144, 2 }, { 0x171, 146, 2 }, { 0x173, 148, 2 }, { 0x175, 150, 2 },
+  { 0x177, 152, 2 }, { 0x17A, 154, 2 }, { 0x17C, 156, 2 }, { 0x17E, 158, 2 }, { 0x1A1, 160, 2 },
+  { 0x1B0, 162, 2 }, { 0x1CE, 164, 2 }, { 0x1D0, 166, 2 }, { 0x1D2, 168, 2 }, { 0x1D4, 170, 2 },
+  { 0x1D6, 172, 3 }, { 0x1D8, 175, 3 }, { 0x1DA, 178, 3 }, { 0x1DC, 181, 3 }, { 0x1DF, 184, 3 },
+  { 0x1E1, 187, 3 }, { 0x1E3, 190, 2 }, { 0x1E7, 192, 2 }, { 0x1E9, 194, 2 }, { 0x1EB, 196, 2 },
+  { 0x1ED, 198, 3 }, { 0x1EF, 201, 2 }, { 0x1F0, 203, 2 }, { 0x1F5, 205, 2 }, { 0x1F9, 207, 2 },
+  { 0x1FB, 209, 3 }, { 0x1FD, 212, 2 }, { 0x1FF, 214, 2 }, { 0x201, 216, 2 }, { 0x203, 218, 2 },
+  { 0x205, 220, 2 }, { 0x207, 222, 2 }, { 0x209, 224, 2 }, { 0x20B, 226, 2 }, { 0x20D, 228, 2 },
+  { 0x20F, 230, 2 }, { 0x211, 232, 2 }, { 0x213, 234, 2 }, { 0x215, 236, 2 }, { 0x217, 238, 2 },
+  { 0x219, 240, 2 }, { 0x21B, 242, 2 }, { 0x21F, 244, 2 }, { 0x227, 246, 2 }, { 0x229, 248, 2 },
+  { 0x22B, 250, 3 }, { 0x22D, 253, 3 }, { 0x22F, 256, 2 }, { 0x231, 258, 3 }, { 0x233, 261, 2 },
+  { 0x390, 263, 3 }, { 0x3AC, 266, 2 }, { 0x3AD, 268, 2 }, { 0x3AE, 270, 2 }, { 0x3AF, 272, 2 },
+  { 0x3B0, 274, 3 }, { 0x3CA, 277, 2 }, { 0x3CB, 279, 2 }, { 0x3CC, 281, 2 }, { 0x3CD, 283, 2 },
+  { 0x3CE, 285, 2 }, { 0x439, 287, 2 }, { 0x450, 289, 2 }, { 0x451, 291, 2 }, { 0x453, 293, 2 },
+  { 0x457, 295, 2 }, { 0x45C, 297, 2 }, { 0x45D, 299, 2 }, { 0x45E, 301, 2 }, { 0x477, 303, 2 },
+  { 0x4C2, 305, 2 }, { 0x4D1, 307, 2 }, { 0x4D3, 309, 2 }, { 0x4D7, 311, 2 }, { 0x4DB, 313, 2 },
+  { 0x4DD, 315, 2 }, { 0x4DF, 317, 2 }, { 0x4E3, 319, 2 }, { 0x4E5, 321, 2 }, { 0x4E7, 323, 2 },
+  { 0x4EB, 325, 2 }, { 0x4ED, 327, 2 }, { 0x4EF, 329, 2 }, { 0x4F1, 331, 2 }, { 0x4F3, 333, 2 },
+  { 0x4F5, 335, 2 }, { 0x4F9, 337, 2 }, { 0x622, 339, 2 }, { 0x623, 341, 2 }, { 0x624, 343, 2 },
+  { 0x625, 345, 2 }, { 0x626, 347, 2 }, { 0x6C0, 349, 2 }, { 0x6C2, 351, 2 }, { 0x6D3, 353, 2 },
+  { 0x929, 355, 2 }, { 0x931, 357, 2 }, { 0x934, 359, 2 }, { 0x9CB, 361, 2 }, { 0x9CC, 363, 2 },
+  { 0xB48, 365, 2 }, { 0xB4B, 367, 2 }, { 0xB4C, 369, 2 }, { 0xB94, 371, 2 }, { 0xBCA, 373, 2 },
+  { 0xBCB, 375, 2 }, { 0xBCC, 377, 2 }, { 0xC48, 379, 2 }, { 0xCC0, 381, 2 }, { 0xCC7, 383, 2 },
+  { 0xCC8, 385, 2 }, { 0xCCA, 387, 2 }, { 0xCCB, 389, 3 }, { 0xD4A, 392, 2 }, { 0xD4B, 394, 2 },
+  { 0xD4C, 396, 2 }, { 0xDDA, 398, 2 }, { 0xDDC, 400, 2 }, { 0xDDD, 402, 3 }, { 0xDDE, 405, 2 },
+  { 0x1026, 407, 2 }, { 0x1B06, 409, 2 }, { 0x1B08, 411, 2 }, { 0x1B0A, 413, 2 },
+  { 0x1B0C, 415, 2 }, { 0x1B0E, 417, 2 }, { 0x1B12, 419, 2 }, { 0x1B3B, 421, 2 },
+  { 0x1B3D, 423, 2 }, { 0x1B40, 425, 2 }, { 0x1B41, 427, 2 }, { 0x1B43, 429, 2 },
+  { 0x1E01, 431, 2 }, { 0x1E03, 433, 2 }, { 0x1E05, 435, 2 }, { 0x1E07, 437, 2 },
+  { 0x1E09, 439, 3 }, { 0x1E0B, 442, 2 }, { 0x1E0D, 444, 2 }, { 0x1E0F, 446, 2 },
+  { 0x1E11, 448, 2 }, { 0x1E13, 450, 2 }, { 0x1E15, 452, 3 }, { 0x1E17, 455, 3 },
+  { 0x1E19, 458, 2 }, { 0x1E1B, 460, 2 }, { 0x1E1D, 462, 3 }, { 0x1E1F, 465, 2 },
+  { 0x1E21, 467, 2 }, { 0x1E23, 469, 2 }, { 0x1E25, 471, 2 }, { 0x1E27, 473, 2 },
+  { 0x1E29, 475, 2 }, { 0x1E2B, 477, 2 }, { 0x1E2D, 479, 2 }, { 0x1E2F, 481, 3 },
+  { 0x1E31, 484, 2 }, { 0x1E33, 486, 2 }, { 0x1E35, 488, 2 }, { 0x1E37, 490, 2 },
+  { 0x1E39, 492, 3 }, { 0x1E3B, 495, 2 }, { 0x1E3D, 497, 2 }, { 0x1E3F, 499, 2 },
+  { 0x1E41, 501, 2 }, { 0x1E43, 503, 2 }, { 0x1E45, 505, 2 }, { 0x1E47, 507, 2 },
+  { 0x1E49, 509, 2 }, { 0x1E4B, 511, 2 }, { 0x1E4D, 513, 3 }, { 0x1E4F, 516, 3 },
+  { 0x1E51, 519, 3 }, { 0x1E53, 522, 3 }, { 0x1E55, 525, 2 }, { 0x1E57, 527, 2 },
+  { 0x1E59, 529, 2 }, { 0x1E5B, 531, 2 }, { 0x1E5D, 533, 3 }, { 0x1E5F, 536, 2 },
+  { 0x1E61, 538, 2 }, { 0x1E63, 540, 2 }, { 0x1E65, 542, 3 }, { 0x1E67, 545, 3 },
+  { 0x1E69, 548, 3 }, { 0x1E6B, 551, 2 }, { 0x1E6D, 553, 2 }, { 0x1E6F, 555, 2 },
+  { 0x1E71, 557, 2 }, { 0x1E73, 559, 2 }, { 0x1E75, 561, 2 }, { 0x1E77, 563, 2 },
+  { 0x1E79, 565, 3 }, { 0x1E7B, 568, 3 }, { 0x1E7D, 571, 2 }, { 0x1E7F, 573, 2 },
+  { 0x1E81, 575, 2 }, { 0x1E83, 577, 2 }, { 0x1E85, 579, 2 }, { 0x1E87, 581, 2 },
+  { 0x1E89, 583, 2 }, { 0x1E8B, 585, 2 }, { 0x1E8D, 587, 2 }, { 0x1E8F, 589, 2 },
+  { 0x1E91, 591, 2 }, { 0x1E93, 593, 2 }, { 0x1E95, 595, 2 }, { 0x1E96, 597, 2 },
+  { 0x1E97, 599, 2 }, { 0x1E98, 601, 2 }, { 0x1E99, 603, 2 }, { 0x1EA1, 605, 2 },
+  { 0x1EA3, 607, 2 }, { 0x1EA5, 609, 3 }, { 0x1EA7, 612, 3 }, { 0x1EA9, 615, 3 },
+  { 0x1EAB, 618, 3 }, { 0x1EAD, 621, 3 }, { 0x1EAF, 624, 3 }, { 0x1EB1, 627, 3 },
+  { 0x1EB3, 630, 3 }, { 0x1EB5, 633, 3 }, { 0x1EB7, 636, 3 }, { 0x1EB9, 639, 2 },
+  { 0x1EBB, 641, 2 }, { 0x1EBD, 643, 2 }, { 0x1EBF, 645, 3 }, { 0x1EC1, 648, 3 },
+  { 0x1EC3, 651, 3 }, { 0x1EC5, 654, 3 }, { 0x1EC7, 657, 3 }, { 0x1EC9, 660, 2 },
+  { 0x1ECB, 662, 2 }, { 0x1ECD, 664, 2 }, { 0x1ECF, 666, 2 }, { 0x1ED1, 668, 3 },
+  { 0x1ED3, 671, 3 }, { 0x1ED5, 674, 3 }, { 0x1ED7, 677, 3 }, { 0x1ED9, 680, 3 },
+  { 0x1EDB, 683, 3 }, { 0x1EDD, 686, 3 }, { 0x1EDF, 689, 3 }, { 0x1EE1, 692, 3 },
+  { 0x1EE3, 695, 3 }, { 0x1EE5, 698, 2 }, { 0x1EE7, 700, 2 }, { 0x1EE9, 702, 3 },
+  { 0x1EEB, 705, 3 }, { 0x1EED, 708, 3 }, { 0x1EEF, 711, 3 }, { 0x1EF1, 714, 3 },
+  { 0x1EF3, 717, 2 }, { 0x1EF5, 719, 2 }, { 0x1EF7, 721, 2 }, { 0x1EF9, 723, 2 },
+  { 0x1F00, 725, 2 }, { 0x1F01, 727, 2 }, { 0x1F02, 729, 3 }, { 0x1F03, 732, 3 },
+  { 0x1F04, 735, 3 }, { 0x1F05, 738, 3 }, { 0x1F06, 741, 3 }, { 0x1F07, 744, 3 },
+  { 0x1F10, 747, 2 }, { 0x1F11, 749, 2 }, { 0x1F12, 751, 3 }, { 0x1F13, 754, 3 },
+  { 0x1F14, 757, 3 }, { 0x1F15, 760, 3 }, { 0x1F20, 763, 2 }, { 0x1F21, 765, 2 },
+  { 0x1F22, 767, 3 }, { 0x1F23, 770, 3 }, { 0x1F24, 773, 3 }, { 0x1F25, 776, 3 },
+  { 0x1F26, 779, 3 }, { 0x1F27, 782, 3 }, { 0x1F30, 785, 2 }, { 0x1F31, 787, 2 },
+  { 0x1F32, 789, 3 }, { 0x1F33, 792, 3 }, { 0x1F34, 795, 3 }, { 0x1F35, 798, 3 },
+  { 0x1F36, 801, 3 }, { 0x1F37, 804, 3 }, { 0x1F40, 807, 2 }, { 0x1F41, 809, 2 },
+  { 0x1F42, 811, 3 }, { 0x1F43, 814, 3 }, { 0x1F44, 817, 3 }, { 0x1F45, 820, 3 },
+  { 0x1F50, 823, 2 }, { 0x1F51, 825, 2 }, { 0x1F52, 827, 3 }, { 0x1F53, 830, 3 },
+  { 0x1F54, 833, 3 }, { 0x1F55, 836, 3 }, { 0x1F56, 839, 3 }, { 0x1F57, 842, 3 },
+  { 0x1F60, 845, 2 }, { 0x1F61, 847, 2 }, { 0x1F62, 849, 3 }, { 0x1F63, 852, 3 },
+  { 0x1F64, 855, 3 }, { 0x1F65, 858, 3 }, { 0x1F66, 861, 3 }, { 0x1F67, 864, 3 },
+  { 0x1F70, 867, 2 }, { 0x1F72, 869, 2 }, { 0x1F74, 871, 2 }, { 0x1F76, 873, 2 },
+  { 0x1F78, 875, 2 }, { 0x1F7A, 877, 2 }, { 0x1F7C, 879, 2 }, { 0x1FB0, 881, 2 },
+  { 0x1FB1, 883, 2 }, { 0x1FB6, 885, 2 }, { 0x1FC6, 887, 2 }, { 0x1FD0, 889, 2 },
+  { 0x1FD1, 891, 2 }, { 0x1FD2, 893, 3 }, { 0x1FD6, 896, 2 }, { 0x1FD7, 898, 3 },
+  { 0x1FE0, 901, 2 }, { 0x1FE1, 903, 2 }, { 0x1FE2, 905, 3 }, { 0x1FE4, 908, 2 },
+  { 0x1FE5, 910, 2 }, { 0x1FE6, 912, 2 }, { 0x1FE7, 914, 3 }, { 0x1FF6, 917, 2 },
+  { 0x219A, 919, 2 }, { 0x219B, 921, 2 }, { 0x21AE, 923, 2 }, { 0x21CD, 925, 2 },
+  { 0x21CE, 927, 2 }, { 0x21CF, 929, 2 }, { 0x2204, 931, 2 }, { 0x2209, 933, 2 },
+  { 0x220C, 935, 2 }, { 0x2224, 937, 2 }, { 0x2226, 939, 2 }, { 0x2241, 941, 2 },
+  { 0x2244, 943, 2 }, { 0x2247, 945, 2 }, { 0x2249, 947, 2 }, { 0x2260, 949, 2 },
+  { 0x2262, 951, 2 }, { 0x226D, 953, 2 }, { 0x226E, 955, 2 }, { 0x226F, 957, 2 },
+  { 0x2270, 959, 2 }, { 0x2271, 961, 2 }, { 0x2274, 963, 2 }, { 0x2275, 965, 2 },
+  { 0x2278, 967, 2 }, { 0x2279, 969, 2 }, { 0x2280, 971, 2 }, { 0x2281, 973, 2 },
+  { 0x2284, 975, 2 }, { 0x2285, 977, 2 }, { 0x2288, 979, 2 }, { 0x2289, 981, 2 },
+  { 0x22AC, 983, 2 }, { 0x22AD, 985, 2 }, { 0x22AE, 987, 2 }, { 0x22AF, 989, 2 },
+  { 0x22E0, 991, 2 }, { 0x22E1, 993, 2 }, { 0x22E2, 995, 2 }, { 0x22E3, 997, 2 },
+  { 0x22EA, 999, 2 }, { 0x22EB, 1001, 2 }, { 0x22EC, 1003, 2 }, { 0x22ED, 1005, 2 },
+  { 0x304C, 1007, 2 }, { 0x304E, 1009, 2 }, { 0x3050, 1011, 2 }, { 0x3052, 1013, 2 },
+  { 0x3054, 1015, 2 }, { 0x3056, 1017, 2 }, { 0x3058, 1019, 2 }, { 0x305A, 1021, 2 },
+  { 0x305C, 1023, 2 }, { 0x305E, 1025, 2 }, { 0x3060, 1027, 2 }, { 0x3062, 1029, 2 },
+  { 0x3065, 1031, 2 }, { 0x3067, 1033, 2 }, { 0x3069, 1035, 2 }, { 0x3070, 1037, 2 },
+  { 0x3071, 1039, 2 }, { 0x3073, 1041, 2 }, { 0x3074, 1043, 2 }, { 0x3076, 1045, 2 },
+  { 0x3077, 1047, 2 }, { 0x3079, 1049, 2 }, { 0x307A, 1051, 2 }, { 0x307C, 1053, 2 },
+  { 0x307D, 1055, 2 }, { 0x3094, 1057, 2 }, { 0x309E, 1059, 2 }, { 0x30AC, 1061, 2 },
+  { 0x30AE, 1063, 2 }, { 0x30B0, 1065, 2 }, { 0x30B2, 1067, 2 }, { 0x30B4, 1069, 2 },
+  { 0x30B6, 1071, 2 }, { 0x30B8, 1073, 2 }, { 0x30BA, 1075, 2 }, { 0x30BC, 1077, 2 },
+  { 0x30BE, 1079, 2 }, { 0x30C0, 1081, 2 }, { 0x30C2, 1083, 2 }, { 0x30C5, 1085, 2 },
+  { 0x30C7, 1087, 2 }, { 0x30C9, 1089, 2 }, { 0x30D0, 1091, 2 }, { 0x30D1, 1093, 2 },
+  { 0x30D3, 1095, 2 }, { 0x30D4, 1097, 2 }, { 0x30D6, 1099, 2 }, { 0x30D7, 1101, 2 },
+  { 0x30D9, 1103, 2 }, { 0x30DA, 1105, 2 }, { 0x30DC, 1107, 2 }, { 0x30DD, 1109, 2 },
+  { 0x30F4, 1111, 2 }, { 0x30F7, 1113, 2 }, { 0x30F8, 1115, 2 }, { 0x30F9, 1117, 2 },
+  { 0x30FA, 1119, 2 }, { 0x30FE, 1121, 2 }, { 0x1109A, 1123, 2 }, { 0x1109C, 1125, 2 },
+  { 0x110AB, 1127, 2 }, { 0x1112E, 1129, 2 }, { 0x1112F, 1131, 2 }, { 0x1134B, 1133, 2 },
+  { 0x1134C, 1135, 2 }, { 0x114BB, 1137, 2 }, { 0x114BC, 1139, 2 }, { 0x114BE, 1141, 2 },
+  { 0x115BA, 1143, 2 }, { 0x115BB, 1145, 2 }, { 0x11938, 1147, 2 },
+};
+
+inline constexpr char32_t DECOMPOSED[] = {
+  0x61, 0x300, 0x61, 0x301, 0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A, 0x63, 0x327, 0x65,
+  0x300, 0x65, 0x301, 0x65, 0x302, 0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302, 0x69, 0x308,
+  0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301, 0x6F, 0x302, 0x6F, 0x303, 0x6F, 0x308, 0x75, 0x300, 0x75,
+  0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301, 0x79, 0x308, 0x61, 0x304, 0x61, 0x306, 0x61, 0x328,
+  0x63, 0x301, 0x63, 0x302, 0x63, 0x307, 0x63, 0x30C, 0x64, 0x30C, 0x65, 0x304, 0x65, 0x306, 0x65,
+  0x307, 0x65, 0x328, 0x65, 0x30C, 0x67, 0x302, 0x67, 0x306, 0x67, 0x307, 0x67, 0x327, 0x68, 0x302,
+  0x69, 0x303, 0x69, 0x304, 0x69, 0x306, 0x69, 0x328, 0x6A, 0x302, 0x6B, 0x327, 0x6C, 0x301, 0x6C,
+  0x327, 0x6C, 0x30C, 0x6E, 0x301, 0x6E, 0x327, 0x6E, 0x30C, 0x6F, 0x304, 0x6F, 0x306, 0x6F, 0x30B,
+  0x72, 0x301, 0x72, 0x327, 0x72, 0x30C, 0x73, 0x301, 0x73, 0x302, 0x73, 0x327, 0x73, 0x30C, 0x74,
+  0x327, 0x74, 0x30C, 0x75, 0x303, 0x75, 0x304, 0x75, 0x306, 0x75, 0x30A, 0x75, 0x30B, 0x75, 0x328,
+  0x77, 0x302, 0x79, 0x302, 0x7A, 0x301, 0x7A, 0x307, 0x7A, 0x30C, 0x6F, 0x31B, 0x75, 0x31B, 0x61,
+  0x30C, 0x69, 0x30C, 0x6F, 0x30C, 0x75, 0x30C, 0x75, 0x308, 0x304, 0x75, 0x308, 0x301, 0x75, 0x308,
+  0x30C, 0x75, 0x308, 0x300, 0x61, 0x308, 0x304, 0x61, 0x307, 0x304, 0xE6, 0x304, 0x67, 0x30C, 0x6B,
+  0x30C, 0x6F, 0x328, 0x6F, 0x328, 0x304, 0x292, 0x30C, 0x6A, 0x30C, 0x67, 0x301, 0x6E, 0x300, 0x61,
+  0x30A, 0x301, 0xE6, 0x301, 0xF8, 0x301, 0x61, 0x30F, 0x61, 0x311, 0x65, 0x30F, 0x65, 0x311, 0x69,
+  0x30F, 0x69, 0x311, 0x6F, 0x30F, 0x6F, 0x311, 0x72, 0x30F, 0x72, 0x311, 0x75, 0x30F, 0x75, 0x311,
+  0x73, 0x326, 0x74, 0x326, 0x68, 0x30C, 0x61, 0x307, 0x65, 0x327, 0x6F, 0x308, 0x304, 0x6F, 0x303,
+  0x304, 0x6F, 0x307, 0x6F, 0x307, 0x304, 0x79, 0x304, 0x3B9, 0x308, 0x301, 0x3B1, 0x301, 0x3B5,
+  0x301, 0x3B7, 0x301, 0x3B9, 0x301, 0x3C5, 0x308, 0x301, 0x3B9, 0x308, 0x3C5, 0x308, 0x3BF, 0x301,
+  0x3C5, 0x301, 0x3C9, 0x301, 0x438, 0x306, 0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308,
+  0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x475, 0x30F, 0x436, 0x306, 0x430, 0x306, 0x430, 0x308,
+  0x435, 0x306, 0x4D9, 0x308, 0x436, 0x308, 0x437, 0x308, 0x438, 0x304, 0x438, 0x308, 0x43E, 0x308,
+  0x4E9, 0x308, 0x44D, 0x308, 0x443, 0x304, 0x443, 0x308, 0x443, 0x30B, 0x447, 0x308, 0x44B, 0x308,
+  0x627, 0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64A, 0x654, 0x6D5, 0x654, 0x6C1, 0x654,
+  0x6D2, 0x654, 0x928, 0x93C, 0x930, 0x93C, 0x933, 0x93C, 0x9C7, 0x9BE, 0x9C7, 0x9D7, 0xB47, 0xB56,
+  0xB47, 0xB3E, 0xB47, 0xB57, 0xB92, 0xBD7, 0xBC6, 0xBBE, 0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56,
+  0xCBF, 0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6, 0xCC2, 0xCD5, 0xD46, 0xD3E, 0xD47,
+  0xD3E, 0xD46, 0xD57, 0xDD9, 0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA, 0xDD9, 0xDDF, 0x1025,
+  0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11,
+  0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x61,
+  0x325, 0x62, 0x307, 0x62, 0x323, 0x62, 0x331, 0x63, 0x327, 0x301, 0x64, 0x307, 0x64, 0x323, 0x64,
+  0x331, 0x64, 0x327, 0x64, 0x32D, 0x65, 0x304, 0x300, 0x65, 0x304, 0x301, 0x65, 0x32D, 0x65, 0x330,
+  0x65, 0x327, 0x306, 0x66, 0x307, 0x67, 0x304, 0x68, 0x307, 0x68, 0x323, 0x68, 0x308, 0x68, 0x327,
+  0x68, 0x32E, 0x69, 0x330, 0x69, 0x308, 0x301, 0x6B, 0x301, 0x6B, 0x323, 0x6B, 0x331, 0x6C, 0x323,
+  0x6C, 0x323, 0x304, 0x6C, 0x331, 0x6C, 0x32D, 0x6D, 0x301, 0x6D, 0x307, 0x6D, 0x323, 0x6E, 0x307,
+  0x6E, 0x323, 0x6E, 0x331, 0x6E, 0x32D, 0x6F, 0x303, 0x301, 0x6F, 0x303, 0x308, 0x6F, 0x304, 0x300,
+  0x6F, 0x304, 0x301, 0x70, 0x301, 0x70, 0x307, 0x72, 0x307, 0x72, 0x323, 0x72, 0x323, 0x304, 0x72,
+  0x331, 0x73, 0x307, 0x73, 0x323, 0x73, 0x301, 0x307, 0x73, 0x30C, 0x307, 0x73, 0x323, 0x307, 0x74,
+  0x307, 0x74, 0x323, 0x74, 0x331, 0x74, 0x32D, 0x75, 0x324, 0x75, 0x330, 0x75, 0x32D, 0x75, 0x303,
+  0x301, 0x75, 0x304, 0x308, 0x76, 0x303, 0x76, 0x323, 0x77, 0x300, 0x77, 0x301, 0x77, 0x308, 0x77,
+  0x307, 0x77, 0x323, 0x78, 0x307, 0x78, 0x308, 0x79, 0x307, 0x7A, 0x302, 0x7A, 0x323, 0x7A, 0x331,
+  0x68, 0x331, 0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A, 0x61, 0x323, 0x61, 0x309, 0x61, 0x302, 0x301,
+  0x61, 0x302, 0x300, 0x61, 0x302, 0x309, 0x61, 0x302, 0x303, 0x61, 0x323, 0x302, 0x61, 0x306,
+  0x301, 0x61, 0x306, 0x300, 0x61, 0x306, 0x309, 0x61, 0x306, 0x303, 0x61, 0x323, 0x306, 0x65,
+  0x323, 0x65, 0x309, 0x65, 0x303, 0x65, 0x302, 0x301, 0x65, 0x302, 0x300, 0x65, 0x302, 0x309, 0x65,
+  0x302, 0x303, 0x65, 0x323, 0x302, 0x69, 0x309, 0x69, 0x323, 0x6F, 0x323, 0x6F, 0x309, 0x6F, 0x302,
+  0x301, 0x6F, 0x302, 0x300, 0x6F, 0x302, 0x309, 0x6F, 0x302, 0x303, 0x6F, 0x323, 0x302, 0x6F,
+  0x31B, 0x301, 0x6F, 0x31B, 0x300, 0x6F, 0x31B, 0x309, 0x6F, 0x31B, 0x303, 0x6F, 0x31B, 0x323,
+  0x75, 0x323, 0x75, 0x309, 0x75, 0x31B, 0x301, 0x75, 0x31B, 0x300, 0x75, 0x31B, 0x309, 0x75, 0x31B,
+  0x303, 0x75, 0x31B, 0x323, 0x79, 0x300, 0x79, 0x323, 0x79, 0x309, 0x79, 0x303, 0x3B1, 0x313,
+  0x3B1, 0x314, 0x3B1, 0x313, 0x300, 0x3B1, 0x314, 0x300, 0x3B1, 0x313, 0x301, 0x3B1, 0x314, 0x301,
+  0x3B1, 0x313, 0x342, 0x3B1, 0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314, 0x3B5, 0x313, 0x300, 0x3B5,
+  0x314, 0x300, 0x3B5, 0x313, 0x301, 0x3B5, 0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313,
+  0x300, 0x3B7, 0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7, 0x314, 0x301, 0x3B7, 0x313, 0x342, 0x3B7,
+  0x314, 0x342, 0x3B9, 0x313, 0x3B9, 0x314, 0x3B9, 0x313, 0x300, 0x3B9, 0x314, 0x300, 0x3B9, 0x313,
+  0x301, 0x3B9, 0x314, 0x301, 0x3B9, 0x313, 0x342, 0x3B9, 0x314, 0x342, 0x3BF, 0x313, 0x3BF, 0x314,
+  0x3BF, 0x313, 0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF, 0x314, 0x301, 0x3C5, 0x313,
+  0x3C5, 0x314, 0x3C5, 0x313, 0x300, 0x3C5, 0x314, 0x300, 0x3C5, 0x313, 0x301, 0x3C5, 0x314, 0x301,
+  0x3C5, 0x313, 0x342, 0x3C5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9, 0x313, 0x300, 0x3C9,
+  0x314, 0x300, 0x3C9, 0x313, 0x301, 0x3C9, 0x314, 0x301, 0x3C9, 0x313, 0x342, 0x3C9, 0x314, 0x342,
+  0x3B1, 0x300, 0x3B5, 0x300, 0x3B7, 0x300, 0x3B9, 0x300, 0x3BF, 0x300, 0x3C5, 0x300, 0x3C9, 0x300,
+  0x3B1, 0x306, 0x3B1, 0x304, 0x3B1, 0x342, 0x3B7, 0x342, 0x3B9, 0x306, 0x3B9, 0x304, 0x3B9, 0x308,
+  0x300, 0x3B9, 0x342, 0x3B9, 0x308, 0x342, 0x3C5, 0x306, 0x3C5, 0x304, 0x3C5, 0x308, 0x300, 0x3C1,
+  0x313, 0x3C1, 0x314, 0x3C5, 0x342, 0x3C5, 0x308, 0x342, 0x3C9, 0x342, 0x2190, 0x338, 0x2192,
+  0x338, 0x2194, 0x338, 0x21D0, 0x338, 0x21D4, 0x338, 0x21D2, 0x338, 0x2203, 0x338, 0x2208, 0x338,
+  0x220B, 0x338, 0x2223, 0x338, 0x2225, 0x338, 0x223C, 0x338, 0x2243, 0x338, 0x2245, 0x338, 0x2248,
+  0x338, 0x3D, 0x338, 0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338, 0x3E, 0x338, 0x2264, 0x338, 0x2265,
+  0x338, 0x2272, 0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277, 0x338, 0x227A, 0x338, 0x227B, 0x338,
+  0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338, 0x22A2, 0x338, 0x22A8, 0x338, 0x22A9,
+  0x338, 0x22AB, 0x338, 0x227C, 0x338, 0x227D, 0x338, 0x2291, 0x338, 0x2292, 0x338, 0x22B2, 0x338,
+  0x22B3, 0x338, 0x22B4, 0x338, 0x22B5, 0x338, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099,
+  0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099,
+  0x305D, 0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099,
+  0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A,
+  0x3078, 0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x309D, 0x3099,
+  0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099,
+  0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099,
+  0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099,
+  0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099,
+  0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099,
+  0x30FD, 0x3099, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132,
+  0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD,
+  0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930,
+};
+
+/** These are the primary composites of code points valid once mapped */
+inline constexpr Composition COMPOSITIONS[] = {
+  { 0x3C, 0x338, 0x226E }, { 0x3D, 0x338, 0x2260 }, { 0x3E, 0x338, 0x226F }, { 0x61, 0x300, 0xE0 },
+  { 0x61, 0x301, 0xE1 }, { 0x61, 0x302, 0xE2 }, { 0x61, 0x303, 0xE3 }, { 0x61, 0x304, 0x101 },
+  { 0x61, 0x306, 0x103 }, { 0x61, 0x307, 0x227 }, { 0x61, 0x308, 0xE4 }, { 0x61, 0x309, 0x1EA3 },
+  { 0x61, 0x30A, 0xE5 }, { 0x61, 0x30C, 0x1CE }, { 0x61, 0x30F, 0x201 }, { 0x61, 0x311, 0x203 },
+  { 0x61, 0x323, 0x1EA1 }, { 0x61, 0x325, 0x1E01 }, { 0x61, 0x328, 0x105 }, { 0x62, 0x307, 0x1E03 },
+  { 0x62, 0x323, 0x1E05 }, { 0x62, 0x331, 0x1E07 }, { 0x63, 0x301, 0x107 }, { 0x63, 0x302, 0x109 },
+  { 0x63, 0x307, 0x10B }, { 0x63, 0x30C, 0x10D }, { 0x63, 0x327, 0xE7 }, { 0x64, 0x307, 0x1E0B },
+  { 0x64, 0x30C, 0x10F }, { 0x64, 0x323, 0x1E0D }, { 0x64, 0x327, 0x1E11 }, { 0x64, 0x32D, 0x1E13 },
+  { 0x64, 0x331, 0x1E0F }, { 0x65, 0x300, 0xE8 }, { 0x65, 0x301, 0xE9 }, { 0x65, 0x302, 0xEA },
+  { 0x65, 0x303, 0x1EBD }, { 0x65, 0x304, 0x113 }, { 0x65, 0x306, 0x115 }, { 0x65, 0x307, 0x117 },
+  { 0x65, 0x308, 0xEB }, { 0x65, 0x309, 0x1EBB }, { 0x65, 0x30C, 0x11B }, { 0x65, 0x30F, 0x205 },
+  { 0x65, 0x311, 0x207 }, { 0x65, 0x323, 0x1EB9 }, { 0x65, 0x327, 0x229 }, { 0x65, 0x328, 0x119 },
+  { 0x65, 0x32D, 0x1E19 }, { 0x65, 0x330, 0x1E1B }, { 0x66, 0x307, 0x1E1F }, { 0x67, 0x301, 0x1F5 },
+  { 0x67, 0x302, 0x11D }, { 0x67, 0x304, 0x1E21 }, { 0x67, 0x306, 0x11F }, { 0x67, 0x307, 0x121 },
+  { 0x67, 0x30C, 0x1E7 }, { 0x67, 0x327, 0x123 }, { 0x68, 0x302, 0x125 }, { 0x68, 0x307, 0x1E23 },
+  { 0x68, 0x308, 0x1E27 }, { 0x68, 0x30C, 0x21F }, { 0x68, 0x323, 0x1E25 }, { 0x68, 0x327, 0x1E29 },
+  { 0x68, 0x32E, 0x1E2B }, { 0x68, 0x331, 0x1E96 }, { 0x69, 0x300, 0xEC }, { 0x69, 0x301, 0xED },
+  { 0x69, 0x302, 0xEE }, { 0x69, 0x303, 0x129 }, { 0x69, 0x304, 0x12B }, { 0x69, 0x306, 0x12D },
+  { 0x69, 0x308, 0xEF }, { 0x69, 0x309, 0x1EC9 }, { 0x69, 0x30C, 0x1D0 }, { 0x69, 0x30F, 0x209 },
+  { 0x69, 0x311, 0x20B }, { 0x69, 0x323, 0x1ECB }, { 0x69, 0x328, 0x12F }, { 0x69, 0x330, 0x1E2D },
+  { 0x6A, 0x302, 0x135 }, { 0x6A, 0x30C, 0x1F0 }, { 0x6B, 0x301, 0x1E31 }, { 0x6B, 0x30C, 0x1E9 },
+  { 0x6B, 0x323, 0x1E33 }, { 0x6B, 0x327, 0x137 }, { 0x6B, 0x331, 0x1E35 }, { 0x6C, 0x301, 0x13A },
+  { 0x6C, 0x30C, 0x13E }, { 0x6C, 0x323, 0x1E37 }, { 0x6C, 0x327, 0x13C }, { 0x6C, 0x32D, 0x1E3D },
+  { 0x6C, 0x331, 0x1E3B }, { 0x6D, 0x301, 0x1E3F }, { 0x6D, 0x307, 0x1E41 },
+  { 0x6D, 0x323, 0x1E43 }, { 0x6E, 0x300, 0x1F9 }, { 0x6E, 0x301, 0x144 }, { 0x6E, 0x303, 0xF1 },
+  { 0x6E, 0x307, 0x1E45 }, { 0x6E, 0x30C, 0x148 }, { 0x6E, 0x323, 0x1E47 }, { 0x6E, 0x327, 0x146 },
+  { 0x6E, 0x32D, 0x1E4B }, { 0x6E, 0x331, 0x1E49 }, { 0x6F, 0x300, 0xF2 }, { 0x6F, 0x301, 0xF3 },
+  { 0x6F, 0x302, 0xF4 }, { 0x6F, 0x303, 0xF5 }, { 0x6F, 0x304, 0x14D }, { 0x6F, 0x306, 0x14F },
+  { 0x6F, 0x307, 0x22F }, { 0x6F, 0x308, 0xF6 }, { 0x6F, 0x309, 0x1ECF }, { 0x6F, 0x30B, 0x151 },
+  { 0x6F, 0x30C, 0x1D2 }, { 0x6F, 0x30F, 0x20D }, { 0x6F, 0x311, 0x20F }, { 0x6F, 0x31B, 0x1A1 },
+  { 0x6F, 0x323, 0x1ECD }, { 0x6F, 0x328, 0x1EB }, { 0x70, 0x301, 0x1E55 }, { 0x70, 0x307, 0x1E57 },
+  { 0x72, 0x301, 0x155 }, { 0x72, 0x307, 0x1E59 }, { 0x72, 0x30C, 0x159 }, { 0x72, 0x30F, 0x211 },
+  { 0x72, 0x311, 0x213 }, { 0x72, 0x323, 0x1E5B }, { 0x72, 0x327, 0x157 }, { 0x72, 0x331, 0x1E5F },
+  { 0x73, 0x301, 0x15B }, { 0x73, 0x302, 0x15D }, { 0x73, 0x307, 0x1E61 }, { 0x73, 0x30C, 0x161 },
+  { 0x73, 0x323, 0x1E63 }, { 0x73, 0x326, 0x219 }, { 0x73, 0x327, 0x15F }, { 0x74, 0x307, 0x1E6B },
+  { 0x74, 0x308, 0x1E97 }, { 0x74, 0x30C, 0x165 }, { 0x74, 0x323, 0x1E6D }, { 0x74, 0x326, 0x21B },
+  { 0x74, 0x327, 0x163 }, { 0x74, 0x32D, 0x1E71 }, { 0x74, 0x331, 0x1E6F }, { 0x75, 0x300, 0xF9 },
+  { 0x75, 0x301, 0xFA }, { 0x75, 0x302, 0xFB }, { 0x75, 0x303, 0x169 }, { 0x75, 0x304, 0x16B },
+  { 0x75, 0x306, 0x16D }, { 0x75, 0x308, 0xFC }, { 0x75, 0x309, 0x1EE7 }, { 0x75, 0x30A, 0x16F },
+  { 0x75, 0x30B, 0x171 }, { 0x75, 0x30C, 0x1D4 }, { 0x75, 0x30F, 0x215 }, { 0x75, 0x311, 0x217 },
+  { 0x75, 0x31B, 0x1B0 }, { 0x75, 0x323, 0x1EE5 }, { 0x75, 0x324, 0x1E73 }, { 0x75, 0x328, 0x173 },
+  { 0x75, 0x32D, 0x1E77 }, { 0x75, 0x330, 0x1E75 }, { 0x76, 0x303, 0x1E7D },
+  { 0x76, 0x323, 0x1E7F }, { 0x77, 0x300, 0x1E81 }, { 0x77, 0x301, 0x1E83 }, { 0x77, 0x302, 0x175 },
+  { 0x77, 0x307, 0x1E87 }, { 0x77, 0x308, 0x1E85 }, { 0x77, 0x30A, 0x1E98 },
+  { 0x77, 0x323, 0x1E89 }, { 0x78, 0x307, 0x1E8B }, { 0x78, 0x308, 0x1E8D },
+  { 0x79, 0x300, 0x1EF3 }, { 0x79, 0x301, 0xFD }, { 0x79, 0x302, 0x177 }, { 0x79, 0x303, 0x1EF9 },
+  { 0x79, 0x304, 0x233 }, { 0x79, 0x307, 0x1E8F }, { 0x79, 0x308, 0xFF }, { 0x79, 0x309, 0x1EF7 },
+  { 0x79, 0x30A, 0x1E99 }, { 0x79, 0x323, 0x1EF5 }, { 0x7A, 0x301, 0x17A }, { 0x7A, 0x302, 0x1E91 },
+  { 0x7A, 0x307, 0x17C }, { 0x7A, 0x30C, 0x17E }, { 0x7A, 0x323, 0x1E93 }, { 0x7A, 0x331, 0x1E95 },
+  { 0xE2, 0x300, 0x1EA7 }, { 0xE2, 0x301, 0x1EA5 }, { 0xE2, 0x303, 0x1EAB },
+  { 0xE2, 0x309, 0x1EA9 }, { 0xE4, 0x304, 0x1DF }, { 0xE5, 0x301, 0x1FB }, { 0xE6, 0x301, 0x1FD },
+  { 0xE6, 0x304, 0x1E3 }, { 0xE7, 0x301, 0x1E09 }, { 0xEA, 0x300, 0x1EC1 }, { 0xEA, 0x301, 0x1EBF },
+  { 0xEA, 0x303, 0x1EC5 }, { 0xEA, 0x309, 0x1EC3 }, { 0xEF, 0x301, 0x1E2F },
+  { 0xF4, 0x300, 0x1ED3 }, { 0xF4, 0x301, 0x1ED1 }, { 0xF4, 0x303, 0x1ED7 },
+  { 0xF4, 0x309, 0x1ED5 }, { 0xF5, 0x301, 0x1E4D }, { 0xF5, 0x304, 0x22D }, { 0xF5, 0x308, 0x1E4F },
+  { 0xF6, 0x304, 0x22B }, { 0xF8, 0x301, 0x1FF }, { 0xFC, 0x300, 0x1DC }, { 0xFC, 0x301, 0x1D8 },
+  { 0xFC, 0x304, 0x1D6 }, { 0xFC, 0x30C, 0x1DA }, { 0x103, 0x300, 0x1EB1 },
+  { 0x103, 0x301, 0x1EAF }, { 0x103, 0x303, 0x1EB5 }, { 0x103, 0x309, 0x1EB3 },
+  { 0x113, 0x300, 0x1E15 }, { 0x113, 0x301, 0x1E17 }, { 0x14D, 0x300, 0x1E51 },
+  { 0x14D, 0x301, 0x1E53 }, { 0x15B, 0x307, 0x1E65 }, { 0x161, 0x307, 0x1E67 },
+  { 0x169, 0x301, 0x1E79 }, { 0x16B, 0x308, 0x1E7B }, { 0x1A1, 0x300, 0x1EDD },
+  { 0x1A1, 0x301, 0x1EDB }, { 0x1A1, 0x303, 0x1EE1 }, { 0x1A1, 0x309, 0x1EDF },
+  { 0x1A1, 0x323, 0x1EE3 }, { 0x1B0, 0x300, 0x1EEB }, { 0x1B0, 0x301, 0x1EE9 },
+  { 0x1B0, 0x303, 0x1EEF }, { 0x1B0, 0x309, 0x1EED }, { 0x1B0, 0x323, 0x1EF1 },
+  { 0x1EB, 0x304, 0x1ED }, { 0x227, 0x304, 0x1E1 }, { 0x229, 0x306, 0x1E1D },
+  { 0x22F, 0x304, 0x231 }, { 0x292, 0x30C, 0x1EF }, { 0x3B1, 0x300, 0x1F70 },
+  { 0x3B1, 0x301, 0x3AC }, { 0x3B1, 0x304, 0x1FB1 }, { 0x3B1, 0x306, 0x1FB0 },
+  { 0x3B1, 0x313, 0x1F00 }, { 0x3B1, 0x314, 0x1F01 }, { 0x3B1, 0x342, 0x1FB6 },
+  { 0x3B5, 0x300, 0x1F72 }, { 0x3B5, 0x301, 0x3AD }, { 0x3B5, 0x313, 0x1F10 },
+  { 0x3B5, 0x314, 0x1F11 }, { 0x3B7, 0x300, 0x1F74 }, { 0x3B7, 0x301, 0x3AE },
+  { 0x3B7, 0x313, 0x1F20 }, { 0x3B7, 0x314, 0x1F21 }, { 0x3B7, 0x342, 0x1FC6 },
+  { 0x3B9, 0x300, 0x1F76 }, { 0x3B9, 0x301, 0x3AF }, { 0x3B9, 0x304, 0x1FD1 },
+  { 0x3B9, 0x306, 0x1FD0 }, { 0x3B9, 0x308, 0x3CA }, { 0x3B9, 0x313, 0x1F30 },
+  { 0x3B9, 0x314, 0x1F31 }, { 0x3B9, 0x342, 0x1FD6 }, { 0x3BF, 0x300, 0x1F78 },
+  { 0x3BF, 0x301, 0x3CC }, { 0x3BF, 0x313, 0x1F40 }, { 0x3BF, 0x314, 0x1F41 },
+  { 0x3C1, 0x313, 0x1FE4 }, { 0x3C1, 0x314, 0x1FE5 }, { 0x3C5, 0x300, 0x1F7A },
+  { 0x3C5, 0x301, 0x3CD }, { 0x3C5, 0x304, 0x1FE1 }, { 0x3C5, 0x306, 0x1FE0 },
+  { 0x3C5, 0x308, 0x3CB }, { 0x3C5, 0x313, 0x1F50 }, { 0x3C5, 0x314, 0x1F51 },
+  { 0x3C5, 0x342, 0x1FE6 }, { 0x3C9, 0x300, 0x1F7C }, { 0x3C9, 0x301, 0x3CE },
+  { 0x3C9, 0x313, 0x1F60 }, { 0x3C9, 0x314, 0x1F61 }, { 0x3C9, 0x342, 0x1FF6 },
+  { 0x3CA, 0x300, 0x1FD2 }, { 0x3CA, 0x301, 0x390 }, { 0x3CA, 0x342, 0x1FD7 },
+  { 0x3CB, 0x300, 0x1FE2 }, { 0x3CB, 0x301, 0x3B0 }, { 0x3CB, 0x342, 0x1FE7 },
+  { 0x430, 0x306, 0x4D1 }, { 0x430, 0x308, 0x4D3 }, { 0x433, 0x301, 0x453 },
+  { 0x435, 0x300, 0x450 }, { 0x435, 0x306, 0x4D7 }, { 0x435, 0x308, 0x451 },
+  { 0x436, 0x306, 0x4C2 }, { 0x436, 0x308, 0x4DD }, { 0x437, 0x308, 0x4DF },
+  { 0x438, 0x300, 0x45D }, { 0x438, 0x304, 0x4E3 }, { 0x438, 0x306, 0x439 },
+  { 0x438, 0x308, 0x4E5 }, { 0x43A, 0x301, 0x45C }, { 0x43E, 0x308, 0x4E7 },
+  { 0x443, 0x304, 0x4EF }, { 0x443, 0x306, 0x45E }, { 0x443, 0x308, 0x4F1 },
+  { 0x443, 0x30B, 0x4F3 }, { 0x447, 0x308, 0x4F5 }, { 0x44B, 0x308, 0x4F9 },
+  { 0x44D, 0x308, 0x4ED }, { 0x456, 0x308, 0x457 }, { 0x475, 0x30F, 0x477 },
+  { 0x4D9, 0x308, 0x4DB }, { 0x4E9, 0x308, 0x4EB }, { 0x627, 0x653, 0x622 },
+  { 0x627, 0x654, 0x623 }, { 0x627, 0x655, 0x625 }, { 0x648, 0x654, 0x624 },
+  { 0x64A, 0x654, 0x626 }, { 0x6C1, 0x654, 0x6C2 }, { 0x6D2, 0x654, 0x6D3 },
+  { 0x6D5, 0x654, 0x6C0 }, { 0x928, 0x93C, 0x929 }, { 0x930, 0x93C, 0x931 },
+  { 0x933, 0x93C, 0x934 }, { 0x9C7, 0x9BE, 0x9CB }, { 0x9C7, 0x9D7, 0x9CC },
+  { 0xB47, 0xB3E, 0xB4B }, { 0xB47, 0xB56, 0xB48 }, { 0xB47, 0xB57, 0xB4C },
+  { 0xB92, 0xBD7, 0xB94 }, { 0xBC6, 0xBBE, 0xBCA }, { 0xBC6, 0xBD7, 0xBCC },
+  { 0xBC7, 0xBBE, 0xBCB }, { 0xC46, 0xC56, 0xC48 }, { 0xCBF, 0xCD5, 0xCC0 },
+  { 0xCC6, 0xCC2, 0xCCA }, { 0xCC6, 0xCD5, 0xCC7 }, { 0xCC6, 0xCD6, 0xCC8 },
+  { 0xCCA, 0xCD5, 0xCCB }, { 0xD46, 0xD3E, 0xD4A }, { 0xD46, 0xD57, 0xD4C },
+  { 0xD47, 0xD3E, 0xD4B }, { 0xDD9, 0xDCA, 0xDDA }, { 0xDD9, 0xDCF, 0xDDC },
+  { 0xDD9, 0xDDF, 0xDDE }, { 0xDDC, 0xDCA, 0xDDD }, { 0x1025, 0x102E, 0x1026 },
+  { 0x1B05, 0x1B35, 0x1B06 }, { 0x1B07, 0x1B35, 0x1B08 }, { 0x1B09, 0x1B35, 0x1B0A },
+  { 0x1B0B, 0x1B35, 0x1B0C }, { 0x1B0D, 0x1B35, 0x1B0E }, { 0x1B11, 0x1B35, 0x1B12 },
+  { 0x1B3A, 0x1B35, 0x1B3B }, { 0x1B3C, 0x1B35, 0x1B3D }, { 0x1B3E, 0x1B35, 0x1B40 },
+  { 0x1B3F, 0x1B35, 0x1B41 }, { 0x1B42, 0x1B35, 0x1B43 }, { 0x1E37, 0x304, 0x1E39 },
+  { 0x1E5B, 0x304, 0x1E5D }, { 0x1E63, 0x307, 0x1E69 }, { 0x1EA1, 0x302, 0x1EAD },
+  { 0x1EA1, 0x306, 0x1EB7 }, { 0x1EB9, 0x302, 0x1EC7 }, { 0x1ECD, 0x302, 0x1ED9 },
+  { 0x1F00, 0x300, 0x1F02 }, { 0x1F00, 0x301, 0x1F04 }, { 0x1F00, 0x342, 0x1F06 },
+  { 0x1F01, 0x300, 0x1F03 }, { 0x1F01, 0x301, 0x1F05 }, { 0x1F01, 0x342, 0x1F07 },
+  { 0x1F10, 0x300, 0x1F12 }, { 0x1F10, 0x301, 0x1F14 }, { 0x1F11, 0x300, 0x1F13 },
+  { 0x1F11, 0x301, 0x1F15 }, { 0x1F20, 0x300, 0x1F22 }, { 0x1F20, 0x301, 0x1F24 },
+  { 0x1F20, 0x342, 0x1F26 }, { 0x1F21, 0x300, 0x1F23 }, { 0x1F21, 0x301, 0x1F25 },
+  { 0x1F21, 0x342, 0x1F27 }, { 0x1F30, 0x300, 0x1F32 }, { 0x1F30, 0x301, 0x1F34 },
+  { 0x1F30, 0x342, 0x1F36 }, { 0x1F31, 0x300, 0x1F33 }, { 0x1F31, 0x301, 0x1F35 },
+  { 0x1F31, 0x342, 0x1F37 }, { 0x1F40, 0x300, 0x1F42 }, { 0x1F40, 0x301, 0x1F44 },
+  { 0x1F41, 0x300, 0x1F43 }, { 0x1F41, 0x301, 0x1F45 }, { 0x1F50, 0x300, 0x1F52 },
+  { 0x1F50, 0x301, 0x1F54 }, { 0x1F50, 0x342, 0x1F56 }, { 0x1F51, 0x300, 0x1F53 },
+  { 0x1F51, 0x301, 0x1F55 }, { 0x1F51, 0x342, 0x1F57 }, { 0x1F60, 0x300, 0x1F62 },
+  { 0x1F60, 0x301, 0x1F64 }, { 0x1F60, 0x342, 0x1F66 }, { 0x1F61, 0x300, 0x1F63 },
+  { 0x1F61, 0x301, 0x1F65 }, { 0x1F61, 0x342, 0x1F67 }, { 0x2190, 0x338, 0x219A },
+  { 0x2192, 0x338, 0x219B }, { 0x2194, 0x338, 0x21AE }, { 0x21D0, 0x338, 0x21CD },
+  { 0x21D2, 0x338, 0x21CF }, { 0x21D4, 0x338, 0x21CE }, { 0x2203, 0x338, 0x2204 },
+  { 0x2208, 0x338, 0x2209 }, { 0x220B, 0x338, 0x220C }, { 0x2223, 0x338, 0x2224 },
+  { 0x2225, 0x338, 0x2226 }, { 0x223C, 0x338, 0x2241 }, { 0x2243, 0x338, 0x2244 },
+  { 0x2245, 0x338, 0x2247 }, { 0x2248, 0x338, 0x2249 }, { 0x224D, 0x338, 0x226D },
+  { 0x2261, 0x338, 0x2262 }, { 0x2264, 0x338, 0x2270 }, { 0x2265, 0x338, 0x2271 },
+  { 0x2272, 0x338, 0x2274 }, { 0x2273, 0x338, 0x2275 }, { 0x2276, 0x338, 0x2278 },
+  { 0x2277, 0x338, 0x2279 }, { 0x227A, 0x338, 0x2280 }, { 0x227B, 0x338, 0x2281 },
+  { 0x227C, 0x338, 0x22E0 }, { 0x227D, 0x338, 0x22E1 }, { 0x2282, 0x338, 0x2284 },
+  { 0x2283, 0x338, 0x2285 }, { 0x2286, 0x338, 0x2288 }, { 0x2287, 0x338, 0x2289 },
+  { 0x2291, 0x338, 0x22E2 }, { 0x2292, 0x338, 0x22E3 }, { 0x22A2, 0x338, 0x22AC },
+  { 0x22A8, 0x338, 0x22AD }, { 0x22A9, 0x338, 0x22AE }, { 0x22AB, 0x338, 0x22AF },
+  { 0x22B2, 0x338, 0x22EA }, { 0x22B3, 0x338, 0x22EB }, { 0x22B4, 0x338, 0x22EC },
+  { 0x22B5, 0x338, 0x22ED }, { 0x3046, 0x3099, 0x3094 }, { 0x304B, 0x3099, 0x304C },
+  { 0x304D, 0x3099, 0x304E }, { 0x304F, 0x3099, 0x3050 }, { 0x3051, 0x3099, 0x3052 },
+  { 0x3053, 0x3099, 0x3054 }, { 0x3055, 0x3099, 0x3056 }, { 0x3057, 0x3099, 0x3058 },
+  { 0x3059, 0x3099, 0x305A }, { 0x305B, 0x3099, 0x305C }, { 0x305D, 0x3099, 0x305E },
+  { 0x305F, 0x3099, 0x3060 }, { 0x3061, 0x3099, 0x3062 }, { 0x3064, 0x3099, 0x3065 },
+  { 0x3066, 0x3099, 0x3067 }, { 0x3068, 0x3099, 0x3069 }, { 0x306F, 0x3099, 0x3070 },
+  { 0x306F, 0x309A, 0x3071 }, { 0x3072, 0x3099, 0x3073 }, { 0x3072, 0x309A, 0x3074 },
+  { 0x3075, 0x3099, 0x3076 }, { 0x3075, 0x309A, 0x3077 }, { 0x3078, 0x3099, 0x3079 },
+  { 0x3078, 0x309A, 0x307A }, { 0x307B, 0x3099, 0x307C }, { 0x307B, 0x309A, 0x307D },
+  { 0x309D, 0x3099, 0x309E }, { 0x30A6, 0x3099, 0x30F4 }, { 0x30AB, 0x3099, 0x30AC },
+  { 0x30AD, 0x3099, 0x30AE }, { 0x30AF, 0x3099, 0x30B0 }, { 0x30B1, 0x3099, 0x30B2 },
+  { 0x30B3, 0x3099, 0x30B4 }, { 0x30B5, 0x3099, 0x30B6 }, { 0x30B7, 0x3099, 0x30B8 },
+  { 0x30B9, 0x3099, 0x30BA }, { 0x30BB, 0x3099, 0x30BC }, { 0x30BD, 0x3099, 0x30BE },
+  { 0x30BF, 0x3099, 0x30C0 }, { 0x30C1, 0x3099, 0x30C2 }, { 0x30C4, 0x3099, 0x30C5 },
+  { 0x30C6, 0x3099, 0x30C7 }, { 0x30C8, 0x3099, 0x30C9 }, { 0x30CF, 0x3099, 0x30D0 },
+  { 0x30CF, 0x309A, 0x30D1 }, { 0x30D2, 0x3099, 0x30D3 }, { 0x30D2, 0x309A, 0x30D4 },
+  { 0x30D5, 0x3099, 0x30D6 }, { 0x30D5, 0x309A, 0x30D7 }, { 0x30D8, 0x3099, 0x30D9 },
+  { 0x30D8, 0x309A, 0x30DA }, { 0x30DB, 0x3099, 0x30DC }, { 0x30DB, 0x309A, 0x30DD },
+  { 0x30EF, 0x3099, 0x30F7 }, { 0x30F0, 0x3099, 0x30F8 }, { 0x30F1, 0x3099, 0x30F9 },
+  { 0x30F2, 0x3099, 0x30FA }, { 0x30FD, 0x3099, 0x30FE }, { 0x11099, 0x110BA, 0x1109A },
+  { 0x1109B, 0x110BA, 0x1109C }, { 0x110A5, 0x110BA, 0x110AB }, { 0x11131, 0x11127, 0x1112E },
+  { 0x11132, 0x11127, 0x1112F }, { 0x11347, 0x1133E, 0x1134B }, { 0x11347, 0x11357, 0x1134C },
+  { 0x114B9, 0x114B0, 0x114BC }, { 0x114B9, 0x114BA, 0x114BB }, { 0x114B9, 0x114BD, 0x114BE },
+  { 0x115B8, 0x115AF, 0x115BA }, { 0x115B9, 0x115AF, 0x115BB }, { 0x11935, 0x11930, 0x11938 },
+};
+
+/**
+ * These are the joining types of the code points that are valid once mapped,
+ * but for those that do not join (U) or cause joining (C)
+ */
+inline constexpr JoiningType JOINING_TYPES[] = {
+  { 0x300, 0x33F, 'T' }, { 0x342, 0x342, 'T' }, { 0x346, 0x34E, 'T' }, { 0x350, 0x36F, 'T' },
+  { 0x483, 0x489, 'T' }, { 0x591, 0x5BD, 'T' }, { 0x5BF, 0x5BF, 'T' }, { 0x5C1, 0x5C2, 'T' },
+  { 0x5C4, 0x5C5, 'T' }, { 0x5C7, 0x5C7, 'T' }, { 0x610, 0x61A, 'T' }, { 0x620, 0x620, 'D' },
+  { 0x622, 0x625, 'R' }, { 0x626, 0x626, 'D' }, { 0x627, 0x627, 'R' }, { 0x628, 0x628, 'D' },
+  { 0x629, 0x629, 'R' }, { 0x62A, 0x62E, 'D' }, { 0x62F, 0x632, 'R' }, { 0x633, 0x63F, 'D' },
+  { 0x641, 0x647, 'D' }, { 0x648, 0x648, 'R' }, { 0x649, 0x64A, 'D' }, { 0x64B, 0x65F, 'T' },
+  { 0x66E, 0x66F, 'D' }, { 0x670, 0x670, 'T' }, { 0x671, 0x673, 'R' }, { 0x679, 0x687, 'D' },
+  { 0x688, 0x699, 'R' }, { 0x69A, 0x6BF, 'D' }, { 0x6C0, 0x6C0, 'R' }, { 0x6C1, 0x6C2, 'D' },
+  { 0x6C3, 0x6CB, 'R' }, { 0x6CC, 0x6CC, 'D' }, { 0x6CD, 0x6CD, 'R' }, { 0x6CE, 0x6CE, 'D' },
+  { 0x6CF, 0x6CF, 'R' }, { 0x6D0, 0x6D1, 'D' }, { 0x6D2, 0x6D3, 'R' }, { 0x6D5, 0x6D5, 'R' },
+  { 0x6D6, 0x6DC, 'T' }, { 0x6DF, 0x6E4, 'T' }, { 0x6E7, 0x6E8, 'T' }, { 0x6EA, 0x6ED, 'T' },
+  { 0x6EE, 0x6EF, 'R' }, { 0x6FA, 0x6FC, 'D' }, { 0x6FF, 0x6FF, 'D' }, { 0x710, 0x710, 'R' },
+  { 0x711, 0x711, 'T' }, { 0x712, 0x714, 'D' }, { 0x715, 0x719, 'R' }, { 0x71A, 0x71D, 'D' },
+  { 0x71E, 0x71E, 'R' }, { 0x71F, 0x727, 'D' }, { 0x728, 0x728, 'R' }, { 0x729, 0x729, 'D' },
+  { 0x72A, 0x72A, 'R' }, { 0x72B, 0x72B, 'D' }, { 0x72C, 0x72C, 'R' }, { 0x72D, 0x72E, 'D' },
+  { 0x72F, 0x72F, 'R' }, { 0x730, 0x74A, 'T' }, { 0x74D, 0x74D, 'R' }, { 0x74E, 0x758, 'D' },
+  { 0x759, 0x75B, 'R' }, { 0x75C, 0x76A, 'D' }, { 0x76B, 0x76C, 'R' }, { 0x76D, 0x770, 'D' },
+  { 0x771, 0x771, 'R' }, { 0x772, 0x772, 'D' }, { 0x773, 0x774, 'R' }, { 0x775, 0x777, 'D' },
+  { 0x778, 0x779, 'R' }, { 0x77A, 0x77F, 'D' }, { 0x7A6, 0x7B0, 'T' }, { 0x7CA, 0x7EA, 'D' },
+  { 0x7EB, 0x7F3, 'T' }, { 0x7FD, 0x7FD, 'T' }, { 0x816, 0x819, 'T' }, { 0x81B, 0x823, 'T' },
+  { 0x825, 0x827, 'T' }, { 0x829, 0x82D, 'T' }, { 0x840, 0x840, 'R' }, { 0x841, 0x845, 'D' },
+  { 0x846, 0x847, 'R' }, { 0x848, 0x848, 'D' }, { 0x849, 0x849, 'R' }, { 0x84A, 0x853, 'D' },
+  { 0x854, 0x854, 'R' }, { 0x855, 0x855, 'D' }, { 0x856, 0x858, 'R' }, { 0x859, 0x85B, 'T' },
+  { 0x860, 0x860, 'D' }, { 0x862, 0x865, 'D' }, { 0x867, 0x867, 'R' }, { 0x868, 0x868, 'D' },
+  { 0x869, 0x86A, 'R' }, { 0x870, 0x882, 'R' }, { 0x886, 0x886, 'D' }, { 0x889, 0x88D, 'D' },
+  { 0x88E, 0x88E, 'R' }, { 0x898, 0x89F, 'T' }, { 0x8A0, 0x8A9, 'D' }, { 0x8AA, 0x8AC, 'R' },
+  { 0x8AE, 0x8AE, 'R' }, { 0x8AF, 0x8B0, 'D' }, { 0x8B1, 0x8B2, 'R' }, { 0x8B3, 0x8B8, 'D' },
+  { 0x8B9, 0x8B9, 'R' }, { 0x8BA, 0x8C8, 'D' }, { 0x8CA, 0x8E1, 'T' }, { 0x8E3, 0x902, 'T' },
+  { 0x93A, 0x93A, 'T' }, { 0x93C, 0x93C, 'T' }, { 0x941, 0x948, 'T' }, { 0x94D, 0x94D, 'T' },
+  { 0x951, 0x957, 'T' }, { 0x962, 0x963, 'T' }, { 0x981, 0x981, 'T' }, { 0x9BC, 0x9BC, 'T' },
+  { 0x9C1, 0x9C4, 'T' }, { 0x9CD, 0x9CD, 'T' }, { 0x9E2, 0x9E3, 'T' }, { 0x9FE, 0x9FE, 'T' },
+  { 0xA01, 0xA02, 'T' }, { 0xA3C, 0xA3C, 'T' }, { 0xA41, 0xA42, 'T' }, { 0xA47, 0xA48, 'T' },
+  { 0xA4B, 0xA4D, 'T' }, { 0xA51, 0xA51, 'T' }, { 0xA70, 0xA71, 'T' }, { 0xA75, 0xA75, 'T' },
+  { 0xA81, 0xA82, 'T' }, { 0xABC, 0xABC, 'T' }, { 0xAC1, 0xAC5, 'T' }, { 0xAC7, 0xAC8, 'T' },
+  { 0xACD, 0xACD, 'T' }, { 0xAE2, 0xAE3, 'T' }, { 0xAFA, 0xAFF, 'T' }, { 0xB01, 0xB01, 'T' },
+  { 0xB3C, 0xB3C, 'T' }, { 0xB3F, 0xB3F, 'T' }, { 0xB41, 0xB44, 'T' }, { 0xB4D, 0xB4D, 'T' },
+  { 0xB55, 0xB56, 'T' }, { 0xB62, 0xB63, 'T' }, { 0xB82, 0xB82, 'T' }, { 0xBC0, 0xBC0, 'T' },
+  { 0xBCD, 0xBCD, 'T' }, { 0xC00, 0xC00, 'T' }, { 0xC04, 0xC04, 'T' }, { 0xC3C, 0xC3C, 'T' },
+  { 0xC3E, 0xC40, 'T' }, { 0xC46, 0xC48, 'T' }, { 0xC4A, 0xC4D, 'T' }, { 0xC55, 0xC56, 'T' },
+  { 0xC62, 0xC63, 'T' }, { 0xC81, 0xC81, 'T' }, { 0xCBC, 0xCBC, 'T' }, { 0xCBF, 0xCBF, 'T' },
+  { 0xCC6, 0xCC6, 'T' }, { 0xCCC, 0xCCD, 'T' }, { 0xCE2, 0xCE3, 'T' }, { 0xD00, 0xD01, 'T' },
+  { 0xD3B, 0xD3C, 'T' }, { 0xD41, 0xD44, 'T' }, { 0xD4D, 0xD4D, 'T' }, { 0xD62, 0xD63, 'T' },
+  { 0xD81, 0xD81, 'T' }, { 0xDCA, 0xDCA, 'T' }, { 0xDD2, 0xDD4, 'T' }, { 0xDD6, 0xDD6, 'T' },
+  { 0xE31, 0xE31, 'T' }, { 0xE34, 0xE3A, 'T' }, { 0xE47, 0xE4E, 'T' }, { 0xEB1, 0xEB1, 'T' },
+  { 0xEB4, 0xEBC, 'T' }, { 0xEC8, 0xECE, 'T' }, { 0xF18, 0xF19, 'T' }, { 0xF35, 0xF35, 'T' },
+  { 0xF37, 0xF37, 'T' }, { 0xF39, 0xF39, 'T' }, { 0xF71, 0xF72, 'T' }, { 0xF74, 0xF74, 'T' },
+  { 0xF7A, 0xF7E, 'T' }, { 0xF80, 0xF80, 'T' }, { 0xF82, 0xF84, 'T' }, { 0xF86, 0xF87, 'T' },
+  { 0xF8D, 0xF92, 'T' }, { 0xF94, 0xF97, 'T' }, { 0xF99, 0xF9C, 'T' }, { 0xF9E, 0xFA1, 'T' },
+  { 0xFA3, 0xFA6, 'T' }, { 0xFA8, 0xFAB, 'T' }, { 0xFAD, 0xFB8, 'T' }, { 0xFBA, 0xFBC, 'T' },
+  { 0xFC6, 0xFC6, 'T' }, { 0x102D, 0x1030, 'T' }, { 0x1032, 0x1037, 'T' }, { 0x1039, 0x103A, 'T' },
+  { 0x103D, 0x103E, 'T' }, { 0x1058, 0x1059, 'T' }, { 0x105E, 0x1060, 'T' },
+  { 0x1071, 0x1074, 'T' }, { 0x1082, 0x1082, 'T' }, { 0x1085, 0x1086, 'T' },
+  { 0x108D, 0x108D, 'T' }, { 0x109D, 0x109D, 'T' }, { 0x135D, 0x135F, 'T' },
+  { 0x1712, 0x1714, 'T' }, { 0x1732, 0x1733, 'T' }, { 0x1752, 0x1753, 'T' },
+  { 0x1772, 0x1773, 'T' }, { 0x17B7, 0x17BD, 'T' }, { 0x17C6, 0x17C6, 'T' },
+  { 0x17C9, 0x17D3, 'T' }, { 0x17DD, 0x17DD, 'T' }, { 0x1807, 0x1807, 'D' },
+  { 0x1820, 0x1878, 'D' }, { 0x1885, 0x1886, 'T' }, { 0x1887, 0x18A8, 'D' },
+  { 0x18A9, 0x18A9, 'T' }, { 0x18AA, 0x18AA, 'D' }, { 0x1920, 0x1922, 'T' },
+  { 0x1927, 0x1928, 'T' }, { 0x1932, 0x1932, 'T' }, { 0x1939, 0x193B, 'T' },
+  { 0x1A17, 0x1A18, 'T' }, { 0x1A1B, 0x1A1B, 'T' }, { 0x1A56, 0x1A56, 'T' },
+  { 0x1A58, 0x1A5E, 'T' }, { 0x1A60, 0x1A60, 'T' }, { 0x1A62, 0x1A62, 'T' },
+  { 0x1A65, 0x1A6C, 'T' }, { 0x1A73, 0x1A7C, 'T' }, { 0x1A7F, 0x1A7F, 'T' },
+  { 0x1AB0, 0x1ACE, 'T' }, { 0x1B00, 0x1B03, 'T' }, { 0x1B34, 0x1B34, 'T' },
+  { 0x1B36, 0x1B3A, 'T' }, { 0x1B3C, 0x1B3C, 'T' }, { 0x1B42, 0x1B42, 'T' },
+  { 0x1B6B, 0x1B73, 'T' }, { 0x1B80, 0x1B81, 'T' }, { 0x1BA2, 0x1BA5, 'T' },
+  { 0x1BA8, 0x1BA9, 'T' }, { 0x1BAB, 0x1BAD, 'T' }, { 0x1BE6, 0x1BE6, 'T' },
+  { 0x1BE8, 0x1BE9, 'T' }, { 0x1BED, 0x1BED, 'T' }, { 0x1BEF, 0x1BF1, 'T' },
+  { 0x1C2C, 0x1C33, 'T' }, { 0x1C36, 0x1C37, 'T' }, { 0x1CD0, 0x1CD2, 'T' },
+  { 0x1CD4, 0x1CE0, 'T' }, { 0x1CE2, 0x1CE8, 'T' }, { 0x1CED, 0x1CED, 'T' },
+  { 0x1CF4, 0x1CF4, 'T' }, { 0x1CF8, 0x1CF9, 'T' }, { 0x1DC0, 0x1DFF, 'T' },
+  { 0x20D0, 0x20F0, 'T' }, { 0x2CEF, 0x2CF1, 'T' }, { 0x2D7F, 0x2D7F, 'T' },
+  { 0x2DE0, 0x2DFF, 'T' }, { 0x302A, 0x302D, 'T' }, { 0x3099, 0x309A, 'T' },
+  { 0xA66F, 0xA672, 'T' }, { 0xA674, 0xA67D, 'T' }, { 0xA69E, 0xA69F, 'T' },
+  { 0xA6F0, 0xA6F1, 'T' }, { 0xA802, 0xA802, 'T' }, { 0xA806, 0xA806, 'T' },
+  { 0xA80B, 0xA80B, 'T' }, { 0xA825, 0xA826, 'T' }, { 0xA82C, 0xA82C, 'T' },
+  { 0xA840, 0xA871, 'D' }, { 0xA872, 0xA872, 'L' }, { 0xA8C4, 0xA8C5, 'T' },
+  { 0xA8E0, 0xA8F1, 'T' }, { 0xA8FF, 0xA8FF, 'T' }, { 0xA926, 0xA92D, 'T' },
+  { 0xA947, 0xA951, 'T' }, { 0xA980, 0xA982, 'T' }, { 0xA9B3, 0xA9B3, 'T' },
+  { 0xA9B6, 0xA9B9, 'T' }, { 0xA9BC, 0xA9BD, 'T' }, { 0xA9E5, 0xA9E5, 'T' },
+  { 0xAA29, 0xAA2E, 'T' }, { 0xAA31, 0xAA32, 'T' }, { 0xAA35, 0xAA36, 'T' },
+  { 0xAA43, 0xAA43, 'T' }, { 0xAA4C, 0xAA4C, 'T' }, { 0xAA7C, 0xAA7C, 'T' },
+  { 0xAAB0, 0xAAB0, 'T' }, { 0xAAB2, 0xAAB4, 'T' }, { 0xAAB7, 0xAAB8, 'T' },
+  { 0xAABE, 0xAABF, 'T' }, { 0xAAC1, 0xAAC1, 'T' }, { 0xAAEC, 0xAAED, 'T' },
+  { 0xAAF6, 0xAAF6, 'T' }, { 0xABE5, 0xABE5, 'T' }, { 0xABE8, 0xABE8, 'T' },
+  { 0xABED, 0xABED, 'T' }, { 0xFB1E, 0xFB1E, 'T' }, { 0xFE20, 0xFE2F, 'T' },
+  { 0x101FD, 0x101FD, 'T' }, { 0x102E0, 0x102E0, 'T' }, { 0x10376, 0x1037A, 'T' },
+  { 0x10A01, 0x10A03, 'T' }, { 0x10A05, 0x10A06, 'T' }, { 0x10A0C, 0x10A0F, 'T' },
+  { 0x10A38, 0x10A3A, 'T' }, { 0x10A3F, 0x10A3F, 'T' }, { 0x10AC0, 0x10AC4, 'D' },
+  { 0x10AC5, 0x10AC5, 'R' }, { 0x10AC7, 0x10AC7, 'R' }, { 0x10AC9, 0x10ACA, 'R' },
+  { 0x10ACD, 0x10ACD, 'L' }, { 0x10ACE, 0x10AD2, 'R' }, { 0x10AD3, 0x10AD6, 'D' },
+  { 0x10AD7, 0x10AD7, 'L' }, { 0x10AD8, 0x10ADC, 'D' }, { 0x10ADD, 0x10ADD, 'R' },
+  { 0x10ADE, 0x10AE0, 'D' }, { 0x10AE1, 0x10AE1, 'R' }, { 0x10AE4, 0x10AE4, 'R' },
+  { 0x10AE5, 0x10AE6, 'T' }, { 0x10AEB, 0x10AEE, 'D' }, { 0x10AEF, 0x10AEF, 'R' },
+  { 0x10B80, 0x10B80, 'D' }, { 0x10B81, 0x10B81, 'R' }, { 0x10B82, 0x10B82, 'D' },
+  { 0x10B83, 0x10B85, 'R' }, { 0x10B86, 0x10B88, 'D' }, { 0x10B89, 0x10B89, 'R' },
+  { 0x10B8A, 0x10B8B, 'D' }, { 0x10B8C, 0x10B8C, 'R' }, { 0x10B8D, 0x10B8D, 'D' },
+  { 0x10B8E, 0x10B8F, 'R' }, { 0x10B90, 0x10B90, 'D' }, { 0x10B91, 0x10B91, 'R' },
+  { 0x10BA9, 0x10BAC, 'R' }, { 0x10BAD, 0x10BAE, 'D' }, { 0x10D00, 0x10D00, 'L' },
+  { 0x10D01, 0x10D21, 'D' }, { 0x10D22, 0x10D22, 'R' }, { 0x10D23, 0x10D23, 'D' },
+  { 0x10D24, 0x10D27, 'T' }, { 0x10EAB, 0x10EAC, 'T' }, { 0x10EFD, 0x10EFF, 'T' },
+  { 0x10F30, 0x10F32, 'D' }, { 0x10F33, 0x10F33, 'R' }, { 0x10F34, 0x10F44, 'D' },
+  { 0x10F46, 0x10F50, 'T' }, { 0x10F51, 0x10F53, 'D' }, { 0x10F54, 0x10F54, 'R' },
+  { 0x10F70, 0x10F73, 'D' }, { 0x10F74, 0x10F75, 'R' }, { 0x10F76, 0x10F81, 'D' },
+  { 0x10F82, 0x10F85, 'T' }, { 0x10FB0, 0x10FB0, 'D' }, { 0x10FB2, 0x10FB3, 'D' },
+  { 0x10FB4, 0x10FB6, 'R' }, { 0x10FB8, 0x10FB8, 'D' }, { 0x10FB9, 0x10FBA, 'R' },
+  { 0x10FBB, 0x10FBC, 'D' }, { 0x10FBD, 0x10FBD, 'R' }, { 0x10FBE, 0x10FBF, 'D' },
+  { 0x10FC1, 0x10FC1, 'D' }, { 0x10FC2, 0x10FC3, 'R' }, { 0x10FC4, 0x10FC4, 'D' },
+  { 0x10FC9, 0x10FC9, 'R' }, { 0x10FCA, 0x10FCA, 'D' }, { 0x10FCB, 0x10FCB, 'L' },
+  { 0x11001, 0x11001, 'T' }, { 0x11038, 0x11046, 'T' }, { 0x11070, 0x11070, 'T' },
+  { 0x11073, 0x11074, 'T' }, { 0x1107F, 0x11081, 'T' }, { 0x110B3, 0x110B6, 'T' },
+  { 0x110B9, 0x110BA, 'T' }, { 0x110C2, 0x110C2, 'T' }, { 0x11100, 0x11102, 'T' },
+  { 0x11127, 0x1112B, 'T' }, { 0x1112D, 0x11134, 'T' }, { 0x11173, 0x11173, 'T' },
+  { 0x11180, 0x11181, 'T' }, { 0x111B6, 0x111BE, 'T' }, { 0x111C9, 0x111CC, 'T' },
+  { 0x111CF, 0x111CF, 'T' }, { 0x1122F, 0x11231, 'T' }, { 0x11234, 0x11234, 'T' },
+  { 0x11236, 0x11237, 'T' }, { 0x1123E, 0x1123E, 'T' }, { 0x11241, 0x11241, 'T' },
+  { 0x112DF, 0x112DF, 'T' }, { 0x112E3, 0x112EA, 'T' }, { 0x11300, 0x11301, 'T' },
+  { 0x1133B, 0x1133C, 'T' }, { 0x11340, 0x11340, 'T' }, { 0x11366, 0x1136C, 'T' },
+  { 0x11370, 0x11374, 'T' }, { 0x11438, 0x1143F, 'T' }, { 0x11442, 0x11444, 'T' },
+  { 0x11446, 0x11446, 'T' }, { 0x1145E, 0x1145E, 'T' }, { 0x114B3, 0x114B8, 'T' },
+  { 0x114BA, 0x114BA, 'T' }, { 0x114BF, 0x114C0, 'T' }, { 0x114C2, 0x114C3, 'T' },
+  { 0x115B2, 0x115B5, 'T' }, { 0x115BC, 0x115BD, 'T' }, { 0x115BF, 0x115C0, 'T' },
+  { 0x115DC, 0x115DD, 'T' }, { 0x11633, 0x1163A, 'T' }, { 0x1163D, 0x1163D, 'T' },
+  { 0x1163F, 0x11640, 'T' }, { 0x116AB, 0x116AB, 'T' }, { 0x116AD, 0x116AD, 'T' },
+  { 0x116B0, 0x116B5, 'T' }, { 0x116B7, 0x116B7, 'T' }, { 0x1171D, 0x1171F, 'T' },
+  { 0x11722, 0x11725, 'T' }, { 0x11727, 0x1172B, 'T' }, { 0x1182F, 0x11837, 'T' },
+  { 0x11839, 0x1183A, 'T' }, { 0x1193B, 0x1193C, 'T' }, { 0x1193E, 0x1193E, 'T' },
+  { 0x11943, 0x11943, 'T' }, { 0x119D4, 0x119D7, 'T' }, { 0x119DA, 0x119DB, 'T' },
+  { 0x119E0, 0x119E0, 'T' }, { 0x11A01, 0x11A0A, 'T' }, { 0x11A33, 0x11A38, 'T' },
+  { 0x11A3B, 0x11A3E, 'T' }, { 0x11A47, 0x11A47, 'T' }, { 0x11A51, 0x11A56, 'T' },
+  { 0x11A59, 0x11A5B, 'T' }, { 0x11A8A, 0x11A96, 'T' }, { 0x11A98, 0x11A99, 'T' },
+  { 0x11C30, 0x11C36, 'T' }, { 0x11C38, 0x11C3D, 'T' }, { 0x11C3F, 0x11C3F, 'T' },
+  { 0x11C92, 0x11CA7, 'T' }, { 0x11CAA, 0x11CB0, 'T' }, { 0x11CB2, 0x11CB3, 'T' },
+  { 0x11CB5, 0x11CB6, 'T' }, { 0x11D31, 0x11D36, 'T' }, { 0x11D3A, 0x11D3A, 'T' },
+  { 0x11D3C, 0x11D3D, 'T' }, { 0x11D3F, 0x11D45, 'T' }, { 0x11D47, 0x11D47, 'T' },
+  { 0x11D90, 0x11D91, 'T' }, { 0x11D95, 0x11D95, 'T' }, { 0x11D97, 0x11D97, 'T' },
+  { 0x11EF3, 0x11EF4, 'T' }, { 0x11F00, 0x11F01, 'T' }, { 0x11F36, 0x11F3A, 'T' },
+  { 0x11F40, 0x11F40, 'T' }, { 0x11F42, 0x11F42, 'T' }, { 0x13440, 0x13440, 'T' },
+  { 0x13447, 0x13455, 'T' }, { 0x16AF0, 0x16AF4, 'T' }, { 0x16B30, 0x16B36, 'T' },
+  { 0x16F4F, 0x16F4F, 'T' }, { 0x16F8F, 0x16F92, 'T' }, { 0x16FE4, 0x16FE4, 'T' },
+  { 0x1BC9D, 0x1BC9E, 'T' }, { 0x1CF00, 0x1CF2D, 'T' }, { 0x1CF30, 0x1CF46, 'T' },
+  { 0x1D167, 0x1D169, 'T' }, { 0x1D17B, 0x1D182, 'T' }, { 0x1D185, 0x1D18B, 'T' },
+  { 0x1D1AA, 0x1D1AD, 'T' }, { 0x1D242, 0x1D244, 'T' }, { 0x1DA00, 0x1DA36, 'T' },
+  { 0x1DA3B, 0x1DA6C, 'T' }, { 0x1DA75, 0x1DA75, 'T' }, { 0x1DA84, 0x1DA84, 'T' },
+  { 0x1DA9B, 0x1DA9F, 'T' }, { 0x1DAA1, 0x1DAAF, 'T' }, { 0x1E000, 0x1E006, 'T' },
+  { 0x1E008, 0x1E018, 'T' }, { 0x1E01B, 0x1E021, 'T' }, { 0x1E023, 0x1E024, 'T' },
+  { 0x1E026, 0x1E02A, 'T' }, { 0x1E08F, 0x1E08F, 'T' }, { 0x1E130, 0x1E136, 'T' },
+  { 0x1E2AE, 0x1E2AE, 'T' }, { 0x1E2EC, 0x1E2EF, 'T' }, { 0x1E4EC, 0x1E4EF, 'T' },
+  { 0x1E8D0, 0x1E8D6, 'T' }, { 0x1E922, 0x1E943, 'D' }, { 0x1E944, 0x1E94B, 'T' },
+};
+
+}// namespace Uri::IdnaTables
+
+#endif// !URI_IDNA_TABLES_HPP
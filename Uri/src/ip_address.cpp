@@ -0,0 +1,25 @@
+#include "ip_address.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace Uri {
+
+bool ParseIpv4Address(std::string_view address, in_addr &binary)
+{
+  std::array<uint8_t, 4> octets{};
+  if (!ParseIpv4Octets(address, octets)) { return false; }
+  std::memcpy(&binary.s_addr, octets.data(), octets.size());
+  return true;
+}
+
+bool ParseIpv6Address(std::string_view address, in6_addr &binary)
+{
+  std::array<uint8_t, 16> bytes{};
+  if (!ParseIpv6Bytes(address, bytes)) { return false; }
+  std::memcpy(binary.s6_addr, bytes.data(), bytes.size());
+  return true;
+}
+
+}// namespace Uri
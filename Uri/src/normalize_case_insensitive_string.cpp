@@ -1,18 +1,107 @@
 #include "normalize_case_insensitive_string.hpp"
 
-#include <algorithm>
-#include <cctype>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/** This is the bit that tells lower case ASCII letters from upper case ones */
+constexpr unsigned int CASE_BIT = 0x20;
+
+/** This is the number of letters in the ASCII alphabet */
+constexpr unsigned int LETTERS = 26;
+
+/** This is the prime of the 64-bit FNV-1a hash */
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/*
+ * This function returns the ASCII lower-case equivalent of the character
+ */
+char FoldCharacter(char character)
+{
+  const unsigned int value = static_cast<unsigned char>(character);
+  return static_cast<char>(value - 'A' < LETTERS ? value | CASE_BIT : value);
+}
+
+#if defined(__SSE2__)
+/** This is the number of characters folded at a time */
+constexpr size_t VECTOR_SIZE = 16;
+
+/*
+ * This function folds sixteen characters at a time. Adding 0x80 - 'A' moves
+ * 'A'..'Z' to the bottom of the signed range (0x80..0x99), so one signed
+ * comparison picks the upper case letters out.
+ */
+__m128i FoldVector(__m128i characters)
+{
+  const auto shifted = _mm_add_epi8(characters, _mm_set1_epi8(static_cast<char>(0x80 - 'A')));
+  const auto is_upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + LETTERS)));
+  return _mm_or_si128(characters, _mm_and_si128(is_upper, _mm_set1_epi8(static_cast<char>(CASE_BIT))));
+}
+#endif
+
+}// namespace
 
 namespace Uri {
 
 std::string NormalizeCaseInsensitiveString(const std::string &in_string)
 {
+  std::string out_string(in_string);
+  AsciiToLower(out_string);
+  return out_string;
+}
+
+void AsciiToLower(std::span<char> characters)
+{
+  AsciiToLower(std::string_view(characters.data(), characters.size()), characters.data());
+}
 
-  std::string out_string;
+void AsciiToLower(std::string_view input, char *output)
+{
+  size_t position = 0;
 
-  std::transform(in_string.begin(), in_string.end(), std::back_inserter(out_string), tolower);
+#if defined(__SSE2__)
+  for (; position + VECTOR_SIZE <= input.size(); position += VECTOR_SIZE) {
+    const auto characters =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + position));// NOLINT
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + position), FoldVector(characters));// NOLINT
+  }
+#endif
 
-  return out_string;
+  for (; position < input.size(); ++position) { output[position] = FoldCharacter(input[position]); }
+}
+
+bool EqualsCaseInsensitive(std::string_view lhs, std::string_view rhs)
+{
+  if (lhs.size() != rhs.size()) { return false; }
+
+  size_t position = 0;
+
+#if defined(__SSE2__)
+  constexpr int ALL_EQUAL = 0xFFFF;
+  for (; position + VECTOR_SIZE <= lhs.size(); position += VECTOR_SIZE) {
+    const auto left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs.data() + position));// NOLINT
+    const auto right =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs.data() + position));// NOLINT
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(FoldVector(left), FoldVector(right))) != ALL_EQUAL) {
+      return false;
+    }
+  }
+#endif
+
+  for (; position < lhs.size(); ++position) {
+    if (FoldCharacter(lhs[position]) != FoldCharacter(rhs[position])) { return false; }
+  }
+  return true;
+}
+
+uint64_t HashCaseInsensitive(std::string_view in_string, uint64_t hash)
+{
+  for (const auto character : in_string) {
+    hash = (hash ^ static_cast<unsigned char>(FoldCharacter(character))) * FNV_PRIME;
+  }
+  return hash;
 }
 
 }// namespace Uri
@@ -1,8 +1,10 @@
-
 #ifndef NORMALIZE_CASE_INSENSITEVE_STRING
 #define NORMALIZE_CASE_INSENSITEVE_STRING
 
+#include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace Uri {
 /* This function takes a string and swaps all upper-case characters with their
@@ -17,6 +19,50 @@ namespace Uri {
  */
 
 std::string NormalizeCaseInsensitiveString(const std::string &in_string);
+
+/* This function swaps all ASCII upper-case characters with their lower-case
+ * equivalents in place. It works on 16 characters at a time where the CPU
+ * supports it, and does not depend on the locale.
+ *
+ * @param[in,out] characters
+ *  these are the characters to fold
+ */
+void AsciiToLower(std::span<char> characters);
+
+/* This function writes the ASCII lower-case equivalent of the input to the
+ * output buffer
+ *
+ * @param[in] input
+ *  these are the characters to fold
+ *
+ * @param[out] output
+ *  this is where the folded characters are written, it must have room for
+ *  as many characters as the input has. It may be the same as the input.
+ */
+void AsciiToLower(std::string_view input, char *output);
+
+/* This function compares two strings ignoring the case of ASCII letters,
+ * folding them as it goes instead of building folded copies
+ *
+ * @return
+ *  an indication of whether or not the strings are equal
+ */
+bool EqualsCaseInsensitive(std::string_view lhs, std::string_view rhs);
+
+/* This function continues a 64-bit FNV-1a hash with the ASCII lower-case
+ * equivalent of the string, so that strings differing only in case hash the
+ * same
+ *
+ * @param[in] in_string
+ *  this is the string to hash
+ *
+ * @param[in] hash
+ *  this is the hash so far, the FNV-1a offset basis for a fresh hash
+ *
+ * @return
+ *  the updated hash
+ */
+uint64_t HashCaseInsensitive(std::string_view in_string, uint64_t hash);
 }// namespace Uri
  //
 #endif
@@ -0,0 +1,21 @@
+#include "parse_port.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace Uri {
+
+bool ParsePort(std::string_view digits, uint16_t &port) noexcept
+{
+  // std::from_chars does not skip whitespace nor accept a sign, and reports
+  // values above 65535 as out of range instead of wrapping them
+  uint16_t value = 0;
+  const auto *const end = digits.data() + digits.size();
+  const auto [last, error] = std::from_chars(digits.data(), end, value);
+  if (error != std::errc() || last != end) { return false; }
+
+  port = value;
+  return true;
+}
+
+}// namespace Uri
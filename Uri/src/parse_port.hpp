@@ -0,0 +1,25 @@
+#ifndef URI_PARSE_PORT_HPP
+#define URI_PARSE_PORT_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace Uri {
+/* This function parses the port of an authority, which must be made only of
+ * decimal digits and fit in 16 bits. It never throws and never allocates, so
+ * junk ports cost no more to reject than good ones cost to accept.
+ *
+ * @param[in] digits
+ *  This is the text after the colon of the authority
+ *
+ * @param[out] port
+ *  This is where the port is stored. It is only written if the text is a
+ *  valid port.
+ *
+ * @return
+ *  An indication of whether or not the text is a valid port
+ */
+bool ParsePort(std::string_view digits, uint16_t &port) noexcept;
+}// namespace Uri
+
+#endif// !URI_PARSE_PORT_HPP
@@ -52,5 +52,11 @@ char PercentEncodedCharacterDecoder::GetDecodedCharacter() const
   return static_cast<char>(impl_->decoded_character);
 }
 
+void PercentEncodedCharacterDecoder::Reset()
+{
+  impl_->decoded_character = 0;
+  impl_->digits_left = 2;
+}
+
 
 }// namespace Uri
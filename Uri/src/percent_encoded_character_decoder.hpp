@@ -42,6 +42,11 @@ public:
    */
   [[nodiscard]] char GetDecodedCharacter() const;
 
+  /* This method makes the decoder ready for another encoded character,
+   * keeping its memory
+   */
+  void Reset();
+
 private:
   const static int LETTER_DISPLACEMENT = 10;
   const static int HEX_DISPLACEMENT = 16;
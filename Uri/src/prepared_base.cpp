@@ -0,0 +1,128 @@
+#include "prepared_base.hpp"
+
+#include <string>
+
+namespace Uri {
+
+struct PreparedBase::Implementation
+{
+  /** This is a copy of the base, for the references resolved by Uri::Resolve */
+  Uri base;
+
+  /**
+   * This tells if the base has a scheme, without which targets are
+   * relative references themselves and are all resolved by Uri::Resolve
+   */
+  bool has_scheme = false;
+
+  /**
+   * This tells if the directory of the base has no dot segments, without
+   * which merged paths always have to be normalized
+   */
+  bool directory_normalized = false;
+
+  /** This is the scheme and authority of the base */
+  std::string prefix;
+
+  /** This is the prefix followed by the directory of the base and a "/" */
+  std::string directory;
+
+  /** This is the prefix followed by the normalized path of the base */
+  std::string path;
+
+  /** This is the query of the base with its "?", or empty if it has none */
+  std::string query;
+
+  /** These are where references given as strings are parsed */
+  std::string reference_string;
+  Uri reference;
+};
+
+PreparedBase::~PreparedBase() = default;
+
+PreparedBase::PreparedBase(PreparedBase &&) noexcept = default;
+
+PreparedBase &PreparedBase::operator=(PreparedBase &&) noexcept = default;
+
+PreparedBase::PreparedBase(const Uri &base) : impl_(new Implementation)
+{
+  impl_->base.CopyScheme(base);
+  impl_->base.CopyAuthority(base);
+  impl_->base.SetPath(base.GetPath());
+  impl_->base.CopyQuery(base);
+
+  impl_->has_scheme = !base.IsRelativeReference();
+  base.AppendSchemeAndAuthority(impl_->prefix);
+  base.AppendQuery(impl_->query);
+
+  // The trailing empty segment puts the "/" after the last directory
+  Uri directory;
+  auto directory_path = base.GetBaseDirectory();
+  directory.SetPath(directory_path);
+  impl_->directory_normalized = directory.IsPathNormalized();
+  impl_->directory = impl_->prefix;
+  if (!directory_path.empty()) {
+    directory_path.emplace_back("");
+    directory.SetPath(directory_path);
+    directory.AppendPath(impl_->directory, true);
+  }
+
+  auto target = base.Resolve(Uri());
+  target.ClearQuery();
+  impl_->path = target.GenerateString();
+}
+
+void PreparedBase::Resolve(const Uri &reference, std::string &target) const
+{
+  const bool fast = impl_->has_scheme && reference.IsRelativeReference()
+                    && reference.GetHost().empty() && reference.IsPathNormalized();
+  if (!fast) {
+    target = impl_->base.Resolve(reference).GenerateString();
+    return;
+  }
+
+  if (reference.IsPathEmpty()) {
+    target.assign(impl_->path);
+    if (reference.HasQuery()) {
+      reference.AppendQuery(target);
+    } else {
+      target.append(impl_->query);
+    }
+  } else if (reference.IsAbsolutePath()) {
+    target.assign(impl_->prefix);
+    reference.AppendPath(target, true);
+    reference.AppendQuery(target);
+  } else if (impl_->directory_normalized) {
+    target.assign(impl_->directory);
+    reference.AppendPath(target, true);
+    reference.AppendQuery(target);
+  } else {
+    target = impl_->base.Resolve(reference).GenerateString();
+    return;
+  }
+  reference.AppendFragment(target);
+}
+
+bool PreparedBase::Resolve(std::string_view reference, std::string &target)
+{
+  impl_->reference_string.assign(reference);
+  if (!impl_->reference.ParseFromString(impl_->reference_string)) {
+    target.clear();
+    return false;
+  }
+  Resolve(impl_->reference, target);
+  return true;
+}
+
+size_t PreparedBase::ResolveBatch(std::span<const std::string_view> references,
+  std::vector<std::string> &targets)
+{
+  targets.resize(references.size());
+  size_t resolved = 0;
+  for (size_t index = 0; index < references.size(); ++index) {
+    if (Resolve(references[index], targets[index])) { ++resolved; }
+  }
+  return resolved;
+}
+
+}// namespace Uri
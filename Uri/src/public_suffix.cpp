@@ -0,0 +1,149 @@
+#include "public_suffix.hpp"
+#include "public_suffix_table.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+using namespace Uri::PublicSuffixTable;
+
+/** This is returned when a host has no public suffix */
+constexpr size_t NO_SUFFIX = std::string_view::npos;
+
+char ToLower(char character)
+{
+  return (character >= 'A' && character <= 'Z') ? static_cast<char>(character - 'A' + 'a')
+                                                 : character;
+}
+
+/*
+ * This function returns the offset of the first character of the label
+ * that ends at the given offset
+ */
+size_t LabelStart(std::string_view host, size_t end)
+{
+  const auto dot = host.substr(0, end).rfind('.');
+  return dot == std::string_view::npos ? 0 : dot + 1;
+}
+
+/*
+ * This function tells if the host is an IP address rather than a name, which
+ * is when it holds a ":" or its last label is a number, as no top level
+ * domain is one
+ */
+bool IsIpAddress(std::string_view host)
+{
+  if (host.find(':') != std::string_view::npos) { return true; }
+  const auto last = host.substr(LabelStart(host, host.size()));
+  return !last.empty() && std::all_of(last.begin(), last.end(), [](char character) {
+    return character >= '0' && character <= '9';
+  });
+}
+
+/*
+ * This function returns the character of a label at the given offset of the
+ * graph, without the mark of the last character
+ */
+char LabelCharacter(size_t offset) { return static_cast<char>(GRAPH[offset] & ~LABEL_END); }
+
+/*
+ * This function reads the entry at the given offset of the graph, giving
+ * the offset it holds and moving to the next entry
+ */
+size_t ReadEntry(size_t &entry, bool &last)
+{
+  const auto first = GRAPH[entry++];
+  last = (first & LAST_ENTRY) != 0;
+  auto offset = static_cast<size_t>(first & ENTRY_HIGH_BITS);
+  for (auto extra = (first & ENTRY_SIZE_BITS) >> ENTRY_SIZE_SHIFT; extra > 0; --extra) {
+    offset = (offset << 8) | GRAPH[entry++];
+  }
+  return offset;
+}
+
+/*
+ * This function returns the offset in the host, which has no trailing ".",
+ * where its public suffix starts. The graph is walked from the end of the
+ * host, and every rule that ends at the start of a label is a match. An
+ * exception rule wins over every other, and otherwise the longest match
+ * does.
+ */
+size_t FindPublicSuffix(std::string_view host)
+{
+  if (host.empty() || IsIpAddress(host)) { return NO_SUFFIX; }
+
+  // The rule "*" matches when no other does
+  auto suffix = LabelStart(host, host.size());
+  auto position = host.size();
+  size_t node = 0;
+  while (position > 0) {
+    auto rules = GRAPH[node];
+    if ((rules & ENTRY_SIZE_BITS) == RULES_MARK) {
+      ++node;
+      if ((rules & HAS_CHILDREN) == 0) { break; }
+    }
+
+    // Labels of the children of a node begin with different characters
+    const auto next = ToLower(host[position - 1]);
+    size_t child = node;
+    bool last = false;
+    for (size_t entry = node;;) {
+      const auto entry_offset = entry;
+      const auto offset = ReadEntry(entry, last);
+      child = (entry_offset == node ? entry_offset : child) + offset;
+      if (LabelCharacter(child) == next) { break; }
+      if (last) { return suffix; }
+    }
+
+    // The rest of the label has to match too
+    for (node = child;; ++node) {
+      if (position == 0 || ToLower(host[position - 1]) != LabelCharacter(node)) { return suffix; }
+      --position;
+      if ((GRAPH[node] & LABEL_END) != 0) { break; }
+    }
+    ++node;
+
+    rules = GRAPH[node];
+    if ((rules & ENTRY_SIZE_BITS) != RULES_MARK || (position > 0 && host[position - 1] != '.')) {
+      continue;
+    }
+    if ((rules & EXCEPTION) != 0) { return host.find('.', position) + 1; }
+    if ((rules & NORMAL) != 0) { suffix = std::min(suffix, position); }
+    if ((rules & WILDCARD) != 0 && position > 0) {
+      suffix = std::min(suffix, LabelStart(host, position - 1));
+    }
+  }
+  return suffix;
+}
+
+/*
+ * This function removes the "." that may end a host
+ */
+std::string_view WithoutTrailingDot(std::string_view host)
+{
+  if (!host.empty() && host.back() == '.') { host.remove_suffix(1); }
+  return host;
+}
+
+}// namespace
+
+namespace Uri {
+
+std::string_view GetPublicSuffix(std::string_view host)
+{
+  host = WithoutTrailingDot(host);
+  const auto suffix = FindPublicSuffix(host);
+  return suffix == NO_SUFFIX ? std::string_view() : host.substr(suffix);
+}
+
+std::string_view GetRegistrableDomain(std::string_view host)
+{
+  host = WithoutTrailingDot(host);
+  const auto suffix = FindPublicSuffix(host);
+  if (suffix == NO_SUFFIX || suffix < 2) { return {}; }
+  const auto start = LabelStart(host, suffix - 1);
+  return start + 1 == suffix ? std::string_view() : host.substr(start);
+}
+
+}// namespace Uri
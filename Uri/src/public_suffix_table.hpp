@@ -0,0 +1,3319 @@
+#ifndef URI_PUBLIC_SUFFIX_TABLE_HPP
+#define URI_PUBLIC_SUFFIX_TABLE_HPP
+
+// This file is generated by Uri/tools/generate_public_suffix_table.py from
+// the Public Suffix List (https://publicsuffix.org/). Do not edit it by hand.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <cstdint>
+
+namespace Uri::PublicSuffixTable {
+
+/** These are the bits of the rules byte of a node */
+inline constexpr uint8_t RULES_MARK = 0x60;
+inline constexpr uint8_t NORMAL = 0x01;
+inline constexpr uint8_t WILDCARD = 0x02;
+inline constexpr uint8_t EXCEPTION = 0x04;
+inline constexpr uint8_t HAS_CHILDREN = 0x08;
+
+/** This marks the last character of a label */
+inline constexpr uint8_t LABEL_END = 0x80;
+
+/** These are the fields of the first byte of an entry */
+inline constexpr uint8_t LAST_ENTRY = 0x80;
+inline constexpr unsigned ENTRY_SIZE_SHIFT = 5;
+inline constexpr uint8_t ENTRY_SIZE_BITS = 0x60;
+inline constexpr uint8_t ENTRY_HIGH_BITS = 0x1F;
+
+/** This is the graph of the rules, described in the generator */
+inline constexpr uint8_t GRAPH[] = {
+  0x20, 0x34, 0x21, 0xF7, 0x22, 0x45, 0x20, 0x95, 0x21, 0x03, 0x21, 0x3D, 0x24, 0xD2, 0x31, 0x6F,
+  0x26, 0x1B, 0x26, 0x9A, 0x1C, 0x40, 0x2E, 0xE7, 0x3E, 0x6D, 0x24, 0x46, 0x3F, 0x89, 0x27, 0xE5,
+  0x23, 0x6B, 0x20, 0xED, 0x22, 0x56, 0x22, 0x27, 0x27, 0x1E, 0x21, 0x07, 0x2A, 0x40, 0x23, 0xEC,
+  0x22, 0x95, 0xA1, 0x42, 0xFA, 0x13, 0x04, 0x20, 0x31, 0x10, 0x1F, 0x0A, 0x06, 0x20, 0x50, 0x16,
+  0x20, 0x25, 0x20, 0x66, 0x1A, 0x20, 0x3A, 0x94, 0xFA, 0xC0, 0xC1, 0x21, 0x79, 0xF8, 0x69, 0x81,
+  0xAE, 0x04, 0x08, 0x06, 0x89, 0x74, 0x69, 0x62, 0x65, 0x6C, 0x65, 0xF4, 0x62, 0x6F, 0x74, 0xF0,
+  0xC0, 0xC8, 0xE2, 0x67, 0x6E, 0x69, 0x74, 0x66, 0xE1, 0xC0, 0xC8, 0x62, 0xE5, 0x02, 0x86, 0x74,
+  0x69, 0xF3, 0xC0, 0xCB, 0x6A, 0x6E, 0x6F, 0x7A, 0x6C, 0xE1, 0xC0, 0xB8, 0x3C, 0xF5, 0x69, 0x02,
+  0x84, 0xF2, 0xC0, 0xAD, 0xCB, 0xAE, 0x40, 0xC9, 0xB5, 0x21, 0xB1, 0x02, 0x8A, 0xF4, 0x69, 0x81,
+  0xAE, 0x0C, 0x08, 0x40, 0xB8, 0xBE, 0x04, 0x30, 0x7F, 0x20, 0x21, 0xA1, 0xF3, 0xEF, 0x40, 0xC9,
+  0xE4, 0x21, 0x4A, 0xA0, 0x24, 0xEC, 0x40, 0xA5, 0x03, 0xC0, 0x26, 0x4B, 0xF3, 0x69, 0x81, 0xAE,
+  0x40, 0xC9, 0x95, 0x21, 0xA9, 0x8A, 0x72, 0x61, 0xF7, 0xC0, 0xC9, 0x4A, 0xEE, 0x69, 0x02, 0x89,
+  0xE1, 0x69, 0x81, 0x6E, 0x69, 0xE6, 0xC0, 0xB4, 0xEB, 0xAE, 0x13, 0x0F, 0x12, 0x40, 0x8A, 0xDB,
+  0x40, 0x25, 0xD6, 0x25, 0x57, 0x23, 0x49, 0x2C, 0x7D, 0x23, 0x79, 0xA1, 0xB3, 0xF4, 0x05, 0x40,
+  0xCA, 0xE5, 0x9C, 0x6E, 0x65, 0x6D, 0x61, 0x69, 0xEC, 0xC0, 0xB5, 0x6D, 0xE9, 0x02, 0x86, 0x77,
+  0xE9, 0x69, 0xC0, 0xC7, 0x9C, 0xF2, 0x04, 0xC0, 0xCA, 0xF6, 0xEF, 0xC0, 0xC0, 0x7E, 0x61, 0x73,
+  0x71, 0x2D, 0x69, 0x72, 0x6F, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0xCC, 0x06, 0xED, 0x69, 0x81, 0xAE,
+  0x0B, 0x40, 0xC9, 0x20, 0x0A, 0x21, 0x89, 0x20, 0x20, 0x04, 0x86, 0xF6, 0x40, 0xA3, 0x0B, 0xC0,
+  0x27, 0xA3, 0xEB, 0x69, 0x81, 0xAE, 0x0B, 0x40, 0x90, 0xC4, 0x40, 0x39, 0xD3, 0x06, 0x1E, 0x06,
+  0x86, 0xF4, 0x04, 0xC0, 0xCA, 0xAE, 0x72, 0x6F, 0x70, 0x65, 0x6C, 0x65, 0x74, 0x7A, 0x61, 0x6B,
+  0x2E, 0x73, 0x61, 0xE1, 0xC0, 0x9C, 0x28, 0x69, 0xE2, 0x69, 0x04, 0xC0, 0xCA, 0x7E, 0xAE, 0x0B,
+  0x04, 0x08, 0x0A, 0x0C, 0x08, 0x0C, 0x05, 0xC0, 0xB7, 0x26, 0xF8, 0xC0, 0xCA, 0x9F, 0x73, 0x6E,
+  0xE4, 0x40, 0xBB, 0xB9, 0xAD, 0x9F, 0x72, 0x65, 0x74, 0x74, 0x65, 0x62, 0xAD, 0xC0, 0xC0, 0x49,
+  0xF0, 0x06, 0x40, 0xAD, 0x6F, 0xAF, 0x45, 0x74, 0xE6, 0xC0, 0xCA, 0x05, 0x6E, 0x61, 0x66, 0x61,
+  0xED, 0xC0, 0xCA, 0x75, 0x6C, 0x69, 0x61, 0x72, 0x74, 0x65, 0x76, 0x69, 0xF4, 0xC0, 0xC8, 0xB8,
+  0x69, 0xFA, 0xC0, 0xBE, 0x14, 0xE5, 0x03, 0x07, 0x87, 0x72, 0x6F, 0x6D, 0xAD, 0xC0, 0xC0, 0x19,
+  0x6D, 0x6F, 0x73, 0xAD, 0xC0, 0xC0, 0x12, 0x68, 0x74, 0xAD, 0xC0, 0xC0, 0x0C, 0xE4, 0x69, 0x81,
+  0xAE, 0x11, 0x40, 0x25, 0x1E, 0x40, 0x4F, 0x0D, 0x40, 0x4D, 0x0E, 0x25, 0xA3, 0x23, 0x2A, 0x06,
+  0xA0, 0x2A, 0xED, 0x40, 0xCA, 0x2B, 0x95, 0xE3, 0x69, 0x81, 0xAE, 0x08, 0x15, 0x15, 0x40, 0xC4,
+  0xC7, 0xA5, 0x2A, 0xED, 0x04, 0xC0, 0xB3, 0xE0, 0x75, 0x72, 0x74, 0x6E, 0x65, 0x63, 0x61, 0x74,
+  0x65, 0x6D, 0xAE, 0x40, 0xB3, 0xC0, 0xA6, 0x10, 0x69, 0x6E, 0x75, 0x6D, 0x2E, 0x64, 0x75, 0x6F,
+  0x6C, 0x63, 0xAE, 0x02, 0x84, 0xF4, 0xC0, 0xBF, 0xB4, 0xF2, 0xC0, 0xBE, 0x0A, 0xB4, 0xC0, 0xC9,
+  0xD4, 0xE2, 0x69, 0x81, 0xAE, 0x0B, 0x40, 0xC7, 0x32, 0x20, 0xF9, 0x21, 0x8D, 0x06, 0x1E, 0x8C,
+  0x6A, 0xF3, 0xC0, 0xC9, 0xBA, 0xE1, 0x69, 0x81, 0xAE, 0x40, 0x26, 0x74, 0x40, 0x9A, 0xE5, 0x22,
+  0x3A, 0x24, 0x60, 0x20, 0x69, 0x21, 0x53, 0x06, 0x1E, 0x06, 0x86, 0xF9, 0x20, 0x25, 0x0A, 0x1C,
+  0x20, 0x4F, 0x0A, 0x20, 0x2A, 0x10, 0x06, 0x0F, 0x20, 0x20, 0x20, 0x2D, 0x07, 0x20, 0x23, 0x20,
+  0x25, 0x0A, 0x20, 0x3A, 0x20, 0x20, 0x20, 0x3B, 0x0B, 0x40, 0x78, 0xD6, 0x3F, 0x49, 0xC0, 0x23,
+  0x87, 0x76, 0x61, 0xEE, 0x69, 0x81, 0x64, 0xEC, 0xC0, 0xC9, 0xA4, 0xF5, 0x69, 0x02, 0x88, 0xE2,
+  0x69, 0x81, 0x74, 0xF3, 0xC0, 0x9C, 0x3C, 0xAE, 0x0B, 0x40, 0xB7, 0xDA, 0x2F, 0xEE, 0x21, 0x93,
+  0x20, 0x24, 0x86, 0xE2, 0xC0, 0xB7, 0xF6, 0xF4, 0x0B, 0x0E, 0x40, 0x57, 0x9D, 0x40, 0x24, 0xE7,
+  0xC0, 0x36, 0xA3, 0xF2, 0x02, 0x85, 0x65, 0xF0, 0xC0, 0xB2, 0x28, 0x61, 0xF0, 0x69, 0xC0, 0xBA,
+  0xAB, 0xE9, 0x09, 0x06, 0x1F, 0x40, 0x79, 0xD5, 0xC0, 0x4F, 0x5B, 0xF2, 0x40, 0x8E, 0x48, 0xB1,
+  0xBE, 0xEE, 0x02, 0x97, 0x75, 0x6D, 0x6D, 0x6F, 0xE3, 0x69, 0x81, 0xAE, 0x07, 0x40, 0x51, 0x59,
+  0xC0, 0x24, 0x45, 0x6D, 0x75, 0x72, 0x6F, 0xE6, 0xC0, 0xC8, 0xC6, 0x69, 0xE6, 0xC0, 0xCA, 0x52,
+  0x6C, 0x65, 0xE4, 0xC0, 0xC0, 0xB6, 0xF3, 0x69, 0x04, 0xC0, 0xB1, 0xBC, 0xF0, 0xC0, 0xBF, 0x0F,
+  0xF2, 0x07, 0x04, 0x04, 0x08, 0xC0, 0x7A, 0x0C, 0xF5, 0xC0, 0xB1, 0xB8, 0xF4, 0xC0, 0x79, 0xAF,
+  0x6F, 0x74, 0x63, 0x65, 0xF2, 0xC0, 0xBD, 0x26, 0xE5, 0x08, 0x05, 0x40, 0x27, 0xA7, 0xC0, 0x59,
+  0xFA, 0x76, 0xE9, 0xC0, 0xC5, 0xEB, 0xE3, 0xC0, 0xC3, 0xBD, 0xF0, 0x69, 0x81, 0xAE, 0x40, 0x97,
+  0x81, 0x40, 0x2F, 0xBC, 0x21, 0x8D, 0x06, 0x1E, 0x06, 0x86, 0xEF, 0x40, 0xC3, 0xFD, 0xA4, 0x8B,
+  0xEE, 0x04, 0xC0, 0xB5, 0x15, 0xE1, 0x04, 0xC0, 0xB3, 0xE6, 0x66, 0xE6, 0xC0, 0xC8, 0xE5, 0xED,
+  0x69, 0x05, 0x0C, 0xC0, 0xC2, 0x96, 0x65, 0x64, 0x61, 0x63, 0xE1, 0x69, 0x81, 0x2E, 0xEC, 0xC0,
+  0xC0, 0x51, 0xAE, 0x40, 0xC2, 0x79, 0x24, 0x60, 0x21, 0xBC, 0x06, 0x06, 0x18, 0x06, 0x86, 0xEC,
+  0x69, 0x08, 0x06, 0x08, 0x3F, 0x71, 0xC0, 0xA8, 0x08, 0xEC, 0x40, 0xBE, 0x92, 0xAA, 0x29, 0x69,
+  0x6D, 0x61, 0xE6, 0x69, 0xC0, 0x7C, 0x9C, 0xAE, 0x0E, 0x40, 0x97, 0x62, 0x40, 0x2F, 0x3B, 0x20,
+  0x38, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xE4, 0x40, 0xC6, 0x4D, 0xA1, 0x3C, 0xEB, 0x69, 0x22, 0x7E,
+  0xC0, 0xC5, 0xA7, 0xE7, 0x69, 0x03, 0x05, 0x8C, 0x72, 0xE5, 0xC0, 0xAD, 0xE9, 0x6F, 0x6C, 0x6F,
+  0x6E, 0x68, 0x63, 0x65, 0xF4, 0x69, 0xC0, 0xBA, 0x0B, 0xAE, 0x40, 0x9B, 0x16, 0x40, 0x2B, 0x9B,
+  0x21, 0x8D, 0x06, 0x1E, 0x02, 0x8A, 0xE5, 0x04, 0x07, 0x0E, 0x86, 0x73, 0x6E, 0x69, 0xEB, 0xC0,
+  0xB5, 0x02, 0xEE, 0x07, 0x40, 0x79, 0xE4, 0xC0, 0x4D, 0x80, 0x72, 0x6F, 0xF4, 0xC0, 0xC5, 0x3B,
+  0x6C, 0x74, 0xEE, 0xC0, 0x9A, 0xED, 0x6B, 0xE3, 0xC0, 0xC7, 0x5C, 0xE4, 0x04, 0xC0, 0xAC, 0x74,
+  0x64, 0xE1, 0xC0, 0x29, 0x39, 0xE3, 0x69, 0x07, 0x40, 0x56, 0xF4, 0xC0, 0x3F, 0xAD, 0xAE, 0x11,
+  0x0D, 0x40, 0xAD, 0xD2, 0x22, 0xF1, 0x30, 0xFC, 0x24, 0x8F, 0x0A, 0x21, 0x83, 0x20, 0x2A, 0x86,
+  0xF3, 0x04, 0xC0, 0xC6, 0x5B, 0x65, 0x67, 0x6F, 0x6C, 0xEB, 0xC0, 0xC7, 0xE8, 0xED, 0x04, 0xC0,
+  0xC8, 0x11, 0x6F, 0xE3, 0x69, 0x81, 0xAE, 0x04, 0xC0, 0xC2, 0xC9, 0x65, 0xE3, 0xB7, 0x64, 0xE2,
+  0x69, 0x05, 0x04, 0xC0, 0xC7, 0x52, 0xE7, 0xC0, 0x86, 0x5F, 0xAE, 0x0C, 0x22, 0xDA, 0x40, 0xB3,
+  0x5C, 0x29, 0x3A, 0x28, 0x41, 0xA0, 0x2A, 0x64, 0x75, 0x6F, 0x6C, 0xE3, 0xC0, 0xC7, 0x62, 0xE1,
+  0x0D, 0x06, 0x05, 0x40, 0x77, 0x87, 0x25, 0x88, 0x40, 0x38, 0x9F, 0xB1, 0xE6, 0x77, 0x64, 0xE1,
+  0xC0, 0x7A, 0x1D, 0xF0, 0x69, 0xC0, 0xC7, 0x86, 0xE4, 0x69, 0x02, 0x91, 0x6F, 0xF4, 0x69, 0x81,
+  0x2E, 0x65, 0x6D, 0x79, 0x66, 0x69, 0x6C, 0x61, 0x75, 0xF1, 0xC0, 0xC5, 0xF8, 0xE9, 0x04, 0xC0,
+  0x63, 0x27, 0x72, 0x66, 0x6B, 0x63, 0xE1, 0xC0, 0xC7, 0x89, 0x37, 0x72, 0x72, 0x30, 0x33, 0x2D,
+  0x2D, 0xEE, 0xC0, 0xC8, 0xAD, 0x34, 0x70, 0x75, 0x6E, 0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0xC8, 0xA2,
+  0xF8, 0x0C, 0x0C, 0x05, 0x06, 0x10, 0x1D, 0x06, 0x15, 0x0B, 0xC0, 0x62, 0x62, 0xF8, 0x04, 0xC0,
+  0xC8, 0x8D, 0x61, 0xED, 0x40, 0x62, 0xC5, 0xAF, 0x67, 0xF3, 0x69, 0xC0, 0xBD, 0x81, 0x72, 0x62,
+  0xE7, 0xC0, 0xC8, 0x66, 0xEF, 0x05, 0x05, 0xC0, 0xC6, 0x31, 0x72, 0xE5, 0xC0, 0xC8, 0x73, 0xE2,
+  0x69, 0xC0, 0xC8, 0x6E, 0xED, 0x69, 0x05, 0x0D, 0xC0, 0xC7, 0x14, 0x6D, 0x61, 0x32, 0x69, 0x62,
+  0x67, 0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0xC8, 0x5A, 0xAE, 0x40, 0xC4, 0xFE, 0x22, 0x17, 0x06, 0x18,
+  0x8C, 0x69, 0x6C, 0xE6, 0xC0, 0xC5, 0x77, 0xE5, 0x07, 0x06, 0x40, 0xBC, 0xE1, 0xA9, 0xDD, 0x6D,
+  0xE1, 0x69, 0xC0, 0xBE, 0x78, 0xE4, 0x40, 0x4F, 0x1E, 0xC0, 0x5C, 0x74, 0xE3, 0x69, 0x81, 0xAE,
+  0x40, 0xC4, 0x06, 0x21, 0x9A, 0xA1, 0x48, 0xE1, 0x69, 0x04, 0xC0, 0xC7, 0x16, 0xAE, 0x0D, 0x04,
+  0x40, 0x99, 0xA1, 0x3A, 0x01, 0x21, 0x90, 0x24, 0xB2, 0xA4, 0x5B, 0xF9, 0xC0, 0xC8, 0x13, 0xF3,
+  0x40, 0xC4, 0xEE, 0xA1, 0xE4, 0xF7, 0x0F, 0x0D, 0x20, 0x4B, 0x14, 0x1A, 0x0F, 0x19, 0x12, 0x0F,
+  0x10, 0x08, 0xC0, 0xC5, 0xD0, 0xFA, 0x69, 0x81, 0xAE, 0x40, 0xC5, 0x2C, 0x21, 0x83, 0x20, 0x26,
+  0x04, 0x86, 0xF4, 0x69, 0x81, 0xAE, 0x0F, 0x04, 0x0F, 0x06, 0x11, 0x40, 0xA0, 0x82, 0x3D, 0xF5,
+  0x27, 0xF8, 0x06, 0xA0, 0x24, 0xFA, 0xC0, 0x41, 0x35, 0x6D, 0x6F, 0xE3, 0x69, 0x81, 0x2E, 0x72,
+  0x65, 0x6C, 0x69, 0x61, 0xED, 0xC0, 0xC6, 0x39, 0xEC, 0x40, 0xC4, 0x31, 0xA2, 0x7A, 0xE2, 0x04,
+  0xC0, 0xBC, 0x9C, 0x38, 0x32, 0x77, 0x72, 0x7A, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0xC7, 0xB3, 0x61,
+  0x34, 0x36, 0x6F, 0x61, 0x30, 0x66, 0x7A, 0x2D, 0x2D, 0xEE, 0xC0, 0xC7, 0xA5, 0xF2, 0x69, 0x04,
+  0xC0, 0xC6, 0x73, 0xAE, 0x40, 0x95, 0x0B, 0x40, 0x2F, 0xBC, 0x0A, 0x21, 0x83, 0x20, 0x26, 0x04,
+  0x86, 0xF0, 0x69, 0x81, 0xAE, 0x0B, 0x05, 0x40, 0xA6, 0xE0, 0x3E, 0x3E, 0x21, 0x1D, 0x14, 0x96,
+  0x75, 0xE1, 0xC0, 0x81, 0x69, 0x33, 0x34, 0xB4, 0xC0, 0xC7, 0x77, 0xEF, 0x09, 0x40, 0x78, 0x44,
+  0x40, 0x4C, 0x03, 0xA1, 0xFA, 0xE8, 0x69, 0xC0, 0xC5, 0xEC, 0xED, 0x69, 0x04, 0xC0, 0xC6, 0x32,
+  0xAE, 0x40, 0x94, 0x86, 0x20, 0x48, 0x40, 0x2B, 0x2D, 0x24, 0x99, 0x20, 0x30, 0x21, 0x53, 0x06,
+  0x20, 0x20, 0x8A, 0xEB, 0x69, 0x81, 0xAE, 0x40, 0x77, 0x46, 0x40, 0x27, 0x7B, 0x40, 0x25, 0xB3,
+  0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xE5, 0x06, 0x40, 0xC5, 0xB7, 0xA0, 0x53, 0x69, 0x76, 0x65, 0xF2,
+  0x69, 0xC0, 0xB7, 0x58, 0xE3, 0x69, 0x02, 0x84, 0xE3, 0xC0, 0xC5, 0xB1, 0xAE, 0x40, 0xC4, 0x4E,
+  0x21, 0x93, 0x1E, 0x8C, 0xE2, 0x69, 0x81, 0xAE, 0x40, 0xC5, 0xF6, 0x8A, 0xE1, 0x69, 0x06, 0x40,
+  0xC4, 0xDB, 0xA0, 0x2A, 0xAE, 0xC0, 0xC5, 0xE7, 0xF6, 0x11, 0x06, 0x20, 0x31, 0x0D, 0x06, 0x1D,
+  0x15, 0x20, 0x9D, 0x40, 0xA1, 0x9F, 0x36, 0x1F, 0xAC, 0xF1, 0x75, 0x71, 0xE8, 0xC0, 0xC0, 0x1D,
+  0xF4, 0x69, 0x09, 0x04, 0x40, 0xA8, 0x1E, 0x3B, 0xA7, 0xA0, 0xFC, 0xE7, 0xC0, 0xC4, 0xEA, 0xAE,
+  0x05, 0x12, 0xC0, 0xB6, 0xCE, 0x6E, 0x61, 0x68, 0x74, 0xAD, 0x02, 0x86, 0x72, 0x65, 0xF4, 0xC0,
+  0x8E, 0x9B, 0x65, 0xF3, 0xC0, 0xBB, 0x20, 0x62, 0x65, 0x77, 0x2D, 0x65, 0x68, 0xF4, 0xC0, 0x91,
+  0x32, 0xF3, 0x69, 0x81, 0xAE, 0x40, 0xC3, 0x62, 0x20, 0x9F, 0x21, 0x78, 0x1E, 0x8C, 0xEF, 0x40,
+  0xC5, 0x6D, 0xA0, 0x2A, 0xED, 0x69, 0x81, 0xAE, 0x13, 0x40, 0x93, 0xBC, 0x20, 0x48, 0x40, 0x2B,
+  0x2D, 0x24, 0x60, 0x20, 0x69, 0x21, 0x53, 0x06, 0x20, 0x24, 0x86, 0xEF, 0x26, 0x0C, 0xC0, 0xBD,
+  0xFA, 0xEC, 0x69, 0x81, 0xAE, 0x25, 0x4B, 0x40, 0x50, 0x6B, 0x40, 0x49, 0xAC, 0x40, 0x24, 0x54,
+  0x21, 0x8D, 0x06, 0x1E, 0x06, 0x86, 0x65, 0xE4, 0x69, 0x81, 0xAE, 0x0E, 0x0C, 0x0A, 0x07, 0x0D,
+  0x0A, 0x06, 0x09, 0x05, 0x08, 0x10, 0x20, 0x22, 0x84, 0xF9, 0x04, 0xC0, 0xBA, 0xFC, 0x61, 0x77,
+  0x65, 0x74, 0x61, 0xE7, 0x62, 0x77, 0x65, 0x69, 0x76, 0x65, 0x72, 0xF0, 0xC0, 0x86, 0xA8, 0x76,
+  0xF2, 0x40, 0xB5, 0xE4, 0xAD, 0xBC, 0x74, 0x72, 0x65, 0x63, 0x6C, 0x61, 0x63, 0x6F, 0x6C, 0xAE,
+  0xC0, 0xAA, 0x29, 0xF3, 0x04, 0xC0, 0xB5, 0x3B, 0x72, 0xE5, 0xC0, 0x8F, 0x96, 0x70, 0x70, 0xE1,
+  0xC0, 0x8C, 0x3E, 0xEF, 0x04, 0xC0, 0x9B, 0xFF, 0xF4, 0xC0, 0x6C, 0xBE, 0xEC, 0x20, 0x34, 0xAA,
+  0x59, 0x68, 0x63, 0x65, 0x74, 0xE1, 0xC0, 0x79, 0x67, 0xE7, 0x04, 0xC0, 0xB8, 0xBF, 0x6E, 0x69,
+  0x67, 0x61, 0x74, 0x73, 0x2D, 0xEF, 0xC0, 0x9B, 0xE1, 0xE5, 0x06, 0x07, 0x0D, 0xC0, 0xAE, 0x76,
+  0x72, 0x61, 0x68, 0x62, 0x65, 0xF7, 0x62, 0x67, 0x61, 0x74, 0xF3, 0x04, 0xC0, 0x91, 0x14, 0xEC,
+  0x81, 0x63, 0xEC, 0x62, 0x64, 0x6F, 0x63, 0xEF, 0xC0, 0x96, 0xFD, 0xE1, 0xC0, 0x77, 0x96, 0xB2,
+  0xC0, 0xC4, 0xBA, 0xE3, 0x69, 0x81, 0xAE, 0x08, 0x26, 0x27, 0x40, 0xBE, 0x68, 0x1E, 0x8C, 0xF4,
+  0x40, 0xC3, 0x44, 0xA1, 0x53, 0xF5, 0x15, 0x06, 0x13, 0x21, 0x60, 0x21, 0x30, 0x0E, 0x20, 0x2D,
+  0x0F, 0x09, 0x20, 0xAA, 0x18, 0x20, 0x2F, 0x16, 0x11, 0xA0, 0x91, 0x79, 0x6B, 0xF5, 0xC0, 0x97,
+  0xE4, 0xF6, 0x69, 0x81, 0xAE, 0x40, 0x73, 0xCD, 0x40, 0x36, 0xBE, 0x2F, 0x55, 0x28, 0x6F, 0x20,
+  0x87, 0x21, 0x93, 0x9E, 0xF3, 0x69, 0x02, 0x8E, 0xF4, 0x04, 0xC0, 0x45, 0xBC, 0xE9, 0x04, 0xC0,
+  0x4D, 0xD2, 0xED, 0xC0, 0x4C, 0x9B, 0xAE, 0x12, 0x09, 0x0C, 0x14, 0x0D, 0x08, 0x20, 0x23, 0x0F,
+  0x20, 0x47, 0x15, 0x05, 0x14, 0x20, 0x8B, 0xA0, 0xD0, 0xFA, 0x03, 0xA1, 0x60, 0x65, 0xED, 0xC0,
+  0xC0, 0x60, 0x76, 0xEF, 0x04, 0xC0, 0xC4, 0x3E, 0x68, 0x73, 0xE1, 0xC0, 0x89, 0x15, 0xF4, 0x02,
+  0x8C, 0x6E, 0x65, 0xEB, 0x02, 0x84, 0xED, 0xC0, 0xA2, 0x1C, 0xE8, 0xA4, 0x11, 0x65, 0xEE, 0xC0,
+  0xBA, 0x24, 0xF2, 0x02, 0x83, 0xE9, 0xA1, 0x7B, 0x61, 0x64, 0x6F, 0xEE, 0xC0, 0x97, 0x6D, 0x6F,
+  0x76, 0x6F, 0x6E, 0xE1, 0xC0, 0xC0, 0x59, 0x6E, 0xE1, 0x03, 0x11, 0x89, 0x74, 0xF3, 0x03, 0xA1,
+  0xA0, 0x68, 0x6B, 0x61, 0x7A, 0x61, 0x6B, 0xAD, 0x40, 0x83, 0x1E, 0xB7, 0xD4, 0x6A, 0x69, 0x61,
+  0x62, 0x72, 0xE5, 0xC0, 0xAE, 0xC4, 0xE7, 0xC0, 0x4B, 0xCF, 0xEC, 0x02, 0x86, 0x79, 0x62, 0xED,
+  0xC0, 0xBF, 0x06, 0x6F, 0x63, 0xE1, 0xC0, 0x94, 0x32, 0xEB, 0x05, 0x20, 0x38, 0xA1, 0x60, 0xF3,
+  0x07, 0x07, 0x05, 0x1A, 0xC0, 0xC3, 0xB9, 0x76, 0x6F, 0x72, 0xEB, 0xC0, 0xC0, 0x85, 0x74, 0xE9,
+  0xC0, 0x75, 0x78, 0xEE, 0x02, 0x8E, 0xE9, 0x02, 0x84, 0xEE, 0xC0, 0x41, 0x40, 0x62, 0x75, 0x79,
+  0xF4, 0xC0, 0x72, 0x62, 0xE1, 0x04, 0xC0, 0x5D, 0xB3, 0xED, 0xC0, 0x41, 0x71, 0x6C, 0x65, 0x67,
+  0x6E, 0x61, 0x68, 0xEB, 0xC0, 0xBD, 0x84, 0x61, 0x6C, 0x68, 0x73, 0x79, 0xE7, 0xC0, 0x7A, 0x87,
+  0xE9, 0x05, 0x08, 0x04, 0xA1, 0x4E, 0x74, 0x74, 0x61, 0x69, 0xEC, 0xC0, 0x4F, 0xD1, 0xEF, 0xC0,
+  0x7C, 0x72, 0xE8, 0xBE, 0x7D, 0x67, 0xF5, 0xC0, 0x5B, 0x8F, 0x64, 0xE1, 0x02, 0x8A, 0x72, 0x67,
+  0x6F, 0x6E, 0x69, 0x6C, 0xE5, 0xC0, 0x4B, 0x01, 0x62, 0x61, 0xE7, 0xC0, 0x4B, 0x5F, 0xE1, 0x0C,
+  0x04, 0x04, 0x07, 0x20, 0x26, 0x05, 0x21, 0x1B, 0xC0, 0x85, 0xE3, 0xFA, 0xC0, 0x38, 0xC8, 0xF6,
+  0xC0, 0xA6, 0xF0, 0x72, 0x61, 0x68, 0xEB, 0xC0, 0xB8, 0xD3, 0xE9, 0x0B, 0x07, 0x08, 0x06, 0x21,
+  0x30, 0x06, 0x08, 0xC0, 0x80, 0x93, 0x7A, 0x61, 0x68, 0xEB, 0xC0, 0xC0, 0xF6, 0x73, 0x73, 0x61,
+  0x6B, 0xE1, 0xC0, 0xBF, 0xA9, 0x6E, 0x65, 0xED, 0xC0, 0xBD, 0x10, 0x6C, 0xE5, 0xC0, 0x93, 0x7B,
+  0x67, 0xF5, 0xC0, 0x93, 0x42, 0xE4, 0x02, 0x87, 0x6E, 0x61, 0x67, 0xE1, 0xC0, 0x93, 0x6C, 0x67,
+  0xEF, 0xC0, 0xBF, 0x00, 0xF2, 0x69, 0x09, 0x40, 0x75, 0x15, 0x40, 0x3C, 0x76, 0xB1, 0x30, 0xAE,
+  0x1B, 0x0E, 0x06, 0x06, 0x09, 0x12, 0x0A, 0x1E, 0x20, 0x24, 0x0A, 0x0F, 0x19, 0x09, 0x16, 0x08,
+  0x04, 0x04, 0x20, 0x22, 0x3E, 0x8E, 0x40, 0xA1, 0xB8, 0xA1, 0xA7, 0xFA, 0x81, 0x61, 0x6B, 0x76,
+  0x61, 0x6B, 0x69, 0x64, 0x61, 0xEC, 0xC0, 0xC1, 0x94, 0x79, 0x6E, 0xFA, 0xC0, 0xBD, 0xA8, 0x76,
+  0xEF, 0x40, 0xC2, 0xBB, 0x9A, 0xF5, 0x04, 0xC0, 0xC2, 0xB6, 0xB4, 0xC0, 0xC0, 0xF5, 0xF4, 0x09,
+  0x40, 0xB1, 0xC0, 0x2F, 0x9C, 0x21, 0x53, 0x8D, 0x69, 0x61, 0x73, 0x33, 0xB2, 0xC0, 0xB5, 0x0D,
+  0xF3, 0x04, 0xC0, 0xB7, 0x41, 0x69, 0xF4, 0xC0, 0xC2, 0x47, 0x72, 0xE9, 0x05, 0x08, 0xC0, 0xC2,
+  0x99, 0x6D, 0x69, 0x64, 0x61, 0xEC, 0xC0, 0xC1, 0x54, 0xE4, 0x04, 0xC0, 0x6F, 0xEA, 0x63, 0xED,
+  0x69, 0x81, 0x2E, 0x73, 0xF0, 0xC0, 0xC1, 0x45, 0x6F, 0x6E, 0x69, 0x6A, 0x79, 0xED, 0x69, 0x81,
+  0xAE, 0x03, 0x04, 0x89, 0x73, 0x70, 0xF6, 0x62, 0x6D, 0x75, 0x72, 0x74, 0x63, 0x65, 0x70, 0xF3,
+  0x62, 0x67, 0x6E, 0xE9, 0x03, 0xB0, 0xD4, 0x64, 0x6E, 0x61, 0xEC, 0x62, 0x6E, 0x61, 0x74, 0xF3,
+  0x81, 0x65, 0xE7, 0xC0, 0xBF, 0x68, 0x6C, 0xE9, 0x04, 0xC0, 0xC2, 0x6A, 0x61, 0x6D, 0x64, 0x6C,
+  0x63, 0xAE, 0xC0, 0x71, 0xF2, 0xEB, 0x02, 0x8F, 0xF3, 0x04, 0xC0, 0xC2, 0x59, 0x72, 0x6F, 0x67,
+  0x69, 0x74, 0x61, 0xF9, 0xC0, 0xC1, 0xF6, 0x69, 0x68, 0x63, 0xEC, 0xC0, 0xC0, 0x65, 0xE9, 0x81,
+  0x61, 0x6E, 0x61, 0xF4, 0xC0, 0x4C, 0x16, 0xE7, 0x06, 0x40, 0xAD, 0x35, 0xB5, 0x07, 0x6E, 0x69,
+  0x74, 0x73, 0x6F, 0x68, 0x75, 0x72, 0x67, 0x65, 0x72, 0xAE, 0xC0, 0x91, 0x5F, 0xE5, 0x03, 0xBF,
+  0xE2, 0xF2, 0xC0, 0xAE, 0xCD, 0x64, 0xF5, 0xB5, 0x72, 0xE2, 0xC0, 0xB1, 0x37, 0xE1, 0x02, 0x87,
+  0x79, 0x65, 0x67, 0xF9, 0xC0, 0x9A, 0x43, 0xE9, 0x03, 0x06, 0x88, 0x76, 0x6F, 0xE4, 0xC0, 0xB0,
+  0x1A, 0x72, 0x69, 0x6B, 0x68, 0xF3, 0xC0, 0xC1, 0x66, 0x6B, 0x79, 0xED, 0xC0, 0x92, 0x08, 0x33,
+  0xEB, 0xC0, 0xC1, 0x08, 0xEF, 0x02, 0x85, 0xF9, 0x69, 0xC0, 0xC1, 0xE7, 0x67, 0x67, 0xEE, 0xC0,
+  0xA7, 0x89, 0xEE, 0x69, 0x02, 0x86, 0x65, 0xED, 0x69, 0xC0, 0xBB, 0x30, 0xAE, 0x03, 0x09, 0x8C,
+  0x74, 0x65, 0x6E, 0x6B, 0x63, 0xE1, 0xC0, 0xC0, 0xB9, 0x65, 0x6E, 0xE9, 0x04, 0xC0, 0xC1, 0xC6,
+  0x65, 0xF3, 0xC0, 0xB6, 0x9B, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0x65, 0x73, 0xE9, 0xB8, 0x32, 0xED,
+  0x69, 0x81, 0xAE, 0x40, 0xBF, 0xF8, 0x0A, 0x21, 0x83, 0x20, 0x24, 0x02, 0x0A, 0x82, 0xEC, 0x69,
+  0x81, 0xAE, 0x40, 0xB3, 0xDE, 0xA8, 0x94, 0xE8, 0x69, 0x06, 0x23, 0xFE, 0xC0, 0xA9, 0xCD, 0xAE,
+  0x17, 0x07, 0x08, 0x0C, 0x11, 0x05, 0x1A, 0x09, 0x10, 0x05, 0x07, 0x14, 0x35, 0x23, 0x40, 0x85,
+  0x89, 0x31, 0x49, 0x28, 0x36, 0xAC, 0xD2, 0x7A, 0x73, 0x61, 0xE7, 0xC0, 0xB5, 0x2B, 0x78, 0xE5,
+  0x40, 0x96, 0x6C, 0xC0, 0x2A, 0xA7, 0xF4, 0x06, 0x40, 0xA5, 0x64, 0xBB, 0xE6, 0x72, 0xEF, 0xC0,
+  0xB0, 0x82, 0xF3, 0x07, 0x40, 0x7C, 0xEF, 0xC0, 0x3C, 0x4D, 0xE1, 0x04, 0xC0, 0x3B, 0xF0, 0xEB,
+  0xC0, 0xC0, 0x35, 0x72, 0xE1, 0xC0, 0xBC, 0x34, 0xEF, 0x08, 0x05, 0x07, 0x40, 0xBF, 0xC5, 0xA1,
+  0x6E, 0x6E, 0xE9, 0xC0, 0x80, 0x3D, 0x6C, 0x65, 0x76, 0xF9, 0xC0, 0x96, 0x25, 0x65, 0xE4, 0xC0,
+  0xBE, 0x34, 0x6E, 0x61, 0x6C, 0x74, 0x61, 0xE7, 0xC0, 0xBF, 0xBC, 0xED, 0x09, 0x40, 0x6A, 0x4E,
+  0x40, 0x43, 0xAE, 0xB3, 0x32, 0x61, 0x6C, 0xEB, 0xC0, 0xBF, 0x80, 0x69, 0xEC, 0xC0, 0xBC, 0x6C,
+  0x65, 0x64, 0x73, 0xFA, 0xC0, 0xC0, 0xD1, 0xE1, 0x05, 0x07, 0xC0, 0x75, 0x69, 0x6B, 0x69, 0x74,
+  0xEF, 0xC0, 0x9D, 0x42, 0x63, 0x69, 0x74, 0xEF, 0xC0, 0x9D, 0x3B, 0x30, 0x30, 0xB0, 0xC0, 0xAF,
+  0xDD, 0xE7, 0x69, 0x81, 0xAE, 0x0D, 0x40, 0xBB, 0xCC, 0x23, 0x5D, 0x20, 0x45, 0x21, 0x48, 0x06,
+  0xA0, 0x2A, 0xED, 0x40, 0x70, 0xB4, 0xC0, 0x50, 0x27, 0xE5, 0x69, 0x81, 0xAE, 0x0B, 0x0C, 0x0A,
+  0x05, 0x40, 0xAD, 0x33, 0x25, 0xA6, 0xAD, 0x3B, 0xF3, 0x04, 0xC0, 0x81, 0x89, 0x6E, 0xE4, 0x40,
+  0xAF, 0xE2, 0xAF, 0xA8, 0x6F, 0x64, 0x61, 0x67, 0x6F, 0x64, 0xAE, 0xC0, 0x8F, 0xEE, 0x65, 0xEE,
+  0xC0, 0x99, 0x02, 0x64, 0xE3, 0xC0, 0xC0, 0x39, 0xE4, 0x04, 0xC0, 0x54, 0x7C, 0xE5, 0x69, 0x81,
+  0x2E, 0x74, 0x69, 0x72, 0x2E, 0x73, 0x65, 0x67, 0x61, 0x70, 0xAD, 0xC0, 0xAF, 0xA7, 0xE3, 0x69,
+  0x04, 0xC0, 0xBF, 0x8C, 0xAE, 0x40, 0xBE, 0xD6, 0x20, 0x47, 0x21, 0x46, 0x06, 0x1E, 0x8C, 0xE1,
+  0x69, 0x04, 0xC0, 0xB5, 0x38, 0xAE, 0x15, 0x04, 0x0C, 0x20, 0x2A, 0x07, 0x04, 0x04, 0x19, 0x09,
+  0x04, 0x40, 0x36, 0x0C, 0x3A, 0x35, 0x40, 0x6E, 0x45, 0xA1, 0x78, 0xF7, 0xC0, 0xBF, 0xE0, 0x76,
+  0x6F, 0xE7, 0x69, 0x81, 0xAE, 0x20, 0x23, 0x14, 0x20, 0x2A, 0x84, 0x75, 0x64, 0xE5, 0x69, 0x81,
+  0xAE, 0x07, 0x0A, 0x06, 0x03, 0x11, 0xA0, 0x2E, 0x77, 0x73, 0xEE, 0x69, 0x81, 0x2E, 0xF3, 0xC0,
+  0xBE, 0x4E, 0xF4, 0x40, 0xBE, 0x92, 0xA1, 0xA1, 0xE4, 0xA0, 0x39, 0x63, 0xE9, 0x04, 0xC0, 0xBE,
+  0xD9, 0xEC, 0xC0, 0xB7, 0x79, 0xF4, 0x40, 0xBE, 0x7F, 0x21, 0x9F, 0x82, 0xF3, 0xC0, 0xAF, 0x70,
+  0xEE, 0xC0, 0xBF, 0x3A, 0x6D, 0x6F, 0xE3, 0x69, 0x81, 0xAE, 0x06, 0x40, 0xB2, 0x28, 0xA8, 0xBC,
+  0x73, 0x74, 0x65, 0x6C, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0xAE, 0xC0, 0xAB, 0x4E, 0xE4, 0x04, 0xC0,
+  0xBE, 0xFE, 0xEC, 0xC0, 0xBF, 0xAE, 0xE3, 0xC0, 0xBC, 0xFC, 0xE1, 0x40, 0xBD, 0xF1, 0xA1, 0xA7,
+  0xB2, 0x02, 0x8A, 0x79, 0x73, 0x73, 0x70, 0x2D, 0x2D, 0xEE, 0xC0, 0xC1, 0x05, 0x35, 0x74, 0x65,
+  0x39, 0x2D, 0x2D, 0xEE, 0xC0, 0xC0, 0xFB, 0xF4, 0x20, 0x24, 0x05, 0x07, 0x05, 0x20, 0x41, 0x20,
+  0xA8, 0x1E, 0x20, 0x24, 0x20, 0x31, 0x20, 0x49, 0x0D, 0x06, 0x0F, 0x28, 0x6E, 0x20, 0x3A, 0x14,
+  0x0A, 0x25, 0xD7, 0x06, 0x10, 0x04, 0x0C, 0x20, 0xA4, 0xC0, 0x5D, 0xD1, 0x7A, 0xF4, 0xC0, 0xB9,
+  0x22, 0xF9, 0x69, 0x81, 0xAE, 0xC0, 0xBF, 0xB3, 0x75, 0xEF, 0xC0, 0x4F, 0xB9, 0xF4, 0x69, 0x06,
+  0x0B, 0x05, 0xC0, 0xBF, 0x81, 0xEF, 0x69, 0x04, 0xC0, 0xAD, 0x25, 0x69, 0xF2, 0xC0, 0xA4, 0xF7,
+  0x61, 0xF9, 0xC0, 0xBE, 0xB4, 0xAE, 0x16, 0x05, 0x40, 0x8D, 0xB6, 0x20, 0x48, 0x40, 0x22, 0xD2,
+  0x28, 0x5B, 0x24, 0x5B, 0x05, 0x20, 0x69, 0x21, 0x53, 0x06, 0xA0, 0x2A, 0x73, 0xE2, 0xC0, 0xB3,
+  0x28, 0xEF, 0x06, 0x40, 0xBD, 0xFA, 0xA1, 0x6E, 0xF2, 0x40, 0xBD, 0x3A, 0xA1, 0xD7, 0xF3, 0x69,
+  0x09, 0x20, 0x4E, 0x0A, 0x07, 0x09, 0xC0, 0x7B, 0x4C, 0xEF, 0x02, 0x85, 0xF0, 0x69, 0xC0, 0x95,
+  0x54, 0xE8, 0x69, 0x81, 0xAE, 0x09, 0x06, 0x0D, 0x0D, 0x04, 0x0B, 0xC0, 0xB0, 0x9D, 0x76, 0x65,
+  0xE4, 0xC0, 0x87, 0x68, 0xF3, 0x04, 0xC0, 0xA8, 0x89, 0x73, 0x65, 0x63, 0x63, 0xE1, 0xC0, 0xBD,
+  0xF9, 0xEC, 0x02, 0x87, 0x72, 0x75, 0x70, 0xED, 0xC0, 0xBB, 0x39, 0xE5, 0xBE, 0x4F, 0xE6, 0xC0,
+  0x7B, 0x05, 0xE5, 0x04, 0xC0, 0xB8, 0x87, 0x74, 0x69, 0xF3, 0xC0, 0xA2, 0x07, 0x64, 0x75, 0x6F,
+  0x6C, 0xE3, 0x32, 0x6B, 0xC0, 0xAC, 0x4D, 0xE9, 0x69, 0x04, 0xC0, 0x7D, 0xF2, 0xF4, 0xC0, 0x95,
+  0xF9, 0xE5, 0x40, 0xB6, 0x6C, 0x28, 0x84, 0x88, 0xE1, 0x04, 0xC0, 0xBD, 0xD3, 0xE3, 0xC0, 0xBE,
+  0xEE, 0xAE, 0x0B, 0x0C, 0x14, 0x40, 0xBD, 0x0E, 0x21, 0x93, 0x1E, 0x06, 0x86, 0xEF, 0x06, 0x40,
+  0xAB, 0x0D, 0xB3, 0xCF, 0x64, 0xE1, 0xC0, 0xA4, 0x32, 0xE5, 0x05, 0x07, 0xC0, 0xB8, 0x95, 0x70,
+  0x69, 0x63, 0xEE, 0xC0, 0xB2, 0x05, 0x6D, 0x6F, 0x74, 0xEF, 0xC0, 0xBB, 0xFC, 0x61, 0x64, 0x61,
+  0x78, 0x69, 0xE1, 0xC0, 0x6F, 0xDA, 0xF2, 0x04, 0x0F, 0xB8, 0x78, 0x6F, 0xF0, 0x06, 0x40, 0xBD,
+  0x15, 0xA1, 0x3B, 0x70, 0x75, 0xF3, 0x69, 0xC0, 0xB8, 0x02, 0xE1, 0x69, 0x81, 0xED, 0x40, 0x92,
+  0x28, 0xC0, 0x2C, 0x1D, 0xF0, 0x69, 0x81, 0xAE, 0x0E, 0x04, 0x40, 0x6A, 0x7E, 0x40, 0x2B, 0xBC,
+  0x40, 0x28, 0x24, 0x06, 0x1E, 0x8C, 0xE5, 0xC0, 0xB5, 0x7F, 0x62, 0x65, 0x77, 0x61, 0x6E, 0x69,
+  0x67, 0x61, 0x70, 0x33, 0xB2, 0xC0, 0xB0, 0xC5, 0xEF, 0x0D, 0x0A, 0x07, 0x40, 0xB9, 0x71, 0x22,
+  0xEC, 0x21, 0x22, 0x20, 0xB6, 0x96, 0xF0, 0x04, 0xC0, 0xBE, 0x08, 0x65, 0xE4, 0xC0, 0xA9, 0xEC,
+  0x6F, 0x66, 0x65, 0xF2, 0xC0, 0xBD, 0xC8, 0x63, 0xF3, 0x69, 0x81, 0xAE, 0x04, 0xC0, 0xBE, 0x2E,
+  0x76, 0x6F, 0xE7, 0x69, 0x81, 0xAE, 0xC0, 0xA9, 0xD8, 0xEE, 0x07, 0x06, 0x0F, 0x1B, 0xC0, 0x8D,
+  0x40, 0x6F, 0x70, 0xF5, 0xC0, 0xBC, 0x40, 0xE9, 0x69, 0x06, 0x40, 0xB1, 0x22, 0xAD, 0x15, 0x6F,
+  0x70, 0x64, 0xEC, 0xC0, 0xBE, 0x07, 0xE5, 0x05, 0x40, 0xBE, 0x00, 0x9E, 0xED, 0x04, 0xC0, 0x4C,
+  0x9E, 0x65, 0x67, 0x61, 0x6E, 0x61, 0xED, 0x69, 0x81, 0x2E, 0x72, 0x65, 0x74, 0xF5, 0xC0, 0xB9,
+  0xE3, 0xE1, 0x06, 0x32, 0x15, 0xC0, 0x87, 0x45, 0x6D, 0x6F, 0x72, 0x6F, 0x63, 0x6B, 0xE9, 0xC0,
+  0x97, 0xC8, 0xED, 0x69, 0x81, 0xAE, 0x40, 0xAC, 0x57, 0x2F, 0xEE, 0x21, 0x93, 0xA0, 0x2A, 0xEC,
+  0x69, 0x28, 0x9D, 0xAD, 0xB0, 0x6A, 0x65, 0x33, 0x61, 0x33, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D,
+  0xEE, 0xC0, 0xBE, 0xFE, 0xE9, 0x69, 0x0B, 0x05, 0x40, 0xB2, 0xF5, 0x29, 0x3D, 0x20, 0x78, 0xA1,
+  0x26, 0x75, 0xF4, 0xC0, 0xBC, 0x61, 0xAE, 0x20, 0x23, 0x09, 0x20, 0x21, 0x0C, 0x09, 0x1C, 0x20,
+  0x40, 0x20, 0x22, 0x09, 0x21, 0x36, 0x20, 0x2C, 0x20, 0x21, 0x20, 0x58, 0x20, 0x92, 0x14, 0x20,
+  0xC3, 0x0F, 0x0F, 0x20, 0xEE, 0x40, 0xA5, 0xB2, 0xAF, 0x46, 0xFA, 0x40, 0xBC, 0x8A, 0x20, 0xC5,
+  0x20, 0x48, 0x8E, 0xF9, 0x05, 0x08, 0x04, 0xA7, 0xBB, 0x6E, 0x61, 0xE3, 0x81, 0xF3, 0xC0, 0xA1,
+  0x22, 0x6C, 0xE9, 0xA7, 0xAA, 0x65, 0x6C, 0x6C, 0x61, 0xF6, 0x02, 0x82, 0xAD, 0x81, 0x61, 0x74,
+  0xF3, 0xC0, 0x2A, 0x43, 0xF6, 0x40, 0xBC, 0x25, 0x20, 0xF9, 0x07, 0x20, 0x30, 0x20, 0x39, 0x82,
+  0xF5, 0x40, 0xBC, 0x88, 0x20, 0x91, 0x20, 0x36, 0x96, 0xF4, 0x0E, 0x05, 0x40, 0xBB, 0xFD, 0x20,
+  0x6F, 0x20, 0x91, 0x20, 0x48, 0x0E, 0x06, 0x8F, 0xEF, 0x69, 0xC0, 0xBD, 0x3F, 0x6E, 0x6F, 0x6D,
+  0x64, 0xE5, 0xC0, 0xB7, 0xF0, 0xF3, 0x0F, 0x13, 0x06, 0x40, 0xBB, 0xCC, 0x20, 0x56, 0x20, 0xA3,
+  0x20, 0x4F, 0x0E, 0x06, 0x8D, 0xEF, 0x04, 0xC0, 0xBD, 0x49, 0xF8, 0x04, 0xC0, 0x59, 0xBA, 0x6F,
+  0x62, 0x64, 0x61, 0x69, 0xEC, 0xC0, 0xBC, 0x2B, 0x65, 0x6C, 0xF0, 0xC0, 0xBB, 0x45, 0xE1, 0x04,
+  0xC0, 0xBD, 0x0F, 0x69, 0x73, 0x65, 0x6C, 0x67, 0xE9, 0x02, 0x82, 0xAD, 0x81, 0x61, 0x69, 0x6E,
+  0x6F, 0xE2, 0xC0, 0x80, 0x74, 0xF2, 0x15, 0x05, 0x40, 0x97, 0x98, 0x40, 0x21, 0xF6, 0x22, 0x0C,
+  0x20, 0x36, 0x20, 0xC3, 0x07, 0x20, 0x32, 0x20, 0x24, 0x0C, 0x87, 0xE2, 0x69, 0xC0, 0xBD, 0x08,
+  0xE1, 0x69, 0x40, 0xBC, 0x91, 0xA0, 0x63, 0xF0, 0x40, 0xBC, 0x6A, 0x20, 0x21, 0x20, 0x70, 0x82,
+  0xEF, 0x14, 0x0B, 0x20, 0x26, 0x11, 0x1F, 0x20, 0x5E, 0x16, 0x20, 0x2C, 0x08, 0x05, 0x05, 0x09,
+  0x40, 0xBA, 0xC8, 0xA0, 0x91, 0x7A, 0xFA, 0x04, 0xC0, 0x54, 0x10, 0x75, 0xF2, 0xC0, 0xBA, 0x73,
+  0xF4, 0x69, 0x05, 0x15, 0xC0, 0xBB, 0xF3, 0xEE, 0x04, 0xC0, 0x36, 0x18, 0xE5, 0x05, 0x06, 0xC0,
+  0xAF, 0xA9, 0x76, 0x65, 0xEE, 0xC0, 0x8F, 0x5B, 0xE7, 0xC0, 0x78, 0x28, 0xE5, 0x04, 0xC0, 0x60,
+  0x26, 0x73, 0xF3, 0xC0, 0xB7, 0x61, 0xF3, 0x69, 0x02, 0x87, 0x73, 0x61, 0x62, 0xEF, 0xC0, 0x94,
+  0x61, 0x69, 0x76, 0xE5, 0xC0, 0xAF, 0x8D, 0xF2, 0x69, 0x02, 0x84, 0xEF, 0xC0, 0xBB, 0xF9, 0xE1,
+  0x02, 0x86, 0x7A, 0x6E, 0xE1, 0xC0, 0xB3, 0xC9, 0x73, 0x65, 0xF0, 0x02, 0x82, 0xAD, 0x81, 0x6F,
+  0x6E, 0x69, 0xE2, 0xC0, 0xB9, 0xF7, 0xEE, 0x69, 0x05, 0x05, 0x0B, 0x1C, 0x8F, 0x75, 0xEC, 0xC0,
+  0x77, 0x6C, 0xF2, 0x02, 0x84, 0xEF, 0xC0, 0x77, 0x06, 0xE5, 0xC0, 0x76, 0xA8, 0xE9, 0x07, 0x06,
+  0x22, 0x88, 0xC0, 0x6F, 0x14, 0x6C, 0x6C, 0xE5, 0xC0, 0xBB, 0x83, 0x62, 0x72, 0xF5, 0x02, 0x82,
+  0xAD, 0x81, 0x6F, 0x72, 0x61, 0xF3, 0xC0, 0xBB, 0xE2, 0x65, 0x63, 0x69, 0xF0, 0x02, 0x82, 0xAD,
+  0x81, 0x69, 0x6C, 0x6F, 0xE3, 0xC0, 0xBB, 0x46, 0xE1, 0x07, 0x06, 0x22, 0x44, 0xC0, 0xB9, 0xD8,
+  0x74, 0x73, 0xE9, 0xC0, 0xBC, 0x27, 0x64, 0x69, 0x70, 0x6D, 0x61, 0xE3, 0x02, 0x82, 0xAD, 0x81,
+  0xEF, 0xC0, 0x70, 0x7C, 0xED, 0x69, 0x05, 0x08, 0xC0, 0xBB, 0xFB, 0x72, 0xE5, 0x40, 0x71, 0x94,
+  0xC0, 0x49, 0x4F, 0xE1, 0x40, 0x6E, 0x17, 0xC0, 0x49, 0xF4, 0xE9, 0x04, 0x04, 0x05, 0x8F, 0xFA,
+  0xC0, 0xBA, 0xD5, 0x72, 0xE4, 0xC0, 0x57, 0xE7, 0x70, 0x6D, 0x65, 0xF4, 0x02, 0x82, 0xAD, 0x81,
+  0x61, 0x69, 0x62, 0xEC, 0xC0, 0xBB, 0xE8, 0x64, 0x65, 0xED, 0x02, 0x82, 0xAD, 0x81, 0x6F, 0x6E,
+  0x61, 0x64, 0xE9, 0xC0, 0x93, 0x9C, 0xE7, 0x69, 0x81, 0x69, 0xF6, 0xC0, 0xB7, 0x96, 0x65, 0xEE,
+  0xC0, 0xBA, 0x31, 0xE3, 0x69, 0xC0, 0xB2, 0xA2, 0xE2, 0x69, 0x81, 0x72, 0x65, 0xF4, 0xC0, 0xB8,
+  0xB5, 0xE1, 0x69, 0xC0, 0xBA, 0x57, 0xEE, 0x0C, 0x05, 0x04, 0x0F, 0x40, 0xBB, 0x2F, 0x20, 0x48,
+  0x08, 0x06, 0x93, 0xED, 0x69, 0xC0, 0xBB, 0x45, 0xE9, 0xC0, 0x90, 0xA1, 0xE5, 0x69, 0x06, 0x20,
+  0x5F, 0xC0, 0xB9, 0xD7, 0x65, 0x6E, 0x2E, 0xE3, 0xC0, 0xB6, 0xA0, 0xE1, 0x69, 0x20, 0x5C, 0xC0,
+  0xBB, 0x29, 0xED, 0x0A, 0x40, 0xAB, 0x47, 0x2E, 0x52, 0x20, 0xBA, 0xA1, 0x1A, 0xE9, 0x69, 0x81,
+  0x74, 0x2E, 0x6E, 0x65, 0x70, 0x6F, 0x2E, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6C, 0x65, 0x6A, 0xAE,
+  0xC0, 0xBA, 0x27, 0xEC, 0x07, 0x20, 0x4B, 0x40, 0xBA, 0xFC, 0x8E, 0xEF, 0x04, 0xC0, 0xBB, 0x56,
+  0x72, 0x69, 0xF4, 0x04, 0x20, 0x29, 0x83, 0xE4, 0x02, 0x86, 0x75, 0xF3, 0x0C, 0x21, 0x75, 0x82,
+  0x65, 0x75, 0xF3, 0x69, 0x04, 0x21, 0x75, 0x82, 0xAD, 0x03, 0xA1, 0x71, 0xEE, 0x04, 0x06, 0xA1,
+  0x6A, 0xE5, 0x81, 0xFA, 0xC0, 0xBA, 0x37, 0xE1, 0x81, 0x73, 0xEC, 0x40, 0xB0, 0x9F, 0xA9, 0xF2,
+  0xAD, 0x02, 0x84, 0xF3, 0x21, 0x57, 0x82, 0xE4, 0x02, 0x82, 0xE5, 0x81, 0x75, 0xF3, 0x04, 0x21,
+  0x4B, 0x82, 0xAD, 0x21, 0x4A, 0x82, 0xE1, 0x69, 0xC0, 0xBB, 0x08, 0xE9, 0x14, 0x0C, 0x0A, 0x14,
+  0x20, 0x35, 0x40, 0x4F, 0xFF, 0x40, 0x69, 0x3C, 0x20, 0x36, 0x20, 0xCA, 0x20, 0x48, 0x0E, 0x86,
+  0xF4, 0x04, 0xC0, 0xBA, 0x06, 0x65, 0xE9, 0x40, 0xB7, 0x51, 0xA3, 0x92, 0xF3, 0x69, 0x81, 0x69,
+  0x64, 0x6E, 0xE9, 0xC0, 0xA7, 0xCA, 0xF2, 0x69, 0x81, 0xE1, 0x05, 0x05, 0xC0, 0xBA, 0xBE, 0x73,
+  0xF3, 0xC0, 0xB8, 0x05, 0x69, 0x6C, 0xE7, 0xC0, 0xB8, 0xEF, 0xEE, 0x05, 0x05, 0xC0, 0xB6, 0xCA,
+  0x69, 0xED, 0xC0, 0xB7, 0x3F, 0xE1, 0x03, 0xA0, 0x22, 0x72, 0xF4, 0x02, 0x8E, 0x61, 0x74, 0x74,
+  0x65, 0x6C, 0x72, 0x61, 0x62, 0x61, 0x69, 0xF2, 0xC0, 0xB0, 0x37, 0x2D, 0x61, 0x74, 0x74, 0x65,
+  0x6C, 0x72, 0x61, 0x62, 0x2D, 0x61, 0x69, 0xF2, 0xC0, 0xB0, 0x27, 0xF0, 0xC0, 0xAD, 0x93, 0xEC,
+  0x69, 0x03, 0x0F, 0x85, 0x72, 0x6F, 0xE6, 0x02, 0x82, 0xAD, 0x81, 0x61, 0x6E, 0x65, 0x73, 0xE5,
+  0xC0, 0xBA, 0x80, 0x6F, 0xF0, 0xC0, 0xB8, 0x9B, 0xEC, 0x81, 0xE5, 0xB9, 0xA8, 0xE7, 0x0F, 0x40,
+  0xB0, 0x4F, 0x27, 0x38, 0x21, 0xBC, 0x20, 0xCA, 0x20, 0x48, 0x08, 0x12, 0x89, 0xF6, 0xC0, 0xB9,
+  0x42, 0xE5, 0x15, 0x05, 0x20, 0x24, 0x0B, 0x1C, 0x05, 0x05, 0x20, 0x43, 0x40, 0xB8, 0x56, 0x20,
+  0x36, 0x20, 0x39, 0x20, 0x91, 0xA0, 0x50, 0x7A, 0xEE, 0xC0, 0xA9, 0x2A, 0xF4, 0x69, 0x02, 0x99,
+  0xF3, 0x02, 0x91, 0x6F, 0xE1, 0x69, 0x03, 0x02, 0x86, 0xE4, 0x87, 0xAD, 0x02, 0x83, 0x64, 0xAD,
+  0x81, 0xE5, 0xA2, 0x6B, 0x65, 0xE9, 0xC0, 0xAD, 0x2B, 0x6E, 0x6F, 0x6D, 0xE5, 0xC0, 0xB4, 0xC5,
+  0xF3, 0x02, 0x84, 0xE9, 0xC0, 0x54, 0xB2, 0xE5, 0xC0, 0x4E, 0x70, 0xEE, 0x02, 0x95, 0xEF, 0x02,
+  0x85, 0x74, 0xEF, 0xC0, 0xB6, 0xE8, 0xEE, 0x02, 0x85, 0x69, 0xF3, 0xC0, 0x9E, 0x30, 0x65, 0xE4,
+  0xC0, 0x77, 0x19, 0xE9, 0xC0, 0x30, 0xBF, 0xED, 0x69, 0xC0, 0xB5, 0xC8, 0x68, 0xE3, 0xC0, 0x9F,
+  0x56, 0xE7, 0x69, 0x03, 0xA0, 0x33, 0x69, 0x64, 0xE1, 0x03, 0x12, 0x8A, 0x6F, 0x74, 0x6C, 0xE1,
+  0x69, 0x02, 0x9A, 0x2D, 0x6F, 0xEE, 0x02, 0x99, 0xE1, 0x81, 0xFA, 0xC0, 0x9D, 0xD6, 0xAD, 0x02,
+  0x87, 0x6F, 0x74, 0x6C, 0xE1, 0x69, 0x05, 0x82, 0xE1, 0x02, 0x82, 0xAD, 0x81, 0xEF, 0x81, 0xEE,
+  0x81, 0xE9, 0x81, 0x74, 0x6E, 0xE5, 0xC0, 0xAC, 0xBB, 0x61, 0x70, 0x65, 0x6D, 0x6F, 0x68, 0x33,
+  0xB2, 0xC0, 0xAB, 0xF9, 0xE3, 0x69, 0x05, 0x05, 0xC0, 0xB0, 0x87, 0x6E, 0xE5, 0xC0, 0x78, 0x92,
+  0xE9, 0xC0, 0x5D, 0x26, 0xE4, 0x04, 0xC0, 0xB9, 0x41, 0xF5, 0x69, 0x81, 0x6F, 0x6C, 0x63, 0xEE,
+  0xC0, 0xA9, 0x9E, 0xE3, 0x40, 0xB7, 0x69, 0x20, 0xCD, 0x20, 0x36, 0x20, 0x39, 0x20, 0x91, 0x20,
+  0x50, 0x8C, 0xE2, 0x0B, 0x1C, 0x1F, 0x1C, 0x12, 0x05, 0x0C, 0x20, 0x26, 0x1A, 0x98, 0xFA, 0x02,
+  0x8C, 0x73, 0x2D, 0x6C, 0x6F, 0x72, 0x69, 0x74, 0x64, 0x73, 0xAD, 0xA0, 0xBA, 0x72, 0x2D, 0x6C,
+  0x6F, 0x72, 0x69, 0x74, 0x2D, 0x64, 0xF3, 0x13, 0xA0, 0x9B, 0xF6, 0x69, 0x02, 0x8F, 0x37, 0x2D,
+  0x6C, 0x6F, 0x72, 0x69, 0x74, 0x64, 0xF3, 0x03, 0xA0, 0x9B, 0xAD, 0xA0, 0x9C, 0x36, 0x2D, 0x6C,
+  0x6F, 0x72, 0x69, 0x74, 0x2D, 0x64, 0xF3, 0xA0, 0x90, 0x73, 0x6E, 0x2D, 0x6C, 0x6F, 0x72, 0x69,
+  0x74, 0x64, 0xF3, 0x03, 0xA0, 0x81, 0x2D, 0x6E, 0x61, 0x73, 0xEC, 0x02, 0x84, 0xF5, 0xC0, 0xB2,
+  0x0A, 0xE1, 0xC0, 0xB2, 0x06, 0x6F, 0x32, 0x2D, 0x6C, 0x6F, 0x72, 0x69, 0x74, 0x64, 0x73, 0x2D,
+  0x6E, 0x65, 0x7A, 0xEF, 0xC0, 0xB1, 0xF4, 0xED, 0x69, 0xC0, 0xB7, 0x05, 0x68, 0x65, 0x2D, 0x65,
+  0x74, 0x73, 0x6F, 0x61, 0x2D, 0xE4, 0xA0, 0x3A, 0xE3, 0x69, 0x02, 0x93, 0x6D, 0x2D, 0x6C, 0x72,
+  0x6F, 0x66, 0x2D, 0x61, 0x6E, 0x65, 0x73, 0x65, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0xBA, 0x03, 0x66,
+  0x2D, 0x61, 0x6E, 0x65, 0x73, 0x65, 0x63, 0x2D, 0x6C, 0x72, 0xEF, 0xC0, 0xB9, 0xE6, 0x62, 0x65,
+  0x2D, 0x65, 0x74, 0x73, 0x6F, 0xE1, 0x02, 0x88, 0x64, 0x65, 0x6C, 0x6C, 0xE1, 0xC0, 0xB3, 0x0D,
+  0x2D, 0x65, 0x6C, 0x6C, 0xE1, 0xC0, 0xB3, 0x05, 0x33, 0x63, 0x2D, 0x6C, 0x6F, 0x72, 0x69, 0x74,
+  0x2D, 0x64, 0x73, 0xAD, 0x81, 0xEF, 0x81, 0x6E, 0x69, 0x74, 0x6E, 0x65, 0xF2, 0xC0, 0xB8, 0xF3,
+  0xAD, 0x03, 0x04, 0x84, 0xB6, 0xC0, 0xAA, 0xE5, 0xB4, 0xC0, 0x9F, 0x33, 0xB2, 0xC0, 0x9F, 0x33,
+  0xE1, 0x1E, 0x20, 0x3B, 0x0F, 0x04, 0x20, 0x78, 0x20, 0x20, 0x20, 0x36, 0x04, 0x20, 0x5D, 0x06,
+  0x0F, 0x21, 0x2A, 0x04, 0x05, 0x20, 0x23, 0x0F, 0x40, 0xA4, 0xC7, 0x30, 0x5D, 0xA0, 0x48, 0x7A,
+  0xEE, 0x05, 0x11, 0xC0, 0xB7, 0x77, 0xE5, 0x07, 0x40, 0x74, 0x34, 0xC0, 0x27, 0x04, 0xE3, 0x04,
+  0xC0, 0xB5, 0x60, 0xE1, 0xC0, 0xB2, 0xFE, 0x61, 0x69, 0x72, 0xE2, 0x03, 0x08, 0x83, 0xE1, 0x02,
+  0x95, 0x6C, 0x6C, 0x65, 0xE4, 0x81, 0x65, 0xE1, 0x8E, 0x2D, 0xE1, 0x02, 0x89, 0x6C, 0x6C, 0x65,
+  0x64, 0x2D, 0x65, 0x2D, 0xE1, 0x81, 0xFA, 0xC0, 0x96, 0xD8, 0xF6, 0x69, 0x81, 0xEF, 0x07, 0x40,
+  0x6E, 0x14, 0xC0, 0x2F, 0xD6, 0xF4, 0xC0, 0x6F, 0x0E, 0xF5, 0xC0, 0x6E, 0x0F, 0xF4, 0x69, 0x05,
+  0x20, 0x44, 0x1A, 0x85, 0x74, 0xE5, 0x02, 0x8A, 0x73, 0x73, 0x69, 0x6E, 0x61, 0x74, 0xEC, 0xC0,
+  0xB6, 0x37, 0x6C, 0x72, 0x61, 0xE2, 0x03, 0x0B, 0x8A, 0x69, 0x6E, 0x61, 0x72, 0x74, 0x61, 0x69,
+  0xF2, 0xC0, 0xAD, 0x8E, 0x61, 0x69, 0x72, 0x64, 0x6E, 0x61, 0xE9, 0xC0, 0xA6, 0x01, 0xAD, 0x02,
+  0x8C, 0x69, 0x6E, 0x61, 0x72, 0x74, 0x2D, 0x61, 0x69, 0xF2, 0xC0, 0xAD, 0x75, 0x61, 0x69, 0x72,
+  0x64, 0x6E, 0x61, 0x2D, 0xE9, 0xC0, 0xA5, 0xE7, 0x73, 0x6F, 0xE1, 0x69, 0x03, 0x03, 0x8B, 0xAD,
+  0x02, 0x8B, 0xE4, 0x05, 0x05, 0xC0, 0x53, 0xD3, 0xAD, 0x04, 0xC0, 0x53, 0xD3, 0x65, 0xEC, 0xC0,
+  0x53, 0xD1, 0x72, 0xE5, 0xC0, 0x76, 0xBC, 0xE1, 0x02, 0x83, 0xF2, 0xB3, 0x92, 0x63, 0x69, 0x6C,
+  0x69, 0xF3, 0xC0, 0xB7, 0x1A, 0xF3, 0x69, 0x05, 0x0B, 0xC0, 0xB2, 0x3B, 0xF5, 0x04, 0xC0, 0x7C,
+  0xF2, 0x63, 0x61, 0xF2, 0xC0, 0xB5, 0x79, 0x73, 0x61, 0xED, 0x02, 0x82, 0xAD, 0x81, 0x61, 0x72,
+  0x61, 0xF2, 0xC0, 0x7A, 0xF4, 0xF2, 0x69, 0x03, 0x10, 0x84, 0x74, 0x73, 0x61, 0x69, 0x6C, 0x67,
+  0xEF, 0x69, 0x02, 0x82, 0xAD, 0x81, 0xEC, 0xC0, 0xB4, 0x67, 0xE5, 0xC0, 0x8E, 0x06, 0xE1, 0x05,
+  0x12, 0xC0, 0xA0, 0xFB, 0x72, 0xF2, 0x04, 0xC0, 0x9B, 0xDE, 0x61, 0xE3, 0x02, 0x82, 0xAD, 0x81,
+  0x61, 0x73, 0xF3, 0xC0, 0xAC, 0xE6, 0x63, 0xF3, 0xC0, 0xB7, 0x00, 0xEF, 0xC0, 0x9D, 0x13, 0xEE,
+  0x69, 0x06, 0x11, 0x06, 0x07, 0x1D, 0x94, 0xEF, 0x08, 0x04, 0x40, 0x7B, 0xF2, 0xC0, 0x20, 0x6C,
+  0xED, 0xC0, 0xAC, 0x6C, 0xE3, 0xC0, 0xAC, 0xCC, 0x6E, 0xE5, 0x69, 0xC0, 0xAB, 0xB9, 0xE9, 0x40,
+  0x7B, 0x50, 0xC0, 0x2D, 0xD6, 0xE7, 0x03, 0x04, 0x86, 0xEF, 0xC0, 0x9B, 0x27, 0x65, 0x64, 0xF2,
+  0xC0, 0xB4, 0x56, 0x61, 0x6D, 0x6F, 0xF2, 0x02, 0x82, 0xAD, 0x81, 0x61, 0x69, 0x6C, 0xE9, 0xC0,
+  0x91, 0xB9, 0xE5, 0x07, 0x40, 0x6D, 0x04, 0xC0, 0x47, 0xDF, 0x73, 0x65, 0xE3, 0x02, 0x82, 0xAD,
+  0x81, 0x69, 0xEC, 0xC0, 0xAC, 0xC3, 0x61, 0x63, 0xF3, 0xC0, 0xB6, 0xBC, 0xED, 0x40, 0xA1, 0x59,
+  0xB1, 0x6B, 0xEC, 0x02, 0x84, 0xEC, 0xC0, 0x8B, 0x95, 0x69, 0x75, 0x71, 0xE1, 0x69, 0xC0, 0xB5,
+  0xFB, 0xE9, 0x0E, 0x16, 0x04, 0x0F, 0x20, 0x60, 0x06, 0x20, 0x2D, 0x20, 0x39, 0x0B, 0x07, 0x86,
+  0xFA, 0x02, 0x84, 0xE9, 0xC0, 0x8A, 0xEE, 0xE5, 0x04, 0xC0, 0x5A, 0x4B, 0x70, 0xF3, 0x04, 0xC0,
+  0xB5, 0xA3, 0xAD, 0xC0, 0xB5, 0xA2, 0xF6, 0xC0, 0xAD, 0xF7, 0x74, 0x6E, 0x65, 0x6C, 0x61, 0xF6,
+  0x02, 0x82, 0xAD, 0x81, 0x6F, 0xE2, 0xC0, 0xB3, 0xAD, 0xF2, 0x07, 0x05, 0x20, 0x46, 0xC0, 0x7E,
+  0x78, 0x75, 0xE7, 0xC0, 0xAC, 0x89, 0x64, 0x6E, 0xE1, 0x04, 0x06, 0x0E, 0x8C, 0x73, 0x73, 0xE5,
+  0xC0, 0xB6, 0x5D, 0x69, 0x6E, 0x61, 0x72, 0x74, 0x61, 0x74, 0x74, 0x65, 0x6C, 0xF2, 0xC0, 0xB5,
+  0xEE, 0x61, 0x74, 0x74, 0x65, 0x6C, 0x72, 0x61, 0x62, 0xE9, 0xC0, 0xA4, 0x82, 0xAD, 0x02, 0x8F,
+  0x69, 0x6E, 0x61, 0x72, 0x74, 0x2D, 0x61, 0x74, 0x74, 0x65, 0x6C, 0xF2, 0xC0, 0xB5, 0xD0, 0x61,
+  0x74, 0x74, 0x65, 0x6C, 0x72, 0x61, 0x62, 0x2D, 0xE9, 0xC0, 0xA4, 0x63, 0xE2, 0x04, 0xC0, 0x87,
+  0xF4, 0x61, 0x6C, 0x61, 0xE3, 0x69, 0x20, 0x5F, 0x82, 0x6F, 0x74, 0xF3, 0xC0, 0xB0, 0xE6, 0xEE,
+  0x06, 0x13, 0x06, 0xC0, 0xA6, 0xD4, 0x6F, 0x62, 0x72, 0x61, 0xE3, 0x02, 0x82, 0xAD, 0x81, 0x73,
+  0x61, 0x69, 0x73, 0x65, 0x6C, 0xE7, 0xC0, 0xB5, 0x2A, 0x69, 0x64, 0xF2, 0xC0, 0xB3, 0x5A, 0xE1,
+  0x08, 0x40, 0x71, 0xD8, 0x3C, 0x0F, 0xBF, 0x7F, 0xE2, 0xC0, 0x9B, 0x39, 0xEC, 0x03, 0x1E, 0x93,
+  0x75, 0x69, 0xE7, 0x04, 0x04, 0x06, 0x82, 0xAD, 0x03, 0x06, 0x82, 0x61, 0x69, 0x7A, 0x65, 0xEE,
+  0x81, 0xE5, 0x81, 0xF6, 0x02, 0x82, 0xAD, 0x81, 0x69, 0x6C, 0xF5, 0xC0, 0x70, 0x36, 0xE9, 0x02,
+  0x8C, 0x6D, 0xE5, 0x02, 0x82, 0xAD, 0x81, 0x6F, 0x69, 0xE7, 0xC0, 0x90, 0x6D, 0xE3, 0xC0, 0xB3,
+  0xBF, 0xE7, 0xC0, 0xB3, 0x02, 0xE7, 0x02, 0x84, 0xF5, 0xC0, 0xAA, 0x78, 0xE7, 0xC0, 0xAB, 0x9B,
+  0x64, 0x72, 0x61, 0xE2, 0xC0, 0x8A, 0x4C, 0x63, 0x73, 0xE5, 0xC0, 0xA2, 0xB3, 0x62, 0x6C, 0xEF,
+  0x02, 0x82, 0xAD, 0x81, 0x6F, 0x69, 0x70, 0xED, 0xC0, 0xB1, 0xC9, 0xE4, 0xC0, 0xB4, 0x5E, 0xE3,
+  0x69, 0xC0, 0x71, 0x6F, 0xB8, 0x02, 0x92, 0x69, 0x2D, 0x6C, 0x72, 0x6F, 0x66, 0x61, 0x6E, 0x65,
+  0x73, 0x65, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0xB6, 0xB9, 0x63, 0x2D, 0x61, 0x6E, 0x65, 0x73, 0x65,
+  0x63, 0x6C, 0x72, 0xEF, 0xC0, 0xB6, 0x9D, 0x37, 0x65, 0x2D, 0x65, 0x74, 0x73, 0x6F, 0x61, 0x65,
+  0x6C, 0x6C, 0xE1, 0xC0, 0xAF, 0xC7, 0x32, 0x6E, 0x2D, 0x6C, 0x6F, 0x72, 0x69, 0x74, 0xE4, 0xC0,
+  0xAE, 0x29, 0xE8, 0x69, 0x81, 0xAE, 0x0F, 0x0D, 0x07, 0x0D, 0x40, 0x92, 0xCA, 0x2A, 0x2D, 0x35,
+  0x62, 0x22, 0xBF, 0xA0, 0x2A, 0xF4, 0x06, 0x40, 0xAF, 0x2C, 0xA6, 0x1C, 0xEC, 0x81, 0xF5, 0xC0,
+  0x8D, 0x88, 0x70, 0xEF, 0x40, 0xB4, 0x3B, 0xA1, 0x0F, 0xEF, 0x06, 0x40, 0xB3, 0xD2, 0xA0, 0xBF,
+  0xF3, 0x40, 0xA9, 0xE0, 0xAA, 0x7A, 0xEC, 0x40, 0xB1, 0xE9, 0xA1, 0xB8, 0xE7, 0x69, 0x81, 0xAE,
+  0x40, 0x8D, 0xC8, 0x2D, 0x68, 0x36, 0xF0, 0x20, 0xD7, 0x20, 0x84, 0x21, 0x7A, 0x19, 0x1E, 0x86,
+  0xE6, 0x04, 0xC0, 0xA4, 0x2F, 0x6F, 0xF3, 0xC0, 0x43, 0xCD, 0xE5, 0x69, 0x13, 0x05, 0x25, 0xA4,
+  0x0A, 0x40, 0x82, 0xBD, 0x40, 0x20, 0xAC, 0x29, 0xA9, 0x20, 0xE6, 0x21, 0x00, 0xA0, 0x48, 0x74,
+  0xE3, 0xC0, 0xAF, 0xA1, 0xEE, 0x69, 0x81, 0xAE, 0x20, 0x29, 0x0E, 0x20, 0x61, 0x20, 0x34, 0x17,
+  0x14, 0x20, 0xA0, 0x20, 0xB0, 0x20, 0x29, 0x20, 0x4A, 0x13, 0x20, 0x35, 0x11, 0x1E, 0x10, 0x17,
+  0x20, 0x53, 0x16, 0x20, 0xC9, 0x20, 0x80, 0x06, 0x20, 0x34, 0x19, 0x1E, 0x0D, 0x05, 0x04, 0x05,
+  0x85, 0xFA, 0x02, 0x87, 0x74, 0x69, 0x72, 0xE6, 0xC0, 0xB4, 0x56, 0xE1, 0xC0, 0x98, 0xEC, 0xF9,
+  0x0A, 0x0C, 0x20, 0x29, 0x1D, 0x22, 0xF7, 0xC0, 0xB0, 0xD6, 0xEE, 0x04, 0xC0, 0x98, 0xD9, 0x6F,
+  0x66, 0x69, 0xF0, 0xC0, 0xB3, 0xAD, 0x6C, 0x74, 0x73, 0x61, 0x66, 0xAE, 0x05, 0x06, 0x0A, 0xA4,
+  0xEC, 0x73, 0x6C, 0xF4, 0xC0, 0x97, 0x8D, 0x6C, 0x73, 0x73, 0xAE, 0x0F, 0x40, 0xB4, 0x78, 0xA0,
+  0x23, 0x64, 0x6F, 0x72, 0x70, 0xAE, 0x04, 0xC0, 0xB4, 0x9B, 0x6C, 0xE1, 0xC0, 0x8B, 0xD7, 0x66,
+  0x66, 0x69, 0x6A, 0x64, 0x75, 0x6F, 0x6C, 0xE3, 0x69, 0x81, 0xAE, 0x02, 0x87, 0x73, 0x75, 0x2D,
+  0xB1, 0xC0, 0x6B, 0xF0, 0x65, 0x64, 0x2D, 0x31, 0xE1, 0xC0, 0xB3, 0x45, 0xE1, 0xC0, 0x74, 0x90,
+  0xF8, 0x07, 0x20, 0x27, 0x40, 0x95, 0x23, 0x86, 0x74, 0x73, 0x61, 0x6C, 0x65, 0xAE, 0x03, 0x0A,
+  0x8A, 0x33, 0x6F, 0x74, 0x73, 0x2D, 0x73, 0xEC, 0xC0, 0xAF, 0x60, 0x32, 0x6F, 0x74, 0x73, 0x2D,
+  0x73, 0xEC, 0xC0, 0xAF, 0x56, 0x31, 0x6F, 0x74, 0x73, 0x2D, 0x73, 0xEC, 0xC0, 0xAF, 0x4C, 0x73,
+  0xF0, 0xC0, 0xB3, 0xBD, 0x76, 0x65, 0x64, 0x2D, 0x6E, 0x61, 0x69, 0x73, 0x73, 0x61, 0x6C, 0x74,
+  0x61, 0x2E, 0x64, 0x6F, 0x72, 0x70, 0x2E, 0xEE, 0xC0, 0x95, 0x98, 0xF5, 0x06, 0x40, 0xA5, 0x38,
+  0xAD, 0xFC, 0xF2, 0x69, 0x81, 0x65, 0x61, 0x6B, 0x75, 0x73, 0x74, 0xAE, 0xC0, 0x83, 0x3D, 0xF4,
+  0x09, 0x20, 0x30, 0x09, 0x10, 0x10, 0x0B, 0x11, 0x9C, 0xF3, 0x03, 0xA0, 0x25, 0x6F, 0xE8, 0x02,
+  0x85, 0x67, 0xEE, 0xC0, 0xB0, 0x89, 0x2D, 0x73, 0x70, 0xF6, 0x69, 0x81, 0x2E, 0x63, 0x69, 0x74,
+  0x73, 0x61, 0x6C, 0x65, 0x6A, 0xAE, 0x07, 0x40, 0x71, 0xB4, 0xC0, 0x21, 0x14, 0x73, 0xEA, 0xC0,
+  0xB3, 0xC7, 0x69, 0x78, 0x65, 0xF4, 0xC0, 0xB0, 0x0F, 0x72, 0x30, 0x70, 0x33, 0x6C, 0xB3, 0xC0,
+  0xB3, 0xD4, 0xEE, 0x02, 0x86, 0x6F, 0x72, 0xE6, 0xC0, 0xB2, 0x7F, 0x65, 0x73, 0x73, 0xE9, 0xC0,
+  0x9F, 0xFC, 0x69, 0xAD, 0x02, 0x88, 0xF3, 0x40, 0x7A, 0xEE, 0x3A, 0x6B, 0xA9, 0x3F, 0xE5, 0xC0,
+  0x42, 0xAB, 0x66, 0x61, 0x72, 0x63, 0x65, 0x6E, 0x69, 0xED, 0xC0, 0x97, 0xBB, 0xE5, 0x02, 0x85,
+  0x73, 0xED, 0xC0, 0xB1, 0x52, 0x6E, 0x72, 0x65, 0x74, 0x6E, 0xE9, 0xC0, 0x95, 0x58, 0x63, 0xE5,
+  0x03, 0x06, 0x8B, 0x6C, 0x65, 0xF3, 0xC0, 0x9E, 0x7A, 0x6A, 0x6F, 0x72, 0x70, 0x72, 0x6F, 0xF4,
+  0x69, 0xC0, 0xA3, 0x8F, 0x66, 0x66, 0xE5, 0xC0, 0xB2, 0xF7, 0x61, 0xE4, 0xC0, 0x2F, 0xC9, 0xF3,
+  0x0E, 0x14, 0x20, 0x3D, 0x1A, 0x13, 0x40, 0x77, 0xB8, 0x19, 0x3D, 0x9D, 0xBD, 0x79, 0xF3, 0x04,
+  0xC0, 0x95, 0x76, 0x65, 0x63, 0x63, 0xE1, 0x04, 0xC0, 0xB2, 0x0C, 0x2D, 0x63, 0x69, 0xF4, 0xC0,
+  0xB2, 0x6C, 0x70, 0x70, 0x61, 0x63, 0x69, 0x74, 0x61, 0x74, 0x73, 0x65, 0x72, 0x75, 0x7A, 0xE1,
+  0x69, 0x81, 0xAE, 0x07, 0x08, 0x09, 0x07, 0xC0, 0xA5, 0x58, 0x73, 0x75, 0x6C, 0x61, 0x72, 0xF4,
+  0xAD, 0xB9, 0x65, 0x70, 0x6F, 0x72, 0x75, 0xE5, 0xC0, 0x6A, 0x99, 0x61, 0x69, 0x73, 0xE1, 0xC0,
+  0x72, 0x27, 0xB2, 0x69, 0x81, 0x73, 0x75, 0x74, 0xF3, 0x40, 0x72, 0x20, 0xC0, 0x3B, 0xD7, 0xEE,
+  0x02, 0x8A, 0x6F, 0x69, 0x74, 0x63, 0x6E, 0x75, 0xE6, 0xC0, 0xB1, 0xBE, 0xE4, 0x40, 0x36, 0x9B,
+  0x2A, 0x07, 0x40, 0x54, 0xAC, 0x3B, 0xA9, 0xA1, 0xE8, 0xEB, 0x02, 0x87, 0x65, 0x6B, 0x6F, 0xEB,
+  0xC0, 0xB0, 0xF1, 0x63, 0x61, 0x74, 0x73, 0x74, 0xF3, 0xC0, 0xAA, 0xF5, 0xE5, 0x03, 0x10, 0x87,
+  0xF4, 0x04, 0xC0, 0xA2, 0xD9, 0x69, 0x73, 0x62, 0x65, 0x77, 0x65, 0x72, 0xF5, 0xC0, 0x9D, 0x8A,
+  0x73, 0x75, 0x6F, 0x68, 0xF3, 0xB5, 0x56, 0x67, 0x64, 0x65, 0x2D, 0xEE, 0xC0, 0x94, 0x34, 0xF2,
+  0x02, 0x90, 0x76, 0x64, 0x73, 0x6C, 0x65, 0x6E, 0x6E, 0x61, 0x68, 0xE3, 0x69, 0x81, 0xAE, 0xC0,
+  0xB0, 0x9F, 0xE5, 0x02, 0x8A, 0x76, 0x72, 0x65, 0x73, 0x2D, 0x78, 0xEE, 0xC0, 0xAF, 0x32, 0x74,
+  0x73, 0x75, 0x6C, 0x63, 0xF9, 0xC0, 0xB1, 0x52, 0xF0, 0x0A, 0x05, 0x07, 0x13, 0x0C, 0x40, 0xA1,
+  0xF6, 0xAB, 0x74, 0x74, 0xE6, 0xC0, 0x95, 0x5D, 0x70, 0xE1, 0x40, 0x9F, 0x0E, 0xB2, 0x2F, 0xEF,
+  0x02, 0x86, 0xE8, 0x40, 0xAD, 0x5B, 0xA4, 0x97, 0x2D, 0x6F, 0x69, 0x64, 0x61, 0x72, 0xAD, 0xC0,
+  0x93, 0x1E, 0x6D, 0x61, 0x63, 0x2D, 0x64, 0x6E, 0x61, 0x62, 0xAD, 0xC0, 0xAF, 0x4D, 0xE9, 0x08,
+  0x40, 0x78, 0xF3, 0x3C, 0x50, 0xA8, 0x8F, 0xAD, 0x04, 0xC0, 0xB1, 0xD9, 0x65, 0x74, 0xF3, 0xC0,
+  0x96, 0xB9, 0xEF, 0x09, 0x05, 0x40, 0x79, 0xA5, 0x3B, 0x90, 0xAC, 0xD7, 0x64, 0xF5, 0xC0, 0x9F,
+  0x46, 0xE3, 0xC0, 0x96, 0x56, 0xEE, 0x06, 0x04, 0x0C, 0xC0, 0x95, 0x24, 0xE9, 0x69, 0xA0, 0xBD,
+  0x64, 0x63, 0x64, 0x75, 0x61, 0x62, 0x6B, 0x63, 0xE1, 0xC0, 0xB2, 0x07, 0xE1, 0x02, 0x8E, 0xE9,
+  0x02, 0x87, 0x6C, 0x6C, 0x65, 0xF2, 0xC0, 0xAE, 0xA8, 0xE2, 0xC0, 0xAE, 0xF6, 0xE6, 0x02, 0x85,
+  0x6C, 0xE8, 0xC0, 0xB1, 0xF4, 0x61, 0xE7, 0xC0, 0xB1, 0xA3, 0xED, 0x02, 0x87, 0x75, 0x72, 0x6F,
+  0xE6, 0xC0, 0xA1, 0x52, 0x61, 0xE3, 0x40, 0x70, 0xE8, 0xBD, 0xE4, 0xEC, 0x06, 0x0D, 0x06, 0xC0,
+  0xA9, 0xCB, 0xF3, 0x04, 0xC0, 0xA2, 0x42, 0x73, 0x2D, 0x37, 0x37, 0xEE, 0xC0, 0x93, 0x54, 0x6D,
+  0x65, 0xF4, 0xC0, 0x9C, 0xEA, 0xE1, 0xC0, 0x7A, 0xDF, 0xEB, 0x06, 0x40, 0x95, 0x53, 0xBA, 0x6B,
+  0x63, 0x61, 0x74, 0x73, 0x76, 0xE1, 0xC0, 0xB1, 0x52, 0x68, 0x76, 0x6F, 0xAE, 0x02, 0x88, 0x73,
+  0x61, 0x61, 0x70, 0x62, 0x65, 0xF7, 0x62, 0x67, 0x6E, 0xE9, 0x81, 0x74, 0x73, 0x6F, 0xE8, 0x62,
+  0xE7, 0x02, 0x85, 0x6F, 0xEC, 0xC0, 0x94, 0x2D, 0x6E, 0xE9, 0x04, 0x0A, 0x08, 0x86, 0x74, 0x73,
+  0x6F, 0x68, 0x6E, 0x6E, 0xF9, 0xC0, 0xA7, 0x45, 0x73, 0x69, 0x72, 0x6B, 0xE3, 0xC0, 0xA8, 0xC4,
+  0x72, 0x65, 0x65, 0xF3, 0xAF, 0xC3, 0x67, 0x61, 0x74, 0x73, 0xAD, 0x06, 0x07, 0x09, 0x0B, 0xA1,
+  0x66, 0xF9, 0x81, 0x65, 0xEB, 0xC0, 0x9E, 0x03, 0x6E, 0xE9, 0x81, 0x67, 0x69, 0x72, 0xEF, 0xA1,
+  0x73, 0xE5, 0x02, 0x84, 0x74, 0xE9, 0xA0, 0x3C, 0x67, 0xE4, 0xA0, 0xC1, 0xE4, 0x03, 0xA1, 0x59,
+  0xE5, 0xA1, 0x5F, 0xE6, 0x05, 0x08, 0xC0, 0x94, 0xE8, 0x63, 0x72, 0x73, 0xAE, 0x2C, 0x33, 0xBB,
+  0x09, 0x61, 0x65, 0x6C, 0x65, 0xF4, 0xC0, 0xAF, 0x17, 0xE5, 0x0C, 0x08, 0x15, 0x05, 0x08, 0x0C,
+  0x20, 0x28, 0x20, 0x21, 0x0C, 0x8D, 0x7A, 0x61, 0xED, 0x40, 0x76, 0x97, 0xA5, 0x55, 0x74, 0xE9,
+  0x02, 0x85, 0x75, 0xF3, 0xC0, 0x9D, 0xB4, 0x73, 0x2D, 0x72, 0x65, 0x70, 0x70, 0x61, 0x72, 0xE3,
+  0xC0, 0xB0, 0xB3, 0xF3, 0x69, 0xC0, 0x5F, 0x30, 0x72, 0x65, 0x68, 0x75, 0xF2, 0xC0, 0x9B, 0xE4,
+  0xEE, 0x04, 0xC0, 0x95, 0x0B, 0x69, 0x6C, 0x6E, 0xEF, 0xC0, 0x7C, 0x55, 0xED, 0x04, 0x08, 0x07,
+  0x8D, 0x74, 0x63, 0x65, 0x72, 0xE9, 0xC0, 0xAF, 0x50, 0x6F, 0x68, 0x74, 0xE1, 0xC0, 0xA2, 0x0D,
+  0x69, 0x74, 0x6E, 0x75, 0x72, 0x6F, 0x69, 0x65, 0x62, 0xEF, 0xC0, 0x89, 0x0D, 0x65, 0x63, 0x6E,
+  0xF5, 0xC0, 0xAF, 0xDA, 0xEC, 0x02, 0x8B, 0x69, 0x62, 0x6F, 0x6D, 0x2D, 0x65, 0x72, 0xF5, 0xC0,
+  0x9B, 0x88, 0x61, 0x63, 0xF3, 0x02, 0x85, 0x6E, 0xEF, 0xC0, 0xAF, 0xD5, 0x6C, 0x69, 0x61, 0x74,
+  0x2E, 0xE1, 0xC0, 0x79, 0x98, 0x68, 0x74, 0x2D, 0x6E, 0x6F, 0x2D, 0x65, 0x63, 0xE9, 0xC0, 0xA8,
+  0x37, 0x67, 0xE4, 0x02, 0x86, 0x69, 0x72, 0xE2, 0xC0, 0x57, 0x92, 0xE5, 0xA0, 0xA6, 0xE3, 0x02,
+  0x8C, 0x72, 0x6F, 0x66, 0x65, 0x6C, 0x61, 0x63, 0x73, 0xAE, 0xC0, 0xAB, 0x9E, 0x6E, 0x61, 0x72,
+  0x75, 0x73, 0x6E, 0x69, 0x68, 0x74, 0x6C, 0x61, 0x65, 0x68, 0x65, 0x7A, 0x69, 0x74, 0xE1, 0xC0,
+  0xA3, 0xA7, 0xE4, 0x07, 0x20, 0x3D, 0x0B, 0x20, 0x27, 0x82, 0x75, 0x6F, 0x6C, 0xE3, 0x03, 0x17,
+  0x96, 0x78, 0x65, 0x64, 0x6E, 0x61, 0xF9, 0x69, 0x81, 0x2E, 0xE5, 0x02, 0x86, 0x74, 0x69, 0xF3,
+  0xC0, 0xAB, 0x3E, 0x67, 0xE1, 0xC0, 0xAA, 0x16, 0x6E, 0x69, 0x65, 0x76, 0x61, 0x73, 0x2E, 0xE3,
+  0x04, 0xC0, 0x7F, 0x77, 0x64, 0x69, 0x2D, 0x65, 0x74, 0x73, 0xE5, 0xC0, 0x51, 0x0D, 0x6D, 0x65,
+  0x61, 0x65, 0x62, 0xEF, 0xC0, 0x88, 0x63, 0x6E, 0x61, 0x62, 0x2D, 0x65, 0x68, 0x74, 0xAD, 0xC0,
+  0xAE, 0xB5, 0x69, 0x72, 0x67, 0x65, 0x76, 0x69, 0x73, 0x73, 0x61, 0x6D, 0x2E, 0x73, 0x61, 0x61,
+  0x70, 0xAE, 0x02, 0x87, 0x32, 0xAD, 0x40, 0x87, 0x25, 0xBF, 0x97, 0x31, 0xAD, 0x08, 0x40, 0x87,
+  0x16, 0x3F, 0x97, 0xA8, 0x2C, 0xE7, 0xC0, 0xAF, 0x9D, 0xE8, 0x88, 0xE5, 0x04, 0xC0, 0xA0, 0xC1,
+  0xFA, 0x81, 0x69, 0x61, 0xED, 0xC0, 0x33, 0x93, 0xE3, 0x02, 0x89, 0x70, 0x61, 0x69, 0x64, 0x65,
+  0xED, 0xC0, 0xAF, 0x6D, 0xE9, 0x03, 0x0D, 0x8D, 0x74, 0x61, 0x74, 0x73, 0x2D, 0x6F, 0x69, 0x65,
+  0x62, 0xEF, 0xC0, 0x88, 0x05, 0x6E, 0x61, 0x67, 0x72, 0x6F, 0x2D, 0x67, 0x6E, 0x69, 0xF4, 0xC0,
+  0x6E, 0xDA, 0x6D, 0x6F, 0x6E, 0x6F, 0x74, 0x70, 0x79, 0x72, 0xE3, 0x62, 0xE2, 0x05, 0x0F, 0xC0,
+  0xAF, 0x7B, 0x6C, 0x79, 0x6C, 0x74, 0x73, 0x61, 0xE6, 0x69, 0x81, 0xAE, 0x81, 0xF0, 0xC0, 0xA5,
+  0x2B, 0xE2, 0xC0, 0x99, 0xCB, 0xE1, 0x0A, 0x0A, 0x40, 0x58, 0x7B, 0x40, 0x3B, 0xCF, 0xB8, 0x90,
+  0x74, 0x61, 0x64, 0x73, 0x79, 0x61, 0xF7, 0xC0, 0xAF, 0x56, 0xEC, 0x04, 0xC0, 0x93, 0xA9, 0xED,
+  0xC0, 0x88, 0xC9, 0xB7, 0x04, 0xC0, 0xA0, 0x8D, 0x37, 0x6E, 0x64, 0x63, 0xAE, 0xC0, 0xAF, 0x6D,
+  0x36, 0xF6, 0xC0, 0xA0, 0x98, 0xB5, 0xC0, 0x8A, 0xAD, 0x32, 0xF2, 0xC0, 0xAE, 0xD1, 0x31, 0xF2,
+  0xC0, 0xAE, 0xCC, 0x30, 0xF2, 0xC0, 0xAE, 0xC7, 0xEB, 0x04, 0xC0, 0x94, 0xB7, 0x63, 0xE9, 0xC0,
+  0xAC, 0x2C, 0xAE, 0x40, 0xA9, 0x09, 0x24, 0x60, 0x20, 0x2F, 0x20, 0x45, 0x21, 0x48, 0x06, 0x1E,
+  0x8C, 0x64, 0x69, 0xED, 0xC0, 0xAD, 0x4F, 0xE3, 0x03, 0xAB, 0x85, 0xE5, 0x04, 0xC0, 0x9A, 0x21,
+  0x72, 0x69, 0xE4, 0x69, 0x81, 0xF4, 0x81, 0xF8, 0xC0, 0xAF, 0x1C, 0xE2, 0x69, 0x06, 0x40, 0xA8,
+  0xAB, 0xA6, 0x64, 0xE7, 0xC0, 0xAE, 0x35, 0xE1, 0x69, 0x0E, 0x05, 0x09, 0x05, 0x40, 0x5A, 0x78,
+  0x40, 0x4C, 0x07, 0x24, 0xDF, 0xA3, 0x98, 0x6D, 0xE1, 0xC0, 0xA8, 0xA0, 0xEC, 0x69, 0x81, 0x61,
+  0x73, 0xE9, 0xC0, 0x60, 0x70, 0xE5, 0x69, 0xC0, 0xAE, 0x9C, 0xAE, 0x12, 0x06, 0x12, 0x14, 0x1C,
+  0x19, 0x04, 0x40, 0x8D, 0xDB, 0x20, 0x30, 0x2F, 0x5B, 0x22, 0x24, 0xA8, 0xB0, 0xF6, 0x40, 0xA2,
+  0x1A, 0xAC, 0xA4, 0x73, 0x6D, 0x63, 0x65, 0x72, 0x75, 0x74, 0x75, 0xE6, 0x6A, 0x81, 0xAE, 0x03,
+  0xA0, 0x28, 0x6E, 0xE9, 0x62, 0xF2, 0x04, 0xC0, 0xAE, 0xD2, 0x65, 0x75, 0x65, 0x66, 0x6B, 0x6E,
+  0x75, 0x66, 0x2E, 0x6E, 0x65, 0xE9, 0xC0, 0xAC, 0xB6, 0xEF, 0x04, 0xC0, 0xA9, 0x81, 0x66, 0x6E,
+  0xE9, 0x69, 0x81, 0x73, 0x74, 0x72, 0x6F, 0xAE, 0x02, 0x83, 0x78, 0xE5, 0x62, 0x6E, 0x65, 0x64,
+  0x6E, 0xF5, 0xC0, 0x8D, 0x9A, 0x67, 0x6E, 0xE9, 0x02, 0x8A, 0x74, 0x73, 0x6F, 0x68, 0x65, 0x72,
+  0xF5, 0xC0, 0x84, 0x10, 0x6C, 0x69, 0x61, 0x6D, 0x65, 0x72, 0xF5, 0xC0, 0x84, 0x06, 0xE5, 0xC0,
+  0x9F, 0x11, 0x63, 0xE1, 0x69, 0x81, 0x2E, 0xE8, 0xC0, 0xAD, 0xA5, 0x30, 0x73, 0x72, 0x7A, 0x63,
+  0x2D, 0x2D, 0xEE, 0xC0, 0xAF, 0x8C, 0xF3, 0x20, 0x2A, 0x08, 0x20, 0x3F, 0x21, 0xD8, 0x20, 0x52,
+  0x20, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x20, 0x26, 0x20, 0x4D, 0x20, 0x37, 0x20, 0x37, 0x20, 0x2F,
+  0x20, 0x25, 0x09, 0x09, 0x20, 0xD1, 0x20, 0x25, 0x20, 0x25, 0x17, 0x20, 0x20, 0x05, 0xC0, 0xA6,
+  0x4A, 0xF9, 0x32, 0x3F, 0x40, 0x91, 0x21, 0xAA, 0xA3, 0xF7, 0x69, 0x06, 0x04, 0x13, 0xC0, 0xAE,
+  0x2D, 0xEF, 0xC0, 0x66, 0xB7, 0xE5, 0x04, 0xC0, 0x59, 0x5D, 0xEE, 0x69, 0x81, 0x2E, 0x65, 0x6C,
+  0x62, 0x61, 0x65, 0x63, 0xE9, 0xC0, 0x7C, 0xA6, 0xAE, 0x0C, 0x0B, 0x40, 0x99, 0x63, 0x32, 0xE8,
+  0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xF3, 0x04, 0xC0, 0x9F, 0x2D, 0x74, 0x65, 0xF0, 0xC0, 0xAD, 0x91,
+  0x72, 0x6F, 0x73, 0x69, 0x76, 0x64, 0xE1, 0x62, 0xF5, 0x69, 0x0B, 0x07, 0x07, 0x0D, 0x04, 0x06,
+  0x40, 0x9A, 0x8C, 0xA1, 0x30, 0x78, 0xE5, 0x40, 0xAD, 0x02, 0xA0, 0xDD, 0x69, 0x6E, 0x65, 0xF3,
+  0xC0, 0x90, 0xD3, 0xE5, 0x69, 0x81, 0x2E, 0x79, 0x74, 0x72, 0x61, 0x70, 0xAE, 0xC0, 0x23, 0xCC,
+  0xE2, 0xC0, 0x9F, 0x0A, 0x61, 0xE8, 0x69, 0xC0, 0x63, 0xC3, 0xAE, 0x17, 0x03, 0x0B, 0x07, 0x0B,
+  0x03, 0x0C, 0x17, 0x07, 0x09, 0x0D, 0x15, 0x03, 0x09, 0x08, 0x03, 0x20, 0x51, 0x08, 0x12, 0x20,
+  0x35, 0x90, 0xFA, 0xA0, 0x87, 0xF9, 0x06, 0x20, 0x34, 0x20, 0xF9, 0x95, 0xE2, 0xC0, 0x92, 0x45,
+  0xF8, 0x03, 0xA0, 0x5B, 0xEF, 0xA5, 0x06, 0xF6, 0x03, 0xA1, 0x1E, 0xF7, 0x69, 0x81, 0xAE, 0xC0,
+  0xAB, 0xB4, 0xF5, 0xA1, 0x5F, 0xF4, 0x07, 0x20, 0xF0, 0x20, 0x35, 0xA0, 0x33, 0xF5, 0x69, 0xA1,
+  0x59, 0xF3, 0x07, 0x07, 0x04, 0x20, 0x46, 0xA0, 0x93, 0x6E, 0xE4, 0x40, 0x90, 0x64, 0xBB, 0xDA,
+  0xEB, 0x69, 0xA1, 0x46, 0xE4, 0xC0, 0xAA, 0x07, 0xF2, 0x20, 0x41, 0x20, 0x5C, 0xA0, 0x70, 0xF0,
+  0x04, 0xC0, 0x74, 0x8C, 0xE9, 0xC0, 0xAC, 0xF0, 0xEF, 0x05, 0x20, 0xBF, 0xA0, 0x68, 0x74, 0x74,
+  0x6E, 0xE9, 0xC0, 0xA9, 0xFE, 0xEE, 0x09, 0x04, 0x20, 0xAA, 0x20, 0x62, 0xC0, 0xAB, 0xAD, 0xF4,
+  0x69, 0xA1, 0x17, 0x61, 0x66, 0x66, 0xEC, 0xC0, 0xAD, 0x13, 0xED, 0xA0, 0xBE, 0xEC, 0x04, 0x08,
+  0xA0, 0xF5, 0xE6, 0x69, 0xA1, 0x04, 0xEB, 0x03, 0xA0, 0x5C, 0xE1, 0x69, 0xA0, 0xFC, 0xEA, 0xA0,
+  0xAA, 0xE9, 0x0A, 0x04, 0x20, 0x3E, 0x20, 0x70, 0x04, 0xC0, 0xA8, 0x8D, 0xF2, 0x69, 0xA0, 0x79,
+  0xED, 0x69, 0x81, 0xAE, 0x0D, 0x0A, 0x05, 0x0A, 0x0A, 0x04, 0x40, 0x9B, 0x41, 0x28, 0xC6, 0xA0,
+  0x6F, 0x77, 0x61, 0x6E, 0x65, 0x74, 0x68, 0xF3, 0xC0, 0x92, 0xA0, 0x74, 0xF3, 0xC0, 0xAA, 0xF7,
+  0x72, 0x6F, 0x62, 0x72, 0x61, 0x2D, 0xEE, 0xC0, 0xA2, 0x7A, 0xEE, 0x04, 0xC0, 0xAB, 0xEF, 0x6F,
+  0xF4, 0xC0, 0x6B, 0xF8, 0xE7, 0xC0, 0xAC, 0xD9, 0xE3, 0x40, 0xA8, 0xE8, 0xA3, 0xEF, 0xE8, 0x69,
+  0xA0, 0x37, 0xE8, 0x03, 0xA0, 0x53, 0xEF, 0x69, 0xA0, 0xA0, 0xE5, 0x05, 0x20, 0x2D, 0x1C, 0x84,
+  0x6C, 0x61, 0x73, 0x2D, 0x34, 0xAD, 0x40, 0x61, 0x2F, 0xC0, 0x2F, 0xCC, 0xE4, 0x07, 0x0D, 0x03,
+  0x09, 0x04, 0xA0, 0x5E, 0xF5, 0x04, 0xC0, 0xA5, 0x37, 0x6F, 0x6C, 0xE3, 0x81, 0xF2, 0xC0, 0xAC,
+  0xA6, 0xF3, 0x69, 0x84, 0xEE, 0x69, 0x81, 0xAE, 0x40, 0x9B, 0x01, 0xAF, 0xBA, 0xED, 0x69, 0xA0,
+  0x69, 0xE5, 0x04, 0xC0, 0xAB, 0x6A, 0x6C, 0x61, 0x63, 0x73, 0x6E, 0x65, 0x2E, 0xF8, 0xC0, 0x97,
+  0xFF, 0xE3, 0x03, 0x04, 0x84, 0xF3, 0x69, 0xA0, 0x51, 0xEE, 0x69, 0xA0, 0x4D, 0xE4, 0x69, 0xA0,
+  0x49, 0xE1, 0x0C, 0x04, 0x04, 0x04, 0x20, 0x22, 0x03, 0x03, 0x03, 0xC0, 0x9C, 0xE2, 0xF7, 0x69,
+  0xA0, 0x38, 0xF6, 0x69, 0xA0, 0x34, 0xF0, 0x69, 0xA0, 0x30, 0xED, 0x69, 0x81, 0xAE, 0x06, 0x40,
+  0x9A, 0xB5, 0xAF, 0xBA, 0x32, 0x31, 0xEB, 0x69, 0x81, 0xAE, 0x03, 0x04, 0x85, 0xF4, 0xC0, 0x9A,
+  0x69, 0x72, 0xF4, 0xC0, 0xA8, 0xA5, 0x68, 0x63, 0xEF, 0xC0, 0x96, 0x9D, 0xEC, 0x69, 0x8A, 0xE9,
+  0x69, 0x87, 0xE7, 0x69, 0x84, 0xE3, 0x69, 0x81, 0xAE, 0x40, 0x9A, 0x90, 0x29, 0x35, 0xA6, 0x85,
+  0xF4, 0x0A, 0x20, 0x29, 0x08, 0x08, 0x2C, 0xCA, 0xC0, 0x89, 0x78, 0xEE, 0x02, 0x9D, 0xE5, 0x02,
+  0x8F, 0x76, 0xE5, 0x69, 0x81, 0xAE, 0x04, 0xC0, 0xAC, 0x04, 0x6E, 0x69, 0xE2, 0xC0, 0x2C, 0x23,
+  0x6D, 0xF4, 0x03, 0xA9, 0xC7, 0x73, 0x65, 0xF6, 0xC0, 0xAA, 0x8C, 0xE1, 0x81, 0x74, 0x6E, 0x75,
+  0xEF, 0xC0, 0x96, 0xBF, 0xE8, 0x04, 0xC0, 0x38, 0x7E, 0xE7, 0xAE, 0x3C, 0x65, 0xEB, 0x40, 0x52,
+  0xEE, 0xC0, 0x3E, 0x58, 0xE1, 0x04, 0xC0, 0xAA, 0xE2, 0xE5, 0x04, 0xC0, 0xAB, 0xC4, 0xF9, 0xC0,
+  0xA2, 0xFB, 0xF3, 0x69, 0x09, 0x20, 0x20, 0x40, 0x5E, 0xF4, 0xC0, 0x22, 0x02, 0xE5, 0x03, 0x05,
+  0x8A, 0x78, 0xEE, 0xC0, 0xAA, 0xA2, 0x72, 0xF0, 0x69, 0x81, 0x78, 0xE5, 0x69, 0xC0, 0x5F, 0xB3,
+  0xEE, 0x04, 0xC0, 0x3F, 0x7D, 0x69, 0x73, 0x75, 0xE2, 0x69, 0xC0, 0x9D, 0x47, 0xAE, 0x40, 0xA5,
+  0x5E, 0x24, 0x08, 0x20, 0x4F, 0x20, 0x38, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xF2, 0x69, 0x0C, 0x11,
+  0x20, 0x2E, 0x0C, 0x40, 0x86, 0xD6, 0x39, 0xD1, 0xAA, 0x94, 0x6F, 0xF4, 0x02, 0x86, 0x6F, 0x6D,
+  0xE1, 0xC0, 0x3C, 0x41, 0x63, 0x61, 0x72, 0xF4, 0xC0, 0x95, 0xEC, 0xE5, 0x0B, 0x04, 0x07, 0x04,
+  0x04, 0x40, 0x68, 0xA6, 0xC0, 0x34, 0x11, 0xF7, 0xC0, 0x6A, 0x59, 0xEE, 0x40, 0x63, 0xEF, 0xC0,
+  0x31, 0xD9, 0xE7, 0xC0, 0xA7, 0x2E, 0xE5, 0xC0, 0x6E, 0xBF, 0x64, 0x6C, 0x69, 0x75, 0xE2, 0x69,
+  0x81, 0x2E, 0x65, 0x74, 0x69, 0xF3, 0xC0, 0xAA, 0x11, 0xE1, 0x06, 0x40, 0xAA, 0xEA, 0xA0, 0x56,
+  0x74, 0xE9, 0xC0, 0x99, 0xB8, 0xAE, 0x12, 0x0B, 0x40, 0x67, 0xFA, 0x40, 0x3D, 0xF7, 0x23, 0x81,
+  0x20, 0x3F, 0x21, 0x44, 0x06, 0x20, 0x20, 0x8A, 0x79, 0x6C, 0x64, 0x6E, 0x65, 0x72, 0x62, 0xAE,
+  0xC0, 0x96, 0x20, 0xE1, 0xC0, 0xA9, 0x1A, 0xF0, 0x69, 0x05, 0x10, 0xC0, 0xA9, 0x00, 0xE9, 0x07,
+  0x40, 0x69, 0xEE, 0xC0, 0x41, 0x2F, 0x68, 0x73, 0x72, 0x61, 0xEC, 0xC0, 0xA9, 0x16, 0xAE, 0x0B,
+  0x40, 0x95, 0xCE, 0x33, 0x73, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xEF, 0xC0, 0x98, 0xEB, 0xEF, 0x05,
+  0x0C, 0x05, 0x06, 0x85, 0xF4, 0x04, 0xC0, 0x98, 0x32, 0x6F, 0x68, 0xF0, 0x69, 0xC0, 0xA9, 0xBA,
+  0x70, 0xF0, 0xC0, 0xA8, 0x30, 0x6C, 0x65, 0xF5, 0xC0, 0xA9, 0x82, 0x67, 0xE5, 0xC0, 0x69, 0xF3,
+  0xE4, 0xC0, 0x95, 0x43, 0xEE, 0x05, 0x20, 0x20, 0x14, 0x88, 0xEF, 0x02, 0x84, 0xF0, 0xC0, 0x8D,
+  0x3C, 0x69, 0xF4, 0x05, 0x0D, 0xC0, 0x39, 0xF9, 0x75, 0x6C, 0x6F, 0xF3, 0x69, 0x81, 0x2E, 0x72,
+  0x65, 0x68, 0x69, 0xE4, 0x62, 0x61, 0xE3, 0xC0, 0xA8, 0x89, 0xE9, 0x02, 0x85, 0x67, 0xE9, 0xC0,
+  0xAA, 0xAB, 0xE1, 0x02, 0x84, 0xED, 0xC0, 0xA6, 0xE1, 0x67, 0xF2, 0xC0, 0xAA, 0x01, 0x65, 0x67,
+  0x61, 0x73, 0xF3, 0xC0, 0xA1, 0xCB, 0xE1, 0x06, 0x40, 0x9A, 0x57, 0xAF, 0x0C, 0xE7, 0xC0, 0x8E,
+  0xAD, 0xED, 0x69, 0x06, 0x06, 0x15, 0xC0, 0xAA, 0x4E, 0x69, 0x61, 0xEC, 0xC0, 0xAA, 0x74, 0x65,
+  0x74, 0x73, 0x79, 0xF3, 0x69, 0x81, 0x2E, 0x74, 0x6E, 0x69, 0x6F, 0x70, 0x74, 0x68, 0x67, 0x69,
+  0xEE, 0xC0, 0xA6, 0xFD, 0xAE, 0x0C, 0x40, 0x5F, 0x0C, 0x40, 0x49, 0x8E, 0x21, 0x8D, 0x06, 0x1E,
+  0x8C, 0x65, 0x74, 0x69, 0xF3, 0xC0, 0x70, 0x35, 0xEC, 0x69, 0x09, 0x07, 0x0B, 0x0A, 0x40, 0x8E,
+  0x73, 0xBB, 0xB4, 0x6C, 0x61, 0x68, 0xF3, 0xC0, 0x8F, 0x9D, 0xE5, 0x04, 0xC0, 0x5D, 0xE5, 0x74,
+  0x6F, 0xE8, 0x69, 0xA1, 0x91, 0xE1, 0x04, 0xC0, 0xA7, 0x16, 0x74, 0xEE, 0xC0, 0xA8, 0x8C, 0xAE,
+  0x40, 0x97, 0x97, 0x2C, 0x45, 0x08, 0x23, 0x2C, 0x21, 0x5B, 0x21, 0x8D, 0x06, 0xA0, 0x2A, 0xEB,
+  0x05, 0x0C, 0xC0, 0x9F, 0x73, 0x68, 0x78, 0x64, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xC0, 0xAB,
+  0x21, 0xE3, 0x04, 0xC0, 0xA5, 0x53, 0x6F, 0xF2, 0x69, 0x81, 0xAE, 0x05, 0x06, 0xC0, 0x89, 0x47,
+  0x73, 0x6E, 0xE4, 0xC0, 0x96, 0x38, 0x65, 0x63, 0x61, 0x70, 0xF3, 0xC0, 0xA4, 0xD3, 0xE9, 0x69,
+  0x08, 0x04, 0x04, 0x40, 0x94, 0x36, 0xAE, 0x01, 0xF4, 0xC0, 0x7C, 0x08, 0xEE, 0xC0, 0x2A, 0x18,
+  0xAE, 0x0A, 0x40, 0x55, 0xBD, 0x40, 0x53, 0xE0, 0x06, 0x1E, 0x8C, 0x65, 0x6B, 0x61, 0x63, 0xF0,
+  0xC0, 0xA8, 0x31, 0x68, 0x35, 0x63, 0x38, 0x32, 0xB2, 0xC0, 0xA3, 0xBD, 0xE7, 0x69, 0x81, 0x6E,
+  0x69, 0xE4, 0xC0, 0x45, 0x37, 0xE5, 0x69, 0x12, 0x04, 0x06, 0x13, 0x17, 0x05, 0x09, 0x13, 0x05,
+  0x1A, 0x09, 0x17, 0x0D, 0x40, 0x8C, 0x84, 0xA8, 0x4B, 0xF6, 0xC0, 0x98, 0xAA, 0x74, 0x61, 0xE9,
+  0xC0, 0x60, 0x5B, 0xF3, 0x02, 0x84, 0xF2, 0xC0, 0x8C, 0x03, 0xE9, 0x04, 0xC0, 0x93, 0x6E, 0x72,
+  0x70, 0x72, 0xE5, 0xC0, 0x88, 0x45, 0xF2, 0x04, 0xC0, 0xA9, 0x86, 0x75, 0xF4, 0x04, 0xC0, 0x4C,
+  0xF6, 0x63, 0x69, 0xF0, 0x69, 0x81, 0x2E, 0x37, 0x33, 0xB3, 0xC0, 0x9B, 0xB0, 0x70, 0xE9, 0xC0,
+  0x91, 0x23, 0xED, 0x40, 0x72, 0x13, 0x40, 0x2F, 0x34, 0xA7, 0x3A, 0xEC, 0x09, 0x04, 0x40, 0x65,
+  0x49, 0x3D, 0xB7, 0xAB, 0xEF, 0xF0, 0xC0, 0xA8, 0x75, 0x67, 0xEE, 0xC0, 0xA7, 0x22, 0x6A, 0xE1,
+  0xC0, 0xA6, 0x43, 0xE9, 0x03, 0x0A, 0x85, 0x74, 0x72, 0x65, 0x70, 0x6F, 0x72, 0xF0, 0x69, 0xA0,
+  0x95, 0x72, 0xF4, 0xC0, 0x54, 0x8C, 0xEC, 0x81, 0x70, 0xF0, 0xC0, 0xA4, 0x7F, 0xE8, 0x04, 0xC0,
+  0x62, 0xA7, 0xE7, 0xC0, 0x5D, 0x6A, 0xE4, 0x02, 0x89, 0x6F, 0xE3, 0x69, 0x81, 0x2E, 0x6F, 0x77,
+  0xEF, 0x62, 0x64, 0x32, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0xAA, 0x25, 0x63, 0x69, 0x76,
+  0x72, 0x65, 0xF3, 0x69, 0x81, 0x2E, 0xE5, 0xC0, 0x92, 0xA3, 0xAE, 0x09, 0x04, 0x40, 0x9B, 0x00,
+  0x2D, 0xC6, 0xA0, 0x2A, 0xED, 0xC0, 0x53, 0x5D, 0xE2, 0x04, 0xC0, 0xA8, 0xBD, 0x65, 0x77, 0x69,
+  0x6D, 0x33, 0xB2, 0xC0, 0x9B, 0x27, 0xE4, 0x0E, 0x06, 0x40, 0x6C, 0x2B, 0x40, 0x39, 0x36, 0x21,
+  0x68, 0x21, 0x15, 0xA0, 0xFC, 0x6F, 0x6F, 0xE7, 0xC0, 0x94, 0x51, 0xEE, 0x02, 0x86, 0x6F, 0x6D,
+  0xE1, 0xC0, 0x9C, 0xDA, 0x69, 0x77, 0x72, 0xE9, 0xC0, 0xA0, 0xD6, 0xE3, 0x04, 0xC0, 0xA4, 0xF7,
+  0xE9, 0x05, 0x15, 0xC0, 0xA8, 0x3F, 0xF4, 0x02, 0x85, 0x79, 0xEC, 0xC0, 0x22, 0x2C, 0x73, 0x69,
+  0x67, 0x6F, 0xEC, 0x81, 0x79, 0x72, 0x72, 0xE5, 0xC0, 0xA5, 0x36, 0x68, 0xF0, 0xC0, 0x7A, 0xC4,
+  0xE2, 0x69, 0x0A, 0x40, 0x9C, 0x3A, 0x2A, 0x48, 0x21, 0xA5, 0xA0, 0x5D, 0xAE, 0x40, 0xA3, 0x73,
+  0x23, 0x5B, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xE1, 0x69, 0x0D, 0x08, 0x40, 0x41, 0x01, 0x40, 0x23,
+  0xA5, 0x40, 0x39, 0xD8, 0xA9, 0x87, 0x6D, 0x74, 0x73, 0x69, 0xF2, 0xC0, 0xA4, 0xCD, 0x62, 0x69,
+  0x72, 0x61, 0x70, 0xF0, 0xC0, 0xA6, 0xE9, 0x39, 0xFA, 0xC0, 0xA2, 0x5D, 0x38, 0xF3, 0xC0, 0xA2,
+  0x58, 0xF2, 0x1C, 0x05, 0x20, 0x49, 0x20, 0x22, 0x18, 0x05, 0x09, 0x05, 0x20, 0x8C, 0x20, 0x2B,
+  0x1C, 0x0D, 0x20, 0xF6, 0x20, 0xB5, 0x11, 0x22, 0xED, 0x40, 0x88, 0xB4, 0xB8, 0xFD, 0x75, 0xE2,
+  0xC0, 0xA5, 0x2B, 0xF4, 0x69, 0x06, 0x40, 0xA7, 0x05, 0xA1, 0x26, 0xAE, 0x1E, 0x07, 0x04, 0x0D,
+  0x04, 0x40, 0x7A, 0x44, 0x33, 0x65, 0x28, 0x9E, 0x29, 0x41, 0x20, 0xF2, 0x21, 0x2C, 0x21, 0x32,
+  0x23, 0x2E, 0x20, 0x2F, 0x20, 0x45, 0x21, 0x4E, 0xA0, 0x2A, 0xF6, 0x40, 0xA7, 0xDF, 0x20, 0x39,
+  0x82, 0xF3, 0xC0, 0xA3, 0x11, 0xEC, 0x06, 0x40, 0xA4, 0xA4, 0xA3, 0x54, 0xE5, 0x40, 0xA7, 0xE5,
+  0xA0, 0x21, 0xEB, 0xC0, 0x2F, 0x73, 0x63, 0xEE, 0x69, 0xC0, 0x9E, 0x03, 0xF0, 0x69, 0x81, 0xAE,
+  0x13, 0x06, 0x40, 0x52, 0xBD, 0x40, 0x4C, 0x8C, 0x22, 0x3A, 0x24, 0x60, 0x20, 0x39, 0x21, 0x83,
+  0x06, 0x1E, 0x8C, 0xF4, 0x40, 0x9B, 0x90, 0xAC, 0x30, 0x61, 0xEC, 0xC0, 0x98, 0x7C, 0xEF, 0x05,
+  0x0B, 0xC0, 0x72, 0x4E, 0xF4, 0x04, 0xC0, 0x91, 0x7F, 0xE3, 0x40, 0xA3, 0xFD, 0xA3, 0xCE, 0x6F,
+  0x64, 0x74, 0xEE, 0xC0, 0x8B, 0xD8, 0xEE, 0x69, 0xC0, 0x84, 0x5C, 0xED, 0x69, 0x81, 0xAE, 0x40,
+  0xA2, 0x75, 0xA5, 0x04, 0xEC, 0x69, 0xC0, 0xA1, 0x28, 0xEB, 0x69, 0x02, 0x83, 0xE3, 0xA9, 0xE8,
+  0xAE, 0x13, 0x14, 0x08, 0x20, 0x20, 0x05, 0x0A, 0x10, 0x0B, 0x04, 0x40, 0x87, 0x97, 0x2C, 0xF2,
+  0x2D, 0x5D, 0xA5, 0x36, 0xF5, 0x02, 0x8C, 0xEA, 0x04, 0xC0, 0xA0, 0xE4, 0x67, 0x6E, 0x61, 0xF7,
+  0xC0, 0xA7, 0x4C, 0x67, 0xE5, 0xC0, 0xA4, 0x66, 0xF3, 0x40, 0xA6, 0x8D, 0x20, 0xBC, 0xA0, 0x24,
+  0xEE, 0x02, 0x95, 0xEF, 0x02, 0x86, 0x77, 0x67, 0xEE, 0xC0, 0x9F, 0x41, 0xE5, 0x02, 0x85, 0x6A,
+  0xE5, 0xC0, 0xA4, 0x4A, 0xE8, 0xC0, 0x81, 0x93, 0x61, 0xF3, 0x40, 0x40, 0x83, 0xC0, 0x5C, 0x3D,
+  0x6D, 0x61, 0xEE, 0x11, 0x85, 0xEC, 0x04, 0xC0, 0xA7, 0x3A, 0x75, 0xEF, 0xC0, 0xA3, 0x3B, 0x6B,
+  0x75, 0xE2, 0x02, 0x85, 0x6E, 0xEF, 0xC0, 0xA0, 0x9A, 0x67, 0xEE, 0x09, 0xC0, 0x86, 0x58, 0x69,
+  0x67, 0x67, 0xEE, 0x81, 0x6F, 0x65, 0xF9, 0xC0, 0xA6, 0xF5, 0xE7, 0xC0, 0xA3, 0xB3, 0xE5, 0x40,
+  0xA6, 0xBB, 0x20, 0x4C, 0x84, 0xE9, 0x69, 0x07, 0x07, 0x40, 0x9C, 0xB5, 0xA5, 0x36, 0xE1, 0x40,
+  0x56, 0xEF, 0xC0, 0x4F, 0x38, 0xAE, 0x0F, 0x40, 0x80, 0xE2, 0x40, 0x24, 0x1C, 0x20, 0x38, 0x0A,
+  0x21, 0x83, 0x20, 0x26, 0x8A, 0xE1, 0x02, 0x84, 0xF2, 0xC0, 0xA7, 0x45, 0xB6, 0xC0, 0xA7, 0x3F,
+  0xE8, 0x69, 0x04, 0xC0, 0x65, 0x50, 0xAE, 0x08, 0x07, 0x40, 0x2F, 0xAA, 0xC0, 0x71, 0xF4, 0x6D,
+  0xEF, 0x40, 0xA5, 0xAD, 0xA1, 0x22, 0xE5, 0x40, 0x89, 0xBC, 0xBB, 0x2B, 0xE7, 0x69, 0x81, 0xAE,
+  0x22, 0xEE, 0x40, 0xA3, 0xAA, 0x06, 0x06, 0x18, 0x8C, 0xE6, 0x69, 0x05, 0x10, 0xC0, 0xA6, 0x43,
+  0x61, 0x76, 0x63, 0x37, 0x79, 0x6C, 0x71, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0xA7, 0xC2,
+  0xAE, 0x16, 0x08, 0x20, 0x28, 0x20, 0x30, 0x05, 0x0D, 0x05, 0x20, 0x3C, 0x10, 0x40, 0x83, 0x56,
+  0x28, 0x53, 0x05, 0x2C, 0x30, 0xA4, 0xF3, 0x78, 0x6F, 0x62, 0x69, 0xE4, 0xC0, 0xA3, 0x74, 0xF4,
+  0x05, 0x17, 0xC0, 0x81, 0xC1, 0xF2, 0x02, 0x86, 0x6F, 0xF0, 0x69, 0xC0, 0x36, 0xFA, 0x65, 0x70,
+  0x78, 0x65, 0x2D, 0x65, 0x72, 0x74, 0x65, 0x6D, 0xEF, 0xC0, 0xA5, 0x75, 0xEF, 0x04, 0xC0, 0xA6,
+  0x48, 0x6F, 0x72, 0xAD, 0xC0, 0x8B, 0xCF, 0xF3, 0x02, 0x8E, 0xEF, 0x02, 0x82, 0xAD, 0x81, 0xF8,
+  0x04, 0xC0, 0x6A, 0x42, 0xE2, 0xC0, 0xA5, 0x2B, 0xE5, 0x07, 0x05, 0x20, 0x43, 0xC0, 0x74, 0x7F,
+  0x75, 0xEF, 0xC0, 0xA5, 0x79, 0x6C, 0x62, 0x61, 0x74, 0x70, 0x6D, 0x6F, 0x63, 0x2D, 0x73, 0x74,
+  0xF2, 0x81, 0x65, 0xF0, 0xC0, 0x9C, 0x1F, 0xEE, 0x40, 0x74, 0xA2, 0x9A, 0xE9, 0x04, 0xC0, 0xA4,
+  0x42, 0x72, 0x67, 0x61, 0x62, 0xED, 0xC0, 0x7C, 0xCC, 0x68, 0xEE, 0xC0, 0xA5, 0xB6, 0xE5, 0x05,
+  0x06, 0xC0, 0x74, 0xA5, 0x6C, 0x69, 0xF0, 0xC0, 0x83, 0x9B, 0xE3, 0x02, 0x9E, 0x6E, 0x61, 0x72,
+  0x66, 0x2D, 0x6E, 0x65, 0x2D, 0x73, 0xE5, 0x81, 0x74, 0x73, 0x69, 0x74, 0x6E, 0x65, 0x64, 0x2D,
+  0x73, 0x6E, 0x65, 0x69, 0x67, 0x72, 0x75, 0xF2, 0xC0, 0x83, 0xCB, 0x69, 0x74, 0x73, 0x75, 0x6A,
+  0x2D, 0x72, 0x65, 0x69, 0x73, 0x73, 0xE9, 0xC0, 0x5A, 0x26, 0x62, 0x65, 0xF7, 0x04, 0xC0, 0x71,
+  0x5F, 0x65, 0x74, 0x69, 0x73, 0x33, 0xB2, 0xC0, 0x98, 0x13, 0x61, 0xF4, 0xC0, 0x54, 0x5B, 0xE5,
+  0x6A, 0x16, 0x06, 0x04, 0x0D, 0x12, 0x1E, 0x06, 0x0C, 0x0B, 0x06, 0x0F, 0x0D, 0x11, 0x23, 0x59,
+  0x40, 0x7E, 0x0B, 0x30, 0xE2, 0xAD, 0xBA, 0x7A, 0x69, 0xE6, 0xC0, 0xA5, 0x50, 0xF9, 0xC0, 0xA0,
+  0x56, 0x77, 0x75, 0x6C, 0x6B, 0x73, 0x72, 0x65, 0x74, 0x6C, 0xEF, 0xC0, 0xA3, 0x91, 0xF6, 0x02,
+  0x86, 0x72, 0x65, 0xF3, 0xC0, 0x23, 0x06, 0xEF, 0x04, 0xC0, 0x74, 0xB8, 0xF2, 0xC0, 0x59, 0xF8,
+  0xF4, 0x09, 0x0F, 0x40, 0x5A, 0x3E, 0x3E, 0xAF, 0xB7, 0x57, 0xF3, 0x07, 0x40, 0x61, 0x11, 0xC0,
+  0x22, 0xFC, 0x75, 0x62, 0x6B, 0xE3, 0xC0, 0xA5, 0x58, 0x6E, 0xE5, 0xC0, 0xA5, 0x65, 0x70, 0x69,
+  0xEE, 0xC0, 0x64, 0x7F, 0xEC, 0x04, 0xC0, 0x36, 0xFD, 0x66, 0x66, 0x65, 0xE1, 0xC0, 0xA3, 0x66,
+  0xEB, 0x04, 0xC0, 0x92, 0x11, 0xEF, 0x40, 0x92, 0x37, 0xB2, 0xBD, 0x69, 0x74, 0xEE, 0xC0, 0x89,
+  0x6D, 0xE8, 0x07, 0x40, 0x2F, 0x5F, 0xC0, 0x63, 0xB8, 0xF4, 0x40, 0x57, 0x93, 0xC0, 0x24, 0x48,
+  0x67, 0x6E, 0xE9, 0x04, 0xC0, 0x77, 0x5A, 0x72, 0x68, 0xE5, 0xC0, 0xA4, 0x31, 0xE5, 0x07, 0x40,
+  0x68, 0x81, 0xC0, 0x3C, 0x8C, 0xEE, 0x04, 0xC0, 0x8A, 0x85, 0xEF, 0xC0, 0x9F, 0xB7, 0xE3, 0x81,
+  0xE3, 0xC0, 0x91, 0x49, 0xE3, 0x69, 0x81, 0xAE, 0x40, 0x85, 0x8D, 0x37, 0x04, 0x25, 0xAD, 0x21,
+  0x1F, 0x21, 0x8B, 0xA0, 0x2A, 0xE2, 0x69, 0x81, 0xAE, 0x1D, 0x0E, 0x04, 0x10, 0x13, 0x1E, 0x1D,
+  0x12, 0x04, 0x12, 0x20, 0x51, 0x04, 0x20, 0x42, 0x13, 0x20, 0x28, 0x04, 0x20, 0x7D, 0x12, 0x20,
+  0x2B, 0x0F, 0x13, 0x0C, 0xA0, 0x71, 0xFA, 0x07, 0x40, 0x80, 0xDE, 0xC0, 0x21, 0xB5, 0xEF, 0x40,
+  0xA3, 0xB1, 0xA1, 0x20, 0xF8, 0xC0, 0xA1, 0xCE, 0xF6, 0x0A, 0x40, 0x7C, 0xF4, 0x31, 0x16, 0x33,
+  0xA3, 0xA3, 0x23, 0x6F, 0xE7, 0x69, 0xA1, 0x79, 0xF5, 0x07, 0x04, 0x40, 0x9F, 0x72, 0xA5, 0x1A,
+  0xEA, 0xC0, 0xA4, 0xC4, 0x63, 0x61, 0x75, 0xE7, 0xC0, 0x8B, 0x3E, 0xF4, 0x0B, 0x04, 0x06, 0x40,
+  0x53, 0xD1, 0x40, 0x46, 0x47, 0xA4, 0x4F, 0xF3, 0xC0, 0xA3, 0x78, 0xEF, 0x40, 0xA3, 0x74, 0xA1,
+  0x16, 0xE5, 0x40, 0xA2, 0x92, 0x20, 0xA6, 0xA1, 0x4C, 0xF3, 0x05, 0x0B, 0xC0, 0xA1, 0x66, 0xF5,
+  0x06, 0x40, 0x9F, 0x92, 0xA4, 0xEE, 0xE1, 0xC0, 0x5B, 0x5D, 0xE1, 0x06, 0x21, 0xB8, 0xC0, 0x56,
+  0x98, 0x69, 0xF8, 0xC0, 0xA2, 0x93, 0xF2, 0x0A, 0x24, 0x25, 0x40, 0x83, 0xCA, 0x34, 0x8E, 0xA2,
+  0xCD, 0xEF, 0x40, 0x5E, 0x12, 0xC0, 0x41, 0x64, 0xF1, 0xC0, 0x9E, 0x2F, 0xF0, 0x0A, 0x40, 0x7A,
+  0xF7, 0x36, 0x68, 0x26, 0xAE, 0xAA, 0xA4, 0xED, 0x69, 0x40, 0xA4, 0x29, 0xA0, 0x31, 0xEF, 0x09,
+  0x0C, 0x0C, 0x06, 0x0F, 0x12, 0xC0, 0xA3, 0x4A, 0xF4, 0x04, 0xC0, 0xA4, 0x48, 0x65, 0x72, 0x70,
+  0xEF, 0xC0, 0xA0, 0xB0, 0xE9, 0x08, 0x40, 0x77, 0x11, 0x40, 0x2D, 0x04, 0x88, 0xE5, 0xA8, 0x23,
+  0xE5, 0x40, 0xA3, 0xFB, 0xA0, 0x37, 0xE4, 0x04, 0xC0, 0xA4, 0x21, 0x72, 0x61, 0x6E, 0x72, 0x65,
+  0x62, 0xEF, 0xC0, 0xA1, 0x44, 0xE3, 0x05, 0x04, 0xC0, 0xA3, 0xE3, 0xF3, 0xC0, 0xA2, 0xB0, 0x6E,
+  0x61, 0x72, 0x62, 0xEF, 0xC0, 0xA0, 0x7D, 0x61, 0x72, 0x69, 0x65, 0xE2, 0xC0, 0xA0, 0x75, 0xEE,
+  0xC0, 0x7F, 0x78, 0xED, 0x0C, 0x20, 0x29, 0x40, 0x7B, 0xEE, 0x3E, 0xF5, 0x27, 0xB4, 0xA1, 0x35,
+  0xEF, 0x04, 0xC0, 0x70, 0x05, 0xE3, 0x69, 0x81, 0xAE, 0x05, 0x05, 0xC0, 0x9E, 0xA1, 0x65, 0xF4,
+  0xC0, 0x77, 0x89, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0x6C, 0x61, 0x75, 0x74, 0x72, 0x69, 0x76, 0x2E,
+  0x65, 0x6C, 0x61, 0x63, 0x73, 0x2E, 0xF3, 0xB9, 0xB2, 0xE5, 0x04, 0xC0, 0x5E, 0xBD, 0xE7, 0x81,
+  0x61, 0xF4, 0xC0, 0x8E, 0x22, 0xEC, 0x07, 0x04, 0x40, 0x9A, 0x88, 0xA9, 0x1B, 0xF3, 0xC0, 0xA3,
+  0x53, 0x61, 0xF4, 0x40, 0x99, 0x63, 0xA8, 0x5A, 0xE9, 0x0E, 0x04, 0x0B, 0x07, 0x3A, 0x36, 0x40,
+  0x34, 0x42, 0x26, 0x6D, 0xC0, 0x20, 0x3F, 0xF8, 0xC0, 0x92, 0xD5, 0xF2, 0x04, 0xC0, 0xA3, 0x80,
+  0x65, 0x75, 0xF2, 0xC0, 0xA2, 0xE9, 0x6F, 0x72, 0x65, 0xF4, 0xC0, 0xA2, 0x2A, 0xEE, 0xBC, 0xF9,
+  0xE8, 0xC0, 0x91, 0x96, 0xE7, 0x08, 0x04, 0x0A, 0x06, 0x06, 0xC0, 0xA3, 0x53, 0xF0, 0xC0, 0xA3,
+  0x0C, 0x6F, 0xEC, 0x69, 0x40, 0xA2, 0x06, 0x20, 0x36, 0xA1, 0x12, 0xEE, 0x40, 0xA3, 0x36, 0x1E,
+  0x8C, 0xEC, 0x40, 0xA0, 0xA2, 0xA2, 0x4F, 0xE5, 0x04, 0xC0, 0xA2, 0xE7, 0xEC, 0x69, 0x81, 0xAE,
+  0x17, 0x04, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x07, 0x40, 0x4E, 0x9F, 0x40, 0x41,
+  0xCE, 0x2D, 0x2B, 0x24, 0xB2, 0xA0, 0x79, 0xF4, 0xC0, 0xA3, 0x2E, 0xF3, 0x40, 0xA3, 0x06, 0x18,
+  0x8C, 0xF2, 0x40, 0xA2, 0xC8, 0xA0, 0x50, 0xF0, 0x40, 0xA2, 0xBB, 0xA0, 0x72, 0xEF, 0x40, 0xA2,
+  0xEE, 0x1E, 0x99, 0xEE, 0xC0, 0xA3, 0x06, 0xEA, 0xC0, 0xA3, 0x02, 0xE7, 0xC0, 0xA3, 0x0A, 0xE6,
+  0xC0, 0xA1, 0x04, 0xE5, 0x40, 0xA2, 0x9F, 0x07, 0xA0, 0x56, 0xE1, 0x40, 0xA2, 0x9F, 0x20, 0x48,
+  0x94, 0xE6, 0x07, 0x06, 0x40, 0x91, 0x22, 0xAE, 0xAF, 0xEE, 0x40, 0xA1, 0xE6, 0xA0, 0xE2, 0xE4,
+  0xC0, 0x9D, 0xF8, 0xE5, 0x07, 0x09, 0x09, 0x05, 0xC0, 0x8D, 0x9F, 0x72, 0x64, 0x6E, 0x61, 0x6F,
+  0xF4, 0xC0, 0x7F, 0xCB, 0x6C, 0x6C, 0x69, 0x76, 0x6E, 0xE9, 0xC0, 0x96, 0x7C, 0x66, 0xE9, 0xC0,
+  0x8A, 0x83, 0x64, 0x6E, 0x61, 0x72, 0x67, 0xE1, 0x81, 0x6E, 0xE9, 0xC0, 0x7A, 0x84, 0xE4, 0x08,
+  0x40, 0x84, 0xCB, 0x30, 0xDF, 0xAA, 0xC3, 0xEE, 0x40, 0xA1, 0x88, 0xA0, 0x20, 0xE3, 0x09, 0x05,
+  0x40, 0x74, 0x45, 0x37, 0x41, 0xB4, 0xBE, 0xF4, 0x69, 0xC0, 0xA2, 0x79, 0xEA, 0xC0, 0xA2, 0x36,
+  0xE2, 0x69, 0x40, 0x50, 0xDD, 0x40, 0x4B, 0x4A, 0x21, 0x7D, 0xA0, 0x28, 0xE1, 0x0C, 0x08, 0x05,
+  0x10, 0x0C, 0x0F, 0x06, 0x0A, 0x08, 0xC0, 0x9E, 0xD7, 0x74, 0x73, 0x69, 0x76, 0xE1, 0xC0, 0xA1,
+  0x7D, 0x72, 0xE9, 0xC0, 0x86, 0xE5, 0xF0, 0x05, 0x07, 0xC0, 0x61, 0x4A, 0x6D, 0xE1, 0x40, 0x9D,
+  0x7A, 0xA4, 0x8B, 0xE1, 0xA6, 0x5D, 0xEE, 0x02, 0x85, 0x69, 0xF2, 0xC0, 0x79, 0x6E, 0xE5, 0xC0,
+  0x90, 0x69, 0xE9, 0x02, 0x86, 0x72, 0x61, 0xED, 0xC0, 0x60, 0x3E, 0x6E, 0x61, 0xE9, 0xC0, 0xA2,
+  0x1C, 0xE7, 0x81, 0xEE, 0xC0, 0x5E, 0x16, 0x64, 0x69, 0x63, 0xE5, 0x81, 0x72, 0xE1, 0xC0, 0x8F,
+  0x48, 0x63, 0x6E, 0x6F, 0x67, 0xEF, 0xC0, 0x9F, 0x60, 0xE2, 0x02, 0x87, 0x69, 0x74, 0x69, 0xF2,
+  0xC0, 0xA0, 0x91, 0xE1, 0x04, 0xC0, 0xA0, 0x87, 0x63, 0xEF, 0xC0, 0x42, 0xEA, 0x32, 0xB1, 0xC0,
+  0xA1, 0xED, 0xE1, 0x69, 0x0D, 0x05, 0x0C, 0x06, 0x40, 0x5D, 0xAF, 0x40, 0x2A, 0xF9, 0x39, 0x32,
+  0x8E, 0x75, 0xE7, 0xC0, 0x9D, 0x13, 0xF4, 0x04, 0xC0, 0x91, 0x42, 0xF3, 0x69, 0x81, 0xF5, 0xC0,
+  0xA1, 0xE5, 0x65, 0x79, 0xE4, 0xC0, 0x8F, 0x1C, 0xAE, 0x11, 0x0A, 0x0B, 0x40, 0x70, 0x50, 0x26,
+  0x7B, 0x39, 0x53, 0x2F, 0x6A, 0x22, 0x11, 0x06, 0xA0, 0x2A, 0xF4, 0x04, 0xC0, 0xA0, 0x65, 0xE5,
+  0x40, 0xA1, 0xC2, 0x84, 0xEC, 0x04, 0xC0, 0xA1, 0xCB, 0x61, 0x75, 0xF4, 0xC0, 0x98, 0xF5, 0xE1,
+  0x04, 0xC0, 0x49, 0xA7, 0x73, 0xE1, 0x81, 0xEE, 0xC0, 0x9D, 0xBF, 0xF1, 0x09, 0x05, 0x40, 0x95,
+  0x6A, 0x2C, 0x18, 0xA0, 0x2A, 0xE9, 0x69, 0xC0, 0x8A, 0x41, 0xE1, 0x69, 0x81, 0x33, 0x61, 0x39,
+  0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0xA2, 0xBB, 0xF0, 0x14, 0x0F, 0x04, 0x20, 0x28, 0x07, 0x20, 0xEF,
+  0x20, 0x3A, 0x05, 0x0C, 0x06, 0x0F, 0x40, 0x2D, 0x11, 0x11, 0x11, 0x84, 0x78, 0x65, 0x63, 0x65,
+  0x34, 0x69, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0xA2, 0x97, 0xF6, 0xC0, 0xA1, 0x6C, 0xF5,
+  0x03, 0x1A, 0x85, 0x6F, 0x72, 0xE7, 0x69, 0x04, 0x05, 0x05, 0x84, 0x6E, 0xE1, 0xC0, 0x51, 0x1C,
+  0x6B, 0xEF, 0xC0, 0x95, 0x60, 0xE3, 0xC0, 0xA0, 0x87, 0xAE, 0xC0, 0x70, 0x83, 0x6C, 0xEC, 0xC0,
+  0x99, 0x3B, 0x65, 0xEB, 0xC0, 0x96, 0xD5, 0x72, 0xE1, 0x40, 0xA0, 0x36, 0xA1, 0x26, 0x70, 0xE1,
+  0x69, 0x81, 0xAE, 0x0E, 0x07, 0x16, 0x11, 0x05, 0x19, 0x0A, 0x10, 0x0F, 0x07, 0x20, 0x49, 0x07,
+  0x86, 0x79, 0x66, 0x69, 0xEC, 0xC0, 0x9F, 0x76, 0xF4, 0x03, 0x06, 0x87, 0x78, 0x65, 0xEE, 0xC0,
+  0x9F, 0x1D, 0xE9, 0x40, 0x48, 0x05, 0xC0, 0x20, 0x12, 0x65, 0x67, 0x65, 0xE2, 0x62, 0xF2, 0x04,
+  0xC0, 0x6B, 0x1E, 0xE5, 0x04, 0xC0, 0x9F, 0xE3, 0x70, 0x6F, 0x6C, 0xE5, 0xC0, 0x6D, 0xCB, 0x70,
+  0xEF, 0xC0, 0xA0, 0x94, 0xEE, 0x02, 0x88, 0x75, 0xF2, 0x69, 0x81, 0xAE, 0xC0, 0xA1, 0x09, 0x61,
+  0x65, 0x63, 0x6F, 0x6C, 0x61, 0x74, 0x69, 0x67, 0x69, 0xE4, 0xC0, 0xA0, 0x7E, 0x6D, 0x61, 0x65,
+  0x72, 0x64, 0x65, 0xF0, 0xC0, 0x71, 0x56, 0x6C, 0xE5, 0x02, 0x88, 0x6E, 0x61, 0x70, 0x79, 0xF3,
+  0xC0, 0x5F, 0xE9, 0xE3, 0xC0, 0x85, 0xEE, 0xEB, 0x03, 0xA0, 0x55, 0x6E, 0x61, 0x6C, 0x66, 0x68,
+  0x74, 0x72, 0xEF, 0xC0, 0x6C, 0xE7, 0x69, 0x6C, 0x72, 0xE5, 0xC0, 0x64, 0xD5, 0xE5, 0x05, 0x0C,
+  0x09, 0x0D, 0x95, 0x76, 0x69, 0x72, 0x64, 0x68, 0x73, 0x61, 0x6C, 0xE6, 0xC0, 0xA0, 0x3C, 0x74,
+  0x75, 0x70, 0x6D, 0x6F, 0xE3, 0xC0, 0x8D, 0x33, 0x6E, 0x69, 0x6C, 0xEE, 0x04, 0xC0, 0x8D, 0x0E,
+  0x6F, 0xEB, 0xC0, 0x79, 0xD7, 0x6B, 0x61, 0x6C, 0x66, 0x77, 0x6F, 0x6E, 0xF3, 0x69, 0x81, 0x2E,
+  0x6B, 0x6E, 0x69, 0x6C, 0x65, 0x74, 0xE1, 0xC0, 0x93, 0xAF, 0x67, 0x61, 0x74, 0x73, 0xEB, 0x81,
+  0x72, 0x65, 0xEC, 0xC0, 0xA0, 0x6D, 0x62, 0x65, 0xF7, 0x69, 0xC0, 0x8F, 0x49, 0xE1, 0x40, 0x48,
+  0x05, 0xAB, 0x2F, 0x30, 0x6D, 0x72, 0x6F, 0x66, 0x74, 0xE1, 0xC0, 0x8E, 0x4C, 0xEF, 0x08, 0x14,
+  0x06, 0x40, 0xA0, 0x0C, 0xA0, 0x22, 0xF4, 0x69, 0x81, 0xAE, 0x02, 0x86, 0x73, 0x6E, 0xE4, 0xC0,
+  0x82, 0x9C, 0x6C, 0x6C, 0xE4, 0x81, 0xF4, 0xC0, 0xA0, 0x2F, 0x6C, 0x6E, 0xF5, 0xC0, 0x9E, 0x37,
+  0xE8, 0x02, 0x90, 0xF3, 0x69, 0x81, 0xAE, 0x06, 0x40, 0x97, 0xBD, 0xA7, 0xCD, 0x78, 0x69, 0xEC,
+  0xC0, 0x8C, 0x99, 0xF0, 0xC0, 0x7C, 0xFE, 0xEE, 0x6A, 0xC0, 0x9E, 0x1B, 0xED, 0x69, 0x06, 0x40,
+  0x9B, 0x24, 0xA3, 0x0E, 0xAE, 0xC0, 0x5F, 0x2B, 0xEC, 0x40, 0x8B, 0x23, 0xB3, 0xFD, 0xEB, 0x69,
+  0x81, 0xAE, 0x40, 0x4F, 0xEC, 0x40, 0x43, 0x11, 0x2C, 0xD9, 0x06, 0x1E, 0x8C, 0xEA, 0x69, 0x81,
+  0xAE, 0x20, 0x28, 0x0C, 0x20, 0x48, 0x0C, 0x0B, 0x21, 0x07, 0x20, 0x3C, 0x20, 0x3C, 0x20, 0x55,
+  0x20, 0x30, 0x28, 0x4D, 0x20, 0x4F, 0x20, 0x25, 0x20, 0x23, 0x20, 0x63, 0x28, 0x0D, 0x20, 0x3A,
+  0x20, 0x21, 0x23, 0x2E, 0x20, 0x85, 0x20, 0x3E, 0x84, 0x7A, 0x37, 0x32, 0x74, 0x68, 0x72, 0x2D,
+  0x2D, 0xEE, 0xC0, 0xA0, 0xDD, 0xF9, 0x0B, 0x05, 0x0F, 0x09, 0x07, 0x05, 0x06, 0x06, 0xC0, 0x9E,
+  0x85, 0x76, 0xE1, 0xC0, 0x8A, 0xC9, 0x75, 0x36, 0x64, 0x32, 0x37, 0x73, 0x72, 0x6A, 0x64, 0x2D,
+  0x2D, 0xEE, 0xC0, 0xA0, 0xBD, 0x72, 0x67, 0xEE, 0x40, 0x53, 0xE5, 0xC0, 0x4B, 0xC8, 0x70, 0xF0,
+  0x40, 0x5E, 0x81, 0xBD, 0xF1, 0x6D, 0xEF, 0xC0, 0x76, 0xDE, 0xEC, 0x37, 0x2D, 0xC0, 0x87, 0x7C,
+  0x6B, 0x6E, 0xE1, 0xC0, 0x9C, 0x58, 0x61, 0x64, 0x79, 0xEE, 0xC0, 0x36, 0xAF, 0x78, 0x35, 0x79,
+  0x74, 0x6C, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0xA0, 0x89, 0x77, 0x6F, 0x6E, 0x73, 0x65, 0x74, 0x69,
+  0xE8, 0xC0, 0x9D, 0x5B, 0xF5, 0x07, 0x05, 0x07, 0x04, 0x11, 0xA0, 0xD3, 0x79, 0xEE, 0xC0, 0x9C,
+  0x76, 0x73, 0x74, 0x6F, 0xEB, 0xC0, 0x38, 0x51, 0xF0, 0xC0, 0x9C, 0x6B, 0xE8, 0x04, 0xC0, 0x9F,
+  0x3F, 0x73, 0x75, 0x79, 0x6B, 0x61, 0x74, 0x69, 0xEB, 0x6A, 0xC0, 0x25, 0x39, 0x66, 0x69, 0xE7,
+  0x69, 0x81, 0xAE, 0x07, 0x18, 0x1D, 0x06, 0x20, 0x31, 0x8A, 0xF5, 0x02, 0x91, 0xF3, 0x04, 0xC0,
+  0x5B, 0x25, 0xF4, 0x02, 0x84, 0xEF, 0xC0, 0x9B, 0xD0, 0x61, 0xED, 0xC0, 0x22, 0xE0, 0xE6, 0xC0,
+  0x8E, 0x25, 0xEF, 0x0B, 0x07, 0x06, 0x40, 0x4C, 0xBA, 0x2D, 0xDA, 0xC0, 0x2E, 0x08, 0x73, 0x69,
+  0x68, 0xE3, 0xC0, 0x7B, 0xE0, 0x6D, 0x61, 0xEB, 0xC0, 0x28, 0x15, 0xE4, 0xC0, 0x9E, 0xCE, 0x6E,
+  0x61, 0xEE, 0xC0, 0x8E, 0x02, 0xE9, 0x09, 0x0A, 0x08, 0x0F, 0x40, 0x20, 0xCB, 0xA8, 0xBB, 0xED,
+  0x04, 0xC0, 0x27, 0xB3, 0x61, 0xEE, 0xC0, 0x26, 0x69, 0xEB, 0x32, 0x91, 0x40, 0x88, 0x4C, 0xA3,
+  0xBE, 0x68, 0xE3, 0x02, 0x86, 0x75, 0x6F, 0xEE, 0xC0, 0x84, 0x70, 0x61, 0xF0, 0xC0, 0x94, 0x54,
+  0x67, 0x6F, 0xE8, 0xC0, 0x2A, 0xFD, 0xE5, 0x02, 0x84, 0xF5, 0xC0, 0x27, 0x67, 0xEB, 0xBA, 0xB8,
+  0xE1, 0x09, 0x19, 0x09, 0x14, 0x05, 0x04, 0xC0, 0x83, 0xDA, 0x77, 0xE1, 0x02, 0x8A, 0x6B, 0x61,
+  0x72, 0x69, 0x68, 0xF3, 0x69, 0xC0, 0x28, 0xAE, 0xE7, 0x02, 0x84, 0x75, 0xF3, 0xA6, 0xF0, 0xE9,
+  0xC0, 0x3B, 0x19, 0x74, 0x61, 0x67, 0xE1, 0x40, 0x4A, 0x95, 0xA2, 0x7A, 0x72, 0x61, 0x68, 0xE1,
+  0x04, 0xC0, 0x6F, 0x0D, 0x67, 0xE9, 0x04, 0xC0, 0x46, 0x08, 0x6D, 0x61, 0xEB, 0xC0, 0x84, 0x8B,
+  0xED, 0x2B, 0x47, 0xB2, 0xAE, 0xEB, 0xC0, 0x29, 0xF0, 0xE4, 0x40, 0x28, 0x15, 0xC0, 0x53, 0x33,
+  0x34, 0x72, 0x76, 0x70, 0x38, 0x2D, 0x2D, 0xEE, 0xC0, 0x9F, 0x77, 0xF4, 0x08, 0x0B, 0x04, 0x08,
+  0x0C, 0xC0, 0x9E, 0x10, 0xF5, 0x04, 0xC0, 0x9E, 0x39, 0x6F, 0x6C, 0xEC, 0xC0, 0x7C, 0x27, 0x73,
+  0xE9, 0xBA, 0xC1, 0x6E, 0x65, 0x74, 0x6E, 0x6F, 0xE3, 0xB4, 0x30, 0xE5, 0x02, 0x85, 0x76, 0xEC,
+  0xC0, 0x83, 0x54, 0xF2, 0xC0, 0x89, 0x04, 0xE1, 0x02, 0x86, 0x6F, 0x62, 0xE7, 0xC0, 0x98, 0xC5,
+  0x63, 0x79, 0x73, 0xF3, 0xC0, 0x9B, 0x40, 0xF3, 0x08, 0x0A, 0x0F, 0x09, 0x06, 0xC0, 0x53, 0xE6,
+  0x78, 0x76, 0x70, 0x34, 0x2D, 0x2D, 0xEE, 0xC0, 0x9F, 0x28, 0xF5, 0x05, 0x05, 0xC0, 0x83, 0x1B,
+  0x72, 0xF5, 0xC0, 0x96, 0x3C, 0xE2, 0xC0, 0x9C, 0x07, 0x73, 0x69, 0x6B, 0x68, 0x63, 0xEE, 0xC0,
+  0x80, 0xE4, 0xF0, 0x40, 0x5D, 0xE0, 0xBD, 0xF0, 0x39, 0x6E, 0x76, 0x66, 0x65, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x9E, 0xFF, 0xF2, 0x09, 0x07, 0x05, 0x20, 0x2A, 0x0A, 0xC0, 0x9D, 0x6F, 0x75, 0x66, 0x65,
+  0xEB, 0xC0, 0x95, 0xED, 0xEF, 0x69, 0xC0, 0x9D, 0x5F, 0xE5, 0x07, 0x09, 0x0C, 0x04, 0xC0, 0x9C,
+  0xCC, 0xF4, 0x04, 0xC0, 0x44, 0xB4, 0xE1, 0xC0, 0x4C, 0x50, 0x70, 0xF0, 0x06, 0x40, 0x9B, 0xAC,
+  0xA1, 0xAA, 0xE9, 0xC0, 0x6C, 0xEF, 0xE9, 0xC0, 0x93, 0x63, 0xE4, 0x04, 0xC0, 0x78, 0xE6, 0xF7,
+  0xC0, 0x58, 0xDF, 0x61, 0x74, 0x73, 0x65, 0x6C, 0x74, 0xF4, 0xC0, 0x93, 0x82, 0x32, 0x78, 0x72,
+  0x6F, 0x36, 0x2D, 0x2D, 0xEE, 0xC0, 0x9E, 0xAA, 0xF0, 0x03, 0xA0, 0x28, 0xEF, 0x03, 0x0B, 0x89,
+  0x72, 0xE4, 0x04, 0xC0, 0x45, 0x15, 0x6E, 0xE9, 0xC0, 0x91, 0xFE, 0xF0, 0x03, 0xA9, 0x1F, 0x79,
+  0xE4, 0xC0, 0x61, 0x5A, 0x68, 0xF3, 0x05, 0x04, 0xC0, 0x88, 0x40, 0xF9, 0xC0, 0x92, 0xDE, 0x69,
+  0xE9, 0xC0, 0x26, 0x10, 0xE1, 0xC0, 0x99, 0xC1, 0xEF, 0x1A, 0x21, 0x42, 0x0A, 0x21, 0x2F, 0x0A,
+  0x07, 0x21, 0x8F, 0x06, 0x04, 0x20, 0xF9, 0x22, 0xFD, 0x04, 0x0B, 0x40, 0x5D, 0x0B, 0x2C, 0x88,
+  0xC0, 0x2B, 0x80, 0x79, 0x6B, 0x6F, 0xF4, 0x69, 0x81, 0xAE, 0x07, 0x0E, 0x20, 0x44, 0x20, 0x38,
+  0x95, 0xF5, 0x04, 0x05, 0xBF, 0xD5, 0x6B, 0xF5, 0xC0, 0x20, 0x7C, 0xE6, 0xC0, 0x58, 0x63, 0xEF,
+  0x09, 0x06, 0x12, 0x06, 0x12, 0x06, 0xC0, 0x7C, 0x1D, 0x79, 0x6B, 0xEE, 0xC0, 0x92, 0x8E, 0xF4,
+  0x06, 0x40, 0x87, 0xA4, 0xA4, 0xB1, 0xE1, 0x04, 0xC0, 0x86, 0xAC, 0x6D, 0x61, 0xF9, 0xC0, 0x27,
+  0x15, 0x72, 0x75, 0xE7, 0xC0, 0x9A, 0xC0, 0xEE, 0x04, 0x04, 0xBF, 0xF3, 0x75, 0xF2, 0xA0, 0xC1,
+  0x69, 0xE8, 0x69, 0x81, 0x73, 0xE1, 0xC0, 0x94, 0x19, 0x6A, 0x69, 0xE8, 0xC0, 0x28, 0x16, 0xE8,
+  0xC0, 0x24, 0x6F, 0xE9, 0x05, 0x06, 0x10, 0x13, 0x84, 0x6D, 0x61, 0xEE, 0xC0, 0x21, 0x91, 0xEA,
+  0x02, 0x86, 0x6F, 0x69, 0xE8, 0xC0, 0x27, 0xFD, 0x6E, 0x75, 0x62, 0xF5, 0xC0, 0x27, 0x37, 0xE8,
+  0x02, 0x87, 0x73, 0x61, 0x62, 0xE1, 0xC0, 0x91, 0x77, 0x63, 0xE1, 0x04, 0xC0, 0x74, 0xE8, 0xF4,
+  0xBC, 0xD6, 0xE7, 0xC0, 0x24, 0x2B, 0x65, 0x6E, 0xE1, 0xAC, 0x18, 0xE5, 0x06, 0x0A, 0x25, 0x47,
+  0xB8, 0x96, 0xED, 0x04, 0xC0, 0x9C, 0xA5, 0x75, 0x72, 0xF5, 0xB7, 0x8F, 0x64, 0xEF, 0xA9, 0x01,
+  0xE1, 0x09, 0x0A, 0x13, 0x06, 0x03, 0x1A, 0x20, 0x32, 0x8A, 0xF9, 0x03, 0xBB, 0xC4, 0x61, 0x67,
+  0xE1, 0xC0, 0x4F, 0xE8, 0x77, 0xE1, 0x02, 0x87, 0xEB, 0x40, 0x24, 0x33, 0xC0, 0x22, 0x63, 0xE7,
+  0x03, 0xA2, 0x7C, 0xEF, 0xC0, 0x9C, 0x4C, 0xF4, 0x40, 0x99, 0x04, 0xA3, 0x70, 0xF3, 0xAD, 0xE0,
+  0xF2, 0x03, 0x04, 0x86, 0xF5, 0xC0, 0x7D, 0x18, 0x69, 0x61, 0xE4, 0xC0, 0x86, 0xEF, 0xE1, 0x02,
+  0x85, 0x77, 0x61, 0xF3, 0xB0, 0x07, 0x68, 0xEF, 0xA8, 0xB7, 0xED, 0x02, 0x99, 0xE9, 0x04, 0xC0,
+  0x7A, 0x7E, 0x68, 0xF3, 0x05, 0x06, 0x04, 0xA1, 0xF8, 0x75, 0x7A, 0xF5, 0xC0, 0x86, 0xCE, 0xE9,
+  0xC0, 0x4A, 0xD3, 0xE1, 0xA3, 0x9D, 0xE1, 0x02, 0x8F, 0x79, 0x61, 0x72, 0x75, 0x6D, 0x69, 0x68,
+  0x73, 0xE1, 0x40, 0x26, 0x39, 0xC0, 0x6D, 0x14, 0xF4, 0x69, 0xBC, 0xD2, 0xEB, 0x03, 0xB8, 0x16,
+  0x69, 0x68, 0xF3, 0xC0, 0x28, 0xBF, 0xE4, 0x03, 0xBB, 0xA2, 0xE9, 0x04, 0xC0, 0x97, 0x58, 0xE8,
+  0x81, 0xE3, 0xC0, 0x91, 0x87, 0x77, 0x74, 0x63, 0x31, 0x2D, 0x2D, 0xEE, 0xC0, 0x9D, 0x13, 0x74,
+  0xEF, 0x03, 0xA0, 0xAD, 0x79, 0xEB, 0x69, 0x81, 0xAE, 0x07, 0x10, 0x20, 0x2D, 0x06, 0x0E, 0x93,
+  0xF5, 0x02, 0x87, 0xFA, 0x40, 0x24, 0x1C, 0xC0, 0x74, 0x5C, 0x72, 0x75, 0xFA, 0xC0, 0x83, 0x9D,
+  0xEF, 0x07, 0x10, 0x0B, 0x04, 0xC0, 0x28, 0x27, 0xF9, 0x06, 0x3C, 0xF8, 0xC0, 0x72, 0x7F, 0x6B,
+  0xE1, 0x04, 0xC0, 0x9B, 0x5E, 0xEB, 0xB8, 0xBF, 0x72, 0x69, 0x68, 0x73, 0x61, 0x6D, 0x61, 0xF9,
+  0xC0, 0x27, 0x4B, 0xEB, 0xC0, 0x92, 0xDD, 0x67, 0x6E, 0x61, 0xF4, 0xB7, 0xC1, 0x6E, 0x61, 0xF4,
+  0xC0, 0x38, 0x1A, 0xE9, 0x05, 0x2E, 0x4F, 0xB8, 0xE5, 0x6B, 0x61, 0x7A, 0x61, 0xED, 0xC0, 0x29,
+  0x4B, 0xE5, 0x07, 0x40, 0x75, 0x7E, 0xC0, 0x24, 0x9D, 0x62, 0xE1, 0x03, 0xB6, 0x77, 0x6E, 0x61,
+  0xF4, 0x69, 0xB7, 0x9A, 0xE1, 0x06, 0x06, 0x08, 0x07, 0x0E, 0x8D, 0xF4, 0x32, 0x04, 0xC0, 0x86,
+  0x0C, 0x72, 0x61, 0x77, 0x61, 0x74, 0xE9, 0xAE, 0x21, 0x6E, 0x69, 0x68, 0xF3, 0xC0, 0x47, 0x6D,
+  0x6D, 0x61, 0x79, 0xE9, 0x04, 0xC0, 0x24, 0x2B, 0xE8, 0x40, 0x23, 0x05, 0xA2, 0x69, 0xEB, 0x04,
+  0x05, 0xB7, 0xAD, 0x75, 0xFA, 0xC0, 0x80, 0xF3, 0xEF, 0xB2, 0x7E, 0x62, 0x6D, 0x61, 0xF4, 0xB7,
+  0x5D, 0x6D, 0x61, 0x6D, 0x75, 0xEB, 0x69, 0x81, 0xAE, 0x06, 0x05, 0x20, 0x2F, 0x1B, 0x87, 0xF5,
+  0x29, 0x65, 0xA7, 0xE1, 0xEF, 0x09, 0x04, 0x17, 0x40, 0x45, 0x26, 0xC0, 0x54, 0xFC, 0xF9, 0xC0,
+  0x56, 0x60, 0xF4, 0x05, 0x09, 0xC0, 0x47, 0x19, 0xF5, 0x69, 0x81, 0x6B, 0x6F, 0xF9, 0xC0, 0x9A,
+  0xEE, 0x6F, 0xED, 0x40, 0x23, 0xDE, 0xC0, 0x72, 0x88, 0x72, 0x69, 0x68, 0x73, 0x75, 0x73, 0xF4,
+  0xC0, 0x97, 0xB6, 0xE9, 0x04, 0x03, 0x08, 0x86, 0xF2, 0xA0, 0xB3, 0x6E, 0x75, 0x67, 0xEF, 0x69,
+  0xC0, 0x26, 0x8B, 0xEB, 0x2D, 0x78, 0xC0, 0x8B, 0x72, 0x68, 0xE3, 0xC0, 0x21, 0x8F, 0x65, 0x6E,
+  0x75, 0xE6, 0xC0, 0x9A, 0xE2, 0xE1, 0x05, 0x05, 0x0A, 0xA1, 0x3A, 0x74, 0xE1, 0xC0, 0x26, 0x70,
+  0x73, 0x75, 0x6B, 0x61, 0x6D, 0xE1, 0x69, 0xC0, 0x25, 0xB7, 0x72, 0xE1, 0xB4, 0x0E, 0x72, 0x6F,
+  0x70, 0x70, 0x61, 0xF3, 0x6A, 0xC0, 0x20, 0xBE, 0xEF, 0x40, 0x86, 0x31, 0x34, 0x78, 0x94, 0x6E,
+  0x61, 0x67, 0x61, 0xEE, 0x69, 0x81, 0xAE, 0x08, 0x15, 0x20, 0x2C, 0x0F, 0x20, 0x68, 0x8F, 0xF5,
+  0x02, 0x88, 0x73, 0x74, 0x61, 0x6D, 0xE5, 0xC0, 0x95, 0x84, 0xEB, 0x04, 0xC0, 0x97, 0xC7, 0x6F,
+  0xE8, 0xC0, 0x21, 0xBE, 0xEF, 0x06, 0x07, 0x05, 0x16, 0xBC, 0x78, 0x73, 0xE9, 0x40, 0x95, 0x79,
+  0xA1, 0xA8, 0x72, 0xEF, 0xC0, 0x85, 0x14, 0xEE, 0x04, 0x0A, 0xA1, 0x88, 0xE9, 0x04, 0xC0, 0x96,
+  0xD7, 0x6D, 0xF5, 0xC0, 0x85, 0x34, 0xE1, 0x40, 0x6C, 0xCF, 0xC0, 0x28, 0x90, 0xE8, 0xB8, 0xB4,
+  0xEE, 0x03, 0xB3, 0xE3, 0x65, 0x73, 0x6E, 0x6F, 0x61, 0x77, 0x61, 0xFA, 0xC0, 0x99, 0xE9, 0xE9,
+  0x07, 0x0E, 0x0B, 0x20, 0x20, 0xA0, 0x23, 0xF2, 0x04, 0x05, 0xBF, 0x68, 0x6F, 0xED, 0xC0, 0x24,
+  0xA2, 0x69, 0xEA, 0xAE, 0x17, 0xED, 0x05, 0x38, 0x64, 0xAB, 0x33, 0xEF, 0x69, 0xC0, 0x9A, 0x46,
+  0xEB, 0x05, 0x08, 0x07, 0xA6, 0xDF, 0x75, 0x7A, 0x69, 0x68, 0xE3, 0xC0, 0x99, 0x43, 0x69, 0xE1,
+  0x40, 0x25, 0x34, 0xA0, 0x87, 0xE1, 0x06, 0x40, 0x97, 0x48, 0xA1, 0x6C, 0xED, 0xC0, 0x25, 0xAE,
+  0xE8, 0x05, 0x07, 0xC0, 0x26, 0x2B, 0x73, 0x75, 0x6B, 0xE1, 0xC0, 0x26, 0x42, 0xE3, 0x02, 0x86,
+  0x75, 0x6F, 0xEE, 0xC0, 0x46, 0x07, 0xE1, 0x69, 0x81, 0x6D, 0xEF, 0x69, 0x81, 0xEE, 0x81, 0xE1,
+  0xC0, 0x21, 0x5F, 0xE7, 0xC0, 0x24, 0x4C, 0xE5, 0x05, 0x04, 0xC0, 0x26, 0x1F, 0x73, 0xF5, 0xB7,
+  0x5B, 0x6E, 0x61, 0xE7, 0xBB, 0x25, 0xE1, 0x0D, 0x08, 0x20, 0x32, 0x0A, 0x09, 0x0C, 0x1F, 0x1B,
+  0x14, 0xC0, 0x6D, 0xD6, 0x79, 0xE1, 0x40, 0x23, 0x21, 0xC0, 0x71, 0xB1, 0xF7, 0x03, 0x0C, 0x88,
+  0xF5, 0x02, 0x85, 0xF3, 0x69, 0xC0, 0x26, 0x5E, 0xEB, 0xC0, 0x59, 0xAA, 0x6F, 0x6E, 0x69, 0xED,
+  0x69, 0xC0, 0x25, 0x4A, 0xE1, 0x03, 0x06, 0x84, 0x7A, 0x69, 0xF5, 0xC0, 0x69, 0xED, 0xEB, 0xC0,
+  0x25, 0x64, 0xE7, 0x04, 0xC0, 0x99, 0xA5, 0xE1, 0x40, 0x6B, 0xFE, 0xC0, 0x2D, 0x90, 0xF4, 0x03,
+  0xBE, 0xC8, 0xE1, 0x81, 0xE7, 0xC0, 0x45, 0x95, 0xF2, 0x04, 0xC0, 0x7A, 0x42, 0xF5, 0xC0, 0x25,
+  0xBE, 0xEE, 0x04, 0xC0, 0x21, 0xB0, 0xE9, 0x69, 0x81, 0x68, 0xF3, 0xBC, 0x8D, 0xED, 0x05, 0x12,
+  0xC0, 0x20, 0x8A, 0xE9, 0x02, 0x84, 0xEA, 0xC0, 0x21, 0xA2, 0x68, 0x73, 0x75, 0x6B, 0x75, 0x66,
+  0x6F, 0xF3, 0xC0, 0x95, 0xFA, 0x61, 0xF9, 0x40, 0x21, 0x92, 0xA2, 0x27, 0xEB, 0x03, 0x03, 0x86,
+  0xEF, 0xAF, 0x03, 0x69, 0x68, 0xF3, 0xC0, 0x59, 0x3D, 0xE1, 0x04, 0xC0, 0x75, 0xDD, 0xF3, 0x04,
+  0xC0, 0x95, 0xF3, 0xF5, 0xC0, 0x76, 0x82, 0xE4, 0x05, 0x07, 0xC0, 0x21, 0x65, 0xE5, 0x40, 0x76,
+  0x78, 0xC0, 0x20, 0xB8, 0xE1, 0x40, 0x21, 0x6D, 0xC0, 0x75, 0xBA, 0xE2, 0xB2, 0xC8, 0x6B, 0x6F,
+  0xEE, 0xC0, 0x93, 0xC1, 0xE8, 0xC0, 0x75, 0xFD, 0xE7, 0x69, 0x03, 0xA0, 0xF0, 0x6F, 0x79, 0xE8,
+  0x69, 0x81, 0xAE, 0x07, 0x05, 0x20, 0x2C, 0x0F, 0xA0, 0x50, 0xF5, 0x39, 0x34, 0xA6, 0xD3, 0xEF,
+  0x0B, 0x04, 0x05, 0x03, 0x0C, 0x40, 0x24, 0xC2, 0xC0, 0x22, 0xBE, 0xF9, 0xC0, 0x96, 0x2A, 0x74,
+  0xEF, 0xC0, 0x94, 0x46, 0xF2, 0xBD, 0xDC, 0xEE, 0x06, 0x22, 0xC6, 0xC0, 0x96, 0x28, 0x75, 0xF3,
+  0xC0, 0x29, 0xA2, 0x67, 0x61, 0x73, 0xE1, 0x69, 0xC0, 0x23, 0x3A, 0xEE, 0x02, 0x87, 0x65, 0x73,
+  0x6E, 0xEF, 0xC0, 0x20, 0x3D, 0x61, 0xEE, 0xC0, 0x75, 0xC5, 0xE9, 0x09, 0x06, 0x04, 0x05, 0x20,
+  0x21, 0x0B, 0xBC, 0x4C, 0x72, 0x6F, 0xE7, 0xC0, 0x23, 0xA7, 0xEF, 0xC0, 0x89, 0xF2, 0x6D, 0xE1,
+  0xC0, 0x8D, 0x6D, 0xEB, 0x02, 0x89, 0xE9, 0x04, 0xC0, 0x98, 0xAB, 0xE8, 0xC0, 0x71, 0xD8, 0xE1,
+  0x03, 0x04, 0x8A, 0xF7, 0xC0, 0x23, 0xA3, 0xF3, 0x04, 0xC0, 0x23, 0x50, 0x61, 0xE7, 0xC0, 0x45,
+  0x89, 0xE7, 0xA5, 0x52, 0xEA, 0x03, 0xB3, 0xFB, 0x61, 0x77, 0xE1, 0x69, 0xC0, 0x24, 0x1F, 0x68,
+  0xF3, 0x03, 0xBC, 0x24, 0xE9, 0x3E, 0xD3, 0xC0, 0x68, 0xF5, 0xE1, 0x0A, 0x0C, 0x18, 0x0E, 0x13,
+  0x2A, 0x10, 0xC0, 0x67, 0xDF, 0x79, 0xE9, 0x04, 0xC0, 0x20, 0x4F, 0x6D, 0x6F, 0xEE, 0xC0, 0x23,
+  0x69, 0x77, 0xE1, 0x02, 0x8B, 0xEB, 0x04, 0xC0, 0x97, 0x4D, 0xE9, 0x40, 0x24, 0xD3, 0xA0, 0x4A,
+  0xE7, 0x03, 0xBF, 0xCA, 0x6F, 0xEB, 0xC0, 0x7E, 0x62, 0xED, 0x02, 0x84, 0xE9, 0xC0, 0x4E, 0xF2,
+  0x61, 0x79, 0x61, 0xF3, 0xC0, 0x95, 0x72, 0xEB, 0x05, 0x07, 0xC0, 0x87, 0x79, 0x75, 0x7A, 0x61,
+  0xF2, 0xC0, 0x22, 0x8F, 0xEF, 0x40, 0x95, 0x14, 0xA2, 0xB8, 0xE2, 0xBB, 0x75, 0xE9, 0xC0, 0x8C,
+  0xDF, 0x64, 0x69, 0x61, 0x6B, 0x6B, 0x6F, 0xE8, 0x69, 0x81, 0xAE, 0x0B, 0x20, 0xA9, 0x20, 0x61,
+  0x20, 0x20, 0x20, 0xB6, 0xA0, 0x58, 0xF5, 0x09, 0x0A, 0x07, 0x20, 0x61, 0x03, 0x16, 0x0B, 0x84,
+  0x7A, 0x69, 0x6D, 0x69, 0x68, 0xF3, 0x69, 0xC0, 0x82, 0x93, 0x79, 0x72, 0xF5, 0x69, 0xC0, 0x33,
+  0x35, 0xF3, 0x05, 0x04, 0xC0, 0x22, 0x45, 0xF5, 0xC0, 0x23, 0x4F, 0xF4, 0x03, 0x07, 0x87, 0x75,
+  0x66, 0x75, 0xF2, 0xC0, 0x95, 0x13, 0x6F, 0x6E, 0x69, 0x68, 0xF3, 0xBF, 0x44, 0x65, 0xE2, 0x08,
+  0x0B, 0x09, 0x08, 0x0D, 0xC0, 0x97, 0x82, 0xF5, 0x05, 0x2C, 0xFC, 0xB2, 0x4D, 0x70, 0xF0, 0xC0,
+  0x75, 0xA4, 0xEF, 0x40, 0x23, 0x1D, 0x40, 0x74, 0x43, 0xA0, 0x70, 0x6E, 0xEF, 0x40, 0x22, 0xD6,
+  0xC0, 0x74, 0x03, 0xED, 0x04, 0xC0, 0x97, 0x8A, 0xEF, 0x04, 0xC0, 0x97, 0xA9, 0xF4, 0xBA, 0xA5,
+  0xE9, 0x05, 0x06, 0xC0, 0x97, 0xA9, 0x72, 0x6F, 0xE2, 0xC0, 0x97, 0x2C, 0x68, 0xF3, 0x69, 0xC0,
+  0x97, 0xA6, 0xF2, 0xBC, 0xB6, 0x70, 0xF0, 0x05, 0x0B, 0xC0, 0x92, 0x1B, 0x65, 0xEE, 0x04, 0xC0,
+  0x52, 0x1C, 0x69, 0xEF, 0xC0, 0x96, 0x1C, 0x61, 0xEB, 0xBC, 0xE7, 0xED, 0x04, 0xC0, 0x64, 0x0D,
+  0x61, 0x73, 0xF3, 0xC0, 0x7D, 0x15, 0x6B, 0xEF, 0xB6, 0x4D, 0x62, 0xE1, 0xC0, 0x8E, 0x71, 0xEF,
+  0x08, 0x0E, 0x20, 0x2E, 0x0F, 0x08, 0xBB, 0x3E, 0xF4, 0x04, 0x04, 0xA7, 0x05, 0xE5, 0xC0, 0x92,
+  0x5A, 0xE1, 0x81, 0xF3, 0xB1, 0x94, 0xF2, 0x03, 0x05, 0x9C, 0x75, 0xED, 0xC0, 0x97, 0x38, 0xEF,
+  0x06, 0x04, 0x04, 0xC0, 0x2A, 0x83, 0xF9, 0xC0, 0x95, 0x59, 0xF0, 0xC0, 0x33, 0xAF, 0xE8, 0x04,
+  0xC0, 0x96, 0x48, 0xE9, 0x04, 0xC0, 0x97, 0x1A, 0xE8, 0xA5, 0xA9, 0x69, 0xE8, 0x04, 0xC0, 0x20,
+  0xF9, 0xE9, 0xB4, 0x98, 0x6E, 0x61, 0x72, 0x75, 0xE6, 0x69, 0x81, 0x69, 0x6D, 0xE1, 0x40, 0x80,
+  0xB9, 0xB2, 0xF7, 0xED, 0x04, 0xC0, 0x44, 0x13, 0xF5, 0xBA, 0x9F, 0x6B, 0xE1, 0xC0, 0x93, 0xEE,
+  0xEE, 0x02, 0x85, 0x75, 0xE2, 0xC0, 0x95, 0x63, 0xE1, 0x06, 0x07, 0x04, 0xC0, 0x8A, 0xAA, 0x74,
+  0x6F, 0x6B, 0xE1, 0xC0, 0x95, 0xDC, 0x72, 0xEF, 0xB4, 0xA3, 0x68, 0x63, 0xF4, 0xC0, 0x8A, 0xE5,
+  0xE9, 0x0B, 0x1E, 0x08, 0x08, 0x0D, 0x0A, 0x20, 0x2D, 0xC0, 0x6B, 0x0D, 0xF2, 0x03, 0x07, 0x8B,
+  0x6F, 0x74, 0x61, 0xF2, 0xC0, 0x92, 0x0A, 0x69, 0x68, 0xF3, 0x04, 0xC0, 0x93, 0x43, 0xE1, 0xC0,
+  0x94, 0x71, 0xE1, 0x2F, 0xFF, 0x32, 0x46, 0xC0, 0x73, 0x67, 0x6F, 0xE1, 0x40, 0x22, 0xBD, 0xC0,
+  0x72, 0xE2, 0xED, 0x04, 0xC0, 0x21, 0xBD, 0xEF, 0xBD, 0xA6, 0xEB, 0x02, 0x86, 0xE9, 0x40, 0x85,
+  0xEF, 0xB0, 0xA9, 0x61, 0xED, 0xBF, 0x24, 0x6A, 0x75, 0x66, 0x69, 0x72, 0x69, 0xE8, 0xC0, 0x37,
+  0x4B, 0xE8, 0x02, 0x99, 0xF3, 0x04, 0x05, 0x06, 0x85, 0x75, 0xE5, 0xC0, 0x48, 0x80, 0x6F, 0x6B,
+  0xEE, 0xC0, 0x8B, 0x05, 0x65, 0xEB, 0xC0, 0x45, 0x1D, 0xE1, 0xC0, 0x8A, 0x3A, 0xE3, 0x03, 0xB3,
+  0x5E, 0xF5, 0x02, 0x84, 0xE9, 0xC0, 0x22, 0x74, 0x62, 0x6D, 0xE5, 0xC0, 0x93, 0x03, 0xE1, 0x06,
+  0x20, 0x2A, 0xC0, 0x52, 0x3D, 0xEE, 0x05, 0x0C, 0x05, 0x06, 0x84, 0x75, 0x73, 0x74, 0xE1, 0x02,
+  0x83, 0xF3, 0xB9, 0x51, 0xED, 0xBD, 0xFE, 0x6F, 0xEB, 0xC0, 0x92, 0xE3, 0x69, 0x68, 0xF3, 0xC0,
+  0x50, 0x66, 0xE5, 0xC0, 0x22, 0xB9, 0xE1, 0x03, 0xBC, 0xED, 0xEB, 0x20, 0x51, 0xBA, 0x4E, 0x6D,
+  0x6F, 0x6B, 0xE1, 0xC0, 0x21, 0xB5, 0xE5, 0x09, 0x08, 0x06, 0x06, 0x09, 0x07, 0x0A, 0x04, 0x97,
+  0x75, 0x6F, 0xEE, 0x81, 0xE9, 0xC0, 0x20, 0x7D, 0x74, 0x61, 0xE4, 0x69, 0xB0, 0x34, 0x73, 0x6F,
+  0xF4, 0xC0, 0x73, 0xF2, 0x70, 0x70, 0x6F, 0x6B, 0xEF, 0x69, 0xC0, 0x21, 0x0D, 0x6E, 0x61, 0x6B,
+  0xE1, 0xC0, 0x8F, 0x98, 0xEB, 0x03, 0xA8, 0x84, 0x75, 0x66, 0xEF, 0xC0, 0x94, 0x95, 0xE9, 0xC0,
+  0x94, 0x11, 0xE2, 0x02, 0x8B, 0xEF, 0x04, 0xC0, 0x94, 0x86, 0xEE, 0x81, 0xEF, 0xC0, 0x7F, 0xC4,
+  0xE1, 0x04, 0xC0, 0x94, 0xC6, 0xF9, 0xC0, 0x7B, 0xF2, 0xE1, 0x37, 0xEE, 0xBA, 0x62, 0xE1, 0x0E,
+  0x20, 0x3A, 0x0A, 0x06, 0x1D, 0x1F, 0x0E, 0x05, 0x21, 0x68, 0xC0, 0x90, 0xAD, 0xF7, 0x04, 0x04,
+  0xB1, 0xD6, 0xE9, 0xC0, 0x7B, 0x30, 0xE1, 0x03, 0x06, 0x96, 0x7A, 0x69, 0x6D, 0xE1, 0xBC, 0x69,
+  0xEB, 0x09, 0x40, 0x21, 0x0D, 0x21, 0x3C, 0xC0, 0x6A, 0x8E, 0xE9, 0x06, 0x40, 0x20, 0x01, 0xA2,
+  0x1C, 0xE8, 0x3F, 0xB5, 0xA2, 0x11, 0x67, 0xE1, 0x02, 0x87, 0x6E, 0x75, 0xF3, 0x69, 0xC0, 0x20,
+  0x80, 0xEB, 0x40, 0x8A, 0xC8, 0xA8, 0xE6, 0x74, 0xE1, 0x03, 0xBB, 0xC1, 0x67, 0x69, 0xEB, 0xBD,
+  0x05, 0x73, 0x61, 0xEB, 0xC0, 0x95, 0x80, 0xF2, 0x03, 0x09, 0x83, 0xF5, 0x04, 0xC0, 0x92, 0x59,
+  0x67, 0xE1, 0xB0, 0x67, 0xEF, 0xAB, 0x81, 0x69, 0xE2, 0x06, 0x35, 0x56, 0xC0, 0x80, 0x17, 0xE1,
+  0x69, 0xC0, 0x44, 0x02, 0xED, 0x07, 0x05, 0x0D, 0x2F, 0x50, 0xB1, 0xAE, 0x6F, 0xF2, 0xC0, 0x92,
+  0x88, 0x69, 0x68, 0xF3, 0x04, 0xC0, 0x20, 0x04, 0x6F, 0x72, 0xE9, 0xC0, 0x20, 0x55, 0x61, 0x79,
+  0xE9, 0xBD, 0x15, 0xEB, 0x03, 0xB9, 0xAF, 0xF5, 0x02, 0x83, 0xEE, 0xBB, 0x1F, 0xE6, 0xC0, 0x90,
+  0x70, 0x68, 0x63, 0xE5, 0xB4, 0x70, 0x67, 0x61, 0x6B, 0x69, 0xE8, 0xC0, 0x84, 0x1D, 0xE1, 0xC0,
+  0x8C, 0x4D, 0x37, 0x71, 0x72, 0x62, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x96, 0x35, 0x31, 0x33, 0x31,
+  0x72, 0xEF, 0xC0, 0x95, 0x5E, 0xEE, 0x08, 0x09, 0x0E, 0x17, 0x0C, 0xC0, 0x7C, 0x92, 0xEF, 0x03,
+  0xBC, 0xD4, 0x73, 0xF4, 0xC0, 0x7A, 0xA4, 0x6E, 0x37, 0x70, 0x37, 0x71, 0x72, 0x74, 0x30, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x96, 0x0D, 0xE1, 0x02, 0x8D, 0xE9, 0x02, 0x84, 0xF6, 0xC0, 0x91, 0xE7, 0x6C,
+  0x6F, 0xE7, 0xC0, 0x73, 0x7D, 0x65, 0x62, 0x79, 0xEC, 0xC0, 0x8E, 0x45, 0x36, 0x35, 0x7A, 0x71,
+  0x68, 0x65, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0xEA, 0x33, 0x30, 0x73, 0x71, 0x6C, 0x31, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x95, 0xDE, 0xED, 0x06, 0x07, 0x0B, 0xC0, 0x79, 0x1B, 0x73, 0x69, 0x6F, 0xE7, 0xC0,
+  0x94, 0x93, 0x34, 0x31, 0x73, 0x33, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0xC5, 0x31, 0x31, 0x74,
+  0x71, 0x71, 0x71, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0xB9, 0xEC, 0x08, 0x08, 0x06, 0x40, 0x5C, 0x78,
+  0xB1, 0x02, 0x72, 0x69, 0x67, 0x65, 0xF4, 0xC0, 0x92, 0xFA, 0x65, 0x6C, 0xEC, 0xC0, 0x24, 0x9A,
+  0x33, 0x33, 0x75, 0x73, 0x73, 0x70, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0x96, 0xEB, 0x07, 0x0A, 0x07,
+  0x12, 0x0C, 0x08, 0x98, 0x6E, 0x75, 0x70, 0x61, 0x74, 0x69, 0xEC, 0xC0, 0x84, 0x39, 0x6C, 0x69,
+  0x6D, 0xF9, 0xC0, 0x69, 0x2A, 0x63, 0xE9, 0x05, 0x07, 0xC0, 0x7F, 0x2E, 0xF3, 0x81, 0x65, 0xF6,
+  0xC0, 0x84, 0x24, 0xE7, 0xC0, 0x88, 0x67, 0x37, 0x39, 0x37, 0x74, 0x69, 0x34, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x95, 0x5F, 0x35, 0x32, 0x32, 0x74, 0xE9, 0xC0, 0x95, 0x3F, 0xB4, 0x02, 0x8A, 0x79, 0x74,
+  0x6A, 0x64, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0x4A, 0x33, 0x71, 0x74, 0x72, 0x35, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x95, 0x3F, 0x32, 0x36, 0x72, 0x74, 0x6C, 0x38, 0x2D, 0x2D, 0xEE, 0xC0, 0x95, 0x33, 0xE9,
+  0x0D, 0x20, 0x44, 0x20, 0xEC, 0x22, 0x4B, 0x22, 0xE9, 0x21, 0x83, 0x04, 0x88, 0x75, 0x6B, 0x75,
+  0xE6, 0x69, 0x81, 0xAE, 0x06, 0x0A, 0x0F, 0x06, 0xBA, 0xF9, 0x6E, 0x65, 0x7A, 0x69, 0x68, 0x63,
+  0xE5, 0x69, 0xBF, 0x89, 0xE9, 0x07, 0x31, 0x8B, 0x2D, 0x15, 0xA1, 0x84, 0x6A, 0x69, 0x65, 0xE8,
+  0xC0, 0x4B, 0x0A, 0x65, 0x61, 0xE2, 0xC0, 0x91, 0x10, 0xE1, 0x05, 0x04, 0x0B, 0xB9, 0x84, 0x73,
+  0xE1, 0xB8, 0x39, 0x6D, 0xE1, 0x05, 0x26, 0x21, 0xAB, 0x1F, 0xF9, 0xC0, 0x20, 0x77, 0xE4, 0xBD,
+  0x70, 0x72, 0xEF, 0x05, 0x20, 0x50, 0xA0, 0x91, 0x74, 0x74, 0x6F, 0xF4, 0x69, 0x81, 0xAE, 0x07,
+  0x0D, 0x13, 0x08, 0x03, 0xA0, 0xDB, 0xF5, 0x02, 0x86, 0xFA, 0x40, 0x71, 0x89, 0xBE, 0xD3, 0xE2,
+  0xC0, 0x30, 0x1A, 0xEF, 0x03, 0x08, 0x84, 0x74, 0x61, 0x6E, 0x69, 0x6D, 0xE9, 0xBF, 0xD3, 0xEE,
+  0xC0, 0x70, 0x72, 0xE7, 0xAC, 0x22, 0x69, 0x72, 0x6F, 0x74, 0xF4, 0xC0, 0x93, 0x4A, 0xE5, 0xA2,
+  0xF2, 0xE1, 0x02, 0x87, 0x73, 0xE1, 0x37, 0xE4, 0xC0, 0x60, 0x2D, 0xF2, 0x02, 0x86, 0x75, 0x6F,
+  0xF4, 0xC0, 0x7E, 0x09, 0x61, 0xE8, 0xBC, 0x1B, 0x6D, 0x6F, 0xE1, 0x69, 0x81, 0xAE, 0x07, 0x09,
+  0x07, 0x20, 0x44, 0xA0, 0x20, 0xF5, 0x03, 0xBF, 0xC7, 0x72, 0x61, 0xE7, 0xBA, 0xD8, 0xEF, 0x03,
+  0xBA, 0x50, 0xEB, 0xBD, 0xAF, 0xE9, 0x08, 0x10, 0x06, 0x0A, 0x05, 0x05, 0x03, 0x89, 0xF2, 0x02,
+  0x87, 0x6F, 0xED, 0x81, 0xEF, 0xC0, 0x93, 0x50, 0x61, 0x6D, 0x6F, 0xE4, 0xB6, 0x37, 0x6E, 0x61,
+  0xF7, 0xC0, 0x93, 0x3B, 0x6D, 0x61, 0xEB, 0x81, 0x69, 0x68, 0xF3, 0xC0, 0x73, 0xE4, 0x6B, 0x61,
+  0xF3, 0xB7, 0x58, 0x6A, 0xE5, 0xC0, 0x7F, 0x4C, 0xE8, 0xA5, 0x9A, 0x67, 0x61, 0x6E, 0x61, 0x79,
+  0xE1, 0xC0, 0x87, 0xCC, 0x61, 0x6E, 0xE1, 0xBC, 0x60, 0xE5, 0x02, 0x85, 0x73, 0xE1, 0xC0, 0x64,
+  0x90, 0x68, 0x6F, 0xEE, 0x08, 0x05, 0x40, 0x6F, 0xEB, 0xC0, 0x22, 0xDE, 0x75, 0xEB, 0xC0, 0x8E,
+  0xC3, 0x69, 0x68, 0xE3, 0x40, 0x73, 0xAB, 0xBE, 0x2E, 0xE1, 0x03, 0x03, 0x84, 0xF7, 0xB6, 0xD6,
+  0x74, 0xF5, 0xB8, 0xA3, 0x64, 0xE1, 0xC0, 0x5D, 0x6E, 0xE3, 0xC0, 0x92, 0x7E, 0x6B, 0xE1, 0x05,
+  0x20, 0xA5, 0xA0, 0x97, 0x7A, 0x61, 0x79, 0x69, 0xED, 0x69, 0x81, 0xAE, 0x07, 0x05, 0x14, 0x09,
+  0x20, 0x23, 0x8D, 0x75, 0x72, 0xE1, 0xB6, 0x3D, 0xEF, 0x04, 0x05, 0xB8, 0x8C, 0xEE, 0x2D, 0x2D,
+  0xAD, 0x09, 0xEA, 0x04, 0xC0, 0x8F, 0x45, 0x6F, 0x6E, 0xEF, 0xB9, 0xC2, 0x6E, 0x61, 0x6E, 0x69,
+  0x68, 0xE3, 0xC0, 0x91, 0x52, 0xE9, 0x03, 0x0E, 0x88, 0xED, 0x02, 0x86, 0x6F, 0xF4, 0x32, 0xB8,
+  0xA7, 0x49, 0x61, 0x6E, 0xE9, 0xB3, 0x28, 0x6B, 0x61, 0x7A, 0xE1, 0x3A, 0xC7, 0xA2, 0x20, 0x68,
+  0x73, 0x61, 0x79, 0x61, 0xE2, 0xC0, 0x7D, 0x15, 0xE5, 0x02, 0x85, 0x73, 0xE1, 0xC0, 0x6B, 0xB8,
+  0x62, 0x61, 0xEE, 0xBC, 0xCD, 0xE1, 0x09, 0x07, 0x09, 0x0A, 0x05, 0x10, 0x06, 0xAD, 0x21, 0x77,
+  0x61, 0xE7, 0x3B, 0xD2, 0xA1, 0xA0, 0x74, 0xE1, 0x03, 0xB2, 0xF5, 0xED, 0xC0, 0x92, 0x58, 0xF2,
+  0x02, 0x83, 0xF5, 0xBD, 0x61, 0x65, 0xED, 0xBD, 0x50, 0x6D, 0x69, 0xE8, 0xBC, 0x1E, 0xEB, 0x02,
+  0x87, 0x75, 0x73, 0x74, 0xEF, 0xC0, 0x80, 0x53, 0x6F, 0x65, 0xE2, 0xC0, 0x91, 0xCA, 0x67, 0x75,
+  0xF9, 0xC0, 0x91, 0x55, 0x62, 0xE9, 0xC0, 0x91, 0x17, 0x73, 0xE1, 0x02, 0x86, 0x77, 0x61, 0xEB,
+  0x6A, 0xB8, 0x22, 0x67, 0x61, 0xEE, 0x69, 0x81, 0xAE, 0x05, 0x13, 0x1F, 0x06, 0x9C, 0x75, 0x73,
+  0xF4, 0x05, 0x08, 0xC0, 0x87, 0x3C, 0x6F, 0x6E, 0x69, 0x68, 0xE3, 0xC0, 0x86, 0x07, 0xE9, 0xBE,
+  0x3D, 0xEF, 0x03, 0x11, 0x84, 0xF4, 0x02, 0x8A, 0x6F, 0xE7, 0x69, 0x81, 0x69, 0x6D, 0x61, 0xEB,
+  0xB9, 0x5F, 0xE5, 0xC0, 0x90, 0x9B, 0x64, 0xE1, 0xBB, 0x3F, 0x62, 0x65, 0xF3, 0xC0, 0x8F, 0x19,
+  0x6E, 0x65, 0xFA, 0xC0, 0x6D, 0x22, 0xE9, 0x04, 0x03, 0x0C, 0x83, 0xED, 0xAD, 0x4C, 0xEB, 0x04,
+  0xC0, 0x90, 0xCD, 0xE1, 0x81, 0x73, 0xE1, 0xC0, 0x8C, 0xBF, 0xE8, 0xAE, 0x2A, 0x61, 0xEB, 0xC0,
+  0x45, 0x89, 0xE1, 0x05, 0x07, 0x06, 0x0D, 0x85, 0x79, 0x61, 0x68, 0xE1, 0xC0, 0x82, 0x6B, 0x77,
+  0x69, 0xEA, 0xC0, 0x6F, 0x91, 0xF2, 0x02, 0x86, 0xF5, 0x3D, 0x6A, 0xC0, 0x73, 0x41, 0x61, 0xE2,
+  0xBA, 0x29, 0x6E, 0x61, 0xF4, 0xBA, 0x4C, 0xED, 0x03, 0xAF, 0x0D, 0x69, 0x68, 0xF3, 0xB9, 0x16,
+  0x72, 0x61, 0x62, 0xE9, 0x69, 0x81, 0xAE, 0x07, 0x12, 0x20, 0x22, 0x20, 0x42, 0x95, 0xF5, 0x03,
+  0x03, 0x86, 0xF3, 0xBC, 0x6B, 0x6B, 0x69, 0xE8, 0xC0, 0x85, 0x8C, 0x66, 0xE9, 0xC0, 0x8C, 0xCC,
+  0xEF, 0x0C, 0x09, 0x04, 0x05, 0x30, 0xB4, 0x20, 0xE8, 0x2B, 0x31, 0xA1, 0x5E, 0xF4, 0x04, 0xC0,
+  0x91, 0x62, 0x61, 0xF3, 0xBD, 0x63, 0xF3, 0xC0, 0x85, 0x0F, 0x72, 0x69, 0xE8, 0xAB, 0x8E, 0xE7,
+  0xB9, 0xDC, 0xE9, 0x09, 0x08, 0x15, 0x05, 0x04, 0x04, 0xC0, 0x90, 0x6E, 0x72, 0x75, 0x6B, 0x75,
+  0x73, 0xF4, 0xB4, 0x8C, 0xEB, 0x04, 0x05, 0xB8, 0xDC, 0x69, 0x68, 0xF3, 0xB8, 0xB2, 0xE1, 0x03,
+  0xBA, 0x1B, 0x73, 0x61, 0x67, 0xF5, 0xC0, 0x64, 0x7C, 0xE8, 0x20, 0x93, 0xBC, 0xBB, 0x67, 0xE1,
+  0xB4, 0xA3, 0x65, 0xF3, 0xB8, 0x4B, 0xE1, 0x02, 0x85, 0x72, 0xE1, 0xC0, 0x91, 0x21, 0xEB, 0x40,
+  0x8E, 0x47, 0xA2, 0x8F, 0xE5, 0x06, 0x05, 0x05, 0xC0, 0x2A, 0x01, 0x74, 0x61, 0xE4, 0xBD, 0xA5,
+  0x64, 0xE9, 0xC0, 0x46, 0x55, 0x62, 0xEF, 0xBC, 0x81, 0xE1, 0x0B, 0x08, 0x0E, 0x0E, 0x1C, 0x10,
+  0x0C, 0x04, 0xC0, 0x8F, 0x1F, 0x79, 0xE9, 0x04, 0xC0, 0x7E, 0xFD, 0xED, 0x92, 0xF7, 0x04, 0xC0,
+  0x7D, 0x18, 0x61, 0xE7, 0x04, 0xC0, 0x90, 0xE4, 0xE1, 0xAF, 0x27, 0xF4, 0x02, 0x83, 0xEF, 0xA0,
+  0x3B, 0x61, 0xE7, 0x40, 0x3C, 0xD7, 0xC0, 0x52, 0x12, 0xF2, 0x02, 0x8E, 0xF5, 0x02, 0x85, 0x69,
+  0x68, 0xE3, 0xB8, 0x42, 0x61, 0x67, 0x69, 0xED, 0xB9, 0x0A, 0xE1, 0x03, 0xA7, 0x44, 0x68, 0x69,
+  0x68, 0xE3, 0xC0, 0x8E, 0xAC, 0xED, 0x05, 0x23, 0x55, 0xB9, 0xB4, 0xE1, 0x06, 0x37, 0x55, 0xC0,
+  0x49, 0xDA, 0xF4, 0xBA, 0xA3, 0x6B, 0x61, 0xEE, 0x69, 0x81, 0x69, 0xE8, 0x81, 0xE3, 0xC0, 0x6D,
+  0x70, 0xE7, 0xC0, 0x7B, 0x28, 0xE2, 0xAB, 0xC5, 0xE8, 0x03, 0xA0, 0xBF, 0xF3, 0x02, 0x85, 0x75,
+  0xE2, 0xC0, 0x90, 0x14, 0x61, 0x6E, 0x61, 0x6D, 0x61, 0xF9, 0x69, 0x81, 0xAE, 0x08, 0x10, 0x07,
+  0x20, 0x2A, 0x20, 0x2B, 0x85, 0xF5, 0x06, 0x04, 0x35, 0xE6, 0xA0, 0x3F, 0xE6, 0xC0, 0x7A, 0xFD,
+  0xE2, 0x39, 0x7C, 0xB3, 0x5D, 0x73, 0x70, 0x6C, 0x61, 0xAD, 0xBB, 0xF1, 0xEF, 0x06, 0x0F, 0x03,
+  0xC0, 0x6F, 0x77, 0xF4, 0x02, 0x84, 0xF5, 0xC0, 0x2B, 0x8C, 0x61, 0x73, 0x69, 0x6D, 0x61, 0xF7,
+  0xA2, 0xE1, 0xEE, 0xA0, 0xD6, 0xEB, 0x02, 0x8A, 0x69, 0x68, 0x63, 0x75, 0x67, 0x61, 0x77, 0xE1,
+  0xB6, 0xD4, 0x61, 0xEB, 0xA0, 0x23, 0xE9, 0x05, 0x13, 0xC0, 0x76, 0x29, 0xEB, 0x02, 0x89, 0xF5,
+  0x04, 0xC0, 0x8E, 0xBA, 0xE6, 0xC0, 0x7E, 0xD0, 0x61, 0x73, 0x61, 0xF2, 0xC0, 0x8E, 0xC8, 0xE8,
+  0x02, 0x8A, 0xF3, 0x04, 0xC0, 0x8C, 0x50, 0x61, 0xEE, 0xC0, 0x3C, 0x11, 0x63, 0x69, 0xED, 0xB3,
+  0x04, 0x65, 0x67, 0xF5, 0xBA, 0x24, 0xE1, 0x04, 0x12, 0x0E, 0x88, 0xF7, 0x04, 0xC0, 0x7B, 0xC9,
+  0xE1, 0x02, 0x85, 0x73, 0xF5, 0xC0, 0x33, 0x91, 0xEB, 0x33, 0xA5, 0xA5, 0xA4, 0xF2, 0x02, 0x85,
+  0x75, 0x73, 0xF4, 0xA2, 0xC0, 0x61, 0x68, 0x6F, 0xEE, 0xAE, 0xC8, 0x6D, 0x61, 0x79, 0x61, 0xE2,
+  0xC0, 0x7F, 0x1D, 0x64, 0x69, 0x68, 0x73, 0x6F, 0xF9, 0xB9, 0x29, 0xE3, 0x05, 0x20, 0x62, 0xA0,
+  0xA7, 0x75, 0x67, 0x61, 0x6D, 0x61, 0xF9, 0x69, 0x81, 0xAE, 0x07, 0x17, 0x07, 0x18, 0x0B, 0xB4,
+  0x3B, 0xF5, 0x09, 0x09, 0x2A, 0x50, 0x2C, 0xF6, 0xC0, 0x76, 0x06, 0x73, 0x74, 0x61, 0x6D, 0x61,
+  0xE4, 0xC0, 0x83, 0xA1, 0xE6, 0xC0, 0x8E, 0xBF, 0x6E, 0x61, 0x6E, 0xF5, 0xC0, 0x8E, 0x83, 0xE9,
+  0x06, 0x06, 0x04, 0xC0, 0x2B, 0xD7, 0x72, 0x61, 0xEB, 0xC0, 0x6C, 0x69, 0x6E, 0xF5, 0xA1, 0xB9,
+  0x6B, 0x65, 0x73, 0x6F, 0xEE, 0xBC, 0x1E, 0xE5, 0x04, 0xC0, 0x81, 0x07, 0x73, 0x75, 0xE2, 0xC0,
+  0x7E, 0xBE, 0xE1, 0x03, 0xB6, 0x68, 0xED, 0x02, 0x85, 0x69, 0xE8, 0xC0, 0x8E, 0x13, 0x61, 0x79,
+  0xF5, 0xBC, 0xCD, 0x6F, 0xEB, 0x69, 0x81, 0xAE, 0x06, 0x14, 0x20, 0x21, 0xA0, 0x2D, 0xF5, 0x02,
+  0x8B, 0x7A, 0x69, 0x6D, 0x69, 0x68, 0x73, 0x61, 0xF3, 0xC0, 0x8F, 0x0C, 0x6B, 0x6F, 0xEB, 0xC0,
+  0x2B, 0xBB, 0xEF, 0x04, 0x07, 0x04, 0x8B, 0x79, 0x6F, 0xF4, 0x69, 0xC0, 0x8F, 0x41, 0x74, 0xEF,
+  0xAC, 0xEB, 0xEE, 0x04, 0xC0, 0x8E, 0x29, 0x75, 0x73, 0xF4, 0x69, 0xB9, 0x38, 0x6D, 0x75, 0xEB,
+  0xC0, 0x8A, 0x79, 0xE9, 0x06, 0x04, 0x07, 0x09, 0x05, 0x87, 0x72, 0xE1, 0xA8, 0x7C, 0x6D, 0xE1,
+  0x32, 0x5A, 0xC0, 0x79, 0x54, 0xEB, 0x04, 0xC0, 0x8D, 0xA2, 0xE1, 0x69, 0xB5, 0x53, 0x6A, 0xE1,
+  0xC0, 0x60, 0xA5, 0x68, 0x63, 0xEF, 0x69, 0xC0, 0x8B, 0x97, 0x65, 0x73, 0xE9, 0xC0, 0x8E, 0x01,
+  0xE1, 0x07, 0x15, 0x06, 0x0E, 0x06, 0xB3, 0x2D, 0x77, 0xE1, 0x02, 0x86, 0xEB, 0x40, 0x8C, 0x19,
+  0xA2, 0xD6, 0xE7, 0x03, 0xB9, 0xEE, 0x6F, 0x64, 0x6F, 0xF9, 0xC0, 0x8D, 0x8A, 0x73, 0x6F, 0xF4,
+  0x69, 0xB9, 0xD6, 0xF2, 0x02, 0x84, 0x75, 0xED, 0xB1, 0xCB, 0x61, 0xE8, 0x30, 0xED, 0xC0, 0x7D,
+  0xDB, 0x6D, 0x61, 0xF9, 0xC0, 0x4A, 0xC3, 0xE4, 0xA4, 0x6C, 0x69, 0xE1, 0x69, 0x81, 0xAE, 0x07,
+  0x1D, 0x19, 0x13, 0x20, 0x4E, 0x9A, 0xF5, 0x06, 0x04, 0x05, 0x09, 0xAC, 0x0B, 0xFA, 0xC0, 0x6F,
+  0x61, 0x79, 0xF2, 0xC0, 0x6C, 0x80, 0xF3, 0x03, 0xA8, 0xDE, 0x74, 0xE1, 0xC0, 0x8D, 0x7F, 0x72,
+  0xE1, 0xAC, 0x36, 0xEF, 0x0A, 0x04, 0x06, 0x39, 0x7F, 0x21, 0x35, 0xC0, 0x27, 0x2D, 0xF3, 0xC0,
+  0x83, 0xBB, 0x72, 0x69, 0x68, 0xF3, 0xB5, 0xE9, 0xEA, 0xC0, 0x84, 0x08, 0xEE, 0x02, 0x85, 0x69,
+  0xE8, 0xC0, 0x3E, 0x3E, 0x61, 0xEE, 0x04, 0xC0, 0x79, 0x00, 0x69, 0xEB, 0xC0, 0x79, 0x80, 0xE9,
+  0x06, 0x07, 0x06, 0x11, 0x1C, 0x84, 0x72, 0x6F, 0x67, 0xE1, 0xC0, 0x86, 0x3E, 0x6D, 0x6F, 0xF4,
+  0xC0, 0x8B, 0x06, 0xEB, 0x02, 0x86, 0x69, 0x68, 0xF3, 0xC0, 0x7E, 0xFE, 0xE1, 0x04, 0xC0, 0x78,
+  0xD7, 0xFA, 0xB5, 0xD4, 0xE8, 0x03, 0x09, 0x85, 0xF3, 0x03, 0xB3, 0x6E, 0x61, 0xE8, 0xC0, 0x8B,
+  0x1B, 0x63, 0xF5, 0xC0, 0x39, 0xD2, 0x61, 0x73, 0x61, 0x69, 0x72, 0x61, 0xF7, 0xC0, 0x8E, 0x2F,
+  0xE5, 0xC0, 0x8D, 0xE4, 0xE1, 0x05, 0x38, 0x0B, 0xA3, 0x79, 0xE7, 0xB6, 0x67, 0xE5, 0x05, 0x06,
+  0x0B, 0xB7, 0xA4, 0x6D, 0x61, 0x6E, 0xEF, 0xBB, 0x77, 0xEB, 0x02, 0x84, 0xF5, 0xC0, 0x8D, 0x1E,
+  0xE1, 0xC0, 0x8A, 0xE8, 0xE9, 0xB8, 0xC1, 0xE1, 0x08, 0x07, 0x0B, 0x0B, 0x19, 0xC0, 0x43, 0xEC,
+  0x79, 0xE9, 0x3A, 0x44, 0xC0, 0x43, 0xF2, 0x77, 0xE1, 0x02, 0x83, 0xFA, 0xB5, 0x62, 0xEB, 0xC0,
+  0x8A, 0xCA, 0xF4, 0x04, 0xC0, 0x6B, 0xBC, 0xEF, 0x40, 0x8A, 0x76, 0xA0, 0x4D, 0xF2, 0x05, 0x08,
+  0xC0, 0x8A, 0x61, 0xF5, 0x03, 0xB7, 0xDC, 0x6B, 0xE1, 0xB4, 0x7E, 0xE1, 0x02, 0x84, 0xF4, 0xC0,
+  0x8C, 0xAE, 0xE8, 0xC0, 0x7D, 0x0A, 0xED, 0x02, 0x89, 0x69, 0x68, 0xF3, 0x03, 0xB5, 0x35, 0xE9,
+  0xA4, 0xF3, 0xE1, 0x69, 0x02, 0x85, 0x79, 0xF5, 0xC0, 0x8C, 0x3C, 0xE8, 0x38, 0x04, 0xC0, 0x75,
+  0xA4, 0xE7, 0x03, 0xA0, 0xBD, 0x69, 0x68, 0x63, 0x6F, 0xF4, 0x69, 0x81, 0xAE, 0x05, 0x08, 0x18,
+  0x12, 0x98, 0xF5, 0x03, 0xA0, 0x86, 0xE2, 0xC0, 0x8D, 0x8D, 0xEF, 0x08, 0x04, 0x40, 0x41, 0x4F,
+  0xC0, 0x29, 0x26, 0x73, 0xE9, 0xB5, 0x2E, 0xEB, 0x04, 0xC0, 0x89, 0x13, 0x69, 0x68, 0xF3, 0xC0,
+  0x82, 0xFA, 0xE9, 0x02, 0x8C, 0xE7, 0x06, 0x29, 0xE0, 0xC0, 0x83, 0x19, 0x65, 0xF4, 0xC0, 0x8C,
+  0x80, 0xE1, 0xB9, 0xD3, 0xE5, 0x03, 0x06, 0x87, 0x6E, 0x75, 0x66, 0xE1, 0xB4, 0x0B, 0xEB, 0x81,
+  0x75, 0x73, 0xF4, 0xB9, 0xF0, 0x69, 0xE9, 0x81, 0xEA, 0xC0, 0x8B, 0x45, 0xE1, 0x07, 0x0C, 0x0C,
+  0x0B, 0x19, 0x12, 0x84, 0xF9, 0x03, 0xA1, 0x12, 0x69, 0x6D, 0x6F, 0x6E, 0xF5, 0xC0, 0x2E, 0x8C,
+  0x77, 0xE1, 0x02, 0x85, 0x7A, 0x65, 0xEE, 0xB7, 0x89, 0xEB, 0xAA, 0xD8, 0xF4, 0x02, 0x84, 0xE9,
+  0xC0, 0x89, 0xD6, 0x61, 0xEB, 0xB8, 0x22, 0xF2, 0x05, 0x20, 0xC8, 0xAA, 0x9D, 0xE1, 0x02, 0x85,
+  0x77, 0x61, 0xF4, 0xAA, 0xB4, 0x62, 0x6F, 0x69, 0x68, 0x73, 0xF5, 0x81, 0xF3, 0xC0, 0x8B, 0x23,
+  0xED, 0x02, 0x83, 0xF5, 0xB7, 0xC2, 0x61, 0xF9, 0x04, 0xC0, 0x8D, 0x00, 0x75, 0x73, 0xE1, 0xC0,
+  0x5D, 0x39, 0xEB, 0xC0, 0x8C, 0x0B, 0xE7, 0x03, 0xB4, 0x6A, 0xE1, 0x04, 0xC0, 0x8C, 0x07, 0xEB,
+  0xB4, 0xC8, 0x61, 0x79, 0x69, 0xED, 0x69, 0x81, 0xAE, 0x06, 0x1C, 0x13, 0x20, 0x26, 0x8A, 0xF5,
+  0x02, 0x95, 0xEB, 0x02, 0x8B, 0x75, 0x68, 0x73, 0x61, 0x6B, 0x69, 0x68, 0xE3, 0xC0, 0x8B, 0xB0,
+  0x69, 0x72, 0x6E, 0x61, 0xF3, 0xB8, 0x56, 0xE6, 0xC0, 0x89, 0x39, 0xEF, 0x05, 0x09, 0xC0, 0x89,
+  0xF8, 0xF4, 0x03, 0xB0, 0x9F, 0x6F, 0xED, 0xC0, 0x38, 0xB3, 0x6A, 0xE1, 0xA9, 0x46, 0xE9, 0x05,
+  0x0E, 0x0F, 0xB8, 0xFD, 0xF2, 0x03, 0xA3, 0x9C, 0xEF, 0x04, 0xC0, 0x89, 0xC4, 0x6D, 0xF5, 0xC0,
+  0x71, 0xF5, 0x6B, 0xE1, 0x02, 0x86, 0xF3, 0x35, 0x3A, 0xC0, 0x77, 0x5B, 0x6D, 0x6F, 0xEE, 0xAC,
+  0xFD, 0xE8, 0xB7, 0x4B, 0xE5, 0x03, 0xB8, 0x00, 0x6E, 0x69, 0xED, 0xC0, 0x88, 0x7C, 0xE1, 0x06,
+  0x07, 0x10, 0x06, 0x0D, 0x9F, 0xF9, 0x03, 0xB7, 0xED, 0xF5, 0xB0, 0xD0, 0xF7, 0x04, 0xC0, 0x7B,
+  0xAA, 0xE1, 0x02, 0x83, 0xEB, 0xAC, 0x50, 0x67, 0xE1, 0xC0, 0x8B, 0xEF, 0x74, 0xE1, 0x2A, 0x0D,
+  0xA1, 0x89, 0xF2, 0x02, 0x83, 0xE9, 0xA9, 0xF1, 0x61, 0xF7, 0x81, 0xE1, 0xC0, 0x37, 0xE9, 0xED,
+  0x03, 0x05, 0x8B, 0x75, 0x6E, 0xE1, 0xB2, 0xF1, 0x69, 0x68, 0x73, 0x75, 0x73, 0x74, 0x61, 0xED,
+  0x69, 0xB6, 0x42, 0xE1, 0x04, 0xC0, 0x8B, 0x13, 0xE7, 0x81, 0xEF, 0xC0, 0x8B, 0x12, 0x64, 0x75,
+  0xEB, 0xC0, 0x72, 0x37, 0xE3, 0xC0, 0x89, 0x0B, 0x61, 0x64, 0x6E, 0x65, 0xF3, 0x6A, 0xB2, 0x15,
+  0x35, 0x34, 0x75, 0x72, 0x6B, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x8D, 0x26, 0xE8, 0x05, 0x05, 0x0C,
+  0x0C, 0x8B, 0x73, 0xF5, 0xC0, 0x8B, 0xEC, 0x36, 0x31, 0x71, 0x71, 0x6C, 0x65, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x8D, 0x0F, 0x32, 0x32, 0x74, 0x73, 0x69, 0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0x8D, 0x03, 0x31,
+  0x33, 0x79, 0x6E, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x8C, 0xF8, 0x30, 0x33, 0x70, 0x76, 0x32, 0x33,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x8C, 0xEC, 0xE7, 0x06, 0x07, 0x08, 0xC0, 0x8A, 0xCD, 0x6F, 0x6C, 0x62,
+  0xEC, 0xC0, 0x62, 0x6D, 0x37, 0x31, 0x71, 0x73, 0xF4, 0xC0, 0x8C, 0xBE, 0x33, 0x7A, 0x73, 0x69,
+  0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0x8C, 0xCB, 0xE5, 0x14, 0x07, 0x20, 0xE1, 0x0A, 0x20, 0xA7, 0x20,
+  0x91, 0x09, 0x06, 0x20, 0xA7, 0x06, 0x09, 0x06, 0x19, 0xC0, 0x6D, 0xA6, 0x75, 0x6C, 0x62, 0xF9,
+  0xC0, 0x60, 0x5C, 0xF4, 0x04, 0x06, 0x05, 0x84, 0x74, 0x6F, 0xE3, 0xC0, 0x8B, 0x83, 0x73, 0xE1,
+  0xC0, 0x89, 0x9E, 0x69, 0xF3, 0xBB, 0x92, 0x61, 0x77, 0xE9, 0x69, 0x81, 0xAE, 0x06, 0x05, 0x13,
+  0x20, 0x5A, 0x91, 0x75, 0xE8, 0xC0, 0x8A, 0x19, 0xEF, 0x04, 0x07, 0xB2, 0x78, 0x74, 0x61, 0x6E,
+  0xF5, 0xC0, 0x82, 0xF6, 0x6E, 0xEF, 0x34, 0xB1, 0xC0, 0x76, 0xBC, 0xE9, 0x05, 0x0E, 0x1B, 0x0A,
+  0x93, 0xED, 0x02, 0x88, 0x75, 0x7A, 0x69, 0xE1, 0x31, 0xFF, 0xA2, 0xA0, 0xE1, 0xAB, 0xE3, 0xEB,
+  0x02, 0x87, 0x65, 0x73, 0x6F, 0x6E, 0xE9, 0xB8, 0x01, 0xE1, 0x02, 0x85, 0x73, 0x61, 0xE7, 0xAC,
+  0x06, 0xED, 0x03, 0xB7, 0xB3, 0x75, 0xFA, 0xC0, 0x7F, 0x2B, 0xEA, 0x04, 0xC0, 0x7F, 0x23, 0x6F,
+  0xE2, 0xC0, 0x7E, 0xD5, 0xE8, 0x02, 0x8C, 0x73, 0xE9, 0x03, 0xB7, 0x73, 0x75, 0x6B, 0x75, 0xFA,
+  0xC0, 0x89, 0xFD, 0xE3, 0xC0, 0x89, 0xA8, 0xE1, 0x04, 0x05, 0xB3, 0xB2, 0x6D, 0xF5, 0xC0, 0x5B,
+  0x4A, 0xE4, 0xC0, 0x80, 0x38, 0xE5, 0x03, 0xB1, 0xAB, 0x68, 0x6F, 0xEE, 0x04, 0xC0, 0x7E, 0xF2,
+  0xE9, 0x37, 0xB7, 0xC0, 0x73, 0x2E, 0xE1, 0x05, 0x0B, 0x1C, 0x06, 0x87, 0xF7, 0x04, 0xC0, 0x89,
+  0xCC, 0x61, 0xF3, 0x32, 0x6C, 0xA1, 0xD3, 0xF4, 0x02, 0x84, 0xE9, 0xC0, 0x86, 0x2C, 0xE1, 0x02,
+  0x8C, 0x6B, 0x61, 0x74, 0x6E, 0x65, 0x7A, 0xF5, 0x81, 0xEB, 0xC0, 0x87, 0x47, 0x68, 0x6F, 0xEE,
+  0xC0, 0x7A, 0x0D, 0x6B, 0x6F, 0xE9, 0xC0, 0x78, 0xD2, 0xE4, 0x40, 0x36, 0xC0, 0xC0, 0x53, 0x8B,
+  0x62, 0xE1, 0xBB, 0x74, 0x72, 0x6F, 0x74, 0x73, 0x6E, 0x6F, 0xE9, 0xC0, 0x37, 0xFB, 0xEE, 0x69,
+  0x04, 0x04, 0xA0, 0x85, 0xEE, 0xC0, 0x8A, 0x43, 0x61, 0x6D, 0x69, 0x68, 0xF3, 0x69, 0x81, 0xAE,
+  0x06, 0x0A, 0x18, 0x06, 0x1B, 0x87, 0xF5, 0x02, 0x83, 0xF9, 0xAD, 0xD4, 0xF3, 0xC0, 0x6C, 0xC5,
+  0xEF, 0x03, 0x03, 0x85, 0xF4, 0xAE, 0x6F, 0x6E, 0x61, 0xF7, 0xB1, 0xFA, 0x6D, 0xF5, 0x03, 0xAE,
+  0x07, 0x7A, 0xE9, 0x69, 0x2B, 0x28, 0xA9, 0x57, 0x6E, 0x61, 0xEE, 0xC0, 0x65, 0xAA, 0xE9, 0x03,
+  0x06, 0x88, 0x6D, 0x69, 0xEB, 0xC0, 0x67, 0x3D, 0x6B, 0x6F, 0x6E, 0x69, 0xEB, 0xC0, 0x70, 0x6B,
+  0xE7, 0x03, 0xAD, 0xF4, 0x75, 0xF3, 0xC0, 0x87, 0x00, 0xE5, 0x03, 0xB6, 0x06, 0xEE, 0xB2, 0xCB,
+  0xE1, 0x04, 0x06, 0x10, 0x87, 0x77, 0x61, 0xEB, 0xC0, 0x67, 0x1A, 0xED, 0x04, 0xC0, 0x8A, 0x45,
+  0x69, 0x68, 0x73, 0x6F, 0x6E, 0xE9, 0x35, 0x33, 0xC0, 0x6F, 0xFF, 0x6B, 0x75, 0x73, 0xF4, 0xC0,
+  0x86, 0xD7, 0xE4, 0x05, 0x27, 0xBF, 0xAD, 0x7E, 0x75, 0xF3, 0xC0, 0x7F, 0x9F, 0xAE, 0x02, 0x8E,
+  0x74, 0x65, 0x6E, 0x69, 0x65, 0x73, 0x61, 0xAE, 0x81, 0x72, 0xE5, 0xC0, 0x7E, 0x19, 0x6E, 0x72,
+  0x69, 0xE8, 0xC0, 0x89, 0x0C, 0x6D, 0x69, 0x68, 0xE5, 0x69, 0x81, 0xAE, 0x07, 0x0B, 0x20, 0x23,
+  0x11, 0x16, 0x83, 0xF5, 0x02, 0x84, 0xFA, 0xC0, 0x89, 0xF5, 0x6B, 0xEF, 0xA0, 0xB2, 0xEF, 0x05,
+  0x06, 0x09, 0x03, 0x87, 0x79, 0xE9, 0x69, 0xC0, 0x85, 0xE0, 0x75, 0x68, 0x63, 0x75, 0x6B, 0xEF,
+  0xC0, 0x88, 0xBB, 0xEE, 0xB5, 0x8F, 0x6B, 0x69, 0x68, 0xE3, 0xC0, 0x87, 0xC4, 0xEA, 0xC0, 0x3D,
+  0x8A, 0xEE, 0x05, 0x06, 0xC0, 0x6E, 0x05, 0x65, 0x67, 0x6F, 0xEB, 0xB2, 0x86, 0x61, 0xEE, 0xC0,
+  0x7A, 0xEE, 0xE9, 0x03, 0x07, 0x86, 0x72, 0x61, 0x62, 0xE1, 0xC0, 0x83, 0x3F, 0x6B, 0x61, 0xF3,
+  0xC0, 0x7F, 0x29, 0x61, 0xEE, 0xC0, 0x88, 0xBF, 0xE5, 0xA0, 0xDA, 0xE1, 0x02, 0x88, 0x74, 0x61,
+  0x6B, 0xE9, 0x69, 0xC0, 0x87, 0xAB, 0xED, 0x02, 0x8A, 0x69, 0xEA, 0x03, 0xB4, 0x70, 0x61, 0xF7,
+  0xC0, 0x87, 0x7E, 0xE1, 0x02, 0x83, 0xF9, 0xB5, 0x3C, 0xE8, 0x03, 0xAE, 0xE3, 0x61, 0xF4, 0x81,
+  0xE1, 0x81, 0xF7, 0xC0, 0x86, 0x23, 0x6C, 0x61, 0x73, 0x72, 0x65, 0xF0, 0xC0, 0x84, 0xBD, 0x6B,
+  0x69, 0xEC, 0xC0, 0x84, 0x4C, 0xE9, 0x03, 0xA0, 0x9E, 0xED, 0x69, 0x81, 0xAE, 0x07, 0x1E, 0x20,
+  0x37, 0x0D, 0xB0, 0x6E, 0xEF, 0x04, 0x15, 0xB2, 0xC5, 0xEE, 0x04, 0x09, 0xB2, 0x0A, 0xEF, 0x04,
+  0xC0, 0x73, 0xD5, 0xE4, 0xC0, 0x87, 0x3A, 0x69, 0x68, 0x73, 0xE5, 0xC0, 0x86, 0xBF, 0xE8, 0xC0,
+  0x85, 0xCD, 0xE9, 0x05, 0x06, 0x12, 0x0C, 0x85, 0x72, 0x61, 0xE2, 0xC0, 0x87, 0x45, 0xEB, 0x04,
+  0xC0, 0x78, 0x68, 0xE1, 0x06, 0x2C, 0x66, 0xC0, 0x7C, 0xC3, 0x73, 0x6F, 0xF3, 0xC0, 0x85, 0xAF,
+  0xE8, 0x03, 0xB5, 0x34, 0x63, 0x69, 0x61, 0x6B, 0xEB, 0xC0, 0x87, 0xFE, 0x67, 0xF5, 0xC0, 0x6D,
+  0x99, 0x61, 0xF2, 0x81, 0x61, 0xF4, 0xC0, 0x6E, 0xA2, 0xE5, 0x04, 0x05, 0xAE, 0x46, 0x73, 0xE9,
+  0x69, 0xB4, 0x8A, 0xE2, 0xB0, 0x6A, 0xE1, 0x05, 0x07, 0x06, 0x11, 0x89, 0x77, 0xE9, 0x40, 0x85,
+  0x80, 0xA1, 0x26, 0x6E, 0x61, 0xF7, 0xC0, 0x7C, 0xDC, 0xED, 0x04, 0xC0, 0x87, 0xBF, 0xE1, 0x03,
+  0xB5, 0xA8, 0xF9, 0x04, 0xC0, 0x88, 0xCD, 0xE5, 0xB5, 0x46, 0xEB, 0x04, 0xC0, 0x65, 0x5A, 0x61,
+  0xF3, 0xB4, 0x82, 0xE2, 0xC0, 0x88, 0x81, 0x62, 0xED, 0xC0, 0x41, 0xD3, 0x65, 0x77, 0xE5, 0xC0,
+  0x88, 0x59, 0x64, 0x61, 0x6D, 0x79, 0x64, 0xE1, 0xC0, 0x87, 0x10, 0x62, 0x6F, 0xEB, 0x6A, 0xAE,
+  0xA4, 0xB5, 0x02, 0x8B, 0x39, 0x6E, 0x79, 0x37, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0xB3, 0x31,
+  0x61, 0x34, 0x6D, 0x32, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0xA8, 0x31, 0x36, 0x74, 0x68, 0x72, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x89, 0x9D, 0xE4, 0x0B, 0x06, 0x15, 0x0B, 0x0C, 0x18, 0x19, 0x0A, 0xC0, 0x88,
+  0x17, 0x6F, 0x6F, 0xE6, 0xC0, 0x7F, 0xBA, 0xEE, 0x04, 0xC0, 0x87, 0x82, 0x65, 0x69, 0x72, 0xE6,
+  0x02, 0x84, 0xF9, 0xC0, 0x87, 0x68, 0xEC, 0x81, 0xF2, 0xC0, 0x77, 0x6B, 0xE5, 0x69, 0x81, 0x74,
+  0x66, 0x61, 0x72, 0xE3, 0xC0, 0x3E, 0x7E, 0x38, 0x36, 0x31, 0x74, 0x69, 0x34, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x89, 0x5F, 0xB7, 0x02, 0x8A, 0x70, 0x74, 0x6C, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0x52,
+  0x38, 0x37, 0x74, 0x6C, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0x47, 0xB5, 0x02, 0x8B, 0x34, 0x30,
+  0x73, 0x6A, 0x35, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0x39, 0x32, 0x30, 0x78, 0x62, 0x7A, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x89, 0x2E, 0x33, 0x74, 0x68, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0x24, 0x31, 0x37,
+  0x73, 0x71, 0x6C, 0x31, 0x2D, 0x2D, 0xEE, 0xC0, 0x89, 0x18, 0xE3, 0x08, 0x05, 0x0C, 0x0F, 0x0D,
+  0xC0, 0x87, 0xD5, 0x6D, 0xF0, 0xC0, 0x2F, 0x95, 0x39, 0x34, 0x70, 0x74, 0x72, 0x35, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x88, 0xFE, 0x36, 0x37, 0x38, 0x7A, 0x37, 0x76, 0x71, 0x35, 0x64, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x88, 0xEF, 0x34, 0x36, 0x32, 0x61, 0x30, 0x74, 0x37, 0x2D, 0x2D, 0xEE, 0xC0, 0x88, 0xE2,
+  0x32, 0x30, 0x34, 0x75, 0xE7, 0xC0, 0x82, 0x05, 0xE2, 0xC0, 0x83, 0x10, 0xE1, 0x19, 0x0C, 0x22,
+  0x9A, 0x22, 0xC7, 0x20, 0xDA, 0x06, 0x08, 0x27, 0x4E, 0x23, 0xB2, 0x21, 0x72, 0x09, 0x21, 0xB2,
+  0x0B, 0x0C, 0x0B, 0xC0, 0x6F, 0xF1, 0xF9, 0x04, 0xC0, 0x87, 0x3F, 0x6F, 0x67, 0x61, 0xEE, 0x6A,
+  0xAD, 0x93, 0x77, 0xE1, 0x05, 0x20, 0xF3, 0xA0, 0x6C, 0x6E, 0x69, 0x6B, 0xEF, 0x69, 0x81, 0xAE,
+  0x09, 0x20, 0x23, 0x12, 0x20, 0x22, 0x20, 0x3C, 0x8C, 0xF5, 0x03, 0x0C, 0x8F, 0x72, 0x61, 0xE2,
+  0x02, 0x84, 0xE5, 0xC0, 0x68, 0x2C, 0xE1, 0xA4, 0xDA, 0x6B, 0x75, 0x73, 0x75, 0xE7, 0x03, 0xB2,
+  0xE5, 0x61, 0x6B, 0x61, 0xEE, 0x69, 0xB2, 0x6E, 0xE2, 0xC0, 0x43, 0x5E, 0xEF, 0x05, 0x08, 0xC0,
+  0x82, 0x3C, 0x74, 0x69, 0x61, 0xE4, 0x32, 0x5E, 0xA0, 0x87, 0xEA, 0xC0, 0x23, 0xBF, 0xEE, 0x02,
+  0x8A, 0xE9, 0x04, 0xC0, 0x83, 0xD8, 0x6A, 0xE9, 0xC0, 0x59, 0x9E, 0xE1, 0x03, 0x06, 0x86, 0x77,
+  0x6F, 0xEE, 0xC0, 0x76, 0x42, 0x74, 0x69, 0xED, 0xC0, 0x86, 0x1F, 0x6D, 0xEF, 0xC0, 0x7B, 0xE0,
+  0xE9, 0x06, 0x07, 0x1B, 0x10, 0xB0, 0xFC, 0x6E, 0x75, 0x67, 0xE1, 0x69, 0xA4, 0x85, 0xED, 0x03,
+  0x04, 0x84, 0x6F, 0xF4, 0xA8, 0xD5, 0xE9, 0xC0, 0x32, 0xAE, 0xE1, 0x04, 0x07, 0xA1, 0x7A, 0x6B,
+  0x69, 0x68, 0xF3, 0xC0, 0x75, 0x77, 0xE7, 0xA7, 0x1F, 0xEB, 0x02, 0x86, 0x69, 0x68, 0x73, 0xE1,
+  0xB4, 0x5E, 0xE1, 0x03, 0xBF, 0xF0, 0xE7, 0xA7, 0x65, 0xEA, 0xB3, 0x89, 0xE5, 0x02, 0x85, 0x73,
+  0xE5, 0xC0, 0x83, 0x95, 0x6F, 0xF3, 0xB2, 0x41, 0xE1, 0x07, 0x06, 0x06, 0x09, 0x08, 0x0A, 0x91,
+  0x7A, 0x6F, 0xEE, 0xC0, 0x75, 0xE1, 0x79, 0x65, 0xE8, 0xC0, 0x85, 0xC7, 0x77, 0xE1, 0x04, 0xC0,
+  0x81, 0xC3, 0xEB, 0xA7, 0x39, 0x72, 0xE1, 0x03, 0xB0, 0x0D, 0xE8, 0xB1, 0xBC, 0xEE, 0x04, 0xC0,
+  0x86, 0x46, 0xE5, 0x2F, 0x8D, 0xA0, 0x96, 0xED, 0x03, 0x04, 0x85, 0xF5, 0xC0, 0x84, 0x2E, 0x69,
+  0x6A, 0xE5, 0xAF, 0x71, 0xE1, 0xC0, 0x5A, 0x33, 0xE8, 0xC0, 0x84, 0xB7, 0x6B, 0x69, 0x68, 0x73,
+  0xE9, 0x69, 0x81, 0xAE, 0x05, 0x12, 0x0D, 0x04, 0x95, 0xF5, 0x05, 0x23, 0x9D, 0xA4, 0x2A, 0xFA,
+  0x04, 0xC0, 0x81, 0xD5, 0x69, 0xED, 0x81, 0xE1, 0xC0, 0x7C, 0x09, 0xEF, 0x02, 0x86, 0x74, 0x6F,
+  0xEE, 0x69, 0xA9, 0x71, 0xE1, 0xC0, 0x22, 0xE5, 0x6E, 0x61, 0xF3, 0x89, 0xE9, 0x07, 0x05, 0x2C,
+  0x19, 0xC0, 0x71, 0x34, 0x75, 0xEB, 0xC0, 0x67, 0x19, 0x68, 0x63, 0x69, 0x6F, 0xEE, 0xC0, 0x85,
+  0xE7, 0xE1, 0x09, 0x06, 0x08, 0x06, 0x29, 0x7B, 0xC0, 0x7B, 0xA1, 0x77, 0x61, 0x7A, 0xE1, 0xB1,
+  0x07, 0xF4, 0x03, 0xA2, 0xFD, 0x69, 0xEB, 0xAE, 0xEA, 0x6D, 0x69, 0xEA, 0xC0, 0x6B, 0xDC, 0x64,
+  0x61, 0x6E, 0x69, 0x68, 0xE3, 0xC0, 0x84, 0x29, 0x67, 0xE1, 0x03, 0xA0, 0xB5, 0x6E, 0x61, 0xEB,
+  0x69, 0x81, 0xAE, 0x05, 0x0A, 0x20, 0x25, 0x8E, 0xEF, 0x05, 0x23, 0xE0, 0xA2, 0x4E, 0x6E, 0xE1,
+  0xBC, 0x82, 0xE9, 0x0B, 0x08, 0x06, 0x07, 0x21, 0x28, 0x27, 0xC8, 0xC0, 0x7D, 0x09, 0x6B, 0x61,
+  0x73, 0x61, 0xE7, 0xC0, 0x63, 0xE0, 0x68, 0x73, 0xF5, 0xC0, 0x83, 0x4B, 0xE7, 0x81, 0x75, 0xF3,
+  0xC0, 0x82, 0xE8, 0x65, 0xF3, 0xAF, 0x77, 0xE5, 0x02, 0x84, 0x73, 0xE1, 0xA0, 0xD9, 0xEE, 0x81,
+  0x6F, 0xEB, 0xC0, 0x66, 0x9D, 0xE1, 0x09, 0x08, 0x14, 0x06, 0x20, 0x28, 0x07, 0x04, 0x8B, 0x79,
+  0x69, 0x6D, 0x6F, 0xEE, 0xC0, 0x84, 0x80, 0x77, 0xE1, 0x02, 0x83, 0xF3, 0xAF, 0x26, 0xEB, 0x05,
+  0x04, 0xC0, 0x76, 0xF5, 0xF5, 0xC0, 0x7F, 0x1E, 0xEF, 0xB0, 0xD6, 0x74, 0x69, 0xEB, 0xC0, 0x31,
+  0xBC, 0xF2, 0x02, 0x88, 0xF5, 0x04, 0xC0, 0x85, 0xAB, 0xEB, 0xB2, 0x05, 0xE1, 0x03, 0x09, 0x89,
+  0x77, 0xE1, 0x04, 0xC0, 0x82, 0x5A, 0xE7, 0xAD, 0x43, 0xE8, 0x04, 0xC0, 0x76, 0x47, 0x69, 0xED,
+  0xA2, 0xE5, 0x67, 0x69, 0x68, 0x73, 0xE1, 0xB1, 0x24, 0xEE, 0x81, 0x69, 0xE2, 0xC0, 0x85, 0x65,
+  0xED, 0xC0, 0x82, 0xD1, 0x6B, 0x75, 0xF3, 0x04, 0xC0, 0x83, 0xB3, 0x74, 0xE1, 0xAE, 0xCA, 0xE4,
+  0xB1, 0x33, 0xEB, 0x69, 0x81, 0xAE, 0x06, 0x12, 0x14, 0x20, 0x21, 0x88, 0xF5, 0x02, 0x84, 0xFA,
+  0xC0, 0x3F, 0x85, 0x73, 0xF4, 0x02, 0x83, 0xEF, 0xAE, 0xEB, 0x61, 0xED, 0xAF, 0xB4, 0xEF, 0x03,
+  0x07, 0x84, 0xF9, 0x81, 0x6F, 0xF4, 0xC0, 0x85, 0x4E, 0xEE, 0xC0, 0x3C, 0x2A, 0x68, 0x73, 0xEF,
+  0xBE, 0x46, 0xE9, 0x03, 0x09, 0x85, 0x6D, 0x6F, 0x6E, 0x69, 0x68, 0xE3, 0xC0, 0x83, 0x32, 0x6B,
+  0xF5, 0xC0, 0x62, 0x2B, 0xEA, 0x02, 0x88, 0x75, 0x73, 0x74, 0x6E, 0xE5, 0xC0, 0x82, 0x78, 0x6E,
+  0xEF, 0xAF, 0xE5, 0x65, 0x6D, 0x61, 0x67, 0xF5, 0xC0, 0x6A, 0x7C, 0xE1, 0x03, 0x0D, 0x88, 0x77,
+  0x61, 0x67, 0xE1, 0x02, 0x84, 0xF9, 0xC0, 0x85, 0x1F, 0xEB, 0xAF, 0x19, 0x72, 0x69, 0x68, 0x6F,
+  0xF4, 0xC0, 0x6F, 0x99, 0x6D, 0x69, 0x68, 0x73, 0xEF, 0xC0, 0x83, 0x17, 0xF4, 0x03, 0xA1, 0x2C,
+  0xE9, 0x03, 0xA0, 0x74, 0xEF, 0x69, 0x81, 0xAE, 0x05, 0x0F, 0x09, 0x19, 0x8D, 0xF5, 0x06, 0x05,
+  0x2E, 0xB1, 0xA2, 0x17, 0x70, 0xF0, 0xC0, 0x57, 0x8A, 0xE6, 0xAC, 0x80, 0x6F, 0x6E, 0x6F, 0x6F,
+  0x67, 0xEE, 0xC0, 0x7A, 0x48, 0xE9, 0x03, 0x06, 0x8B, 0xED, 0x81, 0x75, 0xEB, 0xAC, 0x47, 0xEB,
+  0x06, 0x2C, 0x08, 0xC0, 0x2C, 0x7A, 0x61, 0xF3, 0xA4, 0xDE, 0xEA, 0xC0, 0x61, 0x97, 0xE5, 0x02,
+  0x85, 0x75, 0x73, 0xF4, 0xAF, 0x9A, 0x6F, 0x6E, 0xEF, 0xAF, 0x1A, 0xE1, 0x06, 0x0A, 0x11, 0xC0,
+  0x78, 0x97, 0xF4, 0x03, 0xA6, 0x63, 0xE9, 0x40, 0x83, 0xBF, 0xA0, 0xE6, 0xED, 0x02, 0x89, 0x69,
+  0x68, 0xF3, 0x81, 0x65, 0xED, 0xC0, 0x61, 0x6D, 0x61, 0xF3, 0xC0, 0x65, 0x45, 0x64, 0x61, 0x6B,
+  0x61, 0x74, 0x6F, 0x67, 0xEE, 0xC0, 0x79, 0xF5, 0xEB, 0x04, 0xC0, 0x83, 0x27, 0xE1, 0x69, 0x81,
+  0xAE, 0x08, 0x10, 0x20, 0x2C, 0x05, 0x16, 0xA0, 0x21, 0xF5, 0x02, 0x86, 0x6F, 0x70, 0xF0, 0xC0,
+  0x65, 0x20, 0x6B, 0x6F, 0x62, 0xED, 0xC0, 0x80, 0x61, 0xEF, 0x06, 0x03, 0x09, 0x05, 0x05, 0x8A,
+  0xF9, 0xA9, 0x3B, 0x74, 0x61, 0x73, 0xE9, 0x2D, 0xAD, 0xC0, 0x76, 0xA2, 0x72, 0x69, 0xE8, 0xAD,
+  0x6F, 0x6E, 0xF5, 0xC0, 0x54, 0xAD, 0x6A, 0x6E, 0x6F, 0xE8, 0x69, 0x81, 0x69, 0xF2, 0xAB, 0xDC,
+  0x68, 0xE1, 0xC0, 0x7F, 0xCD, 0x6E, 0x65, 0xF3, 0xAC, 0xB4, 0xE9, 0x03, 0x06, 0x87, 0x6E, 0x61,
+  0x6F, 0xEB, 0xAF, 0x0C, 0x6D, 0x61, 0x67, 0xE1, 0xC0, 0x58, 0x27, 0x68, 0x73, 0xEF, 0xAE, 0x7B,
+  0xE5, 0x04, 0x09, 0x06, 0x87, 0xF4, 0x04, 0xC0, 0x82, 0x44, 0xE1, 0xC0, 0x80, 0xC5, 0x73, 0x75,
+  0x72, 0xE1, 0xA1, 0x47, 0xEE, 0x81, 0x61, 0xF4, 0xC0, 0x83, 0xFC, 0x6D, 0x6F, 0xEA, 0xC0, 0x83,
+  0xCC, 0xE1, 0x06, 0x08, 0x13, 0xC0, 0x2F, 0x72, 0xF7, 0x03, 0xB4, 0xBD, 0xEF, 0xC0, 0x7F, 0x66,
+  0xF4, 0x02, 0x86, 0x69, 0x6B, 0xE1, 0x69, 0xAE, 0xED, 0x61, 0x67, 0xEF, 0x69, 0x81, 0x72, 0x69,
+  0xE8, 0xAF, 0x01, 0xEB, 0x02, 0x83, 0xEF, 0xAE, 0xB7, 0xE1, 0xAD, 0xEE, 0x61, 0xE7, 0x03, 0xA0,
+  0xCD, 0x69, 0x69, 0xEE, 0x69, 0x81, 0xAE, 0x08, 0x0B, 0x20, 0x2C, 0x0B, 0x20, 0x2C, 0x8D, 0xF5,
+  0x02, 0x86, 0x73, 0x74, 0xE5, 0xC0, 0x77, 0x61, 0xEF, 0x8A, 0xEF, 0x08, 0x06, 0x05, 0x0A, 0x04,
+  0x06, 0xAF, 0xFC, 0xF2, 0x81, 0xE9, 0xC0, 0x7F, 0xA1, 0x6E, 0xE1, 0xC0, 0x7E, 0x80, 0xEB, 0x02,
+  0x84, 0xEF, 0xC0, 0x83, 0x1C, 0xE9, 0xB4, 0x50, 0xEA, 0xC0, 0x60, 0x83, 0x69, 0x68, 0xE3, 0xC0,
+  0x83, 0x46, 0xE4, 0xC0, 0x80, 0xB3, 0xEE, 0x02, 0x84, 0xE5, 0xC0, 0x5C, 0xAA, 0x61, 0xEE, 0xAA,
+  0xF5, 0xE9, 0x04, 0x10, 0x0B, 0x87, 0xED, 0x04, 0xC0, 0x83, 0x71, 0xE1, 0x02, 0x84, 0x6B, 0xE1,
+  0xA1, 0x1B, 0xE7, 0xC0, 0x72, 0xAA, 0x6B, 0x61, 0xFA, 0x02, 0x83, 0xEF, 0xAC, 0x30, 0xE1, 0xAC,
+  0xBC, 0x68, 0x63, 0x61, 0x6D, 0xE1, 0xB0, 0xB8, 0x61, 0xEE, 0xC0, 0x72, 0x91, 0xE5, 0x02, 0x86,
+  0xED, 0x81, 0x61, 0xE2, 0xAA, 0xC0, 0xEB, 0xC0, 0x60, 0x06, 0xE1, 0x08, 0x04, 0x15, 0x0E, 0x08,
+  0xC0, 0x7D, 0xE9, 0x79, 0xE9, 0xA1, 0x68, 0xF7, 0x04, 0xC0, 0x37, 0xD5, 0xE1, 0x04, 0x05, 0xA0,
+  0x7B, 0x6B, 0xE9, 0xC0, 0x2A, 0xAF, 0x67, 0x69, 0xEF, 0xC0, 0x77, 0xD4, 0xF4, 0x02, 0x84, 0xE9,
+  0xC0, 0x82, 0x07, 0xE1, 0x03, 0xA2, 0x4D, 0xE7, 0xA8, 0x78, 0x6D, 0x75, 0x6E, 0x6F, 0xF5, 0x69,
+  0xAE, 0x9B, 0xEB, 0x02, 0x85, 0x6F, 0xE1, 0xC0, 0x7D, 0xEF, 0xE9, 0xC0, 0x7A, 0x26, 0x61, 0x6D,
+  0x61, 0xF9, 0x69, 0x81, 0xAE, 0x05, 0x08, 0x0B, 0x14, 0x97, 0xF5, 0x81, 0x6B, 0x6F, 0xE8, 0xC0,
+  0x68, 0xF9, 0xEF, 0x04, 0x03, 0xA6, 0x2A, 0xF9, 0xBF, 0x52, 0xE4, 0xA3, 0x1A, 0xE9, 0x03, 0x05,
+  0x85, 0x6E, 0xF5, 0xC0, 0x2E, 0x72, 0xE8, 0x21, 0x0D, 0xAD, 0xE4, 0xE1, 0x2A, 0x86, 0xC0, 0x73,
+  0x34, 0xE5, 0x07, 0x03, 0x03, 0x06, 0xC0, 0x82, 0xB7, 0xEE, 0xAC, 0xC9, 0xE4, 0xAA, 0xEC, 0x62,
+  0x6F, 0xEE, 0xC0, 0x2E, 0xB8, 0xE1, 0xAD, 0xD3, 0xE1, 0x08, 0x03, 0x20, 0x2F, 0x10, 0x08, 0x14,
+  0x8B, 0xFA, 0xAA, 0x48, 0x77, 0xE1, 0x03, 0x15, 0x87, 0xFA, 0x05, 0x06, 0xC0, 0x82, 0x50, 0xE5,
+  0x81, 0xEE, 0xC0, 0x81, 0x85, 0x61, 0xEE, 0x81, 0xE1, 0x81, 0xE2, 0xC0, 0x82, 0x91, 0x6B, 0xE9,
+  0x2D, 0x89, 0xC0, 0x74, 0xFD, 0xE7, 0x02, 0x87, 0x6F, 0x72, 0x75, 0xED, 0xC0, 0x77, 0xFD, 0xE5,
+  0xC0, 0x7F, 0xA4, 0x74, 0xE1, 0x06, 0x25, 0xE8, 0xC0, 0x79, 0xB1, 0x67, 0xE1, 0x40, 0x2E, 0x6F,
+  0xC0, 0x47, 0x65, 0x72, 0x75, 0xEB, 0x81, 0xE8, 0xC0, 0x82, 0x64, 0x6D, 0x61, 0xF9, 0x04, 0x04,
+  0xA3, 0x1F, 0x6F, 0xEE, 0xAD, 0x3A, 0xE1, 0x04, 0xC0, 0x54, 0xAB, 0xF2, 0xC0, 0x79, 0x75, 0xEB,
+  0x02, 0x84, 0x6F, 0xF5, 0xA8, 0x01, 0x61, 0xF4, 0xA8, 0x22, 0x64, 0x69, 0xE8, 0x81, 0x73, 0xE9,
+  0xC0, 0x82, 0x3C, 0x72, 0xE1, 0x02, 0x86, 0x72, 0x69, 0xEB, 0xC0, 0x7E, 0xC2, 0xEE, 0x69, 0x81,
+  0xAE, 0x06, 0x20, 0x2D, 0x20, 0x42, 0x8E, 0xEF, 0x07, 0x05, 0x0A, 0x09, 0x04, 0xA5, 0x49, 0x79,
+  0xF2, 0xC0, 0x6C, 0xA9, 0x74, 0x6F, 0x6D, 0x61, 0x72, 0x61, 0xF7, 0xC0, 0x71, 0x52, 0x6E, 0x69,
+  0x68, 0x73, 0x6F, 0xF9, 0x69, 0xAC, 0x0E, 0xE7, 0xC0, 0x5E, 0xF4, 0xE4, 0x04, 0xC0, 0x77, 0x81,
+  0xEF, 0xC0, 0x79, 0x11, 0xE9, 0x0A, 0x0E, 0x06, 0x0A, 0x04, 0x0B, 0x25, 0xBF, 0xB7, 0xF1, 0xF2,
+  0x04, 0x05, 0xA2, 0x1C, 0x75, 0xE7, 0xC0, 0x6C, 0xF6, 0x6F, 0xF4, 0xAC, 0x35, 0xED, 0x81, 0x61,
+  0xEB, 0xAA, 0x80, 0x6B, 0xE1, 0x02, 0x83, 0xF4, 0xA9, 0x7B, 0xED, 0xAC, 0x8B, 0xEA, 0xC0, 0x81,
+  0xCE, 0xE8, 0x02, 0x84, 0x73, 0xE9, 0xA8, 0x12, 0x63, 0xE9, 0xAE, 0x59, 0xE1, 0x03, 0xAA, 0x63,
+  0xF2, 0x81, 0xF5, 0xC0, 0x7E, 0xE1, 0xE5, 0x08, 0x28, 0xBD, 0x40, 0x52, 0x18, 0xA3, 0x99, 0x6F,
+  0xFA, 0xC0, 0x2D, 0xA9, 0xE1, 0x06, 0x0B, 0x09, 0x1A, 0x05, 0x8C, 0x77, 0xE1, 0x02, 0x83, 0xEB,
+  0xA1, 0xD5, 0x67, 0xE5, 0xAA, 0xBA, 0x72, 0xE1, 0x04, 0xC0, 0x81, 0x7A, 0xE8, 0xAD, 0xE7, 0xED,
+  0x02, 0x84, 0xEF, 0xC0, 0x5E, 0xC3, 0x61, 0xF9, 0x02, 0x87, 0x69, 0x72, 0x6F, 0x6B, 0xEF, 0xA1,
+  0x8D, 0x61, 0x74, 0x69, 0xEB, 0x2C, 0x59, 0xA1, 0xB5, 0x67, 0x75, 0xF2, 0xB2, 0x3D, 0xE4, 0x04,
+  0xC0, 0x52, 0xE6, 0x61, 0x6B, 0x61, 0x74, 0xEF, 0xA1, 0x74, 0xE2, 0xAD, 0xB9, 0x70, 0x70, 0xE1,
+  0xC0, 0x36, 0xDB, 0xEE, 0x04, 0xC0, 0x5A, 0x84, 0xE9, 0xBB, 0x6F, 0xED, 0x08, 0x20, 0xE0, 0x22,
+  0xE1, 0xC0, 0x72, 0x1C, 0x6E, 0x75, 0xE7, 0x69, 0x81, 0xAE, 0x05, 0x12, 0x19, 0xA0, 0x35, 0xF5,
+  0x03, 0x05, 0x84, 0x79, 0xF2, 0xC0, 0x7D, 0xC7, 0x73, 0xF4, 0xAA, 0xFE, 0x6B, 0x6F, 0xED, 0xBD,
+  0x9B, 0xEF, 0x03, 0x03, 0x8D, 0xF4, 0xA8, 0x89, 0xEE, 0x02, 0x86, 0x6F, 0x79, 0x69, 0xEB, 0xA8,
+  0x95, 0xE5, 0xC0, 0x7F, 0x0C, 0x6A, 0x6F, 0xEE, 0xA4, 0x0B, 0xE9, 0x05, 0x05, 0x06, 0x0D, 0x88,
+  0x72, 0xEF, 0xC0, 0x3E, 0x7A, 0x6F, 0x67, 0x61, 0xED, 0xA8, 0x7B, 0xED, 0x02, 0x86, 0x75, 0x7A,
+  0xE9, 0xC0, 0x80, 0xFB, 0x61, 0xEB, 0xAC, 0x89, 0x6B, 0x61, 0xF3, 0x2B, 0x45, 0xC0, 0x66, 0x55,
+  0x68, 0x73, 0xE1, 0x02, 0x85, 0x79, 0x61, 0xE2, 0xA3, 0xF0, 0x62, 0xE5, 0xC0, 0x76, 0x5D, 0xE1,
+  0x08, 0x10, 0x0D, 0x1B, 0x0B, 0x0F, 0x10, 0x87, 0xF7, 0x06, 0x40, 0x6C, 0x9A, 0xA3, 0x8C, 0x61,
+  0xEB, 0x81, 0xF5, 0x81, 0xE2, 0xC0, 0x7F, 0xA8, 0xF4, 0x05, 0x04, 0xC0, 0x80, 0xBA, 0x69, 0xEE,
+  0xAD, 0x53, 0xE1, 0xA6, 0xEA, 0xF2, 0x07, 0x0B, 0x2B, 0x5E, 0xC0, 0x75, 0x46, 0xF5, 0x02, 0x83,
+  0xED, 0xA3, 0xED, 0x6B, 0xE1, 0xC0, 0x75, 0x58, 0x61, 0x68, 0x6F, 0x6E, 0xE1, 0xC0, 0x7B, 0x89,
+  0xEE, 0x03, 0xAB, 0x52, 0x69, 0x68, 0x73, 0xE1, 0xC0, 0x54, 0x97, 0xED, 0x02, 0x88, 0x75, 0x73,
+  0x74, 0x61, 0x67, 0xE1, 0xAA, 0x8F, 0x61, 0xF9, 0xAA, 0xD8, 0xEB, 0x02, 0x88, 0x6F, 0xE9, 0x29,
+  0xD5, 0x21, 0x4F, 0xA0, 0xD5, 0x61, 0xEE, 0xC0, 0x75, 0xFA, 0xE4, 0x81, 0x6F, 0xF9, 0xC0, 0x5E,
+  0x45, 0xE2, 0xA9, 0x0F, 0x69, 0x68, 0xF3, 0x03, 0xA1, 0xA7, 0x75, 0xEB, 0x03, 0xA1, 0x2E, 0x75,
+  0xE6, 0x69, 0x81, 0xAE, 0x08, 0x19, 0x20, 0x33, 0x07, 0x20, 0x40, 0x97, 0xF5, 0x03, 0x07, 0x8A,
+  0x7A, 0x69, 0xE1, 0x28, 0x41, 0xA3, 0x03, 0x73, 0x74, 0x61, 0x6D, 0x61, 0x6B, 0x61, 0xF7, 0xA1,
+  0x3E, 0x72, 0xE1, 0xAD, 0x07, 0xEF, 0x04, 0x0B, 0x08, 0x8D, 0x74, 0xE1, 0x04, 0xC0, 0x2C, 0x2C,
+  0x73, 0x69, 0xED, 0xA1, 0x2A, 0x72, 0x69, 0x68, 0x73, 0x61, 0xF7, 0xA7, 0x93, 0x6E, 0xEF, 0x69,
+  0x03, 0xA9, 0x64, 0xE4, 0x81, 0x75, 0xF2, 0xC0, 0x75, 0x43, 0xE7, 0x07, 0x2B, 0x05, 0x21, 0x9C,
+  0xAF, 0xD7, 0x65, 0x74, 0xEF, 0xC0, 0x7E, 0xFF, 0x6E, 0x69, 0x68, 0xF3, 0xC0, 0x6F, 0x3F, 0xE9,
+  0x06, 0x0E, 0x06, 0x11, 0x08, 0x86, 0xF2, 0x02, 0x87, 0x75, 0xF3, 0x81, 0xF4, 0xC0, 0x2B, 0xED,
+  0xEF, 0xC0, 0x6A, 0x79, 0xED, 0x81, 0xE9, 0xC0, 0x3A, 0x77, 0xEB, 0x02, 0x86, 0xF5, 0x81, 0xE2,
+  0xC0, 0x7C, 0x86, 0xE1, 0x03, 0xA6, 0x80, 0x7A, 0xE9, 0xA8, 0xA3, 0x68, 0xF3, 0x03, 0xA9, 0xD9,
+  0xE9, 0xA3, 0x05, 0xE5, 0x81, 0xEE, 0xC0, 0x7B, 0xCB, 0xE1, 0x81, 0xE4, 0xC0, 0x77, 0x0E, 0xE5,
+  0x03, 0x09, 0x84, 0x74, 0xE1, 0x04, 0xC0, 0x7D, 0xAB, 0xF4, 0xA7, 0xDF, 0xE9, 0xC0, 0x7D, 0xC1,
+  0x67, 0x6E, 0x61, 0xE2, 0xA0, 0xA9, 0xE1, 0x07, 0x20, 0x29, 0x0C, 0x12, 0xA0, 0x23, 0xF7, 0x04,
+  0xC0, 0x6B, 0x66, 0xE1, 0x05, 0x10, 0xC0, 0x35, 0xAB, 0xEB, 0x02, 0x85, 0x69, 0xE8, 0xC0, 0x70,
+  0x39, 0xE1, 0x22, 0xCE, 0x28, 0xB9, 0xC0, 0x73, 0x12, 0xE7, 0x04, 0x04, 0xA7, 0x18, 0xE5, 0xC0,
+  0x78, 0xD4, 0x61, 0xEB, 0xC0, 0x7A, 0xC5, 0x74, 0xE1, 0x04, 0x03, 0xA8, 0xB7, 0xED, 0xA8, 0x13,
+  0xEB, 0xAA, 0x73, 0xF2, 0x02, 0x87, 0x75, 0x67, 0x61, 0xEE, 0xC0, 0x6E, 0xA3, 0x61, 0x62, 0x6F,
+  0x69, 0x68, 0xF3, 0xAA, 0x61, 0xED, 0x06, 0x04, 0x08, 0xC0, 0x6B, 0x72, 0xF5, 0xC0, 0x7A, 0x4B,
+  0x69, 0x68, 0xF3, 0x29, 0xF9, 0xC0, 0x75, 0x48, 0xE1, 0x04, 0xC0, 0x7D, 0xD3, 0xF9, 0x02, 0x85,
+  0x69, 0xF2, 0xC0, 0x69, 0xC8, 0xE5, 0xA9, 0xF0, 0x62, 0xE1, 0xC0, 0x54, 0xA7, 0x6F, 0xF4, 0x69,
+  0x81, 0xAE, 0x06, 0x0D, 0x08, 0x20, 0x2C, 0x87, 0xEF, 0x02, 0x85, 0x74, 0xF5, 0xC0, 0x22, 0xB9,
+  0x6E, 0xE1, 0xC0, 0x73, 0xCB, 0x6E, 0x61, 0xEE, 0x28, 0x94, 0xC0, 0x76, 0x89, 0xE9, 0x05, 0x06,
+  0x09, 0x06, 0x8D, 0x75, 0x6B, 0x69, 0xE8, 0xAA, 0xDE, 0xED, 0x03, 0xAA, 0x92, 0x75, 0xFA, 0xC0,
+  0x70, 0x2E, 0x6B, 0x69, 0xEA, 0xC0, 0x64, 0x93, 0xE8, 0x02, 0x83, 0xF3, 0xA4, 0x1E, 0x63, 0x6F,
+  0x67, 0xE1, 0xC0, 0x5B, 0xDA, 0xE7, 0xC0, 0x76, 0x0B, 0x65, 0x67, 0x69, 0x68, 0xF3, 0xAA, 0x95,
+  0xE1, 0x03, 0x06, 0x93, 0x77, 0xE1, 0x81, 0xE7, 0xA1, 0xCB, 0x6D, 0xE9, 0x04, 0xC0, 0x7E, 0xC6,
+  0x68, 0x73, 0xF5, 0x03, 0xAC, 0x28, 0x73, 0xF4, 0x81, 0xE1, 0xC0, 0x69, 0x4E, 0x62, 0xE9, 0xAB,
+  0x79, 0xEF, 0x03, 0xA0, 0xA4, 0x72, 0x69, 0xE8, 0x69, 0x81, 0xAE, 0x07, 0x03, 0x0B, 0x0E, 0x20,
+  0x2A, 0x87, 0xF5, 0xA1, 0x4D, 0xEF, 0x02, 0x83, 0xEE, 0xA7, 0x68, 0x67, 0xEE, 0xC0, 0x7D, 0xB7,
+  0x6E, 0x65, 0x67, 0x6F, 0x6B, 0x69, 0x6B, 0x65, 0x73, 0x6E, 0xE9, 0xC0, 0x79, 0x9D, 0xE9, 0x05,
+  0x07, 0xC0, 0x72, 0x77, 0x6D, 0x61, 0x6E, 0x69, 0xED, 0xAA, 0x9F, 0xE8, 0x02, 0x8B, 0xF3, 0x03,
+  0xA3, 0xA8, 0x69, 0x6E, 0x61, 0xF2, 0xC0, 0x7A, 0x71, 0x63, 0xE9, 0x04, 0x03, 0xA5, 0xCD, 0xED,
+  0xA5, 0x82, 0x61, 0x6B, 0x75, 0xF3, 0xB5, 0xC7, 0xE5, 0x03, 0xA6, 0x2A, 0xEB, 0xA3, 0x7C, 0xE1,
+  0x06, 0x03, 0x03, 0x14, 0xA0, 0x22, 0xF7, 0xA6, 0xD5, 0xF4, 0xA7, 0xD2, 0xF2, 0x04, 0xC0, 0x7A,
+  0x46, 0xE1, 0x02, 0x88, 0xE8, 0x04, 0xC0, 0x7E, 0x3B, 0xE5, 0xA8, 0x98, 0xE2, 0xC0, 0x6A, 0x0C,
+  0xED, 0x02, 0x9B, 0xE9, 0x02, 0x90, 0xEA, 0x02, 0x89, 0x69, 0x6D, 0x61, 0x6B, 0x69, 0xEB, 0xC0,
+  0x7C, 0xCD, 0xE1, 0xC0, 0x2F, 0x8F, 0x68, 0x73, 0x6F, 0x72, 0x69, 0xE8, 0xA8, 0x27, 0x61, 0xF9,
+  0xA8, 0xCC, 0x6B, 0xE1, 0x40, 0x7D, 0xAF, 0xA0, 0x53, 0x67, 0x61, 0xEB, 0x69, 0x81, 0xAE, 0x07,
+  0x09, 0x11, 0x04, 0x20, 0x2B, 0x9D, 0x75, 0x7A, 0x69, 0xED, 0x81, 0xF5, 0xC0, 0x51, 0x8C, 0xEF,
+  0x05, 0x06, 0xC0, 0x6A, 0x1F, 0x74, 0xEF, 0x81, 0xED, 0xA9, 0xAA, 0x6B, 0xEE, 0xC0, 0x7A, 0x7F,
+  0xEE, 0xC0, 0x6E, 0x94, 0xE9, 0x04, 0x04, 0x06, 0x90, 0x75, 0xF3, 0xA5, 0x7F, 0xED, 0x26, 0xB0,
+  0xC0, 0x24, 0x19, 0xEB, 0x02, 0x84, 0xEF, 0xC0, 0x5A, 0xAB, 0x61, 0x7A, 0x61, 0x72, 0x75, 0xEB,
+  0xC0, 0x73, 0x49, 0x61, 0x64, 0x6E, 0x65, 0x73, 0x61, 0x6D, 0x75, 0xF3, 0xC0, 0x2F, 0x94, 0xE5,
+  0x03, 0x08, 0x8D, 0x74, 0x6F, 0x6D, 0x6F, 0x6F, 0xEE, 0xA8, 0xAE, 0xEE, 0x02, 0x84, 0xF5, 0xC0,
+  0x2C, 0x44, 0x61, 0xF4, 0x20, 0x9F, 0xA8, 0x98, 0x62, 0xE1, 0xA3, 0xEE, 0xE1, 0x05, 0x04, 0xC0,
+  0x6E, 0x41, 0x79, 0xEF, 0xA8, 0x52, 0xED, 0x02, 0x86, 0x69, 0x68, 0x73, 0xEF, 0xA0, 0xCD, 0x61,
+  0x79, 0xF5, 0xC0, 0x68, 0x18, 0xE1, 0x05, 0x21, 0xF8, 0xA1, 0x79, 0xF9, 0x03, 0xA0, 0x94, 0x6F,
+  0xF4, 0x69, 0x81, 0xAE, 0x07, 0x1A, 0x04, 0x07, 0x20, 0x27, 0x86, 0xF5, 0x03, 0x0B, 0x86, 0xFA,
+  0x02, 0x84, 0xEF, 0xC0, 0x7B, 0x5B, 0xE9, 0xC0, 0x76, 0xF2, 0x73, 0x74, 0x69, 0xED, 0xA8, 0x0E,
+  0x68, 0xE3, 0xC0, 0x72, 0x88, 0x6F, 0xF4, 0xB9, 0xC3, 0x6E, 0x65, 0x7A, 0xF5, 0xC0, 0x73, 0xF5,
+  0xE9, 0x03, 0x0C, 0x87, 0xED, 0x04, 0xC0, 0x5A, 0x19, 0x61, 0xEE, 0x40, 0x7C, 0x35, 0xA0, 0xC5,
+  0x6B, 0x75, 0x7A, 0xE1, 0xC0, 0x58, 0x71, 0xE8, 0x04, 0x07, 0xA9, 0x45, 0x73, 0x61, 0x68, 0xE1,
+  0xC0, 0x70, 0x91, 0x63, 0xE9, 0xA8, 0x09, 0x65, 0xE2, 0x24, 0xCA, 0xA6, 0x06, 0xE1, 0x08, 0x11,
+  0x04, 0x06, 0x0A, 0x04, 0xA9, 0x1D, 0x77, 0x61, 0x6B, 0xE9, 0x02, 0x84, 0xF2, 0xC0, 0x7B, 0x1F,
+  0x69, 0xEE, 0x81, 0xE1, 0xC0, 0x4F, 0x62, 0xF2, 0xC0, 0x6C, 0x43, 0x6E, 0x61, 0xE8, 0xC0, 0x70,
+  0xA8, 0x6D, 0x61, 0xF9, 0x04, 0xC0, 0x7C, 0xAD, 0xE5, 0xAD, 0xA9, 0x6B, 0xEF, 0xA7, 0x43, 0xE4,
+  0xC0, 0x28, 0xEA, 0x61, 0xEB, 0x03, 0xA0, 0xAB, 0xEF, 0x69, 0x81, 0xAE, 0x07, 0x20, 0x2A, 0x0C,
+  0x20, 0x28, 0x8B, 0xEF, 0x07, 0x08, 0x11, 0x03, 0xC0, 0x68, 0x82, 0x75, 0x68, 0x63, 0x69, 0xE2,
+  0xC0, 0x79, 0x5C, 0xEE, 0x02, 0x88, 0x69, 0x6D, 0xE1, 0x81, 0xE7, 0xC0, 0x62, 0xCD, 0xE1, 0x81,
+  0xED, 0xC0, 0x6B, 0xFC, 0xEA, 0xA4, 0x1A, 0x68, 0x73, 0xEF, 0xC0, 0x2E, 0x86, 0xEE, 0x02, 0x84,
+  0xE5, 0xC0, 0x76, 0x5B, 0x61, 0x6E, 0xE5, 0xA5, 0x6C, 0xE9, 0x06, 0x03, 0x0A, 0xC0, 0x77, 0x79,
+  0xED, 0xA1, 0xFF, 0xEB, 0x03, 0xA0, 0x7D, 0x69, 0x68, 0x73, 0xE1, 0xA4, 0x5B, 0xE8, 0x02, 0x86,
+  0x73, 0xE1, 0x81, 0xE8, 0xA6, 0xDC, 0x63, 0xF5, 0x02, 0x84, 0xEF, 0xC0, 0x2F, 0xDE, 0xEB, 0xA8,
+  0x99, 0xE5, 0x03, 0xA0, 0xD5, 0x67, 0xE1, 0x81, 0xEB, 0xC0, 0x79, 0x1D, 0xE1, 0x05, 0x0A, 0x0B,
+  0x11, 0x87, 0x77, 0xE9, 0x04, 0xC0, 0x33, 0x3C, 0xE1, 0xC0, 0x2A, 0xFA, 0xF2, 0x03, 0xA5, 0x3F,
+  0x75, 0x6B, 0x61, 0x77, 0xE1, 0xA7, 0x52, 0xED, 0x02, 0x89, 0x69, 0x68, 0xF3, 0x81, 0x61, 0xF9,
+  0xC0, 0x5C, 0xFF, 0x61, 0xF9, 0x23, 0xBF, 0x92, 0x6B, 0xEF, 0x81, 0xE1, 0xC0, 0x4C, 0xC5, 0xEA,
+  0xC0, 0x68, 0x6A, 0x61, 0xF7, 0x69, 0x81, 0xAE, 0x06, 0x03, 0x1A, 0x05, 0x10, 0x8D, 0xF5, 0xA3,
+  0x23, 0xEF, 0x05, 0x11, 0xC0, 0x79, 0xCF, 0xF4, 0x02, 0x8A, 0x6F, 0x6D, 0x69, 0x68, 0xF3, 0x40,
+  0x5C, 0xD0, 0xB3, 0x43, 0xE1, 0xC0, 0x60, 0xA2, 0xEE, 0xA7, 0x65, 0x6E, 0x61, 0xEE, 0xA5, 0x8E,
+  0xE9, 0x03, 0x03, 0x84, 0xED, 0xA3, 0x79, 0xEA, 0xC0, 0x6B, 0x43, 0x67, 0x61, 0xF2, 0xA8, 0xA4,
+  0xE5, 0x02, 0x84, 0x64, 0xE1, 0xA2, 0xA2, 0x62, 0x61, 0xEE, 0xC0, 0x6B, 0x33, 0xE1, 0x0A, 0x04,
+  0x18, 0x04, 0x11, 0x1B, 0x06, 0xC0, 0x3C, 0x09, 0xF9, 0xC0, 0x66, 0x71, 0x77, 0xE1, 0x02, 0x86,
+  0x6B, 0x6F, 0xEE, 0xC0, 0x78, 0x69, 0xE7, 0x02, 0x83, 0xEF, 0xA5, 0x1D, 0xE1, 0x04, 0xC0, 0x3C,
+  0x42, 0xE4, 0xA6, 0xB2, 0x73, 0xE1, 0xA3, 0x64, 0x72, 0xF5, 0x04, 0xC0, 0x7B, 0x53, 0x75, 0x73,
+  0x74, 0x61, 0x6B, 0x69, 0x68, 0xE3, 0xC0, 0x79, 0xCA, 0x6D, 0xE1, 0x02, 0x91, 0xF9, 0x02, 0x85,
+  0x6F, 0xE4, 0xC0, 0x6F, 0xA0, 0xE1, 0x04, 0xC0, 0x2A, 0x1C, 0xEB, 0xC0, 0x61, 0x3D, 0xE8, 0x21,
+  0x7B, 0xC0, 0x7A, 0x1A, 0xEB, 0x81, 0xE1, 0xC0, 0x49, 0x74, 0xE4, 0x03, 0xA6, 0x76, 0x6E, 0x6F,
+  0xF4, 0xA6, 0x6D, 0x74, 0x69, 0x61, 0xF3, 0x69, 0x81, 0xAE, 0x08, 0x19, 0x20, 0x4F, 0x07, 0x20,
+  0x47, 0x9A, 0xF5, 0x03, 0x04, 0x87, 0xF9, 0xC0, 0x31, 0x9D, 0x73, 0x6F, 0x6E, 0xF5, 0xC0, 0x65,
+  0xFC, 0x62, 0x69, 0x68, 0x63, 0x69, 0x68, 0xE3, 0x69, 0xA5, 0x6A, 0xEF, 0x09, 0x15, 0x0E, 0x14,
+  0x05, 0x06, 0xC0, 0x4B, 0x79, 0xF4, 0x03, 0x04, 0x85, 0x6F, 0xED, 0xA6, 0x59, 0x69, 0xE7, 0xC0,
+  0x76, 0x9A, 0x61, 0x73, 0x69, 0xED, 0x69, 0xC0, 0x61, 0x51, 0xF2, 0x02, 0x86, 0x6F, 0x74, 0xE1,
+  0xC0, 0x76, 0x26, 0x69, 0x68, 0xF3, 0xA3, 0x6A, 0xEE, 0x08, 0x04, 0x40, 0x31, 0x4F, 0xC0, 0x48,
+  0xC3, 0x69, 0xED, 0xA4, 0x7F, 0xE1, 0x40, 0x26, 0xBF, 0xC0, 0x3E, 0x02, 0x6A, 0xEE, 0xC0, 0x7A,
+  0x36, 0x69, 0x68, 0xF3, 0xC0, 0x77, 0xC2, 0xE4, 0xA7, 0x48, 0x6E, 0x61, 0x7A, 0xEE, 0xC0, 0x6F,
+  0x88, 0xE9, 0x05, 0x14, 0x12, 0x04, 0x91, 0xED, 0x03, 0x05, 0x85, 0x75, 0x7A, 0xE9, 0xA5, 0xE0,
+  0xE9, 0x24, 0x53, 0xA1, 0x4F, 0x61, 0x6B, 0xEF, 0xC0, 0x4E, 0x3A, 0xEB, 0x05, 0x08, 0xC0, 0x79,
+  0xC4, 0xF5, 0x04, 0xC0, 0x77, 0x78, 0xF3, 0xA1, 0x8D, 0xE1, 0xC0, 0x79, 0x76, 0xE9, 0xC0, 0x36,
+  0x71, 0xE8, 0x02, 0x89, 0xF3, 0x02, 0x83, 0xF5, 0xA4, 0x36, 0xEF, 0xA3, 0x07, 0x63, 0x75, 0xE7,
+  0xA3, 0x71, 0x62, 0x61, 0xF2, 0xC0, 0x60, 0x63, 0xE5, 0x05, 0x04, 0x04, 0x03, 0x84, 0xFA, 0xC0,
+  0x78, 0xEF, 0xF4, 0xC0, 0x2C, 0x8D, 0xF3, 0xA2, 0x05, 0x6F, 0xE7, 0xA3, 0x56, 0x62, 0x61, 0xEB,
+  0xA2, 0xF2, 0xE1, 0x0B, 0x06, 0x15, 0x20, 0x27, 0x20, 0x32, 0x12, 0xC0, 0x78, 0xA0, 0xFA, 0x81,
+  0xE9, 0xC0, 0x79, 0x43, 0xF9, 0x03, 0xA4, 0x8E, 0xE1, 0x03, 0xA5, 0x42, 0xE7, 0x04, 0x03, 0xA3,
+  0x4D, 0xEF, 0xB1, 0xEB, 0xE9, 0x81, 0xE8, 0xA4, 0xA1, 0x77, 0xE1, 0x06, 0x06, 0x0A, 0xC0, 0x77,
+  0xE9, 0x7A, 0x6F, 0x72, 0xEF, 0xA7, 0xD9, 0xEB, 0x04, 0xC0, 0x24, 0x83, 0xE9, 0x25, 0x16, 0xA1,
+  0xCB, 0xE7, 0x05, 0x03, 0xC0, 0x7A, 0x62, 0xE9, 0xA7, 0xC6, 0xE5, 0x40, 0x75, 0x5D, 0xA3, 0x16,
+  0xED, 0x03, 0x04, 0x90, 0xF5, 0xC0, 0x77, 0xC7, 0xE9, 0x02, 0x83, 0xEA, 0xA2, 0xF5, 0x68, 0x73,
+  0xE1, 0x81, 0x67, 0xF5, 0x81, 0xF2, 0xA1, 0xBE, 0xE1, 0x02, 0x93, 0xF9, 0x05, 0x07, 0xC0, 0x77,
+  0x5E, 0x75, 0x73, 0x74, 0x61, 0xED, 0xA4, 0x3D, 0xEF, 0x31, 0x94, 0xC0, 0x56, 0xAB, 0xF4, 0xC0,
+  0x2D, 0xE9, 0xEB, 0x02, 0x88, 0xEF, 0x04, 0xC0, 0x79, 0xB9, 0xE1, 0xA6, 0x1E, 0xE1, 0x40, 0x47,
+  0xFD, 0xC0, 0x31, 0x30, 0xE4, 0x24, 0xBC, 0x3C, 0xF4, 0xC0, 0x58, 0x20, 0x68, 0x6F, 0x6B, 0x6F,
+  0xF9, 0x6A, 0x81, 0x2E, 0x79, 0x74, 0x69, 0xE3, 0x64, 0xEB, 0x03, 0xA2, 0x52, 0x6F, 0xF5, 0x03,
+  0xA0, 0xD8, 0x7A, 0x69, 0x68, 0xF3, 0x69, 0x81, 0xAE, 0x07, 0x20, 0x27, 0x0C, 0x08, 0xA0, 0x35,
+  0xF5, 0x02, 0x9E, 0xFA, 0x02, 0x93, 0xE9, 0x69, 0x06, 0x26, 0x77, 0xC0, 0x70, 0x11, 0xE9, 0x03,
+  0xA5, 0x6B, 0x68, 0xF3, 0x23, 0xE5, 0xC0, 0x74, 0x9B, 0xE1, 0x03, 0xA2, 0x76, 0xED, 0xC0, 0x79,
+  0x37, 0x73, 0x74, 0x61, 0xED, 0xA4, 0xE0, 0xEF, 0x04, 0xC0, 0x6E, 0x71, 0x6E, 0xEF, 0x81, 0xF3,
+  0xC0, 0x75, 0x09, 0x6E, 0x6F, 0x68, 0xE5, 0x81, 0xEE, 0xA2, 0x58, 0xE9, 0x08, 0x04, 0x07, 0x09,
+  0x0A, 0x08, 0xA2, 0xDA, 0x6F, 0xF2, 0xA4, 0x56, 0x6E, 0x75, 0x6B, 0x6F, 0xEE, 0xA2, 0x71, 0x6D,
+  0xE1, 0x04, 0xC0, 0x76, 0x83, 0xEE, 0xA4, 0x50, 0x6B, 0x61, 0xFA, 0x03, 0xA5, 0x45, 0xE5, 0xC0,
+  0x38, 0x3A, 0x68, 0x63, 0x61, 0x6D, 0xE9, 0xC0, 0x67, 0x91, 0xE1, 0x23, 0x9D, 0xC0, 0x6F, 0xB0,
+  0xE1, 0x08, 0x07, 0x14, 0x07, 0x11, 0x06, 0x07, 0x8B, 0x79, 0x69, 0x6D, 0x6F, 0xEE, 0xA2, 0xC4,
+  0x77, 0xE1, 0x02, 0x83, 0xEB, 0xA2, 0xBD, 0xE7, 0x02, 0x85, 0x75, 0xEB, 0xC0, 0x75, 0xF0, 0x65,
+  0xEB, 0xC0, 0x5F, 0x67, 0x74, 0xE1, 0x81, 0xF7, 0xC0, 0x78, 0x48, 0x72, 0xE1, 0x02, 0x88, 0x68,
+  0x6F, 0x6E, 0x69, 0xEB, 0xC0, 0x6E, 0xC5, 0x62, 0xE9, 0xC0, 0x59, 0xF6, 0x6D, 0x69, 0xE8, 0xC0,
+  0x5D, 0xC8, 0x6B, 0x6F, 0x75, 0xFA, 0xC0, 0x78, 0x17, 0xE4, 0x07, 0x21, 0xA8, 0x22, 0x28, 0xA1,
+  0xF2, 0xE5, 0xA2, 0x80, 0x62, 0x6D, 0xE5, 0xC0, 0x5B, 0x5B, 0x6B, 0x75, 0xE6, 0x69, 0x81, 0xAE,
+  0x08, 0x14, 0x20, 0x25, 0x14, 0x20, 0x81, 0x94, 0xF5, 0x03, 0x06, 0x83, 0xF3, 0x81, 0xF4, 0xC0,
+  0x75, 0xEA, 0xE7, 0xA0, 0x6C, 0x66, 0x69, 0x61, 0xFA, 0xC0, 0x75, 0xF2, 0xEF, 0x0A, 0x05, 0x03,
+  0x07, 0x07, 0x40, 0x58, 0x0F, 0xBF, 0x64, 0x6E, 0x69, 0x68, 0xF3, 0x94, 0xEB, 0xA1, 0x23, 0xEA,
+  0x02, 0x8D, 0xEF, 0xC0, 0x78, 0x75, 0xE8, 0x08, 0x40, 0x5E, 0xE9, 0xB9, 0xAD, 0xE7, 0x81, 0xF5,
+  0x8B, 0x6E, 0xE5, 0x02, 0x8A, 0x7A, 0xF5, 0x04, 0xC0, 0x78, 0xB7, 0xEB, 0xC0, 0x56, 0xA7, 0x73,
+  0x69, 0xE5, 0xC0, 0x75, 0x5C, 0xE9, 0x08, 0x04, 0x0E, 0x13, 0x20, 0x27, 0x17, 0x85, 0xF5, 0xC0,
+  0x6C, 0xC5, 0xF2, 0x02, 0x87, 0x75, 0x67, 0x61, 0xF3, 0xC0, 0x75, 0xDD, 0xEF, 0xC0, 0x24, 0x48,
+  0xED, 0x06, 0x24, 0x38, 0xC0, 0x72, 0x5F, 0x6F, 0x74, 0x69, 0x68, 0x73, 0x6F, 0xF9, 0x81, 0xEE,
+  0xC0, 0x77, 0x7D, 0xEB, 0x06, 0x08, 0x08, 0xC0, 0x78, 0x82, 0x75, 0x73, 0xF4, 0x81, 0xE1, 0xC0,
+  0x77, 0x15, 0xE9, 0x81, 0xF5, 0x81, 0xF3, 0xC0, 0x78, 0x8C, 0xE1, 0x02, 0x87, 0xED, 0x81, 0x75,
+  0xFA, 0xC0, 0x78, 0x73, 0xE7, 0x81, 0xE1, 0xC0, 0x73, 0x71, 0xE8, 0x02, 0x91, 0xF3, 0x04, 0xC0,
+  0x77, 0x12, 0xE1, 0x03, 0xA2, 0x75, 0x68, 0x75, 0xEB, 0x81, 0xF5, 0xC0, 0x77, 0xF6, 0xE3, 0xA3,
+  0x0D, 0xE7, 0x81, 0xEF, 0xA0, 0x22, 0xE1, 0x02, 0x89, 0x72, 0xE1, 0x81, 0x69, 0x68, 0xE3, 0xC0,
+  0x67, 0x8E, 0xEE, 0xC0, 0x64, 0x16, 0xE5, 0x05, 0x03, 0xC0, 0x73, 0x8A, 0x74, 0xE1, 0x88, 0xED,
+  0x04, 0xC0, 0x74, 0xE2, 0xF5, 0x81, 0xF2, 0xC0, 0x6C, 0x2B, 0xE1, 0x09, 0x0A, 0x1A, 0x18, 0x03,
+  0x10, 0x13, 0x05, 0x8B, 0xF9, 0x03, 0xA0, 0x6A, 0xE9, 0x81, 0xE8, 0xC0, 0x77, 0x30, 0x77, 0xE1,
+  0x02, 0x85, 0x6B, 0xEF, 0x69, 0xA1, 0x62, 0xE7, 0x04, 0xC0, 0x2B, 0xCC, 0xE1, 0x07, 0x40, 0x4A,
+  0x62, 0xC0, 0x2D, 0xAD, 0xEE, 0xC0, 0x74, 0xB1, 0xF4, 0x02, 0x84, 0xF5, 0xC0, 0x76, 0xF8, 0xE1,
+  0x02, 0x8A, 0x6B, 0xE1, 0x40, 0x4E, 0x3B, 0x40, 0x28, 0xD7, 0xA0, 0xED, 0xE7, 0xC0, 0x77, 0x78,
+  0xF2, 0xA0, 0x90, 0x6D, 0xE1, 0x04, 0xC0, 0x4A, 0x3D, 0xF9, 0x04, 0xC0, 0x77, 0xD6, 0x61, 0xF3,
+  0xC0, 0x54, 0xB2, 0xEB, 0x02, 0x87, 0x75, 0xFA, 0x81, 0xE9, 0xC0, 0x76, 0xC6, 0x61, 0xF7, 0x81,
+  0xE1, 0x81, 0xF9, 0xC0, 0x77, 0xC1, 0x68, 0xE9, 0xC0, 0x6C, 0x4F, 0xE7, 0x06, 0x40, 0x62, 0x48,
+  0xB4, 0xFE, 0xF5, 0xC0, 0x48, 0x3E, 0xE4, 0x04, 0xC0, 0x23, 0xAF, 0xE5, 0xC0, 0x63, 0xDE, 0x61,
+  0x73, 0xEF, 0x69, 0x81, 0xAE, 0x09, 0x0B, 0x20, 0x3E, 0x0D, 0x20, 0x57, 0x06, 0x91, 0x75, 0x73,
+  0xF4, 0x04, 0xC0, 0x2A, 0xF4, 0x6F, 0xE9, 0xA0, 0x65, 0xEF, 0x07, 0x0F, 0x40, 0x56, 0xAC, 0xBD,
+  0x7A, 0xF4, 0x04, 0x06, 0xA3, 0x13, 0x6F, 0xED, 0x81, 0xE1, 0xA4, 0x1B, 0xE9, 0xC0, 0x74, 0x6E,
+  0xEE, 0x06, 0x05, 0x04, 0xC0, 0x74, 0x49, 0x69, 0x6B, 0xE9, 0xAA, 0xB7, 0xE5, 0xC0, 0x75, 0x13,
+  0xE1, 0x05, 0x04, 0xC0, 0x4B, 0x65, 0x73, 0xE9, 0xA0, 0x34, 0x67, 0x61, 0x6E, 0x69, 0x68, 0xE3,
+  0x81, 0xE1, 0x81, 0xF7, 0xC0, 0x5D, 0x64, 0x6E, 0x61, 0xEE, 0x04, 0xC0, 0x5D, 0x5A, 0xEE, 0x40,
+  0x58, 0x00, 0xBB, 0x48, 0xE9, 0x06, 0x11, 0x08, 0x0E, 0xA3, 0x4E, 0xF2, 0x02, 0x89, 0x6F, 0xF4,
+  0x81, 0xE1, 0x81, 0xED, 0xC0, 0x6B, 0x2E, 0x69, 0xEA, 0xC0, 0x66, 0x74, 0xED, 0x81, 0xF5, 0x81,
+  0xFA, 0xC0, 0x76, 0x1F, 0xEB, 0x03, 0xA1, 0x39, 0xE1, 0x04, 0xC0, 0x5B, 0xAA, 0xF2, 0x81, 0xE1,
+  0xB3, 0x99, 0xE8, 0x02, 0x9F, 0xF3, 0x03, 0x08, 0x8B, 0x6F, 0x79, 0x69, 0x6D, 0x75, 0xF3, 0xA1,
+  0x14, 0xE9, 0x04, 0xC0, 0x76, 0xF0, 0xE1, 0x21, 0x5B, 0xC0, 0x75, 0xB1, 0x61, 0x79, 0x61, 0x62,
+  0x61, 0xE4, 0xAF, 0xF4, 0x63, 0x75, 0x67, 0xE9, 0xC0, 0x65, 0x00, 0xE8, 0x81, 0xEF, 0xC0, 0x60,
+  0x89, 0xE5, 0x02, 0x8A, 0x74, 0x61, 0x77, 0x61, 0x6E, 0x6F, 0xEA, 0xC0, 0x75, 0xC2, 0xF3, 0xC0,
+  0x76, 0x66, 0xE1, 0x07, 0x10, 0x11, 0x16, 0x14, 0xA0, 0x27, 0x77, 0x61, 0xE7, 0x02, 0x86, 0x6F,
+  0x64, 0x6F, 0xF9, 0xA0, 0xD0, 0x61, 0xF9, 0xC0, 0x76, 0xAD, 0xF4, 0x02, 0x86, 0xE9, 0x40, 0x72,
+  0x0B, 0xA1, 0x45, 0x61, 0x6B, 0xE1, 0x81, 0xF2, 0xC0, 0x53, 0x8A, 0xF2, 0x02, 0x8A, 0x65, 0x64,
+  0xE9, 0x81, 0xE9, 0x81, 0xEA, 0xC0, 0x6B, 0xD5, 0xE1, 0x02, 0x83, 0xF7, 0xA2, 0xF8, 0xE2, 0xA2,
+  0x54, 0xED, 0x02, 0x86, 0xEF, 0x81, 0xE4, 0xC0, 0x5C, 0xA1, 0x61, 0x79, 0x61, 0xF3, 0x69, 0x81,
+  0x61, 0xEB, 0xC0, 0x75, 0x2A, 0xEB, 0x03, 0x07, 0x87, 0x75, 0xFA, 0x81, 0xE9, 0xC0, 0x5C, 0x8B,
+  0x6F, 0xE1, 0x81, 0xE4, 0xC0, 0x65, 0xB9, 0xE1, 0x02, 0x8E, 0xF3, 0x03, 0xA0, 0x73, 0x61, 0x6B,
+  0x61, 0x61, 0x79, 0x61, 0xE8, 0xC0, 0x54, 0x3E, 0xEE, 0xC0, 0x73, 0x40, 0xE4, 0x02, 0x84, 0xE5,
+  0xC0, 0x53, 0x96, 0x61, 0x77, 0x69, 0x68, 0xF3, 0xC0, 0x72, 0xE4, 0xE7, 0x03, 0xA0, 0xB8, 0x69,
+  0x68, 0xF3, 0x69, 0x81, 0xAE, 0x08, 0x11, 0x1B, 0x11, 0x20, 0x27, 0x06, 0x90, 0x75, 0xF3, 0x04,
+  0xC0, 0x72, 0xE3, 0xF4, 0x04, 0xC0, 0x76, 0x34, 0xE1, 0x81, 0xF3, 0xC0, 0x6A, 0x27, 0xEF, 0x05,
+  0x0F, 0xC0, 0x6D, 0xF5, 0xF4, 0x05, 0x04, 0xC0, 0x60, 0xAC, 0xF4, 0xC0, 0x72, 0x96, 0x61, 0xF3,
+  0xC0, 0x72, 0xF9, 0xE8, 0x81, 0xF3, 0xC0, 0x67, 0x47, 0x6E, 0xE1, 0x04, 0xC0, 0x4A, 0xF0, 0x6D,
+  0x69, 0x68, 0x63, 0x61, 0xE8, 0x81, 0xE9, 0xC0, 0x74, 0xFD, 0xE9, 0x04, 0x10, 0x07, 0x86, 0xED,
+  0x81, 0xEF, 0x81, 0xE9, 0x81, 0xE8, 0x81, 0xF3, 0x81, 0xE1, 0x81, 0xE7, 0xC0, 0x52, 0xC6, 0xEB,
+  0x81, 0x75, 0x73, 0xF4, 0xA0, 0x3C, 0xE5, 0x81, 0xF3, 0xC0, 0x60, 0x71, 0x61, 0x7A, 0xE1, 0xA0,
+  0xD8, 0x68, 0x6F, 0xF5, 0xC0, 0x49, 0x1E, 0xE5, 0x02, 0x86, 0x6E, 0x6F, 0xEB, 0xC0, 0x52, 0xA5,
+  0x6D, 0x69, 0x68, 0xE1, 0xC0, 0x2B, 0x13, 0xE1, 0x04, 0x07, 0x06, 0x9A, 0x77, 0x61, 0x67, 0xEF,
+  0xC0, 0x44, 0x3B, 0x72, 0x61, 0xE2, 0xC0, 0x5D, 0x74, 0xED, 0x02, 0x8A, 0x69, 0x68, 0xF3, 0x81,
+  0xE1, 0x81, 0xEB, 0xC0, 0x64, 0xEA, 0xE1, 0x02, 0x85, 0x79, 0xE9, 0xC0, 0x63, 0xAD, 0x68, 0xE1,
+  0xC0, 0x70, 0x86, 0xEB, 0xC0, 0x60, 0x26, 0x61, 0xF3, 0x69, 0x81, 0xAE, 0x06, 0x18, 0x06, 0x20,
+  0x47, 0x91, 0xF5, 0x02, 0x8A, 0xF3, 0x04, 0xC0, 0x75, 0x3B, 0x74, 0xE1, 0xC0, 0x45, 0xBC, 0xEB,
+  0x04, 0xC0, 0x64, 0xB9, 0x6F, 0x68, 0xF5, 0xC0, 0x60, 0x03, 0x6E, 0x65, 0xFA, 0xC0, 0x52, 0x45,
+  0xE9, 0x06, 0x11, 0x0A, 0x08, 0x0D, 0x8B, 0x72, 0xE1, 0x04, 0xC0, 0x6E, 0xEC, 0x67, 0x6F, 0xEE,
+  0x81, 0xE9, 0x81, 0x68, 0xF3, 0xC0, 0x74, 0x42, 0x6D, 0x6F, 0xE4, 0x81, 0xF5, 0x81, 0xEB, 0xC0,
+  0x6A, 0x7B, 0x6B, 0x61, 0xFA, 0x81, 0xEE, 0xC0, 0x5B, 0x51, 0xE8, 0x02, 0x84, 0x73, 0xE9, 0xA1,
+  0x38, 0xE3, 0x40, 0x33, 0xE7, 0xAD, 0xE4, 0xE7, 0x04, 0xC0, 0x75, 0x30, 0x61, 0x72, 0xF5, 0xC0,
+  0x70, 0xA4, 0x61, 0xEB, 0xC0, 0x5A, 0xDB, 0xE5, 0x02, 0x87, 0x6E, 0x69, 0xED, 0x81, 0xE9, 0xA1,
+  0x8F, 0x6B, 0xE1, 0x81, 0xE9, 0xC0, 0x6E, 0xE3, 0xE1, 0x06, 0x19, 0x11, 0xC0, 0x48, 0x6F, 0xF4,
+  0x02, 0x8B, 0x69, 0x72, 0xE1, 0x69, 0x81, 0xE9, 0x81, 0xE8, 0xC0, 0x6F, 0xB2, 0xE1, 0x02, 0x82,
+  0xE8, 0x83, 0xE7, 0x81, 0xE1, 0xC0, 0x23, 0x71, 0xED, 0x03, 0xA1, 0x48, 0xE1, 0x02, 0x84, 0xF9,
+  0xC0, 0x71, 0x7C, 0xF4, 0x81, 0xE1, 0xC0, 0x55, 0x97, 0xE7, 0xC0, 0x72, 0x0C, 0xE3, 0x04, 0xC0,
+  0x71, 0xBE, 0xE3, 0xC0, 0x55, 0x8C, 0xE2, 0x04, 0xC0, 0x73, 0xF0, 0x69, 0x68, 0xE3, 0x69, 0x81,
+  0xAE, 0x09, 0x20, 0x27, 0x20, 0x60, 0x09, 0x20, 0x5C, 0x8E, 0xF5, 0x03, 0x08, 0x95, 0x7A, 0x61,
+  0x72, 0x61, 0xF3, 0xC0, 0x71, 0x49, 0xF3, 0x02, 0x8B, 0xF4, 0x04, 0xC0, 0x4A, 0x23, 0xE9, 0x81,
+  0xED, 0xC0, 0x71, 0x3B, 0x61, 0xF9, 0x81, 0xE1, 0xC0, 0x72, 0x22, 0x6B, 0x75, 0xEA, 0xC0, 0x74,
+  0x2A, 0xEF, 0x0A, 0x05, 0x16, 0x0C, 0x07, 0x0D, 0x09, 0xC0, 0x53, 0x7C, 0x79, 0x69, 0xE8, 0xA1,
+  0x18, 0x74, 0x61, 0xF3, 0x02, 0x86, 0xE9, 0x81, 0xED, 0xC0, 0x74, 0x3C, 0x61, 0x72, 0x69, 0x68,
+  0x73, 0x69, 0x6D, 0xE1, 0xC0, 0x74, 0x78, 0x73, 0x6F, 0xE2, 0x81, 0xE9, 0x81, 0xED, 0x81, 0xE1,
+  0xC0, 0x5E, 0x07, 0x6E, 0x69, 0x68, 0x73, 0xE1, 0xB7, 0xFE, 0xEB, 0x02, 0x84, 0xE9, 0xC0, 0x72,
+  0x02, 0xE1, 0x20, 0x57, 0xC0, 0x74, 0x0A, 0x68, 0x73, 0x6F, 0xEE, 0x81, 0xE8, 0xC0, 0x74, 0x08,
+  0xE4, 0x02, 0x85, 0x75, 0xF3, 0xC0, 0x4A, 0xCC, 0x69, 0x61, 0x6B, 0x75, 0x73, 0xF4, 0xC0, 0x73,
+  0x29, 0x6E, 0x61, 0x6E, 0xEF, 0x40, 0x6F, 0xAE, 0xA0, 0xE5, 0xE9, 0x08, 0x06, 0x1E, 0x06, 0x05,
+  0x08, 0x12, 0x85, 0xF5, 0x81, 0xF3, 0xC0, 0x73, 0x07, 0xF2, 0x03, 0x08, 0x86, 0x75, 0x6B, 0xF5,
+  0x81, 0xEA, 0xC0, 0x68, 0x10, 0xEF, 0x40, 0x31, 0x86, 0xB6, 0x93, 0x61, 0x6B, 0x69, 0x68, 0x61,
+  0x62, 0x69, 0x68, 0xF3, 0xC0, 0x72, 0x3A, 0xEF, 0x81, 0xF2, 0xC0, 0x72, 0xE3, 0x6D, 0xF5, 0xC0,
+  0x64, 0xA8, 0x6B, 0xE1, 0x40, 0x34, 0x6F, 0xC0, 0x3E, 0x1D, 0xE8, 0x02, 0x8B, 0xF3, 0x04, 0xC0,
+  0x2F, 0x1D, 0x61, 0x62, 0xE1, 0xC0, 0x67, 0x4C, 0xE1, 0xC0, 0x72, 0xF2, 0x65, 0xF3, 0xC0, 0x2F,
+  0x11, 0x61, 0xFA, 0xC0, 0x72, 0x61, 0xE5, 0x02, 0x87, 0x6E, 0xE1, 0x81, 0xE7, 0xC0, 0x73, 0x88,
+  0xE1, 0xC0, 0x70, 0xF3, 0xE1, 0x0C, 0x10, 0x20, 0x2B, 0x0F, 0x0E, 0x20, 0x23, 0x12, 0xC0, 0x66,
+  0x75, 0xF9, 0x02, 0x88, 0xE9, 0x81, 0x6D, 0x6F, 0x6E, 0xE9, 0xA0, 0x6E, 0x61, 0xE7, 0x81, 0xE1,
+  0x9E, 0xF7, 0x02, 0x85, 0x69, 0xE8, 0xC0, 0x44, 0x2B, 0xE1, 0x03, 0x08, 0x84, 0x7A, 0xF5, 0x81,
+  0x73, 0xF4, 0xC0, 0x6A, 0xBF, 0x6B, 0xE9, 0xA0, 0x51, 0xE7, 0x02, 0x86, 0xEF, 0x81, 0xED, 0xC0,
+  0x59, 0x99, 0x69, 0xED, 0x04, 0xC0, 0x73, 0x84, 0xE1, 0xC0, 0x29, 0xAB, 0xF4, 0x02, 0x83, 0xE9,
+  0xB7, 0x16, 0x61, 0x6D, 0x69, 0xE8, 0x81, 0xE3, 0xC0, 0x70, 0x1E, 0xF3, 0x04, 0xC0, 0x5F, 0x9A,
+  0x75, 0xE6, 0x81, 0xEF, 0x81, 0xED, 0xC0, 0x72, 0x47, 0xF2, 0x02, 0x92, 0xF5, 0x05, 0x05, 0xC0,
+  0x70, 0x7D, 0x75, 0xF3, 0xC0, 0x47, 0x5B, 0x61, 0x67, 0x65, 0xE4, 0xC0, 0x5F, 0x7F, 0xE1, 0x06,
+  0x40, 0x6E, 0x31, 0xA3, 0x23, 0x68, 0xE9, 0x81, 0xE8, 0xC0, 0x6B, 0x75, 0x6D, 0xE1, 0x02, 0x8A,
+  0x79, 0xE5, 0x03, 0xA3, 0xED, 0x72, 0xE1, 0xC0, 0x6E, 0x1F, 0xE8, 0xC0, 0x73, 0x29, 0x62, 0x69,
+  0x68, 0x63, 0x69, 0x61, 0xEB, 0xC0, 0x72, 0x12, 0x39, 0x78, 0x74, 0x6C, 0x6B, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x74, 0x2F, 0x38, 0x35, 0x75, 0x77, 0x75, 0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0x74, 0x23, 0x35,
+  0x77, 0x74, 0x62, 0x36, 0x2D, 0x2D, 0xEE, 0xC0, 0x74, 0x18, 0xB3, 0x02, 0x8A, 0x78, 0x71, 0x69,
+  0x30, 0x6F, 0x73, 0xF4, 0xC0, 0x73, 0xF3, 0x35, 0x78, 0x71, 0xB6, 0xC0, 0x73, 0xF6, 0xE9, 0x06,
+  0x40, 0x70, 0x2F, 0xA1, 0x56, 0xF2, 0x69, 0x81, 0x2E, 0x6E, 0x61, 0xEC, 0xC0, 0x72, 0xD4, 0xE7,
+  0x69, 0x81, 0xAE, 0x40, 0x5F, 0xE1, 0x29, 0xF7, 0x27, 0x0C, 0x20, 0x34, 0x21, 0x93, 0x1E, 0x8C,
+  0xE5, 0xC0, 0x6C, 0x2F, 0xE1, 0x40, 0x6F, 0x21, 0x23, 0x3D, 0x20, 0x39, 0xA0, 0x2A, 0xEF, 0x1D,
+  0x06, 0x04, 0x06, 0x20, 0x46, 0x10, 0x22, 0xE4, 0x14, 0x35, 0x20, 0x0C, 0x07, 0x10, 0x22, 0xFB,
+  0x08, 0x0C, 0x20, 0xA5, 0x14, 0x20, 0x32, 0x20, 0x8E, 0x20, 0xF9, 0x9F, 0xF9, 0x81, 0xEB, 0xC0,
+  0x72, 0x56, 0xF8, 0xC0, 0x6F, 0xC3, 0xF6, 0x40, 0x6E, 0x6A, 0xA1, 0x22, 0xF4, 0x69, 0x06, 0x04,
+  0x0A, 0xC0, 0x5F, 0xB9, 0xF4, 0xC0, 0x62, 0x4F, 0xEF, 0x40, 0x5D, 0xF4, 0x30, 0x06, 0x23, 0x27,
+  0xA1, 0x5C, 0xAE, 0x0E, 0x09, 0x0A, 0x05, 0x04, 0x40, 0x21, 0x26, 0x40, 0x50, 0xFB, 0x1E, 0x06,
+  0x86, 0xF6, 0x04, 0xC0, 0x72, 0x34, 0xE4, 0xC0, 0x72, 0x53, 0x73, 0x75, 0x6C, 0xF0, 0x81, 0x6E,
+  0xF0, 0xC0, 0x70, 0xF9, 0x6E, 0xE1, 0xC0, 0x68, 0xFC, 0xE1, 0xC0, 0x69, 0x68, 0x31, 0xB1, 0xC0,
+  0x58, 0xDD, 0xF3, 0x69, 0x81, 0xAE, 0x40, 0x6F, 0xFE, 0x20, 0x4F, 0x20, 0x38, 0x21, 0x8D, 0x06,
+  0x1E, 0x8C, 0xF2, 0x69, 0x05, 0x20, 0x3D, 0xA2, 0x81, 0xF0, 0x69, 0x81, 0xAE, 0x0F, 0x0B, 0x07,
+  0x0D, 0x40, 0x57, 0x66, 0x35, 0x43, 0x22, 0x6B, 0x21, 0xA4, 0xA0, 0xA4, 0xF4, 0x06, 0x40, 0x4D,
+  0x6A, 0xAF, 0x73, 0xE8, 0xC0, 0x59, 0xCE, 0xF2, 0x40, 0x31, 0x28, 0xC0, 0x40, 0x4C, 0x65, 0x63,
+  0x61, 0x72, 0x74, 0x73, 0x6E, 0x64, 0x2E, 0xE9, 0xC0, 0x50, 0xC3, 0xE1, 0x06, 0x2B, 0xBC, 0xC0,
+  0x64, 0x87, 0xF0, 0xC0, 0x71, 0xED, 0xE5, 0x07, 0x40, 0x4E, 0x1B, 0xC0, 0x21, 0x1B, 0xE1, 0x69,
+  0x81, 0xAE, 0x16, 0x18, 0x06, 0x20, 0x72, 0x20, 0x24, 0x20, 0x26, 0x1A, 0x05, 0x20, 0x73, 0x20,
+  0x22, 0x05, 0x20, 0x50, 0x20, 0x54, 0x10, 0x8B, 0xF9, 0x03, 0x07, 0x86, 0xF4, 0x81, 0x65, 0xE6,
+  0xC0, 0x6E, 0xF6, 0x64, 0x6F, 0xE2, 0xC0, 0x21, 0xA8, 0x63, 0x6E, 0x65, 0xE7, 0xC0, 0x4C, 0x58,
+  0xF7, 0x40, 0x5D, 0x88, 0xA9, 0x54, 0xF4, 0x0A, 0x0C, 0x06, 0x20, 0x32, 0x07, 0x0E, 0xC0, 0x24,
+  0x81, 0x73, 0xE9, 0x04, 0xC0, 0x29, 0xD1, 0x74, 0x6E, 0xE5, 0xC0, 0x57, 0xD9, 0x72, 0x6F, 0xF0,
+  0xC0, 0x62, 0xCB, 0xEE, 0x03, 0xA0, 0x29, 0xE5, 0x03, 0xA0, 0x21, 0xED, 0x03, 0x07, 0x90, 0x70,
+  0x69, 0x75, 0xF1, 0xC0, 0x71, 0x5F, 0xEE, 0x02, 0x85, 0x72, 0xE5, 0xC0, 0x71, 0x4D, 0x69, 0x61,
+  0x74, 0x72, 0xE5, 0xC0, 0x50, 0x35, 0x65, 0x73, 0xF5, 0xC0, 0x70, 0xBB, 0xE4, 0xC0, 0x55, 0xA7,
+  0x61, 0xF4, 0xC0, 0x56, 0xB6, 0x6C, 0x69, 0x75, 0xE2, 0xC0, 0x5C, 0xE0, 0x68, 0x67, 0x69, 0xEC,
+  0x04, 0xC0, 0x70, 0x2C, 0x6F, 0x72, 0xE3, 0xC0, 0x71, 0x4D, 0x66, 0x61, 0x72, 0x63, 0xF2, 0x04,
+  0xC0, 0x62, 0x7A, 0x6F, 0xF4, 0xC0, 0x6D, 0x0C, 0xF3, 0x07, 0x07, 0x08, 0x06, 0xC0, 0x3B, 0x9B,
+  0xF4, 0x81, 0x6E, 0xE5, 0xC0, 0x6C, 0x17, 0x73, 0x65, 0x72, 0xF0, 0x69, 0xC0, 0x67, 0x17, 0xE5,
+  0x40, 0x5C, 0xB0, 0xB4, 0x6A, 0x63, 0x69, 0x74, 0xF3, 0xC0, 0x5D, 0x95, 0xF2, 0x02, 0x8A, 0xEF,
+  0x04, 0xC0, 0x3B, 0xA9, 0x74, 0xE1, 0xC0, 0x2A, 0x02, 0xE5, 0x07, 0x05, 0x04, 0x04, 0xC0, 0x56,
+  0x5E, 0x74, 0xF2, 0xC0, 0x47, 0xAF, 0xEE, 0xC0, 0x56, 0x76, 0xEB, 0xC0, 0x23, 0x52, 0xE4, 0xC0,
+  0x63, 0xF0, 0xF0, 0x02, 0x8C, 0x75, 0x6F, 0x72, 0xE7, 0x69, 0x81, 0x67, 0x6E, 0xE9, 0xC0, 0x3B,
+  0x62, 0x69, 0x68, 0x73, 0x6E, 0x6F, 0x69, 0x70, 0xED, 0xC0, 0x47, 0x89, 0x6F, 0xE7, 0xC0, 0x34,
+  0x38, 0xEE, 0x03, 0xA0, 0x69, 0x6F, 0xE9, 0x04, 0xC0, 0x4C, 0x0A, 0xF4, 0x03, 0x0F, 0x86, 0x6E,
+  0x65, 0x76, 0x65, 0x72, 0x70, 0x2D, 0x74, 0x6E, 0x65, 0x64, 0xE9, 0xC0, 0x5B, 0x85, 0x63, 0x75,
+  0xE4, 0xC0, 0x59, 0x6F, 0xE1, 0x05, 0x06, 0x1A, 0x15, 0x85, 0x72, 0x65, 0xE4, 0xC0, 0x55, 0x1B,
+  0xE9, 0x02, 0x85, 0x76, 0xE1, 0xC0, 0x27, 0x28, 0x63, 0x6F, 0x73, 0x73, 0xE1, 0x69, 0x81, 0x2D,
+  0x72, 0x65, 0x67, 0x6E, 0x65, 0x73, 0xF3, 0xC0, 0x67, 0xC7, 0x67, 0xE9, 0x04, 0xC0, 0x29, 0x61,
+  0x74, 0x73, 0x65, 0x76, 0x6E, 0x69, 0x2D, 0x74, 0x6E, 0x65, 0x64, 0xE9, 0xC0, 0x5B, 0x44, 0x65,
+  0xF2, 0xC0, 0x58, 0x31, 0x63, 0x69, 0x66, 0x69, 0x74, 0x72, 0xE5, 0xC0, 0x70, 0x65, 0x67, 0x69,
+  0xF3, 0xC0, 0x6D, 0x4F, 0xEC, 0x08, 0x14, 0x40, 0x28, 0x79, 0xC0, 0x36, 0x7B, 0x6F, 0x72, 0x74,
+  0x6E, 0x6F, 0xE3, 0x69, 0x81, 0x2D, 0x63, 0x69, 0x66, 0x66, 0x61, 0x72, 0x74, 0xAD, 0xC0, 0x61,
+  0x7D, 0x69, 0xE3, 0xC0, 0x20, 0xD9, 0x68, 0xE3, 0xC0, 0x2A, 0x56, 0x67, 0x6E, 0xE9, 0x07, 0x06,
+  0x0A, 0x05, 0x05, 0x07, 0x92, 0x76, 0x69, 0xE4, 0xC0, 0x5B, 0x53, 0xF4, 0x04, 0xC0, 0x55, 0x78,
+  0x75, 0x68, 0xE3, 0xA0, 0x34, 0x73, 0xE1, 0xC0, 0x67, 0x02, 0x72, 0xE5, 0xC0, 0x67, 0x62, 0x6E,
+  0x6F, 0x6F, 0xEC, 0xC0, 0x34, 0xDD, 0xEC, 0x02, 0x85, 0x6C, 0xE5, 0xC0, 0x26, 0x03, 0x64, 0x6E,
+  0x61, 0x68, 0x64, 0x6E, 0xF5, 0xC0, 0x6A, 0xBF, 0xE4, 0x04, 0xC0, 0x62, 0xF2, 0x69, 0x6C, 0xE7,
+  0x69, 0x02, 0x84, 0xE7, 0xC0, 0x26, 0x20, 0xE1, 0xC0, 0x5A, 0x4E, 0xE5, 0x05, 0x05, 0x11, 0x06,
+  0x86, 0x72, 0xE1, 0xC0, 0x5A, 0xE7, 0x6E, 0xE9, 0x05, 0x06, 0xC0, 0x55, 0x3E, 0x7A, 0x61, 0xE7,
+  0xC0, 0x65, 0x59, 0xEC, 0xC0, 0x61, 0x07, 0x6D, 0x6F, 0x72, 0xE4, 0xA0, 0x4A, 0x67, 0x6E, 0xE1,
+  0xC0, 0x5D, 0x7A, 0x63, 0xEE, 0x02, 0x88, 0x65, 0x72, 0xE5, 0x81, 0xE6, 0xC0, 0x5A, 0x28, 0xE1,
+  0x03, 0x05, 0x87, 0x72, 0xF5, 0xC0, 0x67, 0xA6, 0x6E, 0x65, 0x74, 0xEE, 0xC0, 0x57, 0x6E, 0xEC,
+  0x04, 0xC0, 0x2C, 0x56, 0x6C, 0x69, 0x65, 0x76, 0x72, 0x75, 0x73, 0xAD, 0xC0, 0x60, 0xCF, 0x63,
+  0xE9, 0x02, 0x84, 0x74, 0x61, 0xE2, 0x8F, 0x66, 0x66, 0x61, 0x72, 0xF4, 0xC0, 0x60, 0xBF, 0x62,
+  0x75, 0x6C, 0xE3, 0x69, 0x81, 0x6F, 0xF2, 0xC0, 0x6D, 0x4C, 0xE1, 0x07, 0x40, 0x23, 0xDB, 0xC0,
+  0x49, 0xB9, 0x63, 0xE7, 0xC0, 0x6D, 0x70, 0xAE, 0x11, 0x05, 0x40, 0x57, 0x14, 0x21, 0x21, 0x22,
+  0x1D, 0x2E, 0xC4, 0x05, 0x25, 0x9E, 0x11, 0xA0, 0x90, 0x77, 0xF7, 0xC0, 0x6D, 0x51, 0xED, 0x40,
+  0x5E, 0x36, 0x2E, 0xD0, 0xA2, 0x5E, 0xEF, 0x09, 0x06, 0x40, 0x6E, 0x1A, 0x20, 0xFC, 0x16, 0x9A,
+  0xF4, 0x81, 0xF4, 0xC0, 0x5E, 0x8A, 0xE8, 0xC0, 0x6B, 0xEF, 0xEE, 0x69, 0x06, 0x07, 0x04, 0xC0,
+  0x6D, 0x21, 0xE9, 0x40, 0x2E, 0x2D, 0xC0, 0x32, 0xF5, 0xE1, 0xC0, 0x4C, 0x6C, 0xAE, 0x20, 0x2A,
+  0x20, 0x87, 0x0B, 0x20, 0x6B, 0x20, 0x8A, 0x20, 0x87, 0x20, 0xCC, 0x13, 0x20, 0x75, 0x21, 0x68,
+  0x20, 0x52, 0x21, 0x85, 0x20, 0x88, 0x20, 0x22, 0x20, 0x50, 0x20, 0x3D, 0x20, 0x7F, 0x20, 0x4E,
+  0x20, 0xF9, 0x22, 0x09, 0x20, 0x59, 0xA0, 0xF5, 0xF9, 0x03, 0xA0, 0x71, 0xEF, 0x0B, 0x05, 0x14,
+  0x1F, 0x0C, 0x04, 0x0B, 0x05, 0xC0, 0x59, 0xD8, 0x76, 0x72, 0xE5, 0xA7, 0x0D, 0xF3, 0x08, 0x04,
+  0x04, 0x2A, 0xFC, 0xC0, 0x59, 0x5F, 0xEC, 0xC0, 0x3F, 0x21, 0xE7, 0xC0, 0x6C, 0xB5, 0xE5, 0xA0,
+  0xCC, 0xF2, 0x07, 0x0F, 0x40, 0x5F, 0xE4, 0xAB, 0x22, 0xE5, 0x07, 0x40, 0x47, 0x57, 0xC0, 0x26,
+  0xA3, 0xF4, 0x40, 0x3D, 0x49, 0xC0, 0x30, 0x23, 0xE1, 0x40, 0x4F, 0x74, 0x3D, 0xED, 0xA1, 0x4C,
+  0xEE, 0x04, 0xC0, 0x61, 0xAA, 0xEE, 0x40, 0x21, 0x07, 0xC0, 0x45, 0x2C, 0xED, 0xC0, 0x3E, 0xEB,
+  0xEB, 0x04, 0xC0, 0x6D, 0xB6, 0x72, 0x61, 0xEA, 0xC0, 0x6E, 0x8A, 0x67, 0x61, 0xF6, 0xA1, 0x66,
+  0xE4, 0x06, 0x40, 0x63, 0x0F, 0xA7, 0x4B, 0x6E, 0xE1, 0x69, 0xC0, 0x6E, 0x29, 0xE2, 0x07, 0x06,
+  0x21, 0x49, 0xC0, 0x5B, 0x38, 0x73, 0x65, 0xE2, 0xC0, 0x65, 0x61, 0x65, 0xF3, 0xB1, 0x77, 0xF6,
+  0x04, 0xC0, 0x61, 0xA4, 0x6C, 0x65, 0xF3, 0xC0, 0x43, 0x7F, 0xF5, 0x06, 0x15, 0x07, 0x1C, 0x09,
+  0x89, 0xEE, 0x02, 0x86, 0xF4, 0x81, 0xE1, 0xC0, 0x6B, 0x49, 0x64, 0x69, 0x61, 0x65, 0x67, 0x61,
+  0x64, 0x76, 0xEF, 0xC0, 0x5C, 0xC7, 0x6B, 0x73, 0x69, 0xEF, 0xC0, 0x63, 0x80, 0xEA, 0x03, 0x0A,
+  0x86, 0x76, 0x61, 0x72, 0x65, 0x6B, 0x6B, 0xE8, 0xC0, 0x62, 0xBE, 0x6A, 0x65, 0xE4, 0xC0, 0x63,
+  0xAC, 0x64, 0x61, 0x65, 0x68, 0xE1, 0xC0, 0x6D, 0xF7, 0xE7, 0x04, 0xC0, 0x6A, 0x5F, 0x6E, 0xE1,
+  0xA2, 0xC4, 0x64, 0x72, 0xE1, 0x40, 0x40, 0xCB, 0xC0, 0x2D, 0x42, 0xE2, 0x69, 0x07, 0x0C, 0x32,
+  0x3C, 0xC0, 0x46, 0xB5, 0xE5, 0x06, 0x28, 0x4C, 0xC0, 0x5B, 0x48, 0x6E, 0xEE, 0xC0, 0x6C, 0x6B,
+  0x61, 0xEC, 0xC0, 0x6A, 0x9C, 0xF4, 0x0A, 0x06, 0x10, 0x06, 0x06, 0x03, 0x20, 0x21, 0xA3, 0xE7,
+  0x74, 0x65, 0xF2, 0xC0, 0x47, 0xE4, 0xF3, 0x69, 0x06, 0x32, 0x1E, 0xC0, 0x57, 0x95, 0x65, 0x66,
+  0x72, 0x65, 0xED, 0xC0, 0x4E, 0x9A, 0xEF, 0x40, 0x6D, 0x2D, 0xA0, 0x95, 0x6C, 0x6F, 0xE8, 0xC0,
+  0x62, 0x57, 0xE9, 0xA9, 0x81, 0xE5, 0x06, 0x05, 0x0F, 0xC0, 0x6C, 0x90, 0x76, 0x74, 0xF0, 0xAD,
+  0x3F, 0xF3, 0x04, 0x06, 0xB0, 0xB8, 0x72, 0x6F, 0x6B, 0xEF, 0xA1, 0xDC, 0xEE, 0xC0, 0x3E, 0x2D,
+  0x64, 0x6E, 0x61, 0xEC, 0xA1, 0x47, 0xE1, 0x09, 0x09, 0x05, 0x07, 0x0B, 0x0A, 0xC0, 0x6C, 0xA3,
+  0xF6, 0x04, 0xC0, 0x42, 0x46, 0xEF, 0xC0, 0x2C, 0x10, 0x73, 0xEF, 0xC0, 0x64, 0xC6, 0x6C, 0xE1,
+  0x40, 0x6D, 0x33, 0xA0, 0x4F, 0x6A, 0x6A, 0x72, 0x61, 0x76, 0x2D, 0x61, 0xF4, 0xC0, 0x44, 0x14,
+  0xE7, 0x02, 0x83, 0xE7, 0xA1, 0xD4, 0xE1, 0xC0, 0x6C, 0x21, 0x62, 0xE1, 0xC0, 0x5D, 0x48, 0xF3,
+  0x0B, 0x0E, 0x0E, 0x08, 0x07, 0x04, 0x20, 0x47, 0xC0, 0x57, 0x4D, 0x75, 0xE8, 0x04, 0xC0, 0x58,
+  0xA7, 0x73, 0x72, 0x65, 0x6B, 0x61, 0xAE, 0xB0, 0x5D, 0x73, 0xEF, 0x06, 0x40, 0x6B, 0xF9, 0xA1,
+  0x5C, 0x66, 0x65, 0xEE, 0xC0, 0x6C, 0x70, 0xEF, 0x03, 0xA3, 0x13, 0xF2, 0xC0, 0x69, 0x15, 0x69,
+  0x67, 0x61, 0xF6, 0xC0, 0x6C, 0x22, 0xE7, 0xC0, 0x6B, 0xE3, 0x65, 0xEE, 0x08, 0x05, 0x11, 0x0C,
+  0x07, 0xC0, 0x46, 0xCC, 0x74, 0xF3, 0xC0, 0x52, 0x4E, 0xF3, 0x0B, 0x40, 0x3D, 0x95, 0x40, 0x25,
+  0x4E, 0x25, 0x40, 0xA5, 0x0D, 0x65, 0xE4, 0xC0, 0x61, 0x7A, 0x6E, 0x72, 0x6F, 0x68, 0x2D, 0x67,
+  0x6F, 0x2D, 0x65, 0xEA, 0xA5, 0x6D, 0x6D, 0xE5, 0x29, 0x57, 0xC0, 0x62, 0xD7, 0xE5, 0x04, 0x0B,
+  0xA5, 0x54, 0xEB, 0x03, 0xBE, 0xF5, 0x72, 0xE9, 0x40, 0x69, 0x96, 0xA3, 0x54, 0xE4, 0xC0, 0x67,
+  0xDD, 0x61, 0xE4, 0xC0, 0x61, 0x4E, 0xF2, 0x08, 0x03, 0x04, 0x06, 0x20, 0x94, 0xA2, 0x39, 0xEF,
+  0xAD, 0x99, 0xED, 0x69, 0xB1, 0x18, 0x69, 0x6D, 0xF0, 0xC0, 0x4D, 0x96, 0xE5, 0x0D, 0x0A, 0x05,
+  0x0C, 0x09, 0x20, 0x24, 0x06, 0x40, 0x62, 0x64, 0xA1, 0x36, 0x74, 0xF3, 0x04, 0xC0, 0x69, 0x0E,
+  0xEC, 0xC0, 0x60, 0x75, 0x6E, 0xEE, 0xC0, 0x69, 0x08, 0xED, 0x02, 0x85, 0x6D, 0x61, 0xE8, 0xA8,
+  0x27, 0xE2, 0xC0, 0x4D, 0x6D, 0x6C, 0xE1, 0x03, 0xA3, 0x02, 0xF6, 0xC0, 0x6B, 0xCB, 0xEB, 0x07,
+  0x0C, 0x40, 0x51, 0xF2, 0xB9, 0xB7, 0x69, 0x65, 0x2D, 0x65, 0xF2, 0x03, 0xB0, 0x29, 0xE4, 0xC0,
+  0x6C, 0x85, 0xE1, 0x05, 0x05, 0xC0, 0x61, 0x60, 0xF3, 0x25, 0xC0, 0xA1, 0x0E, 0x6E, 0xF6, 0xC0,
+  0x65, 0xF1, 0x6A, 0x6B, 0xEE, 0xC0, 0x25, 0xBF, 0x67, 0xEE, 0x02, 0x85, 0x69, 0x76, 0xF3, 0xA5,
+  0x7B, 0xE1, 0x09, 0x04, 0x06, 0x04, 0x06, 0x06, 0x05, 0xA0, 0xEA, 0xF9, 0xC0, 0x6B, 0x88, 0xF6,
+  0x40, 0x63, 0x49, 0xA8, 0x42, 0xF4, 0xC0, 0x62, 0x12, 0x72, 0x61, 0x76, 0xAD, 0xAD, 0x27, 0xEE,
+  0x40, 0x5B, 0x9D, 0xAA, 0x16, 0x6D, 0xE5, 0xC0, 0x59, 0x36, 0xEB, 0x40, 0x5C, 0x86, 0xAF, 0xC9,
+  0xE1, 0x07, 0x05, 0x03, 0x06, 0xC0, 0x4C, 0xE7, 0x76, 0xF3, 0xC0, 0x3C, 0xB0, 0xEC, 0xA3, 0x0D,
+  0xEA, 0x81, 0xF4, 0xC0, 0x63, 0xB6, 0xE4, 0x02, 0x84, 0xE9, 0xC0, 0x6B, 0x92, 0x64, 0xEA, 0xC0,
+  0x6B, 0x8D, 0xF0, 0x06, 0x40, 0x69, 0x07, 0xA2, 0x92, 0xF0, 0x02, 0x85, 0x65, 0xEC, 0xC0, 0x68,
+  0xB0, 0x61, 0xEB, 0xAC, 0xE5, 0xEF, 0x0C, 0x0A, 0x10, 0x0A, 0x07, 0x1C, 0x07, 0x03, 0x09, 0xC0,
+  0x6B, 0xA4, 0xF3, 0x02, 0x83, 0xED, 0xBD, 0xA2, 0xE4, 0xC0, 0x69, 0xD7, 0xF2, 0x05, 0x05, 0xC0,
+  0x2A, 0xDA, 0x79, 0xEF, 0xC0, 0x6A, 0x9A, 0x65, 0xE7, 0xC0, 0x3F, 0x32, 0x6E, 0x69, 0x65, 0x6B,
+  0x6F, 0x74, 0xF5, 0xC0, 0x51, 0xF5, 0x6D, 0x73, 0x64, 0xE5, 0xC0, 0x57, 0x03, 0xEC, 0x03, 0x05,
+  0x8F, 0x73, 0xEF, 0x69, 0xB0, 0x08, 0x6F, 0x75, 0xF3, 0x02, 0x86, 0x65, 0x63, 0xE8, 0xC0, 0x69,
+  0xE8, 0xE1, 0xC0, 0x61, 0x4D, 0xED, 0xC0, 0x6A, 0xC5, 0x6B, 0x73, 0x73, 0xEF, 0xC0, 0x60, 0xED,
+  0xE9, 0xA3, 0xC0, 0xE4, 0x04, 0xC0, 0x6A, 0xB3, 0xF2, 0xC0, 0x69, 0x87, 0x36, 0x61, 0x78, 0x69,
+  0x2D, 0x79, 0x67, 0x76, 0x74, 0x73, 0xE5, 0xC0, 0x65, 0xE3, 0xEE, 0x0E, 0x04, 0x05, 0x05, 0x0D,
+  0x07, 0x0D, 0x07, 0x08, 0x04, 0x0D, 0x0A, 0xA0, 0xE1, 0xF9, 0xC0, 0x3A, 0xC8, 0x75, 0xE1, 0xC0,
+  0x56, 0xAE, 0x73, 0xE6, 0xC0, 0x50, 0xA0, 0xF2, 0x02, 0x85, 0x65, 0xF6, 0xC0, 0x6A, 0x9F, 0x61,
+  0xE9, 0xC0, 0x3E, 0x1F, 0x6F, 0x72, 0x66, 0xAD, 0x2C, 0x3C, 0x84, 0xEE, 0x04, 0xC0, 0x6B, 0x71,
+  0x75, 0x72, 0xE7, 0x81, 0xF3, 0xC0, 0x28, 0x74, 0x6D, 0x61, 0x68, 0x65, 0xF2, 0xB9, 0xF6, 0x6C,
+  0x61, 0x64, 0x65, 0xEE, 0xC0, 0x58, 0x95, 0xEB, 0xC0, 0x6A, 0x53, 0xE9, 0x02, 0x85, 0x76, 0xEE,
+  0xC0, 0x3D, 0x71, 0x64, 0x6E, 0xE1, 0xBC, 0xE2, 0xE7, 0x04, 0xC0, 0x4F, 0x5E, 0x75, 0xEA, 0xC0,
+  0x6B, 0x23, 0xE5, 0x0E, 0x0A, 0x0C, 0x15, 0x10, 0x05, 0x0D, 0x06, 0x1E, 0x08, 0x20, 0x3D, 0xA9,
+  0xE7, 0x79, 0x61, 0x6D, 0x2D, 0x6E, 0x61, 0xEA, 0x69, 0xAF, 0x53, 0x76, 0x6C, 0xF9, 0x04, 0xC0,
+  0x60, 0x28, 0x6B, 0xEB, 0xC0, 0x5B, 0x1A, 0xF4, 0x04, 0xC0, 0x54, 0xE5, 0xEF, 0x04, 0xC0, 0x6A,
+  0x18, 0x74, 0x2D, 0x65, 0x72, 0x74, 0xF3, 0x40, 0x50, 0x1D, 0xBA, 0xE8, 0xF3, 0x04, 0xC0, 0x6A,
+  0xFB, 0x6C, 0x61, 0x68, 0x73, 0x6C, 0x61, 0x64, 0xF2, 0xC0, 0x22, 0x03, 0x70, 0xF0, 0xC0, 0x42,
+  0x37, 0x6F, 0x6A, 0xF3, 0x04, 0xC0, 0x69, 0xF6, 0x73, 0x65, 0xEE, 0xC0, 0x44, 0x9E, 0x6D, 0x6D,
+  0xE1, 0xC0, 0x63, 0x5F, 0xEC, 0x04, 0xC0, 0x59, 0x41, 0xE1, 0x02, 0x83, 0xF4, 0xA6, 0x4C, 0xE4,
+  0x05, 0x0A, 0xC0, 0x69, 0xCF, 0xEE, 0x04, 0xC0, 0x69, 0x1E, 0x6F, 0xEA, 0xC0, 0x6A, 0xBA, 0xE7,
+  0xA6, 0xAC, 0xEB, 0x04, 0xC0, 0x43, 0x2D, 0xF3, 0xBF, 0xFF, 0xE7, 0x06, 0x40, 0x21, 0xB5, 0xA2,
+  0x2E, 0xEE, 0x05, 0x0B, 0xC0, 0x2D, 0xCD, 0xE9, 0x02, 0x84, 0xEC, 0xC0, 0x5F, 0x1B, 0xE4, 0xC0,
+  0x5A, 0x65, 0xE1, 0x04, 0x0B, 0x0A, 0x84, 0xF6, 0x04, 0xC0, 0x69, 0x69, 0x65, 0x73, 0xF3, 0xC0,
+  0x69, 0x29, 0xF4, 0x04, 0xC0, 0x3C, 0xAA, 0x64, 0x64, 0xEF, 0xAD, 0x7A, 0x6E, 0xE1, 0xA7, 0x13,
+  0xEC, 0x40, 0x2F, 0x3F, 0xC0, 0x38, 0x66, 0xE4, 0x05, 0x0F, 0xC0, 0x26, 0x38, 0xF2, 0x02, 0x87,
+  0x6F, 0x6A, 0x66, 0xF3, 0xC0, 0x5F, 0xE5, 0x61, 0xE7, 0xC0, 0x61, 0x79, 0x64, 0xEF, 0x2D, 0x56,
+  0xC0, 0x2B, 0x87, 0xE1, 0x06, 0x06, 0x05, 0xC0, 0x66, 0x0C, 0xF2, 0x40, 0x4F, 0x67, 0xBA, 0xBA,
+  0x6A, 0xEC, 0xC0, 0x68, 0x1B, 0xE7, 0x04, 0xC0, 0x68, 0x16, 0x6F, 0x6B, 0xF3, 0x81, 0xF3, 0xC0,
+  0x68, 0x4F, 0xED, 0x0A, 0x1C, 0x04, 0x1E, 0x04, 0x20, 0x4B, 0xC0, 0x59, 0x6A, 0xF5, 0x07, 0x05,
+  0x40, 0x20, 0x14, 0xB8, 0x50, 0x74, 0xF4, 0xC0, 0x3D, 0x44, 0xF2, 0x0A, 0x3E, 0x58, 0x24, 0x4C,
+  0x40, 0x33, 0xA1, 0xB3, 0x32, 0x64, 0xF2, 0xA6, 0x56, 0xF4, 0x69, 0xAE, 0x41, 0xE9, 0x03, 0xA0,
+  0x4C, 0xE5, 0x02, 0x88, 0x72, 0x6B, 0x72, 0x65, 0xEA, 0xC0, 0x69, 0xE9, 0xE8, 0x05, 0x05, 0xC0,
+  0x28, 0x80, 0x73, 0xF3, 0xC0, 0x63, 0x5C, 0x64, 0xEE, 0xBB, 0x8F, 0xE6, 0x69, 0xAE, 0x1F, 0xE1,
+  0x26, 0x81, 0xBA, 0x0E, 0xEC, 0x09, 0x04, 0x0B, 0x04, 0x1F, 0x0A, 0x04, 0x08, 0x92, 0xF2, 0x69,
+  0xAE, 0x0C, 0xEF, 0x69, 0x2E, 0x08, 0x40, 0x3F, 0x88, 0x3B, 0x62, 0xA0, 0xB6, 0xEE, 0x69, 0xAD,
+  0xFD, 0xEC, 0x02, 0x96, 0x6F, 0xF6, 0x04, 0x03, 0x04, 0x85, 0xF3, 0xA4, 0xA3, 0xEB, 0xC0, 0x68,
+  0xCD, 0x67, 0xEE, 0xC0, 0x69, 0xBE, 0xE5, 0xC0, 0x28, 0x42, 0xE5, 0x81, 0xEA, 0xC0, 0x68, 0x83,
+  0xE9, 0x04, 0xC0, 0x69, 0xA1, 0x73, 0xF9, 0xC0, 0x5C, 0x9A, 0xE8, 0x69, 0xAD, 0xD0, 0x65, 0xF3,
+  0x69, 0x81, 0xE4, 0xC0, 0x4A, 0x4C, 0x62, 0x69, 0xE2, 0x02, 0x87, 0x73, 0x65, 0x6B, 0xEC, 0xC0,
+  0x45, 0x6B, 0x65, 0x6B, 0xEC, 0xC0, 0x5F, 0x43, 0xE1, 0x69, 0x03, 0x05, 0x88, 0x72, 0xE5, 0xC0,
+  0x68, 0x8C, 0x6B, 0x73, 0x65, 0x64, 0xEC, 0xC0, 0x58, 0x7D, 0xE4, 0x15, 0x16, 0x10, 0x20, 0x27,
+  0x20, 0x2B, 0x05, 0x20, 0x22, 0x20, 0x22, 0x04, 0x09, 0x1A, 0x0C, 0x23, 0x64, 0xC0, 0x35, 0x72,
+  0xF6, 0x02, 0x89, 0x75, 0x2D, 0x67, 0x6F, 0x2D, 0xE5, 0xC0, 0x40, 0x34, 0xEC, 0x04, 0xC0, 0x69,
+  0x54, 0x65, 0xAD, 0xC0, 0x63, 0x08, 0xF4, 0x05, 0x04, 0xC0, 0x23, 0x82, 0xF3, 0xC0, 0x23, 0xB6,
+  0x72, 0x61, 0xEA, 0xC0, 0x68, 0x53, 0xF3, 0x04, 0x04, 0x10, 0x84, 0xF5, 0xC0, 0x61, 0x0E, 0x6D,
+  0x6F, 0x72, 0x2D, 0x67, 0x6F, 0x2D, 0x65, 0x72, 0x6F, 0x6D, 0xAE, 0x24, 0xF1, 0xA1, 0x63, 0xEB,
+  0xC0, 0x66, 0xF0, 0xE5, 0x05, 0x25, 0x56, 0xA0, 0x4F, 0xF2, 0xC0, 0x44, 0xF0, 0xF2, 0x07, 0x0A,
+  0x07, 0x08, 0xC0, 0x66, 0xBF, 0xF5, 0x04, 0xC0, 0x68, 0x1C, 0x61, 0xAD, 0x29, 0xC8, 0x84, 0xEF,
+  0x40, 0x20, 0x0E, 0xC0, 0x48, 0x0F, 0xE5, 0x40, 0x4E, 0x5A, 0x39, 0x39, 0xA0, 0x6F, 0xE1, 0x69,
+  0x04, 0xC0, 0x67, 0xF5, 0xEE, 0xC0, 0x4E, 0x3F, 0x6F, 0xAD, 0x29, 0xAA, 0x84, 0xEE, 0x0B, 0x04,
+  0x04, 0x0A, 0x22, 0xBA, 0x40, 0x59, 0xB1, 0xA1, 0xD3, 0xEE, 0xC0, 0x64, 0x1F, 0xEB, 0xC0, 0x54,
+  0xFC, 0xE9, 0x05, 0x40, 0x68, 0xAB, 0x88, 0xEE, 0xC0, 0x52, 0x99, 0xE5, 0xC0, 0x62, 0x8C, 0xEC,
+  0x05, 0x0E, 0xC0, 0x66, 0x61, 0xF5, 0x04, 0xC0, 0x68, 0x49, 0x61, 0x67, 0x2D, 0x65, 0x72, 0xF4,
+  0xC0, 0x26, 0x1C, 0xEC, 0x04, 0xC0, 0x5E, 0x60, 0x65, 0x6A, 0x66, 0xF4, 0x81, 0xF4, 0xC0, 0x49,
+  0x51, 0xEB, 0xC0, 0x68, 0x98, 0xE7, 0x04, 0xC0, 0x66, 0x63, 0xEE, 0xC0, 0x2B, 0xC4, 0xE5, 0x04,
+  0x05, 0x07, 0x83, 0x74, 0xF4, 0xC0, 0x67, 0x2F, 0xF3, 0x40, 0x25, 0x79, 0xC0, 0x3D, 0xBA, 0xEE,
+  0xB9, 0xE2, 0x67, 0x6E, 0xE1, 0xC0, 0x60, 0xFB, 0xE4, 0x04, 0xC0, 0x3F, 0x50, 0x6E, 0x75, 0x6D,
+  0xF5, 0xC0, 0x55, 0x4C, 0x61, 0xEE, 0xC0, 0x4F, 0xF3, 0xEB, 0x08, 0x20, 0x20, 0x07, 0x20, 0x45,
+  0xAB, 0x97, 0x72, 0x61, 0xED, 0x02, 0x90, 0xE5, 0x04, 0xC0, 0x62, 0x1C, 0x6C, 0x65, 0x74, 0xAE,
+  0x04, 0xC0, 0x67, 0x47, 0xE1, 0xA4, 0x20, 0x64, 0x65, 0x68, 0xAE, 0x24, 0x42, 0x23, 0x52, 0xC0,
+  0x5F, 0x4F, 0x6B, 0x61, 0x62, 0xE5, 0xC0, 0x4D, 0x9D, 0x69, 0xF6, 0x69, 0x09, 0x0B, 0x13, 0x03,
+  0x04, 0x0C, 0xC0, 0x5F, 0xD2, 0xF3, 0x06, 0x40, 0x48, 0xD3, 0xBE, 0x5F, 0xEB, 0xC0, 0x5E, 0xFC,
+  0xF2, 0x07, 0x05, 0x40, 0x40, 0x87, 0xB7, 0xBD, 0x65, 0xF0, 0xC0, 0x52, 0xA0, 0xE1, 0x40, 0x67,
+  0x1B, 0xA0, 0xDD, 0xEF, 0xA4, 0x4B, 0xEE, 0xC0, 0x5E, 0xE2, 0xEC, 0x06, 0x40, 0x5D, 0x78, 0xA8,
+  0x75, 0x65, 0xF6, 0xC0, 0x67, 0x90, 0x61, 0x6B, 0x6C, 0x65, 0xEA, 0xC0, 0x57, 0x06, 0xE1, 0x03,
+  0x06, 0x84, 0x6C, 0x6C, 0xE5, 0xC0, 0x65, 0xB8, 0xEA, 0xC0, 0x53, 0x04, 0x62, 0xEF, 0xC0, 0x60,
+  0x62, 0xEA, 0x02, 0x94, 0x39, 0x34, 0x62, 0x61, 0x77, 0x68, 0x2D, 0x61, 0x6B, 0x68, 0x6F, 0x6A,
+  0x72, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x68, 0xDA, 0x30, 0x61, 0x6F, 0x71, 0x2D, 0x79, 0x73, 0xE7,
+  0xC0, 0x61, 0xFA, 0xE9, 0x07, 0x0A, 0x0D, 0x06, 0x0A, 0x04, 0x8F, 0x73, 0x73, 0x61, 0x6E, 0xE5,
+  0x81, 0xF6, 0xC0, 0x67, 0x80, 0x72, 0x72, 0x6F, 0x75, 0x6E, 0x61, 0x64, 0x64, 0x6C, 0xE5, 0xC0,
+  0x5B, 0xAC, 0x70, 0x70, 0xE8, 0xC0, 0x66, 0x70, 0x6D, 0x70, 0x6F, 0x75, 0x76, 0x74, 0xE1, 0xC0,
+  0x3C, 0x97, 0xEC, 0xC0, 0x66, 0xD1, 0xEB, 0x04, 0xC0, 0x67, 0x18, 0x68, 0x61, 0x76, 0x6C, 0x61,
+  0x72, 0xE1, 0xC0, 0x3A, 0x1E, 0xE5, 0x04, 0xC0, 0x66, 0x44, 0x68, 0x73, 0x72, 0xE1, 0x81, 0xE7,
+  0xC0, 0x4C, 0x84, 0xE8, 0x05, 0x20, 0x29, 0xAB, 0x67, 0xB7, 0x02, 0x93, 0x35, 0x61, 0x79, 0x37,
+  0x2D, 0x61, 0x74, 0x6B, 0x6F, 0x75, 0x6C, 0x6F, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x68, 0x63, 0x34,
+  0x61, 0x79, 0x38, 0x2D, 0x61, 0x6B, 0x69, 0x69, 0x76, 0x61, 0x67, 0x67, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x68, 0x50, 0x30, 0x61, 0x6C, 0x75, 0x2D, 0x79, 0x73, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x68, 0x42,
+  0xE7, 0x07, 0x07, 0x20, 0x2B, 0x14, 0x13, 0x92, 0x75, 0x61, 0x68, 0xE1, 0xC0, 0x26, 0x93, 0xF2,
+  0x02, 0x88, 0x6F, 0x62, 0x73, 0x70, 0xF2, 0xC0, 0x64, 0x3F, 0x65, 0xE2, 0x69, 0x03, 0x0E, 0x86,
+  0xF3, 0x05, 0x04, 0x21, 0xE0, 0x84, 0xEE, 0xC0, 0x66, 0xBE, 0xE7, 0xC0, 0x3B, 0xE4, 0x65, 0x64,
+  0xF9, 0xC0, 0x56, 0x10, 0x61, 0x64, 0xEE, 0xC0, 0x5B, 0x6F, 0x6F, 0x6B, 0xF3, 0x07, 0x06, 0x21,
+  0xC4, 0xC0, 0x65, 0x1C, 0x6E, 0x65, 0xF2, 0xC0, 0x56, 0xAD, 0xED, 0xC0, 0x62, 0xA6, 0xEE, 0x04,
+  0xC0, 0x61, 0x91, 0x61, 0xF6, 0x69, 0x81, 0xF3, 0x81, 0x6E, 0x65, 0xEC, 0x81, 0xEC, 0xC0, 0x64,
+  0xC0, 0xE1, 0x02, 0x8A, 0x76, 0xE5, 0x03, 0xBD, 0xCB, 0x67, 0xEE, 0xC0, 0x65, 0x9A, 0x6C, 0xEC,
+  0xC0, 0x62, 0x81, 0x35, 0x61, 0x6C, 0x79, 0x2D, 0x79, 0xF2, 0x40, 0x60, 0xF0, 0xA6, 0xBD, 0xE6,
+  0x07, 0x04, 0x07, 0x20, 0x29, 0xA1, 0x76, 0xF6, 0x69, 0xAA, 0xD3, 0xEF, 0x69, 0x2A, 0xCF, 0xC0,
+  0x5A, 0xEA, 0xE1, 0x02, 0x94, 0x37, 0x6B, 0x2D, 0x74, 0x61, 0x6A, 0x6A, 0x72, 0x76, 0x2D, 0x61,
+  0x74, 0x74, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x67, 0x99, 0x31, 0x30, 0x2D, 0x75, 0x6A, 0x76, 0x72,
+  0x65, 0x6B, 0x6B, 0x68, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x67, 0x87, 0x36, 0x32, 0x61, 0x74, 0x73,
+  0x2D, 0x75, 0x67, 0x73, 0x72, 0x6F, 0x70, 0x2D, 0x2D, 0xEE, 0xC0, 0x67, 0x75, 0xE5, 0x0E, 0x04,
+  0x12, 0x06, 0x18, 0x19, 0x08, 0x1C, 0x20, 0x2C, 0x0B, 0x1E, 0x0B, 0x8D, 0xF5, 0xC0, 0x61, 0x09,
+  0xF4, 0x02, 0x86, 0x73, 0x70, 0xE1, 0xC0, 0x64, 0x1A, 0x72, 0x6F, 0x62, 0xF2, 0x81, 0xE1, 0xC0,
+  0x66, 0x46, 0x73, 0x61, 0xE1, 0xC0, 0x4D, 0xFE, 0xF2, 0x05, 0x04, 0xC0, 0x53, 0x69, 0xF6, 0xC0,
+  0x62, 0x68, 0x64, 0x69, 0x6C, 0x73, 0x2D, 0x65, 0x72, 0x74, 0xF3, 0x40, 0x4B, 0x39, 0xB1, 0xFE,
+  0xEE, 0x0B, 0x04, 0x05, 0x37, 0x6D, 0x2B, 0x90, 0x35, 0x2F, 0xB8, 0x58, 0xF9, 0xC0, 0x52, 0xF0,
+  0x72, 0xE5, 0xC0, 0x5B, 0xEA, 0xE7, 0xC0, 0x52, 0x34, 0xED, 0x04, 0xC0, 0x66, 0x03, 0xEF, 0xA1,
+  0x4A, 0xEC, 0x06, 0x0B, 0x05, 0xC0, 0x64, 0xFC, 0xEC, 0x04, 0xC0, 0x63, 0xC3, 0x65, 0x68, 0xF4,
+  0xC0, 0x65, 0x0B, 0x6B, 0xF9, 0xC0, 0x65, 0xCD, 0x62, 0xED, 0xC0, 0x65, 0x42, 0xEB, 0x05, 0x09,
+  0x07, 0x09, 0x87, 0xF3, 0x04, 0xC0, 0x54, 0xDC, 0xF5, 0xC0, 0x5D, 0xE5, 0x6B, 0x6F, 0xF4, 0x69,
+  0xC0, 0x65, 0x63, 0x69, 0x72, 0xE5, 0x81, 0x67, 0xEE, 0xC0, 0x62, 0x38, 0x68, 0x67, 0x6E, 0xE1,
+  0xC0, 0x38, 0xFB, 0x65, 0x72, 0xE1, 0xC0, 0x64, 0xC8, 0xEA, 0x04, 0xC0, 0x50, 0x93, 0xE4, 0x40,
+  0x36, 0x4E, 0xB3, 0xCB, 0xE9, 0x02, 0x85, 0x72, 0xEA, 0xC0, 0x63, 0x6A, 0x6D, 0x65, 0x75, 0xF6,
+  0x02, 0x87, 0x73, 0x65, 0x6B, 0xE1, 0xC0, 0x64, 0x6F, 0x65, 0x6A, 0x73, 0x65, 0x6D, 0xE1, 0xC0,
+  0x63, 0xA1, 0xE7, 0x02, 0x84, 0xEE, 0xC0, 0x64, 0xA5, 0xE7, 0xC0, 0x38, 0xC8, 0xE4, 0x08, 0x40,
+  0x3F, 0xFB, 0x39, 0xF5, 0xA1, 0x40, 0xEC, 0xC0, 0x64, 0x87, 0x61, 0x79, 0x62, 0x2D, 0x79, 0x72,
+  0x65, 0x74, 0xF4, 0xC0, 0x66, 0x64, 0xE4, 0x09, 0x0A, 0x20, 0x5B, 0x20, 0xEB, 0x19, 0x15, 0x8C,
+  0x75, 0x72, 0x65, 0x6B, 0x73, 0x75, 0x62, 0xAE, 0xA8, 0x4C, 0xF2, 0x03, 0xA0, 0x40, 0xEF, 0x04,
+  0xC0, 0x64, 0x6A, 0xEA, 0x04, 0xC0, 0x50, 0x29, 0xE6, 0x06, 0x07, 0x06, 0x06, 0x0C, 0x83, 0xF3,
+  0x39, 0x06, 0x30, 0xFA, 0xAB, 0xAA, 0xF2, 0x40, 0x55, 0x6A, 0xA9, 0x8C, 0x6C, 0x6C, 0xE9, 0xC0,
+  0x4C, 0xF4, 0xE5, 0x04, 0xC0, 0x3E, 0xE2, 0x6B, 0xEB, 0x81, 0xE5, 0xC0, 0x5A, 0xCF, 0xE4, 0xBC,
+  0x3B, 0xE1, 0x69, 0x06, 0x21, 0xA8, 0xC0, 0x5F, 0xFD, 0x64, 0xEE, 0xC0, 0x62, 0x08, 0xE1, 0x02,
+  0x8B, 0xE7, 0x04, 0xC0, 0x64, 0xC7, 0xE5, 0x81, 0xF0, 0xC0, 0x4E, 0x65, 0x62, 0x6C, 0x61, 0xF6,
+  0x81, 0xF3, 0x69, 0xA9, 0x29, 0xEE, 0x03, 0xA0, 0x49, 0xF5, 0x03, 0xA0, 0x40, 0xF3, 0x69, 0x08,
+  0x06, 0x04, 0x0C, 0x04, 0x06, 0x0A, 0x9B, 0x79, 0x6F, 0x6E, 0xEE, 0xB7, 0x32, 0xF4, 0xC0, 0x49,
+  0x4A, 0xF2, 0x04, 0xC0, 0x5C, 0xE8, 0x65, 0xE7, 0x3B, 0xF2, 0xC0, 0x48, 0xB8, 0x6C, 0xE1, 0xA1,
+  0x62, 0xEB, 0x81, 0xEB, 0xC0, 0x63, 0xE0, 0xE5, 0x04, 0xC0, 0x64, 0x81, 0x67, 0xF5, 0xC0, 0x45,
+  0x71, 0xE4, 0x04, 0xC0, 0x64, 0xAE, 0x6C, 0xE5, 0x81, 0xEA, 0xC0, 0x64, 0xB9, 0xEC, 0x69, 0xC0,
+  0x50, 0xDB, 0xE1, 0x03, 0x16, 0x96, 0xF3, 0x05, 0x0A, 0xC0, 0x5A, 0x50, 0x6E, 0x61, 0x69, 0x74,
+  0x73, 0x69, 0xF2, 0xC0, 0x61, 0x2B, 0x65, 0x6C, 0xEC, 0xC0, 0x5A, 0x73, 0x72, 0x74, 0xF3, 0x69,
+  0x81, 0xE5, 0x05, 0x06, 0xC0, 0x29, 0x43, 0xED, 0x81, 0xEC, 0xC0, 0x63, 0x9A, 0x64, 0xE5, 0xC0,
+  0x62, 0x67, 0xEC, 0x09, 0x03, 0x06, 0x0F, 0x05, 0x05, 0x14, 0x19, 0x89, 0xF4, 0xA5, 0x37, 0xF2,
+  0x40, 0x51, 0xAB, 0xB2, 0xC1, 0xEF, 0x04, 0xC0, 0x63, 0x34, 0x68, 0x2D, 0x67, 0x6F, 0x6B, 0x73,
+  0xF2, 0xC0, 0x51, 0x9A, 0x6E, 0xE1, 0xC0, 0x4F, 0x77, 0x67, 0xF9, 0xC0, 0x64, 0x37, 0xE5, 0x05,
+  0x05, 0xC0, 0x60, 0x74, 0x70, 0xF2, 0xC0, 0x57, 0xF0, 0xED, 0x69, 0x81, 0x6C, 0x65, 0xEA, 0xC0,
+  0x63, 0x57, 0x64, 0x72, 0x6F, 0x6E, 0xAE, 0x05, 0x05, 0xC0, 0x63, 0x2A, 0x79, 0xEF, 0xC0, 0x2C,
+  0xD8, 0xE1, 0x03, 0xA1, 0x60, 0x67, 0x35, 0xAD, 0xC0, 0x5D, 0x00, 0x61, 0x64, 0x72, 0x6F, 0x68,
+  0xAE, 0xC0, 0x62, 0xBD, 0x2D, 0x65, 0x72, 0xE4, 0x04, 0xC0, 0x3A, 0xF1, 0xEE, 0xC0, 0x50, 0x3D,
+  0x6C, 0x6F, 0xE6, 0x03, 0xA4, 0xCE, 0x74, 0xF3, 0x02, 0x8A, 0x6F, 0xAE, 0x81, 0x72, 0xE5, 0x81,
+  0xEC, 0xC0, 0x61, 0xCF, 0x65, 0x76, 0xAE, 0xA1, 0x28, 0x69, 0xE5, 0x69, 0x03, 0xBA, 0x90, 0xF3,
+  0x02, 0x86, 0x6C, 0x61, 0xE4, 0xC0, 0x61, 0xF9, 0xE5, 0x81, 0x74, 0xE9, 0xA0, 0x75, 0x62, 0x61,
+  0x72, 0x6D, 0x2D, 0x6A, 0x64, 0x64, 0xE4, 0xC0, 0x5C, 0xB1, 0xE1, 0x04, 0x20, 0x4E, 0x98, 0x74,
+  0xF3, 0x07, 0x0B, 0x08, 0x04, 0x06, 0x0B, 0x83, 0xF2, 0x04, 0xC0, 0x44, 0x72, 0xE5, 0x81, 0xEA,
+  0xC0, 0x63, 0x8C, 0x6F, 0x62, 0xE5, 0x81, 0xE7, 0xC0, 0x44, 0x67, 0xED, 0xC0, 0x4E, 0xD4, 0x6C,
+  0x65, 0xF6, 0xC0, 0x48, 0xC2, 0xEB, 0x04, 0xC0, 0x59, 0x4E, 0x69, 0x72, 0xE4, 0xC0, 0x46, 0x86,
+  0xE7, 0xB5, 0x37, 0xE5, 0x04, 0x06, 0x06, 0x85, 0xEE, 0x81, 0xEE, 0xC0, 0x61, 0xA5, 0x6C, 0x6C,
+  0xF9, 0xC0, 0x62, 0xA5, 0x6B, 0xEB, 0xC0, 0x58, 0x00, 0xE2, 0xC0, 0x62, 0x76, 0x72, 0x65, 0xE8,
+  0x69, 0x04, 0x07, 0xA7, 0x78, 0x73, 0x64, 0x6F, 0xF2, 0xC0, 0x60, 0x05, 0xEE, 0x81, 0x6E, 0xE9,
+  0x81, 0xF6, 0xC0, 0x5F, 0xFC, 0x71, 0x78, 0x2D, 0x74, 0x67, 0x67, 0xF2, 0xC0, 0x5D, 0x9E, 0x63,
+  0xE1, 0x07, 0x0A, 0x09, 0x09, 0x0C, 0x07, 0x8E, 0x75, 0x77, 0x2D, 0x79, 0x6E, 0x6E, 0xF2, 0xC0,
+  0x5C, 0x29, 0x6F, 0x70, 0x2D, 0x64, 0x72, 0xE7, 0xC0, 0x5A, 0xE2, 0x6E, 0x35, 0x2D, 0x72, 0x64,
+  0xE9, 0xC0, 0x5C, 0x17, 0x6C, 0x65, 0x2D, 0x73, 0x6C, 0x67, 0x2D, 0x2D, 0xEE, 0xC0, 0x64, 0x42,
+  0x69, 0x6C, 0x2D, 0xF4, 0xC0, 0x5A, 0xC6, 0x38, 0x6D, 0x2D, 0x64, 0x6E, 0x75, 0x73, 0x79, 0x6E,
+  0x6E, 0xF2, 0xC0, 0x5B, 0xF6, 0x34, 0x73, 0x2D, 0x61, 0x74, 0x73, 0x61, 0x65, 0x66, 0x72, 0x6D,
+  0x6D, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x64, 0x1A, 0xE2, 0x0A, 0x20, 0x3F, 0x16, 0x15, 0x1D, 0x1F,
+  0x20, 0x21, 0x94, 0xF1, 0x02, 0x92, 0x73, 0x2D, 0x6E, 0x65, 0x73, 0x6C, 0x61, 0x68, 0x73, 0x6C,
+  0x61, 0x64, 0x72, 0x6A, 0xF4, 0xC0, 0x5B, 0x93, 0x71, 0x2D, 0x6C, 0x61, 0x64, 0x73, 0x6D, 0x6F,
+  0x72, 0x2D, 0x67, 0x6F, 0x2D, 0x65, 0x72, 0x6D, 0x2D, 0x2D, 0x6E, 0x78, 0xAE, 0x02, 0x84, 0xE5,
+  0xC0, 0x3C, 0x89, 0xE1, 0x81, 0x72, 0x69, 0x2D, 0x79, 0x72, 0x65, 0x68, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x63, 0xD0, 0x6E, 0x6A, 0x2D, 0x64, 0x6E, 0x61, 0x6C, 0x68, 0x2D, 0x67, 0x6F, 0x6B, 0x73, 0x72,
+  0x75, 0x61, 0x2D, 0x2D, 0xEE, 0xC0, 0x63, 0xBA, 0x6A, 0x75, 0x2D, 0x65, 0x72, 0x64, 0x69, 0x6C,
+  0x73, 0x2D, 0x65, 0x72, 0x74, 0x73, 0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0x63, 0xA5, 0xE7, 0x02, 0x8B,
+  0x6F, 0x2D, 0x6E, 0x65, 0x6A, 0x73, 0x73, 0x65, 0xEE, 0xA2, 0x43, 0x67, 0x2D, 0x72, 0x65, 0x67,
+  0x6E, 0x61, 0x72, 0x61, 0x76, 0x2D, 0xF2, 0xC0, 0x5B, 0x21, 0xE3, 0x02, 0x8E, 0x7A, 0x2D, 0x6E,
+  0x65, 0x74, 0x6F, 0x74, 0x2D, 0x65, 0x72, 0xF4, 0xC0, 0x5B, 0x10, 0x30, 0x2D, 0x64, 0x6E, 0x61,
+  0x6C, 0x2D, 0x65, 0x72, 0x64, 0xEE, 0xC0, 0x5B, 0x02, 0xE1, 0x03, 0x0C, 0x8A, 0x6E, 0x30, 0x2D,
+  0x79, 0x64, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x63, 0x59, 0x6C, 0x65, 0x2D, 0x74, 0xEC, 0x40, 0x5A,
+  0xEA, 0xA0, 0x30, 0x69, 0x79, 0x2D, 0xE7, 0xC0, 0x5C, 0x73, 0x35, 0x33, 0x61, 0x79, 0x37, 0x2D,
+  0x6F, 0x6C, 0x6F, 0x75, 0x73, 0x65, 0x63, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x63, 0x34, 0x32, 0x35,
+  0x2D, 0x61, 0x6B, 0x69, 0x69, 0x76, 0x61, 0x67, 0x61, 0xE5, 0xC0, 0x59, 0xB0, 0xE1, 0x20, 0x30,
+  0x0D, 0x20, 0xA4, 0x20, 0x8A, 0x0C, 0x19, 0x20, 0xDF, 0x20, 0x43, 0x20, 0x35, 0x21, 0x2D, 0x20,
+  0x4C, 0x05, 0x20, 0x51, 0x20, 0x9C, 0x05, 0x20, 0x46, 0x20, 0x21, 0x0E, 0x07, 0x20, 0x27, 0x13,
+  0x1C, 0x12, 0x08, 0x20, 0x2F, 0x10, 0x20, 0x82, 0x12, 0x20, 0x95, 0xC0, 0x59, 0x7D, 0x7A, 0x39,
+  0x2D, 0x64, 0x72, 0x6F, 0x6A, 0x66, 0x73, 0xF4, 0xC0, 0x5A, 0xB0, 0xF9, 0x0B, 0x0E, 0x20, 0x2E,
+  0x0E, 0x20, 0x32, 0x10, 0xC0, 0x45, 0x58, 0x67, 0x2D, 0x72, 0x65, 0x67, 0x61, 0x72, 0x6B, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x62, 0xCD, 0x66, 0x2D, 0xF9, 0x03, 0x0B, 0x96, 0x73, 0x74, 0x69, 0x76, 0x6B,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0xBC, 0x72, 0xE5, 0x02, 0x89, 0x74, 0x73, 0x6F, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x62, 0xAF, 0x64, 0x6E, 0x69, 0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0xA6, 0x6B, 0x72, 0x61, 0xEA,
+  0xC0, 0x5A, 0x68, 0x65, 0x2D, 0x6E, 0x65, 0x6A, 0x73, 0x6F, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x62,
+  0x91, 0x62, 0xAD, 0x04, 0x0C, 0x0C, 0x8C, 0x72, 0x65, 0x74, 0x73, 0x6C, 0x6A, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x62, 0x7F, 0x6B, 0x69, 0x76, 0x72, 0x79, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0x73, 0x67,
+  0x6F, 0x6B, 0x73, 0x6D, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0x67, 0x64, 0x6C, 0x6F, 0x66, 0xF2,
+  0xC0, 0x59, 0xF8, 0x38, 0x2D, 0x61, 0x6E, 0x74, 0x6F, 0x75, 0x76, 0x69, 0x67, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x62, 0x4F, 0x37, 0x2D, 0x75, 0x6A, 0x64, 0x61, 0x65, 0x68, 0xE1, 0xC0, 0x58, 0xCE, 0xF8,
+  0x08, 0x0F, 0x0F, 0x13, 0x0F, 0x0F, 0x0B, 0x8F, 0x6E, 0x2D, 0x64, 0x72, 0x6F, 0x6A, 0x66, 0x76,
+  0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0x2B, 0x6D, 0x2D, 0x6E, 0x65, 0x67, 0x6E, 0x69, 0x6C, 0x72,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x62, 0x1C, 0x6A, 0x2D, 0x67, 0x76, 0xE5, 0x02, 0x86, 0x6C, 0x72, 0xE5,
+  0xC0, 0x59, 0xD8, 0x67, 0x6E, 0xE1, 0xC0, 0x58, 0x94, 0x69, 0x2D, 0x64, 0x72, 0x67, 0x65, 0x70,
+  0x70, 0x6F, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0xFA, 0x68, 0x2D, 0x6E, 0x65, 0x6C, 0x74, 0x6C, 0x6F,
+  0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0xEB, 0x66, 0x2D, 0x64, 0x6E, 0x61, 0x6C, 0x6E, 0xEB, 0xC0,
+  0x59, 0x79, 0x64, 0x2D, 0x6E, 0x6D, 0x61, 0x68, 0x65, 0x72, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x61,
+  0xD1, 0x39, 0x2D, 0x64, 0x6C, 0x6F, 0x66, 0x74, 0x73, 0x2D, 0x2D, 0x6E, 0x78, 0xAE, 0x81, 0x61,
+  0x6F, 0x71, 0x2D, 0x72, 0x65, 0xEC, 0xC0, 0x5A, 0xE4, 0x77, 0x68, 0x2D, 0x61, 0x6E, 0x74, 0x6F,
+  0x75, 0xF6, 0xC0, 0x61, 0x95, 0xF6, 0x69, 0x04, 0x07, 0xA4, 0xBA, 0x72, 0xE5, 0x81, 0xE9, 0xC0,
+  0x4B, 0xAE, 0x6C, 0x65, 0x64, 0x61, 0x74, 0x73, 0x6B, 0x6F, 0xF2, 0xC0, 0x5D, 0x13, 0xF5, 0x0C,
+  0x09, 0x20, 0x2E, 0x20, 0x26, 0x0D, 0x20, 0x26, 0x0E, 0x0E, 0x9C, 0x7A, 0x2D, 0x73, 0x6D, 0x6F,
+  0xF2, 0xC0, 0x60, 0xAF, 0x79, 0x2D, 0xF9, 0x04, 0x0A, 0x0D, 0x8A, 0x72, 0x65, 0x76, 0x61, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x61, 0x6D, 0xEE, 0x02, 0x85, 0x6E, 0xE9, 0xC0, 0x61, 0x57, 0x61, 0xF2, 0xC0,
+  0x60, 0x91, 0x6D, 0x72, 0x61, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0x56, 0x64, 0x6E, 0xE1, 0xC0,
+  0x58, 0xE9, 0x77, 0xAD, 0x02, 0x8B, 0x6F, 0x72, 0x79, 0x73, 0x6F, 0x2D, 0x2D, 0xEE, 0xC0, 0x61,
+  0x41, 0xEB, 0x02, 0x8A, 0x69, 0x76, 0x6A, 0x67, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0x34, 0x61, 0x62,
+  0x72, 0x64, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0x2A, 0x76, 0x2D, 0x6E, 0x65, 0x6B, 0x79, 0x72, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x61, 0x1D, 0x75, 0xAD, 0x03, 0x0B, 0x8B, 0x73, 0x65, 0x6E, 0x73, 0x6B, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x61, 0x0D, 0x67, 0x6F, 0x6B, 0x73, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x61, 0x02,
+  0x64, 0x6E, 0x61, 0x6C, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x60, 0xF7, 0x6B, 0x2D, 0x72, 0x65, 0x6B,
+  0x72, 0x65, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x60, 0xE9, 0x6A, 0x2D, 0x65, 0x6B, 0x65, 0x72, 0x6F,
+  0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x60, 0xDB, 0x69, 0xAD, 0x02, 0x8C, 0x76, 0x6C, 0x65, 0x73, 0x6C,
+  0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x60, 0xCB, 0x64, 0x72, 0x6F, 0x6A, 0x66, 0x6B, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x60, 0xBF, 0x68, 0x2D, 0x64, 0x6E, 0x75, 0x73, 0xE5, 0xC0, 0x57, 0x40, 0xF4, 0x08, 0x0A,
+  0x10, 0x0E, 0x0A, 0xC0, 0x5F, 0x25, 0x75, 0x2D, 0x76, 0x72, 0x65, 0x69, 0xEB, 0xC0, 0x58, 0x3B,
+  0xF3, 0x06, 0x40, 0x43, 0xA4, 0xBB, 0xDF, 0x61, 0x65, 0x66, 0x72, 0x61, 0xED, 0xC0, 0x40, 0x30,
+  0x72, 0x2D, 0x61, 0x67, 0x72, 0x6A, 0x6E, 0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0x60, 0x84, 0x70, 0x2D,
+  0x72, 0x61, 0x64, 0x64, 0xEA, 0xC0, 0x58, 0x43, 0x6B, 0x6F, 0x75, 0x6C, 0x6F, 0xEE, 0xAD, 0xF5,
+  0xF3, 0x08, 0x04, 0x07, 0x07, 0x11, 0xC0, 0x54, 0x5E, 0xF3, 0xC0, 0x5B, 0xC7, 0x6D, 0x6F, 0xF2,
+  0x69, 0xC0, 0x5F, 0x52, 0x6C, 0xE1, 0x40, 0x5E, 0x60, 0xA0, 0xB6, 0xE9, 0x04, 0xC0, 0x53, 0xB6,
+  0x65, 0xF2, 0x02, 0x84, 0xF2, 0xC0, 0x4B, 0x65, 0xE4, 0xC0, 0x36, 0x14, 0xE1, 0x04, 0xC0, 0x46,
+  0xF2, 0xEF, 0xC0, 0x46, 0xF1, 0xF2, 0x12, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x12, 0x04, 0x17, 0x20,
+  0x5A, 0x15, 0x20, 0x41, 0x3C, 0xEB, 0xBD, 0xEF, 0x76, 0x2D, 0x72, 0x76, 0x73, 0xF9, 0xC0, 0x5F,
+  0x52, 0x73, 0x2D, 0x6C, 0x61, 0x64, 0xF2, 0xC0, 0x56, 0xA3, 0x70, 0x2D, 0x73, 0x64, 0x6E, 0xE9,
+  0xC0, 0x56, 0x9A, 0x6E, 0x2D, 0x65, 0x73, 0x61, 0xEE, 0xC0, 0x57, 0x9F, 0x6D, 0x2D, 0x74, 0x6C,
+  0x6F, 0x68, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0xF9, 0x6C, 0xAD, 0x02, 0x87, 0x6C, 0x61, 0x72,
+  0xE5, 0xC0, 0x57, 0x87, 0x64, 0x72, 0x6F, 0xEA, 0xC0, 0x5F, 0xD9, 0xEB, 0xC0, 0x4C, 0x0F, 0x6A,
+  0xAD, 0x03, 0x06, 0x86, 0x73, 0x64, 0xE1, 0xC0, 0x59, 0x03, 0x72, 0x6F, 0xEC, 0xC0, 0x5F, 0xC4,
+  0x64, 0x72, 0xE1, 0xC0, 0x58, 0xF7, 0xE9, 0x02, 0x85, 0x73, 0xF4, 0xC0, 0x5C, 0xA3, 0xAD, 0x04,
+  0x20, 0x39, 0x8A, 0xF9, 0x04, 0x0F, 0x09, 0x89, 0xF2, 0x02, 0x88, 0x79, 0x64, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x5F, 0xAF, 0xF5, 0xC0, 0x56, 0x36, 0x6C, 0x65, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0xA2,
+  0x6B, 0x73, 0x61, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0x99, 0xE4, 0x02, 0x88, 0x6E, 0x61, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x5F, 0x8E, 0x61, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0x86, 0x72, 0x73, 0x69, 0x72,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0x7C, 0x6C, 0x62, 0x6F, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0x72,
+  0x68, 0xAD, 0x02, 0x86, 0x65, 0x6D, 0xEA, 0xC0, 0x5E, 0x99, 0xE1, 0x02, 0x85, 0x79, 0xF2, 0xC0,
+  0x5F, 0x52, 0xEC, 0xA0, 0x3F, 0x67, 0xAD, 0x06, 0x0A, 0x06, 0x06, 0x06, 0x8D, 0x73, 0x6F, 0x72,
+  0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5F, 0x4B, 0x6F, 0x6C, 0xED, 0xC0, 0x57, 0x0E, 0x6E, 0x65, 0xF4,
+  0xC0, 0x55, 0xCA, 0x6D, 0x75, 0xF2, 0xC0, 0x56, 0xD2, 0xE5, 0x02, 0x85, 0x6E, 0xE7, 0xC0, 0x56,
+  0xCA, 0x64, 0xF2, 0xC0, 0x5F, 0x1E, 0x61, 0xEE, 0x02, 0x88, 0x6E, 0x64, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x5F, 0x20, 0xED, 0xC0, 0x56, 0xB5, 0x66, 0x2D, 0x61, 0x74, 0x73, 0x72, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x5F, 0x10, 0xF1, 0x04, 0x09, 0xA0, 0x22, 0x79, 0x2D, 0x74, 0x69, 0x6E, 0xEB, 0xC0, 0x56, 0x9B,
+  0x78, 0xAD, 0x02, 0x97, 0xF2, 0x02, 0x8A, 0x69, 0x6D, 0x70, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5E,
+  0xF1, 0x65, 0x6D, 0x62, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5E, 0xE7, 0x69, 0x70, 0x70, 0xE8, 0xC0,
+  0x55, 0x6B, 0x30, 0x2D, 0xF4, 0x03, 0x06, 0x8A, 0x76, 0x65, 0xE9, 0xC0, 0x56, 0x9D, 0x73, 0x6F,
+  0x75, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x5E, 0xCA, 0x62, 0x61, 0xEF, 0xC0, 0x55, 0x4F, 0x70, 0xF0,
+  0xC0, 0x4D, 0x74, 0xEF, 0x06, 0x16, 0x08, 0x08, 0x08, 0x88, 0x77, 0xAD, 0x02, 0x8A, 0x75, 0x62,
+  0x6C, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x5E, 0xAA, 0x61, 0x6E, 0xF2, 0x40, 0x5D, 0xD5, 0xA0, 0xC1,
+  0x76, 0x2D, 0x6D, 0x75, 0xF2, 0xC0, 0x56, 0x63, 0x73, 0x2D, 0x6B, 0x6A, 0xEB, 0xC0, 0x56, 0x2B,
+  0x72, 0x2D, 0x61, 0x73, 0xEE, 0xC0, 0x56, 0x23, 0x71, 0x2D, 0x6E, 0x61, 0xE7, 0xC0, 0x57, 0xAD,
+  0x70, 0xAD, 0x02, 0x86, 0x73, 0x65, 0xEE, 0xC0, 0x56, 0x11, 0x6C, 0x61, 0x64, 0x72, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x5E, 0x6E, 0xEE, 0x11, 0x0B, 0x20, 0x33, 0x04, 0x04, 0x0B, 0x13, 0x14, 0x07, 0x37,
+  0x7A, 0x40, 0x3F, 0x19, 0xA2, 0x6D, 0x7A, 0x2D, 0x72, 0x65, 0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0x5E,
+  0x51, 0xF4, 0x03, 0xA0, 0x24, 0x6F, 0x75, 0xF6, 0x03, 0x0C, 0x84, 0x73, 0xE1, 0x04, 0xC0, 0x5C,
+  0x23, 0x74, 0x74, 0xF6, 0xC0, 0x51, 0x37, 0xE9, 0xC0, 0x55, 0x02, 0xE1, 0x04, 0xC0, 0x5D, 0x06,
+  0xE3, 0x02, 0x82, 0xE3, 0x81, 0xE8, 0xC0, 0x5C, 0x76, 0x61, 0x6F, 0x75, 0x76, 0x61, 0x74, 0x68,
+  0xE5, 0xC0, 0x4C, 0x13, 0xF3, 0xC0, 0x5C, 0xEF, 0xED, 0xC0, 0x49, 0x31, 0x64, 0x6F, 0x75, 0x76,
+  0x73, 0x61, 0x74, 0xF6, 0xC0, 0x51, 0x07, 0xE1, 0x04, 0xC0, 0x5C, 0xF7, 0xF2, 0x69, 0x06, 0x40,
+  0x5B, 0xBC, 0xA1, 0x33, 0x2D, 0x69, 0xAD, 0xC0, 0x5B, 0xF7, 0x35, 0xAD, 0x02, 0x86, 0x74, 0x61,
+  0xEC, 0xC0, 0x55, 0x87, 0x61, 0x73, 0x69, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5D, 0xE4, 0x32, 0x2D,
+  0x64, 0xEF, 0xC0, 0x55, 0xA6, 0x30, 0x2D, 0x74, 0x73, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5D, 0xD2,
+  0x6D, 0xF5, 0xC0, 0x51, 0x34, 0xEC, 0x08, 0x0F, 0x16, 0x08, 0x06, 0xC0, 0x5B, 0x4F, 0xF5, 0x04,
+  0xC0, 0x5C, 0x40, 0x2D, 0x65, 0x64, 0x72, 0x2D, 0x2D, 0xEE, 0xC0, 0x5D, 0xB5, 0x74, 0xAD, 0x02,
+  0x89, 0x74, 0x6F, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x5D, 0xA8, 0x69, 0x6C, 0x6D, 0x2D, 0x2D, 0xEE,
+  0xC0, 0x5D, 0x9F, 0x73, 0x65, 0xEE, 0x81, 0xEE, 0xC0, 0x41, 0x9C, 0xEF, 0x40, 0x50, 0x20, 0xAB,
+  0xF7, 0x6C, 0x61, 0x68, 0x72, 0xE5, 0x81, 0xF6, 0xC0, 0x5C, 0x74, 0xEB, 0x05, 0x12, 0xC0, 0x53,
+  0x36, 0x69, 0x69, 0xF6, 0x02, 0x84, 0xF2, 0xC0, 0x5A, 0x79, 0x61, 0x67, 0x6E, 0xE1, 0x40, 0x53,
+  0x3B, 0xA8, 0xF3, 0xE8, 0x81, 0x6F, 0x6A, 0x73, 0xE1, 0xC0, 0x2C, 0x8F, 0xEA, 0x02, 0x84, 0xF3,
+  0xC0, 0x53, 0x29, 0x64, 0x64, 0x61, 0xE4, 0xC0, 0x5B, 0xA5, 0x69, 0x7A, 0x2D, 0xEC, 0xC0, 0x5D,
+  0x43, 0xE7, 0x08, 0x09, 0x04, 0x40, 0x41, 0x3D, 0xB8, 0xBC, 0x72, 0x61, 0x6A, 0xEE, 0x20, 0x43,
+  0xC0, 0x59, 0xDD, 0xEC, 0xC0, 0x5B, 0xE1, 0x31, 0x30, 0x61, 0x71, 0x30, 0x2D, 0x69, 0x6E, 0x65,
+  0x76, 0x65, 0x2D, 0x2D, 0xEE, 0xC0, 0x5D, 0x2A, 0xE6, 0x02, 0x89, 0x32, 0x2D, 0x68, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x5D, 0x1E, 0x31, 0xAD, 0x40, 0x53, 0xA4, 0xA1, 0x0E, 0xE4, 0x08, 0x04, 0x05, 0x40,
+  0x57, 0xC4, 0xA0, 0xDF, 0xF5, 0xC0, 0x59, 0x21, 0x6E, 0xE1, 0xC0, 0x2B, 0x28, 0x69, 0x69, 0xF3,
+  0x81, 0x65, 0x76, 0xF6, 0xC0, 0x58, 0xD7, 0x62, 0x63, 0x74, 0x2D, 0x65, 0x69, 0x6D, 0x65, 0x75,
+  0x76, 0x65, 0x6A, 0x73, 0x65, 0xED, 0xC0, 0x5C, 0xD1, 0xE1, 0x69, 0x81, 0x2E, 0xF3, 0xC0, 0x5B,
+  0x9E, 0xB8, 0x03, 0x11, 0x8D, 0x6D, 0x2D, 0x64, 0x61, 0x72, 0x65, 0x68, 0x73, 0x64, 0x72, 0x6B,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x5C, 0xCC, 0x6C, 0x2D, 0x6C, 0x61, 0x64, 0x72, 0x75, 0x61, 0x2D, 0xF2,
+  0xC0, 0x54, 0x58, 0x6B, 0x2D, 0x72, 0x65, 0x6B, 0x69, 0x65, 0x2D, 0x65, 0xF2, 0xC0, 0x55, 0xDD,
+  0x37, 0x6B, 0x2D, 0x61, 0x6E, 0x74, 0x6F, 0x75, 0x76, 0x61, 0x63, 0x63, 0xE8, 0xC0, 0x54, 0x6B,
+  0xB4, 0x06, 0x20, 0x20, 0x20, 0x20, 0x90, 0x79, 0xAD, 0x02, 0x8C, 0x69, 0x6B, 0x68, 0x76, 0x6C,
+  0x61, 0x72, 0x61, 0xE5, 0xC0, 0x54, 0x54, 0x61, 0x67, 0x72, 0x6A, 0x6E, 0x65, 0x76, 0x76, 0x61,
+  0x64, 0x2D, 0x2D, 0xEE, 0xC0, 0x5C, 0x7B, 0x73, 0xAD, 0x02, 0x90, 0x69, 0x6D, 0x70, 0x6F, 0x75,
+  0x76, 0x74, 0x61, 0x6C, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x5C, 0x67, 0x61, 0x6E, 0x74, 0x6F, 0x75,
+  0x76, 0x61, 0x63, 0xE8, 0xC0, 0x54, 0x24, 0x36, 0x2D, 0x6E, 0x65, 0x6C, 0x61, 0x64, 0x6E, 0x6A,
+  0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x5C, 0x4B, 0x35, 0xAD, 0x03, 0x0E, 0x8A, 0x74, 0x65, 0x64, 0x6E,
+  0x61, 0x6C, 0x79, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5C, 0x38, 0x67, 0x6F, 0x6B, 0x73, 0x6E, 0x65,
+  0xF2, 0xC0, 0x52, 0xB9, 0x64, 0x6E, 0x61, 0x6C, 0x65, 0x70, 0x72, 0x6A, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x5C, 0x20, 0x33, 0x67, 0x2D, 0x64, 0x61, 0x74, 0x73, 0x6F, 0x62, 0x65, 0x67, 0x68, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x5C, 0x0E, 0xB1, 0x06, 0x19, 0x0B, 0x0B, 0xA0, 0x50, 0x76, 0x2D, 0xF9, 0x02, 0x88,
+  0x76, 0x72, 0x65, 0x6A, 0xEB, 0xC0, 0x53, 0x93, 0x73, 0x65, 0x6E, 0x6E, 0x65, 0x72, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x5B, 0xEE, 0x73, 0x2D, 0x6C, 0x61, 0x64, 0x72, 0x6A, 0xF4, 0xC0, 0x53, 0x7C, 0x72,
+  0x2D, 0x64, 0x61, 0x74, 0x73, 0x67, 0xF2, 0xC0, 0x5B, 0x09, 0x71, 0xAD, 0x06, 0x0D, 0x0D, 0x13,
+  0x09, 0x89, 0x73, 0x73, 0x6F, 0x66, 0x65, 0x6E, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0xC3, 0x72,
+  0x65, 0x67, 0x6E, 0x61, 0x79, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0xB6, 0xEE, 0x02, 0x88, 0x6F,
+  0x72, 0x66, 0x2D, 0xF2, 0xC0, 0x53, 0x44, 0x65, 0x67, 0x6E, 0x69, 0xE4, 0xC0, 0x52, 0x2E, 0x6C,
+  0x61, 0x64, 0x6F, 0x2D, 0xF2, 0xC0, 0x53, 0x33, 0x67, 0x72, 0x65, 0x62, 0x73, 0xEE, 0xC0, 0x5A,
+  0xC2, 0x61, 0x73, 0x69, 0x65, 0x72, 0xF2, 0xC0, 0x53, 0x21, 0x70, 0x2D, 0x6E, 0x65, 0x64, 0x72,
+  0x61, 0x67, 0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0x79, 0xB0, 0x04, 0x10, 0x10, 0x8C, 0x6B, 0x2D,
+  0x6E, 0x65, 0x67, 0x6E, 0x61, 0x6E, 0x76, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0x64, 0x67, 0x2D,
+  0x6C, 0x6B, 0x73, 0x65, 0x64, 0x6C, 0x69, 0x67, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0x54, 0x63, 0x2D,
+  0x69, 0x65, 0x68, 0x73, 0x72, 0x67, 0xE5, 0xC0, 0x54, 0x73, 0x62, 0x2D, 0x65, 0x6B, 0x68, 0x67,
+  0x6E, 0x61, 0x72, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x5B, 0x38, 0xED, 0x69, 0x40, 0x42, 0xD4, 0x2D,
+  0x2C, 0x23, 0xA2, 0x0B, 0xA6, 0x43, 0x6C, 0xEC, 0x40, 0x51, 0xF2, 0xA8, 0x22, 0xEA, 0x69, 0x81,
+  0xAE, 0x40, 0x58, 0x12, 0x09, 0x20, 0x2F, 0x21, 0x8D, 0x06, 0x1E, 0x06, 0x86, 0xE9, 0x69, 0x09,
+  0x05, 0x0B, 0x40, 0x54, 0xF0, 0x24, 0xDA, 0x88, 0x73, 0xF9, 0xC0, 0x45, 0x63, 0xE4, 0x04, 0xC0,
+  0x4E, 0x64, 0xF5, 0x40, 0x59, 0x0A, 0xA0, 0xE8, 0xAE, 0x1F, 0x0A, 0x1F, 0x04, 0x09, 0x20, 0x80,
+  0x20, 0x4B, 0x20, 0x34, 0x20, 0x34, 0x19, 0x20, 0x26, 0x20, 0x22, 0x05, 0x1F, 0x20, 0x71, 0x20,
+  0x36, 0x05, 0x09, 0x12, 0x06, 0xC0, 0x56, 0xF9, 0xF9, 0x06, 0x40, 0x45, 0xC5, 0xB3, 0x55, 0x35,
+  0xF3, 0x62, 0xF8, 0x03, 0x07, 0x89, 0x72, 0x6F, 0x74, 0xE9, 0xC0, 0x59, 0x86, 0x63, 0xF1, 0x69,
+  0x81, 0x2E, 0x73, 0x79, 0xF3, 0x62, 0x62, 0x73, 0x6C, 0x70, 0x72, 0x62, 0x76, 0xAE, 0xC0, 0x59,
+  0x6E, 0xF7, 0xC0, 0x58, 0x7D, 0x76, 0x67, 0x69, 0x62, 0x2E, 0xB0, 0xC0, 0x4E, 0x1C, 0xF4, 0x05,
+  0x20, 0x41, 0x0C, 0x9B, 0xF3, 0x03, 0xA0, 0x38, 0x75, 0x64, 0x67, 0x6E, 0x69, 0x68, 0x74, 0xAE,
+  0x04, 0x09, 0x0C, 0x88, 0x76, 0x65, 0x64, 0xAE, 0x20, 0x24, 0xC0, 0x49, 0x0A, 0x67, 0x6E, 0x69,
+  0x74, 0x73, 0x65, 0x74, 0xAE, 0x17, 0xC0, 0x49, 0x0A, 0x64, 0x6F, 0x72, 0x70, 0xAE, 0xC0, 0x49,
+  0x18, 0x63, 0x65, 0x72, 0x73, 0x69, 0x64, 0xAE, 0x04, 0xC0, 0x49, 0x0A, 0xE4, 0xC0, 0x25, 0xB1,
+  0x6F, 0xE8, 0xC0, 0x59, 0x1A, 0x72, 0x61, 0x65, 0x64, 0x6F, 0x6E, 0x2E, 0x65, 0xE7, 0xC0, 0x58,
+  0x5D, 0xE9, 0x04, 0x07, 0x04, 0x87, 0x6B, 0x65, 0x63, 0xE1, 0xC0, 0x48, 0x47, 0xE7, 0xC0, 0x59,
+  0x00, 0x64, 0x65, 0x74, 0xE6, 0xC0, 0x58, 0x08, 0xE2, 0xC0, 0x3D, 0x23, 0xE5, 0x02, 0x86, 0x6E,
+  0x6F, 0xF4, 0xC0, 0x41, 0xCE, 0x6B, 0x63, 0x75, 0xE2, 0x81, 0xF4, 0xC0, 0x54, 0x43, 0xF3, 0x07,
+  0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x8B, 0xF4, 0x02, 0x87, 0x65, 0xEB, 0x81, 0xE3, 0xC0, 0x59, 0x04,
+  0x61, 0xE3, 0xC0, 0x32, 0xB7, 0x70, 0x70, 0x61, 0x72, 0x65, 0x76, 0x65, 0xEC, 0xC0, 0x58, 0xE3,
+  0x6F, 0x6C, 0xEF, 0xC0, 0x4C, 0xAA, 0x6E, 0x65, 0x6D, 0x65, 0x69, 0x73, 0xAD, 0xC0, 0x57, 0xF1,
+  0x67, 0x6E, 0x69, 0x68, 0xF4, 0xC0, 0x53, 0xB9, 0x63, 0x6F, 0x64, 0x65, 0x68, 0x74, 0x64, 0xE1,
+  0xC0, 0x57, 0x28, 0x33, 0x6B, 0x2D, 0x6E, 0xEF, 0x62, 0xF2, 0x02, 0x88, 0x69, 0x61, 0x6C, 0x2E,
+  0xF3, 0xC0, 0x45, 0xC3, 0xE5, 0x03, 0x0E, 0x8A, 0x76, 0x72, 0x65, 0xF3, 0x04, 0xC0, 0x48, 0x4D,
+  0x63, 0x69, 0xF3, 0xC0, 0x58, 0x09, 0x74, 0x73, 0x6E, 0x65, 0x75, 0x6D, 0xAD, 0xC0, 0x42, 0xF1,
+  0x6E, 0x69, 0x61, 0x74, 0x6E, 0x6F, 0x63, 0x65, 0x72, 0x75, 0x7A, 0xE1, 0x62, 0xF0, 0x03, 0xA0,
+  0x29, 0x70, 0xE1, 0x02, 0x9B, 0xE5, 0x02, 0x8E, 0x74, 0x79, 0x62, 0x65, 0x65, 0x62, 0x2E, 0x31,
+  0xE4, 0x81, 0xEB, 0xC0, 0x54, 0x74, 0x6E, 0x61, 0x6C, 0xF0, 0x81, 0x6B, 0xE3, 0xC0, 0x57, 0xCF,
+  0x2D, 0xE1, 0x81, 0xF2, 0x81, 0x75, 0xF3, 0xC0, 0x39, 0x18, 0x6F, 0x70, 0x69, 0xEC, 0xC0, 0x48,
+  0x26, 0xEF, 0x02, 0x90, 0xF4, 0x02, 0x89, 0x70, 0x79, 0x72, 0x63, 0x74, 0xE6, 0xC0, 0x57, 0x30,
+  0xEF, 0xC0, 0x57, 0xF0, 0x69, 0x72, 0x2D, 0x6E, 0xEF, 0x62, 0xEE, 0x04, 0x05, 0x08, 0x8C, 0x79,
+  0xE4, 0xC0, 0x55, 0x1F, 0x72, 0x6F, 0x63, 0x61, 0x2D, 0x6E, 0xEF, 0x62, 0x6D, 0x74, 0x73, 0xF0,
+  0x69, 0x81, 0x2E, 0x6B, 0xE3, 0xC0, 0x57, 0x39, 0x61, 0xE9, 0x81, 0x63, 0xE9, 0xC0, 0x4F, 0x42,
+  0xEB, 0x03, 0x0F, 0x85, 0x72, 0x61, 0x6D, 0x79, 0x74, 0x65, 0x66, 0x61, 0x73, 0x72, 0x65, 0x73,
+  0xF7, 0xAA, 0x5C, 0x6F, 0xF2, 0xC0, 0x52, 0xC7, 0x63, 0x6F, 0x72, 0x65, 0x67, 0x72, 0x6F, 0xE6,
+  0xA2, 0x72, 0x69, 0xEC, 0xC0, 0x29, 0x68, 0x67, 0x6E, 0xE9, 0x02, 0x89, 0x74, 0x73, 0x6F, 0x68,
+  0x79, 0xF4, 0xC0, 0x2F, 0xDC, 0x67, 0x61, 0x74, 0x73, 0x6E, 0x69, 0x73, 0x65, 0x72, 0x2E, 0x73,
+  0x65, 0x63, 0xE9, 0xC0, 0x4D, 0x22, 0xE5, 0x0A, 0x20, 0x26, 0x07, 0x0E, 0x05, 0x0B, 0xC0, 0x41,
+  0x1E, 0xF4, 0x03, 0x09, 0x87, 0x79, 0x62, 0x65, 0x65, 0x62, 0xAE, 0xC0, 0x34, 0xDB, 0x6E, 0x65,
+  0x77, 0xF4, 0xC0, 0x55, 0xAC, 0xE9, 0x02, 0x89, 0x73, 0x6E, 0x6F, 0x65, 0x68, 0xF4, 0xC0, 0x4E,
+  0xDE, 0x62, 0x65, 0xF5, 0xC0, 0x57, 0x8C, 0x73, 0x75, 0x66, 0xF8, 0xC0, 0x56, 0xA0, 0xEC, 0x04,
+  0xC0, 0x50, 0xFD, 0x61, 0x63, 0x73, 0x6E, 0x6F, 0xEF, 0xC0, 0x4B, 0xDA, 0x65, 0xE7, 0xC0, 0x2F,
+  0x56, 0x64, 0x6F, 0x6E, 0x70, 0x70, 0x61, 0x64, 0xAE, 0xC0, 0x48, 0x9C, 0xE3, 0x02, 0x8A, 0x69,
+  0x76, 0x65, 0x64, 0x6E, 0x69, 0xF3, 0xC0, 0x55, 0xD2, 0x61, 0x70, 0x73, 0x69, 0x6E, 0x75, 0x2E,
+  0x31, 0x72, 0x66, 0xAD, 0xC0, 0x56, 0x23, 0xE4, 0x06, 0x20, 0x24, 0xC0, 0x55, 0xE2, 0xF5, 0x04,
+  0xC0, 0x4F, 0xDD, 0x6F, 0x6C, 0xE3, 0x02, 0x85, 0x72, 0xEF, 0xC0, 0x4B, 0x25, 0x69, 0x61, 0x7A,
+  0x6E, 0x61, 0x62, 0xAE, 0x04, 0xC0, 0x44, 0x4C, 0x73, 0x64, 0x72, 0x61, 0x79, 0x6B, 0x63, 0x61,
+  0xE2, 0x62, 0x72, 0x61, 0x6F, 0x62, 0x65, 0x6C, 0x67, 0xE1, 0xC0, 0x29, 0xD6, 0x63, 0xFA, 0xC0,
+  0x56, 0x47, 0xE2, 0x03, 0xB8, 0x90, 0x61, 0xEC, 0xC0, 0x46, 0x2A, 0xE1, 0x02, 0x87, 0x74, 0x61,
+  0x64, 0xAD, 0xC0, 0x57, 0x00, 0x6D, 0x69, 0x6E, 0x69, 0xE6, 0xC0, 0x53, 0xF6, 0x38, 0x33, 0xB0,
+  0xC0, 0x45, 0xEB, 0x33, 0xB5, 0xC0, 0x48, 0x25, 0x68, 0x77, 0x73, 0x6F, 0xE8, 0xC0, 0x54, 0xEF,
+  0xE7, 0x04, 0xC0, 0x4D, 0xD4, 0xEE, 0x69, 0x40, 0x4C, 0x72, 0xA5, 0xB5, 0xE6, 0x69, 0x81, 0x6E,
+  0xE9, 0x69, 0x81, 0xAE, 0x0C, 0x07, 0x05, 0x16, 0x07, 0x06, 0x08, 0x06, 0x0C, 0xC0, 0x55, 0xEE,
+  0x7A, 0xED, 0x81, 0xF5, 0xC0, 0x4C, 0x92, 0x74, 0xF3, 0xC0, 0x38, 0x5C, 0xF3, 0x02, 0x90, 0x6E,
+  0xE4, 0x06, 0x40, 0x47, 0xE3, 0xAD, 0x9F, 0x2D, 0x63, 0x69, 0x6D, 0xE1, 0xC0, 0x47, 0xDE, 0xE9,
+  0xA0, 0x44, 0x72, 0x75, 0x6F, 0xAD, 0xC0, 0x4C, 0x70, 0xF0, 0x40, 0x39, 0x9C, 0xAF, 0x45, 0x6F,
+  0x66, 0x6E, 0x69, 0xAD, 0xC0, 0x55, 0x46, 0x6D, 0x61, 0xE3, 0xC0, 0x38, 0xDB, 0x6C, 0x6C, 0x61,
+  0x74, 0x69, 0x73, 0x77, 0x6F, 0xEE, 0xC0, 0x53, 0x28, 0xE5, 0x04, 0x0B, 0x0B, 0x88, 0x74, 0x61,
+  0x64, 0x70, 0x75, 0x73, 0xEE, 0x69, 0xC0, 0x54, 0x7E, 0x72, 0x6F, 0x6D, 0x2D, 0x72, 0x6F, 0x66,
+  0x2D, 0xE5, 0xBF, 0x24, 0x68, 0x74, 0x2D, 0x73, 0xEB, 0xC0, 0x51, 0x2B, 0xE7, 0x02, 0x8C, 0x65,
+  0x6C, 0x6C, 0x6F, 0x63, 0x65, 0x76, 0x6F, 0xEC, 0xC0, 0x55, 0x58, 0x64, 0x65, 0x6C, 0x77, 0x6F,
+  0x6E, 0x6B, 0x2D, 0x66, 0x6F, 0x2D, 0xEC, 0x02, 0x82, 0xEC, 0x81, 0x65, 0x72, 0xF2, 0xC0, 0x55,
+  0xAE, 0xE5, 0x05, 0x08, 0xC0, 0x56, 0x31, 0x6D, 0x6F, 0x72, 0x61, 0xE6, 0xC0, 0x56, 0x01, 0xE4,
+  0x40, 0x52, 0x01, 0xA1, 0x32, 0xE4, 0x69, 0x06, 0x0E, 0x05, 0xC0, 0x4D, 0x99, 0x7A, 0x64, 0x37,
+  0x61, 0x63, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x57, 0x37, 0x61, 0xE7, 0xC0, 0x53, 0xC1,
+  0xAE, 0x0C, 0x06, 0x40, 0x32, 0x6A, 0x40, 0x23, 0x6B, 0x06, 0x1E, 0x06, 0x86, 0xF4, 0x40, 0x4F,
+  0xDA, 0xA6, 0x1C, 0xE4, 0xC0, 0x53, 0xBD, 0xE3, 0x69, 0x0A, 0x0A, 0x06, 0x40, 0x54, 0x91, 0x21,
+  0x2E, 0xA0, 0x33, 0xF3, 0x04, 0xC0, 0x4D, 0x14, 0x65, 0xE4, 0xC0, 0x42, 0xD1, 0xED, 0x81, 0xE1,
+  0xC0, 0x4F, 0xB8, 0xAE, 0x14, 0x1E, 0x12, 0x05, 0x0B, 0x0E, 0x05, 0x03, 0x40, 0x3D, 0x34, 0x33,
+  0x2C, 0x23, 0xA2, 0x21, 0x48, 0x06, 0xA0, 0x2A, 0xF4, 0x07, 0x12, 0x40, 0x54, 0x42, 0xA1, 0x60,
+  0x69, 0x6C, 0x70, 0x65, 0x72, 0x64, 0x65, 0x6C, 0x6C, 0x61, 0x77, 0x65, 0x72, 0x69, 0xE6, 0x69,
+  0xA0, 0x32, 0xB4, 0xC0, 0x55, 0xA3, 0xF3, 0x04, 0xC0, 0x3E, 0x8A, 0x65, 0x67, 0x61, 0xF0, 0x04,
+  0xC0, 0x54, 0xB6, 0x64, 0xE1, 0xC0, 0x4C, 0x84, 0x70, 0x61, 0x74, 0xEF, 0x62, 0xED, 0x04, 0xC0,
+  0x44, 0x73, 0xEF, 0x40, 0x50, 0x5C, 0xA5, 0x27, 0xEC, 0x04, 0xC0, 0x55, 0x87, 0x70, 0x65, 0xF2,
+  0x69, 0x81, 0xAE, 0xC0, 0x2F, 0x74, 0x69, 0xF0, 0xC0, 0x55, 0x06, 0xE5, 0xA3, 0x97, 0x64, 0xF2,
+  0x38, 0xD6, 0xC0, 0x3C, 0x9A, 0xE2, 0x69, 0x08, 0x04, 0x40, 0x2C, 0xB2, 0xC0, 0x27, 0xD1, 0xE9,
+  0xC0, 0x50, 0x50, 0xAE, 0x12, 0x0E, 0x08, 0x18, 0x1F, 0x07, 0x15, 0x04, 0x40, 0x31, 0x4A, 0x29,
+  0x93, 0x37, 0xF6, 0x21, 0xE8, 0x9E, 0xF4, 0x06, 0x40, 0x53, 0xD7, 0xA1, 0x60, 0x61, 0xF3, 0x81,
+  0xEB, 0xC0, 0x55, 0x52, 0x73, 0x61, 0x69, 0x63, 0xE9, 0xC0, 0x23, 0xC2, 0xEF, 0x07, 0x0A, 0x40,
+  0x50, 0x0B, 0xA3, 0xA9, 0x74, 0x6E, 0x65, 0x69, 0x6D, 0x69, 0xF6, 0xC0, 0x54, 0x43, 0x6C, 0x62,
+  0xE5, 0xC0, 0x52, 0x43, 0xEC, 0x04, 0xC0, 0x55, 0x1B, 0xE1, 0x04, 0xC0, 0x3F, 0x62, 0x6E, 0x6F,
+  0xE9, 0x02, 0x87, 0x73, 0xE5, 0x81, 0xE6, 0xC0, 0x3D, 0xC9, 0x63, 0x61, 0x6E, 0x69, 0x72, 0xF5,
+  0xC0, 0x42, 0xF6, 0xE9, 0x81, 0x6B, 0xE9, 0xC0, 0x52, 0xF5, 0xE5, 0x02, 0x8D, 0x74, 0xF2, 0x04,
+  0xC0, 0x55, 0x02, 0x6F, 0xF0, 0x40, 0x42, 0xF5, 0xAE, 0xE6, 0x72, 0xE2, 0xC0, 0x4B, 0xDA, 0x64,
+  0xF5, 0xAF, 0x31, 0xE1, 0x07, 0x09, 0x08, 0x07, 0x0B, 0xA0, 0x39, 0x76, 0x69, 0x74, 0x61, 0x72,
+  0xE5, 0xC0, 0x23, 0x5E, 0x74, 0xF3, 0x81, 0x69, 0xF6, 0xC0, 0x53, 0x2F, 0x73, 0x65, 0x72, 0xF0,
+  0xC0, 0x2F, 0x68, 0xEE, 0x02, 0x84, 0x69, 0xE3, 0xA9, 0x25, 0x65, 0xE7, 0xB2, 0xCB, 0xE9, 0x05,
+  0x05, 0x0B, 0x08, 0x8C, 0x76, 0xE9, 0xC0, 0x38, 0xAB, 0x72, 0xF4, 0x04, 0xC0, 0x4B, 0xDF, 0x73,
+  0xF5, 0xC0, 0x2D, 0x37, 0xED, 0x03, 0xA5, 0xD3, 0xEF, 0xC0, 0x30, 0x1C, 0x67, 0x6F, 0x6C, 0xEF,
+  0x04, 0xC0, 0x30, 0x14, 0xEE, 0xC0, 0x42, 0x42, 0xE3, 0x02, 0x85, 0x6E, 0xE5, 0xC0, 0x4B, 0xAF,
+  0xE1, 0x81, 0x72, 0xE3, 0xC0, 0x31, 0xA6, 0x63, 0xE9, 0x40, 0x42, 0x0A, 0xA9, 0x9C, 0xE1, 0x69,
+  0x02, 0x85, 0x62, 0xEF, 0xC0, 0x43, 0xB9, 0xAE, 0x09, 0x04, 0x04, 0x40, 0x49, 0x14, 0x2B, 0x23,
+  0x9E, 0xF6, 0xC0, 0x54, 0x3A, 0xE7, 0xC0, 0x54, 0x66, 0xE2, 0xC0, 0x54, 0x00, 0x37, 0x36, 0x69,
+  0x34, 0x6F, 0x72, 0x66, 0x79, 0x2D, 0x2D, 0xEE, 0xC0, 0x55, 0x67, 0xEE, 0x1D, 0x0A, 0x1C, 0x20,
+  0x66, 0x20, 0x40, 0x1C, 0x14, 0x10, 0x20, 0x76, 0x0F, 0x0C, 0x20, 0xB6, 0x10, 0x20, 0x21, 0x20,
+  0x43, 0x0F, 0x20, 0xE9, 0x10, 0x20, 0x4D, 0xA7, 0x0F, 0x77, 0xEF, 0x04, 0xC0, 0x50, 0xFC, 0xF4,
+  0x69, 0xAA, 0x37, 0xF6, 0x69, 0x81, 0xAE, 0x11, 0x40, 0x3F, 0x1E, 0x2C, 0x6C, 0x22, 0x3A, 0x24,
+  0x60, 0x20, 0x39, 0x21, 0x83, 0x06, 0x1E, 0x8C, 0xF4, 0x40, 0x52, 0x9B, 0x21, 0x53, 0x8D, 0xF5,
+  0x08, 0x08, 0x05, 0x40, 0x52, 0xCB, 0xA0, 0xC1, 0xF8, 0x81, 0xE1, 0x81, 0xED, 0xC0, 0x50, 0xA9,
+  0x73, 0xF4, 0xC0, 0x50, 0xE9, 0xF2, 0x69, 0x81, 0xAE, 0x08, 0x0B, 0x09, 0x09, 0x0B, 0x03, 0x0F,
+  0x86, 0x74, 0x6E, 0x65, 0x6D, 0x70, 0x6F, 0x6C, 0xE5, 0xC0, 0x49, 0x2C, 0xF3, 0x04, 0xC0, 0x52,
+  0xF5, 0xF2, 0xC0, 0x37, 0xF3, 0x72, 0x65, 0x74, 0x72, 0x6F, 0xF0, 0xC0, 0x53, 0x5D, 0x6E, 0x6F,
+  0x69, 0x74, 0x61, 0x72, 0x67, 0xE9, 0xC0, 0x48, 0x0D, 0xEC, 0xA3, 0xA4, 0xE5, 0x02, 0x88, 0x73,
+  0x61, 0x62, 0x61, 0x74, 0x61, 0xE4, 0x62, 0x64, 0x6F, 0xE3, 0x62, 0x64, 0x6C, 0x69, 0x75, 0xE2,
+  0x62, 0xE2, 0xC0, 0x48, 0x1E, 0xF4, 0x69, 0x04, 0xC0, 0x53, 0x9B, 0xAE, 0x0E, 0x06, 0x06, 0x0B,
+  0x05, 0x40, 0x34, 0x19, 0x36, 0xD8, 0x28, 0x51, 0xA0, 0x30, 0xF4, 0x40, 0x51, 0xA5, 0xA1, 0xD4,
+  0xEF, 0x40, 0x48, 0x1E, 0xA9, 0xF3, 0xED, 0x04, 0xC0, 0x2F, 0x0B, 0x6F, 0xE3, 0x69, 0xC0, 0x3D,
+  0x19, 0x6C, 0xF4, 0xC0, 0x52, 0x01, 0xE4, 0x04, 0xC0, 0x51, 0xF9, 0x75, 0x6F, 0x6C, 0x63, 0x65,
+  0x67, 0xEE, 0xC0, 0x40, 0x9C, 0xF3, 0x69, 0x81, 0xAE, 0x08, 0x06, 0x06, 0x40, 0x53, 0x21, 0x1E,
+  0x8C, 0xF6, 0x40, 0x2E, 0x91, 0xA2, 0x4F, 0xF4, 0x40, 0x4D, 0x20, 0xA6, 0x0F, 0xEF, 0xC0, 0x47,
+  0xE1, 0xF2, 0x02, 0x88, 0x6F, 0xF0, 0x69, 0x81, 0x2E, 0xE5, 0xB1, 0x4D, 0xE5, 0x04, 0xC0, 0x53,
+  0x2F, 0xF9, 0xC0, 0x52, 0x9A, 0xF0, 0x69, 0x04, 0xC0, 0x4F, 0xC3, 0xAE, 0x40, 0x51, 0x6F, 0x21,
+  0x8D, 0x06, 0x20, 0x20, 0x8A, 0xEF, 0x0F, 0x06, 0x06, 0x0E, 0x06, 0x04, 0x2D, 0x39, 0x29, 0x99,
+  0x33, 0x2E, 0xC0, 0x24, 0x86, 0xFA, 0x81, 0xE1, 0xC0, 0x52, 0x5C, 0xF4, 0x40, 0x29, 0xF1, 0xA8,
+  0x49, 0xF3, 0x06, 0x23, 0xB6, 0xC0, 0x37, 0x0C, 0x73, 0xE3, 0x81, 0xE9, 0xC0, 0x2F, 0x37, 0xF0,
+  0x40, 0x35, 0x6A, 0xBD, 0x37, 0xED, 0xC0, 0x41, 0x02, 0xE9, 0x05, 0x20, 0x24, 0x0A, 0x89, 0xF4,
+  0x02, 0x93, 0xE3, 0x02, 0x8B, 0xF5, 0x04, 0xC0, 0x52, 0xEB, 0x72, 0x74, 0xF3, 0xC0, 0x3D, 0x47,
+  0x65, 0xF4, 0xC0, 0x3B, 0x8E, 0xE1, 0x05, 0x29, 0x94, 0xB6, 0x16, 0x63, 0x75, 0x64, 0xE5, 0x69,
+  0xC0, 0x44, 0x61, 0x73, 0x69, 0xF6, 0x69, 0x81, 0x6F, 0xF2, 0xC0, 0x45, 0xA9, 0xEE, 0x04, 0xC0,
+  0x52, 0xBA, 0xF5, 0xC0, 0x47, 0xD5, 0x68, 0xF3, 0xC0, 0x4A, 0xC6, 0xED, 0x69, 0x81, 0xAE, 0x07,
+  0x40, 0x52, 0x72, 0x06, 0xA0, 0x2A, 0xE3, 0xC0, 0x49, 0x4B, 0xEB, 0x69, 0x81, 0xAE, 0x40, 0x50,
+  0xDD, 0x21, 0x8D, 0x06, 0xA0, 0x2A, 0xE9, 0x69, 0x11, 0x0A, 0x29, 0x81, 0x27, 0x73, 0x40, 0x2C,
+  0xA6, 0x32, 0xCF, 0x20, 0xAE, 0x21, 0x00, 0xA1, 0x75, 0x65, 0x6C, 0x6B, 0x6E, 0x69, 0x76, 0xEC,
+  0xC0, 0x50, 0x96, 0xAE, 0x1D, 0x18, 0x13, 0x0C, 0x07, 0x0A, 0x06, 0x07, 0x06, 0x09, 0x09, 0x40,
+  0x2A, 0x7A, 0x22, 0x76, 0x39, 0x89, 0x25, 0x25, 0x03, 0x21, 0x2F, 0x23, 0x38, 0x21, 0x41, 0xA0,
+  0x77, 0xF4, 0x09, 0x06, 0x39, 0xE9, 0x40, 0x36, 0xEA, 0xA1, 0x53, 0x65, 0xEE, 0x69, 0xC0, 0x41,
+  0x7A, 0x61, 0x72, 0xE1, 0x81, 0xEA, 0xC0, 0x40, 0xB4, 0xF3, 0x0A, 0x40, 0x50, 0x2A, 0x20, 0x6A,
+  0x20, 0x5D, 0xA1, 0x3B, 0x73, 0x65, 0x6E, 0x69, 0xF3, 0xC0, 0x47, 0xA1, 0xF2, 0x06, 0x40, 0x50,
+  0x21, 0xA1, 0xDE, 0x61, 0xE8, 0xC0, 0x4D, 0x59, 0xF0, 0x40, 0x28, 0xC5, 0xC0, 0x27, 0x50, 0xEF,
+  0x40, 0x50, 0xA2, 0x20, 0x6E, 0x20, 0x51, 0xA0, 0xAF, 0xEE, 0x40, 0x51, 0x14, 0xA0, 0xF2, 0xED,
+  0x40, 0x40, 0xE5, 0x31, 0x19, 0x97, 0xEC, 0x40, 0x43, 0x5C, 0xAE, 0xA1, 0xE9, 0x04, 0xC0, 0x52,
+  0x04, 0xE8, 0xC0, 0x4E, 0xDC, 0xE7, 0x40, 0x38, 0x86, 0x02, 0x39, 0x0C, 0xA0, 0x60, 0xE5, 0x04,
+  0xC0, 0x51, 0xE3, 0xF3, 0x81, 0x61, 0x62, 0x61, 0xF0, 0xC0, 0x4D, 0x30, 0xE8, 0x69, 0x81, 0xAE,
+  0x40, 0x4F, 0x97, 0x20, 0x5C, 0x20, 0x28, 0x21, 0x93, 0x1E, 0x06, 0x86, 0xE7, 0x69, 0x02, 0x93,
+  0x69, 0xF3, 0x02, 0x84, 0xE9, 0xC0, 0x36, 0xDD, 0x65, 0xE4, 0x69, 0x81, 0x2E, 0xF3, 0x81, 0xF3,
+  0xC0, 0x51, 0xA2, 0xAE, 0x40, 0x4F, 0xF7, 0x0A, 0x21, 0x83, 0x06, 0x1E, 0x8C, 0xE5, 0x0F, 0x05,
+  0x04, 0x0D, 0x07, 0x08, 0x05, 0x04, 0x40, 0x3A, 0xD3, 0x32, 0x95, 0xA4, 0x03, 0x73, 0xE9, 0xC0,
+  0x4F, 0xF9, 0xF2, 0x69, 0xA8, 0xEF, 0xE9, 0x04, 0xC0, 0x4F, 0x81, 0x6C, 0x69, 0x62, 0x6F, 0xED,
+  0xC0, 0x4B, 0x19, 0x68, 0xE3, 0x81, 0xF4, 0xC0, 0x4E, 0x15, 0x67, 0x61, 0x77, 0x73, 0xEB, 0xC0,
+  0x4D, 0x52, 0x66, 0xF5, 0xC0, 0x37, 0x84, 0xE5, 0xC0, 0x4C, 0x2E, 0x64, 0xF2, 0xC0, 0x49, 0x4D,
+  0xE4, 0x02, 0x84, 0xEB, 0xC0, 0x51, 0x71, 0xE7, 0x69, 0x81, 0x2E, 0x79, 0xF0, 0xA0, 0x95, 0xE3,
+  0x69, 0x04, 0xC0, 0x51, 0x3D, 0xAE, 0x1E, 0x06, 0x09, 0x18, 0x0C, 0x04, 0x08, 0x20, 0x41, 0x08,
+  0x04, 0x0C, 0x07, 0x07, 0x06, 0x14, 0x40, 0x31, 0x2B, 0x2A, 0x5D, 0x22, 0x5B, 0x2A, 0x8E, 0x27,
+  0x19, 0x20, 0xBA, 0x86, 0xFA, 0x40, 0x51, 0x07, 0xA1, 0x43, 0xF8, 0x40, 0x4C, 0x3D, 0x24, 0x8B,
+  0x20, 0x39, 0x9A, 0xF4, 0x04, 0xC0, 0x51, 0x0C, 0x63, 0x65, 0x6E, 0x6E, 0x6F, 0x63, 0x6B, 0x63,
+  0x69, 0x75, 0x71, 0x2E, 0x74, 0x63, 0x65, 0xF2, 0xC0, 0x45, 0x23, 0xF3, 0x06, 0x40, 0x4C, 0x16,
+  0xA4, 0xC4, 0x70, 0x70, 0xE1, 0xB4, 0xE2, 0xF1, 0xC0, 0x50, 0xF8, 0xEE, 0x40, 0x50, 0x0D, 0x0D,
+  0x20, 0x7B, 0x82, 0xED, 0x04, 0xC0, 0x50, 0xDE, 0x6F, 0xE3, 0x69, 0x81, 0x2E, 0x73, 0x77, 0x61,
+  0x6E, 0x6F, 0x7A, 0x61, 0x6D, 0x61, 0xAE, 0x05, 0x1A, 0xC0, 0x3A, 0x88, 0xE2, 0x03, 0xB2, 0xD4,
+  0x65, 0x2E, 0x31, 0xAD, 0x02, 0x85, 0x74, 0x73, 0x65, 0xF7, 0x81, 0x68, 0x74, 0x72, 0x6F, 0x6E,
+  0xAD, 0x81, 0xEE, 0xC0, 0x50, 0xBD, 0x31, 0x2D, 0x68, 0x74, 0x72, 0x6F, 0x6E, 0x2D, 0x6E, 0x63,
+  0xAE, 0xC0, 0x44, 0x23, 0xEC, 0x40, 0x4B, 0xC3, 0x24, 0x0E, 0xA0, 0xDE, 0xEB, 0xC0, 0x4F, 0xC9,
+  0xEA, 0x40, 0x4D, 0xF3, 0x21, 0x8C, 0x21, 0x12, 0x20, 0x21, 0xA1, 0x0C, 0xE9, 0x40, 0x2E, 0x9A,
+  0xC0, 0x21, 0x1F, 0xE8, 0x40, 0x50, 0x2F, 0x0E, 0xA0, 0x64, 0xE7, 0x40, 0x37, 0xA0, 0xB8, 0xEF,
+  0xE4, 0x08, 0x40, 0x46, 0xD8, 0x29, 0x42, 0xA0, 0x39, 0x75, 0x6F, 0x6C, 0x63, 0x74, 0x6E, 0x61,
+  0xF4, 0xC0, 0x48, 0x6A, 0xE2, 0xC0, 0x4F, 0x91, 0xE2, 0x69, 0x04, 0xC0, 0x50, 0x62, 0xAE, 0x40,
+  0x4E, 0xAC, 0x21, 0x8D, 0x06, 0x1E, 0x02, 0x8A, 0xE1, 0x10, 0x06, 0x04, 0x0C, 0x04, 0x08, 0x06,
+  0x07, 0x0A, 0x40, 0x3F, 0xE2, 0x2F, 0x0C, 0xA1, 0x26, 0x79, 0x61, 0xEC, 0xC0, 0x50, 0x50, 0x76,
+  0xE1, 0xB3, 0xA5, 0xF5, 0x02, 0x84, 0xF1, 0xC0, 0x45, 0xCA, 0x68, 0xE9, 0xC0, 0x51, 0x53, 0xF3,
+  0xC0, 0x4A, 0xEC, 0x69, 0x64, 0xF2, 0x81, 0xE1, 0xC0, 0x3E, 0xA2, 0x68, 0x6B, 0xE1, 0xC0, 0x4B,
+  0x0D, 0x67, 0x72, 0x6F, 0xED, 0xC0, 0x45, 0x87, 0x63, 0x69, 0x6C, 0x62, 0xF5, 0x81, 0xF0, 0xC0,
+  0x4E, 0x79, 0xE2, 0xA8, 0x6A, 0x33, 0x31, 0x35, 0x72, 0x6D, 0x69, 0x2D, 0x2D, 0xEE, 0xC0, 0x51,
+  0x21, 0xED, 0x1F, 0x13, 0x2F, 0x1A, 0x10, 0x0C, 0x09, 0x2E, 0xDF, 0x0C, 0x20, 0x4B, 0x02, 0x20,
+  0x30, 0x0F, 0x13, 0x05, 0x0C, 0x07, 0x20, 0x5D, 0x0C, 0x37, 0x91, 0x2D, 0x44, 0x2A, 0xD3, 0xA0,
+  0x7D, 0xFA, 0x69, 0x81, 0xAE, 0x40, 0x49, 0x97, 0x08, 0x24, 0x4F, 0x20, 0x38, 0x0A, 0x21, 0x83,
+  0x06, 0x1E, 0x06, 0x86, 0xF5, 0x04, 0xC0, 0x45, 0x8D, 0x65, 0x73, 0x75, 0xED, 0x69, 0x81, 0xAE,
+  0x20, 0x27, 0x1C, 0x21, 0x57, 0x16, 0x0F, 0x1F, 0x20, 0xD5, 0x21, 0xAC, 0x20, 0x8C, 0x05, 0x06,
+  0x20, 0x93, 0x22, 0x34, 0x20, 0x6C, 0x20, 0xC3, 0x20, 0x6A, 0x20, 0x3F, 0x20, 0x55, 0x20, 0xA9,
+  0x0D, 0x21, 0xF0, 0x20, 0x8C, 0xA0, 0x5E, 0xFA, 0x09, 0x05, 0x07, 0x40, 0x21, 0xB4, 0xC0, 0x22,
+  0x30, 0x75, 0x72, 0xE3, 0xAD, 0x82, 0x6F, 0x6A, 0x61, 0xE4, 0xC0, 0x4E, 0xF2, 0x69, 0x65, 0xF7,
+  0xC0, 0x4D, 0x93, 0xF9, 0x14, 0x20, 0x20, 0x0A, 0x20, 0x68, 0x06, 0x11, 0x0A, 0x0B, 0x20, 0x2B,
+  0x20, 0x42, 0x3C, 0xBA, 0x3F, 0x83, 0xA1, 0x21, 0xF4, 0x03, 0x04, 0x8B, 0xEE, 0xC0, 0x31, 0xDD,
+  0xE9, 0x04, 0xC0, 0x3F, 0x40, 0x73, 0x72, 0xE5, 0xC0, 0x2A, 0x99, 0x65, 0x69, 0x63, 0x6F, 0xF3,
+  0x69, 0x81, 0x6C, 0x61, 0x63, 0xE9, 0xAB, 0xDD, 0x73, 0x70, 0x65, 0x6C, 0xE9, 0x81, 0xF0, 0xC0,
+  0x4F, 0x23, 0xF2, 0x07, 0x08, 0x20, 0x2A, 0x08, 0x04, 0x99, 0x74, 0x73, 0x75, 0x64, 0x6E, 0xE9,
+  0xA0, 0x27, 0x6F, 0x74, 0x73, 0x69, 0xE8, 0x69, 0x09, 0x05, 0x07, 0x0A, 0x25, 0x59, 0xC0, 0x3D,
+  0xC4, 0x72, 0x65, 0xF4, 0xA3, 0xF3, 0x6C, 0xE1, 0x40, 0x39, 0x68, 0xA2, 0x76, 0x67, 0x6E, 0x69,
+  0x76, 0x69, 0xEC, 0x69, 0xC0, 0x43, 0x20, 0x64, 0x6E, 0xE1, 0xA5, 0x56, 0x6E, 0x6F, 0x73, 0x61,
+  0xED, 0xC0, 0x31, 0xF0, 0x6C, 0xE5, 0xA8, 0xF4, 0xE5, 0x03, 0x04, 0x88, 0x76, 0xEF, 0xBE, 0x26,
+  0x6C, 0x6C, 0x61, 0xE7, 0x69, 0xC0, 0x37, 0xD0, 0x64, 0x69, 0x6F, 0xF2, 0x81, 0xE2, 0xC0, 0x29,
+  0x8A, 0xE1, 0x03, 0xA1, 0x61, 0x74, 0xE9, 0xC0, 0x4E, 0xDB, 0xEE, 0x27, 0xE5, 0xC0, 0x3D, 0xA2,
+  0xED, 0x02, 0x88, 0x6F, 0x6E, 0x6F, 0x72, 0xF4, 0xC0, 0x4D, 0xE3, 0x65, 0x64, 0xE1, 0xC0, 0x4D,
+  0x17, 0xEC, 0x04, 0xC0, 0x31, 0x3D, 0x65, 0x74, 0xE1, 0xAD, 0x9B, 0x68, 0x70, 0x61, 0x72, 0x67,
+  0x6F, 0x74, 0xEF, 0xC0, 0x3A, 0x2A, 0x67, 0x6F, 0x6C, 0xEF, 0x09, 0x09, 0x0A, 0x05, 0x27, 0xA1,
+  0xC0, 0x30, 0xC5, 0x70, 0xEF, 0x04, 0xC0, 0x4E, 0xAA, 0xF2, 0xA3, 0xE5, 0x6E, 0xE8, 0x04, 0xC0,
+  0x3C, 0x45, 0xF4, 0xC0, 0x4E, 0x6F, 0x6D, 0xEF, 0xC0, 0x2D, 0x50, 0xE5, 0x27, 0xAA, 0xC0, 0x46,
+  0xB6, 0xE5, 0x05, 0x0E, 0x04, 0x09, 0x9C, 0xF3, 0x02, 0x85, 0x72, 0x65, 0xEA, 0xAA, 0x0C, 0x6E,
+  0x72, 0xE5, 0xC0, 0x3C, 0xE8, 0xF2, 0xC0, 0x36, 0x03, 0xEE, 0x04, 0xC0, 0x4D, 0x80, 0xE4, 0xC0,
+  0x3E, 0x6F, 0xEC, 0x02, 0x95, 0xEC, 0x02, 0x84, 0xEF, 0xC0, 0x41, 0x58, 0x61, 0xF6, 0x69, 0x81,
+  0x65, 0x6E, 0x69, 0x77, 0x79, 0x64, 0xEE, 0xC0, 0x3B, 0x34, 0x65, 0xEB, 0xA5, 0x5A, 0x68, 0xF3,
+  0xC0, 0x43, 0xBA, 0xE1, 0x02, 0x89, 0xF7, 0x03, 0xAB, 0x7D, 0x65, 0xF4, 0xC0, 0x46, 0x1E, 0x62,
+  0x65, 0x6B, 0x61, 0x65, 0x70, 0x61, 0xF3, 0xC0, 0x4A, 0x8F, 0xF8, 0x05, 0x04, 0x07, 0xA4, 0xF9,
+  0xF4, 0xC0, 0x4B, 0x55, 0x69, 0x6E, 0x65, 0xEF, 0xC0, 0x39, 0x95, 0x65, 0xF3, 0xC0, 0x41, 0xD7,
+  0xF7, 0x02, 0x84, 0xF2, 0xC0, 0x4E, 0x02, 0xEF, 0x81, 0xE3, 0x81, 0xF3, 0xC0, 0x4D, 0x22, 0xF5,
+  0x02, 0x86, 0xF2, 0x81, 0xED, 0xC0, 0x37, 0x58, 0xE1, 0x02, 0x8E, 0x65, 0x74, 0x61, 0x6C, 0x70,
+  0x6F, 0x64, 0x61, 0x72, 0x6F, 0xEC, 0xC0, 0x4D, 0xE8, 0xE2, 0x81, 0xE7, 0xA4, 0xFA, 0xF4, 0x0B,
+  0x20, 0x37, 0x20, 0x51, 0x05, 0x17, 0x08, 0x0C, 0x04, 0x86, 0xF3, 0x08, 0x10, 0x07, 0x08, 0x28,
+  0x4C, 0xA1, 0xBF, 0xF2, 0x02, 0x85, 0x75, 0x68, 0xEC, 0xAA, 0xD9, 0x6F, 0x68, 0x6E, 0x65, 0xED,
+  0xC0, 0x4A, 0xAE, 0x69, 0x6C, 0x61, 0xF9, 0xC0, 0x3D, 0x8D, 0x65, 0x77, 0x68, 0x74, 0xF5, 0xC0,
+  0x39, 0xEB, 0xE1, 0x02, 0x84, 0x6F, 0xE3, 0xAC, 0xBF, 0x63, 0x64, 0xE1, 0x81, 0xEF, 0xC0, 0x3A,
+  0x8F, 0xF2, 0x03, 0x08, 0x89, 0x75, 0x66, 0x6B, 0x6E, 0xE1, 0xC0, 0x4C, 0x74, 0x6F, 0xF0, 0x29,
+  0x2A, 0x40, 0x23, 0xA6, 0xAE, 0xCB, 0xE1, 0x69, 0x0A, 0x0D, 0x06, 0x09, 0x05, 0x06, 0x04, 0xC0,
+  0x3B, 0x31, 0x79, 0x72, 0xE1, 0x81, 0x72, 0x6F, 0x70, 0x6D, 0x65, 0xF4, 0xC0, 0x37, 0xE8, 0x74,
+  0x61, 0xED, 0xC0, 0x4C, 0x89, 0xEE, 0x03, 0xA1, 0x69, 0x6F, 0x6F, 0xF4, 0xB0, 0xCA, 0x68, 0x73,
+  0xE9, 0xA7, 0x59, 0x67, 0x74, 0xF4, 0xC0, 0x31, 0x9E, 0xE5, 0xC0, 0x44, 0xDD, 0x64, 0xF2, 0xC0,
+  0x48, 0x8F, 0x6F, 0xF0, 0xC0, 0x4A, 0x3C, 0x6E, 0xE5, 0x02, 0x84, 0xF6, 0xC0, 0x37, 0xB8, 0xED,
+  0x04, 0x07, 0xA3, 0xB1, 0x70, 0x69, 0x75, 0x71, 0xE5, 0xAA, 0x87, 0xE5, 0xA0, 0x9A, 0x69, 0x6F,
+  0xF2, 0x81, 0xF4, 0xC0, 0x4A, 0x1D, 0xE5, 0x03, 0xBB, 0x74, 0x6B, 0x72, 0x61, 0x6D, 0x6E, 0xE1,
+  0xAB, 0x37, 0xE4, 0xC0, 0x4C, 0x48, 0x63, 0x65, 0xEA, 0xC0, 0x35, 0xD7, 0x61, 0x67, 0x69, 0x6C,
+  0xEC, 0xA5, 0xF4, 0xF3, 0x10, 0x10, 0x20, 0x38, 0x0A, 0x1C, 0x20, 0x30, 0x09, 0x0C, 0x1D, 0x06,
+  0x0A, 0x20, 0x9F, 0x8D, 0xF5, 0x02, 0x84, 0xE3, 0xC0, 0x3A, 0x33, 0xE2, 0x69, 0x81, 0x6D, 0x75,
+  0xEC, 0xC0, 0x4C, 0xED, 0xF4, 0x06, 0x20, 0x20, 0x05, 0xA4, 0xDF, 0x72, 0xE1, 0x69, 0x05, 0x06,
+  0xC0, 0x40, 0xEB, 0xF8, 0x81, 0x75, 0xE1, 0xBF, 0x89, 0xE5, 0x04, 0xC0, 0x44, 0x59, 0x76, 0x69,
+  0x74, 0x61, 0x72, 0x6F, 0x63, 0x65, 0xE4, 0x69, 0xC0, 0x40, 0xDC, 0x6F, 0xEC, 0xC0, 0x47, 0x65,
+  0x66, 0x61, 0x72, 0xE3, 0x69, 0x81, 0x64, 0x6E, 0xE1, 0xC0, 0x35, 0x9A, 0xF3, 0x04, 0xC0, 0x4B,
+  0x01, 0x61, 0xEC, 0xC0, 0x4C, 0x89, 0x72, 0xE5, 0x08, 0x06, 0x07, 0x29, 0xE3, 0xC0, 0x2C, 0x57,
+  0x74, 0x6E, 0x65, 0xE3, 0xA2, 0xEC, 0x6C, 0xF4, 0x81, 0xF4, 0xC0, 0x48, 0x9D, 0x64, 0xEE, 0xC0,
+  0x42, 0x49, 0xEE, 0x05, 0x20, 0x20, 0xA4, 0x13, 0x6F, 0xE9, 0x02, 0x99, 0x74, 0x61, 0x63, 0x69,
+  0x6E, 0x75, 0x6D, 0x6D, 0x6F, 0xE3, 0x69, 0x81, 0x65, 0x6C, 0x65, 0x74, 0x2D, 0x64, 0x6E, 0x61,
+  0x2D, 0x73, 0xF4, 0xB4, 0x17, 0xF3, 0xA3, 0x4E, 0xE1, 0x04, 0xC0, 0x4B, 0x7C, 0x62, 0xEC, 0xC0,
+  0x4B, 0x8C, 0x6D, 0x72, 0x61, 0x65, 0x72, 0x69, 0xE6, 0xA8, 0x93, 0xEC, 0x02, 0x84, 0xEC, 0xC0,
+  0x48, 0x98, 0xE5, 0x81, 0xF3, 0xA5, 0x15, 0xE9, 0x06, 0x04, 0x0A, 0xC0, 0x36, 0x9A, 0xF8, 0xC0,
+  0x4C, 0x56, 0x75, 0x6F, 0x6C, 0x74, 0xEE, 0x81, 0xE9, 0xC0, 0x49, 0x6D, 0x6C, 0x6F, 0x70, 0x61,
+  0x6E, 0xE1, 0xAA, 0x45, 0xE8, 0x81, 0xF4, 0xC0, 0x4B, 0x95, 0x67, 0x6E, 0x69, 0x72, 0x70, 0xF3,
+  0x81, 0xED, 0xA1, 0xAF, 0xE5, 0x0A, 0x1B, 0x08, 0x0E, 0x20, 0x26, 0x0B, 0x20, 0x24, 0x85, 0xF5,
+  0x04, 0xC0, 0x4C, 0x00, 0xF1, 0x02, 0x8E, 0x69, 0x74, 0x6E, 0xE1, 0x69, 0x04, 0xC0, 0x40, 0x14,
+  0xEE, 0x81, 0xE1, 0xAA, 0x17, 0x61, 0xE4, 0xC0, 0x4A, 0x1F, 0x73, 0x75, 0x6F, 0x68, 0x63, 0xE9,
+  0xA8, 0x83, 0xF2, 0x03, 0xA7, 0xDC, 0xE5, 0x04, 0xC0, 0x49, 0xA9, 0x75, 0xE7, 0xC0, 0x43, 0x6C,
+  0xEC, 0x05, 0x18, 0xC0, 0x31, 0x6A, 0xEC, 0x02, 0x85, 0x69, 0xE1, 0xC0, 0x30, 0xF5, 0xE5, 0x02,
+  0x85, 0x78, 0xF5, 0xC0, 0x38, 0xBA, 0x72, 0x75, 0x74, 0x61, 0x6E, 0xF3, 0xA2, 0x14, 0x65, 0x67,
+  0x6E, 0x61, 0xF3, 0xC0, 0x3B, 0x91, 0x69, 0x74, 0x69, 0x6E, 0x61, 0xED, 0x81, 0xF5, 0xC0, 0x4A,
+  0xD8, 0x68, 0x63, 0x73, 0xE9, 0x03, 0x06, 0x93, 0x73, 0x65, 0xEC, 0xC0, 0x49, 0xB8, 0x72, 0x6F,
+  0x74, 0x73, 0x69, 0xE8, 0x69, 0x04, 0xC0, 0x35, 0xE7, 0x6E, 0x69, 0xFA, 0x81, 0xE9, 0xC0, 0x48,
+  0xB1, 0x64, 0xE5, 0xAA, 0xAD, 0x64, 0xEE, 0xC0, 0x4A, 0x6E, 0x63, 0x6E, 0x65, 0x69, 0x63, 0xF3,
+  0x69, 0xA3, 0xAF, 0x64, 0xE9, 0x04, 0xC0, 0x48, 0x15, 0x70, 0x61, 0x72, 0x64, 0xEE, 0xBD, 0xA3,
+  0xE1, 0x03, 0xA7, 0x66, 0xEC, 0x04, 0xC0, 0x4B, 0x43, 0xEC, 0x40, 0x36, 0x82, 0xB1, 0xDF, 0xF2,
+  0x09, 0x12, 0x06, 0x06, 0x20, 0x59, 0xC0, 0x3A, 0x30, 0xF5, 0x03, 0x07, 0x87, 0x74, 0x61, 0xEB,
+  0x81, 0xE9, 0xBB, 0x96, 0x61, 0x73, 0x6F, 0xEE, 0xC0, 0x3F, 0x63, 0xEF, 0x81, 0xE2, 0xC0, 0x4A,
+  0x27, 0x69, 0xE1, 0x69, 0xC0, 0x34, 0xA7, 0xE5, 0x07, 0x20, 0x2C, 0x06, 0x0B, 0x0A, 0x84, 0xF4,
+  0x07, 0x04, 0x0C, 0x10, 0xC0, 0x35, 0xE6, 0xF5, 0xC0, 0x36, 0x38, 0xF3, 0x03, 0xA2, 0xAA, 0x65,
+  0x68, 0xE3, 0x22, 0x02, 0xC0, 0x44, 0xED, 0x6E, 0x65, 0xE3, 0x69, 0x08, 0x21, 0x5D, 0x24, 0x7B,
+  0xC0, 0x2E, 0x1A, 0x6C, 0xE1, 0xA3, 0xF3, 0xE5, 0xC0, 0x40, 0xFB, 0x70, 0x61, 0x70, 0xF3, 0xA6,
+  0x9A, 0x6E, 0x61, 0x6B, 0x73, 0x69, 0x7A, 0x6E, 0xE1, 0xC0, 0x49, 0xD5, 0x6C, 0x6C, 0x69, 0x6D,
+  0x73, 0x69, 0xF7, 0xC0, 0x41, 0xD6, 0x69, 0xF2, 0xAE, 0x4E, 0xE2, 0x40, 0x34, 0x42, 0xB5, 0xF7,
+  0x61, 0xF7, 0x69, 0x03, 0xA1, 0x67, 0x64, 0xEC, 0xC0, 0x4A, 0xD6, 0x71, 0xE1, 0xC0, 0x48, 0x4F,
+  0x70, 0x6F, 0x68, 0xF3, 0xB5, 0x4C, 0xEF, 0x0A, 0x13, 0x07, 0x05, 0x09, 0x15, 0x11, 0x06, 0x19,
+  0x86, 0xF2, 0x02, 0x8B, 0x69, 0x65, 0x6E, 0x61, 0x6A, 0x65, 0x64, 0xEF, 0xC0, 0x47, 0x35, 0x68,
+  0xF4, 0xC0, 0x40, 0x40, 0x6E, 0xE9, 0x81, 0xF2, 0xC0, 0x4A, 0x6D, 0x6D, 0x69, 0xF4, 0xA6, 0x7C,
+  0x6C, 0x6C, 0x65, 0x63, 0x69, 0xF4, 0xC0, 0x29, 0x39, 0xE9, 0x03, 0x06, 0x85, 0x72, 0x61, 0xF4,
+  0xC0, 0x4A, 0x28, 0x64, 0xE9, 0xC0, 0x48, 0xDB, 0x63, 0x61, 0xE4, 0xC0, 0x3D, 0xF6, 0xE7, 0x02,
+  0x85, 0x65, 0xE9, 0xC0, 0x24, 0x46, 0xE1, 0x04, 0xC0, 0x49, 0x15, 0xE3, 0xC0, 0x28, 0x57, 0xE5,
+  0x81, 0xEC, 0xC0, 0x41, 0xAC, 0xE3, 0x03, 0x0A, 0x86, 0x73, 0x69, 0x63, 0x6E, 0x61, 0x72, 0xE6,
+  0xC0, 0x27, 0x5C, 0x69, 0x78, 0x65, 0xED, 0xA5, 0xF2, 0x65, 0xE4, 0xC0, 0x33, 0x3A, 0x61, 0x62,
+  0xEC, 0xC0, 0x45, 0x8D, 0x32, 0x61, 0x36, 0x76, 0x2D, 0x73, 0x65, 0x61, 0x63, 0x69, 0x6E, 0x75,
+  0x6D, 0x6F, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0x4B, 0x59, 0xEE, 0x0F, 0x08, 0x20, 0x21, 0x20, 0xF5,
+  0x0D, 0x0C, 0x09, 0x15, 0x14, 0x20, 0x7F, 0xB2, 0xD3, 0x76, 0x61, 0x68, 0x6E, 0x65, 0xE2, 0xA1,
+  0x2D, 0xF2, 0x02, 0x89, 0x6F, 0x62, 0x72, 0xE5, 0x81, 0xE4, 0xC0, 0x41, 0x54, 0xE5, 0x08, 0x04,
+  0x04, 0x21, 0x83, 0xC0, 0x48, 0x71, 0xFA, 0xC0, 0x46, 0x57, 0xF5, 0xC0, 0x49, 0x71, 0xE4, 0xC0,
+  0x49, 0x1F, 0xEF, 0x0A, 0x0F, 0x1C, 0x22, 0x82, 0x3E, 0x5F, 0xC0, 0x26, 0x63, 0xF4, 0x06, 0x40,
+  0x29, 0x22, 0xA9, 0xD7, 0x65, 0x72, 0xE2, 0x81, 0xE5, 0xC0, 0x35, 0x61, 0xF3, 0x04, 0x05, 0x07,
+  0x85, 0x73, 0xF2, 0xC0, 0x48, 0xC2, 0x72, 0x65, 0x66, 0xE6, 0xC0, 0x43, 0x46, 0x69, 0xED, 0xC0,
+  0x44, 0xE7, 0xE4, 0x81, 0xEE, 0xC0, 0x2A, 0x8A, 0xE9, 0x03, 0xA0, 0xA5, 0xF4, 0x03, 0x07, 0x90,
+  0x69, 0x62, 0x69, 0xE8, 0xC0, 0x3F, 0xAF, 0xE3, 0x04, 0xC0, 0x37, 0x72, 0x69, 0x66, 0xAD, 0x81,
+  0x65, 0x63, 0x6E, 0xE5, 0xC0, 0x2F, 0xEF, 0xE1, 0x0E, 0x04, 0x1A, 0x06, 0x09, 0x20, 0x20, 0x08,
+  0x0B, 0x09, 0x06, 0xC0, 0x3E, 0x58, 0x7A, 0xE9, 0xA0, 0x25, 0x76, 0x72, 0x65, 0xF3, 0x04, 0xC0,
+  0x47, 0xE0, 0x6E, 0x6F, 0x63, 0x6C, 0x61, 0x74, 0x6E, 0x65, 0xED, 0x81, 0x6E, 0x6F, 0x72, 0x69,
+  0xF6, 0xC0, 0x2E, 0xF2, 0xF4, 0x21, 0x9A, 0xC0, 0x47, 0x84, 0x73, 0xE9, 0x81, 0x6C, 0x69, 0xF6,
+  0xC0, 0x40, 0x9C, 0xF2, 0x03, 0x08, 0x86, 0x74, 0x73, 0x75, 0x6C, 0xEC, 0xC0, 0x48, 0x64, 0x6F,
+  0x70, 0xF2, 0xC0, 0x49, 0x5C, 0x62, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x73, 0x65, 0xF6, 0x81, 0xF2,
+  0xC0, 0x2A, 0x0F, 0x6E, 0x69, 0x73, 0x73, 0xE1, 0xC0, 0x40, 0x55, 0x6B, 0x69, 0x6E, 0x75, 0x6D,
+  0x6D, 0x6F, 0xEB, 0xC0, 0x2D, 0x49, 0xE9, 0x04, 0xC0, 0x48, 0x70, 0xE3, 0xC0, 0x40, 0x3F, 0x64,
+  0x6E, 0xF5, 0xC0, 0x3E, 0xF6, 0xE3, 0x04, 0xC0, 0x39, 0x09, 0x75, 0x64, 0xE5, 0x69, 0xC0, 0x32,
+  0x07, 0xF3, 0x02, 0x84, 0xEE, 0xC0, 0x3E, 0xA4, 0x69, 0xF6, 0x04, 0xC0, 0x2D, 0x1E, 0x64, 0x6E,
+  0x61, 0x64, 0x6E, 0xF5, 0xC0, 0x35, 0x46, 0xEE, 0x04, 0xC0, 0x48, 0x0F, 0x75, 0x72, 0x62, 0x6E,
+  0xE5, 0xC0, 0x47, 0x10, 0xEC, 0x02, 0x85, 0x6F, 0xE3, 0xC0, 0x3D, 0x58, 0xE5, 0xC0, 0x33, 0x8D,
+  0xE9, 0x03, 0xA7, 0x85, 0xEC, 0x81, 0xF2, 0xBB, 0x99, 0xE8, 0x02, 0x86, 0xEF, 0x81, 0xEA, 0xC0,
+  0x48, 0x0E, 0x61, 0xE2, 0x69, 0x81, 0x6E, 0x65, 0xF3, 0x81, 0xE9, 0xC0, 0x48, 0xB7, 0x67, 0x69,
+  0x73, 0x65, 0xE4, 0x69, 0x81, 0x64, 0xEE, 0x02, 0x85, 0x75, 0x74, 0xF3, 0xA3, 0x62, 0xE1, 0xC0,
+  0x31, 0xA6, 0xE5, 0x07, 0x06, 0x1C, 0x11, 0x09, 0x08, 0x89, 0x73, 0x73, 0xE5, 0xC0, 0x37, 0xC7,
+  0xF2, 0x04, 0x0E, 0xA0, 0x4B, 0x68, 0xF5, 0x69, 0x81, 0x64, 0x6E, 0x75, 0x74, 0x61, 0x6D, 0xE9,
+  0xC0, 0x33, 0xBC, 0x65, 0x64, 0x6E, 0x61, 0x61, 0xEC, 0xC0, 0x47, 0x41, 0x70, 0x70, 0x61, 0x68,
+  0x63, 0x73, 0x6E, 0x65, 0x74, 0x65, 0x77, 0x72, 0x75, 0xF5, 0xC0, 0x45, 0xB7, 0x6C, 0x61, 0xE6,
+  0x81, 0x74, 0xF3, 0xC0, 0x43, 0x6D, 0x68, 0xE3, 0x81, 0x6E, 0xE5, 0xC0, 0x3F, 0xA6, 0x67, 0x61,
+  0x68, 0x6E, 0x65, 0xF0, 0xC0, 0x48, 0x6A, 0xE4, 0x05, 0x1D, 0xC0, 0x2B, 0x15, 0x72, 0x61, 0xE7,
+  0x69, 0x03, 0x0F, 0x83, 0xF3, 0x04, 0xC0, 0x46, 0x55, 0xEE, 0x81, 0x65, 0xF2, 0x81, 0x64, 0xEC,
+  0xC0, 0x26, 0x33, 0x6C, 0xE1, 0x81, 0x63, 0xE9, 0xA1, 0x56, 0x61, 0x6C, 0x6F, 0xEB, 0xC0, 0x46,
+  0x53, 0xE1, 0x05, 0x0B, 0x08, 0x0C, 0x87, 0x77, 0x65, 0x68, 0x63, 0x74, 0x61, 0x6B, 0xF3, 0xC0,
+  0x45, 0x67, 0x6D, 0x66, 0x6F, 0x65, 0xEC, 0xC0, 0x38, 0xE0, 0xE9, 0x04, 0xC0, 0x20, 0xB9, 0x74,
+  0x70, 0x79, 0xE7, 0xC0, 0x47, 0xFF, 0x67, 0x69, 0x68, 0xE3, 0xC0, 0x48, 0x1A, 0xE3, 0x69, 0x81,
+  0x69, 0x72, 0x65, 0x6D, 0xE1, 0x69, 0x81, 0x65, 0x76, 0xE9, 0xC0, 0x45, 0x37, 0xED, 0x0B, 0x20,
+  0x2C, 0x0C, 0x08, 0x0B, 0x24, 0xFE, 0xC0, 0x2F, 0xA9, 0xF5, 0x03, 0x08, 0x8F, 0x74, 0x65, 0x72,
+  0x6F, 0xE2, 0xC0, 0x41, 0xC6, 0x69, 0x72, 0xE1, 0x04, 0xC0, 0x35, 0x04, 0x74, 0xE5, 0x81, 0x6E,
+  0xE1, 0xC0, 0x35, 0xD5, 0x65, 0x73, 0x75, 0x6D, 0x79, 0x72, 0x6F, 0x74, 0x73, 0x69, 0xE8, 0x81,
+  0x6C, 0xE1, 0xC0, 0x32, 0x1E, 0x73, 0xE9, 0x81, 0xEC, 0x81, 0x61, 0x6E, 0x72, 0xF5, 0xC0, 0x3B,
+  0x78, 0xEC, 0x36, 0x15, 0x40, 0x29, 0x32, 0xA6, 0x75, 0x65, 0x6C, 0x61, 0xF3, 0x69, 0x81, 0x75,
+  0xF2, 0xC0, 0x41, 0x1F, 0xE1, 0x05, 0x20, 0xEC, 0xB6, 0x00, 0xE8, 0x02, 0x85, 0x72, 0xF5, 0xC0,
+  0x45, 0xA5, 0x6E, 0x65, 0x74, 0xEC, 0xC0, 0x44, 0x00, 0xEC, 0x06, 0x0D, 0x20, 0x32, 0x10, 0x95,
+  0xEF, 0x06, 0x40, 0x44, 0xAB, 0xA0, 0xEF, 0x74, 0x73, 0xE9, 0xC0, 0x34, 0x73, 0xEC, 0x03, 0x0F,
+  0x8E, 0xE9, 0x04, 0xC0, 0x47, 0x6C, 0xED, 0x69, 0x81, 0xE4, 0x81, 0x6E, 0xE9, 0xC0, 0x45, 0x6F,
+  0xE5, 0x04, 0xC0, 0x46, 0x5A, 0x72, 0x64, 0xEE, 0x81, 0x65, 0xF6, 0xC0, 0x3B, 0x41, 0xE1, 0x02,
+  0x8A, 0x68, 0x73, 0x6E, 0x6F, 0xE5, 0x81, 0xE7, 0xC0, 0x2E, 0xF1, 0xE2, 0xC0, 0x3E, 0xEE, 0xE9,
+  0x04, 0xC0, 0x34, 0x35, 0x61, 0x72, 0x74, 0x6E, 0xEF, 0x81, 0x67, 0xE5, 0xC0, 0x47, 0x4E, 0xE5,
+  0x05, 0x0A, 0xC0, 0x36, 0xE1, 0xF3, 0x04, 0xC0, 0x46, 0xA2, 0x73, 0xF5, 0xC0, 0x34, 0x21, 0x6E,
+  0xF5, 0xC0, 0x34, 0x1C, 0xE1, 0x0C, 0x04, 0x03, 0x07, 0x0D, 0x03, 0x06, 0x40, 0x36, 0xAB, 0xB0,
+  0x4E, 0xF6, 0xC0, 0x45, 0x3E, 0xF4, 0xA4, 0x33, 0x72, 0x75, 0x74, 0xEC, 0xC0, 0x45, 0x85, 0x6E,
+  0x6F, 0x69, 0x74, 0xE1, 0x04, 0xC0, 0x46, 0xFE, 0xE3, 0xC0, 0x46, 0xE5, 0xE9, 0xBE, 0x39, 0x65,
+  0x72, 0xF4, 0xC0, 0x25, 0x9D, 0x63, 0xE9, 0x07, 0x07, 0x23, 0x7E, 0xC0, 0x40, 0x8C, 0xEE, 0x81,
+  0x61, 0xF4, 0xC0, 0x45, 0xF9, 0x67, 0x6F, 0x6C, 0xEF, 0x03, 0x04, 0x84, 0xEF, 0xC0, 0x44, 0x37,
+  0xED, 0xC0, 0x45, 0xED, 0xE5, 0x81, 0x61, 0x68, 0xE3, 0xC0, 0x40, 0xAF, 0xEB, 0x07, 0x16, 0x09,
+  0x0D, 0x09, 0x07, 0x84, 0xF2, 0x02, 0x85, 0x6F, 0xF9, 0x69, 0xA2, 0x5F, 0x61, 0xED, 0x03, 0xBD,
+  0xB6, 0x72, 0xE5, 0x81, 0xE9, 0x81, 0xE5, 0xC0, 0x45, 0xE6, 0x6F, 0x6F, 0x72, 0x62, 0x6E, 0xE1,
+  0xC0, 0x43, 0x8B, 0x6E, 0xE1, 0x04, 0xC0, 0x46, 0xBA, 0x72, 0x66, 0x65, 0xEE, 0xC0, 0x3C, 0x34,
+  0xEC, 0x04, 0xC0, 0x44, 0x78, 0x6F, 0xE6, 0xBD, 0x86, 0x69, 0x6E, 0x65, 0xE2, 0xC0, 0x44, 0x70,
+  0xE6, 0xC0, 0x41, 0xA7, 0xE3, 0x02, 0x97, 0x6F, 0x6C, 0xE3, 0x69, 0x02, 0x85, 0x64, 0x6E, 0x61,
+  0xE8, 0x88, 0x2D, 0x64, 0x6E, 0x61, 0x2D, 0xE8, 0x81, 0x63, 0xF4, 0xC0, 0x2C, 0x1D, 0x6E, 0x69,
+  0x76, 0x6C, 0xE5, 0xC0, 0x45, 0x7B, 0xE9, 0x06, 0x0A, 0x05, 0x0D, 0x07, 0x86, 0x74, 0x61, 0x6E,
+  0x6E, 0x69, 0x63, 0xEE, 0xC0, 0x3D, 0x88, 0x73, 0xE9, 0xC0, 0x3D, 0x64, 0x6C, 0x61, 0xE4, 0x69,
+  0x81, 0x72, 0xEF, 0x81, 0x64, 0x61, 0xF6, 0xA0, 0x9B, 0xEB, 0x40, 0x22, 0xE4, 0xC0, 0x23, 0x05,
+  0x69, 0x61, 0xF7, 0xC0, 0x26, 0xFC, 0x64, 0x36, 0x67, 0x6C, 0x62, 0x68, 0x62, 0x64, 0x39, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x47, 0x4D, 0xE8, 0x05, 0x1A, 0x09, 0x16, 0x91, 0xF4, 0x05, 0x0A, 0xC0, 0x31,
+  0x2E, 0x75, 0xEF, 0x04, 0xC0, 0x45, 0xBA, 0xED, 0xC0, 0x24, 0xB7, 0x72, 0xEF, 0x04, 0xC0, 0x46,
+  0x05, 0xF7, 0xC0, 0x3B, 0xD2, 0x73, 0xE9, 0x03, 0xA4, 0xB2, 0xF7, 0xC0, 0x3F, 0x75, 0xE7, 0x02,
+  0x89, 0x72, 0x75, 0x62, 0x73, 0x74, 0xF4, 0xC0, 0x40, 0x9B, 0x65, 0x61, 0x31, 0x68, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x47, 0x0E, 0xE3, 0x05, 0x04, 0xC0, 0x21, 0x7D, 0x73, 0xE9, 0xA2, 0x77, 0x72, 0x61,
+  0x65, 0xF3, 0xC0, 0x44, 0x46, 0x61, 0xF4, 0xC0, 0x43, 0xD7, 0xE7, 0x06, 0x20, 0x61, 0xC0, 0x29,
+  0x99, 0xF2, 0x03, 0xA0, 0x56, 0xF5, 0x02, 0x8D, 0x6F, 0xE2, 0x02, 0x85, 0x6D, 0xE5, 0xC0, 0x2E,
+  0x63, 0xE9, 0xC0, 0x44, 0x9C, 0xE2, 0x0A, 0x06, 0x20, 0x28, 0x09, 0x40, 0x2A, 0xDD, 0xAE, 0x78,
+  0xFA, 0x81, 0xEC, 0xC0, 0x42, 0xE3, 0xF3, 0x03, 0x08, 0x8A, 0x72, 0x65, 0x74, 0x65, 0xF0, 0xC0,
+  0x44, 0xCE, 0x6E, 0x61, 0x69, 0x74, 0x73, 0x69, 0xF2, 0xC0, 0x41, 0xFF, 0x6D, 0x61, 0x69, 0x6C,
+  0x6C, 0x69, 0xF7, 0x69, 0x81, 0x6C, 0x61, 0x69, 0x6E, 0x6F, 0xEC, 0xC0, 0x45, 0x83, 0xED, 0x04,
+  0xC0, 0x26, 0x3C, 0xF5, 0xC0, 0x43, 0x9C, 0xE9, 0xC0, 0x28, 0x6B, 0x65, 0x62, 0x6E, 0xF2, 0xC0,
+  0x44, 0x9C, 0xEE, 0x02, 0x8D, 0x75, 0x6C, 0x6D, 0x6D, 0x61, 0x73, 0x74, 0xF3, 0x81, 0xEE, 0xC0,
+  0x39, 0x63, 0xE9, 0x09, 0x04, 0x09, 0x06, 0x04, 0x0B, 0xC0, 0x2E, 0xD9, 0xF6, 0xC0, 0x3B, 0x3F,
+  0x70, 0x65, 0x65, 0x6B, 0x65, 0xED, 0xC0, 0x45, 0x5B, 0x6C, 0x61, 0xE8, 0xC0, 0x43, 0x40, 0xEB,
+  0xC0, 0x42, 0x43, 0x67, 0x69, 0x6E, 0x65, 0x72, 0x65, 0xF6, 0x81, 0xED, 0xB3, 0x80, 0x64, 0xEC,
+  0xC0, 0x3A, 0xA8, 0xE6, 0x02, 0x87, 0x6F, 0x68, 0x67, 0xF2, 0xC0, 0x3A, 0xA0, 0xE9, 0xA4, 0x42,
+  0xE5, 0x14, 0x0F, 0x0E, 0x20, 0x31, 0x20, 0x22, 0x20, 0x52, 0x14, 0x1D, 0x20, 0x28, 0x0A, 0x0B,
+  0x20, 0x24, 0x0C, 0x0C, 0x94, 0x76, 0x69, 0xF4, 0x02, 0x85, 0x6F, 0x6D, 0xEF, 0xB7, 0x38, 0x63,
+  0xE1, 0xC0, 0x34, 0x37, 0xF5, 0x02, 0x87, 0x76, 0x65, 0xEC, 0x81, 0xEC, 0xB7, 0xA4, 0x71, 0xE9,
+  0xA2, 0x7E, 0xF4, 0x03, 0x07, 0x87, 0x74, 0x65, 0x76, 0xF2, 0xC0, 0x44, 0xE4, 0x69, 0x6D, 0x65,
+  0xF3, 0xC0, 0x43, 0xD6, 0xE1, 0x04, 0x12, 0xB5, 0x0D, 0x74, 0xF3, 0x69, 0x81, 0xE5, 0x69, 0x81,
+  0x79, 0x72, 0x74, 0x6E, 0x75, 0x6F, 0xE3, 0x69, 0xC0, 0x38, 0xDC, 0x6C, 0x6F, 0xE3, 0x81, 0xEF,
+  0xC0, 0x41, 0x28, 0xF3, 0x04, 0x09, 0x05, 0x88, 0x75, 0x6F, 0xE8, 0x69, 0x81, 0xEC, 0xC0, 0x3B,
+  0xE3, 0x73, 0xE9, 0xC0, 0x40, 0x06, 0x69, 0x61, 0x63, 0x6E, 0xE1, 0xC0, 0x43, 0x83, 0x61, 0x62,
+  0x61, 0xF4, 0xC0, 0x41, 0x99, 0xF2, 0x05, 0x05, 0x15, 0x06, 0x9C, 0x76, 0xF5, 0xC0, 0x34, 0x67,
+  0x75, 0xF4, 0x07, 0x3F, 0xF3, 0x2F, 0x67, 0xB3, 0x4D, 0x6C, 0x75, 0xE3, 0x69, 0x04, 0xC0, 0x38,
+  0x93, 0xE9, 0xC0, 0x3F, 0x67, 0x6F, 0x6D, 0x69, 0xF4, 0xA9, 0x47, 0xE9, 0x03, 0xA1, 0x06, 0x68,
+  0xF3, 0x03, 0x09, 0x86, 0x70, 0x6D, 0x61, 0xE8, 0x81, 0xF7, 0xC0, 0x44, 0x5A, 0xEB, 0x81, 0xF2,
+  0xC0, 0x43, 0x57, 0xE1, 0xC0, 0x43, 0x3E, 0xE1, 0x04, 0xC0, 0x35, 0x6D, 0x77, 0x61, 0x6C, 0x65,
+  0xE4, 0x69, 0x81, 0x66, 0xEF, 0xBD, 0xC5, 0xEE, 0x05, 0x07, 0xC0, 0x22, 0xC5, 0x72, 0xE5, 0x81,
+  0xE3, 0xC0, 0x40, 0x8D, 0x67, 0xEF, 0x81, 0xEC, 0xC0, 0x30, 0x72, 0xED, 0x03, 0x07, 0x88, 0x75,
+  0xF4, 0x81, 0xF3, 0xC0, 0x44, 0x2B, 0x69, 0xF4, 0x69, 0x81, 0xE9, 0xC0, 0x29, 0x89, 0x61, 0x66,
+  0x66, 0x6F, 0xEC, 0x81, 0xEC, 0xC0, 0x24, 0xDA, 0xEC, 0x09, 0x03, 0x0D, 0x0A, 0x34, 0xA1, 0xC0,
+  0x2E, 0xBF, 0xF4, 0xA3, 0x0D, 0xE9, 0x02, 0x86, 0xF4, 0x81, 0xF8, 0xC0, 0x40, 0x16, 0xF3, 0xC0,
+  0x28, 0x98, 0x63, 0x79, 0x63, 0xF2, 0x81, 0x6F, 0xF4, 0xC0, 0x43, 0x15, 0xE2, 0xC0, 0x3F, 0x31,
+  0x6B, 0x6F, 0x6F, 0x72, 0x62, 0x72, 0xE5, 0xC0, 0x42, 0xD8, 0xE9, 0x02, 0x85, 0x6E, 0x6F, 0xEC,
+  0xB7, 0x66, 0xE3, 0xBA, 0x2C, 0xE7, 0x04, 0x08, 0xB7, 0xF0, 0x64, 0x69, 0x72, 0x62, 0xED, 0xC0,
+  0x41, 0xF7, 0xE1, 0x02, 0x8F, 0x74, 0x69, 0x72, 0x65, 0xE8, 0x69, 0x81, 0x6C, 0x61, 0x6E, 0x6F,
+  0xE9, 0xC0, 0x40, 0xF0, 0x6C, 0xEC, 0xC0, 0x40, 0xBD, 0xE6, 0x03, 0xA1, 0xA9, 0x69, 0x6C, 0x64,
+  0x6C, 0xE9, 0xC0, 0x41, 0xAA, 0xE5, 0x04, 0xC0, 0x36, 0xA7, 0x74, 0xF3, 0x81, 0xF5, 0xC0, 0x36,
+  0xA3, 0xE4, 0x02, 0x88, 0x72, 0x65, 0x76, 0x61, 0xF3, 0xC0, 0x41, 0x5B, 0x6E, 0x75, 0x6B, 0x6E,
+  0x65, 0xEB, 0xC0, 0x3F, 0x6F, 0xE3, 0x07, 0x05, 0x20, 0x3D, 0xC0, 0x39, 0x07, 0x70, 0xE5, 0xC0,
+  0x42, 0x35, 0xEE, 0x03, 0xA0, 0x28, 0xE5, 0x03, 0x11, 0x89, 0x69, 0x63, 0xF3, 0x69, 0x81, 0x66,
+  0x6F, 0xF9, 0x81, 0xF2, 0x81, 0x6F, 0x74, 0xF3, 0xC0, 0x20, 0x4A, 0x67, 0x69, 0x6C, 0x6C, 0x65,
+  0xF4, 0xC0, 0x41, 0xF3, 0x66, 0x65, 0x64, 0x6C, 0x61, 0x74, 0xF3, 0xC0, 0x22, 0x9F, 0xE1, 0x02,
+  0x87, 0x74, 0x73, 0x69, 0xF3, 0xC0, 0x41, 0xB3, 0xEC, 0x81, 0x75, 0xE2, 0xC0, 0x42, 0x98, 0xE1,
+  0x04, 0xC0, 0x32, 0x5D, 0xEC, 0x04, 0xC0, 0x3A, 0x75, 0x70, 0x68, 0x74, 0xF2, 0xC0, 0x3E, 0x71,
+  0xE4, 0x06, 0x10, 0x20, 0x42, 0x04, 0x90, 0xF2, 0x02, 0x87, 0x6F, 0xE6, 0x81, 0xF8, 0xC0, 0x43,
+  0x2E, 0x61, 0x75, 0xE7, 0xC0, 0x34, 0x57, 0xEE, 0x02, 0x9C, 0xF5, 0x02, 0x8B, 0x6F, 0x73, 0x64,
+  0x6E, 0x61, 0x65, 0x67, 0xE1, 0xC0, 0x3C, 0xA4, 0x62, 0x72, 0x6F, 0x66, 0x73, 0x64, 0x67, 0x79,
+  0xE2, 0x81, 0xED, 0xC0, 0x2E, 0x19, 0xE1, 0x69, 0x81, 0xEC, 0x08, 0x04, 0x0C, 0x40, 0x28, 0x4F,
+  0xB2, 0x16, 0xF9, 0xC0, 0x28, 0x51, 0xF4, 0x02, 0x84, 0xF2, 0xC0, 0x3F, 0x96, 0x6F, 0xE3, 0xC0,
+  0x42, 0x84, 0x72, 0x61, 0x67, 0x79, 0xE4, 0xA1, 0xF9, 0xEC, 0xC0, 0x31, 0x3C, 0xE9, 0x04, 0xC0,
+  0x38, 0x54, 0x75, 0x6C, 0x65, 0x67, 0x6E, 0x65, 0x64, 0x6C, 0xE5, 0xB5, 0x75, 0xE1, 0x06, 0x08,
+  0x0A, 0xC0, 0x42, 0xB0, 0x6F, 0xF2, 0x81, 0x6C, 0xE9, 0xC0, 0x37, 0x3D, 0x65, 0x74, 0xF3, 0x81,
+  0xED, 0x81, 0xF2, 0xC0, 0x3A, 0xCB, 0x64, 0x68, 0xE7, 0xC0, 0x42, 0x13, 0xE3, 0x07, 0x20, 0x46,
+  0x04, 0xC0, 0x39, 0x04, 0xE9, 0x09, 0x04, 0x1C, 0x0D, 0x06, 0x3A, 0x13, 0xBF, 0x7B, 0xF6, 0xC0,
+  0x40, 0x8F, 0xF4, 0x03, 0x0A, 0x85, 0x6E, 0x61, 0x6C, 0x74, 0xE1, 0x81, 0xE4, 0xC0, 0x42, 0x87,
+  0x6C, 0xE5, 0xC0, 0x42, 0x7E, 0x63, 0x61, 0x72, 0x70, 0x6F, 0xF2, 0xC0, 0x20, 0x58, 0x68, 0x70,
+  0x61, 0x72, 0x67, 0x6F, 0x6E, 0x61, 0x65, 0xE3, 0xC0, 0x42, 0x74, 0x66, 0x69, 0xE3, 0xC0, 0x39,
+  0xA0, 0x64, 0x65, 0x70, 0x6F, 0x6C, 0x63, 0xF9, 0xAC, 0x69, 0xE5, 0xC0, 0x39, 0xC0, 0x64, 0x6E,
+  0x6F, 0x74, 0x67, 0x6E, 0x69, 0x68, 0xF3, 0xC0, 0x27, 0xF1, 0xE1, 0x14, 0x05, 0x11, 0x15, 0x20,
+  0x27, 0x18, 0x1B, 0x0C, 0x20, 0x57, 0x06, 0x12, 0x1A, 0x1E, 0x1D, 0x05, 0xC0, 0x34, 0xEB, 0x7A,
+  0xE1, 0xC0, 0x30, 0x25, 0xF4, 0x02, 0x87, 0x6F, 0x73, 0x65, 0xEE, 0xC0, 0x2B, 0xCC, 0x6E, 0xE1,
+  0x81, 0xEC, 0xC0, 0x3F, 0x16, 0xF2, 0x02, 0x88, 0x65, 0x7A, 0x7A, 0x69, 0xF6, 0xC0, 0x41, 0xB6,
+  0x61, 0x62, 0x72, 0x61, 0xE2, 0x81, 0x61, 0xF4, 0xBF, 0x04, 0xEE, 0x06, 0x0C, 0x07, 0xC0, 0x3F,
+  0xC2, 0x69, 0x6C, 0x6F, 0x72, 0x61, 0x63, 0x68, 0x74, 0xF5, 0xC0, 0x2E, 0x30, 0x65, 0x64, 0x61,
+  0xF3, 0xC0, 0x39, 0x2D, 0xE1, 0x02, 0x83, 0xE9, 0xBA, 0x80, 0x63, 0x69, 0x72, 0xE5, 0xC0, 0x41,
+  0x36, 0xED, 0x03, 0x05, 0x85, 0xEF, 0x40, 0x41, 0xD4, 0x8C, 0x65, 0xEE, 0xC0, 0x39, 0x00, 0xE1,
+  0x04, 0xC0, 0x39, 0x08, 0x62, 0xE1, 0xC0, 0x41, 0x97, 0xEC, 0x03, 0x0A, 0x87, 0x75, 0x6F, 0x73,
+  0x73, 0x69, 0xED, 0x69, 0xC0, 0x37, 0x80, 0x71, 0x2D, 0x73, 0xEE, 0xC0, 0x39, 0x5F, 0x6C, 0x6F,
+  0xEA, 0xC0, 0x40, 0x94, 0x6B, 0x73, 0xE1, 0x04, 0xC0, 0x41, 0x72, 0x72, 0xE2, 0xC0, 0x41, 0x97,
+  0xE9, 0x0C, 0x06, 0x07, 0x12, 0x10, 0x04, 0x11, 0x20, 0x2C, 0xC0, 0x3E, 0x42, 0x74, 0x73, 0xEF,
+  0xC0, 0x3D, 0xD5, 0x73, 0xF3, 0x81, 0xF5, 0xC0, 0x41, 0x83, 0xEE, 0x02, 0x88, 0x72, 0x6F, 0x66,
+  0x69, 0xEC, 0xC0, 0x3F, 0xA4, 0xE9, 0x81, 0x67, 0xF2, 0xC0, 0x3E, 0x7A, 0xEC, 0x02, 0x86, 0x65,
+  0x74, 0xE1, 0xC0, 0x2E, 0x4F, 0xE1, 0x81, 0xF2, 0x81, 0xF4, 0xB7, 0x68, 0xE7, 0xC0, 0x2F, 0x0B,
+  0x62, 0x6D, 0x75, 0x6C, 0x6F, 0xE3, 0x69, 0x81, 0x68, 0x73, 0xE9, 0x81, 0x74, 0xE9, 0xC0, 0x2E,
+  0x3F, 0x61, 0x75, 0xE8, 0xC0, 0x35, 0x60, 0xE8, 0x81, 0xE1, 0xC0, 0x40, 0x4A, 0xE7, 0x02, 0x88,
+  0x6F, 0x6F, 0x6E, 0x61, 0x74, 0xF4, 0xB7, 0xEC, 0x68, 0x61, 0x6E, 0x6E, 0xE1, 0xA5, 0xE9, 0xE5,
+  0x02, 0x86, 0x73, 0x72, 0x65, 0xE4, 0xBC, 0x6F, 0x72, 0x61, 0x61, 0xE9, 0x81, 0x68, 0x70, 0x6C,
+  0x65, 0x64, 0xE1, 0x81, 0x6C, 0xE9, 0xC0, 0x2C, 0x97, 0xE4, 0x03, 0x08, 0x8F, 0xE9, 0x81, 0xF2,
+  0x81, 0xEF, 0xC0, 0x36, 0xC8, 0x65, 0x6E, 0x6F, 0x6D, 0x61, 0x6C, 0x65, 0xE4, 0x81, 0xE1, 0x81,
+  0xF3, 0xC0, 0x3F, 0x25, 0xE1, 0xA4, 0xE6, 0xE3, 0x02, 0x85, 0x72, 0x6F, 0xEC, 0xB6, 0x09, 0xE9,
+  0x02, 0x8B, 0x72, 0x66, 0xE1, 0x81, 0x74, 0xF3, 0x81, 0xE1, 0xC0, 0x40, 0xC8, 0x61, 0xE4, 0x81,
+  0xF5, 0xC0, 0x3B, 0xF7, 0x61, 0xF4, 0xC0, 0x35, 0xF4, 0x39, 0x32, 0x63, 0x68, 0x67, 0x2D, 0x73,
+  0x65, 0x61, 0x63, 0x69, 0x6E, 0x75, 0x6D, 0x6F, 0x63, 0x65, 0x6C, 0x65, 0x74, 0x2D, 0x65, 0x2D,
+  0x73, 0x6F, 0x69, 0x65, 0x72, 0x72, 0x6F, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0x41, 0xD4, 0xF4, 0x69,
+  0x81, 0xAE, 0x40, 0x3E, 0x61, 0x20, 0x98, 0x21, 0x8D, 0x06, 0x20, 0x20, 0x04, 0x86, 0x72, 0x61,
+  0xE6, 0x69, 0x03, 0xBA, 0x15, 0x2E, 0xEA, 0xC0, 0x3A, 0x64, 0xF0, 0x69, 0x81, 0xAE, 0x27, 0x3C,
+  0xC0, 0x37, 0x72, 0xEF, 0x69, 0x0A, 0x04, 0x2E, 0xB1, 0x40, 0x2D, 0x9D, 0x24, 0x21, 0x94, 0xF4,
+  0xC0, 0x31, 0xF9, 0xE3, 0x69, 0x03, 0xBB, 0xBB, 0xAE, 0x20, 0x31, 0x08, 0x20, 0x94, 0x20, 0x20,
+  0x1C, 0x0B, 0x20, 0x2F, 0x21, 0x03, 0x23, 0x45, 0x21, 0xB8, 0x20, 0x9F, 0x20, 0x49, 0x20, 0xAF,
+  0x20, 0x3F, 0x20, 0x78, 0x20, 0xC9, 0x03, 0x20, 0x5C, 0x09, 0x20, 0x55, 0x21, 0xBA, 0x21, 0x01,
+  0x20, 0x47, 0x20, 0x22, 0x20, 0x61, 0x05, 0x05, 0xB5, 0x78, 0x7A, 0x65, 0x73, 0x64, 0x72, 0xEF,
+  0xAF, 0x74, 0xF9, 0x0A, 0x20, 0x21, 0x09, 0x17, 0x0D, 0x04, 0x0A, 0xAD, 0xAA, 0xF8, 0x02, 0x94,
+  0x6F, 0x72, 0xF0, 0x02, 0x8A, 0x6D, 0x61, 0x70, 0x73, 0x6F, 0x6E, 0xAE, 0xC0, 0x3E, 0xEB, 0x68,
+  0x73, 0xE9, 0xB7, 0xD2, 0x61, 0x6C, 0x61, 0xE7, 0x81, 0x6B, 0xE5, 0xC0, 0x3F, 0x23, 0xF5, 0x69,
+  0x81, 0xE7, 0x81, 0xEF, 0xC0, 0x40, 0x18, 0x72, 0x6F, 0xF4, 0x02, 0x86, 0x73, 0x69, 0xF4, 0xC0,
+  0x3C, 0x9F, 0x63, 0x65, 0x72, 0x69, 0x64, 0x65, 0x76, 0x69, 0x74, 0xE3, 0xA5, 0x64, 0xEB, 0x04,
+  0xC0, 0x24, 0x15, 0x6E, 0x69, 0x6B, 0x73, 0xE9, 0xC0, 0x30, 0x91, 0x66, 0xE9, 0xA4, 0x25, 0x64,
+  0x6E, 0x61, 0x63, 0x73, 0x65, 0xEB, 0xC0, 0x35, 0xC6, 0xE1, 0x03, 0x09, 0x8D, 0x77, 0x65, 0x74,
+  0x61, 0x67, 0xAD, 0xC0, 0x2E, 0xAB, 0xEC, 0x02, 0x86, 0x70, 0x65, 0xFA, 0xC0, 0x35, 0x4D, 0x65,
+  0xF2, 0xAD, 0x71, 0x62, 0x6E, 0xF8, 0x69, 0x81, 0xAE, 0x02, 0x87, 0x6C, 0x61, 0x63, 0x6F, 0x6C,
+  0xAD, 0x81, 0xB2, 0xC0, 0x3D, 0xAB, 0xF8, 0x09, 0x08, 0x05, 0x27, 0x57, 0x39, 0x2E, 0xBC, 0xD2,
+  0x6F, 0x62, 0x61, 0x6E, 0x69, 0xE1, 0xA8, 0x84, 0xE9, 0x27, 0xB7, 0xB8, 0xDA, 0x62, 0x73, 0x62,
+  0x66, 0x2E, 0xF3, 0xC0, 0x2C, 0xA1, 0xF7, 0x02, 0x87, 0x77, 0x77, 0x31, 0xB0, 0xC0, 0x36, 0x54,
+  0xEF, 0x02, 0x84, 0xFA, 0xC0, 0x2A, 0x16, 0x6C, 0x70, 0x77, 0x6F, 0x6E, 0x73, 0x2D, 0xF9, 0xC0,
+  0x32, 0x72, 0xF6, 0x05, 0x29, 0xB0, 0xA3, 0x8B, 0x72, 0xE4, 0xC0, 0x35, 0x20, 0xF5, 0x0C, 0x08,
+  0x10, 0x22, 0xED, 0x40, 0x2D, 0x62, 0x2E, 0x15, 0xA0, 0xBC, 0xF2, 0x69, 0x81, 0x75, 0xE7, 0xC0,
+  0x23, 0x21, 0x6F, 0x79, 0x6E, 0x61, 0x68, 0x74, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6D, 0xF3, 0xC0,
+  0x2F, 0xF8, 0x61, 0x2D, 0xF3, 0x81, 0x70, 0x70, 0x61, 0xF4, 0xA3, 0x18, 0xF4, 0x0F, 0x11, 0x20,
+  0x39, 0x11, 0x20, 0x5F, 0x04, 0x0B, 0x0E, 0x12, 0x2B, 0x37, 0xA0, 0xDA, 0xF5, 0x04, 0xC0, 0x23,
+  0x47, 0x6E, 0x79, 0x65, 0x6B, 0x63, 0x6F, 0x68, 0x2D, 0xE1, 0xC0, 0x2F, 0xCD, 0xF3, 0x02, 0x8D,
+  0x6F, 0xE8, 0x02, 0x84, 0xF3, 0xC0, 0x3E, 0xB0, 0x70, 0xE9, 0xC0, 0x3E, 0x94, 0xE9, 0x07, 0x04,
+  0x09, 0x09, 0xC0, 0x20, 0x8C, 0x74, 0xF2, 0xA4, 0x74, 0x70, 0x61, 0x72, 0x65, 0x68, 0xF4, 0xC0,
+  0x22, 0xC1, 0x6C, 0x61, 0x69, 0x63, 0x6F, 0xF3, 0xC0, 0x22, 0xB8, 0x68, 0x63, 0x72, 0x61, 0x6E,
+  0x61, 0xAD, 0x25, 0x73, 0xBD, 0x3D, 0x6F, 0x70, 0xF3, 0x06, 0x40, 0x2C, 0xCF, 0xB1, 0xEE, 0x70,
+  0x70, 0xE1, 0x69, 0x81, 0x2E, 0xF2, 0x62, 0xEE, 0x03, 0xA0, 0x52, 0xE5, 0x05, 0x08, 0x20, 0x32,
+  0x8B, 0x79, 0x6F, 0x6A, 0x2E, 0x73, 0x6E, 0xE3, 0x62, 0x74, 0x6E, 0x6F, 0x63, 0x72, 0x65, 0x73,
+  0xF5, 0x04, 0x1F, 0xB5, 0xD7, 0xE5, 0x04, 0x10, 0xAB, 0xB3, 0x6C, 0x62, 0x61, 0x76, 0x72, 0x65,
+  0x73, 0x62, 0x6F, 0x2E, 0x63, 0x69, 0xF4, 0xC0, 0x3D, 0xC4, 0x64, 0x6F, 0x6E, 0x69, 0x6C, 0x2E,
+  0xF0, 0xC0, 0x3D, 0x8F, 0xE2, 0x81, 0x75, 0xE8, 0xC0, 0x2D, 0x9A, 0x72, 0x2D, 0x6F, 0x74, 0x2D,
+  0x65, 0x63, 0xE1, 0xC0, 0x2D, 0x9E, 0x64, 0x75, 0x74, 0xF3, 0xC0, 0x22, 0x46, 0x61, 0x74, 0x6E,
+  0x75, 0x6F, 0x63, 0xE3, 0xA3, 0xE7, 0xE9, 0x69, 0xB4, 0x9F, 0x68, 0x67, 0x69, 0x6C, 0x66, 0x68,
+  0x74, 0x69, 0xF7, 0xB8, 0x14, 0x65, 0x65, 0xEC, 0x04, 0xC0, 0x22, 0xF6, 0x72, 0x65, 0x62, 0xF5,
+  0xC0, 0x22, 0xF2, 0xE3, 0x04, 0xC0, 0x22, 0x70, 0x65, 0x74, 0x65, 0x64, 0x61, 0x74, 0x61, 0x64,
+  0xAE, 0x3B, 0x69, 0xBA, 0xCB, 0x61, 0x72, 0x63, 0x6F, 0x6D, 0x65, 0xE4, 0xC0, 0x22, 0x04, 0xF3,
+  0x19, 0x08, 0x21, 0x30, 0x20, 0x7B, 0x1C, 0x1E, 0x19, 0x0B, 0x20, 0x34, 0x09, 0x1F, 0x05, 0x19,
+  0x10, 0x20, 0x60, 0x03, 0x16, 0x03, 0xC0, 0x38, 0xFE, 0x79, 0x61, 0x73, 0x64, 0x72, 0xEF, 0xAD,
+  0x45, 0x77, 0x61, 0x6E, 0x6F, 0x7A, 0x61, 0x6D, 0x61, 0xAE, 0x08, 0x05, 0x19, 0x20, 0x24, 0xC0,
+  0x27, 0x8A, 0xE2, 0x81, 0x6C, 0xE5, 0x62, 0xB3, 0x04, 0xC0, 0x3D, 0x97, 0x2D, 0x74, 0xF3, 0x02,
+  0x85, 0x65, 0x77, 0xAD, 0xA0, 0xA4, 0x61, 0x65, 0x68, 0x74, 0x72, 0x6F, 0x6E, 0xAD, 0xA0, 0x7D,
+  0x32, 0x2D, 0x74, 0xF3, 0x02, 0x87, 0x65, 0x77, 0xAD, 0x20, 0x47, 0xA0, 0x48, 0x61, 0xE5, 0x02,
+  0x8B, 0x68, 0xF4, 0x03, 0xA0, 0x48, 0x72, 0x6F, 0x6E, 0xAD, 0xA0, 0xA2, 0x2D, 0x73, 0xF5, 0x20,
+  0xA3, 0xC0, 0x30, 0x80, 0x31, 0xAD, 0x08, 0x20, 0x5E, 0x20, 0x23, 0xC0, 0x26, 0xFF, 0x74, 0xF3,
+  0x03, 0xA0, 0x23, 0x65, 0x77, 0xAD, 0x03, 0x12, 0x85, 0x76, 0x6F, 0x67, 0x2D, 0x73, 0x75, 0xAD,
+  0x04, 0xC0, 0x31, 0x10, 0x73, 0x70, 0x69, 0xE6, 0xC0, 0x30, 0xFA, 0x75, 0xE5, 0x20, 0x36, 0x84,
+  0x73, 0xF5, 0x20, 0x35, 0xA0, 0x5D, 0x61, 0xE5, 0x02, 0x94, 0x68, 0xF4, 0x02, 0x88, 0x75, 0x6F,
+  0x73, 0x2D, 0x70, 0xE1, 0x1F, 0x84, 0x72, 0x6F, 0x6E, 0x2D, 0x70, 0xE1, 0x17, 0x84, 0xAD, 0x03,
+  0x09, 0x84, 0x73, 0xF5, 0x69, 0x02, 0x8C, 0xAD, 0xC0, 0x30, 0xC2, 0x70, 0xE1, 0xA0, 0x67, 0x61,
+  0xF3, 0x02, 0x84, 0xAE, 0x20, 0x45, 0x9D, 0xAD, 0x40, 0x30, 0xB2, 0x9A, 0x6C, 0xE1, 0x02, 0x96,
+  0x72, 0x74, 0x6E, 0x65, 0x63, 0xAD, 0x02, 0x87, 0x75, 0xE5, 0x20, 0x28, 0xC0, 0x30, 0x80, 0x61,
+  0xE3, 0x20, 0x21, 0xC0, 0x30, 0x80, 0x6E, 0x72, 0x65, 0x74, 0x78, 0xE5, 0xC0, 0x30, 0x96, 0x68,
+  0xF4, 0x03, 0xA0, 0x28, 0x75, 0x6F, 0x73, 0xAD, 0x04, 0x1A, 0x03, 0x88, 0x70, 0xE1, 0x04, 0xC0,
+  0x30, 0x80, 0xAE, 0x06, 0x1D, 0x40, 0x30, 0x54, 0x9A, 0x6B, 0x63, 0x61, 0x74, 0x73, 0x6C, 0x61,
+  0x75, 0x64, 0xAE, 0xC0, 0x30, 0x81, 0x66, 0xE1, 0x8C, 0x65, 0xED, 0x89, 0x72, 0x6F, 0x6E, 0xAD,
+  0x81, 0x75, 0xE5, 0x81, 0xAE, 0x81, 0x39, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0x2E, 0xF3, 0x02, 0x8D,
+  0x74, 0x65, 0x73, 0x73, 0x61, 0x2D, 0x77, 0x65, 0x69, 0xF6, 0xC0, 0x37, 0xD4, 0xE6, 0xC0, 0x3B,
+  0x8C, 0xF4, 0x04, 0x20, 0x57, 0x8B, 0x73, 0x61, 0x65, 0x62, 0x2D, 0x63, 0x69, 0x68, 0x74, 0x79,
+  0x6D, 0xAE, 0x07, 0x0F, 0x08, 0x04, 0x0D, 0x09, 0x85, 0xF8, 0x69, 0x81, 0xEE, 0x02, 0x84, 0xF9,
+  0xC0, 0x3B, 0xD9, 0x69, 0xE8, 0xC0, 0x2B, 0xDC, 0x74, 0x6F, 0x6C, 0x65, 0xE3, 0xC0, 0x3C, 0xBF,
+  0xF3, 0xC0, 0x3B, 0x59, 0x72, 0xE5, 0x04, 0xC0, 0x2C, 0x69, 0x67, 0x69, 0x74, 0xEE, 0xC0, 0x21,
+  0x1A, 0x6C, 0x61, 0x63, 0xE1, 0x81, 0xF2, 0xC0, 0x3A, 0xBF, 0x69, 0xEC, 0xC0, 0x39, 0x4A, 0xE1,
+  0x02, 0x84, 0xFA, 0xC0, 0x3C, 0x25, 0x6C, 0x6C, 0x69, 0xE3, 0xC0, 0x3C, 0x1E, 0x6E, 0x65, 0x6D,
+  0x65, 0x6C, 0x65, 0x70, 0x69, 0x75, 0xF1, 0x62, 0x63, 0x65, 0x6A, 0x62, 0xEF, 0x02, 0x86, 0x72,
+  0x74, 0x6C, 0x75, 0xF6, 0x62, 0x65, 0x64, 0x6F, 0x6E, 0x69, 0xEC, 0x62, 0xF3, 0x02, 0x86, 0x69,
+  0x62, 0xEF, 0xC0, 0x28, 0xA9, 0xE5, 0x02, 0x85, 0x72, 0x74, 0xE3, 0xA1, 0xD0, 0xEC, 0x81, 0x2D,
+  0x72, 0x6F, 0x66, 0x2D, 0xF3, 0xC0, 0x27, 0x3A, 0xF2, 0x03, 0xA0, 0x4B, 0xE5, 0x02, 0x8A, 0x74,
+  0x73, 0x6F, 0x68, 0x6D, 0x61, 0xE5, 0xC0, 0x34, 0xCA, 0x6E, 0x74, 0x72, 0x61, 0x70, 0x2D, 0x70,
+  0x61, 0xE5, 0x81, 0xEC, 0xBF, 0xBC, 0x70, 0x70, 0xE1, 0x04, 0x0A, 0xA6, 0xB1, 0xF4, 0x04, 0xC0,
+  0x21, 0xDD, 0x69, 0xEB, 0xC0, 0x2D, 0x57, 0x2D, 0x61, 0xF6, 0x81, 0xEE, 0xC0, 0x3A, 0x3A, 0xEF,
+  0x02, 0x82, 0xAD, 0x81, 0xF8, 0x81, 0x6F, 0xE2, 0xBE, 0xF9, 0xEE, 0x07, 0x0F, 0x40, 0x29, 0xE1,
+  0xA3, 0x38, 0x6F, 0x6F, 0x74, 0xF2, 0x81, 0x61, 0x63, 0x2D, 0x6F, 0x74, 0x6E, 0xE9, 0xC0, 0x20,
+  0x94, 0xE4, 0x08, 0x0A, 0x04, 0x3E, 0x1A, 0x10, 0xBD, 0x9A, 0x68, 0x74, 0x69, 0xF7, 0x81, 0x73,
+  0xF3, 0xC0, 0x39, 0xA3, 0xE4, 0xC0, 0x2B, 0x0B, 0x2D, 0x70, 0xED, 0xC0, 0x37, 0xE6, 0xED, 0x03,
+  0xBF, 0xF6, 0x63, 0xF8, 0xC0, 0x3B, 0xBA, 0xEB, 0x04, 0x12, 0xBF, 0xDA, 0x63, 0x6F, 0x6C, 0xE2,
+  0x02, 0x87, 0x70, 0x6F, 0x68, 0xF3, 0xC0, 0x3B, 0x48, 0x65, 0xE7, 0xC0, 0x31, 0x7B, 0x61, 0x65,
+  0x72, 0x66, 0xAD, 0xC0, 0x39, 0xF8, 0x6A, 0xE6, 0xC0, 0x39, 0xCE, 0xE9, 0x02, 0x8D, 0x70, 0xE1,
+  0x03, 0xA7, 0xCC, 0x74, 0x6E, 0x65, 0x6C, 0xF4, 0xC0, 0x21, 0x57, 0x68, 0x74, 0x32, 0x74, 0x6E,
+  0xE9, 0xC0, 0x38, 0x3F, 0x66, 0x70, 0x69, 0xAD, 0x04, 0xC0, 0x31, 0x64, 0x65, 0x72, 0x61, 0x6C,
+  0xE6, 0xC0, 0x3A, 0x46, 0xE5, 0x05, 0x16, 0x0A, 0x10, 0x8A, 0xF4, 0x02, 0x88, 0x79, 0x73, 0x6B,
+  0x63, 0xE9, 0xC0, 0x32, 0xDC, 0xE9, 0x02, 0x84, 0xF3, 0xC0, 0x3B, 0x71, 0xE9, 0xC0, 0x39, 0x40,
+  0x6D, 0x61, 0x67, 0x2D, 0x6F, 0x74, 0x6E, 0xE9, 0xBF, 0xFA, 0x6C, 0x61, 0x68, 0x77, 0x2D, 0x65,
+  0x68, 0x74, 0x2D, 0x73, 0xE5, 0x81, 0xF6, 0xC0, 0x38, 0x7F, 0x69, 0x74, 0x69, 0x6C, 0x69, 0x74,
+  0xF5, 0xC0, 0x21, 0xDF, 0xE3, 0x02, 0x8D, 0x69, 0x76, 0x65, 0x64, 0x2D, 0x61, 0x6E, 0xE5, 0x81,
+  0xEC, 0xC0, 0x3A, 0x9B, 0x61, 0x70, 0x73, 0x6E, 0x61, 0x65, 0x63, 0x6F, 0x6C, 0x61, 0x74, 0x69,
+  0x67, 0x69, 0xE4, 0x62, 0xE4, 0xBD, 0x9B, 0x63, 0xE9, 0x02, 0x8D, 0x74, 0x63, 0x61, 0x74, 0x79,
+  0x74, 0x69, 0xF2, 0x81, 0xF5, 0xC0, 0x25, 0xE3, 0xF0, 0x28, 0xC7, 0xB6, 0x65, 0xE2, 0xBD, 0x94,
+  0xE1, 0x05, 0x09, 0x3D, 0x8E, 0x86, 0x76, 0x6E, 0x61, 0x63, 0x72, 0xE5, 0xC0, 0x39, 0xCF, 0x61,
+  0xF0, 0xC0, 0x37, 0x36, 0xF2, 0x10, 0x20, 0x3A, 0x03, 0x20, 0x40, 0x0A, 0x04, 0x21, 0x0F, 0x40,
+  0x35, 0xDF, 0x23, 0x3E, 0x96, 0xF5, 0x04, 0x06, 0xA0, 0x27, 0x6F, 0x6D, 0x75, 0xE8, 0xBE, 0xF7,
+  0xE5, 0x02, 0x8E, 0x75, 0x67, 0x6F, 0x6C, 0x62, 0x2D, 0x6E, 0x6F, 0x6D, 0x2D, 0xF4, 0xC0, 0x2E,
+  0x86, 0x74, 0x73, 0x6F, 0x68, 0xAE, 0x02, 0x84, 0x68, 0x63, 0xAD, 0x81, 0x64, 0x75, 0x6F, 0x6C,
+  0x63, 0xAD, 0x81, 0xE7, 0xC0, 0x2F, 0x32, 0x61, 0x73, 0x2D, 0x6F, 0xAD, 0xC0, 0x2B, 0xCE, 0xF0,
+  0xBE, 0xC8, 0xEF, 0x05, 0x20, 0x2A, 0xBE, 0x96, 0xF4, 0x03, 0x08, 0x8B, 0x73, 0x75, 0xF3, 0x81,
+  0xE1, 0xC0, 0x3A, 0x1D, 0xE3, 0x02, 0x84, 0x6F, 0xE4, 0xBE, 0x57, 0x61, 0xAD, 0xA1, 0x18, 0x61,
+  0x72, 0x65, 0x6C, 0x65, 0x63, 0x63, 0x61, 0x6C, 0x61, 0x62, 0x6F, 0x6C, 0x67, 0x73, 0xF7, 0xC0,
+  0x3A, 0x86, 0x73, 0x69, 0x76, 0x64, 0x61, 0x6C, 0x61, 0x69, 0x63, 0x6E, 0x61, 0x6E, 0x69, 0xE6,
+  0xBE, 0x30, 0x6D, 0x67, 0x72, 0x70, 0x2E, 0x6E, 0xE5, 0xC0, 0x3B, 0x76, 0xE9, 0xC0, 0x23, 0x5C,
+  0xE5, 0x0F, 0x0F, 0x0D, 0x20, 0x31, 0x13, 0x06, 0x06, 0x15, 0x20, 0x23, 0x0B, 0x14, 0x07, 0x8E,
+  0x7A, 0x69, 0x6C, 0x69, 0x62, 0x6F, 0x6D, 0x64, 0x65, 0x65, 0x70, 0xF3, 0xC0, 0x2A, 0x57, 0xF9,
+  0x02, 0x85, 0x77, 0x61, 0xEC, 0xBD, 0xFB, 0x61, 0x6C, 0xF0, 0xBD, 0xF6, 0x76, 0x72, 0x65, 0xF3,
+  0x05, 0x05, 0x04, 0xAA, 0xA3, 0x6E, 0xED, 0xC0, 0x37, 0x14, 0xE9, 0xC0, 0x23, 0xBC, 0xAD, 0x02,
+  0x86, 0xF3, 0x40, 0x23, 0x60, 0xA7, 0xD5, 0x6B, 0x69, 0xAE, 0x02, 0x89, 0x63, 0x70, 0x6A, 0x2D,
+  0x72, 0x65, 0x76, 0xAD, 0x81, 0x64, 0x75, 0x6F, 0x6C, 0xE3, 0xC0, 0x35, 0x0E, 0x74, 0xEE, 0x03,
+  0x04, 0x85, 0x75, 0xE8, 0xBD, 0xBC, 0x69, 0x61, 0xF0, 0xBD, 0xB7, 0x65, 0xE3, 0xC0, 0x39, 0x4A,
+  0x73, 0x75, 0xE2, 0xC0, 0x39, 0x8E, 0x72, 0x65, 0x74, 0xE1, 0xBD, 0xA4, 0xF0, 0x02, 0x89, 0x65,
+  0x65, 0x6B, 0x6B, 0x6F, 0x6F, 0xE2, 0xBD, 0x9A, 0x61, 0x63, 0x73, 0x64, 0x6E, 0x61, 0xEC, 0xBD,
+  0x91, 0xEE, 0x02, 0x99, 0x69, 0xE1, 0x02, 0x89, 0x74, 0x72, 0x65, 0x74, 0x6E, 0x65, 0xAD, 0xA0,
+  0x46, 0x72, 0x74, 0x6C, 0x61, 0x6E, 0x6F, 0x73, 0x72, 0x65, 0xF0, 0xBD, 0x75, 0x67, 0x69, 0x73,
+  0x65, 0xE4, 0xBD, 0x6E, 0x6B, 0x72, 0x6F, 0x77, 0x2D, 0x64, 0x72, 0x61, 0xE8, 0xBD, 0x63, 0xE8,
+  0x02, 0x8B, 0x70, 0x61, 0x72, 0x67, 0x6F, 0x74, 0x6F, 0x68, 0xF0, 0xBD, 0x55, 0x63, 0x61, 0x65,
+  0xF4, 0xBD, 0x4F, 0x67, 0x67, 0x6F, 0x6C, 0xE2, 0xBD, 0x48, 0xE5, 0x03, 0xBC, 0x04, 0x6E, 0x69,
+  0x67, 0x6E, 0x65, 0xAD, 0x81, 0xEE, 0xBD, 0x3C, 0xE4, 0x02, 0x87, 0x6E, 0x65, 0xF2, 0x3B, 0x66,
+  0xBD, 0x94, 0x69, 0xF6, 0x02, 0x89, 0x6F, 0x72, 0xF0, 0x81, 0x6E, 0xF7, 0xC0, 0x39, 0x60, 0x65,
+  0x72, 0x70, 0x2D, 0x79, 0x62, 0x2D, 0x64, 0x65, 0x74, 0x73, 0x6F, 0x68, 0xAE, 0xB6, 0x69, 0xE1,
+  0x69, 0x03, 0xBD, 0x64, 0x74, 0x73, 0x6B, 0x63, 0x6F, 0xF2, 0xBD, 0x06, 0xF0, 0x0A, 0x0A, 0x20,
+  0x57, 0x20, 0x27, 0x08, 0xC0, 0x38, 0x1B, 0xF4, 0x02, 0x84, 0x74, 0xE8, 0xBD, 0x49, 0xE6, 0xBD,
+  0x46, 0x70, 0xE1, 0x0B, 0x12, 0x12, 0x09, 0x04, 0x07, 0x08, 0x21, 0x84, 0xA4, 0x87, 0xF4, 0x02,
+  0x87, 0x6E, 0x6F, 0x72, 0xE6, 0xC0, 0x29, 0x2E, 0xE9, 0x81, 0x6C, 0x6D, 0x61, 0xE5, 0xA8, 0x44,
+  0xF2, 0x02, 0x89, 0x6F, 0x65, 0x74, 0x65, 0xED, 0x69, 0xC0, 0x2B, 0xE8, 0x61, 0x65, 0xE7, 0xC0,
+  0x24, 0x1C, 0x6F, 0x69, 0x66, 0x69, 0x6C, 0xE1, 0xC0, 0x30, 0x56, 0xEB, 0xC0, 0x2B, 0x2E, 0x65,
+  0x73, 0x61, 0xE2, 0xC0, 0x27, 0xC0, 0x61, 0x6E, 0x69, 0xF3, 0x69, 0xC0, 0x2D, 0x43, 0xAD, 0x81,
+  0x72, 0x65, 0x74, 0x74, 0xE1, 0xC0, 0x26, 0xC1, 0xE9, 0x07, 0x09, 0x11, 0x26, 0x66, 0xB5, 0x3A,
+  0x79, 0xED, 0x03, 0xBB, 0xAC, 0xF4, 0xC0, 0x37, 0xC8, 0x72, 0x75, 0x6F, 0xF9, 0x02, 0x86, 0x68,
+  0x63, 0xF4, 0xC0, 0x2C, 0xC9, 0x65, 0xF3, 0xC0, 0x28, 0x7D, 0x6F, 0xE7, 0xC0, 0x28, 0x78, 0x61,
+  0x65, 0x6C, 0x75, 0xF4, 0xC0, 0x38, 0x2A, 0x32, 0xF0, 0xBC, 0xBC, 0xEF, 0x0A, 0x06, 0x0B, 0x0A,
+  0x10, 0x0D, 0x3B, 0x58, 0xBC, 0xFA, 0x74, 0x74, 0xE1, 0xC0, 0x24, 0xD2, 0x73, 0x73, 0x65, 0x63,
+  0x63, 0x61, 0x6E, 0x64, 0xE3, 0xA5, 0x42, 0xEE, 0x69, 0x81, 0x69, 0x6C, 0x6F, 0xF8, 0xC0, 0x33,
+  0x14, 0xED, 0x03, 0xBC, 0x93, 0x65, 0x64, 0x2D, 0x62, 0x61, 0x6C, 0x74, 0x6C, 0xEF, 0xC0, 0x36,
+  0x5E, 0x68, 0x63, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0xF4, 0x81, 0xF3, 0xC0, 0x35, 0x05, 0x62, 0x6F,
+  0xF2, 0xC0, 0x24, 0x9A, 0xEE, 0x0F, 0x03, 0x20, 0x4B, 0x06, 0x1B, 0x24, 0xC9, 0x21, 0x07, 0x40,
+  0x27, 0x69, 0xAA, 0x94, 0xF4, 0xBC, 0x63, 0xEF, 0x04, 0x1A, 0x16, 0x8E, 0xF3, 0x02, 0x8A, 0x72,
+  0x65, 0x70, 0x6C, 0x61, 0x75, 0x73, 0xF5, 0xB3, 0x6E, 0x69, 0x61, 0x6D, 0x2D, 0x61, 0x6C, 0x2D,
+  0x61, 0x2D, 0xF4, 0xC0, 0x2B, 0xE1, 0xF2, 0x02, 0x8B, 0x74, 0x61, 0x70, 0x2D, 0x65, 0x6C, 0x2D,
+  0xF4, 0xC0, 0x2B, 0xD3, 0x69, 0x74, 0xE1, 0x81, 0xEC, 0xC0, 0x34, 0xA3, 0x69, 0x73, 0x61, 0x6D,
+  0x2D, 0x61, 0x6C, 0x2D, 0x61, 0x2D, 0xF4, 0xC0, 0x2B, 0xBD, 0x65, 0x68, 0x74, 0x6E, 0x61, 0xF0,
+  0xBA, 0x32, 0x65, 0x65, 0x72, 0xE7, 0xBB, 0xBA, 0x64, 0xE3, 0x03, 0x0C, 0x84, 0x78, 0xE9, 0x81,
+  0x72, 0x74, 0xF2, 0x81, 0x65, 0xF0, 0xC0, 0x31, 0x73, 0x75, 0xED, 0xA4, 0x5E, 0x68, 0x73, 0xF5,
+  0xC0, 0x2B, 0x7C, 0xE1, 0x03, 0x0F, 0x93, 0xE9, 0x02, 0x85, 0x72, 0x61, 0xF4, 0xA0, 0xD1, 0x63,
+  0x69, 0x73, 0x75, 0xED, 0xBB, 0x8C, 0xE6, 0x02, 0x88, 0x72, 0x61, 0x63, 0x73, 0x61, 0xEE, 0xBB,
+  0x81, 0x2D, 0x73, 0x6C, 0x6C, 0x75, 0xE2, 0xBB, 0x79, 0x63, 0x69, 0x6C, 0x62, 0x75, 0x70, 0x65,
+  0xF2, 0xBB, 0x6F, 0xED, 0x07, 0x10, 0x08, 0x16, 0x05, 0xA1, 0xAA, 0x75, 0x69, 0x72, 0x61, 0x72,
+  0x72, 0x65, 0x74, 0x2D, 0x79, 0x6C, 0x74, 0xF3, 0xC0, 0x2F, 0xA6, 0x73, 0x61, 0x63, 0x72, 0x61,
+  0xF3, 0xBB, 0xA4, 0x72, 0x6F, 0x66, 0xE5, 0x02, 0x89, 0x72, 0x65, 0x72, 0x61, 0x63, 0xAD, 0xC0,
+  0x22, 0x87, 0x70, 0x79, 0x74, 0xAE, 0xC0, 0x20, 0x2A, 0x70, 0x6D, 0xEC, 0xB9, 0x68, 0x6D, 0x65,
+  0xB0, 0x62, 0xEC, 0x08, 0x04, 0x0B, 0x15, 0x08, 0x1E, 0x11, 0x83, 0xF8, 0xC0, 0x27, 0x77, 0x73,
+  0xF3, 0x81, 0x75, 0x6B, 0xEF, 0x81, 0xF2, 0xC0, 0x22, 0x65, 0xF2, 0x02, 0x8A, 0x75, 0xAD, 0x03,
+  0xAA, 0xFA, 0x74, 0xE1, 0xC0, 0x37, 0x30, 0x69, 0x68, 0x77, 0x79, 0xE1, 0xC0, 0x20, 0xC1, 0x70,
+  0x70, 0x6D, 0x73, 0xF7, 0xC0, 0x37, 0x41, 0xEC, 0x02, 0x93, 0x75, 0x66, 0x2D, 0x79, 0x74, 0x6E,
+  0x75, 0x6F, 0xE2, 0x69, 0x81, 0x2E, 0xE1, 0x03, 0xA3, 0xC6, 0xF4, 0xA9, 0xC5, 0x65, 0x63, 0x65,
+  0x6C, 0x66, 0xE6, 0xBC, 0xB5, 0xE9, 0x03, 0xBB, 0x2F, 0x61, 0xED, 0x03, 0xA4, 0xC2, 0x64, 0x65,
+  0x74, 0x73, 0x6F, 0xE8, 0xA3, 0x85, 0xE6, 0xBB, 0x21, 0xE1, 0x04, 0x07, 0xBB, 0x13, 0x72, 0x65,
+  0x62, 0x69, 0xEC, 0xBA, 0xBD, 0x63, 0x6F, 0xEC, 0xA4, 0x9A, 0xEB, 0x0E, 0x20, 0x20, 0x20, 0x80,
+  0x07, 0x06, 0x20, 0x6F, 0x40, 0x33, 0xB9, 0xA1, 0x28, 0xF2, 0x02, 0x92, 0x6F, 0xF7, 0x03, 0xA2,
+  0x39, 0x74, 0x65, 0x6E, 0x2D, 0x6F, 0x72, 0x65, 0x68, 0x6B, 0xE3, 0xC0, 0x35, 0xF0, 0x61, 0x64,
+  0x68, 0x74, 0x69, 0x77, 0x74, 0xEC, 0xC0, 0x2C, 0x32, 0x6C, 0x61, 0x74, 0x73, 0x6E, 0x61, 0x65,
+  0x62, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6C, 0xE5, 0x69, 0x81, 0xAE, 0x03, 0x12, 0x92, 0x33, 0x2D,
+  0x74, 0xF3, 0x02, 0x86, 0x65, 0x77, 0xAD, 0xC0, 0x29, 0x8C, 0x61, 0x65, 0x68, 0xF4, 0xA0, 0x37,
+  0x32, 0x2D, 0x74, 0xF3, 0x02, 0x88, 0x65, 0x77, 0xAD, 0x40, 0x29, 0x7A, 0xA1, 0x21, 0x61, 0xE5,
+  0x19, 0x88, 0x31, 0xAD, 0x04, 0x20, 0x2A, 0x8D, 0x74, 0xF3, 0x02, 0x91, 0x65, 0x77, 0xAD, 0x06,
+  0x40, 0x29, 0x5E, 0xA1, 0x21, 0x76, 0x6F, 0xE7, 0x81, 0xAD, 0xC0, 0x2A, 0x7A, 0x61, 0xE5, 0x02,
+  0x8B, 0x68, 0xF4, 0x02, 0x9D, 0x72, 0x6F, 0x6E, 0xAD, 0xC0, 0x23, 0x6D, 0xAD, 0x40, 0x2A, 0x67,
+  0xA9, 0x22, 0x6C, 0x61, 0x72, 0x74, 0x6E, 0x65, 0x63, 0xAD, 0x40, 0x29, 0x39, 0xAB, 0x33, 0x68,
+  0xF4, 0x81, 0x75, 0x6F, 0x73, 0xAD, 0xC0, 0x23, 0x50, 0x65, 0x65, 0xE7, 0x24, 0x5B, 0xB5, 0x70,
+  0x63, 0x69, 0x6C, 0xF3, 0xBA, 0xCE, 0xE1, 0x03, 0xBA, 0x4E, 0x65, 0x72, 0x66, 0x6F, 0x63, 0xF3,
+  0xC0, 0x2D, 0x4C, 0xEA, 0xA0, 0x64, 0xE9, 0x0B, 0x0F, 0x03, 0x10, 0x05, 0x03, 0x09, 0x22, 0xD7,
+  0xA0, 0xD7, 0xFA, 0x02, 0x86, 0x6E, 0x69, 0xEC, 0xC0, 0x23, 0x1C, 0x69, 0x68, 0xE3, 0xC0, 0x23,
+  0x16, 0xF2, 0xBA, 0x26, 0xF0, 0x02, 0x85, 0x64, 0x65, 0xF4, 0xAD, 0xF4, 0x61, 0x65, 0x72, 0xEF,
+  0x81, 0xE3, 0xBB, 0x61, 0x6B, 0x69, 0xF7, 0xA3, 0xA9, 0xE8, 0xBA, 0x0E, 0x66, 0x69, 0x77, 0x65,
+  0x68, 0xF4, 0xC0, 0x35, 0x76, 0x63, 0x6F, 0x2D, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x73, 0x75, 0xE3,
+  0x6A, 0x81, 0xAE, 0x03, 0x04, 0x84, 0x73, 0x63, 0xEF, 0x62, 0x70, 0x63, 0xEF, 0x62, 0x69, 0x63,
+  0xEF, 0x62, 0xE8, 0x02, 0x83, 0xEF, 0xB9, 0xE2, 0xEE, 0xB9, 0xDF, 0xE7, 0x02, 0x99, 0xEF, 0x02,
+  0x91, 0x6C, 0xE2, 0x03, 0xA3, 0x6A, 0x73, 0x69, 0x68, 0x74, 0x73, 0x65, 0x74, 0x69, 0xF2, 0xC0,
+  0x33, 0x9D, 0x66, 0xE7, 0xC0, 0x35, 0x46, 0x6E, 0xE9, 0x04, 0x0D, 0x0A, 0x83, 0x74, 0x73, 0x6F,
+  0x68, 0x2D, 0x62, 0x74, 0x2E, 0x65, 0xF4, 0xC0, 0x33, 0x66, 0x72, 0x6F, 0x62, 0x73, 0xE9, 0x81,
+  0xEB, 0xC0, 0x2A, 0xF3, 0xEB, 0xA3, 0xA2, 0x67, 0x61, 0x74, 0x73, 0xAD, 0x02, 0x8A, 0x73, 0x77,
+  0x65, 0x6E, 0xEE, 0x81, 0xF7, 0xC0, 0x35, 0x30, 0x72, 0x61, 0x65, 0xE7, 0x81, 0xE8, 0xA7, 0x97,
+  0xE5, 0x13, 0x14, 0x1F, 0x20, 0x39, 0x06, 0x20, 0x27, 0x15, 0x1B, 0x17, 0x15, 0x11, 0x15, 0x09,
+  0x07, 0x20, 0x68, 0x87, 0xFA, 0x03, 0x04, 0x86, 0xE9, 0xC0, 0x24, 0x5B, 0x65, 0x65, 0xEC, 0xC0,
+  0x35, 0x1D, 0x61, 0xED, 0x81, 0xEB, 0xBA, 0xD8, 0xF6, 0x02, 0x90, 0xE9, 0x02, 0x8A, 0x74, 0x61,
+  0x76, 0x72, 0x65, 0x73, 0x6E, 0xEF, 0xB8, 0xF8, 0xEC, 0xA3, 0x4E, 0x61, 0x6C, 0x73, 0x2D, 0x65,
+  0x6C, 0x63, 0x69, 0x62, 0xF5, 0xB8, 0xE9, 0xF4, 0x04, 0x05, 0x09, 0x86, 0x79, 0xF3, 0xC0, 0x34,
+  0xFE, 0x75, 0x70, 0x6D, 0x6F, 0x63, 0xF3, 0xC0, 0x34, 0x5D, 0x6F, 0x6D, 0x65, 0xF2, 0xA2, 0xC2,
+  0xE9, 0x02, 0x96, 0xF3, 0x07, 0x05, 0x04, 0x28, 0xA8, 0xB0, 0x04, 0x78, 0xE9, 0xC0, 0x32, 0xEF,
+  0x74, 0xE9, 0xBF, 0xEE, 0x61, 0xEC, 0xC0, 0x33, 0xE1, 0x6E, 0x75, 0x61, 0x72, 0xE5, 0xBE, 0x50,
+  0x73, 0x72, 0x75, 0xEE, 0xB8, 0xAC, 0xF2, 0x03, 0x07, 0x90, 0x69, 0x68, 0x63, 0xE5, 0xC0, 0x34,
+  0xD2, 0x65, 0x68, 0x77, 0x79, 0x6E, 0x61, 0x6E, 0x6F, 0x68, 0x74, 0x79, 0xF0, 0x69, 0xC0, 0x27,
+  0xB3, 0x61, 0x6C, 0x66, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0xF9, 0xC0, 0x27, 0xB7, 0xEE, 0x04, 0x04,
+  0xB8, 0xD2, 0x6F, 0xE7, 0xB9, 0x4E, 0x69, 0x6C, 0x6E, 0xEF, 0x04, 0xC0, 0x34, 0x09, 0x2D, 0xE5,
+  0xA1, 0x0E, 0xED, 0x04, 0x0C, 0xB8, 0xAF, 0x6F, 0xE8, 0x81, 0xAD, 0x04, 0xC0, 0x25, 0xB6, 0x74,
+  0xE1, 0xA2, 0x4F, 0x69, 0x6E, 0x61, 0x2D, 0x6F, 0x74, 0x6E, 0xE9, 0xB9, 0x27, 0xEC, 0x02, 0x8A,
+  0x67, 0x6F, 0x6F, 0x67, 0x68, 0x74, 0xE9, 0xC0, 0x32, 0x75, 0x62, 0x69, 0x74, 0x70, 0xE1, 0x81,
+  0xAD, 0xC0, 0x34, 0x07, 0xEB, 0x02, 0x8D, 0x69, 0x72, 0x74, 0x73, 0x72, 0x65, 0x74, 0x6E, 0x75,
+  0x6F, 0xE3, 0xB8, 0x83, 0x61, 0x75, 0xF1, 0xB8, 0x7E, 0xE9, 0x02, 0x88, 0x70, 0x2D, 0x73, 0x65,
+  0xEB, 0xC0, 0x2A, 0x3B, 0x68, 0x63, 0x65, 0xF4, 0xB8, 0x18, 0xE7, 0x02, 0x88, 0x6E, 0x61, 0x68,
+  0x63, 0x78, 0xE5, 0xB8, 0x62, 0x64, 0x65, 0x2D, 0x79, 0x6C, 0x74, 0xF3, 0xC0, 0x2C, 0x52, 0x66,
+  0x69, 0x6C, 0x66, 0x6C, 0x61, 0xE8, 0xB8, 0x4F, 0x65, 0x72, 0xE6, 0x21, 0xE5, 0xA0, 0x67, 0xE4,
+  0x69, 0x03, 0xB8, 0x44, 0xEF, 0x03, 0xA0, 0x44, 0xEE, 0x03, 0xA0, 0x25, 0x6E, 0x65, 0x76, 0x65,
+  0xAE, 0x04, 0x07, 0x07, 0x87, 0x34, 0xAD, 0x40, 0x26, 0xFC, 0xA1, 0x21, 0x33, 0xAD, 0x40, 0x26,
+  0xF5, 0xA1, 0x21, 0x32, 0xAD, 0x40, 0x26, 0xEE, 0xA1, 0x21, 0x31, 0xAD, 0x40, 0x26, 0xE7, 0xA1,
+  0x21, 0x69, 0x6C, 0xAE, 0x02, 0x88, 0x73, 0x72, 0x65, 0x62, 0xED, 0xC0, 0x31, 0xA9, 0x72, 0x65,
+  0x63, 0x6E, 0x61, 0x6C, 0x61, 0x62, 0x65, 0x64, 0xEF, 0x81, 0xEE, 0x62, 0xE3, 0x02, 0x86, 0x65,
+  0x6C, 0xE7, 0xC0, 0x20, 0xFF, 0x2E, 0x72, 0x65, 0x64, 0x6C, 0x69, 0x75, 0xE2, 0x6A, 0x81, 0xAD,
+  0x03, 0xA0, 0x84, 0xE7, 0xC0, 0x27, 0x89, 0x63, 0x69, 0x66, 0x66, 0xEF, 0xA1, 0x74, 0x62, 0x75,
+  0x74, 0x75, 0x6F, 0x79, 0x68, 0x74, 0xE9, 0xC0, 0x31, 0xA5, 0xE4, 0x0B, 0x08, 0x07, 0x20, 0x77,
+  0x10, 0x03, 0x10, 0x20, 0x45, 0x93, 0x77, 0x65, 0x74, 0x6F, 0xED, 0xC0, 0x31, 0xFD, 0x76, 0x72,
+  0x65, 0xF3, 0xC0, 0x31, 0xF6, 0x75, 0x6F, 0x6C, 0xE3, 0x09, 0x0B, 0x07, 0x0D, 0x14, 0x06, 0x10,
+  0x0F, 0x84, 0x76, 0x65, 0xE4, 0x04, 0xC0, 0x2E, 0x8F, 0xF0, 0xC0, 0x31, 0x72, 0x74, 0x65, 0x6B,
+  0xE3, 0xC0, 0x2A, 0xB0, 0x73, 0x6D, 0x65, 0x74, 0x73, 0x79, 0x73, 0xF4, 0x81, 0xF5, 0xC0, 0x33,
+  0x6E, 0x70, 0x61, 0x6E, 0x71, 0x79, 0xED, 0x69, 0x81, 0xAD, 0x04, 0xC0, 0x28, 0xA7, 0xE1, 0x81,
+  0x68, 0xF0, 0xC0, 0x33, 0x1B, 0x6E, 0x65, 0xF6, 0xC0, 0x24, 0x85, 0x6D, 0x65, 0x61, 0x65, 0x62,
+  0x6F, 0x64, 0xE1, 0x69, 0x81, 0xAE, 0x81, 0x76, 0x65, 0xE4, 0x62, 0x69, 0x61, 0x66, 0x61, 0x77,
+  0xAE, 0x03, 0xAA, 0x47, 0xE4, 0x26, 0x7D, 0xC0, 0x26, 0x1E, 0xE8, 0xC0, 0x33, 0x1F, 0x2D, 0x6E,
+  0x6F, 0x69, 0x74, 0xE1, 0x81, 0x74, 0x73, 0x79, 0xE1, 0xC0, 0x21, 0x0D, 0xEE, 0x03, 0xB7, 0x38,
+  0x61, 0x62, 0x65, 0x68, 0x74, 0x2D, 0x68, 0x74, 0x69, 0xF7, 0xB7, 0xA8, 0xED, 0xB7, 0x2B, 0xE9,
+  0x03, 0xB7, 0x25, 0x72, 0x67, 0x65, 0x76, 0x69, 0x73, 0x73, 0x61, 0x6D, 0xAE, 0xB0, 0x19, 0xE5,
+  0x07, 0x0C, 0x14, 0x0C, 0xC0, 0x23, 0x8E, 0x74, 0x73, 0x6F, 0x68, 0xE5, 0x81, 0x63, 0x61, 0x70,
+  0xF3, 0xBF, 0xF3, 0x72, 0x65, 0x77, 0x6F, 0x70, 0x65, 0x6E, 0x69, 0x67, 0x6E, 0x65, 0x70, 0xF7,
+  0x69, 0x81, 0x2E, 0xF3, 0xC0, 0x2D, 0xE4, 0xEC, 0x81, 0x6C, 0x6F, 0x72, 0x74, 0x6E, 0x6F, 0xE3,
+  0xC0, 0x31, 0x87, 0x69, 0x66, 0x69, 0x74, 0x72, 0x65, 0x63, 0xAD, 0x04, 0xC0, 0x23, 0x68, 0x74,
+  0x6F, 0xEE, 0xB7, 0x50, 0x61, 0x65, 0x72, 0x6F, 0xF4, 0xB6, 0xE8, 0xE3, 0x0B, 0x03, 0x04, 0x0A,
+  0x08, 0x0A, 0x08, 0x03, 0xC0, 0x32, 0x1C, 0xF3, 0xB6, 0xC0, 0x72, 0xE9, 0xB6, 0xB9, 0xF0, 0x03,
+  0xA0, 0x26, 0x6B, 0x72, 0x6F, 0xF7, 0xBD, 0x69, 0xEE, 0x03, 0xB6, 0xAC, 0xF6, 0xC0, 0x32, 0x11,
+  0x69, 0x74, 0x73, 0x61, 0x6C, 0x65, 0x6A, 0xAE, 0xAF, 0xA2, 0x65, 0x73, 0x79, 0x72, 0xE3, 0xC0,
+  0x32, 0x14, 0xE4, 0xB6, 0x95, 0x61, 0xED, 0x81, 0x79, 0x74, 0x69, 0x72, 0x75, 0x63, 0x65, 0xF3,
+  0xBD, 0xE9, 0xE2, 0x02, 0x88, 0x69, 0x6C, 0x64, 0x74, 0x73, 0xAE, 0xAA, 0x29, 0x65, 0xF7, 0x03,
+  0x06, 0x88, 0x6F, 0x74, 0xF4, 0xC0, 0x2F, 0x46, 0x64, 0x72, 0x61, 0x69, 0xF7, 0xC0, 0x22, 0x63,
+  0xAD, 0xC0, 0x23, 0x64, 0xE1, 0x0E, 0x03, 0x03, 0x0C, 0x09, 0x05, 0x10, 0x03, 0x0F, 0x40, 0x2F,
+  0x3F, 0xA2, 0x4F, 0xF7, 0xB6, 0x54, 0xF6, 0xB6, 0x51, 0x74, 0x61, 0x64, 0x74, 0x73, 0x75, 0x64,
+  0x67, 0x6E, 0xE9, 0xBC, 0xFE, 0xF2, 0x03, 0xB6, 0xDD, 0xEF, 0x81, 0xE4, 0xAE, 0xF6, 0xF0, 0x35,
+  0xDF, 0xA0, 0x5A, 0xED, 0x03, 0xB6, 0x31, 0x61, 0x6C, 0xEC, 0x03, 0xB5, 0xD3, 0x61, 0x6D, 0xE1,
+  0xC0, 0x31, 0x00, 0xE9, 0xB6, 0x24, 0xE7, 0x03, 0xB6, 0x1E, 0x6F, 0x79, 0x2D, 0x73, 0x65, 0x68,
+  0x63, 0xE1, 0xC0, 0x2D, 0xFF, 0xE3, 0x03, 0xB6, 0x0F, 0x69, 0xF2, 0x04, 0xC0, 0x31, 0x2A, 0x62,
+  0x61, 0xE6, 0xC0, 0x31, 0x76, 0xB5, 0x81, 0xF3, 0xBE, 0x20, 0x33, 0x70, 0xED, 0xB5, 0xF8, 0x32,
+  0xE1, 0xC0, 0x31, 0x80, 0xAE, 0x0C, 0x06, 0x40, 0x2E, 0xD8, 0x21, 0x2C, 0x21, 0x8D, 0x06, 0xA0,
+  0x2A, 0xEF, 0x40, 0x31, 0x0F, 0xA0, 0xAF, 0xED, 0x04, 0xC0, 0x31, 0xB2, 0xF5, 0x81, 0xE5, 0xC0,
+  0x28, 0xE0, 0xEC, 0x04, 0xC0, 0x29, 0x32, 0x6F, 0x68, 0x6B, 0xE3, 0xC0, 0x2B, 0x72, 0xEB, 0x69,
+  0x81, 0xAE, 0x10, 0x1D, 0x03, 0x08, 0x27, 0x2C, 0x30, 0x1D, 0x05, 0x31, 0x23, 0x28, 0xD3, 0x20,
+  0x24, 0x86, 0xF3, 0x05, 0x0D, 0xC0, 0x30, 0x96, 0xEE, 0x81, 0x65, 0xE9, 0x81, 0xE3, 0x81, 0x61,
+  0x6D, 0x72, 0xE1, 0xBC, 0xFA, 0xE5, 0x81, 0x72, 0x69, 0xE1, 0x81, 0xF4, 0xC0, 0x31, 0x09, 0xF0,
+  0xA8, 0x1E, 0xEE, 0x81, 0x69, 0x63, 0xE5, 0xC0, 0x2E, 0x88, 0xE5, 0x04, 0xC0, 0x2F, 0xAF, 0x72,
+  0x69, 0x61, 0x6E, 0x69, 0x72, 0x65, 0xF4, 0xB6, 0x7D, 0xEA, 0x62, 0xE9, 0x69, 0x05, 0x0A, 0xC0,
+  0x2D, 0xE2, 0x72, 0x62, 0x67, 0x34, 0x2D, 0x2D, 0xEE, 0xC0, 0x32, 0x66, 0xAE, 0x0A, 0x05, 0x40,
+  0x2F, 0x2A, 0x20, 0x5F, 0x21, 0xA7, 0x8C, 0xF4, 0x40, 0x31, 0x2C, 0x9F, 0xEF, 0x04, 0xC0, 0x31,
+  0x29, 0xE3, 0x69, 0x81, 0xAE, 0x03, 0xB6, 0xF7, 0xE3, 0xBF, 0x1D, 0xE7, 0x69, 0x81, 0x76, 0x75,
+  0x39, 0x36, 0x64, 0x38, 0x73, 0x79, 0xFA, 0xC0, 0x32, 0x2A, 0xE6, 0x69, 0x04, 0xC0, 0x30, 0x10,
+  0xAE, 0x09, 0x36, 0x0F, 0x39, 0x42, 0x21, 0x93, 0x1E, 0x8C, 0xEF, 0xA0, 0x6B, 0xE4, 0x69, 0xC0,
+  0x2A, 0x8F, 0xE3, 0x69, 0x81, 0xAE, 0x40, 0x2F, 0x45, 0x21, 0x8D, 0x20, 0x24, 0x82, 0xE2, 0x69,
+  0x40, 0x2A, 0x7E, 0xA5, 0x72, 0xE1, 0x69, 0x09, 0x04, 0x20, 0x22, 0x08, 0x05, 0xC0, 0x30, 0xF1,
+  0xE6, 0xC0, 0x30, 0x33, 0xE5, 0x02, 0x9B, 0xF4, 0x69, 0x81, 0xAE, 0x02, 0x8C, 0x65, 0x73, 0xF2,
+  0x81, 0x75, 0xEF, 0x81, 0x63, 0xF3, 0xC0, 0x24, 0xE5, 0xE3, 0x81, 0x69, 0x74, 0x73, 0xE1, 0xC0,
+  0x2A, 0x2F, 0xF2, 0xC0, 0x2F, 0xEA, 0x64, 0x72, 0x65, 0x74, 0xF3, 0xC0, 0x30, 0x09, 0xE3, 0x69,
+  0xC0, 0x2B, 0x9E, 0xAE, 0x08, 0x0D, 0x04, 0x40, 0x30, 0x77, 0x18, 0x8C, 0xEF, 0x05, 0x04, 0xC0,
+  0x30, 0x9A, 0xEB, 0xC0, 0x30, 0x91, 0xE9, 0xA3, 0x87, 0xE5, 0xC0, 0x20, 0x7B, 0x61, 0xE1, 0xC0,
+  0x27, 0x43, 0x39, 0x38, 0x31, 0x72, 0x76, 0x6A, 0x2D, 0x2D, 0xEE, 0xC0, 0x31, 0xA4, 0x30, 0x30,
+  0x74, 0x73, 0x62, 0x33, 0x2D, 0x2D, 0xEE, 0xC0, 0x31, 0x98, 0xEC, 0x1D, 0x08, 0x0F, 0x08, 0x05,
+  0x08, 0x25, 0x84, 0x20, 0x2C, 0x20, 0x34, 0x14, 0x20, 0x39, 0x20, 0x51, 0x06, 0x13, 0x16, 0x20,
+  0x36, 0x03, 0x0E, 0x20, 0x97, 0xC0, 0x22, 0x23, 0x79, 0x63, 0x35, 0x72, 0xE2, 0xC0, 0x29, 0x76,
+  0x78, 0x33, 0x62, 0x36, 0x38, 0x39, 0x71, 0x71, 0x36, 0x2D, 0x2D, 0xEE, 0xC0, 0x31, 0x63, 0x75,
+  0x62, 0x6E, 0x61, 0xF4, 0xC0, 0x20, 0xF3, 0xF4, 0x69, 0xC0, 0x26, 0x53, 0xF2, 0x40, 0x2D, 0x69,
+  0x21, 0xAA, 0xA0, 0xC3, 0xF0, 0x69, 0x04, 0xC0, 0x2F, 0x3F, 0xAE, 0x20, 0x23, 0x20, 0x3D, 0x20,
+  0x59, 0x04, 0x20, 0x50, 0x20, 0xE5, 0x19, 0x0A, 0x20, 0x26, 0x20, 0x64, 0x20, 0x59, 0x1F, 0x10,
+  0x20, 0x62, 0x1B, 0x0A, 0x1B, 0x20, 0x82, 0x1A, 0x20, 0x25, 0x09, 0xC0, 0x2B, 0x70, 0xFA, 0x07,
+  0x11, 0x08, 0x14, 0xC0, 0x2B, 0x0B, 0xF3, 0x02, 0x86, 0x75, 0x6B, 0xEC, 0xC0, 0x30, 0x00, 0xE9,
+  0x04, 0xC0, 0x2F, 0x96, 0xEC, 0xB6, 0x03, 0x64, 0x61, 0x6C, 0x65, 0xFA, 0xC0, 0x2F, 0xE4, 0xE3,
+  0x03, 0x09, 0x84, 0x7A, 0x73, 0x6F, 0x67, 0x64, 0xF9, 0xC0, 0x2F, 0xC9, 0x69, 0xF7, 0xBF, 0xA6,
+  0x61, 0xF0, 0x96, 0x61, 0x6D, 0x2D, 0x61, 0xF7, 0xC0, 0x24, 0x4E, 0xF9, 0x08, 0x07, 0x06, 0x0D,
+  0x04, 0x15, 0x07, 0x8F, 0x7A, 0x75, 0xF4, 0x81, 0xF2, 0xB5, 0xCF, 0x77, 0x61, 0xEC, 0xC0, 0x2C,
+  0xD6, 0xF2, 0x02, 0x85, 0x75, 0xFA, 0xC0, 0x25, 0x33, 0x6F, 0xE7, 0xC0, 0x2F, 0xB8, 0xF0, 0xC0,
+  0x2E, 0x86, 0xEE, 0x02, 0x8E, 0x6C, 0x6F, 0x64, 0x2D, 0x7A, 0x72, 0x65, 0x69, 0x6D, 0xE9, 0x81,
+  0xFA, 0xB5, 0xA7, 0xEA, 0xC0, 0x2B, 0x93, 0x68, 0xE3, 0x81, 0xF9, 0xC0, 0x2F, 0x98, 0xE4, 0x02,
+  0x85, 0x69, 0x6B, 0xF3, 0xA2, 0x2C, 0x61, 0x7A, 0x63, 0x7A, 0xF3, 0xA4, 0x20, 0x62, 0x75, 0xFA,
+  0x81, 0xF3, 0xB5, 0x86, 0xF8, 0xC0, 0x2B, 0x72, 0xF7, 0x03, 0xA0, 0x39, 0xEF, 0x05, 0x0E, 0x0C,
+  0x09, 0x8D, 0xFA, 0x02, 0x86, 0x73, 0x65, 0xFA, 0xC0, 0x2F, 0x52, 0xE3, 0x81, 0xEF, 0xBA, 0x7F,
+  0xF4, 0x02, 0x85, 0x73, 0x75, 0xE7, 0xBC, 0x95, 0x72, 0xE1, 0xA2, 0x09, 0xF2, 0x04, 0xC0, 0x2C,
+  0x91, 0xE7, 0xC0, 0x2A, 0x2E, 0xEB, 0x06, 0x22, 0x7F, 0xC0, 0x29, 0x03, 0x7A, 0x73, 0xF5, 0xC0,
+  0x2E, 0x82, 0xE7, 0xA6, 0x82, 0xE1, 0x04, 0xC0, 0x2D, 0x22, 0xEC, 0x02, 0x88, 0x73, 0x69, 0x7A,
+  0x64, 0xEF, 0xC0, 0x2D, 0x1A, 0xE3, 0xA3, 0x60, 0xF6, 0x04, 0xC0, 0x22, 0x4B, 0x6F, 0xE7, 0x69,
+  0x81, 0xAE, 0x14, 0x06, 0x20, 0x21, 0x07, 0x0E, 0x0A, 0x1E, 0x16, 0x05, 0x13, 0x06, 0x0B, 0x05,
+  0x07, 0x06, 0x08, 0xC0, 0x26, 0x7B, 0x7A, 0x6F, 0xF5, 0xC0, 0x2C, 0xF3, 0xF7, 0x07, 0x09, 0x03,
+  0x08, 0xC0, 0x2E, 0xDE, 0xF5, 0x69, 0x81, 0x69, 0x6D, 0xFA, 0xC0, 0x2C, 0xE2, 0xEF, 0xA0, 0x5E,
+  0xE9, 0x40, 0x29, 0xA5, 0x23, 0x36, 0xA1, 0xAE, 0x67, 0xFA, 0xC0, 0x2E, 0xD0, 0x74, 0x61, 0x6C,
+  0x75, 0xF3, 0xA3, 0xBD, 0xF3, 0x08, 0x40, 0x2B, 0x54, 0x21, 0x6D, 0xA1, 0x02, 0x6F, 0xE9, 0xC0,
+  0x2C, 0xBD, 0xF2, 0x04, 0xC0, 0x2E, 0x5C, 0x6B, 0xF3, 0xC0, 0x2C, 0xB3, 0xF0, 0x08, 0x06, 0x07,
+  0x40, 0x2B, 0xF2, 0xA2, 0xC1, 0xF5, 0x40, 0x2E, 0x54, 0xA0, 0x5C, 0x73, 0xF0, 0x69, 0x04, 0x04,
+  0xB4, 0x70, 0xF7, 0xC0, 0x2B, 0x3B, 0xED, 0xC0, 0x2B, 0x37, 0xEF, 0x06, 0x08, 0x39, 0xB4, 0xB4,
+  0x76, 0x77, 0x74, 0x73, 0x6F, 0xF2, 0xC0, 0x2D, 0xB5, 0xF0, 0x69, 0x81, 0xF0, 0xC0, 0x2C, 0x81,
+  0x6E, 0xE4, 0xC0, 0x2E, 0x21, 0xED, 0x03, 0x05, 0x85, 0xF5, 0x69, 0xC0, 0x2E, 0x81, 0x72, 0xE9,
+  0xC0, 0x2E, 0x7C, 0x69, 0xE7, 0xC0, 0x2C, 0x69, 0x68, 0x69, 0xE9, 0xC0, 0x2C, 0x61, 0xE7, 0x04,
+  0xC0, 0x2C, 0x5B, 0xE9, 0x81, 0xED, 0xC0, 0x2C, 0x58, 0x66, 0xE9, 0xC0, 0x2C, 0x51, 0x65, 0xF3,
+  0x81, 0xF3, 0xC0, 0x2D, 0xF8, 0x64, 0x74, 0xE9, 0xC0, 0x2C, 0x44, 0x62, 0x6E, 0xE9, 0x40, 0x2C,
+  0x3E, 0xA1, 0xAE, 0xE1, 0x04, 0xC0, 0x2D, 0xE2, 0xF3, 0x69, 0xC0, 0x2C, 0x32, 0xF4, 0x08, 0x06,
+  0x04, 0x40, 0x27, 0xF8, 0xA6, 0x1C, 0x73, 0x65, 0xFA, 0xC0, 0x2E, 0x27, 0x6F, 0xF0, 0xBA, 0x5C,
+  0x61, 0x69, 0xF7, 0xC0, 0x2A, 0xCD, 0x72, 0x6F, 0x6D, 0x6F, 0x70, 0x68, 0xE3, 0xC0, 0x2B, 0x65,
+  0xF0, 0x03, 0x12, 0x86, 0x6F, 0x68, 0xF3, 0x69, 0x04, 0xC0, 0x2D, 0x8B, 0x2D, 0x65, 0x63, 0x72,
+  0x65, 0x6D, 0x6D, 0xEF, 0xA9, 0x84, 0x6B, 0x6C, 0x77, 0xF7, 0xA3, 0x37, 0xE5, 0x03, 0xA0, 0xA0,
+  0x6C, 0x6B, 0xF3, 0x69, 0xB9, 0x75, 0xEF, 0x0D, 0x11, 0x03, 0x20, 0x2C, 0x06, 0x40, 0x28, 0x7F,
+  0x23, 0xA9, 0xA1, 0x6E, 0xF7, 0x02, 0x87, 0x6F, 0x67, 0x61, 0xF2, 0xC0, 0x2D, 0xDB, 0x65, 0xEA,
+  0x81, 0xE1, 0xC0, 0x28, 0x94, 0xF4, 0xBB, 0x15, 0xEE, 0x04, 0x13, 0x0A, 0x85, 0xFA, 0x03, 0x06,
+  0x86, 0x72, 0x6F, 0xF7, 0xC0, 0x28, 0xD2, 0x65, 0x69, 0xEE, 0xC0, 0x2D, 0x92, 0xE3, 0xA1, 0x86,
+  0xF4, 0x04, 0xC0, 0x21, 0xAD, 0x79, 0x7A, 0xE3, 0xA2, 0xA4, 0x70, 0xE5, 0xC0, 0x2A, 0x42, 0x6C,
+  0xE5, 0xC0, 0x2D, 0xA3, 0xEC, 0x81, 0xEB, 0xC0, 0x2B, 0xB9, 0xEB, 0x02, 0x87, 0x7A, 0x64, 0x6F,
+  0xEC, 0xC0, 0x2A, 0x2D, 0x63, 0x65, 0xEC, 0xC0, 0x2D, 0x95, 0xEE, 0x05, 0x18, 0x07, 0xA0, 0x28,
+  0xF9, 0x02, 0x8E, 0xFA, 0x02, 0x85, 0x73, 0xE5, 0xC0, 0x24, 0xA4, 0x72, 0x74, 0xE5, 0xC0, 0x2A,
+  0x10, 0x74, 0x7A, 0x73, 0xEC, 0xC0, 0x2D, 0x77, 0x75, 0x6C, 0x65, 0xE9, 0xC0, 0x2B, 0x60, 0xE9,
+  0x07, 0x0D, 0x07, 0x02, 0x06, 0xA2, 0x2C, 0x7A, 0xE4, 0x02, 0x85, 0x6F, 0x62, 0xE5, 0xA2, 0xA5,
+  0xE5, 0xC0, 0x2D, 0x41, 0x6D, 0x6F, 0x6C, 0xEF, 0xC0, 0x2B, 0x44, 0xEC, 0x87, 0x63, 0x65, 0x7A,
+  0xE3, 0xA2, 0x3B, 0xE2, 0xC0, 0x29, 0x8A, 0xE1, 0x02, 0x85, 0x6E, 0xFA, 0xC0, 0x29, 0xE4, 0xE7,
+  0xC0, 0x2A, 0x82, 0xED, 0x03, 0x05, 0x86, 0xF4, 0x69, 0xC0, 0x2D, 0x3C, 0xF3, 0x28, 0xBB, 0xC0,
+  0x24, 0x44, 0xEF, 0x06, 0x05, 0x40, 0x2D, 0x08, 0x8A, 0x74, 0xF9, 0xC0, 0x2D, 0x07, 0xE4, 0xC0,
+  0x21, 0x97, 0xEC, 0x04, 0x06, 0xA0, 0x61, 0xE9, 0x40, 0x22, 0x91, 0xAA, 0x7D, 0xE5, 0x3E, 0x67,
+  0xAE, 0x95, 0xEB, 0x09, 0x20, 0x23, 0x08, 0x0C, 0x13, 0xC0, 0x20, 0x86, 0xF3, 0x05, 0x08, 0x05,
+  0x06, 0x86, 0x72, 0x6F, 0x77, 0x65, 0xFA, 0xC0, 0x2C, 0x3A, 0x70, 0xF5, 0xC0, 0x2A, 0xA5, 0x6E,
+  0x61, 0xE4, 0xC0, 0x2C, 0xBA, 0x6A, 0x61, 0xFA, 0xC0, 0x23, 0xC1, 0xE1, 0xC0, 0x2A, 0x95, 0x72,
+  0x6F, 0xE2, 0x21, 0xE4, 0xC0, 0x21, 0xD3, 0xEF, 0x03, 0xA9, 0xC1, 0x74, 0x73, 0x79, 0x6C, 0xE1,
+  0xC0, 0x27, 0xFE, 0x69, 0xEE, 0x04, 0x07, 0xA2, 0x01, 0xF3, 0x81, 0x61, 0xF2, 0xC0, 0x29, 0x51,
+  0xE2, 0x81, 0xF9, 0xC0, 0x2C, 0xA7, 0xE5, 0x03, 0xA1, 0xB0, 0x77, 0x61, 0xEC, 0x81, 0x63, 0x6F,
+  0xEC, 0xC0, 0x2A, 0x9B, 0xE9, 0x03, 0x07, 0x83, 0x6B, 0x6C, 0x61, 0xF7, 0xC0, 0x27, 0xED, 0xE7,
+  0xA0, 0x28, 0x63, 0x73, 0x6F, 0x6D, 0x6F, 0x68, 0x63, 0x75, 0x72, 0xE5, 0xC0, 0x2B, 0x38, 0x68,
+  0x63, 0x79, 0x7A, 0x72, 0xE2, 0x81, 0xEC, 0xB2, 0x21, 0xE7, 0x05, 0x0F, 0xC0, 0x2C, 0x6C, 0x65,
+  0x7A, 0x72, 0x62, 0xEF, 0x02, 0x85, 0xEE, 0x81, 0xF2, 0xBB, 0xB4, 0xEC, 0xB6, 0xFE, 0x61, 0x6C,
+  0xE2, 0xC0, 0x20, 0x3B, 0xE5, 0x06, 0x0B, 0x13, 0x08, 0x0C, 0x9C, 0xFA, 0x03, 0xA0, 0x3C, 0x73,
+  0x77, 0x6F, 0xFA, 0xC0, 0x21, 0xD6, 0xF4, 0x02, 0x8A, 0x69, 0xF3, 0x81, 0x65, 0x6C, 0x70, 0xED,
+  0xC0, 0x2A, 0x1D, 0x61, 0x74, 0x73, 0xE5, 0xB6, 0x01, 0x6E, 0x61, 0x70, 0x6F, 0xEB, 0xC0, 0x29,
+  0x84, 0xEC, 0x02, 0x83, 0xEF, 0xB5, 0x99, 0x61, 0x68, 0xE4, 0xC0, 0x28, 0xD6, 0xE9, 0x03, 0x07,
+  0x89, 0x73, 0x61, 0x6C, 0xE4, 0xC0, 0x28, 0xCB, 0x6B, 0xF3, 0x81, 0x72, 0x6F, 0xED, 0xC0, 0x28,
+  0xC2, 0x63, 0x73, 0x6A, 0x75, 0x6F, 0xEE, 0xA1, 0x5C, 0xE3, 0x02, 0x88, 0x79, 0x7A, 0x72, 0x65,
+  0x69, 0xE2, 0xB6, 0x98, 0xE9, 0x02, 0x99, 0xF7, 0x03, 0xB8, 0x95, 0xEF, 0x03, 0x03, 0x84, 0xF4,
+  0xB2, 0x08, 0xEB, 0xC0, 0x28, 0x9B, 0x68, 0xE3, 0x03, 0xB4, 0xA5, 0x61, 0xF2, 0xC0, 0x2B, 0x0E,
+  0xEC, 0x81, 0xF2, 0xC0, 0x2B, 0xB7, 0xE4, 0x06, 0x0C, 0x3D, 0x04, 0xAC, 0x87, 0x75, 0x6F, 0x6C,
+  0xE3, 0x03, 0xA7, 0x0F, 0x73, 0xE4, 0xC0, 0x2B, 0x6D, 0x72, 0x61, 0x67, 0xF2, 0xC0, 0x2A, 0xEE,
+  0xE3, 0x05, 0x05, 0xC0, 0x2B, 0x5F, 0x6F, 0xF2, 0xC0, 0x29, 0xB4, 0xE5, 0x02, 0x8D, 0x6C, 0xE5,
+  0x04, 0xC0, 0x2B, 0xB0, 0x7A, 0x72, 0x6F, 0xE7, 0xC0, 0x28, 0xFC, 0x69, 0xF7, 0x02, 0x89, 0xEF,
+  0x03, 0xA0, 0xE0, 0xEE, 0x81, 0xF3, 0xB7, 0xD4, 0x61, 0x6C, 0x73, 0xE5, 0xAF, 0x95, 0xE1, 0x0E,
+  0x0F, 0x20, 0x23, 0x07, 0x04, 0x16, 0x10, 0x20, 0x20, 0x20, 0x26, 0x10, 0x92, 0xFA, 0x02, 0x83,
+  0xED, 0xBB, 0x53, 0x65, 0x69, 0x77, 0x6F, 0x6C, 0xE1, 0xC0, 0x26, 0xB5, 0xF7, 0x02, 0x8D, 0xEF,
+  0x02, 0x87, 0x74, 0x61, 0x69, 0xEE, 0xC0, 0x28, 0x1A, 0xEE, 0xBA, 0x2F, 0xE1, 0x02, 0x85, 0x7A,
+  0x73, 0xF2, 0xB1, 0x06, 0xEC, 0x06, 0x40, 0x2A, 0x55, 0xA1, 0x0C, 0xE5, 0xC0, 0x26, 0x92, 0xF4,
+  0x81, 0x73, 0xE1, 0xC0, 0x2B, 0x51, 0xF3, 0xC0, 0x21, 0xFB, 0x72, 0x6F, 0xE7, 0x06, 0x40, 0x26,
+  0x55, 0xA2, 0x3C, 0x2D, 0x61, 0xE9, 0x02, 0x84, 0xEE, 0xC0, 0x24, 0xA3, 0xE2, 0xC0, 0x2A, 0x9F,
+  0xEE, 0x03, 0x04, 0x83, 0xFA, 0xC0, 0x22, 0x12, 0xE9, 0xAA, 0xCC, 0x65, 0x72, 0xE1, 0xB6, 0x22,
+  0xEC, 0x04, 0xC0, 0x25, 0xBD, 0xEF, 0x02, 0x92, 0xF7, 0x02, 0x87, 0x6F, 0x6B, 0xF3, 0x81, 0xEE,
+  0xB5, 0xAA, 0x2D, 0x61, 0x77, 0x6F, 0xEC, 0xC0, 0x2A, 0x34, 0xEB, 0x81, 0xFA, 0xC0, 0x2A, 0xA6,
+  0xEB, 0x04, 0x08, 0x03, 0x8A, 0x79, 0x74, 0x73, 0xF9, 0x81, 0xF2, 0xAE, 0x85, 0xF4, 0xBF, 0x06,
+  0x73, 0x6C, 0x6F, 0x70, 0xEF, 0x81, 0xEC, 0xC0, 0x20, 0x72, 0x65, 0x6C, 0xEF, 0x03, 0xA0, 0x23,
+  0x67, 0x75, 0xEC, 0xC0, 0x28, 0xE1, 0xE9, 0x05, 0x06, 0xC0, 0x27, 0xED, 0x6E, 0x79, 0xE4, 0xC0,
+  0x2A, 0xAD, 0x6D, 0xF2, 0xB0, 0x74, 0xE4, 0x05, 0x05, 0xC0, 0x2A, 0x9B, 0x75, 0x72, 0xE1, 0xAD,
+  0x1E, 0xEF, 0x81, 0x72, 0xF4, 0xC0, 0x29, 0x69, 0x63, 0x69, 0xEE, 0x02, 0x84, 0xE7, 0xC0, 0x21,
+  0x9B, 0xE4, 0x81, 0x69, 0xF7, 0xC0, 0x2A, 0x4E, 0xEF, 0x09, 0x04, 0x11, 0x08, 0x40, 0x28, 0x7F,
+  0xA2, 0x17, 0xF2, 0xC0, 0x2A, 0xAE, 0xEF, 0x04, 0xC0, 0x28, 0xA8, 0xE3, 0x69, 0x81, 0xAE, 0x04,
+  0xC0, 0x27, 0x7D, 0x72, 0xEF, 0xBE, 0x61, 0xEC, 0x69, 0x81, 0x2E, 0xE7, 0xC0, 0x29, 0x88, 0xE2,
+  0x81, 0xF4, 0xBF, 0xB8, 0xEE, 0x69, 0x04, 0xC0, 0x2A, 0x82, 0xAE, 0x0D, 0x07, 0x0E, 0x3C, 0x6B,
+  0x14, 0x14, 0x28, 0x94, 0x25, 0x04, 0xA0, 0x26, 0x79, 0x61, 0x6C, 0xF0, 0xC0, 0x26, 0xCF, 0x72,
+  0x65, 0x74, 0x73, 0x75, 0x6C, 0x63, 0x2D, 0x67, 0x6E, 0x69, 0xF4, 0xA2, 0x53, 0x6E, 0xEF, 0x03,
+  0xA7, 0x7A, 0x72, 0x74, 0xF3, 0xC0, 0x21, 0x77, 0xED, 0x69, 0x81, 0xAE, 0x0A, 0x27, 0xD7, 0x40,
+  0x20, 0xAE, 0x21, 0x93, 0x1E, 0x8C, 0xF6, 0x27, 0xCB, 0xC0, 0x22, 0x48, 0xEC, 0x06, 0x0B, 0x06,
+  0xC0, 0x25, 0x34, 0x69, 0x68, 0x6D, 0x61, 0x69, 0x6C, 0x6C, 0xE9, 0xC0, 0x28, 0x21, 0xE5, 0x40,
+  0x28, 0x25, 0xA0, 0xEB, 0xE1, 0x06, 0x40, 0x21, 0x25, 0xA8, 0xF0, 0xE2, 0x04, 0xC0, 0x21, 0xAA,
+  0xF4, 0x03, 0xA3, 0x06, 0x65, 0x6B, 0x73, 0x61, 0xE2, 0x69, 0x81, 0xAE, 0x02, 0x84, 0xFA, 0xC0,
+  0x29, 0xF7, 0xF3, 0xB7, 0x48, 0xE9, 0x69, 0x06, 0x0C, 0x40, 0x29, 0xE1, 0x8C, 0xE1, 0x04, 0xC0,
+  0x28, 0xCE, 0xED, 0x23, 0xA8, 0x40, 0x26, 0x21, 0x86, 0xAE, 0x0E, 0x20, 0x25, 0x06, 0x40, 0x21,
+  0x4B, 0x26, 0xAD, 0x0A, 0x21, 0x83, 0xA0, 0x30, 0x6F, 0xE3, 0x69, 0x81, 0xAE, 0x03, 0x0D, 0x8A,
+  0xF4, 0x04, 0xC0, 0x29, 0xB2, 0xE9, 0x81, 0x62, 0x61, 0xF4, 0xC0, 0x29, 0x54, 0x72, 0x65, 0x64,
+  0x72, 0x6F, 0x74, 0x69, 0xE2, 0xB9, 0x08, 0x65, 0x67, 0x61, 0xF0, 0xBE, 0x39, 0xE9, 0x81, 0xEE,
+  0xC0, 0x20, 0xE1, 0xE6, 0xA3, 0xA3, 0xE8, 0x40, 0x26, 0x59, 0xA1, 0x54, 0xE7, 0x69, 0x81, 0xAE,
+  0x0B, 0x40, 0x23, 0x51, 0x24, 0x8F, 0x21, 0x93, 0x1E, 0x02, 0x8A, 0xF8, 0xC0, 0x2A, 0xB3, 0xE6,
+  0x05, 0x40, 0x29, 0x81, 0x9F, 0x38, 0xE6, 0x04, 0xC0, 0x23, 0xB3, 0x70, 0x62, 0x67, 0x6F, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x2A, 0x9D, 0xE5, 0x06, 0x08, 0x20, 0x22, 0xBA, 0xAF, 0xF4, 0x69, 0x03, 0xBA,
+  0xAA, 0xF4, 0xBE, 0xF7, 0xEE, 0x02, 0x9B, 0x6E, 0x61, 0x68, 0xE3, 0x69, 0x04, 0x09, 0xBA, 0xB8,
+  0x72, 0x65, 0x68, 0xF4, 0x81, 0xE1, 0xC0, 0x24, 0x4A, 0x67, 0x6E, 0x69, 0xEB, 0x81, 0xEF, 0xC0,
+  0x29, 0x4F, 0xE1, 0xC0, 0x25, 0xB5, 0x64, 0xE1, 0xC0, 0x20, 0x72, 0xE4, 0xBF, 0x30, 0xE3, 0x69,
+  0x81, 0xAE, 0x40, 0x24, 0x12, 0x22, 0xF3, 0x22, 0x11, 0x20, 0x26, 0x84, 0xE1, 0x69, 0x0E, 0x15,
+  0x20, 0x2D, 0x0C, 0x20, 0x25, 0x04, 0x07, 0x40, 0x25, 0x96, 0xA3, 0x10, 0x75, 0x74, 0x75, 0xED,
+  0x69, 0x81, 0x6E, 0x72, 0x65, 0x74, 0x73, 0x65, 0xF7, 0x81, 0x68, 0xF4, 0x81, 0xF2, 0xC0, 0x28,
+  0xA7, 0xF4, 0x05, 0x04, 0xC0, 0x28, 0xCA, 0xEE, 0xC0, 0x25, 0xF8, 0xE9, 0x02, 0x86, 0xF0, 0x20,
+  0xFF, 0xC0, 0x26, 0x28, 0x67, 0x69, 0xE4, 0x69, 0x81, 0x2E, 0x73, 0x70, 0x70, 0x61, 0x64, 0x75,
+  0x6F, 0x6C, 0xE3, 0x69, 0x81, 0x2E, 0x6E, 0xEF, 0x81, 0xE4, 0x81, 0xEE, 0xB8, 0xB8, 0xEE, 0x04,
+  0xC0, 0x20, 0x66, 0x6F, 0x69, 0x74, 0x61, 0xEE, 0xB8, 0x10, 0xE9, 0x03, 0x08, 0x86, 0x74, 0x6E,
+  0x65, 0x64, 0xF5, 0xC0, 0x28, 0x1E, 0x72, 0x6F, 0xED, 0xC0, 0x26, 0x8B, 0xE3, 0x03, 0xB4, 0xFA,
+  0x6E, 0x61, 0x6E, 0x69, 0xE6, 0x69, 0x03, 0xBA, 0x58, 0xEC, 0x81, 0xF0, 0xC0, 0x27, 0xCD, 0xE7,
+  0x69, 0xBF, 0x98, 0xE2, 0x81, 0x6F, 0xEC, 0xC0, 0x28, 0x85, 0xAE, 0x40, 0x28, 0x7D, 0x06, 0x06,
+  0x18, 0x06, 0x86, 0x30, 0x34, 0x73, 0x72, 0x34, 0x77, 0x2D, 0x2D, 0xEE, 0xC0, 0x29, 0xB3, 0xEB,
+  0x1C, 0x21, 0x5C, 0x05, 0x20, 0x31, 0x20, 0x2B, 0x04, 0x20, 0x35, 0x0F, 0x20, 0x33, 0x0B, 0x20,
+  0x9A, 0x0B, 0x20, 0x29, 0x20, 0x25, 0x05, 0x08, 0x34, 0x03, 0xB1, 0x41, 0xF5, 0x69, 0x81, 0xAE,
+  0x12, 0x16, 0x09, 0x20, 0x21, 0x15, 0x05, 0x06, 0x20, 0x6F, 0x17, 0x14, 0x04, 0x20, 0x39, 0x0A,
+  0xAC, 0xEC, 0xF9, 0x04, 0xC0, 0x27, 0xC2, 0x72, 0x69, 0x75, 0x71, 0x6E, 0x69, 0xAD, 0x03, 0xA0,
+  0xDE, 0x63, 0xE9, 0x81, 0xEC, 0xC0, 0x25, 0x6D, 0x77, 0x65, 0x69, 0x76, 0x65, 0x72, 0xAD, 0xA0,
+  0xD0, 0x76, 0x6F, 0xE7, 0x69, 0x81, 0xAE, 0x03, 0x0A, 0x83, 0x6E, 0x67, 0x69, 0xE1, 0x81, 0x70,
+  0xED, 0xC0, 0x26, 0x55, 0xE9, 0xB5, 0x41, 0x65, 0x63, 0xE9, 0x03, 0xB3, 0xB6, 0x66, 0x66, 0xEF,
+  0xB3, 0xA9, 0xF4, 0x05, 0x09, 0xC0, 0x28, 0x03, 0x73, 0x65, 0x75, 0x71, 0x6E, 0x69, 0xAD, 0xA0,
+  0xA0, 0x6E, 0x6D, 0xF9, 0xC0, 0x27, 0xB6, 0x73, 0xE8, 0xC0, 0x27, 0xFD, 0xF0, 0x81, 0xF3, 0xC0,
+  0x27, 0x25, 0xEF, 0x02, 0x85, 0x72, 0xF0, 0xC0, 0x27, 0xF7, 0xE3, 0x69, 0x81, 0xAE, 0x0A, 0x09,
+  0x12, 0x08, 0x13, 0x17, 0x40, 0x27, 0x02, 0x98, 0x76, 0x72, 0x65, 0x73, 0x2D, 0xE8, 0xC0, 0x27,
+  0xD8, 0xF4, 0x04, 0xC0, 0x27, 0xC1, 0x66, 0x69, 0x68, 0x73, 0x72, 0x65, 0x79, 0x61, 0x6C, 0xAE,
+  0xC0, 0x22, 0xE8, 0x6F, 0x6D, 0xE9, 0x81, 0xE4, 0xC0, 0x27, 0xDD, 0x6B, 0x72, 0x61, 0x6D, 0x65,
+  0x74, 0x79, 0x62, 0xAE, 0x02, 0x84, 0xED, 0xC0, 0x26, 0x63, 0xE8, 0xC0, 0x25, 0xB9, 0x65, 0xEE,
+  0x02, 0x8C, 0x6F, 0x7A, 0x67, 0x6E, 0x69, 0x65, 0x62, 0x6C, 0xEC, 0xC0, 0x22, 0x95, 0x69, 0x6C,
+  0x6E, 0xEF, 0xC0, 0x27, 0x05, 0x62, 0x75, 0x6E, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x72, 0xAE, 0xB7,
+  0x57, 0xEE, 0x03, 0xB1, 0xFF, 0x6F, 0x69, 0x73, 0x73, 0x69, 0x6D, 0x6D, 0x6F, 0x63, 0xAD, 0x02,
+  0x8E, 0x6C, 0xE1, 0x81, 0xF9, 0xC0, 0x23, 0x4C, 0x6C, 0x65, 0x6E, 0x61, 0x70, 0xAD, 0x81, 0x74,
+  0x6E, 0x65, 0x64, 0x6E, 0x65, 0x70, 0xE5, 0x81, 0xE4, 0xC0, 0x25, 0xFB, 0x68, 0x63, 0xF3, 0x62,
+  0x67, 0x72, 0xEF, 0x69, 0x81, 0xAE, 0x04, 0x20, 0x23, 0x85, 0x79, 0xF2, 0x02, 0x89, 0x74, 0x6E,
+  0x65, 0x65, 0x6C, 0x66, 0xE6, 0xBB, 0xD1, 0x65, 0x74, 0x74, 0x6F, 0x6C, 0xF9, 0x02, 0x88, 0x74,
+  0x69, 0x6E, 0x69, 0xE6, 0xC0, 0x26, 0x85, 0x6C, 0x6B, 0xE5, 0xC0, 0x22, 0x26, 0x73, 0xE7, 0xC0,
+  0x23, 0x7F, 0x67, 0x75, 0xEC, 0x69, 0xC0, 0x27, 0x06, 0xE5, 0x04, 0xC0, 0x27, 0x28, 0x63, 0xE9,
+  0xC0, 0x23, 0xCE, 0xE3, 0x35, 0x12, 0xB2, 0x1F, 0xF3, 0x69, 0xC0, 0x21, 0xE8, 0x72, 0x6F, 0xF7,
+  0x69, 0x81, 0x74, 0x65, 0xEE, 0x69, 0x02, 0x85, 0xE4, 0x81, 0xEF, 0xBC, 0xCD, 0xAE, 0x04, 0x06,
+  0x09, 0x86, 0x73, 0x65, 0x63, 0x6C, 0xE1, 0x62, 0xEF, 0x04, 0xC0, 0x26, 0xF3, 0xF6, 0xC0, 0x20,
+  0xCA, 0x6E, 0x6F, 0xEC, 0xC0, 0x26, 0xFF, 0x68, 0x74, 0x75, 0x6D, 0xE9, 0xB1, 0xAB, 0xF0, 0x69,
+  0x81, 0xAE, 0x12, 0x04, 0x04, 0x04, 0x05, 0x23, 0x28, 0x3D, 0x4F, 0x24, 0x8F, 0x20, 0x45, 0x21,
+  0x48, 0x06, 0xA0, 0x2A, 0xF3, 0xC0, 0x26, 0xA5, 0xF0, 0xC0, 0x26, 0xA1, 0xEE, 0xC0, 0x26, 0x9D,
+  0xED, 0x3E, 0xDD, 0xA7, 0xE0, 0xEB, 0xC0, 0x26, 0x94, 0xEF, 0xC0, 0x25, 0xC1, 0xEE, 0x02, 0x9B,
+  0xE9, 0x69, 0x04, 0xC0, 0x26, 0x54, 0xEC, 0x69, 0x81, 0xAE, 0x03, 0x06, 0x83, 0x70, 0x65, 0xF0,
+  0xC0, 0x26, 0x2E, 0xEE, 0xAF, 0xF7, 0x62, 0x65, 0x77, 0xE4, 0x62, 0x61, 0xE2, 0x69, 0x07, 0x05,
+  0x05, 0x36, 0x69, 0xAE, 0x16, 0xF4, 0x31, 0x97, 0xB4, 0xE7, 0x65, 0xF4, 0xC0, 0x25, 0xAF, 0xE3,
+  0xBD, 0xDD, 0xED, 0x69, 0x81, 0xAE, 0x40, 0x24, 0x96, 0x20, 0x76, 0x21, 0x46, 0x06, 0x06, 0x18,
+  0x8C, 0xEC, 0x69, 0x06, 0x04, 0x35, 0xB0, 0xAE, 0x90, 0xE3, 0xC0, 0x24, 0x6A, 0xAE, 0x12, 0x04,
+  0x03, 0x08, 0x2B, 0xFD, 0x13, 0x35, 0x1F, 0x23, 0x25, 0x20, 0x72, 0x21, 0x53, 0x06, 0x1E, 0x8C,
+  0xF0, 0xC0, 0x21, 0x15, 0xEE, 0xBD, 0x58, 0xEC, 0x81, 0xE5, 0x81, 0xF4, 0xC0, 0x25, 0x68, 0xE3,
+  0x32, 0x7A, 0xB3, 0xDB, 0xE9, 0x02, 0x85, 0xF6, 0x81, 0xE4, 0xA3, 0x32, 0xF4, 0xA5, 0x69, 0xE8,
+  0x69, 0x04, 0xC0, 0x26, 0x21, 0xAE, 0x0F, 0x0C, 0x0A, 0x05, 0x0B, 0x05, 0x1C, 0x0C, 0x10, 0x04,
+  0x0D, 0x40, 0x25, 0x85, 0x86, 0x78, 0x76, 0x61, 0x30, 0x66, 0x7A, 0x2D, 0x2D, 0xEE, 0xC0, 0x27,
+  0x31, 0xF6, 0x05, 0x2D, 0x0C, 0xB8, 0xD7, 0xE4, 0xC0, 0x25, 0x08, 0x73, 0x61, 0xE1, 0xB0, 0xDA,
+  0x6E, 0x70, 0x71, 0x69, 0x63, 0x2D, 0x2D, 0xEE, 0xC0, 0x27, 0x17, 0xED, 0x2D, 0x03, 0xB8, 0xEF,
+  0xE9, 0x04, 0x0B, 0xA3, 0xE7, 0x78, 0x61, 0x30, 0x6B, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x27, 0x02,
+  0x30, 0x35, 0x30, 0x71, 0x6D, 0x67, 0x2D, 0x2D, 0xEE, 0xC0, 0x26, 0xF6, 0xE7, 0x05, 0x2C, 0xE9,
+  0xB8, 0xEF, 0x61, 0x30, 0xEE, 0xC0, 0x26, 0x1B, 0xE4, 0x05, 0x3C, 0x23, 0xA8, 0xB6, 0xB2, 0x03,
+  0xAC, 0xE9, 0x33, 0x72, 0x76, 0xE3, 0xBD, 0x64, 0xE3, 0xC0, 0x24, 0x4B, 0x62, 0x33, 0x71, 0x61,
+  0x30, 0x64, 0x6F, 0x2D, 0x2D, 0xEE, 0xC0, 0x26, 0xC9, 0xE1, 0x03, 0xAC, 0xDA, 0x34, 0x79, 0x61,
+  0x30, 0x63, 0x75, 0x2D, 0x2D, 0xEE, 0xC0, 0x26, 0xB9, 0xE5, 0x04, 0xC0, 0x21, 0x99, 0x73, 0x61,
+  0xED, 0xC0, 0x21, 0xA0, 0xE4, 0x69, 0x04, 0xC0, 0x25, 0x99, 0xAE, 0x0C, 0x04, 0x32, 0xCC, 0x24,
+  0xC1, 0x27, 0xA4, 0x21, 0x18, 0xA5, 0x2A, 0xE7, 0xC0, 0x23, 0xE0, 0xE5, 0x03, 0xBF, 0x3C, 0xE4,
+  0x81, 0x69, 0x73, 0x65, 0x6D, 0x6D, 0x65, 0x6A, 0x68, 0x33, 0xB2, 0xB7, 0xAF, 0xE3, 0x6A, 0x06,
+  0x07, 0x07, 0x0A, 0xBC, 0x84, 0x72, 0xE5, 0x81, 0xED, 0xC0, 0x25, 0x39, 0x65, 0x62, 0x64, 0xEE,
+  0xC0, 0x21, 0x9E, 0xE1, 0x04, 0xC0, 0x25, 0x38, 0x62, 0x64, 0xE5, 0xA9, 0xBD, 0x2E, 0x77, 0x77,
+  0xF7, 0x64, 0x61, 0x72, 0xE6, 0xBC, 0x24, 0x39, 0x32, 0x34, 0x74, 0xE3, 0xC0, 0x26, 0x45, 0x38,
+  0x75, 0x78, 0x70, 0x33, 0x2D, 0x2D, 0xEE, 0xC0, 0x26, 0x48, 0xEA, 0x0E, 0x0A, 0x20, 0x21, 0x04,
+  0x13, 0x20, 0x7F, 0x0B, 0x40, 0x22, 0x4F, 0xA1, 0x9F, 0x79, 0x71, 0x78, 0x39, 0x34, 0x71, 0xE9,
+  0xC0, 0x25, 0x60, 0xF4, 0x69, 0x81, 0xAE, 0x10, 0x07, 0x25, 0x77, 0x39, 0x37, 0x21, 0x32, 0x23,
+  0x2E, 0x21, 0xBC, 0x06, 0x1E, 0x06, 0x86, 0xF4, 0x33, 0xF0, 0x2F, 0x9C, 0xA1, 0x60, 0xE3, 0x40,
+  0x23, 0xA5, 0xA1, 0x61, 0xEE, 0xC0, 0x20, 0x03, 0xE6, 0x69, 0x81, 0xAE, 0x3C, 0x66, 0x22, 0x3A,
+  0x24, 0x60, 0x20, 0x2F, 0x0A, 0x21, 0x83, 0x20, 0x24, 0x06, 0x86, 0xE2, 0x69, 0x81, 0xAE, 0x0E,
+  0x04, 0x08, 0x0E, 0x1D, 0x04, 0x19, 0x0E, 0x04, 0x40, 0x24, 0x3B, 0xA0, 0x2A, 0x79, 0xE5, 0xA3,
+  0x60, 0xF6, 0x81, 0xE9, 0x81, 0xEE, 0xC0, 0x22, 0xB8, 0xF4, 0x05, 0x40, 0x24, 0x98, 0x8D, 0x6E,
+  0xE1, 0x81, 0x72, 0x75, 0xE1, 0xA0, 0x2B, 0xF3, 0x03, 0x08, 0x86, 0xF4, 0x81, 0x61, 0x63, 0xEF,
+  0xC0, 0x23, 0xDB, 0x72, 0x69, 0x73, 0xE9, 0xB4, 0x6D, 0x65, 0xF4, 0x81, 0x63, 0x65, 0x74, 0x69,
+  0x68, 0xE3, 0xBE, 0x66, 0x72, 0xF5, 0xBB, 0x97, 0xEF, 0x07, 0x05, 0x07, 0x3F, 0x5D, 0xA3, 0xA9,
+  0x74, 0xF3, 0xC0, 0x22, 0xE6, 0x6E, 0xEF, 0x81, 0xE3, 0xC0, 0x24, 0x59, 0xE3, 0x69, 0xC0, 0x24,
+  0x54, 0xED, 0x04, 0xC0, 0x24, 0x68, 0xF3, 0x81, 0x69, 0xF2, 0x81, 0xF5, 0xC0, 0x24, 0x29, 0xE5,
+  0xC0, 0x23, 0x00, 0x61, 0x63, 0x69, 0xF2, 0xC0, 0x23, 0xA2, 0x38, 0x64, 0x61, 0x31, 0x74, 0x61,
+  0x62, 0x62, 0xE7, 0xBB, 0xF7, 0x36, 0x70, 0x71, 0x67, 0x7A, 0x61, 0x39, 0x69, 0x61, 0x62, 0x67,
+  0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x25, 0x5B, 0xE9, 0x20, 0x22, 0x04, 0x07, 0x04, 0x0C, 0x1B, 0x16,
+  0x07, 0x20, 0x35, 0x05, 0x18, 0x20, 0x31, 0x04, 0x20, 0x22, 0x10, 0x20, 0x6B, 0x0B, 0x07, 0x20,
+  0x45, 0x20, 0x21, 0x20, 0x2E, 0x0B, 0x25, 0x7E, 0xBB, 0x8E, 0xF9, 0xC0, 0x22, 0xF5, 0x78, 0xE1,
+  0x40, 0x23, 0x61, 0xA0, 0xC2, 0xF7, 0xC0, 0x20, 0xA6, 0xF6, 0x69, 0x81, 0xAE, 0x3B, 0xA1, 0x26,
+  0xAD, 0x21, 0xB1, 0x02, 0x8A, 0xF4, 0x03, 0x07, 0x8A, 0x72, 0xE1, 0x81, 0xE8, 0xC0, 0x23, 0xE5,
+  0xE9, 0x04, 0xC0, 0x23, 0xEB, 0x6E, 0xE9, 0xC0, 0x22, 0x7B, 0x61, 0x72, 0x65, 0xF3, 0xB9, 0x6B,
+  0xF3, 0x69, 0x04, 0xC0, 0x20, 0xCA, 0xAE, 0x04, 0x05, 0xBE, 0xA4, 0x70, 0x70, 0xE1, 0xB2, 0xE4,
+  0x65, 0x67, 0x61, 0xF0, 0xB2, 0xDE, 0x72, 0xE1, 0x81, 0x72, 0xF2, 0xA8, 0x3D, 0xEE, 0x69, 0x04,
+  0x04, 0x0F, 0x86, 0xF2, 0xC0, 0x23, 0x9E, 0xE9, 0x04, 0xC0, 0x23, 0xBA, 0x68, 0x67, 0x72, 0x6F,
+  0xE2, 0x81, 0xED, 0xC0, 0x22, 0x92, 0x61, 0x69, 0x72, 0xF0, 0xBA, 0xD2, 0xAE, 0x10, 0x3D, 0x4F,
+  0x08, 0x23, 0xEF, 0x20, 0xA2, 0x20, 0x30, 0x0F, 0x21, 0x4A, 0x20, 0x24, 0x86, 0xE2, 0x3E, 0x82,
+  0xA4, 0xEA, 0x6D, 0xE1, 0xC0, 0x23, 0x90, 0xEC, 0x69, 0x03, 0x05, 0x86, 0x69, 0x61, 0xED, 0xB4,
+  0x38, 0x64, 0x72, 0x61, 0xE8, 0xA2, 0x70, 0xAE, 0x03, 0xBE, 0x49, 0xE1, 0xC0, 0x21, 0x9A, 0xEB,
+  0x69, 0x08, 0x05, 0x06, 0x06, 0x0A, 0xC0, 0x22, 0xEF, 0xF5, 0x81, 0xFA, 0xBE, 0xBD, 0x6E, 0x69,
+  0x73, 0xEC, 0xAE, 0x7A, 0x69, 0xF7, 0x69, 0xC0, 0x22, 0x30, 0x62, 0x34, 0x67, 0x63, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x24, 0x6E, 0xAE, 0x3D, 0x07, 0x24, 0x8F, 0x20, 0x45, 0x21, 0x48, 0x06, 0x1E, 0x8C,
+  0x6A, 0xF5, 0xAF, 0x17, 0xE8, 0x02, 0x93, 0xF3, 0x02, 0x89, 0x69, 0xE2, 0x81, 0x75, 0x73, 0xF4,
+  0xC0, 0x23, 0x34, 0x61, 0x62, 0x6F, 0xE4, 0xC0, 0x22, 0x20, 0xE3, 0x03, 0xBC, 0xFA, 0xE1, 0x81,
+  0xF4, 0x81, 0xE9, 0xC0, 0x22, 0x43, 0xE7, 0x69, 0x81, 0xAE, 0x07, 0x40, 0x22, 0xE7, 0x06, 0x1E,
+  0x8C, 0xE4, 0x40, 0x22, 0x25, 0x87, 0xE6, 0x69, 0x02, 0x86, 0xEF, 0x81, 0xEE, 0xC0, 0x20, 0x39,
+  0xAE, 0x0C, 0x0C, 0x16, 0x10, 0x0B, 0x06, 0x33, 0xDC, 0x20, 0xEC, 0xA8, 0xBC, 0x75, 0x76, 0x69,
+  0x73, 0x69, 0x74, 0x6F, 0x6B, 0x33, 0xB2, 0xB5, 0x33, 0x72, 0x65, 0x74, 0x6E, 0x65, 0x63, 0x61,
+  0x74, 0x61, 0x64, 0xAE, 0x02, 0x84, 0x73, 0xE1, 0xBA, 0x16, 0xEF, 0x81, 0xED, 0xBF, 0xC3, 0x6D,
+  0x72, 0x6F, 0x66, 0x74, 0x61, 0x6C, 0x70, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0xAE, 0xBA, 0x4C, 0xE9,
+  0x02, 0x84, 0x73, 0xF0, 0xA8, 0xD4, 0xEB, 0xC0, 0x21, 0xB9, 0x64, 0x6E, 0xE1, 0xC0, 0x22, 0x80,
+  0x61, 0x77, 0x35, 0x2D, 0x6E, 0x65, 0x6E, 0x69, 0x6B, 0x6B, 0x68, 0x2D, 0x2D, 0xEE, 0xC0, 0x23,
+  0xC1, 0xE5, 0x02, 0x83, 0xF0, 0xB1, 0xE6, 0x62, 0xE8, 0xC0, 0x23, 0xA8, 0xE4, 0x03, 0xAF, 0xDB,
+  0xE4, 0xBF, 0x2D, 0xE3, 0x69, 0x05, 0x03, 0xC0, 0x22, 0x96, 0xE3, 0xB0, 0xFF, 0xAE, 0x12, 0x06,
+  0x07, 0x04, 0x06, 0x39, 0xE0, 0x26, 0xCE, 0x20, 0x30, 0x21, 0x16, 0x20, 0x43, 0x1E, 0x0C, 0x82,
+  0xF6, 0x81, 0xF5, 0xC0, 0x22, 0x47, 0xEF, 0x39, 0x76, 0x28, 0xCF, 0xA0, 0x24, 0xE5, 0xC0, 0x20,
+  0xB0, 0xE4, 0x40, 0x22, 0x40, 0xA0, 0x24, 0x61, 0x79, 0x62, 0x2D, 0x74, 0x72, 0x6F, 0x70, 0x6F,
+  0x72, 0x61, 0x2D, 0x2D, 0xEE, 0xC0, 0x23, 0x6A, 0xE2, 0x69, 0x06, 0x0B, 0x06, 0xC0, 0x21, 0xD2,
+  0xEF, 0x69, 0x81, 0xED, 0x69, 0x81, 0xAE, 0x2F, 0x04, 0xB2, 0x9C, 0x61, 0x68, 0x64, 0xF5, 0xBF,
+  0xE1, 0xAE, 0x40, 0x22, 0x0C, 0x1E, 0x02, 0x0A, 0x82, 0xE1, 0x69, 0x05, 0x06, 0x07, 0x05, 0x88,
+  0x74, 0xEE, 0x81, 0xE9, 0xBE, 0x84, 0x64, 0x6E, 0x75, 0xF9, 0xC0, 0x21, 0x3C, 0x62, 0xF5, 0xC0,
+  0x20, 0x15, 0x31, 0x70, 0x2D, 0x2D, 0xEE, 0xC0, 0x23, 0x28, 0xAE, 0x08, 0x39, 0x92, 0x26, 0xB6,
+  0x21, 0xB1, 0x8C, 0x75, 0xF7, 0xBF, 0xF9, 0x37, 0x61, 0x30, 0x6F, 0x69, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x23, 0x10, 0x33, 0x74, 0x75, 0x70, 0x6B, 0x2D, 0x2D, 0xEE, 0xC0, 0x23, 0x05, 0xE8, 0x14, 0x04,
+  0x0E, 0x20, 0x4A, 0x20, 0x55, 0x10, 0x05, 0x04, 0x02, 0x0B, 0x10, 0x0C, 0x20, 0x7B, 0x09, 0x1C,
+  0xA0, 0x6D, 0xFA, 0xC0, 0x21, 0xBF, 0x76, 0xEF, 0x69, 0x81, 0x2E, 0x6C, 0x6F, 0x70, 0xE4, 0x81,
+  0xF2, 0xC0, 0x21, 0xB3, 0xF4, 0x69, 0x05, 0x15, 0x06, 0x0C, 0x86, 0x72, 0xE1, 0x03, 0xBF, 0x60,
+  0xE5, 0x69, 0x81, 0x2E, 0x73, 0x70, 0x70, 0x61, 0xE4, 0x6A, 0x81, 0x2E, 0x7A, 0x7A, 0xE2, 0x62,
+  0x6F, 0x72, 0xF8, 0xC0, 0x20, 0x05, 0x6C, 0x61, 0x65, 0xE8, 0x69, 0x81, 0x2E, 0x61, 0xF2, 0xC0,
+  0x20, 0xB7, 0x69, 0x61, 0xE6, 0x69, 0xB2, 0xD3, 0xAE, 0x0D, 0x21, 0xFF, 0x2A, 0x7B, 0x33, 0x4B,
+  0x0A, 0x20, 0x3F, 0x21, 0x70, 0x86, 0x65, 0xEE, 0x81, 0x69, 0xEC, 0xC0, 0x21, 0x0D, 0xF3, 0x69,
+  0x03, 0x07, 0x89, 0xE9, 0x3E, 0xE8, 0x20, 0x88, 0xA0, 0xDC, 0xE1, 0x04, 0xC0, 0x21, 0x61, 0xEE,
+  0xC0, 0x20, 0x7E, 0xAE, 0x0B, 0x03, 0x03, 0x1A, 0x08, 0x23, 0x86, 0x3B, 0xEE, 0xA1, 0x8D, 0xF9,
+  0xAD, 0x64, 0xF0, 0xBC, 0x8B, 0xED, 0x04, 0xC0, 0x21, 0x44, 0x72, 0x6F, 0x66, 0x74, 0x61, 0x6C,
+  0x70, 0xAE, 0x06, 0x03, 0x34, 0x28, 0xA1, 0x21, 0xF4, 0xA6, 0xAA, 0xE3, 0xC0, 0x21, 0x26, 0xEC,
+  0x04, 0xC0, 0x21, 0x30, 0xF8, 0xBF, 0xD5, 0xE7, 0x04, 0xC0, 0x21, 0x2E, 0x6E, 0x61, 0x62, 0x68,
+  0xF3, 0xA1, 0xDE, 0xF0, 0x69, 0x81, 0xAE, 0x26, 0xD5, 0x38, 0x8F, 0x20, 0xB5, 0x20, 0xD8, 0x06,
+  0x1E, 0x06, 0x86, 0xEF, 0x81, 0xE3, 0xBD, 0x8B, 0xED, 0x69, 0xA9, 0x29, 0xEB, 0x62, 0xE7, 0x69,
+  0x81, 0xAE, 0x40, 0x20, 0xD6, 0x06, 0x1E, 0x06, 0x86, 0xE6, 0x03, 0xBD, 0x91, 0x32, 0x6C, 0x70,
+  0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x22, 0x09, 0x64, 0x30, 0x73, 0x62, 0x67, 0x70, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x21, 0xFD, 0xE3, 0x69, 0x08, 0x07, 0x03, 0x09, 0x08, 0x04, 0xBC, 0xC3, 0x74,
+  0x61, 0xF7, 0x69, 0xC0, 0x20, 0x70, 0xF3, 0xBF, 0xD4, 0xF2, 0x02, 0x83, 0xF5, 0xBD, 0x2B, 0xE1,
+  0xBC, 0xC7, 0x69, 0xF2, 0x69, 0x81, 0x65, 0xF5, 0xBE, 0x0C, 0xE1, 0xC0, 0x20, 0xB3, 0xAE, 0x0E,
+  0x03, 0x16, 0x12, 0x05, 0x05, 0x06, 0x2F, 0x50, 0x22, 0x24, 0x07, 0xA1, 0x2D, 0xF9, 0xAF, 0x66,
+  0x77, 0x6F, 0x6C, 0x66, 0x2E, 0xE5, 0x02, 0x87, 0x6E, 0x69, 0x67, 0x6E, 0xE5, 0xAD, 0xA7, 0x61,
+  0x2E, 0x31, 0xF0, 0xC0, 0x20, 0x5A, 0xF4, 0x04, 0xC0, 0x20, 0x6C, 0x65, 0x6E, 0x65, 0x72, 0x69,
+  0xE6, 0x6A, 0x81, 0x2E, 0x63, 0x76, 0xF3, 0x62, 0x73, 0x6E, 0xE4, 0xA2, 0xB7, 0xF0, 0x30, 0x49,
+  0xAF, 0xAB, 0x67, 0x6E, 0x69, 0xEB, 0xB1, 0x13, 0x64, 0x75, 0x6F, 0x6C, 0x63, 0xAD, 0xB4, 0xBD,
+  0xE2, 0x69, 0x03, 0xB9, 0xE9, 0xED, 0xC0, 0x20, 0x36, 0xB8, 0x02, 0x8E, 0x61, 0x37, 0x6D, 0x61,
+  0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xC0, 0x21, 0x68, 0x38, 0x79, 0x76, 0x66, 0x65, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x21, 0x5D, 0x34, 0x77, 0x63, 0x33, 0x6F, 0x2D, 0x2D, 0x6E, 0xF8, 0x69, 0x81,
+  0xAE, 0x04, 0x0F, 0x11, 0x8F, 0x72, 0x62, 0x30, 0x65, 0x66, 0x31, 0x63, 0x32, 0x31, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x21, 0x3E, 0x6C, 0x38, 0x62, 0x78, 0x69, 0x38, 0x69, 0x66, 0x63, 0x32, 0x31, 0x2D,
+  0x2D, 0xEE, 0xC0, 0x21, 0x2D, 0x69, 0x64, 0x31, 0x6B, 0x7A, 0x75, 0x63, 0x33, 0x68, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x21, 0x1E, 0xE1, 0x03, 0x11, 0x8D, 0x76, 0x65, 0x34, 0x62, 0x33, 0x63, 0x30, 0x6F,
+  0x63, 0x32, 0x31, 0x2D, 0x2D, 0xEE, 0xC0, 0x21, 0x09, 0x33, 0x6A, 0x30, 0x68, 0x63, 0x33, 0x6D,
+  0x2D, 0x2D, 0xEE, 0xC0, 0x20, 0xFC, 0x32, 0x78, 0x79, 0x63, 0x33, 0x6F, 0x2D, 0x2D, 0xEE, 0xC0,
+  0x20, 0xF0, 0x30, 0x65, 0x65, 0x35, 0x61, 0x33, 0x6C, 0x64, 0x32, 0x63, 0x6B, 0x78, 0x2D, 0x2D,
+  0xEE, 0xC0, 0x20, 0xDE, 0xE7, 0x1F, 0x0B, 0x08, 0x13, 0x20, 0x28, 0x24, 0x3F, 0x1D, 0x20, 0xC4,
+  0x19, 0x19, 0x05, 0x20, 0x23, 0x1B, 0x13, 0x20, 0x48, 0x0F, 0x1F, 0x0B, 0x0A, 0x07, 0x20, 0x5F,
+  0x22, 0x42, 0xB6, 0x86, 0x77, 0x73, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xC0, 0x20, 0xB3, 0xF6,
+  0x69, 0x03, 0xB7, 0xFF, 0xAE, 0xBC, 0x83, 0xF5, 0x69, 0x81, 0xAE, 0x0A, 0x2C, 0xF2, 0x2D, 0x5D,
+  0x25, 0x20, 0x08, 0x0C, 0x82, 0xEF, 0x3F, 0x56, 0xA0, 0x24, 0xF3, 0x69, 0x02, 0x91, 0x67, 0x62,
+  0x36, 0x33, 0x39, 0x6A, 0x34, 0x33, 0x75, 0x73, 0x35, 0x2D, 0x2D, 0xEE, 0xC0, 0x20, 0x83, 0xAE,
+  0x09, 0x33, 0xF8, 0x2B, 0x37, 0x06, 0x06, 0x18, 0x8C, 0x64, 0x65, 0x6C, 0x61, 0xE3, 0x81, 0xF3,
+  0xA4, 0xC3, 0xF2, 0x05, 0x0A, 0x24, 0x1C, 0x86, 0x75, 0xE2, 0x03, 0xB2, 0xF9, 0xED, 0x81, 0xE1,
+  0xBE, 0x66, 0xEF, 0x69, 0x81, 0xAE, 0x1D, 0x0C, 0x0F, 0x06, 0x20, 0x86, 0x20, 0x7D, 0x20, 0xA3,
+  0x20, 0x2F, 0x20, 0x24, 0x0E, 0x20, 0x4D, 0x14, 0x1D, 0x14, 0x0A, 0x06, 0x20, 0xB2, 0x20, 0x46,
+  0x09, 0xA0, 0x26, 0xF9, 0x03, 0xBE, 0x82, 0x6C, 0x69, 0x6D, 0x61, 0x66, 0xF8, 0xA2, 0xA3, 0xF8,
+  0x02, 0x86, 0x75, 0x6E, 0x69, 0xEC, 0xAA, 0x93, 0xE9, 0x81, 0x6E, 0xF5, 0xAA, 0x8D, 0x76, 0x72,
+  0x65, 0xF3, 0xB0, 0x28, 0x75, 0xE5, 0x69, 0x81, 0xAE, 0x17, 0x04, 0x04, 0x08, 0x0C, 0x0A, 0x0B,
+  0x06, 0x05, 0x08, 0x08, 0x05, 0x04, 0x0B, 0x03, 0x2B, 0x2E, 0x28, 0xBB, 0x26, 0x1A, 0xA0, 0xE2,
+  0xFA, 0x3E, 0xD5, 0x8A, 0xF9, 0x3E, 0xDB, 0x86, 0xF5, 0x3D, 0xF0, 0x0D, 0x20, 0xBA, 0x1A, 0x9B,
+  0xF4, 0x3D, 0x63, 0x20, 0x6C, 0x19, 0x20, 0x91, 0x20, 0x4A, 0x12, 0x8F, 0xF3, 0x05, 0x3C, 0xBC,
+  0xA1, 0xE4, 0xE9, 0x69, 0xA9, 0x22, 0xF2, 0x3B, 0x57, 0x22, 0x42, 0x20, 0x46, 0x20, 0xB6, 0xA0,
+  0x37, 0xEF, 0x35, 0xBB, 0x28, 0xE9, 0x84, 0xEE, 0x3D, 0xA8, 0xA1, 0x00, 0xEC, 0x3D, 0xA3, 0x20,
+  0xAA, 0x20, 0x4C, 0x9F, 0xEB, 0x3C, 0x99, 0x06, 0x21, 0x9F, 0xA0, 0x63, 0xE9, 0x3D, 0x73, 0xA0,
+  0xC3, 0xE7, 0x3E, 0x80, 0x84, 0xE5, 0x3C, 0x8E, 0x20, 0xFC, 0x20, 0xA3, 0x20, 0x3F, 0x10, 0x94,
+  0xE4, 0xBE, 0x7F, 0xE1, 0x03, 0xBE, 0x79, 0xAD, 0xBE, 0x29, 0xF4, 0x06, 0x20, 0x22, 0x0A, 0x07,
+  0x9E, 0xF3, 0x03, 0x06, 0x8A, 0x72, 0x69, 0x66, 0xF9, 0xB3, 0xF0, 0xEF, 0x02, 0x83, 0xEC, 0xA3,
+  0x03, 0x68, 0xAD, 0xB6, 0x43, 0xE9, 0x81, 0x78, 0x65, 0x74, 0xEE, 0x03, 0xBA, 0x99, 0xF3, 0x81,
+  0xE5, 0xBA, 0x96, 0x6F, 0x69, 0x2D, 0x61, 0x6C, 0x6C, 0x69, 0xFA, 0xBD, 0x63, 0x68, 0x67, 0x69,
+  0x6E, 0xEB, 0xA2, 0x0E, 0xE5, 0x02, 0x91, 0x6E, 0x72, 0x65, 0x74, 0x6E, 0xE9, 0x02, 0x84, 0x65,
+  0x68, 0xF4, 0x81, 0x66, 0x6F, 0xE4, 0xA3, 0x9D, 0x65, 0x77, 0x73, 0x2D, 0x79, 0x72, 0x65, 0xF6,
+  0xA2, 0xC2, 0x63, 0xE5, 0x02, 0x87, 0x72, 0x69, 0x64, 0x65, 0xF2, 0xB9, 0x03, 0x6A, 0x6F, 0x72,
+  0x70, 0x61, 0x72, 0x6F, 0x64, 0x65, 0x66, 0xAE, 0x04, 0x05, 0xBC, 0xC6, 0x67, 0x74, 0x73, 0xAE,
+  0x81, 0x73, 0xEF, 0x81, 0xAE, 0xAB, 0x0F, 0xF3, 0x0E, 0x0F, 0x0B, 0x20, 0x30, 0x04, 0x09, 0x10,
+  0x12, 0x0B, 0x38, 0x7E, 0xA2, 0xE6, 0x74, 0x6E, 0x65, 0x6D, 0x68, 0x63, 0x61, 0x74, 0x74, 0x61,
+  0xEF, 0x81, 0xED, 0xBD, 0xCF, 0xF3, 0x03, 0xAA, 0x1F, 0x61, 0x2D, 0x73, 0x6B, 0xE3, 0xBA, 0x6E,
+  0x6E, 0xE4, 0x10, 0x03, 0x03, 0x0A, 0x04, 0x05, 0x20, 0x94, 0x28, 0x9A, 0x23, 0x98, 0x2F, 0xA8,
+  0xA1, 0x23, 0xF4, 0xBD, 0x97, 0xF2, 0xA4, 0x60, 0x6E, 0x79, 0xE4, 0x69, 0x81, 0xAE, 0x29, 0x3B,
+  0xB4, 0x51, 0x6D, 0xEF, 0xB9, 0xF3, 0x6B, 0x63, 0xF5, 0xBB, 0xAB, 0xAD, 0x81, 0xF7, 0xBD, 0x37,
+  0x6C, 0xF4, 0xBA, 0xC0, 0x6B, 0x6F, 0x6F, 0x62, 0x2D, 0x64, 0xE1, 0xBB, 0xFD, 0x65, 0x69, 0x72,
+  0x66, 0x6F, 0x74, 0x61, 0x74, 0x6F, 0x70, 0x68, 0xE3, 0x81, 0xF5, 0xBD, 0x83, 0xE4, 0x02, 0x87,
+  0x79, 0xEC, 0x81, 0x69, 0xED, 0xB5, 0x99, 0x69, 0x6B, 0x63, 0x65, 0x74, 0xAE, 0xB0, 0xE7, 0xE2,
+  0x02, 0x83, 0xE2, 0xA1, 0x92, 0x61, 0x6C, 0xE6, 0xA1, 0xD3, 0xE1, 0x02, 0x86, 0x6E, 0x79, 0x6D,
+  0xF3, 0xBB, 0x63, 0x69, 0x6C, 0xE1, 0x2E, 0x03, 0xA0, 0x81, 0xF2, 0x03, 0x05, 0x87, 0x76, 0x64,
+  0xED, 0xBB, 0x75, 0x67, 0x6D, 0x74, 0x72, 0xE5, 0xBD, 0x48, 0xE5, 0x03, 0x0A, 0x8B, 0x73, 0x75,
+  0x2D, 0x78, 0x75, 0x6E, 0x69, 0xEC, 0xA1, 0x0A, 0x70, 0x70, 0x65, 0x70, 0x74, 0xE5, 0x81, 0x65,
+  0xF7, 0xBC, 0xD2, 0x67, 0xE1, 0x81, 0xF4, 0xB9, 0xD9, 0xF0, 0x03, 0x09, 0x90, 0x74, 0xE6, 0x03,
+  0xBC, 0xAC, 0xE5, 0x28, 0xA8, 0x88, 0xEF, 0x03, 0xAF, 0x53, 0x74, 0x6B, 0x73, 0xE5, 0x81, 0xE4,
+  0x81, 0xE5, 0x81, 0xE5, 0xBB, 0xEA, 0xE9, 0x03, 0xBC, 0x99, 0xE6, 0xA7, 0xF6, 0xEF, 0x02, 0x86,
+  0x74, 0xF0, 0x3A, 0x50, 0xA1, 0xD2, 0x6A, 0x6F, 0xE4, 0xAD, 0xA0, 0xEE, 0x04, 0x05, 0x09, 0x87,
+  0x70, 0x76, 0xAD, 0xBB, 0x81, 0xEF, 0x03, 0xA9, 0x70, 0x72, 0x76, 0xE9, 0xB9, 0x94, 0x69, 0x62,
+  0x70, 0x74, 0xF4, 0xBC, 0x03, 0x61, 0xE6, 0x06, 0x05, 0x17, 0x03, 0x04, 0x84, 0x78, 0x6F, 0xF3,
+  0xA0, 0xA0, 0xF3, 0x03, 0x05, 0x87, 0x74, 0x61, 0xF0, 0xA0, 0x97, 0x6E, 0x69, 0x75, 0x72, 0xE2,
+  0xA0, 0x90, 0x63, 0x69, 0x74, 0x6C, 0xE5, 0xA0, 0x87, 0xEC, 0xBC, 0x5B, 0x65, 0xE7, 0xAA, 0x70,
+  0x63, 0xE6, 0xBA, 0xAC, 0x62, 0xEC, 0xBC, 0xB0, 0xED, 0x02, 0x8A, 0x65, 0x64, 0x6F, 0x6D, 0x2D,
+  0x65, 0x6C, 0xE2, 0xBA, 0xC3, 0x61, 0x63, 0x73, 0x73, 0xE5, 0xA7, 0x66, 0xEC, 0x04, 0x0B, 0xAC,
+  0xEB, 0x6C, 0x61, 0x77, 0x65, 0x72, 0x69, 0xE6, 0x2C, 0xCF, 0xAF, 0x47, 0xE9, 0x03, 0xB4, 0x82,
+  0x76, 0x65, 0x2D, 0x79, 0x72, 0x65, 0xF6, 0xA1, 0x1B, 0xEB, 0x04, 0x05, 0xBB, 0x93, 0xEE, 0x81,
+  0xF5, 0xBC, 0x82, 0x65, 0x65, 0xE7, 0x81, 0x2D, 0xE1, 0x21, 0x09, 0xAC, 0x15, 0x67, 0x6F, 0x6C,
+  0x62, 0x79, 0x6D, 0x64, 0xE1, 0xBA, 0xC3, 0xE6, 0x81, 0x65, 0xE8, 0xA0, 0x23, 0xE5, 0x0A, 0x1D,
+  0x20, 0x2F, 0x11, 0x19, 0x19, 0x0E, 0xBB, 0xC0, 0xF4, 0x02, 0x8C, 0x69, 0xF3, 0x03, 0xBC, 0x2C,
+  0x2D, 0x79, 0xE2, 0x81, 0xE2, 0xBB, 0x5F, 0x61, 0x64, 0x69, 0x64, 0x6E, 0xE1, 0x81, 0xE3, 0x81,
+  0xAD, 0x81, 0xE1, 0xA0, 0xCF, 0xF2, 0x03, 0x16, 0x84, 0x75, 0x63, 0x65, 0x73, 0x2D, 0x37, 0x37,
+  0x6E, 0x64, 0x63, 0x2E, 0x6E, 0x69, 0x67, 0x69, 0x72, 0x6F, 0x2E, 0x6C, 0xF3, 0xBB, 0xB6, 0x69,
+  0xF7, 0xBB, 0x9D, 0x65, 0x68, 0x77, 0x6F, 0x6E, 0x67, 0x6E, 0x69, 0x6F, 0x67, 0x79, 0x6C, 0xE4,
+  0x81, 0xEC, 0xBB, 0x09, 0xEE, 0x02, 0x89, 0x75, 0x6D, 0x61, 0xAE, 0x81, 0x65, 0xEC, 0xB8, 0x03,
+  0x6F, 0x7A, 0xE4, 0xB8, 0x9D, 0xED, 0x03, 0x09, 0x86, 0x6F, 0x68, 0x72, 0x75, 0x6F, 0x79, 0xF3,
+  0xA6, 0xCF, 0x61, 0xE7, 0x81, 0xE5, 0xA7, 0x6D, 0x2D, 0xED, 0x81, 0xEF, 0xBA, 0xB2, 0xEC, 0x02,
+  0x8A, 0x70, 0x6F, 0x65, 0x70, 0x61, 0x72, 0x6F, 0xE4, 0xA0, 0x3F, 0x61, 0x73, 0x2D, 0x34, 0xAD,
+  0x81, 0x66, 0xE6, 0x81, 0xF5, 0xBA, 0xE8, 0x67, 0x72, 0x6F, 0xE6, 0x02, 0x83, 0xF0, 0xA6, 0xCE,
+  0xEC, 0x81, 0xEF, 0xBB, 0x72, 0x63, 0x69, 0x6E, 0x2D, 0x79, 0x72, 0x65, 0xF6, 0xA0, 0x45, 0xE4,
+  0x05, 0x16, 0x09, 0x05, 0x91, 0x75, 0x6F, 0x6C, 0xE3, 0x02, 0x83, 0xED, 0xB9, 0x90, 0x61, 0x72,
+  0x66, 0x6E, 0x69, 0x61, 0x72, 0x6F, 0xE4, 0x81, 0xE5, 0xBA, 0x67, 0x6F, 0x6F, 0x67, 0x2D, 0x79,
+  0x72, 0x65, 0xF6, 0x9F, 0x6E, 0x75, 0x6F, 0xE6, 0x9A, 0xE5, 0x02, 0x84, 0x76, 0x61, 0xF3, 0x93,
+  0x73, 0x75, 0x66, 0x6E, 0x6F, 0xE3, 0x81, 0xF3, 0xBB, 0x6C, 0x61, 0x62, 0x2D, 0x79, 0x72, 0x65,
+  0xF6, 0x81, 0xAD, 0xAC, 0x14, 0x62, 0x65, 0x77, 0x2D, 0x6C, 0x6C, 0xE1, 0xAF, 0x00, 0xE1, 0x04,
+  0x11, 0xB8, 0x90, 0xF4, 0x02, 0x88, 0x73, 0x69, 0x76, 0x72, 0x65, 0xF4, 0xBB, 0x11, 0x6E, 0x65,
+  0x69, 0xED, 0xB5, 0xE0, 0xF2, 0x81, 0x65, 0x6D, 0x61, 0x63, 0x79, 0x74, 0x69, 0x72, 0x75, 0x63,
+  0x65, 0xF3, 0xBA, 0xBC, 0x37, 0x37, 0x6E, 0x64, 0x63, 0x2E, 0xE3, 0x69, 0xBB, 0x1C, 0x65, 0x62,
+  0x6D, 0xEF, 0xBB, 0x0C, 0x32, 0x6E, 0x30, 0x38, 0x34, 0x71, 0x6C, 0x6A, 0x2D, 0x2D, 0xEE, 0xBC,
+  0x30, 0xEF, 0x05, 0x39, 0x0D, 0xA1, 0xEC, 0x6F, 0xE7, 0x69, 0x81, 0xAE, 0x05, 0x29, 0x04, 0xB0,
+  0xC2, 0x74, 0x6E, 0x65, 0x74, 0x6E, 0x6F, 0xE3, 0x81, 0x72, 0x65, 0x73, 0xF5, 0x62, 0xEE, 0x69,
+  0x06, 0x11, 0x04, 0x20, 0x7D, 0x83, 0xF5, 0x03, 0xB4, 0x47, 0x72, 0x65, 0x68, 0x63, 0xE9, 0x81,
+  0xF3, 0x81, 0xF2, 0x81, 0xE5, 0xB9, 0x85, 0xEF, 0x69, 0xBA, 0x7A, 0xE9, 0x69, 0x0D, 0x06, 0x20,
+  0x27, 0x0F, 0x04, 0x0B, 0x09, 0x0B, 0x05, 0x03, 0xB8, 0x20, 0x76, 0xE9, 0x39, 0xDD, 0xA0, 0xC3,
+  0xF4, 0x0A, 0x0D, 0x05, 0x04, 0x20, 0x5E, 0x37, 0x3C, 0xA1, 0xAD, 0x73, 0x6F, 0xE8, 0x69, 0x81,
+  0x2E, 0x74, 0x66, 0x61, 0x72, 0xE3, 0xA4, 0x15, 0x6C, 0x75, 0xF3, 0xA5, 0x19, 0x68, 0xE7, 0xB0,
+  0x8D, 0x65, 0xEB, 0x81, 0xF2, 0xB0, 0x24, 0x72, 0xE5, 0x03, 0xB1, 0xE2, 0x65, 0xEE, 0x81, 0xE9,
+  0x81, 0xE7, 0x81, 0xEE, 0xBA, 0x6E, 0xF0, 0x69, 0xA5, 0x88, 0xEE, 0x02, 0x83, 0xE9, 0xAD, 0x81,
+  0x61, 0x65, 0xEC, 0xBA, 0x7D, 0xEB, 0x03, 0xB7, 0x7A, 0x6F, 0xEF, 0x3A, 0x67, 0x8E, 0xE8, 0x02,
+  0x85, 0x74, 0x6F, 0xEC, 0xBA, 0x6C, 0xF3, 0xB1, 0xF2, 0xE4, 0x26, 0x7F, 0xA6, 0xE6, 0xE3, 0xAE,
+  0xE7, 0xE2, 0x69, 0x81, 0x6D, 0xF5, 0xA8, 0x50, 0xE1, 0xB8, 0x53, 0xAE, 0x10, 0x03, 0x03, 0x05,
+  0x04, 0x04, 0x38, 0x44, 0x09, 0x20, 0x2F, 0x21, 0x8D, 0x06, 0xA0, 0x2A, 0xEF, 0xB5, 0x0F, 0xEE,
+  0xB9, 0x4E, 0xED, 0x28, 0x9C, 0xA0, 0x86, 0xEC, 0x3A, 0x36, 0x86, 0xE9, 0x69, 0xB8, 0x4C, 0xE4,
+  0xB9, 0x47, 0xED, 0x69, 0x02, 0x83, 0xF0, 0xB6, 0xC7, 0xAE, 0x09, 0x05, 0x39, 0xF0, 0x06, 0x20,
+  0x20, 0x04, 0x86, 0xED, 0x37, 0xD1, 0xA2, 0x5E, 0xE4, 0xB9, 0x68, 0xEB, 0x69, 0x81, 0xAE, 0x11,
+  0x24, 0x2D, 0x29, 0xE7, 0x20, 0x83, 0x20, 0xD5, 0x24, 0x53, 0x24, 0x8C, 0x21, 0x93, 0x1E, 0x86,
+  0xE7, 0x39, 0xED, 0x9C, 0xE9, 0x38, 0xA5, 0xA1, 0x6B, 0xE7, 0x69, 0x81, 0xAE, 0x08, 0x06, 0x0E,
+  0x38, 0x22, 0x21, 0xB3, 0x8A, 0x73, 0xE1, 0x81, 0xE1, 0xB6, 0x85, 0x6C, 0x65, 0x6E, 0x61, 0xF0,
+  0x69, 0x81, 0x2E, 0x6E, 0x6F, 0x6D, 0xE5, 0xB6, 0xD4, 0xE1, 0xA3, 0x33, 0xE5, 0x69, 0x03, 0xB9,
+  0xE4, 0xAE, 0x0E, 0x03, 0x28, 0x1A, 0x2F, 0xBF, 0x20, 0x2F, 0x21, 0x8D, 0x06, 0x20, 0x24, 0x86,
+  0xEE, 0xAC, 0xB2, 0x69, 0xE3, 0xB9, 0x5E, 0xE3, 0x69, 0x03, 0xB9, 0xA6, 0x7A, 0x61, 0x39, 0x61,
+  0x30, 0x63, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xBA, 0xC7, 0xE2, 0x69, 0x81, 0xAE, 0x20, 0x34,
+  0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x23, 0x80, 0x24, 0xCB, 0x22, 0x26, 0x21, 0x39, 0x24, 0x87,
+  0x24, 0x47, 0x21, 0x86, 0x20, 0xB6, 0x20, 0xA8, 0x02, 0x06, 0x20, 0xA6, 0x20, 0x36, 0x20, 0x20,
+  0x19, 0x0D, 0x20, 0x7D, 0x07, 0x07, 0x20, 0x2B, 0x06, 0x10, 0x04, 0x04, 0x06, 0x06, 0x06, 0x09,
+  0xA1, 0x0A, 0xF9, 0x69, 0xB8, 0xD5, 0xB9, 0x61, 0xB8, 0x61, 0xB7, 0x61, 0xB6, 0x61, 0xB5, 0x61,
+  0xB3, 0x61, 0xE1, 0x69, 0x02, 0x83, 0xF6, 0xB7, 0x5D, 0xAE, 0x37, 0x09, 0x20, 0x98, 0x21, 0xB3,
+  0x8A, 0xB7, 0x02, 0x89, 0x72, 0x62, 0x32, 0x63, 0x2D, 0x2D, 0xEE, 0xBA, 0x64, 0x38, 0xE1, 0x81,
+  0x34, 0x64, 0x35, 0x61, 0x34, 0x70, 0x72, 0x65, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xBA, 0x51,
+  0x36, 0x39, 0x76, 0x71, 0x68, 0x72, 0x2D, 0x2D, 0xEE, 0xBA, 0x46, 0x35, 0x6D, 0x7A, 0x74, 0x35,
+  0x2D, 0x2D, 0xEE, 0xBA, 0x3C, 0x34, 0x35, 0x35, 0x73, 0xE5, 0xB1, 0xCE, 0xB3, 0x03, 0xA0, 0x51,
+  0x39, 0x31, 0x77, 0x36, 0x6A, 0x2D, 0x2D, 0x6E, 0xF8, 0x69, 0x81, 0xAE, 0x05, 0x0C, 0x0C, 0x0C,
+  0x90, 0xF6, 0x81, 0x74, 0x61, 0x30, 0x63, 0x75, 0x2D, 0x2D, 0xEE, 0xBA, 0x14, 0xED, 0x81, 0x31,
+  0x71, 0x74, 0x78, 0x6D, 0x2D, 0x2D, 0xEE, 0xBA, 0x08, 0xE7, 0x81, 0x6C, 0x61, 0x30, 0x64, 0x6F,
+  0x2D, 0x2D, 0xEE, 0xB9, 0xFC, 0xE4, 0x03, 0xAF, 0x38, 0xB2, 0x81, 0x32, 0x73, 0x76, 0x63, 0x77,
+  0x2D, 0x2D, 0xEE, 0xB9, 0xEC, 0xE1, 0x81, 0x35, 0x77, 0x71, 0x6D, 0x67, 0x2D, 0x2D, 0xEE, 0xB9,
+  0xE0, 0x34, 0x34, 0x73, 0x64, 0x33, 0x2D, 0x2D, 0xEE, 0xB9, 0xD6, 0xB2, 0x02, 0x8A, 0x38, 0x7A,
+  0x72, 0x66, 0x36, 0x2D, 0x2D, 0xEE, 0xB9, 0xC9, 0x34, 0x77, 0x71, 0x35, 0x35, 0x2D, 0x2D, 0xEE,
+  0xB9, 0xBF, 0xE6, 0x17, 0x08, 0x0F, 0x08, 0x03, 0x08, 0x20, 0x21, 0x05, 0x03, 0x20, 0x54, 0x12,
+  0x10, 0x04, 0x0B, 0x0B, 0x20, 0x63, 0x35, 0x76, 0xA1, 0xA6, 0xF7, 0x69, 0x81, 0xAE, 0x32, 0x3E,
+  0xA4, 0x57, 0x76, 0x64, 0x37, 0x63, 0x6B, 0x61, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xB9,
+  0x90, 0xF4, 0x69, 0x03, 0xB6, 0x66, 0xAE, 0xB6, 0x7C, 0xF2, 0xB3, 0xBF, 0xF0, 0x69, 0x81, 0xAE,
+  0x38, 0x3E, 0x1E, 0x8C, 0xEE, 0x69, 0x81, 0xAE, 0x0D, 0x08, 0x05, 0x21, 0x21, 0x30, 0xE6, 0x21,
+  0x25, 0x23, 0x5D, 0xA0, 0x45, 0x72, 0xE5, 0x03, 0xB7, 0xF0, 0xE8, 0xB6, 0xE5, 0xED, 0x27, 0x27,
+  0xB1, 0x19, 0xE3, 0xB6, 0xA5, 0xEC, 0x32, 0x53, 0xA5, 0xC1, 0xE9, 0xAD, 0xBE, 0xE3, 0x69, 0x04,
+  0x03, 0xB2, 0xFC, 0xEE, 0xB7, 0xCF, 0x61, 0x31, 0x70, 0x2D, 0x2D, 0x6E, 0xF8, 0x69, 0x81, 0xAE,
+  0x09, 0x0B, 0x04, 0x0A, 0x07, 0x14, 0x0E, 0xB0, 0x45, 0x7A, 0x69, 0x6C, 0x61, 0x31, 0x68, 0x2D,
+  0x2D, 0xEE, 0xB9, 0x2D, 0x70, 0xE4, 0xA0, 0x2D, 0x6E, 0x68, 0x61, 0x31, 0x68, 0x2D, 0x2D, 0xEE,
+  0xB9, 0x1F, 0xE6, 0x02, 0x9C, 0x61, 0xB1, 0xB0, 0x60, 0xE3, 0x02, 0x83, 0xED, 0xB0, 0x5A, 0x61,
+  0x76, 0x63, 0x30, 0x61, 0x61, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xB9, 0x04, 0x62, 0x38, 0xEC,
+  0x81, 0xE5, 0x81, 0x61, 0x31, 0x6A, 0x2D, 0x2D, 0xEE, 0xB8, 0xF6, 0x61, 0x31, 0x34, 0x2D, 0x2D,
+  0xEE, 0xB8, 0xEE, 0xE2, 0x69, 0x03, 0xAD, 0xE4, 0x77, 0x61, 0x39, 0x62, 0x67, 0x6D, 0x2D, 0x2D,
+  0xEE, 0xB8, 0xDE, 0xE1, 0x69, 0xB1, 0x49, 0x32, 0x38, 0x30, 0x78, 0x69, 0x6D, 0x2D, 0x2D, 0xEE,
+  0xB8, 0xCF, 0x31, 0x39, 0x38, 0x78, 0x69, 0x6D, 0x2D, 0x2D, 0xEE, 0xB8, 0xC4, 0x30, 0x66, 0x33,
+  0x72, 0x6B, 0x63, 0x67, 0x2D, 0x2D, 0xEE, 0xB8, 0xB8, 0xE5, 0x20, 0x2B, 0x0C, 0x03, 0x08, 0x20,
+  0x55, 0x0F, 0x20, 0xC6, 0x20, 0xE0, 0x20, 0x70, 0x16, 0x20, 0x88, 0x21, 0x3E, 0x20, 0x58, 0x20,
+  0x22, 0x0B, 0x17, 0x20, 0x8C, 0x09, 0x20, 0x39, 0x22, 0xC3, 0x20, 0xB7, 0x20, 0x66, 0x10, 0x0C,
+  0x0B, 0x0E, 0x0F, 0xAC, 0x8E, 0xF9, 0x69, 0x81, 0xAE, 0x35, 0xB2, 0x21, 0x8D, 0x06, 0x1E, 0x06,
+  0x86, 0xF8, 0xB3, 0xAC, 0xF7, 0x03, 0xB7, 0x52, 0x6B, 0xE3, 0xB7, 0xA6, 0xF6, 0x69, 0x07, 0x14,
+  0x08, 0x27, 0x03, 0xAD, 0x62, 0xE9, 0x04, 0x09, 0xAF, 0xCD, 0x73, 0x73, 0x65, 0x72, 0xE7, 0x81,
+  0xEF, 0xB6, 0x90, 0xEC, 0x69, 0x81, 0xAE, 0xA5, 0x4A, 0x65, 0x33, 0x67, 0x65, 0x72, 0xE2, 0xAF,
+  0xF8, 0xAE, 0x11, 0x05, 0x03, 0x05, 0x06, 0x07, 0x30, 0xC7, 0x05, 0x24, 0xBC, 0x21, 0x53, 0x06,
+  0x20, 0x24, 0x86, 0xF3, 0x81, 0xF4, 0xB0, 0xF2, 0xF2, 0xAB, 0x9D, 0xED, 0x25, 0xF9, 0xAE, 0xD0,
+  0xE3, 0x81, 0xE5, 0x37, 0x07, 0x99, 0xE2, 0x31, 0xF9, 0x20, 0x4E, 0xA4, 0x9C, 0x32, 0xB1, 0xB6,
+  0xE3, 0xF5, 0x03, 0xB6, 0xEB, 0x71, 0xE9, 0x02, 0x84, 0x74, 0xF5, 0xB6, 0x00, 0xEE, 0xAE, 0x33,
+  0xF4, 0x09, 0x06, 0x08, 0x20, 0x91, 0x30, 0x1F, 0xA4, 0xD0, 0x75, 0x74, 0x69, 0xF4, 0xAE, 0xDD,
+  0xF4, 0x03, 0xA6, 0xB0, 0x69, 0xEF, 0xB3, 0xC8, 0x69, 0xF3, 0x69, 0x02, 0x86, 0x62, 0x65, 0xF7,
+  0x69, 0xB5, 0xA6, 0xAE, 0x0C, 0x05, 0x0B, 0x08, 0x0C, 0x0D, 0x12, 0x0C, 0x20, 0x20, 0xB5, 0xB8,
+  0x78, 0x75, 0xEC, 0xAD, 0xA6, 0xF4, 0x02, 0x83, 0x73, 0xF4, 0x62, 0xE8, 0x81, 0xF2, 0xB6, 0x55,
+  0xF3, 0x81, 0x70, 0x76, 0x74, 0xF3, 0xAE, 0xC8, 0xEE, 0x02, 0x85, 0xEF, 0x81, 0xF9, 0xB6, 0xA2,
+  0x65, 0xF9, 0xB6, 0x90, 0x6C, 0x61, 0x69, 0x63, 0x6F, 0xF3, 0x81, 0x6E, 0xE5, 0x81, 0xF0, 0xB6,
+  0x9D, 0xEB, 0x02, 0x84, 0x77, 0xEE, 0xB5, 0x6A, 0x72, 0x6F, 0x77, 0x74, 0x65, 0x6E, 0x6F, 0x69,
+  0xEC, 0xAC, 0x47, 0x68, 0x73, 0x6D, 0x72, 0x6F, 0x66, 0x74, 0x61, 0xEC, 0x81, 0xF0, 0x62, 0xE5,
+  0x05, 0x05, 0x10, 0xAF, 0xC4, 0x77, 0x69, 0xEE, 0xB5, 0x6C, 0xF2, 0x02, 0x87, 0x6F, 0x63, 0xE5,
+  0x81, 0xF6, 0xB5, 0xF3, 0x65, 0xF4, 0x81, 0xEE, 0xB6, 0x5C, 0x6E, 0x69, 0xEC, 0xA2, 0xCF, 0x61,
+  0x72, 0xE5, 0x81, 0x64, 0x75, 0x6F, 0x6C, 0xE3, 0x62, 0xE1, 0x03, 0xB4, 0x47, 0x74, 0xF3, 0x02,
+  0x83, 0xEC, 0xB6, 0x0B, 0xE5, 0x69, 0x02, 0x84, 0x6C, 0xE1, 0xB4, 0x9E, 0xAE, 0x81, 0x65, 0x74,
+  0x75, 0x70, 0x6D, 0x6F, 0xE3, 0x62, 0xF3, 0x69, 0x06, 0x03, 0x03, 0x05, 0x07, 0x87, 0xF5, 0xB5,
+  0x45, 0xF2, 0xB5, 0x42, 0x6E, 0x65, 0xF3, 0xA1, 0xA2, 0xE9, 0x03, 0xB4, 0x7B, 0xF5, 0xB2, 0xED,
+  0xE1, 0x2C, 0xF8, 0x25, 0x7F, 0xA3, 0x98, 0xAE, 0x1E, 0x07, 0x03, 0x04, 0x0C, 0x0E, 0x06, 0x10,
+  0x05, 0x08, 0x08, 0x04, 0x04, 0x06, 0x15, 0x04, 0x12, 0x32, 0xB2, 0x20, 0xA8, 0x02, 0x21, 0x1B,
+  0x20, 0x88, 0x20, 0x41, 0xA0, 0x2A, 0xF8, 0x69, 0x81, 0x75, 0xF6, 0xA0, 0x7D, 0xF6, 0xA0, 0x40,
+  0xF4, 0x69, 0xB5, 0xC5, 0xF3, 0x69, 0x03, 0xB4, 0x27, 0x79, 0x73, 0xF0, 0x81, 0xEF, 0xB4, 0xD2,
+  0xF2, 0x69, 0x81, 0x6F, 0x77, 0x65, 0x62, 0x64, 0x6C, 0x75, 0x6F, 0xE3, 0xAA, 0x81, 0xF0, 0x69,
+  0x35, 0x42, 0xA0, 0x28, 0xEE, 0x69, 0x81, 0x6D, 0x79, 0x67, 0x73, 0x6B, 0x75, 0x72, 0xE2, 0x81,
+  0x72, 0xF5, 0xB2, 0xDF, 0xED, 0x69, 0x35, 0xA8, 0x95, 0xEB, 0x69, 0x81, 0xF3, 0x81, 0xE8, 0xB4,
+  0x81, 0xE9, 0x69, 0x81, 0xF4, 0x81, 0xF2, 0xAC, 0xD7, 0xE8, 0x69, 0xB4, 0x75, 0xE7, 0x69, 0xB5,
+  0x9B, 0xE6, 0x69, 0x81, 0xEE, 0xB5, 0x89, 0xE4, 0x69, 0x03, 0xB5, 0x76, 0xEE, 0x03, 0xA2, 0x6B,
+  0x75, 0x62, 0x72, 0x6F, 0x66, 0x6C, 0x61, 0xEE, 0x81, 0x75, 0xED, 0x8D, 0xE3, 0x69, 0xB5, 0x87,
+  0xE2, 0x69, 0x02, 0x89, 0x72, 0x6F, 0xE6, 0x81, 0xED, 0x81, 0xEF, 0xB2, 0x03, 0x69, 0x62, 0xEE,
+  0xB4, 0x45, 0xE1, 0x69, 0x02, 0x8A, 0x64, 0x69, 0x73, 0x6E, 0x69, 0x6D, 0x33, 0xB2, 0xA7, 0x9C,
+  0x62, 0x61, 0x70, 0xAE, 0xB0, 0xA5, 0xF2, 0x69, 0x09, 0x1A, 0x09, 0x1F, 0x03, 0x16, 0x03, 0xAC,
+  0x6A, 0xF5, 0x05, 0x03, 0x0E, 0xAD, 0x23, 0xFA, 0xB5, 0x4D, 0xF4, 0x02, 0x86, 0x6E, 0xE5, 0x81,
+  0xE3, 0xB3, 0x84, 0x69, 0x6E, 0xF2, 0xAA, 0x64, 0xE3, 0xB1, 0x2E, 0xF4, 0x81, 0xE1, 0x81, 0xE5,
+  0x81, 0xE8, 0xB5, 0x31, 0x6F, 0x74, 0xF3, 0x69, 0x81, 0xAE, 0x02, 0x88, 0x79, 0xE6, 0x81, 0xEC,
+  0x81, 0xEC, 0xB1, 0x15, 0xE5, 0x02, 0x85, 0x73, 0x61, 0xE2, 0xAE, 0xCF, 0x72, 0x61, 0xF7, 0x81,
+  0xF0, 0xA0, 0xD8, 0xE2, 0xB4, 0xFC, 0xE1, 0x03, 0x06, 0x83, 0x77, 0xF4, 0x81, 0xE6, 0xA1, 0x2C,
+  0xF0, 0xB4, 0xEB, 0xE3, 0x69, 0x81, 0x68, 0xF4, 0x81, 0x6C, 0xE1, 0x81, 0xE5, 0xB4, 0x09, 0xAE,
+  0x2B, 0xEB, 0x23, 0xC9, 0xA2, 0xDF, 0xF0, 0x69, 0x03, 0x05, 0x83, 0xF9, 0x81, 0xEB, 0xB4, 0x75,
+  0xE9, 0xAF, 0x95, 0xAE, 0x32, 0x7F, 0x14, 0x22, 0x17, 0x06, 0x1E, 0x86, 0xEE, 0x69, 0x05, 0x08,
+  0x20, 0x5A, 0x9A, 0x72, 0x75, 0x6F, 0xE2, 0x81, 0xEC, 0xB2, 0x7B, 0xEF, 0x69, 0x05, 0x15, 0x0E,
+  0x08, 0x83, 0xFA, 0x69, 0x81, 0xAE, 0x06, 0x07, 0x23, 0x66, 0xA9, 0x60, 0x6E, 0x6F, 0x74, 0x69,
+  0x72, 0xF4, 0x62, 0x36, 0xB6, 0xB3, 0x62, 0x74, 0xF3, 0x03, 0xB2, 0xFA, 0xE5, 0x03, 0xA3, 0x75,
+  0x67, 0x64, 0xE9, 0xA1, 0x7A, 0x6C, 0x61, 0x74, 0xE9, 0x81, 0xF0, 0xB2, 0xAB, 0xE8, 0xB4, 0x2C,
+  0xAE, 0x03, 0x0A, 0x89, 0x6B, 0x6E, 0x69, 0xEC, 0x81, 0xE5, 0x81, 0xED, 0xB3, 0x98, 0xE5, 0x81,
+  0x63, 0xE9, 0x81, 0x76, 0xF2, 0xB0, 0x72, 0x64, 0x65, 0x72, 0x6E, 0xEF, 0x69, 0x81, 0x2E, 0x67,
+  0x6E, 0x69, 0xE7, 0xB3, 0x88, 0xE9, 0x03, 0xB2, 0x53, 0x6C, 0x6E, 0xEF, 0x69, 0x81, 0xAE, 0x04,
+  0x07, 0xB3, 0xAD, 0x65, 0x67, 0x61, 0x74, 0x73, 0xAD, 0x81, 0x6F, 0x72, 0xE5, 0xB4, 0x25, 0x67,
+  0x6F, 0xEC, 0xB4, 0x3C, 0xED, 0x69, 0x08, 0x04, 0x0A, 0x1C, 0x31, 0xCC, 0xA0, 0x38, 0x6F, 0xF2,
+  0xB0, 0x98, 0xE9, 0x03, 0xB3, 0x7B, 0x74, 0xF7, 0x81, 0xEF, 0xB3, 0x15, 0xE1, 0x03, 0xB3, 0xFC,
+  0xEE, 0x69, 0x81, 0xAE, 0x02, 0x89, 0x73, 0x69, 0x68, 0x2E, 0x74, 0x6F, 0xE7, 0xA9, 0xD9, 0x72,
+  0x65, 0x68, 0x2E, 0x74, 0x6F, 0xE7, 0xA9, 0xD0, 0xAE, 0x15, 0x0E, 0x05, 0x07, 0x15, 0x11, 0x0D,
+  0x16, 0x15, 0x0C, 0x0A, 0x08, 0x07, 0x20, 0x20, 0x08, 0x11, 0x0C, 0x04, 0xB1, 0x61, 0xF9, 0x05,
+  0x23, 0xF3, 0xAF, 0x62, 0x6F, 0x6C, 0x70, 0xE5, 0x81, 0xE4, 0xAE, 0xD6, 0xF6, 0x27, 0x1B, 0xAC,
+  0xA2, 0xF5, 0x03, 0xB3, 0xBB, 0xE1, 0xA0, 0xB3, 0xF4, 0x03, 0xB3, 0xC8, 0xF3, 0x02, 0x85, 0xEF,
+  0x81, 0xE8, 0xB3, 0x63, 0x61, 0x63, 0x64, 0x6E, 0xF5, 0x81, 0xEF, 0xB3, 0x68, 0xF3, 0x05, 0x05,
+  0x03, 0xA8, 0x72, 0x75, 0x6D, 0xE8, 0xA3, 0x8E, 0xEE, 0xA3, 0x07, 0xE4, 0xB3, 0x42, 0xF2, 0x04,
+  0x04, 0xA0, 0x85, 0x6F, 0xE6, 0xA4, 0x54, 0x69, 0xE4, 0xA0, 0x58, 0xF0, 0x04, 0x03, 0xA5, 0xD8,
+  0xEA, 0xA0, 0x78, 0xE9, 0x03, 0xB3, 0x2E, 0x73, 0x6E, 0x61, 0x72, 0x74, 0x2E, 0x65, 0xF4, 0xB1,
+  0x6E, 0xEF, 0x04, 0x0C, 0xB3, 0x7E, 0xF4, 0x02, 0x83, 0xF0, 0xB2, 0xAA, 0xEE, 0x81, 0x69, 0xE7,
+  0xA3, 0x54, 0x62, 0xED, 0xB2, 0x73, 0x6E, 0xEF, 0x81, 0x69, 0x74, 0x61, 0x74, 0x73, 0x6B, 0xF3,
+  0xA7, 0x8B, 0x6B, 0x63, 0x61, 0x74, 0xF3, 0x81, 0x65, 0xE7, 0xB3, 0x46, 0x68, 0x63, 0xF4, 0x81,
+  0x69, 0xEC, 0xB3, 0x3A, 0xE7, 0x03, 0xB3, 0x62, 0xF3, 0xA0, 0x30, 0xE5, 0x03, 0x05, 0x95, 0xF0,
+  0x81, 0xE3, 0xB3, 0x54, 0xE9, 0x03, 0xA0, 0x21, 0x6C, 0x70, 0x61, 0xE4, 0x69, 0x81, 0x2E, 0x74,
+  0x73, 0x6F, 0x68, 0x6C, 0xE1, 0x81, 0xE3, 0xA3, 0x0D, 0xE4, 0x8F, 0x64, 0x75, 0x6F, 0x6C, 0x63,
+  0xF3, 0xB1, 0x33, 0xE2, 0x03, 0xA7, 0xA9, 0xE7, 0x81, 0x2D, 0xF2, 0x81, 0x61, 0x65, 0x67, 0xE5,
+  0x81, 0xEC, 0xAA, 0xA7, 0x61, 0x69, 0x6C, 0xE9, 0x81, 0xF3, 0x81, 0xE1, 0x81, 0xF2, 0xB3, 0x04,
+  0x36, 0xB6, 0xB3, 0x0E, 0xB4, 0x02, 0x87, 0xF0, 0x03, 0xB1, 0xAF, 0xE3, 0xB3, 0x17, 0x33, 0xB2,
+  0xB2, 0x00, 0xEC, 0x0B, 0x06, 0x05, 0x10, 0x05, 0x06, 0x04, 0x09, 0x0D, 0xA3, 0x14, 0x79, 0x74,
+  0xF3, 0x69, 0xA4, 0x56, 0xF0, 0x81, 0xF0, 0xB2, 0xFE, 0xEC, 0x02, 0x89, 0x65, 0x72, 0xE1, 0x81,
+  0xF5, 0x81, 0xF1, 0xB2, 0xF2, 0x61, 0xF3, 0xB1, 0xBE, 0xE9, 0x26, 0x82, 0xAA, 0x6D, 0xE7, 0x69,
+  0x81, 0xEF, 0xB2, 0xA8, 0x64, 0xEE, 0xAF, 0x66, 0xE3, 0x02, 0x83, 0xF2, 0xA9, 0xF0, 0xE1, 0xB2,
+  0xCB, 0xE2, 0x03, 0xB2, 0xD0, 0xE9, 0x03, 0xB2, 0xA9, 0xE4, 0x81, 0xF5, 0xB2, 0xC9, 0xE1, 0x02,
+  0x84, 0xF3, 0x69, 0xA8, 0x73, 0xE4, 0x81, 0xED, 0xA1, 0x8D, 0xEB, 0x69, 0x02, 0x86, 0xE9, 0x31,
+  0xBA, 0x20, 0xD9, 0x84, 0xAE, 0x07, 0x07, 0x04, 0x30, 0xA0, 0xA1, 0xF3, 0xEF, 0x2D, 0x62, 0x23,
+  0xC3, 0xA1, 0x4A, 0xE5, 0x32, 0x82, 0x90, 0xE3, 0x32, 0x2B, 0xA0, 0x72, 0xEA, 0x69, 0x81, 0xAE,
+  0x2A, 0x17, 0x26, 0xB4, 0x21, 0xB3, 0x8A, 0xE9, 0x69, 0x03, 0x07, 0x84, 0xF6, 0x03, 0xB1, 0x8E,
+  0xE2, 0xB0, 0x1F, 0x74, 0xE9, 0xAF, 0x19, 0xAE, 0x24, 0x80, 0x28, 0xBC, 0xA5, 0x04, 0xE7, 0x69,
+  0x08, 0x04, 0x12, 0x05, 0x20, 0x58, 0xA0, 0x5F, 0x72, 0xEF, 0xB1, 0x64, 0x6E, 0xE1, 0x02, 0x8A,
+  0x72, 0xEF, 0x69, 0x81, 0x2E, 0xE8, 0x81, 0xE3, 0xAE, 0x59, 0x68, 0xE3, 0xA8, 0x37, 0x65, 0x6C,
+  0xEC, 0xB2, 0x3D, 0xE1, 0x08, 0x03, 0x20, 0x46, 0x2B, 0xB6, 0xA5, 0x15, 0xF9, 0xB0, 0xDB, 0xF0,
+  0x69, 0x81, 0xAE, 0x08, 0x0C, 0x06, 0x05, 0x07, 0x0A, 0x0C, 0x82, 0xF9, 0x02, 0x85, 0xEB, 0x81,
+  0xE3, 0xAD, 0xF0, 0x63, 0xF6, 0xB1, 0x6C, 0x74, 0x65, 0x6E, 0xE7, 0xA7, 0x9E, 0x73, 0x6E, 0xE4,
+  0xB1, 0xBA, 0x6B, 0x73, 0xE5, 0x81, 0xEC, 0xB1, 0xB3, 0x67, 0x72, 0x65, 0xE2, 0x81, 0xE5, 0x81,
+  0xE4, 0xB1, 0xFD, 0xE4, 0x81, 0x65, 0x74, 0x61, 0xEC, 0x81, 0xF3, 0x81, 0xEE, 0xA4, 0xF2, 0xB3,
+  0x81, 0x78, 0xEC, 0xB1, 0x13, 0x67, 0xF4, 0x81, 0xF2, 0xB1, 0x05, 0xAE, 0x07, 0x31, 0xB5, 0x06,
+  0x1E, 0x06, 0x86, 0xF4, 0x03, 0xB1, 0xCD, 0xF6, 0xB1, 0x82, 0xE6, 0x03, 0xA7, 0xBE, 0xE1, 0x31,
+  0x74, 0xA0, 0x5D, 0xE5, 0x69, 0x05, 0x07, 0x03, 0x04, 0x83, 0xF2, 0x03, 0xB0, 0xA2, 0xE7, 0xAE,
+  0xB1, 0xE7, 0xB1, 0x9A, 0x66, 0xE6, 0xB1, 0xB8, 0xE5, 0xB0, 0xB7, 0xAE, 0x0E, 0x03, 0x05, 0x04,
+  0x03, 0x24, 0xCF, 0x29, 0xE7, 0x22, 0xB9, 0x06, 0xA0, 0x2A, 0xF0, 0xA2, 0xE2, 0xED, 0x81, 0xEF,
+  0xAC, 0x6F, 0x6B, 0xE9, 0xAE, 0x1D, 0xE5, 0xA9, 0x22, 0xE2, 0xA7, 0x82, 0xE4, 0x69, 0x06, 0x03,
+  0x0C, 0x06, 0xA5, 0xD8, 0xEF, 0xB2, 0x92, 0xE9, 0x02, 0x83, 0xF5, 0xB1, 0x61, 0x73, 0x64, 0x6F,
+  0xEF, 0xAF, 0x7B, 0x61, 0x72, 0xF4, 0x69, 0xA2, 0xC2, 0xAE, 0x1C, 0x18, 0x20, 0x2A, 0x05, 0x0E,
+  0x20, 0x5D, 0x20, 0x72, 0x11, 0x10, 0x20, 0x68, 0x12, 0x08, 0x0A, 0x12, 0x20, 0x45, 0x09, 0x20,
+  0x35, 0x07, 0x0A, 0x06, 0xA9, 0xB1, 0x7A, 0x74, 0x65, 0xEE, 0x02, 0x8C, 0x73, 0x61, 0x64, 0x74,
+  0x72, 0x65, 0x74, 0xF4, 0x81, 0xE5, 0xA6, 0x84, 0x6D, 0x69, 0x74, 0xE2, 0xA8, 0x2D, 0xF9, 0x05,
+  0x09, 0x07, 0xB0, 0x95, 0x74, 0x69, 0x63, 0xAD, 0x81, 0x61, 0xED, 0xA7, 0x21, 0x6B, 0x73, 0x75,
+  0xF2, 0x81, 0xE6, 0x62, 0x61, 0x77, 0x65, 0x74, 0x61, 0x67, 0xAD, 0x03, 0xB0, 0xB0, 0x6C, 0x6C,
+  0x61, 0xF7, 0x81, 0xE5, 0x81, 0xF2, 0xA8, 0xA3, 0x78, 0xE9, 0x81, 0xB2, 0x61, 0x76, 0x72, 0x65,
+  0x73, 0x69, 0xAD, 0x03, 0xA0, 0x6D, 0xF4, 0x81, 0xF3, 0xAD, 0x18, 0xF3, 0x05, 0x0A, 0x10, 0xA0,
+  0x38, 0x73, 0x6E, 0x64, 0xE4, 0x69, 0x81, 0xAE, 0x22, 0x1D, 0x85, 0x6F, 0x70, 0x65, 0x72, 0xAD,
+  0x02, 0x85, 0xF4, 0x81, 0xE9, 0xB0, 0xC7, 0x6E, 0xF6, 0xB0, 0x8A, 0x6E, 0xE4, 0x04, 0x03, 0x06,
+  0x86, 0xF0, 0xB0, 0x81, 0x69, 0x73, 0x6F, 0xE3, 0xA0, 0x58, 0xAD, 0x05, 0x04, 0x09, 0x0A, 0x89,
+  0x79, 0xE1, 0xA9, 0x5E, 0x74, 0x65, 0xEE, 0x81, 0x72, 0x65, 0xF4, 0xAF, 0x59, 0x73, 0x65, 0x68,
+  0x63, 0x73, 0x69, 0x6D, 0xE1, 0xA1, 0xE5, 0x6E, 0x75, 0xE6, 0x81, 0xE9, 0x81, 0xE1, 0xB0, 0xC5,
+  0xE4, 0xAE, 0xB3, 0x64, 0xAD, 0x20, 0xB0, 0x86, 0xF2, 0x02, 0x8D, 0x6F, 0x67, 0x69, 0x76, 0xAD,
+  0x03, 0xB0, 0x2B, 0xEE, 0x81, 0xE9, 0xAE, 0x5E, 0xE5, 0x05, 0x20, 0x23, 0x16, 0x8E, 0x76, 0x72,
+  0x65, 0xF3, 0x04, 0x0D, 0xA0, 0xDD, 0x62, 0x65, 0x77, 0x2D, 0x65, 0x6D, 0x6F, 0xE8, 0x69, 0x81,
+  0xAE, 0xA1, 0xA9, 0x2D, 0xE5, 0x02, 0x85, 0x6D, 0x6F, 0xE8, 0xB0, 0x04, 0x62, 0x75, 0xE3, 0xAF,
+  0x8A, 0xF4, 0x03, 0x05, 0x86, 0x75, 0x6F, 0xF2, 0xA0, 0xAF, 0x74, 0x75, 0x62, 0xAD, 0xAE, 0xF6,
+  0x61, 0x64, 0xF0, 0x81, 0xF5, 0xA1, 0x04, 0x73, 0xF5, 0x02, 0x82, 0xAD, 0x81, 0x6C, 0xE1, 0x81,
+  0x75, 0x74, 0xF2, 0xAD, 0x50, 0x6E, 0x74, 0x72, 0x61, 0x70, 0x64, 0x65, 0x65, 0x70, 0x73, 0x2E,
+  0x72, 0xE5, 0x81, 0x6D, 0xEF, 0x81, 0x74, 0xF3, 0xAE, 0xA9, 0xF0, 0x04, 0x08, 0xAF, 0xAB, 0x69,
+  0x6F, 0xE7, 0x69, 0x81, 0xEF, 0xAF, 0x44, 0x68, 0xB2, 0xA2, 0x71, 0xEF, 0x81, 0x72, 0x70, 0x2D,
+  0x79, 0xF4, 0x81, 0xE9, 0x81, 0x6E, 0xF5, 0x81, 0xED, 0xB0, 0x13, 0xEE, 0x07, 0x06, 0x18, 0x16,
+  0x13, 0x0A, 0x86, 0x70, 0xF6, 0x20, 0x3A, 0xA0, 0xFB, 0x6F, 0x69, 0x74, 0x61, 0x74, 0x73, 0x6B,
+  0x73, 0x69, 0x64, 0xAD, 0x81, 0xF9, 0x81, 0x67, 0x6F, 0xEC, 0x81, 0x6F, 0xEE, 0x81, 0xF9, 0xAF,
+  0x94, 0x6E, 0x6F, 0x72, 0x62, 0x6C, 0x69, 0x65, 0x68, 0x2D, 0x73, 0x68, 0x2E, 0x74, 0xE9, 0x81,
+  0x2E, 0xF3, 0x81, 0x65, 0xE7, 0xA7, 0x19, 0xE9, 0x02, 0x8B, 0x6C, 0x72, 0x65, 0xE2, 0x81, 0x2D,
+  0xEE, 0x20, 0xFB, 0xAD, 0xD4, 0x65, 0x6D, 0xF4, 0xA0, 0x7F, 0x65, 0x73, 0x67, 0x6E, 0x75, 0xF4,
+  0x81, 0xE9, 0xA6, 0xA7, 0x61, 0xF7, 0x81, 0xAD, 0xAF, 0x46, 0x2D, 0x69, 0x2D, 0x67, 0x2D, 0x6F,
+  0xAD, 0xAE, 0xC8, 0xED, 0x03, 0xAF, 0xA7, 0x72, 0x6F, 0x66, 0x74, 0x74, 0x61, 0x6C, 0xF0, 0x81,
+  0xEC, 0x81, 0xF5, 0xAD, 0xB0, 0xEC, 0x81, 0xF3, 0x81, 0x64, 0xAD, 0xAE, 0x29, 0x6B, 0x65, 0x65,
+  0x67, 0x6E, 0x69, 0x65, 0xF4, 0xA0, 0x42, 0x68, 0x63, 0x69, 0x65, 0x72, 0x65, 0x62, 0x73, 0x6E,
+  0x6F, 0x69, 0x73, 0x73, 0x75, 0x6B, 0xF3, 0xA3, 0x94, 0xE5, 0x06, 0x0B, 0x0A, 0x07, 0x0E, 0x8B,
+  0x74, 0x69, 0x65, 0x73, 0x62, 0x65, 0x77, 0x33, 0xB2, 0xA1, 0xB1, 0x6E, 0x69, 0x68, 0x63, 0x61,
+  0x6D, 0x79, 0xE5, 0xAB, 0xFB, 0x6D, 0x6F, 0xE8, 0x81, 0xF3, 0xAB, 0x85, 0x6C, 0x75, 0x68, 0x63,
+  0x73, 0xF6, 0x81, 0xF2, 0x81, 0xE5, 0x81, 0xF3, 0xAE, 0x48, 0x64, 0x61, 0x72, 0x65, 0x67, 0x74,
+  0x6D, 0x75, 0xE5, 0xA2, 0x3C, 0x63, 0x61, 0x70, 0x73, 0x72, 0x65, 0x62, 0xF5, 0x62, 0x64, 0xE5,
+  0x81, 0x63, 0x61, 0x6C, 0xF0, 0xAF, 0x1D, 0xE2, 0x03, 0x17, 0x85, 0x76, 0x7A, 0x2D, 0x6E, 0x65,
+  0x6C, 0x6C, 0x65, 0x74, 0x73, 0x65, 0x62, 0x67, 0x69, 0x74, 0x73, 0x6E, 0x67, 0x2D, 0x2D, 0xEE,
+  0xB0, 0x2F, 0x72, 0x62, 0xAD, 0xAD, 0x9F, 0x6F, 0x77, 0x2D, 0x6E, 0x72, 0x65, 0x66, 0x65, 0x69,
+  0x6C, 0x67, 0x69, 0x74, 0x73, 0x6E, 0x67, 0x2D, 0x2D, 0xEE, 0xB0, 0x15, 0x61, 0x6D, 0x69, 0xEC,
+  0x81, 0xB4, 0x61, 0xB7, 0x81, 0x65, 0x72, 0xE1, 0x81, 0x75, 0xF1, 0xAE, 0x88, 0x34, 0x32, 0x70,
+  0x69, 0xAD, 0x88, 0xB1, 0x81, 0xF3, 0x81, 0x6E, 0xE4, 0x81, 0xEE, 0x81, 0xF9, 0xAC, 0xD7, 0xE3,
+  0x07, 0x09, 0x20, 0x30, 0x04, 0xA0, 0x30, 0x72, 0x6F, 0xE6, 0x81, 0xF2, 0x81, 0xE9, 0xAE, 0xD7,
+  0xEE, 0x02, 0x8B, 0x65, 0x69, 0x63, 0xF3, 0x69, 0x81, 0x2E, 0x6F, 0xE2, 0xAE, 0x55, 0xE1, 0x06,
+  0x17, 0x26, 0x1B, 0xA6, 0x7D, 0x72, 0x75, 0x73, 0x6E, 0xE9, 0x69, 0x02, 0x8B, 0x73, 0x72, 0xE5,
+  0x81, 0xEC, 0x81, 0xE5, 0x81, 0xF6, 0xA1, 0x99, 0x65, 0xE6, 0xA4, 0x82, 0x69, 0xEC, 0xAC, 0xFA,
+  0xE9, 0x69, 0xA6, 0x23, 0xE1, 0x04, 0x03, 0xA0, 0x21, 0xF3, 0xAE, 0x53, 0x70, 0xF3, 0x69, 0x02,
+  0x85, 0x61, 0x72, 0xF4, 0xA4, 0x6F, 0xAE, 0x03, 0x06, 0x86, 0x74, 0x73, 0x61, 0xE6, 0xAE, 0x00,
+  0x72, 0xE5, 0x81, 0xE2, 0xAC, 0x6A, 0x6C, 0x6C, 0x61, 0x34, 0xF3, 0xAF, 0x84, 0x6C, 0xF0, 0x69,
+  0x81, 0xAE, 0xAE, 0x5C, 0x30, 0x6B, 0x72, 0x62, 0x64, 0x34, 0x2D, 0x2D, 0x6E, 0xF8, 0x69, 0x81,
+  0xAE, 0x04, 0x0C, 0x0E, 0x8C, 0x64, 0x38, 0x6C, 0x68, 0x62, 0x64, 0x35, 0x2D, 0x2D, 0xEE, 0xAF,
+  0x60, 0x63, 0x36, 0x79, 0x74, 0x64, 0x67, 0x62, 0x64, 0x34, 0x2D, 0x2D, 0xEE, 0xAF, 0x52, 0x62,
+  0x38, 0x61, 0x64, 0x62, 0x65, 0x68, 0x2D, 0x2D, 0xEE, 0xAF, 0x46, 0x61, 0x32, 0x71, 0x62, 0x64,
+  0x38, 0x2D, 0x2D, 0xEE, 0xAF, 0x3B, 0xE2, 0x69, 0x03, 0x07, 0x86, 0x75, 0xF4, 0x69, 0x81, 0xF5,
+  0xAD, 0x07, 0x6F, 0xF2, 0x81, 0xF4, 0xAC, 0xEF, 0xAE, 0x0A, 0x15, 0x03, 0x11, 0x09, 0x0B, 0x28,
+  0x94, 0xA3, 0x81, 0x73, 0x6E, 0x6F, 0x69, 0x74, 0x75, 0x6C, 0x6F, 0x73, 0x74, 0x73, 0x6F, 0x68,
+  0x72, 0x65, 0x74, 0x6E, 0x69, 0xAE, 0xAC, 0xB1, 0xF0, 0xAD, 0x69, 0x6E, 0x65, 0x76, 0x75, 0x65,
+  0x6C, 0x75, 0x6B, 0x2E, 0x79, 0x78, 0x6F, 0x72, 0x70, 0xFA, 0xAD, 0xB8, 0x6C, 0x72, 0x75, 0x73,
+  0x6E, 0x61, 0x72, 0xF4, 0x62, 0x67, 0x6E, 0x69, 0x74, 0xF3, 0x81, 0xEF, 0x81, 0xE8, 0xA8, 0xB0,
+  0x65, 0x74, 0x69, 0x73, 0x62, 0x65, 0x77, 0x33, 0xB2, 0x81, 0xB1, 0x61, 0xE1, 0x69, 0x03, 0xA6,
+  0x18, 0xAE, 0x2B, 0xC1, 0x20, 0x42, 0x21, 0x83, 0x0C, 0x1A, 0x04, 0x86, 0x37, 0x30, 0x37, 0x62,
+  0x30, 0x65, 0x33, 0x2D, 0x2D, 0xEE, 0xAE, 0xB9, 0x34, 0x31, 0x38, 0x74, 0x78, 0x68, 0x2D, 0x2D,
+  0xEE, 0xAE, 0xAE, 0x33, 0x6D, 0x61, 0x30, 0x65, 0x31, 0x63, 0x76, 0x72, 0x2D, 0x2D, 0xEE, 0xAE,
+  0xA0, 0x32, 0x61, 0x36, 0x61, 0x31, 0x62, 0x36, 0x62, 0x31, 0x69, 0x2D, 0x2D, 0xEE, 0xAE, 0x91,
+  0xB1, 0x03, 0x0A, 0x85, 0x74, 0x61, 0x33, 0x6B, 0x67, 0x2D, 0x2D, 0xEE, 0xAE, 0x83, 0x37, 0x61,
+  0xB1, 0xAE, 0x2A, 0x35, 0x33, 0x77, 0xEC, 0xAE, 0x6A, 0xE4, 0x1D, 0x08, 0x21, 0xF1, 0x13, 0x1A,
+  0x20, 0x43, 0x05, 0x20, 0x28, 0x12, 0x0E, 0x20, 0x52, 0x0A, 0x07, 0x03, 0x20, 0x20, 0x1C, 0x0E,
+  0x11, 0x0D, 0x0B, 0x0B, 0x0A, 0xA0, 0x20, 0x7A, 0x61, 0x35, 0x63, 0x62, 0xE7, 0xAE, 0x3A, 0x75,
+  0x6F, 0x6C, 0xE3, 0x69, 0x81, 0xAE, 0x13, 0x0D, 0x0E, 0x20, 0xAB, 0x0A, 0x0E, 0x09, 0x20, 0x25,
+  0x10, 0x19, 0x0D, 0x07, 0x11, 0x18, 0x09, 0x0D, 0x98, 0x79, 0x61, 0x77, 0x6F, 0x63, 0x6E, 0xE5,
+  0x81, 0xAE, 0x81, 0xF5, 0xAC, 0xEE, 0x78, 0x65, 0x6C, 0x70, 0x63, 0x69, 0x66, 0xE6, 0x81, 0xE1,
+  0x81, 0xF2, 0xAD, 0x11, 0x77, 0x63, 0x73, 0xAE, 0x08, 0x0B, 0x20, 0x23, 0x20, 0x39, 0x1F, 0x8A,
+  0x77, 0x61, 0x77, 0x2D, 0x6C, 0x70, 0xAE, 0x20, 0x33, 0x10, 0x9A, 0xF3, 0x03, 0x0B, 0x91, 0x6D,
+  0x61, 0x2D, 0x6C, 0x6E, 0xAE, 0x20, 0x25, 0x0C, 0x04, 0x9A, 0x65, 0x63, 0x6E, 0x61, 0x74, 0x73,
+  0x6E, 0x69, 0xAE, 0x03, 0xA9, 0xEC, 0xF6, 0x81, 0xE9, 0xAC, 0x18, 0xB8, 0xA9, 0x62, 0x72, 0x61,
+  0x70, 0x2D, 0x72, 0x66, 0xAE, 0x05, 0x0C, 0x04, 0x0A, 0x90, 0x73, 0x38, 0xEB, 0x69, 0x81, 0x2E,
+  0x73, 0xE5, 0x81, 0xE4, 0xAC, 0x41, 0x6D, 0xE8, 0xAA, 0xA4, 0x65, 0x74, 0x69, 0x73, 0x62, 0x65,
+  0xF7, 0x81, 0xAD, 0x91, 0x63, 0x6E, 0xE6, 0x69, 0x81, 0x2E, 0x73, 0x6E, 0x6F, 0x69, 0x74, 0xE3,
+  0x81, 0xEE, 0xA1, 0xC8, 0xB3, 0xAC, 0x2E, 0x6C, 0x61, 0x74, 0x65, 0x6D, 0x65, 0x72, 0x61, 0x62,
+  0xAE, 0x02, 0x83, 0x32, 0xAD, 0x8B, 0x31, 0xAD, 0x02, 0x86, 0x73, 0x6D, 0x61, 0xAD, 0xAC, 0x0D,
+  0x72, 0x61, 0x70, 0xAD, 0xAB, 0x4A, 0x6B, 0x6F, 0x6F, 0x62, 0x65, 0x6C, 0x61, 0xE3, 0xAC, 0x05,
+  0x67, 0x6E, 0x69, 0x6C, 0x65, 0x62, 0x61, 0x6C, 0x74, 0x72, 0xE1, 0x81, 0xED, 0xAB, 0xF6, 0x75,
+  0x6C, 0x75, 0x6C, 0x65, 0xF4, 0x81, 0xEF, 0xA7, 0x61, 0x74, 0x65, 0x6E, 0x72, 0x61, 0x78, 0x61,
+  0x2E, 0x31, 0xAD, 0x81, 0xF3, 0xAC, 0x1D, 0x73, 0x63, 0x69, 0x74, 0xE1, 0x81, 0x74, 0xF3, 0x62,
+  0xF2, 0x02, 0x8F, 0xEF, 0x02, 0x89, 0x74, 0x6E, 0x65, 0x6D, 0xE5, 0x81, 0xEC, 0xAC, 0x05, 0xF0,
+  0xAA, 0x00, 0xE5, 0x02, 0x87, 0x70, 0x6F, 0x6C, 0x72, 0xEF, 0xAA, 0xBE, 0x68, 0x63, 0x6E, 0x61,
+  0x72, 0x2D, 0x6E, 0xEF, 0x62, 0xEE, 0x02, 0x84, 0x77, 0xEF, 0xA9, 0x90, 0x65, 0x76, 0x75, 0x65,
+  0xEC, 0x81, 0xF5, 0xA8, 0x9B, 0xED, 0x02, 0x8F, 0x69, 0x61, 0x6C, 0x63, 0x65, 0x72, 0xAE, 0x05,
+  0x20, 0x83, 0xA9, 0x8F, 0xF3, 0xA9, 0xE9, 0x65, 0x64, 0xE1, 0x81, 0xE9, 0xA9, 0xE8, 0x6C, 0x65,
+  0x74, 0x65, 0x6D, 0x69, 0x72, 0xF0, 0x69, 0x81, 0xAE, 0xA0, 0x6E, 0x69, 0x61, 0x7A, 0x6E, 0x61,
+  0xE2, 0x62, 0x67, 0x6E, 0x69, 0x74, 0x73, 0x6F, 0x68, 0x64, 0x6E, 0x65, 0x72, 0x74, 0xAE, 0x28,
+  0x29, 0xA0, 0x88, 0xE5, 0x03, 0xA5, 0x27, 0x74, 0x69, 0x73, 0xEF, 0x02, 0x88, 0x74, 0x6E, 0x65,
+  0x67, 0xE1, 0x81, 0xED, 0x62, 0x69, 0x73, 0x6E, 0x65, 0xF3, 0x62, 0x64, 0x72, 0x61, 0x79, 0xEB,
+  0x81, 0xEE, 0xA1, 0x8A, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6C, 0x65, 0x6A, 0xAE, 0x81, 0xF0, 0xA8,
+  0x94, 0xE2, 0x02, 0x8C, 0x65, 0x77, 0x69, 0x6C, 0x65, 0xEB, 0x69, 0x81, 0x2E, 0xF3, 0xAB, 0x82,
+  0x64, 0x6E, 0xE5, 0x81, 0xF6, 0x81, 0xE1, 0xAB, 0x73, 0xE1, 0x03, 0x0D, 0x8A, 0x78, 0xEF, 0x69,
+  0x81, 0xAE, 0x02, 0x83, 0xEE, 0xAB, 0x7E, 0xEB, 0xA9, 0x66, 0x74, 0x63, 0x65, 0xF0, 0x81, 0xF3,
+  0x81, 0xF2, 0xAB, 0x06, 0x62, 0x75, 0x72, 0x61, 0x2D, 0x76, 0x6E, 0x65, 0x6A, 0xAE, 0x02, 0x8B,
+  0x61, 0x62, 0x75, 0x72, 0x61, 0x2E, 0x72, 0x75, 0x65, 0xAE, 0x81, 0xB1, 0x81, 0xF4, 0xAA, 0x42,
+  0xF4, 0x69, 0x05, 0x26, 0x0B, 0xA4, 0x47, 0x65, 0x78, 0x63, 0x77, 0x6B, 0x63, 0x63, 0x2D, 0x2D,
+  0xEE, 0xAC, 0x4E, 0xF3, 0x69, 0x02, 0x89, 0xED, 0x69, 0x81, 0x6B, 0xE3, 0x81, 0xF2, 0xA8, 0xE6,
+  0xAE, 0x24, 0xDE, 0x23, 0x60, 0x21, 0x2C, 0x20, 0x45, 0x21, 0x4E, 0x1E, 0x8C, 0xF2, 0x05, 0x18,
+  0x09, 0xA0, 0xB4, 0xEB, 0x69, 0x02, 0x8F, 0x6A, 0x68, 0x33, 0x61, 0x31, 0x68, 0x61, 0x62, 0x67,
+  0x6D, 0x2D, 0x2D, 0xEE, 0xAC, 0x1B, 0xAE, 0x2A, 0xD7, 0xA0, 0x20, 0x65, 0x66, 0x35, 0x30, 0x36,
+  0x77, 0xB4, 0xA3, 0xD6, 0xE1, 0x02, 0x86, 0x75, 0xE7, 0x81, 0xEE, 0xA8, 0xC5, 0xE3, 0x02, 0x88,
+  0xF9, 0x81, 0x61, 0x6C, 0x63, 0xF2, 0xAA, 0x46, 0x74, 0xE9, 0x81, 0xE4, 0x81, 0xE5, 0xA7, 0xAD,
+  0xEF, 0x20, 0x97, 0xA9, 0x89, 0xEE, 0x04, 0x03, 0xA9, 0xCE, 0xF5, 0xA9, 0xA5, 0xE1, 0x03, 0xAA,
+  0xB1, 0xEC, 0x69, 0x02, 0x84, 0x72, 0xE1, 0xA7, 0xEF, 0x2E, 0x63, 0x69, 0x74, 0x61, 0x74, 0xF3,
+  0x69, 0x81, 0xAE, 0x02, 0x83, 0xF6, 0xA7, 0x9A, 0x73, 0x65, 0xF4, 0xA8, 0x82, 0xED, 0x69, 0x81,
+  0xAE, 0x06, 0x05, 0x27, 0x84, 0xA2, 0xD5, 0xF4, 0x2A, 0x7F, 0xA0, 0x2E, 0xF0, 0xA5, 0xAB, 0xEC,
+  0x04, 0x04, 0xAA, 0x62, 0x72, 0xEF, 0xA8, 0x86, 0xE9, 0x81, 0xF5, 0xAA, 0x77, 0xE9, 0x69, 0x07,
+  0x06, 0x08, 0x2A, 0x16, 0xA0, 0x48, 0x72, 0xE4, 0x81, 0xE1, 0xAA, 0x7C, 0x6F, 0xF2, 0x81, 0xE4,
+  0x81, 0xEE, 0xAA, 0x83, 0xAE, 0x12, 0x09, 0x06, 0x07, 0x05, 0x09, 0x23, 0xF1, 0x21, 0x32, 0x23,
+  0x25, 0x20, 0x38, 0x0A, 0x21, 0xAD, 0x88, 0x79, 0xED, 0x69, 0x81, 0x2E, 0x73, 0x73, 0xF2, 0x62,
+  0x73, 0x65, 0x70, 0xEE, 0xA6, 0xFC, 0xF0, 0x81, 0xE1, 0x81, 0xEC, 0xA9, 0x25, 0xEF, 0x25, 0x11,
+  0xA5, 0x0D, 0xE5, 0x81, 0xF4, 0x81, 0xF2, 0x81, 0xEF, 0xA9, 0x17, 0x61, 0xF3, 0xA7, 0x23, 0xE8,
+  0x05, 0x29, 0xD5, 0xA0, 0x69, 0x64, 0xB3, 0xA4, 0x57, 0xE7, 0x69, 0x81, 0xAE, 0x29, 0xFB, 0x86,
+  0xE6, 0xAA, 0x1F, 0xE5, 0x04, 0x07, 0x07, 0x84, 0x74, 0x69, 0xED, 0x81, 0xE9, 0xA9, 0x2C, 0x73,
+  0x6F, 0xF0, 0x81, 0xF8, 0xA9, 0xEE, 0xF2, 0x69, 0xA6, 0xA6, 0xED, 0x69, 0x81, 0xE2, 0x81, 0x75,
+  0xEC, 0xA9, 0xFF, 0xE3, 0x69, 0x02, 0x95, 0x67, 0x39, 0x61, 0x32, 0x67, 0x32, 0x62, 0x30, 0x61,
+  0x65, 0x30, 0x63, 0x68, 0x63, 0x6C, 0x63, 0x2D, 0x2D, 0xEE, 0xAB, 0x05, 0xAE, 0xA9, 0xBB, 0xE2,
+  0x6A, 0x81, 0x32, 0x62, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xAA, 0xF4, 0xE1, 0x69, 0x06,
+  0x06, 0x27, 0xC9, 0xA0, 0x64, 0x6F, 0x6C, 0x6E, 0xF7, 0xA6, 0x0E, 0xAE, 0xA0, 0xBA, 0x39, 0x63,
+  0x74, 0x64, 0x76, 0x6B, 0x63, 0x65, 0x2D, 0x2D, 0xEE, 0xAA, 0xD6, 0x37, 0x35, 0x79, 0x72, 0x70,
+  0x6B, 0x2D, 0x2D, 0xEE, 0xAA, 0xCB, 0x36, 0x39, 0x37, 0x75, 0x74, 0x6F, 0x2D, 0x2D, 0xEE, 0xAA,
+  0xC0, 0x35, 0x78, 0x71, 0x35, 0x35, 0x2D, 0x2D, 0xEE, 0xAA, 0xB6, 0xB3, 0x02, 0x93, 0xE3, 0x02,
+  0x87, 0x39, 0x6A, 0x72, 0x63, 0xF0, 0xAA, 0x9B, 0x34, 0x62, 0x31, 0x31, 0x2D, 0x2D, 0xEE, 0xAA,
+  0xA0, 0x31, 0x77, 0x72, 0x70, 0x6B, 0x2D, 0x2D, 0xEE, 0xAA, 0x96, 0x32, 0x75, 0x72, 0x7A, 0x63,
+  0x2D, 0x2D, 0xEE, 0xAA, 0x8C, 0xE3, 0x1C, 0x03, 0x03, 0x1B, 0x10, 0x09, 0x0D, 0x1A, 0x12, 0x20,
+  0x38, 0x04, 0x20, 0x41, 0x20, 0x7F, 0x20, 0x20, 0x20, 0x52, 0x20, 0x2B, 0x1A, 0x20, 0x33, 0x09,
+  0xA0, 0x72, 0xF9, 0xA9, 0x43, 0xF7, 0xA8, 0xF4, 0xF6, 0x69, 0x81, 0xAE, 0x09, 0x0A, 0x27, 0x7C,
+  0x21, 0x93, 0x1E, 0x06, 0x86, 0xF6, 0x03, 0xA9, 0x11, 0xE7, 0x69, 0x81, 0xAE, 0xA7, 0x37, 0xE5,
+  0x81, 0xB0, 0x61, 0xF4, 0x69, 0x05, 0x27, 0x22, 0xA1, 0xA7, 0xAE, 0x03, 0xA5, 0x8A, 0xE5, 0x27,
+  0x1D, 0xA2, 0x0A, 0x72, 0x65, 0xEC, 0x81, 0xE3, 0x81, 0xE5, 0xA8, 0x2F, 0xEE, 0x69, 0x05, 0x28,
+  0x0D, 0xA0, 0xAA, 0xAE, 0x02, 0x95, 0xED, 0xA8, 0x9E, 0xED, 0x69, 0x02, 0x8B, 0x70, 0x31, 0x61,
+  0x6B, 0x63, 0x71, 0x2D, 0x2D, 0xEE, 0xAA, 0x19, 0xAE, 0x02, 0x85, 0xEF, 0x81, 0xF3, 0xA8, 0x0D,
+  0xED, 0xA9, 0x02, 0xEC, 0x69, 0x03, 0xA8, 0x01, 0xAE, 0x09, 0x27, 0x29, 0x21, 0x8D, 0x06, 0x1E,
+  0x02, 0x8A, 0xF9, 0xA8, 0xE9, 0xE9, 0x04, 0x05, 0x05, 0x94, 0xF4, 0x81, 0xE9, 0xA8, 0xD3, 0xF3,
+  0x81, 0xF5, 0xA8, 0xD4, 0xEE, 0x03, 0x09, 0x84, 0x6F, 0x73, 0xE1, 0x81, 0xEE, 0x81, 0xE1, 0xA8,
+  0x6B, 0x69, 0xEC, 0xA8, 0xBD, 0xE1, 0xA8, 0xC2, 0xEC, 0x02, 0x86, 0x6F, 0xE8, 0x81, 0xF4, 0xA6,
+  0xD7, 0x62, 0x75, 0x70, 0x65, 0x72, 0x61, 0x6E, 0xE1, 0x81, 0xEE, 0xA8, 0x11, 0x66, 0xE4, 0xA7,
+  0xC7, 0xE5, 0x69, 0x05, 0x03, 0x06, 0xA8, 0x85, 0xF3, 0xA8, 0x93, 0x62, 0xE5, 0x81, 0xF5, 0xA8,
+  0x42, 0xAE, 0x10, 0x05, 0x05, 0x0E, 0x04, 0x25, 0x81, 0x20, 0xA8, 0x20, 0x84, 0x21, 0x8D, 0x06,
+  0x1E, 0x8C, 0xEF, 0x27, 0x0F, 0xA0, 0xBF, 0xEE, 0x81, 0xE9, 0xA7, 0x56, 0xEC, 0x03, 0xA8, 0x74,
+  0x61, 0x69, 0x63, 0xE9, 0x81, 0xE6, 0x81, 0xE6, 0xA8, 0x74, 0x65, 0xF3, 0xA7, 0xD0, 0x32, 0xB1,
+  0xA4, 0xFE, 0xE3, 0x69, 0x03, 0x09, 0x8D, 0x61, 0xB1, 0x81, 0x6C, 0x2D, 0x2D, 0xEE, 0xA9, 0x71,
+  0x30, 0x61, 0x74, 0x66, 0x37, 0x62, 0x34, 0x35, 0x2D, 0x2D, 0xEE, 0xA9, 0x64, 0xAE, 0x07, 0x04,
+  0x15, 0x0F, 0x11, 0x0A, 0x8A, 0x78, 0xF3, 0xA8, 0x39, 0xF3, 0x04, 0x09, 0xA6, 0xEE, 0x73, 0x65,
+  0x63, 0x63, 0x61, 0x70, 0xF4, 0xA7, 0x0B, 0x6F, 0x74, 0x6F, 0x68, 0xF0, 0xA7, 0xB2, 0x72, 0x65,
+  0x76, 0x72, 0x65, 0x73, 0xAD, 0x81, 0xE5, 0x81, 0xED, 0x81, 0xE1, 0xA7, 0xF1, 0x6E, 0x77, 0x61,
+  0x70, 0x73, 0x2E, 0xF3, 0x81, 0x65, 0x63, 0x6E, 0x61, 0xF4, 0x81, 0xF3, 0xA6, 0x98, 0xEC, 0x81,
+  0xE9, 0x81, 0x61, 0xED, 0x81, 0xF7, 0xA8, 0x0D, 0x67, 0x6E, 0x69, 0x70, 0x70, 0x61, 0x72, 0xE3,
+  0xA7, 0x93, 0x65, 0x75, 0x67, 0x61, 0x65, 0x6C, 0x79, 0x73, 0x61, 0x74, 0xEE, 0x81, 0xE1, 0xA6,
+  0xC1, 0xE2, 0x07, 0x03, 0x12, 0x27, 0xB4, 0xA0, 0x23, 0xF3, 0xA6, 0xFC, 0x66, 0x37, 0x36, 0x61,
+  0x30, 0x63, 0x37, 0x79, 0x6C, 0x71, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA8, 0xE3, 0xE3, 0xA6,
+  0xC1, 0xE1, 0x69, 0x03, 0xA0, 0x3E, 0x33, 0x61, 0x30, 0x39, 0x2D, 0x2D, 0x6E, 0xF8, 0x69, 0x81,
+  0xAE, 0x05, 0x09, 0x03, 0x0E, 0x8B, 0x75, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xA8, 0xC2, 0xF4,
+  0xA1, 0xB9, 0xE8, 0x02, 0x96, 0xFA, 0x81, 0xE1, 0x81, 0x30, 0x39, 0x2D, 0x2D, 0xEE, 0xA8, 0xB1,
+  0x67, 0xF6, 0x81, 0x61, 0x31, 0x63, 0x2D, 0x2D, 0xEE, 0xA8, 0xA6, 0x63, 0x61, 0x31, 0x6F, 0x2D,
+  0x2D, 0xEE, 0xA8, 0x9D, 0xAE, 0x09, 0x25, 0xBD, 0x21, 0x8D, 0x06, 0x1E, 0x06, 0x86, 0xF2, 0x81,
+  0xF2, 0xA5, 0x73, 0x39, 0x6A, 0xF2, 0x02, 0x99, 0xE3, 0x03, 0x07, 0x87, 0x73, 0x32, 0x2D, 0x2D,
+  0xEE, 0xA8, 0x7E, 0x68, 0x33, 0x2D, 0x2D, 0xEE, 0xA8, 0x77, 0x65, 0x67, 0x2D, 0x2D, 0xEE, 0xA8,
+  0x70, 0xE2, 0x04, 0x11, 0xA0, 0x5C, 0xB9, 0x81, 0x73, 0x2D, 0x2D, 0xEE, 0xA8, 0x63, 0xB8, 0x02,
+  0x8D, 0x63, 0x39, 0x6A, 0x72, 0xE2, 0x81, 0x32, 0x68, 0x2D, 0x2D, 0xEE, 0xA8, 0x53, 0x34, 0x78,
+  0x78, 0x32, 0x67, 0x2D, 0x2D, 0xEE, 0xA8, 0x49, 0xB4, 0x04, 0x11, 0x0A, 0x88, 0x65, 0x72, 0x64,
+  0x35, 0x61, 0x39, 0x62, 0x31, 0x6B, 0xE3, 0x81, 0x62, 0x2D, 0x2D, 0xEE, 0xA8, 0x33, 0x62, 0x79,
+  0x6A, 0x39, 0x71, 0x2D, 0x2D, 0xEE, 0xA8, 0x29, 0x61, 0x31, 0x65, 0x2D, 0x2D, 0xEE, 0xA8, 0x21,
+  0x34, 0x75, 0x62, 0x31, 0x6B, 0x6D, 0x2D, 0x2D, 0xEE, 0xA8, 0x16, 0x32, 0x65, 0x39, 0x63, 0x32,
+  0x63, 0xFA, 0xA7, 0xFF, 0xB1, 0x02, 0x89, 0x68, 0x62, 0x67, 0x77, 0x2D, 0x2D, 0xEE, 0xA8, 0x01,
+  0x31, 0xF1, 0x81, 0x35, 0x34, 0x2D, 0x2D, 0xEE, 0xA7, 0xF7, 0xE2, 0x14, 0x14, 0x20, 0x20, 0x13,
+  0x03, 0x0D, 0x11, 0x05, 0x20, 0x24, 0x1B, 0x0B, 0x1D, 0x18, 0x0C, 0x20, 0x23, 0xA5, 0x82, 0x77,
+  0x70, 0x2D, 0x67, 0x6E, 0x75, 0x74, 0x61, 0x72, 0x65, 0x62, 0x73, 0x6E, 0x65, 0x67, 0x6D, 0x72,
+  0xE5, 0xA0, 0xF9, 0xF5, 0x02, 0x86, 0xF0, 0x69, 0x81, 0xAE, 0xA6, 0x0D, 0x6C, 0xE3, 0x69, 0x02,
+  0x85, 0xF3, 0x81, 0xED, 0xA3, 0xD2, 0xAE, 0x05, 0x25, 0x57, 0xA0, 0xA4, 0xE5, 0x81, 0xEC, 0x81,
+  0xE5, 0xA1, 0xA7, 0x74, 0x63, 0x2D, 0x72, 0x65, 0x74, 0x61, 0x72, 0x65, 0x62, 0x73, 0x6E, 0x65,
+  0x67, 0x6D, 0x72, 0xE5, 0xA0, 0xC6, 0xF3, 0x69, 0x86, 0xEC, 0x69, 0x03, 0xA6, 0x78, 0xAE, 0x24,
+  0xBC, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xE4, 0x02, 0x83, 0xED, 0xA5, 0x66, 0x68, 0x65, 0x73, 0x61,
+  0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xA7, 0x7A, 0xE3, 0x21, 0x70, 0xA4, 0x8B, 0xE2, 0x69, 0x03, 0xA6,
+  0x64, 0xAE, 0x0A, 0x03, 0x05, 0x05, 0x24, 0x82, 0x21, 0x93, 0x1E, 0x8C, 0xFA, 0xA1, 0x81, 0xF6,
+  0x26, 0x1A, 0xA0, 0x39, 0xEF, 0x24, 0xCD, 0xA1, 0x6E, 0xE5, 0x81, 0xF2, 0x81, 0xEF, 0xA5, 0x5F,
+  0xE1, 0x07, 0x03, 0x03, 0x26, 0x18, 0x0A, 0x93, 0xF2, 0xA6, 0x3C, 0xE8, 0xA4, 0x8C, 0x30, 0x64,
+  0x63, 0x34, 0x78, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA7, 0x36, 0x38, 0x38, 0x75, 0x76, 0x6F,
+  0x72, 0x2D, 0x2D, 0xEE, 0xA7, 0x2B, 0xB4, 0x02, 0x8A, 0x39, 0x36, 0x72, 0x7A, 0x63, 0x2D, 0x2D,
+  0xEE, 0xA7, 0x1E, 0xB6, 0x02, 0x84, 0x71, 0xE9, 0xA7, 0x09, 0x31, 0x72, 0x66, 0x7A, 0x2D, 0x2D,
+  0xEE, 0xA7, 0x0E, 0xB3, 0x02, 0x8B, 0x6A, 0xE3, 0x81, 0x61, 0x31, 0x64, 0x2D, 0x2D, 0xEE, 0xA7,
+  0x00, 0x62, 0x32, 0x6B, 0x63, 0x63, 0x2D, 0x2D, 0xEE, 0xA6, 0xF6, 0x32, 0xF8, 0x81, 0x74, 0x62,
+  0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA6, 0xEA, 0xB1, 0x03, 0x0A, 0x8B, 0x65, 0x32, 0x6B, 0x63, 0x31,
+  0x2D, 0x2D, 0xEE, 0xA6, 0xDC, 0x36, 0x38, 0x71, 0xF5, 0x81, 0x76, 0x2D, 0x2D, 0xEE, 0xA6, 0xD1,
+  0x32, 0x35, 0x71, 0x68, 0x78, 0x2D, 0x2D, 0xEE, 0xA6, 0xC7, 0x30, 0x30, 0x61, 0x76, 0x65, 0x35,
+  0x61, 0x39, 0x69, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA6, 0xB5, 0xE1, 0x20, 0x30, 0x20,
+  0x56, 0x06, 0x09, 0x09, 0x0F, 0x21, 0xCA, 0x1A, 0x20, 0x29, 0x20, 0x2F, 0x0E, 0x20, 0x66, 0x20,
+  0x5F, 0x20, 0x2F, 0x20, 0x3F, 0x1A, 0x06, 0x20, 0x31, 0x0A, 0x15, 0x07, 0x03, 0x1F, 0x20, 0x88,
+  0x20, 0x56, 0x09, 0x0B, 0x07, 0x20, 0x42, 0x0F, 0x18, 0x20, 0x27, 0xA0, 0x35, 0xFA, 0x02, 0x85,
+  0xFA, 0x81, 0xE9, 0xA5, 0x07, 0xAE, 0x0E, 0x03, 0x05, 0x03, 0x0A, 0x0E, 0x05, 0x05, 0x0D, 0x24,
+  0xEA, 0x06, 0xA0, 0x2A, 0xF7, 0xA4, 0x30, 0xF4, 0x25, 0x15, 0xA0, 0x27, 0xF3, 0xA3, 0xF7, 0x72,
+  0x61, 0x64, 0xEE, 0x81, 0xEF, 0x81, 0xF2, 0xA5, 0x15, 0xEF, 0x02, 0x83, 0xE7, 0xA5, 0x29, 0xE3,
+  0x69, 0x81, 0xAE, 0x81, 0xF4, 0xA5, 0x12, 0xED, 0x24, 0xBD, 0xA0, 0x7E, 0xEC, 0x23, 0x32, 0xA1,
+  0xF5, 0xE3, 0x03, 0xA5, 0x30, 0xE9, 0x03, 0xA5, 0x0D, 0xF2, 0x81, 0xE7, 0xA5, 0x29, 0xE2, 0x81,
+  0xE5, 0xA3, 0x0B, 0x79, 0xEF, 0x81, 0xE7, 0xA3, 0x29, 0xF8, 0x03, 0xA5, 0x18, 0x69, 0x61, 0xE3,
+  0xA3, 0xE5, 0x77, 0xE1, 0x81, 0x6E, 0xE9, 0x81, 0xEB, 0xA5, 0x03, 0xF6, 0x69, 0x06, 0x03, 0x20,
+  0xFB, 0xA0, 0xF2, 0xE2, 0xA4, 0xDE, 0xE1, 0x81, 0xEA, 0x61, 0xF5, 0x69, 0x81, 0xAE, 0x1C, 0x07,
+  0x20, 0x26, 0x03, 0x20, 0x38, 0x07, 0x03, 0x17, 0x07, 0x0A, 0x16, 0x0C, 0x1E, 0x20, 0x3D, 0x1A,
+  0x03, 0x05, 0x05, 0x0C, 0x1C, 0x03, 0x21, 0x80, 0xA1, 0xBB, 0xFA, 0x03, 0xA2, 0xC0, 0xE9, 0xA4,
+  0xB3, 0xF9, 0x03, 0x12, 0x85, 0xF3, 0x03, 0x07, 0x82, 0x74, 0x76, 0x6F, 0x6E, 0xF2, 0xA1, 0x18,
+  0xF3, 0x81, 0x61, 0x6B, 0xF2, 0xA1, 0x11, 0xED, 0x81, 0xF5, 0xA4, 0x49, 0x69, 0x6B, 0x73, 0x74,
+  0x69, 0x6E, 0x6C, 0x65, 0xED, 0xA1, 0x06, 0xF8, 0xA4, 0x98, 0xF6, 0x69, 0x0A, 0x07, 0x1A, 0x21,
+  0x07, 0x22, 0x7B, 0x20, 0xE1, 0x86, 0xEF, 0x02, 0x90, 0xE7, 0x69, 0xA0, 0xE7, 0xE9, 0x05, 0x03,
+  0x03, 0x05, 0x83, 0xF9, 0xA1, 0x1A, 0xF6, 0xA3, 0x92, 0x6B, 0x72, 0xE1, 0xA0, 0xDF, 0xE8, 0xA0,
+  0xD3, 0x61, 0x6C, 0x6F, 0xEB, 0xA3, 0xF9, 0xE5, 0x03, 0xA1, 0x01, 0x61, 0x6C, 0xEF, 0x81, 0xEB,
+  0xA3, 0x14, 0xF4, 0x21, 0xB1, 0x21, 0xC5, 0xA0, 0xDB, 0xF3, 0xA0, 0xF4, 0xF2, 0x06, 0x08, 0x20,
+  0xE3, 0xA3, 0x62, 0x79, 0x6D, 0x6F, 0x74, 0x79, 0xE8, 0xA1, 0x9B, 0x69, 0x6D, 0x6F, 0x74, 0x69,
+  0xE8, 0xA1, 0x93, 0xF0, 0x21, 0x90, 0x20, 0xB0, 0xA1, 0xA6, 0xEF, 0x03, 0xA4, 0x32, 0x6E, 0xF6,
+  0x81, 0xEF, 0xA4, 0x28, 0xEE, 0x0A, 0x05, 0x22, 0x20, 0x20, 0xA6, 0x20, 0x56, 0xA1, 0x00, 0xF9,
+  0x81, 0xEC, 0xA2, 0xC6, 0x6F, 0x73, 0x72, 0xE5, 0xA0, 0x83, 0xED, 0x07, 0x20, 0xAC, 0x23, 0x05,
+  0xA0, 0x5B, 0x79, 0xF2, 0xA0, 0xAA, 0xEC, 0x04, 0x0F, 0xA3, 0xA0, 0x6F, 0x70, 0x6F, 0x74, 0x73,
+  0xE1, 0x02, 0x82, 0xF6, 0x83, 0xE2, 0x81, 0xE5, 0xA3, 0x9B, 0x69, 0x70, 0x6F, 0xEE, 0x81, 0xF2,
+  0x81, 0xE5, 0xA4, 0x01, 0xEB, 0x04, 0x23, 0xE7, 0x86, 0xF3, 0x04, 0x20, 0x22, 0x8A, 0xF6, 0x02,
+  0x91, 0x6F, 0x72, 0x74, 0x65, 0x70, 0x6F, 0x72, 0xF0, 0x02, 0x82, 0xE9, 0x83, 0xE5, 0x81, 0xEE,
+  0xA1, 0xD4, 0x69, 0x6B, 0x6E, 0x61, 0x72, 0x66, 0x2D, 0x6F, 0x6E, 0xE1, 0x81, 0xF6, 0xA2, 0xC2,
+  0xF4, 0x02, 0x8B, 0xE5, 0x81, 0xEE, 0x81, 0xEF, 0xA1, 0xBC, 0x6E, 0x61, 0xE7, 0x81, 0xF5, 0xA2,
+  0xCA, 0xE9, 0x02, 0x8A, 0x79, 0x6B, 0x73, 0x74, 0x79, 0x6E, 0x6C, 0x65, 0xED, 0x8E, 0x73, 0x74,
+  0xF6, 0x81, 0x69, 0x6E, 0xF2, 0x81, 0xE5, 0x81, 0xE8, 0xA3, 0x97, 0xE8, 0xA0, 0x32, 0xE7, 0x22,
+  0xAA, 0xA0, 0xF1, 0xE6, 0x22, 0x20, 0xA0, 0x6C, 0xE5, 0x05, 0x20, 0x4F, 0xA3, 0x46, 0x6E, 0xF6,
+  0x81, 0xE9, 0xA3, 0x78, 0xE4, 0x04, 0x0B, 0xA2, 0x83, 0xEF, 0x69, 0x81, 0x72, 0x6F, 0x67, 0xE8,
+  0x81, 0xFA, 0xA1, 0x6C, 0x61, 0x72, 0x67, 0x6F, 0x76, 0x6F, 0xF2, 0x81, 0xE9, 0x81, 0xEB, 0x61,
+  0xE2, 0xA3, 0x02, 0xE1, 0x06, 0x09, 0x06, 0x0A, 0x14, 0x87, 0x76, 0x61, 0xF4, 0x81, 0xEC, 0x81,
+  0xEF, 0xA2, 0xF9, 0x74, 0xEC, 0x81, 0xE1, 0xA2, 0xEA, 0xF3, 0x02, 0x82, 0xF3, 0x81, 0xE5, 0x81,
+  0xE4, 0xA3, 0x4B, 0xE9, 0x02, 0x87, 0x73, 0x74, 0x79, 0x6E, 0xEE, 0xA0, 0x38, 0x68, 0x7A, 0x68,
+  0x7A, 0x69, 0x72, 0x6F, 0xF0, 0xA0, 0x7D, 0x65, 0x6D, 0xE9, 0x81, 0xF2, 0xA3, 0x24, 0x63, 0x69,
+  0x6E, 0xEE, 0xA0, 0x21, 0xF4, 0x04, 0x05, 0x05, 0x88, 0xEF, 0x81, 0xF9, 0xA2, 0xD9, 0xEC, 0x81,
+  0xE5, 0xA1, 0x13, 0x65, 0xEC, 0x81, 0xE8, 0x81, 0xF4, 0xA3, 0x1C, 0xE1, 0xA1, 0x08, 0xF3, 0x69,
+  0x03, 0x03, 0x8D, 0xE9, 0xA1, 0xA6, 0x61, 0xE3, 0x69, 0x81, 0x2E, 0x75, 0x62, 0x61, 0x6E, 0x2E,
+  0xE9, 0xA0, 0xED, 0xAE, 0x0B, 0x03, 0x20, 0xF1, 0x20, 0x38, 0x21, 0x8D, 0x06, 0x1E, 0x8C, 0xE4,
+  0xA0, 0xA4, 0xE2, 0x81, 0xF5, 0xA2, 0x85, 0xF2, 0x06, 0x0B, 0x15, 0x04, 0xA3, 0x0C, 0xF5, 0x02,
+  0x83, 0xF4, 0xA0, 0xEE, 0xEB, 0x81, 0xE1, 0xA2, 0x6C, 0xEE, 0x69, 0x81, 0x64, 0x35, 0x75, 0x68,
+  0x66, 0x38, 0x6C, 0x65, 0x35, 0x38, 0x72, 0x34, 0x77, 0x2D, 0x2D, 0xEE, 0xA3, 0xD3, 0x65, 0xED,
+  0xA0, 0xD6, 0xE1, 0x81, 0xFA, 0x61, 0xF1, 0x69, 0x81, 0xAE, 0x20, 0xB9, 0x09, 0x21, 0xBC, 0x06,
+  0x06, 0x18, 0x06, 0x86, 0xF0, 0x69, 0x08, 0x20, 0x28, 0x0D, 0x22, 0x00, 0xA0, 0x5D, 0x72, 0xE1,
+  0x69, 0x81, 0xAE, 0x06, 0x06, 0x07, 0x02, 0x05, 0x84, 0x73, 0xE9, 0x81, 0xF2, 0xA1, 0x83, 0x72,
+  0x64, 0x64, 0x61, 0xAD, 0xA1, 0x10, 0xEE, 0x83, 0xE9, 0x81, 0xF2, 0xA0, 0x73, 0x36, 0xF0, 0xA1,
+  0x71, 0x34, 0x36, 0xB1, 0xA2, 0x4E, 0x67, 0x37, 0x68, 0x79, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D,
+  0xEE, 0xA3, 0x7E, 0xAE, 0x0A, 0x05, 0x06, 0x05, 0x09, 0x20, 0x84, 0x0A, 0xA1, 0x89, 0xEF, 0x81,
+  0xE2, 0xA2, 0x64, 0xED, 0x81, 0xEF, 0x22, 0x40, 0x8A, 0xE7, 0x20, 0xDA, 0xA1, 0x76, 0xE4, 0x02,
+  0x83, 0xEC, 0xA1, 0xE1, 0xE5, 0xA2, 0x41, 0xE2, 0xA2, 0x12, 0xEE, 0x69, 0x05, 0x05, 0x07, 0x03,
+  0x83, 0xF4, 0x81, 0xE5, 0xA2, 0x41, 0x6F, 0x6C, 0x65, 0x63, 0xF2, 0xA1, 0x91, 0xE9, 0xA1, 0xC5,
+  0xE1, 0xA0, 0xC9, 0xAE, 0x0F, 0x03, 0x03, 0x07, 0x06, 0x07, 0x0A, 0x05, 0x07, 0x03, 0x20, 0x6E,
+  0x21, 0x68, 0x8C, 0xF8, 0xA2, 0x12, 0xF6, 0xA2, 0x1C, 0xF3, 0x02, 0x82, 0xF7, 0x61, 0xF5, 0x61,
+  0xF2, 0x03, 0xA2, 0x08, 0xE4, 0x61, 0xEF, 0x20, 0x8B, 0x20, 0xBF, 0xA0, 0xAF, 0xEC, 0x81, 0xEF,
+  0x81, 0xEF, 0x81, 0x68, 0xE3, 0xA1, 0x8E, 0xE9, 0x81, 0xE2, 0xA1, 0x04, 0xE5, 0x81, 0xED, 0x81,
+  0xE1, 0xA1, 0xD5, 0xE3, 0xA1, 0xDC, 0xE1, 0xA1, 0xD9, 0xED, 0x69, 0x05, 0x0B, 0x07, 0xA1, 0xC4,
+  0x65, 0x30, 0x30, 0x73, 0xE6, 0x81, 0x37, 0x76, 0xF1, 0xA2, 0xCE, 0x61, 0xE8, 0x81, 0x6F, 0xEB,
+  0xA0, 0xB7, 0xAE, 0x08, 0x03, 0x07, 0x21, 0x83, 0x20, 0x26, 0x8A, 0xF4, 0xA1, 0xA8, 0xF3, 0x81,
+  0xF3, 0x81, 0xE5, 0xA0, 0xFE, 0xE3, 0xA1, 0xBF, 0xEC, 0x69, 0x03, 0x17, 0x87, 0x6C, 0xE5, 0x02,
+  0x8A, 0x72, 0x62, 0x6D, 0xF5, 0x81, 0xE4, 0x81, 0xE5, 0xA1, 0x91, 0x6E, 0x69, 0xF3, 0x81, 0xE9,
+  0x81, 0xF5, 0xA1, 0x8E, 0x69, 0x72, 0x67, 0x6E, 0xE1, 0xA0, 0x76, 0xAE, 0x09, 0x04, 0x07, 0x21,
+  0x48, 0x06, 0x1E, 0x04, 0x88, 0xF4, 0x0E, 0xA1, 0x60, 0xF2, 0x03, 0xA1, 0x1B, 0xEE, 0xA1, 0x64,
+  0xEF, 0x81, 0xE6, 0x81, 0xEE, 0xA0, 0x6B, 0xEB, 0x04, 0x07, 0x03, 0x86, 0xF5, 0x81, 0xF3, 0x81,
+  0xF4, 0xA1, 0x6B, 0xE5, 0xA1, 0x3C, 0xE4, 0x81, 0xEF, 0x81, 0xF6, 0x61, 0xE1, 0x81, 0xF3, 0xA1,
+  0x5D, 0x6A, 0xEE, 0x81, 0xE9, 0xA1, 0x41, 0xE9, 0x05, 0x11, 0x04, 0x10, 0x8D, 0x73, 0xE1, 0x69,
+  0x81, 0xAE, 0x81, 0xF3, 0x81, 0xEE, 0x81, 0xE4, 0x81, 0x75, 0x6F, 0xEC, 0xA1, 0x34, 0xEB, 0x69,
+  0xA0, 0xC5, 0x64, 0x65, 0xED, 0x69, 0x81, 0x2E, 0x72, 0xE5, 0x81, 0x6D, 0xE1, 0x81, 0xF2, 0x81,
+  0xE6, 0x61, 0x63, 0xEE, 0x81, 0xE1, 0xA0, 0x33, 0x68, 0xF3, 0x81, 0xEB, 0x81, 0xE9, 0x81, 0xE8,
+  0xA0, 0xB3, 0xE7, 0x69, 0x03, 0x03, 0x88, 0xEF, 0xA0, 0xA9, 0x6E, 0x61, 0x72, 0x69, 0xF0, 0x81,
+  0xE9, 0x61, 0xE5, 0x81, 0xED, 0xA1, 0x07, 0xE6, 0x03, 0xA0, 0xF5, 0xEF, 0xA0, 0xE6, 0xE5, 0xA0,
+  0xCD, 0xE4, 0x05, 0x04, 0x03, 0x03, 0x8A, 0xF4, 0x81, 0xEC, 0x61, 0xF3, 0xA0, 0xF9, 0xEF, 0xA0,
+  0xE7, 0xEE, 0x02, 0x84, 0xEF, 0x81, 0xE8, 0x61, 0xE5, 0xA0, 0xE8, 0xE1, 0x81, 0xF4, 0xA0, 0x75,
+  0xE3, 0x69, 0x05, 0x07, 0x19, 0xA0, 0x4C, 0x6E, 0x61, 0xE9, 0x81, 0xF6, 0xA0, 0xD9, 0xE9, 0x03,
+  0x04, 0x8E, 0x73, 0xF2, 0xA0, 0xBA, 0xF2, 0x02, 0x83, 0xE6, 0xA0, 0xCB, 0x65, 0xED, 0x81, 0xE1,
+  0x81, 0xF2, 0xA0, 0x58, 0xED, 0xA0, 0xC0, 0xAE, 0x0F, 0x08, 0x06, 0x03, 0x04, 0x03, 0x19, 0x03,
+  0x03, 0x07, 0x03, 0x04, 0x07, 0xA0, 0x4B, 0xF9, 0x81, 0x73, 0xF2, 0x81, 0xE1, 0xA0, 0x85, 0x76,
+  0x65, 0x64, 0x77, 0xE1, 0x62, 0xF5, 0xA0, 0x80, 0xF4, 0x20, 0x6E, 0x8F, 0xF3, 0xA0, 0x79, 0xF0,
+  0x02, 0x8F, 0x6F, 0xE8, 0x81, 0xF3, 0x81, 0x64, 0x61, 0x65, 0x72, 0x70, 0xF3, 0x81, 0xF9, 0xA0,
+  0x77, 0xE9, 0x81, 0xAD, 0x81, 0xEF, 0xA0, 0x60, 0xEE, 0xA0, 0x73, 0xEC, 0xA0, 0x5A, 0xEB, 0x02,
+  0x82, 0xF9, 0x61, 0xF3, 0x61, 0xE6, 0xA0, 0x50, 0xE5, 0x81, 0xF0, 0x61, 0xE3, 0x04, 0x20, 0x2B,
+  0x96, 0xF1, 0x61, 0xE2, 0x20, 0x42, 0x10, 0x8F, 0xE2, 0x69, 0x07, 0x07, 0x08, 0x20, 0x26, 0x0A,
+  0x86, 0x69, 0x68, 0xF3, 0x81, 0xEF, 0xA0, 0x4D, 0x61, 0xE2, 0x81, 0xE9, 0x81, 0xEC, 0xA0, 0x47,
+  0xAE, 0x07, 0x06, 0x06, 0x14, 0x04, 0x06, 0x86, 0xF6, 0x81, 0xEF, 0x81, 0xE7, 0x61, 0xF5, 0x81,
+  0xE4, 0x81, 0xE5, 0x61, 0xF4, 0x02, 0x8D, 0xEF, 0x81, 0x70, 0xF3, 0x81, 0xE7, 0x81, 0xEF, 0x81,
+  0xEC, 0x81, 0xE2, 0x61, 0xE5, 0x81, 0xEE, 0x61, 0xF3, 0x81, 0xF2, 0x61, 0xED, 0x81, 0xEF, 0x81,
+  0xE3, 0x61, 0xEC, 0x81, 0xE9, 0x81, 0xED, 0x61, 0xE7, 0x81, 0xF2, 0x81, 0xEF, 0x61, 0xE1, 0x02,
+  0x84, 0xE9, 0x81, 0xF4, 0x61, 0xE1, 0x61, 0x39, 0x64, 0x32, 0x63, 0x32, 0x34, 0x2D, 0x2D, 0xEE,
+  0xA0, 0xFF, 0x38, 0x38, 0x33, 0x78, 0xEE, 0xA0, 0xE0, 0xB6, 0x06, 0x09, 0x09, 0x09, 0x0B, 0x86,
+  0x6C, 0x62, 0x67, 0x77, 0x2D, 0x2D, 0xEE, 0xA0, 0xE8, 0x65, 0x63, 0x37, 0x71, 0x2D, 0x2D, 0xEE,
+  0xA0, 0xDF, 0xE1, 0x81, 0x78, 0x71, 0x2D, 0x2D, 0xEE, 0xA0, 0xD6, 0x35, 0x62, 0x30, 0xB6, 0x81,
+  0x74, 0x2D, 0x2D, 0xEE, 0xA0, 0xCB, 0x32, 0x79, 0x71, 0xF9, 0xA0, 0xAD, 0xB1, 0x81, 0x66, 0x34,
+  0x61, 0x33, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA0, 0xB6, 0x34, 0x78, 0x31, 0x64, 0x37,
+  0x37, 0x78, 0x72, 0x63, 0x6B, 0x2D, 0x2D, 0xEE, 0xA0, 0xA7, 0xB3, 0x02, 0x8B, 0x36, 0x30, 0x61,
+  0x30, 0x79, 0x38, 0x2D, 0x2D, 0xEE, 0xA0, 0x99, 0x32, 0x77, 0x71, 0x71, 0x31, 0x2D, 0x2D, 0xEE,
+  0xA0, 0x8F, 0xB2, 0x03, 0x09, 0x8F, 0x71, 0x62, 0x64, 0x39, 0x2D, 0x2D, 0xEE, 0xA0, 0x82, 0x65,
+  0x79, 0x68, 0x33, 0x6C, 0x61, 0x32, 0x63, 0x6B, 0x78, 0x2D, 0x2D, 0xEE, 0xA0, 0x73, 0x38, 0x75,
+  0x67, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE, 0xA0, 0x68, 0xB1, 0x04, 0x0D, 0x0A, 0x8F, 0x72, 0x64,
+  0x63, 0x65, 0x71, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xA0, 0x56, 0x68, 0x62, 0x62, 0x67, 0x6D,
+  0x2D, 0x2D, 0xEE, 0xA0, 0x4C, 0x61, 0x70, 0x67, 0x36, 0x71, 0x70, 0x63, 0x62, 0x67, 0x6D, 0x2D,
+  0x2D, 0xEE, 0xA0, 0x3D, 0x32, 0x6F, 0x61, 0x30, 0x38, 0x2D, 0x2D, 0xEE, 0xA0, 0x33, 0xB0, 0x04,
+  0x0E, 0x0B, 0x8A, 0x6E, 0x62, 0x62, 0x30, 0x63, 0x37, 0x61, 0x62, 0x67, 0x6D, 0x2D, 0x2D, 0xEE,
+  0x9F, 0x65, 0x39, 0x65, 0x62, 0xE7, 0x81, 0x6E, 0x2D, 0x2D, 0xEE, 0x94, 0x32, 0x37, 0x71, 0xEA,
+  0x81, 0x66, 0x2D, 0x2D, 0xEE, 0x8A, 0x30, 0x74, 0x72, 0x6B, 0x39, 0x2D, 0x2D, 0xEE, 0x81, 0xF8,
+  0x61,
+};
+
+}// namespace Uri::PublicSuffixTable
+
+#endif// !URI_PUBLIC_SUFFIX_TABLE_HPP
@@ -1,61 +1,237 @@
 #include "uri.hpp"
 #include "character_set.hpp"
+#include "decode_in_place.hpp"
+#include "instrumentation.hpp"
+#include "ip_address.hpp"
 #include "normalize_case_insensitive_string.hpp"
+#include "parse_port.hpp"
 #include "percent_encoded_character_decoder.hpp"
+#include "utf8.hpp"
+#include "validation_policy.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
-#include <functional>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <random>
-#include <sstream>
-#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <arpa/inet.h>
 #include <sys/types.h>
+#include <utility>
 
 namespace {
 /*
- * This Function checks if every character of the string matches the pattern
- * the requisites from another Function
+ * This function packs a scheme of up to eight characters into an integer,
+ * folding it to lower case on the way. Every character allowed in a scheme
+ * other than the upper case letters already has bit 5 set, so setting it is
+ * an exact case fold for valid schemes.
  *
- * @param [in] candidate
- *  This is the string to test
+ * @param[in] scheme
+ *  This is the scheme to pack
  *
- *@param[in] StillPassing
- * This is the requisite Function
+ * @return
+ *  The packed scheme, or zero if it is too long to pack
+ */
+constexpr uint64_t PackScheme(std::string_view scheme)
+{
+  constexpr size_t MAX_PACKED_LENGTH = 8;
+  constexpr unsigned int CASE_BIT = 0x20;
+  constexpr unsigned int BYTE_BITS = 8;
+
+  if (scheme.size() > MAX_PACKED_LENGTH) { return 0; }
+  uint64_t packed = 0;
+  for (const auto character : scheme) {
+    packed = (packed << BYTE_BITS) | (static_cast<unsigned char>(character) | CASE_BIT);
+  }
+  return packed;
+}
+
+/*
+ * This function recognizes the common schemes, so that the rest of the code
+ * can test for them with a single integer comparison
+ *
+ * @param[in] scheme
+ *  This is the scheme, in any case
  *
  * @return
- * An indication if the candidate passes the test
+ *  The scheme as an enumeration, or KnownScheme::unknown
  */
+Uri::KnownScheme InternScheme(std::string_view scheme)
+{
+  switch (PackScheme(scheme)) {
+  case PackScheme("http"):
+    return Uri::KnownScheme::http;
+  case PackScheme("https"):
+    return Uri::KnownScheme::https;
+  case PackScheme("ws"):
+    return Uri::KnownScheme::ws;
+  case PackScheme("wss"):
+    return Uri::KnownScheme::wss;
+  case PackScheme("ftp"):
+    return Uri::KnownScheme::ftp;
+  case PackScheme("file"):
+    return Uri::KnownScheme::file;
+  default:
+    return Uri::KnownScheme::unknown;
+  }
+}
 
-bool FailsMatch(const std::string &candidate, const std::function<bool(char, bool)> &StillPassing)
+/** These are the constants of the 64-bit FNV-1a hash used for the canonical hash */
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/*
+ * This function mixes the given character into the running FNV-1a hash
+ *
+ * @param[in] hash
+ *  This is the hash so far
+ *
+ * @param[in] character
+ *  This is the character to mix in
+ *
+ * @return
+ *  The updated hash
+ */
+uint64_t HashCharacter(uint64_t hash, char character)
 {
-  for (const auto character : candidate) {
-    if (!StillPassing(character, false)) { return true; }
+  return (hash ^ static_cast<unsigned char>(character)) * FNV_PRIME;
+}
+
+/*
+ * This function mixes the given string into the running hash, followed by a
+ * terminator so that adjacent components can not run into each other
+ */
+uint64_t HashString(uint64_t hash, const std::string &element)
+{
+  for (const auto character : element) { hash = HashCharacter(hash, character); }
+  return HashCharacter(hash, '\0');
+}
+
+/*
+ * This function mixes the given string into the running hash as if it had
+ * been converted to lower case first
+ */
+uint64_t HashCaseInsensitiveString(uint64_t hash, const std::string &element)
+{
+  return HashCharacter(Uri::HashCaseInsensitive(element, hash), '\0');
+}
+
+/*
+ * This function returns the port implied by the given scheme when the URI
+ * does not carry one, or zero when the scheme has no well known port
+ *
+ * @param[in] scheme
+ *  This is the interned scheme
+ */
+uint16_t DefaultPort(Uri::KnownScheme scheme)
+{
+  switch (scheme) {
+  case Uri::KnownScheme::http:
+  case Uri::KnownScheme::ws:
+    return 80;// NOLINT
+  case Uri::KnownScheme::https:
+  case Uri::KnownScheme::wss:
+    return 443;// NOLINT
+  case Uri::KnownScheme::ftp:
+    return 21;// NOLINT
+  case Uri::KnownScheme::file:
+  case Uri::KnownScheme::unknown:
+    break;
   }
-  return !StillPassing(' ', true);
+  return 0;
 }
 
-std::function<bool(char, bool)> LegalSchemeCheckStrategy()
+/*
+ * This function checks if normalizing the path would change it, that is if
+ * any segment is a "." or ".." segment or if two empty segments are adjacent
+ */
+bool PathNeedsNormalization(const std::vector<std::string> &path)
 {
-  auto is_first_character = std::make_shared<bool>(true);
+  for (size_t index = 0; index < path.size(); ++index) {
+    const auto &segment = path[index];
+    if (segment == "." || segment == "..") { return true; }
+    if (segment.empty() && index > 0 && path[index - 1].empty()) { return true; }
+  }
+  return false;
+}
 
-  return [is_first_character](char character, bool end) {
-    if (end) {
-      return !*is_first_character;
-    } else {
-      if (*is_first_character) {
-        *is_first_character = false;
-        return Uri::ALPHA.Contains(character);
-      } else {
-        return Uri::SCHEME_NOT_FIRST.Contains(character);
+/*
+ * This function applies the "remove_dot_segments" routine of RFC 3986 to the
+ * given path segments
+ *
+ * @param[in] old_path
+ *  This is the path to normalize
+ *
+ * @return
+ *  The normalized path
+ */
+std::vector<std::string> RemoveDotSegments(const std::vector<std::string> &old_path)
+{
+  std::vector<std::string> path;
+  path.reserve(old_path.size());
+
+  for (size_t index = 0; index < old_path.size(); ++index) {
+    const auto &segment = old_path[index];
+    const bool is_last = index + 1 == old_path.size();
+
+    if (segment == ".") {
+      // The path already ends with a "/" if the last segment kept is empty
+      if (is_last && (path.empty() || !path.back().empty())) { path.emplace_back(""); }
+    } else if (segment == "..") {
+      if (!path.empty() && (!path[0].empty() || path.size() > 1)) {
+        path.pop_back();
+        if (is_last && !path.empty() && !path.back().empty()) { path.emplace_back(""); }
       }
+    } else {
+      if (!segment.empty() || path.empty() || !path.back().empty()) { path.push_back(segment); }
     }
-  };
+  }
+
+  return path;
 }
 
+/*
+ * These functions report to the instrumentation counters of this library
+ */
+Uri::ParseResult CountFailure(Uri::ParseResult result)
+{
+  using Instrumentation::FailureReason;
+  auto reason = FailureReason::invalid_query_or_fragment;
+  switch (result.error) {
+  case Uri::ParseError::invalid_scheme:
+    reason = FailureReason::invalid_scheme;
+    break;
+  case Uri::ParseError::invalid_user_info:
+    reason = FailureReason::invalid_user_info;
+    break;
+  case Uri::ParseError::invalid_host:
+    reason = FailureReason::invalid_host;
+    break;
+  case Uri::ParseError::invalid_port:
+    reason = FailureReason::invalid_port;
+    break;
+  case Uri::ParseError::invalid_path:
+    reason = FailureReason::invalid_path;
+    break;
+  case Uri::ParseError::invalid_utf8:
+    reason = FailureReason::invalid_encoding;
+    break;
+  case Uri::ParseError::none:
+  case Uri::ParseError::invalid_query:
+  case Uri::ParseError::invalid_fragment:
+    break;
+  }
+  Instrumentation::CountFailure(Instrumentation::Library::uri, reason);
+  return result;
+}
+
+void CountDecodedEscape() { Instrumentation::CountDecodedEscape(Instrumentation::Library::uri); }
+
 }// namespace
 
 namespace Uri {
@@ -64,8 +240,12 @@ struct Uri::Implementation
 {
 
   std::string scheme;
+  KnownScheme known_scheme = KnownScheme::unknown;
   std::string user_name;
   std::string host;
+  HostKind host_kind = HostKind::reg_name;
+  in_addr ipv4_address{};
+  in6_addr ipv6_address{};
   bool has_port = false;
   uint16_t port = 0000;
   std::vector<std::string> path;
@@ -74,83 +254,256 @@ struct Uri::Implementation
   bool has_fragment = false;
   std::string fragment;
 
+  /**
+   * This is the hash of the canonical form of the URI (RFC 3986 section 6),
+   * kept up to date by every method that changes a component
+   */
+  uint64_t canonical_hash = 0;
+
+  /**
+   * These keep the memory of a previous parse so that parsing again into the
+   * same instance does not have to allocate: the strings of the path
+   * segments that were cleared, the part of the string left to parse, the
+   * decoder of percent-encoded characters and the URI an IRI was mapped to
+   */
+  std::vector<std::string> spare_segments;
+  std::string remaining;
+  PercentEncodedCharacterDecoder percent_decoder;
+  std::string mapped_iri;
+
   // Methods
 
+  /**
+   * This method clears every component, keeping the memory they hold
+   */
+  void Reset()
+  {
+    scheme.clear();
+    known_scheme = KnownScheme::unknown;
+    user_name.clear();
+    host.clear();
+    host_kind = HostKind::reg_name;
+    ipv4_address = {};
+    ipv6_address = {};
+    has_port = false;
+    port = 0;
+    RecyclePath();
+    has_query = false;
+    query.clear();
+    has_fragment = false;
+    fragment.clear();
+    canonical_hash = 0;
+  }
+
+  void RecyclePath()
+  {
+    for (auto &segment : path) {
+      segment.clear();
+      spare_segments.push_back(std::move(segment));
+    }
+    path.clear();
+  }
+
+  /**
+   * This method appends a segment to the path, reusing the string of a
+   * segment cleared earlier if there is one
+   */
+  std::string &AddSegment(std::string_view segment)
+  {
+    if (spare_segments.empty()) { return path.emplace_back(segment); }
+    auto &added = path.emplace_back(std::move(spare_segments.back()));
+    spare_segments.pop_back();
+    added.assign(segment);
+    return added;
+  }
+
   [[nodiscard]] bool HasAuthority() const
   {
     return !host.empty() || !user_name.empty() || has_port;
   }
 
-  bool ParseScheme(const std::string &uri_string)
+  /*
+   * This method checks if the port has to be taken into account when
+   * comparing URIs, that is if it is present and not the default port of
+   * the scheme
+   */
+  [[nodiscard]] bool HasCanonicalPort() const
   {
-    auto scheme_end = uri_string.find(':');
+    return has_port && port != DefaultPort(known_scheme);
+  }
 
-    if (scheme_end == std::string::npos || scheme_end > uri_string.find('/')) {
-      scheme.clear();
-      return true;
+  /*
+   * This method checks if the host of the URI is equivalent to the host of
+   * the other URI. IPv6 addresses are compared in binary form, since the
+   * same address can be written in many ways.
+   */
+  [[nodiscard]] bool HostEquivalent(const Implementation &other) const
+  {
+    if (host_kind != other.host_kind) { return false; }
+    if (host_kind == HostKind::ipv6) {
+      return std::memcmp(ipv6_address.s6_addr, other.ipv6_address.s6_addr, sizeof(in6_addr)) == 0;
+    }
+    return EqualsCaseInsensitive(host, other.host);
+  }
+
+  /*
+   * This method checks if the authority of the URI is equivalent to the
+   * authority of the other URI, which has the same scheme
+   */
+  [[nodiscard]] bool AuthorityEquivalent(const Implementation &other) const
+  {
+    return HasAuthority() == other.HasAuthority() && user_name == other.user_name
+           && HostEquivalent(other) && HasCanonicalPort() == other.HasCanonicalPort()
+           && (!HasCanonicalPort() || port == other.port);
+  }
+
+  /*
+   * This method checks if the path of the URI is equivalent to the path
+   * of the other URI once dot segments are removed and an empty path with
+   * authority is taken as "/"
+   */
+  [[nodiscard]] bool PathEquivalent(const Implementation &other) const
+  {
+    if (!PathNeedsNormalization(path) && !PathNeedsNormalization(other.path)) {
+      if (path.empty() != other.path.empty()) {
+        const auto &non_empty = path.empty() ? other.path : path;
+        return HasAuthority() && non_empty.size() == 1 && non_empty[0].empty();
+      }
+      return path == other.path;
+    }
+    return CanonicalPath() == other.CanonicalPath();
+  }
+
+  /*
+   * This method returns the path as it is in the canonical form of the URI
+   */
+  [[nodiscard]] std::vector<std::string> CanonicalPath() const
+  {
+    auto canonical_path = PathNeedsNormalization(path) ? RemoveDotSegments(path) : path;
+    if (canonical_path.empty() && HasAuthority()) { canonical_path.emplace_back(""); }
+    return canonical_path;
+  }
+
+  /*
+   * This method recomputes the hash of the canonical form of the URI
+   */
+  void UpdateCanonicalHash()
+  {
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    hash = HashCaseInsensitiveString(hash, scheme);
+    hash = HashCharacter(hash, HasAuthority() ? '/' : '\0');
+    hash = HashString(hash, user_name);
+    if (host_kind == HostKind::ipv6) {
+      for (const auto byte : ipv6_address.s6_addr) {
+        hash = HashCharacter(hash, static_cast<char>(byte));
+      }
+      hash = HashCharacter(hash, '\0');
+    } else {
+      hash = HashCaseInsensitiveString(hash, host);
+    }
+    if (HasCanonicalPort()) {
+      hash = HashCharacter(hash, static_cast<char>(port >> 8U));
+      hash = HashCharacter(hash, static_cast<char>(port & 0xFFU));
+    }
+    hash = HashCharacter(hash, '\0');
+
+    if (PathNeedsNormalization(path)) {
+      for (const auto &segment : CanonicalPath()) { hash = HashString(hash, segment); }
+    } else if (path.empty() && HasAuthority()) {
+      hash = HashString(hash, "");
     } else {
-      scheme = uri_string.substr(0, scheme_end);
-      scheme = NormalizeCaseInsensitiveString(scheme);
-      return !FailsMatch(scheme, LegalSchemeCheckStrategy());
+      for (const auto &segment : path) { hash = HashString(hash, segment); }
     }
+    hash = HashCharacter(hash, '\0');
+
+    if (has_query) { hash = HashString(HashCharacter(hash, '?'), query); }
+    if (has_fragment) { hash = HashString(HashCharacter(hash, '#'), fragment); }
+
+    canonical_hash = hash;
   }
 
-  bool ParseHost(std::string &uri_string)
+  /*
+   * The parse methods below return the result of parsing their part of the
+   * URI. The offset of an error is counted from the start of the whole
+   * string, which begins "base" bytes before the string they are given.
+   */
+
+  ParseResult ParseScheme(const std::string &uri_string)
   {
-    auto authority_end = uri_string.find('/', 2);
+    auto scheme_end = uri_string.find(':');
 
-    if (authority_end == std::string::npos) {
-      auto other_authority_end = uri_string.find_first_of("?#");
-      authority_end =
-        other_authority_end == std::string::npos ? uri_string.length() : other_authority_end;
+    if (scheme_end == std::string::npos || scheme_end > uri_string.find_first_of("/?#")) {
+      scheme.clear();
+      known_scheme = KnownScheme::unknown;
+      return {};
+    } else {
+      scheme.assign(uri_string, 0, scheme_end);
+      AsciiToLower(scheme);
+      known_scheme = InternScheme(scheme);
+      const auto error_position = FirstMismatch<SchemePolicy>(scheme);
+      if (error_position != std::string::npos) {
+        return { ParseError::invalid_scheme, error_position };
+      }
+      return {};
     }
+  }
+
+  ParseResult ParseHost(std::string &uri_string, size_t base)
+  {
+    auto authority_end = uri_string.find_first_of("/?#", 2);
+    if (authority_end == std::string::npos) { authority_end = uri_string.length(); }
 
-    auto authority = uri_string.substr(2, authority_end - 2);
-    uri_string = uri_string.substr(authority_end);
+    auto authority = std::string_view(uri_string).substr(2, authority_end - 2);
+    auto host_base = base + 2;
 
     auto user_delimiter = authority.find('@');
     if (user_delimiter == std::string::npos) {
       user_name.clear();
     } else {
-      user_name = authority.substr(0, user_delimiter);
+      user_name.assign(authority.substr(0, user_delimiter));
       authority = authority.substr(user_delimiter + 1);
 
-      if (!DecodeElement(user_name, USER_NAME)) { return false; }
+      const auto error_position = DecodeElement<UserInfoPolicy>(user_name);
+      if (error_position != std::string::npos) {
+        return { ParseError::invalid_user_info, host_base + error_position };
+      }
+      host_base += user_delimiter + 1;
     }
 
-    auto port_delimiter = authority[0] != '[' ? authority.find(':') : std::string::npos;
-    if (port_delimiter < authority.find(']') && authority.find(']') != std::string::npos) {
-      port_delimiter = authority.find(':', port_delimiter + 1);
+    auto port_delimiter = std::string::npos;
+    if (!authority.empty() && authority[0] == '[') {
+      const auto literal_end = authority.find(']');
+      if (literal_end != std::string::npos) { port_delimiter = authority.find(':', literal_end); }
+    } else {
+      port_delimiter = authority.find(':');
     }
 
     has_port = false;
 
-    if (port_delimiter == std::string::npos) {
-      if (!UncodeHost(authority)) { return false; }
-    } else {
-      auto coded_host = authority.substr(0, port_delimiter);
-      if (!UncodeHost(coded_host)) { return false; }
-      try {
-        const std::shared_ptr<size_t> end_of_number(new size_t);
-        const std::string port_segment =
-          authority.substr(port_delimiter + 1, authority_end - port_delimiter - 1);
-
-        port = static_cast<uint16_t>(std::stoul(port_segment, end_of_number.get()));
-        const auto signed_port = std::stoi(port_segment);
-
-        if (*end_of_number != port_segment.size()) { return false; }
-        if (signed_port != port) { return false; }
-
-      } catch (const std::invalid_argument &e) {
-        return false;
+    const auto coded_host = authority.substr(0, port_delimiter);
+    const auto error_position = UncodeHost(coded_host);
+    if (error_position != std::string::npos) {
+      return { ParseError::invalid_host, host_base + error_position };
+    }
+    if (port_delimiter != std::string::npos) {
+      const auto port_segment = authority.substr(port_delimiter + 1);
+      if (!ParsePort(port_segment, port)) {
+        return { ParseError::invalid_port, host_base + port_delimiter + 1 };
       }
 
       has_port = true;
     }
-    return true;
+    uri_string.erase(0, authority_end);
+    return {};
   }
 
-  bool UncodeHost(const std::string &coded_host)
+  /*
+   * This method decodes the host, returning the position of the first
+   * character that is not valid, or npos if the host is valid. An IP
+   * literal that is not valid is reported at its opening bracket.
+   */
+  size_t UncodeHost(std::string_view coded_host)
   {
     enum class Decoded_state {
       first_character,
@@ -162,9 +515,10 @@ struct Uri::Implementation
 
     Decoded_state decode_state =
       coded_host.empty() ? Decoded_state::normal_state : Decoded_state::first_character;
-    PercentEncodedCharacterDecoder percent_decoder;
+    size_t percent_position = 0;
 
-    for (auto character : coded_host) {
+    for (size_t position = 0; position < coded_host.size(); ++position) {
+      const auto character = coded_host[position];
 
       switch (decode_state) {
       case Decoded_state::first_character:
@@ -177,45 +531,68 @@ struct Uri::Implementation
 
       case Decoded_state::normal_state:
         if (character == '%') {
-          percent_decoder = PercentEncodedCharacterDecoder();
+          percent_decoder.Reset();
+          percent_position = position;
           decode_state = Decoded_state::hex_decode_character;
           break;
-        } else if (REG_NAME_NOT_PCT_ENCODED.Contains(character)) {
+        } else if (RegNamePolicy::Rest(character)) {
           host.push_back(character);
           break;
         }
-        return false;
+        return position;
 
       case Decoded_state::hex_decode_character:
-        if (!percent_decoder.NextEncodedCharacter(character)) { return false; }
+        if (!percent_decoder.NextEncodedCharacter(character)) { return position; }
         if (percent_decoder.Done()) {
           host.push_back(percent_decoder.GetDecodedCharacter());
+          CountDecodedEscape();
           decode_state = Decoded_state::normal_state;
         }
         break;
 
       case Decoded_state::IPLiteral:
-        return DecodeIP(coded_host);
+        return DecodeIP(coded_host) ? std::string::npos : 0;
 
       case Decoded_state::IPv4address:
         break;
       }
     }
 
-    host = NormalizeCaseInsensitiveString(host);
-    return decode_state == Decoded_state::normal_state;
+    AsciiToLower(host);
+    ClassifyRegName();
+    if (decode_state == Decoded_state::hex_decode_character) { return percent_position; }
+    if (decode_state == Decoded_state::IPLiteral) { return 0; }
+    return std::string::npos;
   }
 
-  bool DecodeIP(const std::string &coded_host)
+  /*
+   * This method sets the kind of the host to IPv4 address if the reg-name
+   * is a dotted-decimal address, or to reg-name otherwise
+   */
+  void ClassifyRegName()
   {
-    const std::string inside_brackets = coded_host.substr(1, coded_host.length() - 2);
-    if (coded_host[0] != '[' || coded_host.back() != ']') { return false; }
-    if (inside_brackets[0] == 'v') { return DecodeIPvFuture(inside_brackets); }
+    host_kind = ParseIpv4Address(host, ipv4_address) ? HostKind::ipv4 : HostKind::reg_name;
+  }
 
-    return ValidateIpv6Address(inside_brackets);
+  bool DecodeIP(std::string_view coded_host)
+  {
+    if (coded_host.length() < 2 || coded_host[0] != '[' || coded_host.back() != ']') {
+      return false;
+    }
+    const auto inside_brackets = coded_host.substr(1, coded_host.length() - 2);
+    if (!inside_brackets.empty() && inside_brackets[0] == 'v') {
+      host_kind = HostKind::ipv_future;
+      return DecodeIPvFuture(inside_brackets);
+    }
+
+    if (!ParseIpv6Address(inside_brackets, ipv6_address)) { return false; }
+    host_kind = HostKind::ipv6;
+    host.assign(inside_brackets);
+    AsciiToLower(host);
+    return true;
   }
 
-  bool DecodeIPvFuture(const std::string &coded_host)
+  bool DecodeIPvFuture(std::string_view coded_host)
   {
     enum class States {
       prefix,
@@ -256,315 +633,97 @@ struct Uri::Implementation
     return decode_state == States::sufix;
   }
 
-  bool ValidateIpv6Address(const std::string &address)// NOLINT
-  {
-    size_t number_groups = 0;
-    size_t number_digits = 0;
-    bool double_colon_encountered = false;
-    size_t potential_ipv4_start = 0;
-    size_t position = 0;
-    bool ipv4_encountered = false;
-
-    enum class ValidationState {
-      NoGroupYet,
-      ColonNoGroupYet,
-      MaybeIPV4,
-      NotIPV4,
-      AfterDoubleColon,
-      ColonAfterGroup,
-    };
-
-    ValidationState current_state = ValidationState::NoGroupYet;
-    for (const auto &character : address) {
-      switch (current_state) {
-      case ValidationState::NoGroupYet:
-        if (character == ':') {
-          current_state = ValidationState::ColonNoGroupYet;
-          break;
-        } else if (DIGITS.Contains(character)) {
-          potential_ipv4_start = position;
-          number_digits = 1;
-          current_state = ValidationState::MaybeIPV4;
-          break;
-        } else if (HEX_DIGIT.Contains(character)) {
-          current_state = ValidationState::NotIPV4;
-          number_digits = 1;
-          break;
-        }
-        return false;
-
-      case ValidationState::ColonNoGroupYet:
-        if (character == ':') {
-          double_colon_encountered = true;
-          current_state = ValidationState::AfterDoubleColon;
-          break;
-        }
-        return false;
-
-      case ValidationState::AfterDoubleColon:
-        if (DIGITS.Contains(character)) {
-          potential_ipv4_start = position;
-          if (++number_digits > 4) { return false; }
-          current_state = ValidationState::MaybeIPV4;
-          break;
-        } else if (HEX_DIGIT.Contains(character)) {
-          if (++number_digits > 4) { return false; }
-          current_state = ValidationState::NotIPV4;
-          break;
-        }
-        return false;
-
-      case ValidationState::NotIPV4:
-        if (character == ':') {
-          number_digits = 0;
-          number_groups++;
-          current_state = ValidationState::ColonAfterGroup;
-          break;
-        } else if (HEX_DIGIT.Contains(character)) {
-          if (++number_digits > 4) { return false; }
-          break;
-        }
-        return false;
-
-      case ValidationState::MaybeIPV4:
-        if (character == ':') {
-          number_digits = 0;
-          number_groups++;
-          current_state = ValidationState::ColonAfterGroup;
-          break;
-        } else if (character == '.') {
-          ipv4_encountered = true;
-          break;
-        } else if (DIGITS.Contains(character)) {
-          if (++number_digits > 4) { return false; }
-          break;
-        } else if (HEX_DIGIT.Contains(character)) {
-          if (++number_digits > 4) { return false; }
-          current_state = ValidationState::NotIPV4;
-          break;
-        }
-        return false;
-
-      case ValidationState::ColonAfterGroup:
-        if (character == ':') {
-          if (double_colon_encountered) { return false; }
-          double_colon_encountered = true;
-          current_state = ValidationState::AfterDoubleColon;
-          break;
-        } else if (DIGITS.Contains(character)) {
-          potential_ipv4_start = position;
-          ++number_digits;
-          current_state = ValidationState::MaybeIPV4;
-          break;
-        } else if (HEX_DIGIT.Contains(character)) {
-          if (++number_digits > 4) { return false; }
-          ++number_digits;
-          current_state = ValidationState::NotIPV4;
-          break;
-        }
-        return false;
-      }
-      if (ipv4_encountered) { break; }
-      ++position;
-    }
-
-    if (current_state == ValidationState::NotIPV4 || current_state == ValidationState::MaybeIPV4) {
-      ++number_groups;
-    }
-    if (position == address.length()
-        && (current_state == ValidationState::ColonNoGroupYet
-            || current_state == ValidationState::ColonAfterGroup)) {
-      return false;
-    }
-
-    const size_t MAX_GROUPS = 8;
-
-    if (ipv4_encountered) {
-      if (!ValidateIpv4Address(address.substr(potential_ipv4_start))) { return false; }
-      number_groups += 2;
-    }
-
-    host = address;
-    if (double_colon_encountered) {
-      return number_groups < MAX_GROUPS;
-    } else {
-      return number_groups == MAX_GROUPS;
-    }
-  }
-
-  static bool ValidateIpv4Address(const std::string &address)
-  {
-    const size_t MAX_GROUPS = 4;
-    size_t number_groups = 0;
-    std::string octet_buffer;
-
-    enum class ValidationState { OutOctet, DigitOrDot };
-
-    ValidationState current_state = ValidationState::OutOctet;
-
-    for (const auto &character : address) {
-      switch (current_state) {
-      case ValidationState::OutOctet:
-        if (!DIGITS.Contains(character)) { return false; }
-        octet_buffer.push_back(character);
-        current_state = ValidationState::DigitOrDot;
-        break;
-
-      case ValidationState::DigitOrDot:
-        if (character == '.') {
-          if (++number_groups > 4) { return false; }
-          if (!ValidateOctet(octet_buffer)) { return false; }
-          octet_buffer.clear();
-          current_state = ValidationState::OutOctet;
-          break;
-        } else if (DIGITS.Contains(character)) {
-          octet_buffer.push_back(character);
-          break;
-        }
-        return false;
-      }
-    }
-    if (!octet_buffer.empty()) {
-      ++number_groups;
-      if (!ValidateOctet(octet_buffer)) { return false; }
-    }
-
-    return number_groups == MAX_GROUPS;
-  }
-
-  static bool ValidateOctet(const std::string &octet_string)
-  {
-    int octet = 0;
-    const int OCTET_SHIFT = 10;
-
-    for (const auto &character : octet_string) {
-      if (DIGITS.Contains(character)) {
-        octet *= OCTET_SHIFT;
-        octet += character - '0';
-      } else {
-        return false;
-      }
-    }
-
-    const int MAX_OCTET = 255;
-    return octet <= MAX_OCTET;
-  }
-
-  bool ParsePath(std::string &URL)
+  ParseResult ParsePath(std::string &URL, size_t base)
   {
     // Parse Path
     // "" -> []
     // "/" -> [""]
     // "foo/" -> [foo, ""]
     // "/foo" -> ["", foo]
-    path.clear();
-    if (URL == "/") {
-      path.emplace_back("");
-      URL.clear();
-      return true;
-    }
+    RecyclePath();
 
-    if (!URL.empty()) {
+    const auto path_end = std::min(URL.find_first_of("?#"), URL.size());
+    const std::string_view path_string(URL.data(), path_end);
+
+    if (path_string == "/") {
+      AddSegment("");
+    } else if (!path_string.empty()) {
+      size_t segment_begin = 0;
       for (;;) {
-        auto path_delimiter = URL.find('/');
-        auto query_fragment_delimiter = std::min(URL.find('?'), URL.find('#'));
-
-        if (path_delimiter == std::string::npos) {
-          path_delimiter = query_fragment_delimiter;
-          if (path_delimiter == std::string::npos) {
-            path.push_back(URL);
-            URL.clear();
-          } else if (path_delimiter != 0) {
-            path.emplace_back(URL.begin(), URL.begin() + static_cast<int>(path_delimiter));
-          }
-          break;
-        } else {
-          if (path_delimiter > query_fragment_delimiter) {
-            path.emplace_back(
-              URL.begin(), URL.begin() + static_cast<int>(query_fragment_delimiter));
-            URL = URL.substr(query_fragment_delimiter);
-            break;
-          }
-          path.emplace_back(URL.begin(), URL.begin() + static_cast<int>(path_delimiter));
-          URL = URL.substr(path_delimiter + 1);
+        const auto segment_end = path_string.find('/', segment_begin);
+        auto &segment = AddSegment(path_string.substr(segment_begin, segment_end - segment_begin));
+        const auto error_position = DecodeElement<PathSegmentPolicy>(segment);
+        if (error_position != std::string::npos) {
+          return { ParseError::invalid_path, base + segment_begin + error_position };
         }
+        if (segment_end == std::string_view::npos) { break; }
+        segment_begin = segment_end + 1;
       }
     }
+    URL.erase(0, path_end);
 
-    for (auto &segment : path) {
-      if (!DecodeElement(segment, PCHAR_NOT_PCT_ENCODED)) { return false; }
-    }
+    // Make room for the segments to be recycled by the next parse
+    spare_segments.reserve(spare_segments.size() + path.size());
 
-    return true;
+    return {};
   }
 
-  bool ParseQueryAndFragment(const std::string &uri_string)
+  ParseResult ParseQueryAndFragment(const std::string &uri_string, size_t base)
   {
-    const auto query_delimiter = uri_string.find('?');
-
     const auto fragment_delimiter = uri_string.find('#');
 
-    if (fragment_delimiter == std::string::npos) {
-      fragment.clear();
-      if (query_delimiter == std::string::npos) {
+    // A '?' after the fragment delimiter is part of the fragment
+    auto query_delimiter = uri_string.find('?');
+    if (query_delimiter > fragment_delimiter) { query_delimiter = std::string::npos; }
+
+    query.clear();
+    fragment.clear();
+
+    if (query_delimiter != std::string::npos) {
+      has_query = true;
+      const auto query_end = std::min(fragment_delimiter, uri_string.size());
+      query.assign(uri_string, query_delimiter + 1, query_end - query_delimiter - 1);
+      const auto error_position = DecodeElement<QueryOrFragmentPolicy>(query);
+      if (error_position != std::string::npos) {
         query.clear();
-      } else {
-        has_query = true;
-        query = uri_string.substr(query_delimiter + 1);
-        if (!DecodeElement(query, QUERY_OR_FRAGMENT)) {
-          query.clear();
-          return false;
-        }
+        return { ParseError::invalid_query, base + query_delimiter + 1 + error_position };
       }
-    } else {
+    }
+
+    if (fragment_delimiter != std::string::npos) {
       has_fragment = true;
-      fragment = uri_string.substr(fragment_delimiter + 1);
-      if (!DecodeElement(fragment, QUERY_OR_FRAGMENT)) {
+      fragment.assign(uri_string, fragment_delimiter + 1);
+      const auto error_position = DecodeElement<QueryOrFragmentPolicy>(fragment);
+      if (error_position != std::string::npos) {
         fragment.clear();
-        return false;
-      }
-      if (query_delimiter == std::string::npos) {
-        query.clear();
-      } else {
-        has_query = true;
-        query = uri_string.substr(query_delimiter + 1, fragment_delimiter - query_delimiter - 1);
-        if (!DecodeElement(query, QUERY_OR_FRAGMENT)) {
-          query.clear();
-          return false;
-        }
+        return { ParseError::invalid_fragment, base + fragment_delimiter + 1 + error_position };
       }
     }
-    return true;
+
+    return {};
   }
 
-  bool static DecodeElement(std::string &element, const CharacterSet &allowed_characters)
+  /*
+   * This method decodes the percent-encoded characters of the element in
+   * place, checking every character that is not encoded against the policy
+   *
+   * @return
+   * The position of the first character that is not valid, or of the "%"
+   * of an escape cut short by the end of the element, or npos if the
+   * element is valid
+   */
+  template<typename Policy> size_t DecodeElement(std::string &element)
   {
-    auto coded_string = std::move(element);
-    element.clear();
-
-    PercentEncodedCharacterDecoder percent_decoder;
-    bool decoding_percent_charcater = false;
-
-    for (auto character : coded_string) {
-
-      if (decoding_percent_charcater) {
-        if (!percent_decoder.NextEncodedCharacter(character)) { return false; }
-        if (percent_decoder.Done()) {
-          decoding_percent_charcater = false;
-          element.push_back(percent_decoder.GetDecodedCharacter());
-        }
-      } else {
-        if (character == '%') {
-          percent_decoder = PercentEncodedCharacterDecoder();
-          decoding_percent_charcater = true;
-        } else {
-          if (!allowed_characters.Contains(character)) { return false; }
-          element.push_back(character);
-        }
-      }
-    }
+    return DecodeInPlace<Policy, Instrumentation::Library::uri>(element, percent_decoder);
+  }
 
-    return !decoding_percent_charcater;
+  /*
+   * This method removes the dot segments of the path, if it has any,
+   * leaving the hash for the caller to update
+   */
+  void NormalizePath()
+  {
+    if (PathNeedsNormalization(path)) { path = RemoveDotSegments(path); }
   }
 };
 char MakeHexDigit(unsigned int value)
@@ -577,37 +736,97 @@ char MakeHexDigit(unsigned int value)
   }
 }
 
-std::string EncodeElement(const std::string &element, const CharacterSet &allowedCharacter)
+void AppendEncoded(std::string &target,
+  const std::string &element,
+  const CharacterSet &allowedCharacter)
 {
   const unsigned int HEX_DISPLACEMENT = 4;
   const unsigned int HEX_THING = 0x0F;
-  std::string encodedElement;
 
   for (const auto &character : element) {
 
     if (allowedCharacter.Contains(character)) {
-      encodedElement.push_back(character);
+      target.push_back(character);
     } else {
-      encodedElement.push_back('%');
-      encodedElement.push_back(
-        MakeHexDigit(static_cast<unsigned int>(character) >> HEX_DISPLACEMENT));
-      encodedElement.push_back(MakeHexDigit(static_cast<unsigned int>(character) & HEX_THING));
+      const unsigned int value = static_cast<unsigned char>(character);
+      target.push_back('%');
+      target.push_back(MakeHexDigit(value >> HEX_DISPLACEMENT));
+      target.push_back(MakeHexDigit(value & HEX_THING));
     }
   }
+}
+
+/*
+ * This function appends the encoded segments of a path to the target
+ *
+ * @param[in] has_scheme
+ *    This tells that the path follows a scheme
+ *
+ * @param[in] has_authority
+ *    This tells that the path follows an authority
+ */
+void AppendSegments(std::string &target,
+  const std::vector<std::string> &path,
+  bool has_scheme,
+  bool has_authority)
+{
+  // Without an authority, a path beginning with "//" would be read back as
+  // one, so an empty authority is written in front of it
+  if (!has_authority && path.size() > 2 && path[0].empty() && path[1].empty()) { target += "//"; }
+
+  if (path.size() == 1 && path[0].empty()) { target += '/'; }
+  for (size_t position = 0; position < path.size(); ++position) {
+    if (position > 0) { target += '/'; }
+    // A colon in the first segment of a relative reference would be read
+    // back as the end of a scheme
+    const bool is_first_relative = position == 0 && !has_scheme && !has_authority;
+    AppendEncoded(
+      target, path[position], is_first_relative ? SEGMENT_NZ_NC : PCHAR_NOT_PCT_ENCODED);
+  }
+}
 
-  return encodedElement;
+std::string_view ToString(ParseError error)
+{
+  switch (error) {
+  case ParseError::none:
+    return "no error";
+  case ParseError::invalid_scheme:
+    return "invalid scheme";
+  case ParseError::invalid_user_info:
+    return "invalid user info";
+  case ParseError::invalid_host:
+    return "invalid host";
+  case ParseError::invalid_port:
+    return "invalid port";
+  case ParseError::invalid_path:
+    return "invalid path";
+  case ParseError::invalid_query:
+    return "invalid query";
+  case ParseError::invalid_fragment:
+    return "invalid fragment";
+  case ParseError::invalid_utf8:
+    return "invalid UTF-8";
+  }
+  return "unknown error";
 }
 
 Uri::~Uri() = default;
 
-Uri::Uri() : impl_(new Implementation) {}
+Uri::Uri(Uri &&) noexcept = default;
+
+Uri &Uri::operator=(Uri &&) noexcept = default;
+
+Uri::Uri() : impl_(new Implementation) { impl_->UpdateCanonicalHash(); }
 
 bool Uri::operator==(const Uri &other) const
 {
-  return impl_->scheme == other.impl_->scheme && impl_->user_name == other.impl_->user_name
-         && impl_->host == other.impl_->host && impl_->port == other.impl_->port
-         && impl_->has_port == other.impl_->has_port && impl_->path == other.impl_->path
-         && impl_->query == other.impl_->query && impl_->fragment == other.impl_->fragment;
+  if (impl_->canonical_hash != other.impl_->canonical_hash) { return false; }
+
+  return EqualsCaseInsensitive(impl_->scheme, other.impl_->scheme)
+         && impl_->AuthorityEquivalent(*other.impl_)
+         && impl_->PathEquivalent(*other.impl_) && impl_->has_query == other.impl_->has_query
+         && impl_->query == other.impl_->query && impl_->has_fragment == other.impl_->has_fragment
+         && impl_->fragment == other.impl_->fragment;
 };
 
 bool Uri::operator!=(const Uri &other) const { return !(*this == other); }
@@ -634,35 +853,80 @@ std::ostream &operator<<(std::ostream &out_stream, const Uri &uri)
   return out_stream;
 }
 
-bool Uri::ParseFromString(const std::string &uri_string)
+ParseResult Uri::ParseFromString(const std::string &uri_string)
 {
-  impl_ = std::make_unique<Implementation>();
-  if (!impl_->ParseScheme(uri_string)) { return false; }
+  Instrumentation::ParseScope parse_scope(Instrumentation::Library::uri, uri_string.size());
 
-  auto scheme_end = uri_string.find(':');
-  auto uri_left = impl_->scheme.empty() ? uri_string : uri_string.substr(scheme_end + 1);
+  impl_->Reset();
+  if (auto result = impl_->ParseScheme(uri_string); !result) { return CountFailure(result); }
+
+  auto &uri_left = impl_->remaining;
+  if (impl_->scheme.empty()) {
+    uri_left.assign(uri_string);
+  } else {
+    uri_left.assign(uri_string, uri_string.find(':') + 1);
+  }
+  const auto consumed = [&] { return uri_string.size() - uri_left.size(); };
 
   if (uri_left.substr(0, 2) == "//") {
-    if (!impl_->ParseHost(uri_left)) { return false; }
+    if (auto result = impl_->ParseHost(uri_left, consumed()); !result) {
+      return CountFailure(result);
+    }
   }
 
-  if (!impl_->ParsePath(uri_left)) { return false; }
+  if (auto result = impl_->ParsePath(uri_left, consumed()); !result) {
+    return CountFailure(result);
+  }
 
-  if (!impl_->host.empty() && impl_->path.empty()) { impl_->path.emplace_back(""); }
+  if (!impl_->host.empty() && impl_->path.empty()) { impl_->AddSegment(""); }
 
   if (!uri_left.empty()) {
-    if (!impl_->ParseQueryAndFragment(uri_left)) { return false; };
+    if (auto result = impl_->ParseQueryAndFragment(uri_left, consumed()); !result) {
+      return CountFailure(result);
+    }
   }
 
-  return true;
+  impl_->UpdateCanonicalHash();
+  parse_scope.Succeed();
+  return {};
+}
+
+ParseResult Uri::ParseFromIriString(const std::string &iri_string)
+{
+  if (FindNonAscii(iri_string) == std::string::npos) { return ParseFromString(iri_string); }
+
+  auto &mapped = impl_->mapped_iri;
+  if (const auto invalid = MapIriToUri(iri_string, mapped); invalid != std::string::npos) {
+    Instrumentation::ParseScope parse_scope(Instrumentation::Library::uri, iri_string.size());
+    Reset();
+    return CountFailure({ ParseError::invalid_utf8, invalid });
+  }
+
+  auto result = ParseFromString(mapped);
+  if (!result) { result.offset = IriOffset(iri_string, result.offset); }
+  return result;
+}
+
+void Uri::Reset()
+{
+  impl_->Reset();
+  impl_->UpdateCanonicalHash();
 }
 
 std::string Uri::GetScheme() const { return impl_->scheme; }
 
+KnownScheme Uri::GetKnownScheme() const { return impl_->known_scheme; }
+
 std::string Uri::GetUserName() const { return impl_->user_name; }
 
 std::string Uri::GetHost() const { return impl_->host; }
 
+HostKind Uri::GetHostKind() const { return impl_->host_kind; }
+
+in_addr Uri::GetIpv4Address() const { return impl_->ipv4_address; }
+
+in6_addr Uri::GetIpv6Address() const { return impl_->ipv6_address; }
+
 std::vector<std::string> Uri::GetPath() const { return impl_->path; }
 
 bool Uri::HasPort() const { return impl_->has_port; }
@@ -681,121 +945,260 @@ bool Uri::IsAbsolutePath() const { return !impl_->path.empty() && impl_->path.fr
 
 void Uri::NormalizePath()
 {
-  auto old_path = std::move(impl_->path);
-
-  impl_->path.clear();
+  impl_->NormalizePath();
+  impl_->UpdateCanonicalHash();
+}
 
-  while (!old_path.empty()) {
-    if (old_path[0] == ".") {
-      if (old_path.size() == 1) { impl_->path.emplace_back(""); }
-    } else if (old_path[0] == "..") {
-      if (!impl_->path.empty() && (!impl_->path[0].empty() || impl_->path.size() > 1)) {
-        impl_->path.pop_back();
-        if (old_path.size() == 1 && !impl_->path.back().empty()) { impl_->path.emplace_back(""); }
-      }
-    } else {
-      if (!old_path[0].empty() || impl_->path.empty() || !impl_->path.back().empty()) {
-        impl_->path.push_back(old_path[0]);
-      }
-    }
-    old_path.erase(old_path.begin());
-  }
+IdnaError Uri::NormalizeHost()
+{
+  if (impl_->host_kind != HostKind::reg_name || impl_->host.empty()) { return IdnaError::none; }
+  std::string ascii;
+  const auto error = DomainToAscii(impl_->host, ascii);
+  if (error != IdnaError::none) { return error; }
+  impl_->host = std::move(ascii);
+  impl_->UpdateCanonicalHash();
+  return IdnaError::none;
 }
 
+uint64_t Uri::GetHash() const { return impl_->canonical_hash; }
+
 Uri Uri::Resolve(const Uri &relative_reference) const
 {
   Uri target;
 
   if (!relative_reference.impl_->scheme.empty()) {
-    target.impl_->scheme = relative_reference.impl_->scheme;
+    target.CopyScheme(relative_reference);
     target.CopyAuthority(relative_reference);
     target.CopyAndNormalizePath(relative_reference);
-    target.impl_->query = relative_reference.impl_->query;
+    target.CopyQuery(relative_reference);
   } else {
     if (!relative_reference.impl_->host.empty()) {
       target.CopyAuthority(relative_reference);
       target.CopyAndNormalizePath(relative_reference);
-      target.impl_->query = relative_reference.impl_->query;
+      target.CopyQuery(relative_reference);
     } else {
       if (relative_reference.impl_->path.empty()) {
         target.CopyAndNormalizePath(*this);
-        if (!relative_reference.impl_->query.empty()) {
-          target.impl_->query = relative_reference.impl_->query;
+        if (relative_reference.impl_->has_query) {
+          target.CopyQuery(relative_reference);
         } else {
-          target.impl_->query = impl_->query;
+          target.CopyQuery(*this);
         }
       } else if (relative_reference.IsAbsolutePath()) {
-        target.impl_->path = relative_reference.impl_->path;
-        target.impl_->query = relative_reference.impl_->query;
+        target.CopyAndNormalizePath(relative_reference);
+        target.CopyQuery(relative_reference);
       } else {
-        target.impl_->path = impl_->path;
-        if (target.impl_->path.size() > 1) { target.impl_->path.pop_back(); }
-        std::copy(relative_reference.impl_->path.begin(),
-          relative_reference.impl_->path.end(),
-          std::back_inserter(target.impl_->path));
-        target.NormalizePath();
-        target.impl_->query = relative_reference.impl_->query;
+        auto &path = target.impl_->path;
+        path = GetBaseDirectory();
+        path.insert(path.end(),
+          relative_reference.impl_->path.begin(),
+          relative_reference.impl_->path.end());
+        target.impl_->NormalizePath();
+        target.CopyQuery(relative_reference);
       }
       target.CopyAuthority(*this);
     }
-    target.impl_->scheme = impl_->scheme;
+    target.CopyScheme(*this);
   }
 
-  target.impl_->fragment = relative_reference.impl_->fragment;
+  target.CopyFragment(relative_reference);
+  target.impl_->UpdateCanonicalHash();
 
   return target;
 }
 
-void Uri::CopyScheme(const Uri &other) { impl_->scheme = other.impl_->scheme; }
+Uri Uri::MakeRelative(const Uri &target) const
+{
+  Uri reference;
+  auto &reference_path = reference.impl_->path;
+  reference.CopyFragment(target);
+
+  // The paths are compared as Resolve gives them back, which is normalized
+  // and "/" for an empty path with authority
+  std::vector<std::string> canonical_target_path;
+  const auto *target_path = &target.impl_->path;
+  if (PathNeedsNormalization(*target_path)
+      || (target_path->empty() && target.impl_->HasAuthority())) {
+    canonical_target_path = target.impl_->CanonicalPath();
+    target_path = &canonical_target_path;
+  }
+  static const std::vector<std::string> ROOT{ "" };
+  const auto *base_path = &impl_->path;
+  if (base_path->empty() && impl_->HasAuthority()) { base_path = &ROOT; }
+
+  const bool same_scheme =
+    !impl_->scheme.empty() && EqualsCaseInsensitive(impl_->scheme, target.impl_->scheme);
+  const bool same_authority = same_scheme && impl_->AuthorityEquivalent(*target.impl_);
+  const auto is_absolute = [](const std::vector<std::string> &path) {
+    return !path.empty() && path.front().empty();
+  };
+
+  if (!same_authority) {
+    // A network-path reference keeps the scheme of the base
+    if (same_scheme && !target.impl_->host.empty()) {
+      reference.CopyAuthority(target);
+    } else {
+      reference.CopyScheme(target);
+      reference.CopyAuthority(target);
+    }
+    reference_path = *target_path;
+    reference.CopyQuery(target);
+  } else if (*target_path == *base_path && (target.impl_->has_query || !impl_->has_query)) {
+    // Only the query and fragment differ, so the path is left empty and the
+    // query is given unless it is that of the base
+    if (!impl_->has_query || target.impl_->query != impl_->query) { reference.CopyQuery(target); }
+  } else if (*target_path == *base_path) {
+    // An empty path would bring back the query of the base
+    if (base_path->empty()) {
+      reference.CopyScheme(target);
+      reference_path = *target_path;
+    } else if (!base_path->back().empty()) {
+      reference_path.push_back(base_path->back());
+    } else {
+      reference_path.emplace_back(base_path->size() == 1 ? "" : ".");
+    }
+  } else if (PathNeedsNormalization(*base_path) || target_path->empty() || base_path->empty()
+             || is_absolute(*base_path) != is_absolute(*target_path)) {
+    // The path of the target can not be reached from that of the base, which
+    // has no directory to walk if it is empty
+    if (!is_absolute(*target_path)) {
+      reference.CopyScheme(target);
+      reference.CopyAuthority(target);
+    }
+    reference_path = *target_path;
+    reference.CopyQuery(target);
+  } else {
+    // Walk the directory of the base and the target down to where they
+    // part, go up from the rest of the base and down the rest of the target
+    const size_t directory_size =
+      (base_path->size() == 1 && base_path->front().empty()) ? 1 : base_path->size() - 1;
+    size_t common = 0;
+    while (common < directory_size && common + 1 < target_path->size()
+           && (*base_path)[common] == (*target_path)[common]) {
+      ++common;
+    }
+    const size_t ups = directory_size - common;
+
+    const auto length = [](auto begin, auto end) {
+      size_t total = 0;
+      for (auto segment = begin; segment != end; ++segment) { total += segment->size() + 1; }
+      return total;
+    };
+    const auto rest = std::next(target_path->begin(), static_cast<ptrdiff_t>(common));
+    const bool shorter_absolute = is_absolute(*target_path)
+                                  && (common == 0
+                                      || length(target_path->begin(), target_path->end())
+                                           < ups * 3 + length(rest, target_path->end()));
+    if (shorter_absolute) {
+      reference_path = *target_path;
+    } else {
+      reference_path.reserve(ups + 1 + static_cast<size_t>(target_path->end() - rest));
+      reference_path.assign(ups, "..");
+      // A first segment left empty would make the path absolute
+      if (ups == 0 && rest->empty()) { reference_path.emplace_back("."); }
+      if (ups > 0 || rest + 1 != target_path->end() || !rest->empty()) {
+        reference_path.insert(reference_path.end(), rest, target_path->end());
+      }
+    }
+    reference.CopyQuery(target);
+  }
+
+  reference.impl_->UpdateCanonicalHash();
+  return reference;
+}
+
+void Uri::CopyScheme(const Uri &other)
+{
+  impl_->scheme = other.impl_->scheme;
+  impl_->known_scheme = other.impl_->known_scheme;
+}
 
 void Uri::CopyAuthority(const Uri &other)
 {
   impl_->host = other.impl_->host;
+  impl_->host_kind = other.impl_->host_kind;
+  impl_->ipv4_address = other.impl_->ipv4_address;
+  impl_->ipv6_address = other.impl_->ipv6_address;
   impl_->user_name = other.impl_->user_name;
+  impl_->has_port = other.impl_->has_port;
   impl_->port = other.impl_->port;
 }
 
 void Uri::CopyAndNormalizePath(const Uri &other)
 {
   impl_->path = other.impl_->path;
-  NormalizePath();
+  impl_->NormalizePath();
 }
 
-void Uri::CopyQuery(const Uri &other) { impl_->query = other.impl_->query; }
+void Uri::CopyQuery(const Uri &other)
+{
+  impl_->has_query = other.impl_->has_query;
+  impl_->query = other.impl_->query;
+}
 
-void Uri::CopyFragment(const Uri &other) { impl_->fragment = other.impl_->fragment; }
+void Uri::CopyFragment(const Uri &other)
+{
+  impl_->has_fragment = other.impl_->has_fragment;
+  impl_->fragment = other.impl_->fragment;
+}
 
-void Uri::SetScheme(const std::string &scheme) { impl_->scheme = scheme; }
+void Uri::SetScheme(const std::string &scheme)
+{
+  impl_->scheme = scheme;
+  impl_->known_scheme = InternScheme(scheme);
+  impl_->UpdateCanonicalHash();
+}
 
-void Uri::SetUserName(const std::string &user_name) { impl_->user_name = user_name; }
+void Uri::SetUserName(const std::string &user_name)
+{
+  impl_->user_name = user_name;
+  impl_->UpdateCanonicalHash();
+}
 
-void Uri::SetHost(const std::string &host) { impl_->host = host; }
+void Uri::SetHost(const std::string &host)
+{
+  impl_->host = host;
+  if (ParseIpv6Address(host, impl_->ipv6_address)) {
+    impl_->host_kind = HostKind::ipv6;
+  } else {
+    impl_->ClassifyRegName();
+  }
+  impl_->UpdateCanonicalHash();
+}
 
 void Uri::SetPort(const u_int16_t &port)
 {
   impl_->port = port;
   impl_->has_port = true;
+  impl_->UpdateCanonicalHash();
 }
 
 void Uri::ClearPort()
 {
   impl_->port = 0;
   impl_->has_port = false;
+  impl_->UpdateCanonicalHash();
 }
 
 
-void Uri::SetPath(const std::vector<std::string> &path) { impl_->path = path; }
+void Uri::SetPath(const std::vector<std::string> &path)
+{
+  impl_->path = path;
+  impl_->UpdateCanonicalHash();
+}
 
 void Uri::SetQuery(const std::string &query)
 {
   impl_->has_query = true;
   impl_->query = query;
+  impl_->UpdateCanonicalHash();
 }
 
 void Uri::ClearQuery()
 {
   impl_->query.clear();
   impl_->has_query = false;
+  impl_->UpdateCanonicalHash();
 }
 
 bool Uri::HasQuery() const { return impl_->has_query; }
@@ -804,48 +1207,139 @@ void Uri::SetFragment(const std::string &fragment)
 {
   impl_->has_fragment = true;
   impl_->fragment = fragment;
+  impl_->UpdateCanonicalHash();
 }
 
 void Uri::ClearFragment()
 {
   impl_->fragment.clear();
   impl_->has_fragment = false;
+  impl_->UpdateCanonicalHash();
 }
 
 bool Uri::HasFragment() const { return impl_->has_fragment; }
 
-std::string Uri::GenerateString() const
+std::vector<std::string> Uri::GetBaseDirectory() const
 {
+  const auto &path = impl_->path;
+  if (path.empty()) {
+    return impl_->HasAuthority() ? std::vector<std::string>{ "" } : std::vector<std::string>{};
+  }
 
-  std::ostringstream buffer;
+  // A path of one empty segment is the root, which has no last segment
+  if (path.size() == 1 && path.front().empty()) { return path; }
+  return { path.begin(), std::prev(path.end()) };
+}
 
-  if (!impl_->scheme.empty()) { buffer << impl_->scheme << ":"; }
+bool Uri::IsPathEmpty() const { return impl_->path.empty(); }
 
-  if (impl_->HasAuthority()) {
-    buffer << "//";
+bool Uri::IsPathNormalized() const { return !PathNeedsNormalization(impl_->path); }
 
-    if (!impl_->user_name.empty()) { buffer << EncodeElement(impl_->user_name, USER_NAME) << "@"; }
+void Uri::AppendSchemeAndAuthority(std::string &target) const
+{
+  if (!impl_->scheme.empty()) {
+    target += impl_->scheme;
+    target += ':';
+  }
 
-    if (impl_->ValidateIpv6Address(impl_->host)) {
-      buffer << '[' << NormalizeCaseInsensitiveString(impl_->host) << ']';
-    } else {
-      buffer << EncodeElement(impl_->host, REG_NAME_NOT_PCT_ENCODED);
-    }
+  if (!impl_->HasAuthority()) { return; }
+  target += "//";
+
+  if (!impl_->user_name.empty()) {
+    AppendEncoded(target, impl_->user_name, USER_NAME);
+    target += '@';
+  }
 
-    if (impl_->has_port) { buffer << ':' << impl_->port; }
+  if (impl_->host_kind == HostKind::ipv6) {
+    target += '[';
+    target += NormalizeCaseInsensitiveString(impl_->host);
+    target += ']';
+  } else if (impl_->host_kind == HostKind::ipv_future) {
+    target += '[';
+    target += impl_->host;
+    target += ']';
+  } else {
+    AppendEncoded(target, impl_->host, REG_NAME_NOT_PCT_ENCODED);
+  }
+
+  if (impl_->has_port) {
+    target += ':';
+    target += std::to_string(impl_->port);
   }
+}
+
+void Uri::AppendPath(std::string &target, bool after_authority) const
+{
+  AppendSegments(
+    target, impl_->path, !impl_->scheme.empty(), after_authority || impl_->HasAuthority());
+}
+
+void Uri::AppendQuery(std::string &target) const
+{
+  if (!impl_->has_query) { return; }
+  target += '?';
+  AppendEncoded(target, impl_->query, QUERY_OR_FRAGMENT);
+}
 
-  if (IsAbsolutePath() && impl_->path.size() == 1) { buffer << "/"; }
-  size_t position = 0;
-  for (const auto &segment : impl_->path) {
-    buffer << EncodeElement(segment, PCHAR_NOT_PCT_ENCODED);
-    if (++position < impl_->path.size()) { buffer << "/"; }
+void Uri::AppendFragment(std::string &target) const
+{
+  if (!impl_->has_fragment) { return; }
+  target += '#';
+  AppendEncoded(target, impl_->fragment, QUERY_OR_FRAGMENT);
+}
+
+std::string Uri::GenerateString() const
+{
+  std::string buffer;
+  AppendSchemeAndAuthority(buffer);
+  AppendPath(buffer, false);
+  AppendQuery(buffer);
+  AppendFragment(buffer);
+  return buffer;
+}
+
+std::string Uri::GenerateCanonicalString() const
+{
+  std::string buffer;
+  if (!impl_->scheme.empty()) {
+    buffer += NormalizeCaseInsensitiveString(impl_->scheme);
+    buffer += ':';
   }
 
-  if (impl_->has_query) { buffer << "?" << EncodeElement(impl_->query, QUERY_OR_FRAGMENT); }
-  if (impl_->has_fragment) { buffer << "#" << EncodeElement(impl_->fragment, QUERY_OR_FRAGMENT); }
+  if (impl_->HasAuthority()) {
+    buffer += "//";
+    if (!impl_->user_name.empty()) {
+      AppendEncoded(buffer, impl_->user_name, USER_NAME);
+      buffer += '@';
+    }
+
+    if (impl_->host_kind == HostKind::ipv6) {
+      // The binary form is compared, so it is written back the one way
+      // RFC 5952 recommends
+      std::array<char, INET6_ADDRSTRLEN> address{};
+      inet_ntop(AF_INET6, &impl_->ipv6_address, address.data(), address.size());
+      buffer += '[';
+      buffer += address.data();
+      buffer += ']';
+    } else if (impl_->host_kind == HostKind::ipv_future) {
+      buffer += '[';
+      buffer += impl_->host;
+      buffer += ']';
+    } else {
+      AppendEncoded(
+        buffer, NormalizeCaseInsensitiveString(impl_->host), REG_NAME_NOT_PCT_ENCODED);
+    }
+
+    if (impl_->HasCanonicalPort()) {
+      buffer += ':';
+      buffer += std::to_string(impl_->port);
+    }
+  }
 
-  return buffer.str();
+  AppendSegments(buffer, impl_->CanonicalPath(), !impl_->scheme.empty(), impl_->HasAuthority());
+  AppendQuery(buffer);
+  AppendFragment(buffer);
+  return buffer;
 }
 
 }// namespace Uri
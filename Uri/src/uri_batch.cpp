@@ -0,0 +1,211 @@
+#include "uri_batch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+namespace {
+
+/** This is the least number of inputs worth handing to a thread of its own */
+constexpr size_t MIN_INPUTS_PER_THREAD = 1024;
+
+/*
+ * This function records where a component is located in an input
+ *
+ * @param[in] offsets
+ *  These are the offsets of the component for the whole batch
+ *
+ * @param[in] index
+ *  This is the position of the input in the batch
+ *
+ * @param[in] begin
+ *  This is where the component begins in the input
+ *
+ * @param[in] end
+ *  This is where the component ends in the input
+ */
+void SetComponent(Uri::ComponentOffsets &offsets, size_t index, size_t begin, size_t end)
+{
+  offsets.begin[index] = static_cast<uint32_t>(begin);
+  offsets.length[index] = static_cast<uint32_t>(end - begin);
+}
+
+/*
+ * This function marks every component of an input as absent
+ */
+void ClearComponents(Uri::BatchParseResults &results, size_t index)
+{
+  for (auto *offsets : { &results.scheme,
+         &results.user_info,
+         &results.host,
+         &results.port,
+         &results.path,
+         &results.query,
+         &results.fragment }) {
+    offsets->begin[index] = Uri::ComponentOffsets::ABSENT;
+    offsets->length[index] = 0;
+  }
+}
+
+/*
+ * This function splits a valid URI into its components, following the same
+ * rules as Uri::ParseFromString
+ *
+ * @param[in] input
+ *  This is the URI to split
+ *
+ * @param[in] results
+ *  This is where the offsets of the components are stored
+ *
+ * @param[in] index
+ *  This is the position of the input in the batch
+ */
+void SplitComponents(std::string_view input, Uri::BatchParseResults &results, size_t index)
+{
+  size_t position = 0;
+
+  const auto scheme_end = input.find(':');
+  if (scheme_end != std::string_view::npos && scheme_end < input.find_first_of("/?#")) {
+    SetComponent(results.scheme, index, 0, scheme_end);
+    position = scheme_end + 1;
+  }
+
+  if (input.substr(position, 2) == "//") {
+    const auto authority_begin = position + 2;
+    auto authority_end = input.find_first_of("/?#", authority_begin);
+    if (authority_end == std::string_view::npos) { authority_end = input.size(); }
+
+    auto host_begin = authority_begin;
+    const auto user_info_end = input.find('@', authority_begin);
+    if (user_info_end < authority_end) {
+      SetComponent(results.user_info, index, authority_begin, user_info_end);
+      host_begin = user_info_end + 1;
+    }
+
+    auto host_end = authority_end;
+    auto port_delimiter = std::string_view::npos;
+    if (host_begin < authority_end && input[host_begin] == '[') {
+      const auto literal_end = input.find(']', host_begin);
+      if (literal_end + 1 < authority_end && input[literal_end + 1] == ':') {
+        port_delimiter = literal_end + 1;
+      }
+    } else {
+      port_delimiter = input.find(':', host_begin);
+    }
+    if (port_delimiter < authority_end) {
+      host_end = port_delimiter;
+      SetComponent(results.port, index, port_delimiter + 1, authority_end);
+    }
+    SetComponent(results.host, index, host_begin, host_end);
+    position = authority_end;
+  }
+
+  auto path_end = input.find_first_of("?#", position);
+  if (path_end == std::string_view::npos) { path_end = input.size(); }
+  SetComponent(results.path, index, position, path_end);
+  position = path_end;
+
+  if (position < input.size() && input[position] == '?') {
+    auto query_end = input.find('#', position);
+    if (query_end == std::string_view::npos) { query_end = input.size(); }
+    SetComponent(results.query, index, position + 1, query_end);
+    position = query_end;
+  }
+
+  if (position < input.size()) { SetComponent(results.fragment, index, position + 1, input.size()); }
+}
+
+/*
+ * This function parses the inputs of the batch in the given range
+ *
+ * @param[in] inputs
+ *  This is the whole batch
+ *
+ * @param[in] results
+ *  This is where the results of the whole batch are stored
+ *
+ * @param[in] first
+ *  This is the position of the first input to parse
+ *
+ * @param[in] last
+ *  This is the position after the last input to parse
+ */
+void ParseRange(std::span<const std::string_view> inputs,
+  Uri::BatchParseResults &results,
+  size_t first,
+  size_t last)
+{
+  Uri::Uri uri;
+  std::string buffer;
+
+  for (size_t index = first; index < last; ++index) {
+    const auto input = inputs[index];
+    ClearComponents(results, index);
+    results.parse_errors[index] = Uri::ParseError::none;
+    results.error_offsets[index] = 0;
+
+    if (input.size() >= Uri::ComponentOffsets::ABSENT) {
+      results.valid[index] = 0;
+      results.errors[index] = Uri::BatchParseError::too_long;
+      continue;
+    }
+
+    buffer.assign(input);
+    if (const auto result = uri.ParseFromString(buffer); !result) {
+      results.valid[index] = 0;
+      results.errors[index] = Uri::BatchParseError::invalid;
+      results.parse_errors[index] = result.error;
+      results.error_offsets[index] = static_cast<uint32_t>(result.offset);
+      continue;
+    }
+
+    results.valid[index] = 1;
+    results.errors[index] = Uri::BatchParseError::none;
+    SplitComponents(input, results, index);
+  }
+}
+
+}// namespace
+
+namespace Uri {
+
+void BatchParseResults::Resize(size_t size)
+{
+  for (auto *offsets : { &scheme, &user_info, &host, &port, &path, &query, &fragment }) {
+    offsets->begin.resize(size);
+    offsets->length.resize(size);
+  }
+  valid.resize(size);
+  errors.resize(size);
+  parse_errors.resize(size);
+  error_offsets.resize(size);
+}
+
+void ParseBatch(std::span<const std::string_view> inputs,
+  BatchParseResults &results,
+  size_t thread_count)
+{
+  results.Resize(inputs.size());
+
+  if (thread_count == 0) { thread_count = std::max(1U, std::thread::hardware_concurrency()); }
+  thread_count = std::min(thread_count, inputs.size() / MIN_INPUTS_PER_THREAD);
+
+  if (thread_count <= 1) {
+    ParseRange(inputs, results, 0, inputs.size());
+    return;
+  }
+
+  // Every thread fills a contiguous slice of the arrays, so they never
+  // write to the same cache lines except at the slice boundaries
+  const auto chunk_size = (inputs.size() + thread_count - 1) / thread_count;
+  std::vector<std::jthread> workers;
+  workers.reserve(thread_count - 1);
+
+  for (size_t first = chunk_size; first < inputs.size(); first += chunk_size) {
+    const auto last = std::min(first + chunk_size, inputs.size());
+    workers.emplace_back([inputs, &results, first, last] { ParseRange(inputs, results, first, last); });
+  }
+  ParseRange(inputs, results, 0, std::min(chunk_size, inputs.size()));
+}
+
+}// namespace Uri
@@ -0,0 +1,222 @@
+#include "utf8.hpp"
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/** These are the bits that tell the length of a UTF-8 sequence from its lead byte */
+constexpr unsigned int ASCII_LIMIT = 0x80;
+constexpr unsigned int LEAD_2_MASK = 0xE0;
+constexpr unsigned int LEAD_2 = 0xC0;
+constexpr unsigned int LEAD_3_MASK = 0xF0;
+constexpr unsigned int LEAD_3 = 0xE0;
+constexpr unsigned int LEAD_4_MASK = 0xF8;
+constexpr unsigned int LEAD_4 = 0xF0;
+
+/** These are the bits of a continuation byte and the six bits of value it holds */
+constexpr unsigned int CONTINUATION_MASK = 0xC0;
+constexpr unsigned int CONTINUATION = 0x80;
+constexpr unsigned int CONTINUATION_BITS = 6;
+constexpr unsigned int CONTINUATION_VALUE = 0x3F;
+
+/** These are the limits of the code points of RFC 3629 */
+constexpr char32_t MIN_2 = 0x80;
+constexpr char32_t MIN_3 = 0x800;
+constexpr char32_t MIN_4 = 0x10000;
+constexpr char32_t MAX_CODE_POINT = 0x10FFFF;
+constexpr char32_t SURROGATES_BEGIN = 0xD800;
+constexpr char32_t SURROGATES_END = 0xDFFF;
+
+/** These are the limits of the "ucschar" and "iprivate" rules of RFC 3987 */
+constexpr char32_t PLANE_MASK = 0xFFFF;
+constexpr char32_t PLANE_LAST = 0xFFFD;
+constexpr char32_t TAGS_PLANE = 0xE0000;
+constexpr char32_t TAGS_END = 0xE1000;
+constexpr char32_t PRIVATE_PLANES = 0xF0000;
+constexpr char32_t PRIVATE_USE_BEGIN = 0xE000;
+constexpr char32_t PRIVATE_USE_END = 0xF8FF;
+
+/** These are the ranges of the Basic Multilingual Plane an IRI may hold */
+struct Range
+{
+  char32_t first;
+  char32_t last;
+};
+constexpr Range BMP_UCSCHAR[] = { { 0xA0, 0xD7FF }, { 0xF900, 0xFDCF }, { 0xFDF0, 0xFFEF } };
+
+/** These are the digits of percent-encoded bytes */
+constexpr std::string_view HEX_DIGITS = "0123456789ABCDEF";
+constexpr unsigned int HEX_DISPLACEMENT = 4;
+constexpr unsigned int HEX_THING = 0x0F;
+
+#if defined(__SSE2__)
+/** This is the number of bytes looked at a time */
+constexpr size_t VECTOR_SIZE = 16;
+#endif
+
+}// namespace
+
+namespace Uri {
+
+size_t FindNonAscii(std::string_view input, size_t position)
+{
+#if defined(__SSE2__)
+  // The mask has a bit for every byte with its high bit set
+  for (; position + VECTOR_SIZE <= input.size(); position += VECTOR_SIZE) {
+    const auto bytes =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + position));// NOLINT
+    const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(bytes));
+    if (mask != 0) { return position + static_cast<size_t>(std::countr_zero(mask)); }
+  }
+#endif
+
+  for (; position < input.size(); ++position) {
+    if (static_cast<unsigned char>(input[position]) >= ASCII_LIMIT) { return position; }
+  }
+  return std::string_view::npos;
+}
+
+size_t DecodeUtf8(std::string_view input, size_t position, char32_t &code_point)
+{
+  const unsigned int lead = static_cast<unsigned char>(input[position]);
+  size_t length = 0;
+  char32_t value = 0;
+  char32_t minimum = 0;
+  if (lead < ASCII_LIMIT) {
+    code_point = lead;
+    return 1;
+  } else if ((lead & LEAD_2_MASK) == LEAD_2) {
+    length = 2;
+    value = lead & ~LEAD_2_MASK;
+    minimum = MIN_2;
+  } else if ((lead & LEAD_3_MASK) == LEAD_3) {
+    length = 3;
+    value = lead & ~LEAD_3_MASK;
+    minimum = MIN_3;
+  } else if ((lead & LEAD_4_MASK) == LEAD_4) {
+    length = 4;
+    value = lead & ~LEAD_4_MASK;
+    minimum = MIN_4;
+  } else {
+    return 0;
+  }
+
+  if (input.size() - position < length) { return 0; }
+  for (size_t index = 1; index < length; ++index) {
+    const unsigned int byte = static_cast<unsigned char>(input[position + index]);
+    if ((byte & CONTINUATION_MASK) != CONTINUATION) { return 0; }
+    value = (value << CONTINUATION_BITS) | (byte & CONTINUATION_VALUE);
+  }
+
+  if (value < minimum || value > MAX_CODE_POINT
+      || (value >= SURROGATES_BEGIN && value <= SURROGATES_END)) {
+    return 0;
+  }
+  code_point = value;
+  return length;
+}
+
+void AppendUtf8(std::string &text, char32_t code_point)
+{
+  const auto byte = [](char32_t bits) { return static_cast<char>(bits); };
+  if (code_point < MIN_2) {
+    text.push_back(byte(code_point));
+    return;
+  }
+
+  // The lead byte holds what is left above the continuation bytes
+  size_t continuations = 1;
+  char32_t lead = LEAD_2;
+  if (code_point >= MIN_4) {
+    continuations = 3;
+    lead = LEAD_4;
+  } else if (code_point >= MIN_3) {
+    continuations = 2;
+    lead = LEAD_3;
+  }
+  text.push_back(byte(lead | (code_point >> (CONTINUATION_BITS * continuations))));
+  while (continuations-- > 0) {
+    const auto bits = (code_point >> (CONTINUATION_BITS * continuations)) & CONTINUATION_VALUE;
+    text.push_back(byte(CONTINUATION | bits));
+  }
+}
+
+size_t FindInvalidUtf8(std::string_view input)
+{
+  size_t position = 0;
+  while ((position = FindNonAscii(input, position)) != std::string_view::npos) {
+    char32_t code_point = 0;
+    const auto length = DecodeUtf8(input, position, code_point);
+    if (length == 0) { return position; }
+    position += length;
+  }
+  return std::string_view::npos;
+}
+
+bool IsIriCharacter(char32_t code_point, bool in_query)
+{
+  if (code_point < MIN_4) {
+    for (const auto &range : BMP_UCSCHAR) {
+      if (code_point >= range.first && code_point <= range.last) { return true; }
+    }
+    return in_query && code_point >= PRIVATE_USE_BEGIN && code_point <= PRIVATE_USE_END;
+  }
+
+  // The last two code points of every plane are not characters
+  if ((code_point & PLANE_MASK) > PLANE_LAST) { return false; }
+  if (code_point < TAGS_PLANE) { return true; }
+  if (code_point < PRIVATE_PLANES) { return code_point >= TAGS_END; }
+  return in_query;
+}
+
+size_t MapIriToUri(std::string_view iri, std::string &uri)
+{
+  uri.clear();
+  uri.reserve(iri.size());
+
+  // The query runs from the first "?" to the first "#", if the "?" comes first
+  const auto query_begin = iri.find_first_of("?#");
+  const auto query_end = (query_begin != std::string_view::npos && iri[query_begin] == '?')
+                           ? iri.find('#', query_begin)
+                           : query_begin;
+
+  size_t position = 0;
+  while (position < iri.size()) {
+    const auto non_ascii = FindNonAscii(iri, position);
+    uri.append(iri.substr(position, non_ascii - position));
+    if (non_ascii == std::string_view::npos) { break; }
+
+    char32_t code_point = 0;
+    const auto length = DecodeUtf8(iri, non_ascii, code_point);
+    const bool in_query = non_ascii > query_begin && non_ascii < query_end;
+    if (length == 0 || !IsIriCharacter(code_point, in_query)) { return non_ascii; }
+
+    for (size_t index = 0; index < length; ++index) {
+      const unsigned int byte = static_cast<unsigned char>(iri[non_ascii + index]);
+      uri.push_back('%');
+      uri.push_back(HEX_DIGITS[byte >> HEX_DISPLACEMENT]);
+      uri.push_back(HEX_DIGITS[byte & HEX_THING]);
+    }
+    position = non_ascii + length;
+  }
+  return std::string_view::npos;
+}
+
+size_t IriOffset(std::string_view iri, size_t uri_offset)
+{
+  // Every byte that is not ASCII was written as three
+  const size_t ENCODED_SIZE = 3;
+  size_t mapped = 0;
+  for (size_t position = 0; position < iri.size(); ++position) {
+    mapped += static_cast<unsigned char>(iri[position]) < ASCII_LIMIT ? 1 : ENCODED_SIZE;
+    if (mapped > uri_offset) { return position; }
+  }
+  return iri.size();
+}
+
+}// namespace Uri
@@ -0,0 +1,93 @@
+#ifndef URI_UTF8_HPP
+#define URI_UTF8_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Uri {
+/* This function finds the first byte that is not ASCII. It looks at 16
+ * bytes at a time where the CPU supports it, so ASCII input, which is most
+ * of it, costs little more than a memchr.
+ *
+ * @param[in] input
+ *  This is the text to search
+ *
+ * @param[in] position
+ *  This is where the search starts
+ *
+ * @return
+ *  The position of the first byte above 0x7F, or npos if there is none
+ */
+size_t FindNonAscii(std::string_view input, size_t position = 0);
+
+/* This function decodes the UTF-8 sequence at the given position, as
+ * RFC 3629 defines it: overlong forms, surrogates, code points above
+ * U+10FFFF and sequences cut short are not well formed.
+ *
+ * @param[in] input
+ *  This is the text holding the sequence
+ *
+ * @param[in] position
+ *  This is where the sequence begins
+ *
+ * @param[out] code_point
+ *  This is where the code point is stored if the sequence is well formed
+ *
+ * @return
+ *  The length of the sequence, or 0 if it is not well formed
+ */
+size_t DecodeUtf8(std::string_view input, size_t position, char32_t &code_point);
+
+/* This function writes the code point in UTF-8 at the end of the text. The
+ * code point must be one DecodeUtf8 accepts.
+ */
+void AppendUtf8(std::string &text, char32_t code_point);
+
+/* This function checks that the whole text is well formed UTF-8
+ *
+ * @return
+ *  The position of the first byte that is not part of a well formed
+ *  sequence, or npos if there is none
+ */
+size_t FindInvalidUtf8(std::string_view input);
+
+/* This function checks if the code point may appear in an IRI as it is,
+ * that is if it is a "ucschar" of RFC 3987, or an "iprivate" one inside
+ * the query
+ */
+bool IsIriCharacter(char32_t code_point, bool in_query);
+
+/* This function maps an IRI to a URI as RFC 3987 section 3.1 describes, in
+ * one pass: runs of ASCII are copied as they are and every other character
+ * is checked and percent-encoded, byte by byte.
+ *
+ * @param[in] iri
+ *  This is the IRI to map
+ *
+ * @param[out] uri
+ *  This is where the URI is written, reusing its memory
+ *
+ * @return
+ *  The position in the IRI of the first byte that is not well formed UTF-8
+ *  or is a character an IRI may not hold, or npos if the IRI was mapped
+ */
+size_t MapIriToUri(std::string_view iri, std::string &uri);
+
+/* This function finds the byte of the IRI that a byte of the URI it was
+ * mapped to came from, so that errors found in the URI can be reported at
+ * the right place
+ *
+ * @param[in] iri
+ *  This is the IRI that was mapped
+ *
+ * @param[in] uri_offset
+ *  This is the position of the byte in the URI
+ *
+ * @return
+ *  The position of the byte in the IRI
+ */
+size_t IriOffset(std::string_view iri, size_t uri_offset);
+}// namespace Uri
+
+#endif// !URI_UTF8_HPP
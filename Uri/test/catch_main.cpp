@@ -1,3 +1,4 @@
 #define CATCH_CONFIG_MAIN// This tells the catch header to generate a main
+#define CATCH_CONFIG_ENABLE_BENCHMARKING// Hidden [.benchmark] test cases use BENCHMARK
 
 #include <catch2/catch.hpp>
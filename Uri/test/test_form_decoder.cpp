@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+
+#include "../headers/form_decoder.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Fields = std::vector<std::pair<std::string, std::string>>;
+
+/*
+ * This function decodes a form body fed in chunks of the given size
+ */
+std::pair<Uri::FormError, Fields> DecodeForm(std::string_view body, size_t chunk_size)
+{
+  Fields fields;
+  Uri::FormDecoder decoder([&fields](std::string_view name, std::string_view value) {
+    fields.emplace_back(name, value);
+    return true;
+  });
+  for (size_t offset = 0; offset < body.size(); offset += chunk_size) {
+    const auto error = decoder.Feed(body.substr(offset, chunk_size));
+    if (error != Uri::FormError::none) { return { error, fields }; }
+  }
+  return { decoder.Finish(), fields };
+}
+
+}// namespace
+
+TEST_CASE("Form bodies are decoded in chunks of any size", "[FormDecoder]")
+{
+  const std::string body = "name=J%C3%BCrgen+Smith&empty=&&flag&q=a%2Bb%3Dc%26d&path=/a?b:c@d";
+  const Fields expected{
+    { "name", "J\xC3\xBCrgen Smith" },
+    { "empty", "" },
+    { "flag", "" },
+    { "q", "a+b=c&d" },
+    { "path", "/a?b:c@d" },
+  };
+
+  for (size_t chunk_size = 1; chunk_size <= body.size(); ++chunk_size) {
+    INFO("Chunk size: " + std::to_string(chunk_size));
+    const auto [error, fields] = DecodeForm(body, chunk_size);
+    REQUIRE(error == Uri::FormError::none);
+    REQUIRE(fields == expected);
+  }
+}
+
+TEST_CASE("Form fields that need no decoding are given in place", "[FormDecoder]")
+{
+  // A field at the end of a chunk may go on in the next, so it is kept
+  const std::string body = "a=1&b=2&";
+  std::vector<const char *> names;
+  Uri::FormDecoder decoder([&names](std::string_view name, std::string_view) {
+    names.push_back(name.data());
+    return true;
+  });
+  REQUIRE(decoder.Feed(body) == Uri::FormError::none);
+  REQUIRE(decoder.Finish() == Uri::FormError::none);
+  REQUIRE(names == std::vector<const char *>{ body.data(), body.data() + 4 });
+}
+
+TEST_CASE("Bad form bodies are reported", "[FormDecoder]")
+{
+  REQUIRE(DecodeForm("a=%zz", 2).first == Uri::FormError::invalid_character);
+  REQUIRE(DecodeForm("a=%4", 100).first == Uri::FormError::invalid_character);
+  REQUIRE(DecodeForm("a=b c", 100).first == Uri::FormError::invalid_character);
+  REQUIRE(DecodeForm("a=\"b\"&c=d", 100).first == Uri::FormError::invalid_character);
+
+  Uri::FormDecoder small([](std::string_view, std::string_view) { return true; }, 8);
+  REQUIRE(small.Feed("a=1234&") == Uri::FormError::none);
+  REQUIRE(small.Feed("b=12345") == Uri::FormError::none);
+  REQUIRE(small.Feed("67") == Uri::FormError::field_too_long);
+  REQUIRE(small.Feed("&c=1") == Uri::FormError::field_too_long);
+
+  Uri::FormDecoder stopped([](std::string_view, std::string_view) { return false; });
+  REQUIRE(stopped.Feed("a=1&b=2") == Uri::FormError::aborted);
+  REQUIRE(stopped.Finish() == Uri::FormError::aborted);
+}
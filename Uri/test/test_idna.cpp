@@ -0,0 +1,223 @@
+#include <catch2/catch.hpp>
+
+#include "../headers/idna.hpp"
+#include "../src/utf8.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+/*
+ * This function decodes UTF-8 that is known to be valid into code points
+ */
+std::u32string ToCodePoints(std::string_view text)
+{
+  std::u32string code_points;
+  for (size_t position = 0; position < text.size();) {
+    char32_t code_point = 0;
+    position += Uri::DecodeUtf8(text, position, code_point);
+    code_points.push_back(code_point);
+  }
+  return code_points;
+}
+
+}// namespace
+
+TEST_CASE("Labels are encoded and decoded with Punycode", "[Idna]")
+{
+  struct TestVector
+  {
+    std::string label;
+    std::string encoded;
+  };
+  const std::vector<TestVector> testVectors{
+    { "b\xC3\xBC"
+      "cher",
+      "bcher-kva" },
+    { "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "wgv71a119e" },
+    { "r\xC3\xA9sum\xC3\xA9", "rsum-bpad" },
+    { "stra\xC3\x9F"
+      "e",
+      "strae-oqa" },
+    { "\xC3\xBC", "tda" },
+    { "abc", "abc-" },
+    // These are from the samples of RFC 3492 section 7.1
+    { "\xD9\x84\xD9\x8A\xD9\x87\xD9\x85\xD8\xA7\xD8\xA8\xD8\xAA\xD9\x83\xD9\x84\xD9\x85\xD9\x88"
+      "\xD8\xB4\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A\xD8\x9F",
+      "egbpdaj6bu4bxfgehfvwxn" },
+    { "\xE4\xBB\x96\xE4\xBB\xAC\xE4\xB8\xBA\xE4\xBB\x80\xE4\xB9\x88\xE4\xB8\x8D\xE8\xAF\xB4"
+      "\xE4\xB8\xAD\xE6\x96\x87",
+      "ihqwcrb4cv8a8dqg056pqjye" },
+    { "\xD0\xBF\xD0\xBE\xD1\x87\xD0\xB5\xD0\xBC\xD1\x83\xD0\xB6\xD0\xB5\xD0\xBE\xD0\xBD\xD0\xB8"
+      "\xD0\xBD\xD0\xB5\xD0\xB3\xD0\xBE\xD0\xB2\xD0\xBE\xD1\x80\xD1\x8F\xD1\x82\xD0\xBF\xD0\xBE"
+      "\xD1\x80\xD1\x83\xD1\x81\xD1\x81\xD0\xBA\xD0\xB8",
+      "b1abfaaepdrnnbgefbadotcwatmq2g4l" },
+    { "3\xE5\xB9\xB4"
+      "B\xE7\xB5\x84\xE9\x87\x91\xE5\x85\xAB\xE5\x85\x88\xE7\x94\x9F",
+      "3B-ww4c5e180e575a65lsy2b" },
+  };
+
+  std::u32string decoded;
+  for (const auto &testVector : testVectors) {
+    INFO("Encoded: " + testVector.encoded);
+    const auto code_points = ToCodePoints(testVector.label);
+    std::string encoded;
+    REQUIRE(Uri::PunycodeEncode(code_points, encoded));
+    REQUIRE(encoded == testVector.encoded);
+    REQUIRE(Uri::PunycodeDecode(testVector.encoded, decoded));
+    REQUIRE(decoded == code_points);
+  }
+
+  // Digits are decoded in either case
+  REQUIRE(Uri::PunycodeDecode("BCHER-KVA", decoded));
+  REQUIRE(decoded == U"B\u00FCCHER");
+}
+
+TEST_CASE("Bad Punycode is rejected", "[Idna]")
+{
+  std::u32string decoded;
+  REQUIRE_FALSE(Uri::PunycodeDecode("bcher-kv", decoded));
+  REQUIRE_FALSE(Uri::PunycodeDecode("bcher-k!a", decoded));
+  REQUIRE_FALSE(Uri::PunycodeDecode("b\xC3\xBC-kva", decoded));
+  REQUIRE_FALSE(Uri::PunycodeDecode("99999999999", decoded));
+  REQUIRE_FALSE(Uri::PunycodeDecode("zzzzzzzzzzzzzzzzzzzzzzzz", decoded));
+}
+
+TEST_CASE("Domain names are converted to ASCII", "[Idna]")
+{
+  struct TestVector
+  {
+    std::string domain;
+    std::string ascii;
+  };
+  const std::vector<TestVector> testVectors{
+    { "B\xC3\xBC"
+      "cher.example",
+      "xn--bcher-kva.example" },
+    { "M\xC3\x9CNCHEN.de", "xn--mnchen-3ya.de" },
+    { "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x80\x82jp", "xn--wgv71a119e.jp" },
+    { "stra\xC3\x9F"
+      "e.de",
+      "xn--strae-oqa.de" },
+    { "\xCE\xB2\xCF\x8C\xCE\xBB\xCE\xBF\xCF\x82.gr", "xn--nxasmm1c.gr" },
+    { "\xEF\xBD\x85\xEF\xBD\x98\xEF\xBD\x81\xEF\xBD\x8D\xEF\xBD\x90\xEF\xBD\x8C\xEF\xBD\x85.com",
+      "example.com" },
+    { "\xE2\x91\xA0\xE2\x91\xA1\xEF\xBD\xA1"
+      "com",
+      "12.com" },
+    { "\xC7\x85.com", "xn--d-toa.com" },
+    { "r\xC3\xA9sum\xC3\xA9.example.org", "xn--rsum-bpad.example.org" },
+    { "caf\xC3\xA9\xC2\xAD.com", "xn--caf-dma.com" },
+    { "xn--bcher-kva.example", "xn--bcher-kva.example" },
+    { "WWW.Example.COM", "www.example.com" },
+    { "\xE0\xA4\x95\xE0\xA5\x8D\xE2\x80\x8D\xE0\xA4\xB7.example", "xn--11b2ezcw70k.example" },
+    { "\xD9\x86\xD8\xA7\xD9\x85\xD9\x87\xE2\x80\x8C\xD8\xA7\xDB\x8C.com",
+      "xn--mgba3gch31f060k.com" },
+    { "b\xC3\xBC"
+      "cher.example.",
+      "xn--bcher-kva.example." },
+  };
+
+  std::string ascii;
+  for (const auto &testVector : testVectors) {
+    INFO("Domain: " + testVector.domain);
+    REQUIRE(Uri::DomainToAscii(testVector.domain, ascii) == Uri::IdnaError::none);
+    REQUIRE(ascii == testVector.ascii);
+  }
+}
+
+TEST_CASE("Domain names are normalized before they are converted", "[Idna]")
+{
+  struct TestVector
+  {
+    std::string decomposed;
+    std::string composed;
+    std::string ascii;
+  };
+  const std::vector<TestVector> testVectors{
+    { "bu\xCC\x88"
+      "cher.example",
+      "b\xC3\xBC"
+      "cher.example",
+      "xn--bcher-kva.example" },
+    { "a\xCC\x88\xCC\xA3.com", "\xE1\xBA\xA1\xCC\x88.com", "xn--ssa342l.com" },
+    { "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB\xE1\x84\x80\xE1\x85\xAE\xE1\x86\xA8.kr",
+      "\xED\x95\x9C\xEA\xB5\xAD.kr",
+      "xn--3e0b707e.kr" },
+  };
+
+  std::string ascii;
+  for (const auto &testVector : testVectors) {
+    INFO("Domain: " + testVector.composed);
+    REQUIRE(Uri::DomainToAscii(testVector.decomposed, ascii) == Uri::IdnaError::none);
+    REQUIRE(ascii == testVector.ascii);
+    REQUIRE(Uri::DomainToAscii(testVector.composed, ascii) == Uri::IdnaError::none);
+    REQUIRE(ascii == testVector.ascii);
+  }
+}
+
+TEST_CASE("Domain names that can not be converted tell the reason", "[Idna]")
+{
+  struct TestVector
+  {
+    std::string domain;
+    Uri::IdnaError error;
+  };
+  const std::vector<TestVector> testVectors{
+    { "caf\xC3.com", Uri::IdnaError::invalid_utf8 },
+    { "a\xE2\x80\x8E"
+      "b.com",
+      Uri::IdnaError::prohibited_character },
+    { "\xC2\xA0.com", Uri::IdnaError::prohibited_character },
+    { "a\xE2\x80\x8D"
+      "b.com",
+      Uri::IdnaError::prohibited_character },
+    { "\xEF\xBC\x8F.com", Uri::IdnaError::prohibited_character },
+    { "a.\xCC\x88"
+      "c.com",
+      Uri::IdnaError::prohibited_character },
+    { "xn--u-ccb.com", Uri::IdnaError::invalid_punycode },
+    { "xn--wca.com", Uri::IdnaError::invalid_punycode },
+    { "xn--abc-.com", Uri::IdnaError::invalid_punycode },
+    { "xn--xn---epa.com", Uri::IdnaError::invalid_punycode },
+    { "xn--zzzzzzzzzzzzzzzzzzzzzzzz.com", Uri::IdnaError::invalid_punycode },
+    { "XN--b\xC3\xBC"
+      "cher.com",
+      Uri::IdnaError::invalid_punycode },
+    { "a..com", Uri::IdnaError::empty_label },
+    { ".com", Uri::IdnaError::empty_label },
+    { "", Uri::IdnaError::empty_label },
+    { std::string(64, 'a') + ".com", Uri::IdnaError::label_too_long },
+    { std::string(63, 'a') + "." + std::string(63, 'b') + "." + std::string(63, 'c') + "."
+        + std::string(62, 'd'),
+      Uri::IdnaError::domain_too_long },
+  };
+
+  std::string ascii;
+  for (const auto &testVector : testVectors) {
+    INFO("Domain: " + testVector.domain);
+    REQUIRE(Uri::DomainToAscii(testVector.domain, ascii) == testVector.error);
+  }
+
+  REQUIRE(Uri::ToString(Uri::IdnaError::empty_label) == "empty label");
+}
+
+TEST_CASE("Domain names are converted back to Unicode", "[Idna]")
+{
+  std::string unicode;
+  REQUIRE(Uri::DomainToUnicode("xn--bcher-kva.example", unicode) == Uri::IdnaError::none);
+  REQUIRE(unicode
+          == "b\xC3\xBC"
+             "cher.example");
+  REQUIRE(Uri::DomainToUnicode("XN--wgv71a119e.jp.", unicode) == Uri::IdnaError::none);
+  REQUIRE(unicode == "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E.jp.");
+  REQUIRE(Uri::DomainToUnicode("www.xn--9.com", unicode) == Uri::IdnaError::invalid_punycode);
+
+  // Converting to ASCII and back gives the mapped name
+  std::string ascii;
+  const std::string domain = "R\xC3\xA9sum\xC3\xA9.Example.org";
+  REQUIRE(Uri::DomainToAscii(domain, ascii) == Uri::IdnaError::none);
+  REQUIRE(Uri::DomainToUnicode(ascii, unicode) == Uri::IdnaError::none);
+  REQUIRE(unicode == "r\xC3\xA9sum\xC3\xA9.example.org");
+}
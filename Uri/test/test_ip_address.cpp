@@ -0,0 +1,102 @@
+#include "../headers/ip_address.hpp"
+#include <arpa/inet.h>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+TEST_CASE("Parse valid IPv4 addresses", "[IpAddress]")
+{
+  const std::vector<std::string> test_vectors{
+    "0.0.0.0",
+    "1.2.3.4",
+    "127.0.0.1",
+    "255.255.255.255",
+    "10.200.30.9",
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    INFO(test_vector);
+    in_addr actual{};
+    in_addr expected{};
+    REQUIRE(Uri::ParseIpv4Address(test_vector, actual));
+    REQUIRE(inet_pton(AF_INET, test_vector.c_str(), &expected) == 1);
+    REQUIRE(actual.s_addr == expected.s_addr);
+  }
+}
+
+TEST_CASE("Parse invalid IPv4 addresses", "[IpAddress]")
+{
+  const std::vector<std::string> test_vectors{
+    "",
+    "1.2.3",
+    "1.2.3.4.5",
+    "1.2.3.256",
+    "1.2.3.",
+    ".1.2.3",
+    "1..2.3",
+    "01.2.3.4",
+    "1.2.3.4a",
+    "1.2.x.4",
+    "1000.2.3.4",
+    "www.example.com",
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    INFO(test_vector);
+    in_addr address{};
+    REQUIRE_FALSE(Uri::ParseIpv4Address(test_vector, address));
+  }
+}
+
+TEST_CASE("Parse valid IPv6 addresses", "[IpAddress]")
+{
+  const std::vector<std::string> test_vectors{
+    "::",
+    "::1",
+    "1::",
+    "::ffff:1.2.3.4",
+    "2001:db8:85a3:8d3:1319:8a2e:370:7348",
+    "2001:DB8::8a2e:0:1",
+    "fe80::1:2:3:4:5:6",
+    "1:2:3:4:5:6:1.2.3.4",
+    "1:2:3:4:5:6:7::",
+    "::2:3:4:5:6:7:8",
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    INFO(test_vector);
+    in6_addr actual{};
+    in6_addr expected{};
+    REQUIRE(Uri::ParseIpv6Address(test_vector, actual));
+    REQUIRE(inet_pton(AF_INET6, test_vector.c_str(), &expected) == 1);
+    REQUIRE(std::memcmp(actual.s6_addr, expected.s6_addr, sizeof(in6_addr)) == 0);
+  }
+}
+
+TEST_CASE("Parse invalid IPv6 addresses", "[IpAddress]")
+{
+  const std::vector<std::string> test_vectors{
+    "",
+    ":",
+    ":::",
+    "1:",
+    ":1",
+    "1:2:3:4:5:6:7",
+    "1:2:3:4:5:6:7:8:9",
+    "1::2::3",
+    "12345::",
+    "::fxff:1.2.3.4",
+    "::ffff:1.2.3.256",
+    "::ffff:1.2",
+    "1:2:3:4:5:6:7:1.2.3.4",
+    "2001:db8:85a3::8a2e:0:",
+    "1:2:3:4:5:6:7:8::",
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    INFO(test_vector);
+    in6_addr address{};
+    REQUIRE_FALSE(Uri::ParseIpv6Address(test_vector, address));
+  }
+}
@@ -2,6 +2,13 @@
 
 #include "../src/normalize_case_insensitive_string.hpp"
 
+#include <string>
+
+namespace {
+/** This is the hash of an empty string with the 64-bit FNV-1a hash */
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+}// namespace
+
 TEST_CASE("Normalize case insentice string", "[NormalizeCaseInsensitiveString]")
 {
   REQUIRE("example" == Uri::NormalizeCaseInsensitiveString("example"));
@@ -11,3 +18,54 @@ TEST_CASE("Normalize case insentice string", "[NormalizeCaseInsensitiveString]")
   REQUIRE("foo1bar" == Uri::NormalizeCaseInsensitiveString("foo1bar"));
   REQUIRE("foo1bar" == Uri::NormalizeCaseInsensitiveString("FOO1BAR"));
 }
+
+TEST_CASE("Fold every byte value", "[NormalizeCaseInsensitiveString]")
+{
+  // Long enough to go through the vector loop and the scalar tail
+  std::string all_bytes;
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    for (int value = 0; value < 256; ++value) { all_bytes.push_back(static_cast<char>(value)); }
+  }
+  all_bytes.push_back('Z');
+
+  std::string folded(all_bytes.size(), '\0');
+  Uri::AsciiToLower(all_bytes, folded.data());
+
+  for (size_t index = 0; index < all_bytes.size(); ++index) {
+    const auto character = all_bytes[index];
+    INFO(index);
+    if (character >= 'A' && character <= 'Z') {
+      REQUIRE(folded[index] == static_cast<char>(character - 'A' + 'a'));
+    } else {
+      REQUIRE(folded[index] == character);
+    }
+  }
+
+  Uri::AsciiToLower(all_bytes);
+  REQUIRE(folded == all_bytes);
+}
+
+TEST_CASE("Compare strings ignoring case", "[NormalizeCaseInsensitiveString]")
+{
+  REQUIRE(Uri::EqualsCaseInsensitive("", ""));
+  REQUIRE(Uri::EqualsCaseInsensitive("Host", "hOST"));
+  REQUIRE(Uri::EqualsCaseInsensitive(
+    "Accept-Encoding-With-A-Long-Name", "accept-encoding-with-a-long-NAME"));
+  REQUIRE_FALSE(Uri::EqualsCaseInsensitive("Host", "Hosts"));
+  REQUIRE_FALSE(Uri::EqualsCaseInsensitive("@[`{", "`{@["));
+  REQUIRE_FALSE(Uri::EqualsCaseInsensitive(
+    "Accept-Encoding-With-A-Long-Name", "Accept-Encoding-With-A-Long-Namf"));
+  REQUIRE_FALSE(Uri::EqualsCaseInsensitive(
+    "Accept-Encoding-With-A-Long-Name", "Accept-Encodinf-With-A-Long-Name"));
+}
+
+TEST_CASE("Hash strings ignoring case", "[NormalizeCaseInsensitiveString]")
+{
+  REQUIRE(FNV_OFFSET_BASIS == Uri::HashCaseInsensitive("", FNV_OFFSET_BASIS));
+  // The FNV-1a hash of "a"
+  REQUIRE(0xaf63dc4c8601ec8cULL == Uri::HashCaseInsensitive("A", FNV_OFFSET_BASIS));
+  REQUIRE(Uri::HashCaseInsensitive("www.Example.COM", FNV_OFFSET_BASIS)
+          == Uri::HashCaseInsensitive("www.example.com", FNV_OFFSET_BASIS));
+  REQUIRE(Uri::HashCaseInsensitive("www.example.com", FNV_OFFSET_BASIS)
+          != Uri::HashCaseInsensitive("www.example.org", FNV_OFFSET_BASIS));
+}
@@ -0,0 +1,102 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "../src/parse_port.hpp"
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/*
+ * This is how ports used to be parsed, kept to measure the new parser
+ * against it
+ */
+bool ParsePortWithExceptions(const std::string &port_segment, uint16_t &port)
+{
+  try {
+    const std::shared_ptr<size_t> end_of_number(new size_t);
+
+    port = static_cast<uint16_t>(std::stoul(port_segment, end_of_number.get()));
+    const auto signed_port = std::stoi(port_segment);
+
+    if (*end_of_number != port_segment.size()) { return false; }
+    if (signed_port != port) { return false; }
+  } catch (const std::invalid_argument &e) {
+    return false;
+  } catch (const std::out_of_range &e) {
+    return false;
+  }
+  return true;
+}
+
+const std::vector<std::string> MALFORMED_PORTS{
+  "",
+  "false",
+  "8080spam",
+  "-8080",
+  "+80",
+  " 80",
+  "65536",
+  "99999999999999999999999",
+  "80:80",
+};
+
+}// namespace
+
+TEST_CASE("Parse valid ports", "[ParsePort]")
+{
+  struct TestVector
+  {
+    std::string digits;
+    uint16_t port;
+  };
+
+  const std::vector<TestVector> test_vectors{
+    { "0", 0 },
+    { "80", 80 },
+    { "8080", 8080 },
+    { "65535", 65535 },
+    { "00443", 443 },
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    INFO(test_vector.digits);
+    uint16_t port = 1;
+    REQUIRE(Uri::ParsePort(test_vector.digits, port));
+    REQUIRE(test_vector.port == port);
+  }
+}
+
+TEST_CASE("Parse malformed ports", "[ParsePort]")
+{
+  for (const auto &digits : MALFORMED_PORTS) {
+    INFO(digits);
+    uint16_t port = 1;
+    REQUIRE_FALSE(Uri::ParsePort(digits, port));
+    REQUIRE(1 == port);
+  }
+}
+
+TEST_CASE("Benchmark parsing malformed ports", "[ParsePort][.benchmark]")
+{
+  BENCHMARK("exceptions")
+  {
+    size_t rejected = 0;
+    uint16_t port = 0;
+    for (const auto &digits : MALFORMED_PORTS) {
+      if (!ParsePortWithExceptions(digits, port)) { ++rejected; }
+    }
+    return rejected;
+  };
+
+  BENCHMARK("from_chars")
+  {
+    size_t rejected = 0;
+    uint16_t port = 0;
+    for (const auto &digits : MALFORMED_PORTS) {
+      if (!Uri::ParsePort(digits, port)) { ++rejected; }
+    }
+    return rejected;
+  };
+}
@@ -0,0 +1,164 @@
+#include "../headers/prepared_base.hpp"
+#include <catch2/catch.hpp>
+
+#include "../headers/uri.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/*
+ * This function resolves the reference the slow way, making a Uri for
+ * the target and generating its string
+ */
+std::string ResolveWithUri(const std::string &base, const std::string &reference)
+{
+  Uri::Uri base_uri;
+  Uri::Uri reference_uri;
+  REQUIRE(base_uri.ParseFromString(base));
+  REQUIRE(reference_uri.ParseFromString(reference));
+  return base_uri.Resolve(reference_uri).GenerateString();
+}
+
+}// namespace
+
+TEST_CASE("Prepared bases resolve the examples of RFC 3986", "[PreparedBase]")
+{
+  struct TestVector
+  {
+    std::string reference;
+    std::string target;
+  };
+  const std::vector<TestVector> testVectors{
+    { "g:h", "g:h" },
+    { "g", "http://a/b/c/g" },
+    { "./g", "http://a/b/c/g" },
+    { "g/", "http://a/b/c/g/" },
+    { "/g", "http://a/g" },
+    { "//g", "http://g/" },
+    { "?y", "http://a/b/c/d;p?y" },
+    { "g?y", "http://a/b/c/g?y" },
+    { "#s", "http://a/b/c/d;p?q#s" },
+    { "g#s", "http://a/b/c/g#s" },
+    { "g?y#s", "http://a/b/c/g?y#s" },
+    { ";x", "http://a/b/c/;x" },
+    { "g;x", "http://a/b/c/g;x" },
+    { "g;x?y#s", "http://a/b/c/g;x?y#s" },
+    { "", "http://a/b/c/d;p?q" },
+    { ".", "http://a/b/c/" },
+    { "./", "http://a/b/c/" },
+    { "..", "http://a/b/" },
+    { "../", "http://a/b/" },
+    { "../g", "http://a/b/g" },
+    { "../..", "http://a/" },
+    { "../../", "http://a/" },
+    { "../../g", "http://a/g" },
+    { "../../../g", "http://a/g" },
+    { "../../../../g", "http://a/g" },
+    { "/./g", "http://a/g" },
+    { "/../g", "http://a/g" },
+    { "g.", "http://a/b/c/g." },
+    { ".g", "http://a/b/c/.g" },
+    { "g..", "http://a/b/c/g.." },
+    { "..g", "http://a/b/c/..g" },
+    { "./../g", "http://a/b/g" },
+    { "./g/.", "http://a/b/c/g/" },
+    { "g/./h", "http://a/b/c/g/h" },
+    { "g/../h", "http://a/b/c/h" },
+    { "g;x=1/./y", "http://a/b/c/g;x=1/y" },
+    { "g;x=1/../y", "http://a/b/c/y" },
+    { "g?y/./x", "http://a/b/c/g?y/./x" },
+    { "g#s/../x", "http://a/b/c/g#s/../x" },
+  };
+
+  Uri::Uri base;
+  REQUIRE(base.ParseFromString("http://a/b/c/d;p?q"));
+  Uri::PreparedBase prepared(base);
+  std::string target;
+  for (const auto &testVector : testVectors) {
+    INFO("Reference: " + testVector.reference);
+    REQUIRE(prepared.Resolve(testVector.reference, target));
+    REQUIRE(target == testVector.target);
+    REQUIRE(target == ResolveWithUri("http://a/b/c/d;p?q", testVector.reference));
+  }
+}
+
+TEST_CASE("Prepared bases give the same targets as Uri::Resolve", "[PreparedBase]")
+{
+  const std::vector<std::string> bases{
+    "http://a/b/c/d;p?q",
+    "http://a",
+    "https://user@[::1]:8080/x/y/",
+    "http://a/b/../c/./d",
+    "http://a/b//c",
+    "urn:a:b",
+    "foo:x/y",
+    "foo:/x",
+    "file:",
+    "//a/b/c",
+    "b/c",
+  };
+
+  // References are made of every combination of these pieces
+  const std::vector<std::string> starts{ "", "/", "//h", "g:" };
+  const std::vector<std::string> segments{ "g", ".", "..", "", "%7E;x", "a:b" };
+  const std::vector<std::string> ends{ "", "?y", "#s", "?#", "?%20/x" };
+  std::vector<std::string> references;
+  for (const auto &start : starts) {
+    for (const auto &end : ends) {
+      references.push_back(start + end);
+      for (const auto &first : segments) {
+        references.push_back(start + first + end);
+        for (const auto &second : segments) {
+          references.push_back(start + first + "/" + second + end);
+        }
+      }
+    }
+  }
+
+  Uri::Uri reference_uri;
+  std::string target;
+  for (const auto &base : bases) {
+    Uri::Uri base_uri;
+    REQUIRE(base_uri.ParseFromString(base));
+    Uri::PreparedBase prepared(base_uri);
+
+    for (const auto &reference : references) {
+      INFO("Base: " + base + " Reference: " + reference);
+      const bool valid = static_cast<bool>(reference_uri.ParseFromString(reference));
+      REQUIRE(prepared.Resolve(reference, target) == valid);
+      if (valid) {
+        REQUIRE(target == base_uri.Resolve(reference_uri).GenerateString());
+      } else {
+        REQUIRE(target.empty());
+      }
+    }
+  }
+}
+
+TEST_CASE("Prepared bases resolve batches of references", "[PreparedBase]")
+{
+  Uri::Uri base;
+  REQUIRE(base.ParseFromString("http://example.com/docs/index.html"));
+  Uri::PreparedBase prepared(base);
+
+  const std::vector<std::string_view> references{
+    "intro.html",
+    "../images/logo.png",
+    "/",
+    "bad reference",
+    "https://other.example/",
+  };
+  std::vector<std::string> targets{ "this is reused" };
+  REQUIRE(prepared.ResolveBatch(references, targets) == 4);
+  REQUIRE(targets
+          == std::vector<std::string>{
+            "http://example.com/docs/intro.html",
+            "http://example.com/images/logo.png",
+            "http://example.com/",
+            "",
+            "https://other.example/",
+          });
+}
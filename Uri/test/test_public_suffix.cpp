@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include "../headers/public_suffix.hpp"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Registrable domains follow the rules of the Public Suffix List", "[PublicSuffix]")
+{
+  struct TestVector
+  {
+    std::string host;
+    std::string suffix;
+    std::string domain;
+  };
+  // These are from the tests of the list (https://publicsuffix.org/list/)
+  const std::vector<TestVector> testVectors{
+    { "com", "com", "" },
+    { "example.com", "com", "example.com" },
+    { "a.b.example.com", "com", "example.com" },
+    { "uk.com", "uk.com", "" },
+    { "b.example.uk.com", "uk.com", "example.uk.com" },
+    { "test.ac", "ac", "test.ac" },
+    { "mm", "mm", "" },
+    { "c.mm", "c.mm", "" },
+    { "a.b.c.mm", "c.mm", "b.c.mm" },
+    { "www.test.jp", "jp", "test.jp" },
+    { "test.ac.jp", "ac.jp", "test.ac.jp" },
+    { "kyoto.jp", "kyoto.jp", "" },
+    { "b.ide.kyoto.jp", "ide.kyoto.jp", "b.ide.kyoto.jp" },
+    { "c.kobe.jp", "c.kobe.jp", "" },
+    { "b.c.kobe.jp", "c.kobe.jp", "b.c.kobe.jp" },
+    { "www.city.kobe.jp", "kobe.jp", "city.kobe.jp" },
+    { "ck", "ck", "" },
+    { "test.ck", "test.ck", "" },
+    { "b.test.ck", "test.ck", "b.test.ck" },
+    { "www.ck", "ck", "www.ck" },
+    { "www.www.ck", "ck", "www.ck" },
+    { "test.k12.ak.us", "k12.ak.us", "test.k12.ak.us" },
+    { "xn--85x722f.com.cn", "com.cn", "xn--85x722f.com.cn" },
+    { "xn--85x722f.xn--55qx5d.cn", "xn--55qx5d.cn", "xn--85x722f.xn--55qx5d.cn" },
+    { "shishi.xn--fiqs8s", "xn--fiqs8s", "shishi.xn--fiqs8s" },
+    { "b.example.example", "example", "example.example" },
+    { "www.example.co.uk", "co.uk", "example.co.uk" },
+    { "foo.github.io", "github.io", "foo.github.io" },
+
+    // Letters keep their case and a trailing "." is ignored
+    { "WWW.Example.CO.UK", "CO.UK", "Example.CO.UK" },
+    { "www.example.com.", "com", "example.com" },
+
+    // Names that only end like a rule do not match it
+    { "www.notco.uk", "uk", "notco.uk" },
+    { "a..com", "com", "" },
+
+    // IP addresses have no public suffix
+    { "192.168.0.1", "", "" },
+    { "::1", "", "" },
+    { "", "", "" },
+  };
+
+  for (const auto &testVector : testVectors) {
+    INFO("Host: " + testVector.host);
+    REQUIRE(Uri::GetPublicSuffix(testVector.host) == testVector.suffix);
+    REQUIRE(Uri::GetRegistrableDomain(testVector.host) == testVector.domain);
+  }
+}
+
+TEST_CASE("Public suffixes are views of the host", "[PublicSuffix]")
+{
+  const std::string host = "www.example.co.uk";
+  const auto domain = Uri::GetRegistrableDomain(host);
+  REQUIRE(domain.data() == host.data() + 4);
+  REQUIRE(domain.size() == host.size() - 4);
+}
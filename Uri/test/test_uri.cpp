@@ -1,6 +1,8 @@
 #include "../headers/uri.hpp"
 #include <catch2/catch.hpp>
+#include <random>
 #include <sys/types.h>
+#include <unordered_map>
 
 TEST_CASE("Parse String base case", "Uri")// NOLINT
 {
@@ -101,6 +103,16 @@ TEST_CASE("Parse String with negative port", "Uri")
   REQUIRE(!uri.ParseFromString("https://www.example.com:-8080/foo/bar"));
 }
 
+TEST_CASE("Parse String with out of range and padded ports", "Uri")
+{
+  Uri::Uri uri;
+
+  REQUIRE(!uri.ParseFromString("https://www.example.com:99999999999999999999/foo/bar"));
+  REQUIRE(!uri.ParseFromString("https://www.example.com:+80/foo/bar"));
+  REQUIRE(!uri.ParseFromString("https://www.example.com: 80/foo/bar"));
+  REQUIRE(!uri.ParseFromString("https://www.example.com:/foo/bar"));
+}
+
 TEST_CASE("Parse String that ends after authority", "Uri")
 {
   Uri::Uri uri;
@@ -260,6 +272,40 @@ TEST_CASE("Parse String with scheme in lowercase and uppercase", "Uri")
   }
 }
 
+TEST_CASE("Parse String recognizes common schemes", "Uri")
+{
+  struct TestVector
+  {
+    std::string uri_string;
+    Uri::KnownScheme scheme;
+  };
+
+  const std::vector<TestVector> testVectors{
+    { "http://www.example.com/", Uri::KnownScheme::http },
+    { "HTTPS://www.example.com/", Uri::KnownScheme::https },
+    { "ws://www.example.com/", Uri::KnownScheme::ws },
+    { "wss://www.example.com/", Uri::KnownScheme::wss },
+    { "ftp://www.example.com/", Uri::KnownScheme::ftp },
+    { "file:///etc/hosts", Uri::KnownScheme::file },
+    { "httpx://www.example.com/", Uri::KnownScheme::unknown },
+    { "htt://www.example.com/", Uri::KnownScheme::unknown },
+    { "mailto:bob@example.com", Uri::KnownScheme::unknown },
+    { "//www.example.com/", Uri::KnownScheme::unknown },
+  };
+
+  for (const auto &testVector : testVectors) {
+    Uri::Uri uri;
+
+    INFO(testVector.uri_string);
+    REQUIRE(uri.ParseFromString(testVector.uri_string));
+    REQUIRE(testVector.scheme == uri.GetKnownScheme());
+  }
+
+  Uri::Uri uri;
+  uri.SetScheme("wSs");
+  REQUIRE(Uri::KnownScheme::wss == uri.GetKnownScheme());
+}
+
 TEST_CASE("Parse String with scheme corner cases", "Uri")
 {
   struct TestVector
@@ -635,9 +681,88 @@ TEST_CASE("Normalization and equivalent uri", "Uri")
   REQUIRE(uri2.ParseFromString("eXAMPLe://a/./b/../b/%63/%7bfoo%7d"));
 
 
-  REQUIRE(uri1 != uri2);
+  REQUIRE(uri1 == uri2);
+  REQUIRE(uri1.GetHash() == uri2.GetHash());
   uri2.NormalizePath();
   REQUIRE(uri1 == uri2);
+  REQUIRE(uri1.GetHash() == uri2.GetHash());
+}
+
+TEST_CASE("Equivalent uris in canonical form", "Uri")
+{
+  struct TestVector
+  {
+    std::string uri_string1;
+    std::string uri_string2;
+    bool are_equal;
+  };
+
+  const std::vector<TestVector> testVectors{
+    { "http://www.example.com/", "HTTP://WWW.EXAMPLE.COM/", true },
+    { "http://www.example.com/", "http://www.example.com:80/", true },
+    { "https://www.example.com/", "https://www.example.com:443", true },
+    { "https://www.example.com/", "https://www.example.com:80/", false },
+    { "ftp://www.example.com/", "ftp://www.example.com:21/", true },
+    { "foo://www.example.com/", "foo://www.example.com:80/", false },
+    { "http://www.example.com/%7Efoo", "http://www.example.com/~foo", true },
+    { "http://www.example.com/%7efoo", "http://www.example.com/%7Efoo", true },
+    { "http://www.example.com/a/./b/../c", "http://www.example.com/a/c", true },
+    { "http://www.example.com/a", "http://www.example.com/A", false },
+    { "http://www.example.com/?", "http://www.example.com/", false },
+    { "http://www.example.com/#", "http://www.example.com/", false },
+    { "http://www.example.com/?a", "http://www.example.com/?A", false },
+    { "http://bob@www.example.com/", "http://BOB@www.example.com/", false },
+    { "http://[::1]/", "http://[::1]:80", true },
+    { "http://[::1]/", "http://[0:0:0:0:0:0:0:1]/", true },
+    { "http://[::1]/", "http://[::2]/", false },
+  };
+
+  for (const auto &testVector : testVectors) {
+    Uri::Uri uri1;
+    Uri::Uri uri2;
+
+    INFO(testVector.uri_string1 + " " + testVector.uri_string2);
+    REQUIRE(uri1.ParseFromString(testVector.uri_string1));
+    REQUIRE(uri2.ParseFromString(testVector.uri_string2));
+    REQUIRE(testVector.are_equal == (uri1 == uri2));
+    if (testVector.are_equal) { REQUIRE(uri1.GetHash() == uri2.GetHash()); }
+  }
+}
+
+TEST_CASE("Hash is kept up to date by setters", "Uri")
+{
+  Uri::Uri uri1;
+  Uri::Uri uri2;
+
+  REQUIRE(uri1 == uri2);
+  REQUIRE(uri1.GetHash() == uri2.GetHash());
+
+  REQUIRE(uri1.ParseFromString("http://www.example.com/foo?bar"));
+  uri2.SetScheme("HTTP");
+  uri2.SetHost("www.Example.com");
+  uri2.SetPath({ "", "foo" });
+  uri2.SetQuery("bar");
+  REQUIRE(uri1 == uri2);
+  REQUIRE(uri1.GetHash() == uri2.GetHash());
+
+  uri2.SetPort(8080);
+  REQUIRE(uri1 != uri2);
+  uri2.ClearPort();
+  REQUIRE(uri1.GetHash() == uri2.GetHash());
+}
+
+TEST_CASE("Uri as key of unordered containers", "Uri")
+{
+  std::unordered_map<Uri::Uri, int> cache;
+
+  Uri::Uri uri1;
+  Uri::Uri uri2;
+  REQUIRE(uri1.ParseFromString("http://www.example.com/a/../b"));
+  REQUIRE(uri2.ParseFromString("HTTP://www.EXAMPLE.com:80/b"));
+
+  cache.emplace(std::move(uri1), 1);
+  REQUIRE(cache.count(uri2) == 1);
+  REQUIRE(cache.find(uri2)->second == 1);
 }
 
 TEST_CASE("Resolve relative refence form a base Uri", "Uri")
@@ -672,7 +797,11 @@ TEST_CASE("Resolve relative refence form a base Uri", "Uri")
     { "http://a/b/c/d;p?q", "../..", "http://a/" },
     { "http://a/b/c/d;p?q", "../../", "http://a/" },
     { "http://a/b/c/d;p?q", "../../g", "http://a/g" },
+    { "http://a/b/c/d;p?q", "/./g", "http://a/g" },
+    { "http://a/b/c/d;p?q", "/../g", "http://a/g" },
     { "http://example.com", "foo", "http://example.com/foo" },
+    { "foo:x", "y", "foo:y" },
+    { "foo:x/y", "z", "foo:x/z" },
   };
 
   for (const auto &testVector : testVectors) {
@@ -691,6 +820,110 @@ TEST_CASE("Resolve relative refence form a base Uri", "Uri")
   }
 }
 
+TEST_CASE("Make relative gives the shortest reference to a target", "[Uri]")
+{
+  struct TestVector
+  {
+    std::string base;
+    std::string target;
+    std::string reference;
+  };
+
+  const std::vector<TestVector> testVectors{
+    { "http://a/b/c/d;p?q", "http://a/b/c/g", "g" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/g/", "g/" },
+    { "http://a/b/c/d;p?q", "http://a/b/g", "../g" },
+    { "http://a/b/c/d;p?q", "http://a/b/", "../" },
+    { "http://a/b/c/d;p?q", "http://a/g", "/g" },
+    { "http://a/b/c/d;p?q", "http://a/", "/" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/", "." },
+    { "http://a/b/c/d;p?q", "http://a/b/c/d;p?q", "" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/d;p?y", "?y" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/d;p", "d;p" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/d;p?q#s", "#s" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/g?y#s", "g?y#s" },
+    { "http://a/b/c/d;p?q", "http://a/b/c//g", ".//g" },
+    { "http://a/b/c/d;p?q", "http://a/b/c/g:h", "g%3Ah" },
+    { "http://a/b/c/d;p?q", "http://a/b/./c/../c/g", "g" },
+    { "http://a/b/c/d;p?q", "HTTP://A:80/b/c/g", "g" },
+    { "http://a/b/c/d;p?q", "http://g/x", "//g/x" },
+    { "http://a/b/c/d;p?q", "https://a/b/c/g", "https://a/b/c/g" },
+    { "http://a/b/c/?q", "http://a/b/c/", "." },
+    { "http://a?q", "http://a/", "/" },
+    { "http://a", "http://a/x/y", "x/y" },
+    { "http://a/b/../c", "http://a/c/d", "/c/d" },
+    { "foo:x/y", "foo:x/z", "z" },
+    { "foo:x/y", "foo:z", "../z" },
+    { "foo:x/y", "foo:/z", "/z" },
+    { "foo:/x", "foo:z", "foo:z" },
+  };
+
+  for (const auto &testVector : testVectors) {
+    INFO("Base: " + testVector.base + " Target: " + testVector.target);
+    Uri::Uri base;
+    Uri::Uri target;
+    REQUIRE(base.ParseFromString(testVector.base));
+    REQUIRE(target.ParseFromString(testVector.target));
+
+    const auto reference = base.MakeRelative(target);
+    REQUIRE(reference.GenerateString() == testVector.reference);
+    REQUIRE(base.Resolve(reference) == target);
+  }
+}
+
+TEST_CASE("Make relative references resolve back to the target", "[Uri]")
+{
+  // Targets are made of random paths, so that every way two paths can part
+  // is taken, and the same seed keeps the run reproducible
+  const std::vector<std::string> bases{
+    "http://a/b/c/d;p?q",
+    "http://a",
+    "http://a/",
+    "http://u@a:8080/b/c/?q",
+    "http://a/b//c/",
+    "http://a/b/../c",
+    "foo:x/y/z",
+    "foo:x?q",
+    "foo:/x/y",
+    "foo:",
+    "foo:?q",
+  };
+  const std::vector<std::string> prefixes{
+    "http://a", "http://a:8080", "http://u@a:8080", "http://b", "https://a", "foo:", "foo:/"
+  };
+  const std::vector<std::string> segments{ "b", "c", "d;p", "", ".", "..", "g:h", "%20" };
+  const std::vector<std::string> suffixes{ "", "?q", "?y", "#s", "?q#s", "?" };
+
+  std::mt19937 generator(42);// NOLINT
+  const auto pick = [&generator](const std::vector<std::string> &choices) {
+    return choices[std::uniform_int_distribution<size_t>(0, choices.size() - 1)(generator)];
+  };
+
+  Uri::Uri base;
+  Uri::Uri target;
+  Uri::Uri reference_from_string;
+  for (size_t round = 0; round < 20000; ++round) {
+    const auto prefix = pick(prefixes);
+    std::string target_string = prefix;
+    const auto segment_count = std::uniform_int_distribution<size_t>(0, 4)(generator);
+    for (size_t index = 0; index < segment_count; ++index) {
+      if (index > 0 || prefix.back() != ':') { target_string += "/"; }
+      target_string += pick(segments);
+    }
+    target_string += pick(suffixes);
+    const auto &base_string = pick(bases);
+
+    INFO("Base: " + base_string + " Target: " + target_string);
+    REQUIRE(base.ParseFromString(base_string));
+    if (!target.ParseFromString(target_string)) { continue; }
+
+    const auto reference = base.MakeRelative(target);
+    REQUIRE(base.Resolve(reference) == target);
+    REQUIRE(reference_from_string.ParseFromString(reference.GenerateString()));
+    REQUIRE(base.Resolve(reference_from_string) == target);
+  }
+}
+
 TEST_CASE("Empty path in Uri whit authority is equivalent to slash only path",// NOLINT
   "Uri")
 {
@@ -737,7 +970,7 @@ TEST_CASE("Parsing IPv6Address URI", "Uri")
 
   for (const auto &test_vector : test_vectors) {
     Uri::Uri uri;
-    const bool parse_result = uri.ParseFromString(test_vector.uri_string);
+    const bool parse_result = static_cast<bool>(uri.ParseFromString(test_vector.uri_string));
 
     INFO(test_vector.uri_string);
     REQUIRE(test_vector.is_valid == parse_result);
@@ -746,6 +979,55 @@ TEST_CASE("Parsing IPv6Address URI", "Uri")
   }
 }
 
+TEST_CASE("Parsing IP literal hosts into binary form", "Uri")
+{
+  Uri::Uri uri;
+
+  REQUIRE(uri.ParseFromString("http://[2001:DB8::1]:8080/"));
+  REQUIRE(Uri::HostKind::ipv6 == uri.GetHostKind());
+  REQUIRE("2001:db8::1" == uri.GetHost());
+  REQUIRE(uri.HasPort());
+  REQUIRE(8080 == uri.GetPort());
+  const auto ipv6_address = uri.GetIpv6Address();
+  REQUIRE(0x20 == ipv6_address.s6_addr[0]);
+  REQUIRE(0x01 == ipv6_address.s6_addr[1]);
+  REQUIRE(0x0d == ipv6_address.s6_addr[2]);
+  REQUIRE(0xb8 == ipv6_address.s6_addr[3]);
+  REQUIRE(0x01 == ipv6_address.s6_addr[15]);
+
+  REQUIRE(uri.ParseFromString("http://192.168.0.1:80/"));
+  REQUIRE(Uri::HostKind::ipv4 == uri.GetHostKind());
+  const auto ipv4_address = uri.GetIpv4Address();
+  const auto *octets = reinterpret_cast<const uint8_t *>(&ipv4_address.s_addr);// NOLINT
+  REQUIRE(192 == octets[0]);
+  REQUIRE(168 == octets[1]);
+  REQUIRE(0 == octets[2]);
+  REQUIRE(1 == octets[3]);
+
+  REQUIRE(uri.ParseFromString("http://[v7.aB]/"));
+  REQUIRE(Uri::HostKind::ipv_future == uri.GetHostKind());
+  REQUIRE("http://[v7.aB]/" == uri.GenerateString());
+
+  REQUIRE(uri.ParseFromString("http://www.example.com/"));
+  REQUIRE(Uri::HostKind::reg_name == uri.GetHostKind());
+
+  REQUIRE(uri.ParseFromString("http://1.2.3.4.example.com/"));
+  REQUIRE(Uri::HostKind::reg_name == uri.GetHostKind());
+
+  REQUIRE_FALSE(uri.ParseFromString("http://[::1]x:80/"));
+}
+
+TEST_CASE("Generating a string does not change the host", "Uri")
+{
+  Uri::Uri uri;
+
+  uri.SetScheme("http");
+  uri.SetHost("FFFF::1");
+  REQUIRE(Uri::HostKind::ipv6 == uri.GetHostKind());
+  REQUIRE("http://[ffff::1]" == uri.GenerateString());
+  REQUIRE("FFFF::1" == uri.GetHost());
+}
+
 TEST_CASE("Generate String from URI", "Uri")
 {
   struct TestVector
@@ -987,3 +1269,213 @@ TEST_CASE("Generate String from URI with percent encoded character ", "Uri")
     REQUIRE(test_vector.uri_string == uri.GenerateString());
   }
 }
+
+TEST_CASE("Generated string parses back to an equivalent uri", "[Uri]")
+{
+  const std::vector<std::string> test_vectors{
+    "%3Afoo/bar",
+    "////foo",
+    "?a:b",
+    "foo#bar?baz",
+    "#x:y",
+    "%C3%A9t%C3%A9",
+    "http://www.example.com?a/b",
+    "http://www.ex%3Aample.com/",
+    "a/..",
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    Uri::Uri uri;
+    INFO(test_vector);
+    REQUIRE(uri.ParseFromString(test_vector));
+
+    const auto generated = uri.GenerateString();
+    INFO(generated);
+    Uri::Uri reparsed;
+    REQUIRE(reparsed.ParseFromString(generated));
+    REQUIRE(reparsed == uri);
+  }
+}
+
+TEST_CASE("Canonical string is the same for equal uris", "[Uri]")
+{
+  struct TestVector
+  {
+    std::string uri_string;
+    std::string canonical;
+  };
+  const std::vector<TestVector> test_vectors{
+    { "HTTP://Example.COM:80/a/./b", "http://example.com/a/b" },
+    { "http://example.com", "http://example.com/" },
+    { "https://example.com:443?q#f", "https://example.com/?q#f" },
+    { "https://example.com:80/", "https://example.com:80/" },
+    { "http://user@[FFFF:0:0::1]:8080/x/../y", "http://user@[ffff::1]:8080/y" },
+    { "foo:a/./b/..", "foo:a/" },
+    { "a/../b", "b" },
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    Uri::Uri uri;
+    INFO(test_vector.uri_string);
+    REQUIRE(uri.ParseFromString(test_vector.uri_string));
+    REQUIRE(uri.GenerateCanonicalString() == test_vector.canonical);
+
+    Uri::Uri reparsed;
+    REQUIRE(reparsed.ParseFromString(test_vector.canonical));
+    REQUIRE(reparsed == uri);
+    REQUIRE(reparsed.GetHash() == uri.GetHash());
+    REQUIRE(reparsed.GenerateCanonicalString() == test_vector.canonical);
+  }
+}
+
+TEST_CASE("Question mark in fragment is not a query", "[Uri]")
+{
+  Uri::Uri uri;
+  REQUIRE(uri.ParseFromString("foo#bar?baz"));
+  REQUIRE_FALSE(uri.HasQuery());
+  REQUIRE(uri.GetFragment() == "bar?baz");
+  REQUIRE(uri.GetScheme().empty());
+
+  REQUIRE(uri.ParseFromString("http://www.example.com?a/b"));
+  REQUIRE(uri.GetHost() == "www.example.com");
+  REQUIRE(uri.GetQuery() == "a/b");
+}
+
+TEST_CASE("Parse errors tell the reason and the offset", "[Uri]")
+{
+  struct TestVector
+  {
+    std::string uri_string;
+    Uri::ParseError error;
+    size_t offset;
+  };
+  const std::vector<TestVector> test_vectors{
+    { "http://www.example.com/", Uri::ParseError::none, 0 },
+    { "ht_tp://www.example.com/", Uri::ParseError::invalid_scheme, 2 },
+    { ":foo", Uri::ParseError::invalid_scheme, 0 },
+    { "http://b{b@www.example.com/", Uri::ParseError::invalid_user_info, 8 },
+    { "http://bob@www.exa mple.com/", Uri::ParseError::invalid_host, 18 },
+    { "http://www.example.com%4/", Uri::ParseError::invalid_host, 22 },
+    { "http://[::g]/", Uri::ParseError::invalid_host, 7 },
+    { "http://www.example.com:8x/", Uri::ParseError::invalid_port, 23 },
+    { "http://bob@[::1]:99999/", Uri::ParseError::invalid_port, 17 },
+    { "http://www.example.com/foo/b[r", Uri::ParseError::invalid_path, 28 },
+    { "/foo/%zz", Uri::ParseError::invalid_path, 6 },
+    { "foo/bar%2", Uri::ParseError::invalid_path, 7 },
+    { "http://www.example.com/?a b", Uri::ParseError::invalid_query, 25 },
+    { "http://www.example.com/?ab#c d", Uri::ParseError::invalid_fragment, 28 },
+    { "?q#%", Uri::ParseError::invalid_fragment, 3 },
+  };
+
+  for (const auto &test_vector : test_vectors) {
+    Uri::Uri uri;
+    INFO(test_vector.uri_string);
+    const auto result = uri.ParseFromString(test_vector.uri_string);
+    REQUIRE(static_cast<bool>(result) == (test_vector.error == Uri::ParseError::none));
+    REQUIRE(result.error == test_vector.error);
+    REQUIRE(result.offset == test_vector.offset);
+  }
+
+  REQUIRE(Uri::ToString(Uri::ParseError::invalid_port) == "invalid port");
+}
+
+TEST_CASE("Parse IRIs holding UTF-8 characters", "[Uri]")
+{
+  Uri::Uri iri;
+  Uri::Uri uri;
+  REQUIRE(iri.ParseFromIriString("http://r\xC3\xA9sum\xC3\xA9.example.org"
+                                 "/caf\xC3\xA9/\xE2\x82\xAC?q=\xF0\x9F\x98\x80#\xC3\xA9"));
+  REQUIRE(iri.GetHost() == "r\xC3\xA9sum\xC3\xA9.example.org");
+  REQUIRE(iri.GetPath() == std::vector<std::string>{ "", "caf\xC3\xA9", "\xE2\x82\xAC" });
+  REQUIRE(iri.GetQuery() == "q=\xF0\x9F\x98\x80");
+  REQUIRE(iri.GetFragment() == "\xC3\xA9");
+  REQUIRE(iri.GenerateString()
+          == "http://r%C3%A9sum%C3%A9.example.org/caf%C3%A9/%E2%82%AC?q=%F0%9F%98%80#%C3%A9");
+  REQUIRE(uri.ParseFromString(iri.GenerateString()));
+  REQUIRE(uri == iri);
+
+  // Only IRIs may hold characters that are not ASCII
+  REQUIRE(uri.ParseFromString("http://a/caf\xC3\xA9").error == Uri::ParseError::invalid_path);
+
+  // IRIs that are all ASCII are parsed as URIs
+  REQUIRE(iri.ParseFromIriString("http://a/b?c#d"));
+  REQUIRE(uri.ParseFromString("http://a/b?c#d"));
+  REQUIRE(iri == uri);
+  REQUIRE(iri.ParseFromIriString("http://a/b c") == uri.ParseFromString("http://a/b c"));
+}
+
+TEST_CASE("Hosts of IRIs are normalized to their ASCII form", "[Uri]")
+{
+  Uri::Uri iri;
+  Uri::Uri uri;
+  REQUIRE(iri.ParseFromIriString("http://B\xC3\xBC"
+                                 "cher.Example/caf\xC3\xA9"));
+  REQUIRE(uri.ParseFromString("http://xn--bcher-kva.example/caf%C3%A9"));
+  REQUIRE_FALSE(iri == uri);
+  REQUIRE(iri.NormalizeHost() == Uri::IdnaError::none);
+  REQUIRE(iri.GetHost() == "xn--bcher-kva.example");
+  REQUIRE(iri == uri);
+  REQUIRE(iri.GetHash() == uri.GetHash());
+  REQUIRE(iri.GenerateString() == "http://xn--bcher-kva.example/caf%C3%A9");
+
+  // Hosts that can not be converted and IP addresses are left as they are
+  REQUIRE(uri.ParseFromString("http://a..b/"));
+  REQUIRE(uri.NormalizeHost() == Uri::IdnaError::empty_label);
+  REQUIRE(uri.GetHost() == "a..b");
+  REQUIRE(uri.ParseFromString("http://[::1]/"));
+  REQUIRE(uri.NormalizeHost() == Uri::IdnaError::none);
+  REQUIRE(uri.GetHost() == "::1");
+}
+
+TEST_CASE("Bad IRIs tell the reason and the offset", "[Uri]")
+{
+  struct TestVector
+  {
+    std::string iri;
+    Uri::ParseError error;
+    size_t offset;
+  };
+  const std::vector<TestVector> testVectors{
+    { "http://a/caf\xC3", Uri::ParseError::invalid_utf8, 12 },
+    { "http://a/\xC0\xAF", Uri::ParseError::invalid_utf8, 9 },
+    { "http://a/\xED\xA0\x80", Uri::ParseError::invalid_utf8, 9 },
+    { "http://a/\xC2\x85", Uri::ParseError::invalid_utf8, 9 },
+    { "http://a/\xEE\x80\x80", Uri::ParseError::invalid_utf8, 9 },
+    { "http://a/caf\xC3\xA9 b", Uri::ParseError::invalid_path, 14 },
+    { "http://\xC3\xA9:8x/", Uri::ParseError::invalid_port, 10 },
+    { "http://a/?\xEE\x80\x80#\xC3\xA9{", Uri::ParseError::invalid_fragment, 16 },
+  };
+
+  Uri::Uri iri;
+  for (const auto &testVector : testVectors) {
+    INFO("IRI: " + testVector.iri);
+    const auto result = iri.ParseFromIriString(testVector.iri);
+    REQUIRE(result.error == testVector.error);
+    REQUIRE(result.offset == testVector.offset);
+  }
+  REQUIRE(Uri::ToString(Uri::ParseError::invalid_utf8) == "invalid UTF-8");
+}
+
+TEST_CASE("Parsing again replaces every component", "[Uri]")
+{
+  Uri::Uri uri;
+  REQUIRE(uri.ParseFromString("http://user@[::1]:8080/a/b/c?q#f"));
+  REQUIRE(uri.ParseFromString("/x"));
+  REQUIRE(uri.GetScheme().empty());
+  REQUIRE(uri.GetUserName().empty());
+  REQUIRE(uri.GetHost().empty());
+  REQUIRE(uri.GetHostKind() == Uri::HostKind::reg_name);
+  REQUIRE_FALSE(uri.HasPort());
+  REQUIRE(uri.GetPath() == std::vector<std::string>{ "", "x" });
+  REQUIRE_FALSE(uri.HasQuery());
+  REQUIRE_FALSE(uri.HasFragment());
+
+  REQUIRE(uri.ParseFromString("https://www.example.com/%7Euser/a%20b?x=%41"));
+  REQUIRE(uri.GetPath() == std::vector<std::string>{ "", "~user", "a b" });
+  REQUIRE(uri.GetQuery() == "x=A");
+
+  uri.Reset();
+  REQUIRE(uri == Uri::Uri());
+  REQUIRE(uri.GetHash() == Uri::Uri().GetHash());
+  REQUIRE(uri.GetPath().empty());
+}
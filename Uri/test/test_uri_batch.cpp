@@ -0,0 +1,111 @@
+#include "../headers/uri.hpp"
+#include "../headers/uri_batch.hpp"
+#include <catch2/catch.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("Parse batch splits components", "UriBatch")
+{
+  const std::vector<std::string_view> inputs{
+    "http://bob@www.example.com:8080/foo/bar?baz#ch2",
+    "//[::1]:443/",
+    "foo/bar",
+    "https://www.example.com?#",
+    "https://[v7.aB]/x",
+  };
+
+  Uri::BatchParseResults results;
+  Uri::ParseBatch(inputs, results);
+
+  REQUIRE(inputs.size() == results.Size());
+  for (size_t index = 0; index < inputs.size(); ++index) {
+    INFO(inputs[index]);
+    REQUIRE(results.valid[index] == 1);
+    REQUIRE(results.errors[index] == Uri::BatchParseError::none);
+  }
+
+  REQUIRE("http" == results.scheme.Get(inputs[0], 0));
+  REQUIRE("bob" == results.user_info.Get(inputs[0], 0));
+  REQUIRE("www.example.com" == results.host.Get(inputs[0], 0));
+  REQUIRE("8080" == results.port.Get(inputs[0], 0));
+  REQUIRE("/foo/bar" == results.path.Get(inputs[0], 0));
+  REQUIRE("baz" == results.query.Get(inputs[0], 0));
+  REQUIRE("ch2" == results.fragment.Get(inputs[0], 0));
+
+  REQUIRE_FALSE(results.scheme.IsPresent(1));
+  REQUIRE("[::1]" == results.host.Get(inputs[1], 1));
+  REQUIRE("443" == results.port.Get(inputs[1], 1));
+  REQUIRE("/" == results.path.Get(inputs[1], 1));
+
+  REQUIRE_FALSE(results.scheme.IsPresent(2));
+  REQUIRE_FALSE(results.host.IsPresent(2));
+  REQUIRE("foo/bar" == results.path.Get(inputs[2], 2));
+  REQUIRE_FALSE(results.query.IsPresent(2));
+
+  REQUIRE(results.query.IsPresent(3));
+  REQUIRE(results.query.Get(inputs[3], 3).empty());
+  REQUIRE(results.fragment.IsPresent(3));
+  REQUIRE(results.fragment.Get(inputs[3], 3).empty());
+
+  REQUIRE("[v7.aB]" == results.host.Get(inputs[4], 4));
+  REQUIRE_FALSE(results.port.IsPresent(4));
+}
+
+TEST_CASE("Parse batch flags invalid inputs", "UriBatch")
+{
+  const std::vector<std::string_view> inputs{
+    "http://www.example.com/",
+    "http://www.example.com:false/",
+    "ht%tp://www.example.com/",
+    "/foo/bar",
+  };
+
+  Uri::BatchParseResults results;
+  Uri::ParseBatch(inputs, results);
+
+  REQUIRE(results.valid == std::vector<uint8_t>{ 1, 0, 0, 1 });
+  REQUIRE(results.errors[1] == Uri::BatchParseError::invalid);
+  REQUIRE(results.errors[2] == Uri::BatchParseError::invalid);
+  REQUIRE(results.parse_errors[0] == Uri::ParseError::none);
+  REQUIRE(results.parse_errors[1] == Uri::ParseError::invalid_port);
+  REQUIRE(results.error_offsets[1] == 23);
+  REQUIRE(results.parse_errors[2] == Uri::ParseError::invalid_scheme);
+  REQUIRE(results.error_offsets[2] == 2);
+  REQUIRE_FALSE(results.host.IsPresent(1));
+}
+
+TEST_CASE("Parse batch in parallel gives the same results", "UriBatch")
+{
+  const std::vector<std::string> patterns{
+    "http://www.example.com/foo/bar?q=1",
+    "https://bob@[::ffff:1.2.3.4]:8443/",
+    "mailto:bob@example.com",
+    "http://www.example.com:99999/",
+    "../a/b#frag",
+  };
+
+  std::vector<std::string> storage;
+  const size_t batch_size = 10000;
+  storage.reserve(batch_size);
+  for (size_t index = 0; index < batch_size; ++index) {
+    storage.push_back(patterns[index % patterns.size()] + std::to_string(index));
+  }
+  const std::vector<std::string_view> inputs(storage.begin(), storage.end());
+
+  Uri::BatchParseResults sequential;
+  Uri::BatchParseResults parallel;
+  Uri::ParseBatch(inputs, sequential, 1);
+  Uri::ParseBatch(inputs, parallel, 4);
+
+  REQUIRE(sequential.valid == parallel.valid);
+  REQUIRE(sequential.errors == parallel.errors);
+  REQUIRE(sequential.host.begin == parallel.host.begin);
+  REQUIRE(sequential.path.length == parallel.path.length);
+  REQUIRE(sequential.fragment.begin == parallel.fragment.begin);
+
+  for (size_t index = 0; index < batch_size; ++index) {
+    Uri::Uri uri;
+    REQUIRE(static_cast<bool>(uri.ParseFromString(storage[index])) == (parallel.valid[index] == 1));
+  }
+}
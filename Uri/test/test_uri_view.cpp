@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include "../headers/uri_view.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Uri::Literals;
+
+namespace {
+
+// Literals are parsed when the program is built and need no construction
+constinit Uri::UriView api_base = "https://api.example.com:8443/v1/?key=a%20b#top"_uri;
+
+}// namespace
+
+TEST_CASE("URI literals are parsed at compile time", "[UriView]")
+{
+  constexpr auto uri = "http://user@[::ffff:1.2.3.4]:80/a/b%2F?q#f"_uri;
+  static_assert(uri.GetScheme() == "http");
+  static_assert(uri.GetUserName() == "user");
+  static_assert(uri.GetHost() == "::ffff:1.2.3.4");
+  static_assert(uri.GetHostKind() == Uri::HostKind::ipv6);
+  static_assert(uri.HasPort() && uri.GetPort() == 80);
+  static_assert(uri.GetPath() == "/a/b%2F");
+  static_assert(uri.HasQuery() && uri.GetQuery() == "q");
+  static_assert(uri.HasFragment() && uri.GetFragment() == "f");
+
+  constexpr auto relative = "../a?"_uri;
+  static_assert(relative.IsRelativeReference() && !relative.HasAuthority());
+  static_assert(relative.GetPath() == "../a" && relative.HasQuery() && !relative.HasFragment());
+
+  // Strings that are not valid URIs would not compile as literals
+  static_assert(Uri::UriView().ParseFromString("http://a b/")
+                == Uri::ParseResult{ Uri::ParseError::invalid_host, 8 });
+  static_assert(!Uri::UriView().ParseFromString("http://a:65536/"));
+
+  REQUIRE(api_base.GetHost() == "api.example.com");
+  REQUIRE(api_base.GetPort() == 8443);
+  REQUIRE(api_base.GetQuery() == "key=a%20b");
+
+  // The string of a view is a valid Uri
+  Uri::Uri parsed;
+  REQUIRE(parsed.ParseFromString(std::string(api_base.GetString())));
+  REQUIRE(parsed.GetQuery() == "key=a b");
+}
+
+TEST_CASE("Views accept the same strings as Uri, with the same errors", "[UriView]")
+{
+  const std::vector<std::string> testVectors{
+    "",
+    "http://www.example.com/foo/bar",
+    "HTTP://a:/",
+    "http://a:0080/",
+    "http://[v7.:x]/",
+    "http://[v7.]/",
+    "http://[vz.a]/",
+    "http://[1:2:3:4:5:6:7:8:9]/",
+    "http://[::1/",
+    "http://[]:80/",
+    "http://a%4/b",
+    "http://a/b%4/c",
+    "http://a/b%zz",
+    "//a@b@c/",
+    "1http://a/",
+    "a:b:c",
+    "mailto:joe@example.com",
+    "?a#b?c#d",
+    "/a[b]",
+    "http://a/?q%",
+  };
+  Uri::Uri uri;
+  Uri::UriView view;
+  for (const auto &testVector : testVectors) {
+    INFO("URI: " + testVector);
+    REQUIRE(view.ParseFromString(testVector) == uri.ParseFromString(testVector));
+  }
+
+  // Random strings made of the characters that matter to the grammar
+  const std::string alphabet = "ab1F:/?#[]@%.v-+ ";
+  std::mt19937 generator(42);// NOLINT
+  std::uniform_int_distribution<size_t> length(0, 16);
+  std::uniform_int_distribution<size_t> character(0, alphabet.size() - 1);
+  for (int round = 0; round < 20000; ++round) {
+    std::string candidate;
+    for (auto remaining = length(generator); remaining > 0; --remaining) {
+      candidate.push_back(alphabet[character(generator)]);
+    }
+    if (round % 2 == 0) { candidate.insert(0, "http://"); }
+
+    INFO("URI: " + candidate);
+    const auto result = view.ParseFromString(candidate);
+    REQUIRE(result == uri.ParseFromString(candidate));
+    if (!result) { continue; }
+    REQUIRE(view.IsRelativeReference() == uri.IsRelativeReference());
+    REQUIRE(view.GetHostKind() == uri.GetHostKind());
+    REQUIRE(view.HasPort() == uri.HasPort());
+    if (view.HasPort()) { REQUIRE(view.GetPort() == uri.GetPort()); }
+    REQUIRE(view.HasQuery() == uri.HasQuery());
+    REQUIRE(view.HasFragment() == uri.HasFragment());
+  }
+}
@@ -0,0 +1,144 @@
+#include <catch2/catch.hpp>
+
+#include "../src/utf8.hpp"
+
+#include <initializer_list>
+#include <string>
+
+namespace {
+
+/*
+ * This function writes the code point in UTF-8, without checking it, so
+ * that surrogates can be written too
+ */
+std::string EncodeUtf8(char32_t code_point)
+{
+  std::string encoded;
+  const auto byte = [](char32_t value) { return static_cast<char>(value); };
+  if (code_point < 0x80) {
+    encoded.push_back(byte(code_point));
+  } else if (code_point < 0x800) {
+    encoded.push_back(byte(0xC0 | (code_point >> 6)));
+    encoded.push_back(byte(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    encoded.push_back(byte(0xE0 | (code_point >> 12)));
+    encoded.push_back(byte(0x80 | ((code_point >> 6) & 0x3F)));
+    encoded.push_back(byte(0x80 | (code_point & 0x3F)));
+  } else {
+    encoded.push_back(byte(0xF0 | (code_point >> 18)));
+    encoded.push_back(byte(0x80 | ((code_point >> 12) & 0x3F)));
+    encoded.push_back(byte(0x80 | ((code_point >> 6) & 0x3F)));
+    encoded.push_back(byte(0x80 | (code_point & 0x3F)));
+  }
+  return encoded;
+}
+
+}// namespace
+
+TEST_CASE("The first byte that is not ASCII is found", "[Utf8]")
+{
+  // Long enough to go through the vector loop and the scalar tail
+  const std::string ascii(40, 'a');
+  REQUIRE(Uri::FindNonAscii(ascii) == std::string::npos);
+  REQUIRE(Uri::FindNonAscii("") == std::string::npos);
+
+  for (size_t position = 0; position + 1 < ascii.size(); ++position) {
+    auto input = ascii;
+    input[position] = '\x80';
+    input.back() = '\xFF';
+    INFO(position);
+    REQUIRE(Uri::FindNonAscii(input) == position);
+    REQUIRE(Uri::FindNonAscii(input, position + 1) == input.size() - 1);
+  }
+}
+
+TEST_CASE("Every code point decodes and nothing else does", "[Utf8]")
+{
+  for (char32_t code_point = 0; code_point <= 0x10FFFF; ++code_point) {
+    const auto encoded = EncodeUtf8(code_point);
+    char32_t decoded = 0;
+    const bool is_surrogate = code_point >= 0xD800 && code_point <= 0xDFFF;
+    if (is_surrogate) {
+      REQUIRE(Uri::DecodeUtf8(encoded, 0, decoded) == 0);
+    } else if (Uri::DecodeUtf8(encoded, 0, decoded) != encoded.size() || decoded != code_point) {
+      FAIL("Code point " << static_cast<uint32_t>(code_point) << " did not decode");
+    }
+  }
+
+  const std::vector<std::string> malformed{
+    "\x80",
+    "\xBF",
+    "\xC0\xAF",
+    "\xC1\xBF",
+    "\xE0\x80\xAF",
+    "\xF0\x80\x80\xAF",
+    "\xF4\x90\x80\x80",
+    "\xF8\x88\x80\x80\x80",
+    "\xFF",
+    "\xC3",
+    "\xE2\x82",
+    "\xC3\x28",
+    "\xE2\x28\xA1",
+  };
+  for (const auto &sequence : malformed) {
+    char32_t decoded = 0;
+    REQUIRE(Uri::DecodeUtf8(sequence, 0, decoded) == 0);
+  }
+}
+
+TEST_CASE("Invalid UTF-8 is found in long text", "[Utf8]")
+{
+  const std::string text =
+    "plain ASCII text, then caf\xC3\xA9 and \xE2\x82\xAC and \xF0\x9F\x98\x80";
+  REQUIRE(Uri::FindInvalidUtf8(text) == std::string::npos);
+  REQUIRE(Uri::FindInvalidUtf8(text + "\xF0\x9F\x98") == text.size());
+  REQUIRE(Uri::FindInvalidUtf8(text + "\xED\xA0\x80 more") == text.size());
+}
+
+TEST_CASE("Only IRI characters may be held by IRIs", "[Utf8]")
+{
+  REQUIRE(Uri::IsIriCharacter(U'é', false));
+  REQUIRE(Uri::IsIriCharacter(U'\U0001F600', false));
+  REQUIRE(Uri::IsIriCharacter(U'\U000E1000', false));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0x85, false));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0xFDD0, false));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0xFFFE, false));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0x1FFFF, false));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0xE0001, false));
+
+  // Private use characters may only be in the query
+  REQUIRE_FALSE(Uri::IsIriCharacter(0xE000, false));
+  REQUIRE(Uri::IsIriCharacter(0xE000, true));
+  REQUIRE(Uri::IsIriCharacter(0x10FFFD, true));
+  REQUIRE_FALSE(Uri::IsIriCharacter(0x10FFFF, true));
+}
+
+TEST_CASE("IRIs are mapped to URIs in one pass", "[Utf8]")
+{
+  std::string uri;
+  REQUIRE(Uri::MapIriToUri("http://example.com/a", uri) == std::string::npos);
+  REQUIRE(uri == "http://example.com/a");
+
+  const std::string iri = "http://r\xC3\xA9sum\xC3\xA9.example/\xE2\x82\xAC?\xEE\x80\x80#x";
+  REQUIRE(Uri::MapIriToUri(iri, uri) == std::string::npos);
+  REQUIRE(uri == "http://r%C3%A9sum%C3%A9.example/%E2%82%AC?%EE%80%80#x");
+  REQUIRE(Uri::IriOffset(iri, uri.find("%E2")) == iri.find('\xE2'));
+  REQUIRE(Uri::IriOffset(iri, uri.find("%E2") + 4) == iri.find('\xE2') + 1);
+  REQUIRE(Uri::IriOffset(iri, uri.find('?')) == iri.find('?'));
+
+  // Private use characters may not be in the path or the fragment
+  REQUIRE(Uri::MapIriToUri("http://a/\xEE\x80\x80", uri) == 9);
+  REQUIRE(Uri::MapIriToUri("http://a/?#\xEE\x80\x80", uri) == 11);
+  REQUIRE(Uri::MapIriToUri("http://a/caf\xC3", uri) == 12);
+}
+
+TEST_CASE("Code points are written in UTF-8", "[Utf8]")
+{
+  std::string text;
+  for (const auto code_point : std::initializer_list<char32_t>{
+         0x24, 0x7F, 0xA2, 0x7FF, 0x20AC, 0xFFFD, 0x10348, 0x10FFFF }) {
+    text.clear();
+    Uri::AppendUtf8(text, code_point);
+    REQUIRE(text == EncodeUtf8(code_point));
+  }
+}
@@ -0,0 +1,39 @@
+#include "../headers/validation_policy.hpp"
+#include <catch2/catch.hpp>
+
+static_assert(Uri::Matches<Uri::SchemePolicy>("http"));
+static_assert(Uri::FailsMatch<Uri::SchemePolicy>("1http"));
+static_assert(Uri::Matches<Uri::RegNamePolicy>(""));
+
+TEST_CASE("Scheme policy", "[ValidationPolicy]")
+{
+  REQUIRE(Uri::Matches<Uri::SchemePolicy>("h"));
+  REQUIRE(Uri::Matches<Uri::SchemePolicy>("x+y-z.1"));
+  REQUIRE(Uri::Matches<Uri::SchemePolicy>("HTTP"));
+  REQUIRE_FALSE(Uri::Matches<Uri::SchemePolicy>(""));
+  REQUIRE_FALSE(Uri::Matches<Uri::SchemePolicy>("+http"));
+  REQUIRE_FALSE(Uri::Matches<Uri::SchemePolicy>("ht_tp"));
+  REQUIRE_FALSE(Uri::Matches<Uri::SchemePolicy>("ht tp"));
+}
+
+TEST_CASE("Character class policies", "[ValidationPolicy]")
+{
+  REQUIRE(Uri::Matches<Uri::UserInfoPolicy>("bob:secret"));
+  REQUIRE_FALSE(Uri::Matches<Uri::UserInfoPolicy>("bob@host"));
+  REQUIRE(Uri::Matches<Uri::RegNamePolicy>("www.example.com"));
+  REQUIRE_FALSE(Uri::Matches<Uri::RegNamePolicy>("www.exa mple.com"));
+  REQUIRE(Uri::Matches<Uri::PathSegmentPolicy>("a@b:c"));
+  REQUIRE_FALSE(Uri::Matches<Uri::PathSegmentPolicy>("a/b"));
+  REQUIRE(Uri::Matches<Uri::QueryOrFragmentPolicy>("a/b?c"));
+  REQUIRE_FALSE(Uri::Matches<Uri::QueryOrFragmentPolicy>("a#b"));
+}
+
+TEST_CASE("First mismatch position", "[ValidationPolicy]")
+{
+  REQUIRE(Uri::FirstMismatch<Uri::SchemePolicy>("http") == std::string_view::npos);
+  REQUIRE(Uri::FirstMismatch<Uri::SchemePolicy>("") == 0);
+  REQUIRE(Uri::FirstMismatch<Uri::SchemePolicy>("1http") == 0);
+  REQUIRE(Uri::FirstMismatch<Uri::SchemePolicy>("ht_tp") == 2);
+  REQUIRE(Uri::FirstMismatch<Uri::RegNamePolicy>("") == std::string_view::npos);
+  REQUIRE(Uri::FirstMismatch<Uri::RegNamePolicy>("www.exa mple.com") == 7);
+}
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""Writes Uri/src/idna_tables.hpp from the IDNA mapping table of UTS #46.
+
+The mapping table folds the case folding and compatibility normalization
+of Unicode (NFKC_Casefold) into one status per code point, and is published
+with every version of Unicode as IdnaMappingTable.txt, for instance at
+https://www.unicode.org/Public/idna/15.1.0/IdnaMappingTable.txt. The joining
+types, which tell where a zero width non-joiner may be, come from
+extracted/DerivedJoiningType.txt of the Unicode Character Database. The
+tables of normalization form C come from the unicodedata module of Python,
+which has to be for the same version of Unicode as the other two, so pick
+the version of Python to match. Run it from the root of the repository:
+
+    python3 Uri/tools/generate_idna_tables.py IdnaMappingTable.txt \\
+        DerivedJoiningType.txt > Uri/src/idna_tables.hpp
+
+The tables are for nontransitional processing, so the deviations (sharp s,
+final sigma and the zero width joiners) are kept, and for hosts of URIs
+rather than of DNS only (UseSTD3ASCIIRules false), so the characters that
+STD3 disallows are taken as valid or mapped and left to the URI grammar.
+"""
+
+import re
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+WIDTH = 100
+
+VALID = "valid"
+MAPPED = "mapped"
+IGNORED = "ignored"
+DISALLOWED = "disallowed"
+
+STATUSES = {
+    "valid": VALID,
+    "deviation": VALID,
+    "disallowed_STD3_valid": VALID,
+    "mapped": MAPPED,
+    "disallowed_STD3_mapped": MAPPED,
+    "ignored": IGNORED,
+    "disallowed": DISALLOWED,
+}
+
+
+def read_table(path):
+    """Returns the version of the table and the status and mapping of every
+    code point, as nontransitional processing without STD3 rules takes them"""
+    version = None
+    statuses = [DISALLOWED] * (MAX_CODE_POINT + 1)
+    mappings = {}
+    with open(path, encoding="utf-8") as table:
+        for line in table:
+            found = re.match(r"#\s*Version:\s*(\S+)", line)
+            if found:
+                version = found.group(1)
+            fields = [field.strip() for field in line.split("#", 1)[0].split(";")]
+            if len(fields) < 2:
+                continue
+            first, _, last = fields[0].partition("..")
+            first = int(first, 16)
+            last = int(last, 16) if last else first
+            status = STATUSES[fields[1]]
+            for code_point in range(first, last + 1):
+                statuses[code_point] = status
+                if status == MAPPED:
+                    mappings[code_point] = [int(each, 16) for each in fields[2].split()]
+    return version, statuses, mappings
+
+
+def read_joining_types(path, statuses):
+    """Returns the version of the file and the ranges of the code points
+    that are valid once mapped and join as the rule for the zero width
+    non-joiner of RFC 5892 (appendix A.1) needs: left, dual, right or
+    transparent"""
+    version = None
+    types = {}
+    with open(path, encoding="utf-8") as table:
+        for line in table:
+            found = re.match(r"#\s*DerivedJoiningType-(\S+)\.txt", line)
+            if found:
+                version = found.group(1)
+            fields = [field.strip() for field in line.split("#", 1)[0].split(";")]
+            if len(fields) < 2 or fields[1] not in ("L", "D", "R", "T"):
+                continue
+            first, _, last = fields[0].partition("..")
+            for code_point in range(int(first, 16), int(last or first, 16) + 1):
+                if statuses[code_point] == VALID:
+                    types[code_point] = fields[1]
+
+    found = []
+    for code_point, value in sorted(types.items()):
+        if found and found[-1][1] == code_point - 1 and found[-1][2] == value:
+            found[-1][1] = code_point
+        else:
+            found.append([code_point, code_point, value])
+    return version, found
+
+
+def ranges(predicate):
+    """Returns the ranges of code points the predicate holds for"""
+    found = []
+    first = None
+    for code_point in range(MAX_CODE_POINT + 2):
+        holds = code_point <= MAX_CODE_POINT and predicate(code_point)
+        if holds and first is None:
+            first = code_point
+        elif not holds and first is not None:
+            found.append((first, code_point - 1))
+            first = None
+    return found
+
+
+def runs_and_expansions(mappings):
+    """Splits the mappings in runs of code points mapped by the same offset
+    and in the code points mapped to many"""
+    simple = []
+    expansions = []
+    for code_point, mapped in sorted(mappings.items()):
+        if len(mapped) == 1:
+            simple.append((code_point, mapped[0] - code_point))
+        else:
+            expansions.append((code_point, mapped))
+
+    # Upper and lower case letters often alternate, so a run may step by two
+    runs = []
+    index = 0
+    while index < len(simple):
+        first, delta = simple[index]
+        best_count, best_stride = 1, 1
+        for stride in (1, 2):
+            last = index
+            while (last + 1 < len(simple) and simple[last + 1][0] == simple[last][0] + stride
+                   and simple[last + 1][1] == delta):
+                last += 1
+            if last - index + 1 > best_count:
+                best_count, best_stride = last - index + 1, stride
+        runs.append((first, best_count, delta, best_stride))
+        index += best_count
+    return runs, expansions
+
+
+def normalization(statuses):
+    """Returns the canonical combining classes, decompositions and
+    compositions of the code points that are valid once mapped, which are
+    the only ones normalized"""
+    def is_valid(code_point):
+        return statuses[code_point] == VALID
+
+    classes = []
+    for code_point in range(MAX_CODE_POINT + 1):
+        value = unicodedata.combining(chr(code_point)) if is_valid(code_point) else 0
+        if value == 0:
+            continue
+        if classes and classes[-1][1] == code_point - 1 and classes[-1][2] == value:
+            classes[-1][1] = code_point
+        else:
+            classes.append([code_point, code_point, value])
+
+    decompositions = []
+    compositions = []
+    for code_point in range(MAX_CODE_POINT + 1):
+        character = chr(code_point)
+        if not is_valid(code_point) or code_point in HANGUL_SYLLABLES:
+            continue
+        decomposed = unicodedata.normalize("NFD", character)
+        if decomposed == character:
+            continue
+        decompositions.append((code_point, [ord(each) for each in decomposed]))
+
+        # A primary composite is one NFC leaves as it is
+        parts = unicodedata.decomposition(character).split()
+        if (len(parts) == 2 and unicodedata.normalize("NFC", character) == character
+                and all(is_valid(int(part, 16)) for part in parts)):
+            compositions.append((int(parts[0], 16), int(parts[1], 16), code_point))
+    compositions.sort()
+    return classes, decompositions, compositions
+
+
+def write_entries(entries):
+    """Writes the entries of an array, as many on a line as fit"""
+    line = " "
+    for entry in entries:
+        if len(line) + len(entry) + 2 > WIDTH:
+            print(line.rstrip())
+            line = " "
+        line += " " + entry + ","
+    print(line.rstrip())
+
+
+def write_expansions(name, pool_name, expansions):
+    """Writes code points mapped to many, as slices of one array"""
+    pool = []
+    entries = []
+    for code_point, mapped in expansions:
+        entries.append("{ 0x%X, %d, %d }" % (code_point, len(pool), len(mapped)))
+        pool.extend(mapped)
+    assert len(pool) < 1 << 16
+    print("inline constexpr Expansion %s[] = {" % name)
+    write_entries(entries)
+    print("};\n")
+    print("inline constexpr char32_t %s[] = {" % pool_name)
+    write_entries("0x%X" % each for each in pool)
+    print("};\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: generate_idna_tables.py IdnaMappingTable.txt DerivedJoiningType.txt")
+    version, statuses, mappings = read_table(sys.argv[1])
+    joining_version, joining_types = read_joining_types(sys.argv[2], statuses)
+    if version != unicodedata.unidata_version or joining_version != version:
+        sys.exit("the tables are for Unicode %s and %s but Python has Unicode %s"
+                 % (version, joining_version, unicodedata.unidata_version))
+    runs, expansions = runs_and_expansions(mappings)
+    classes, decompositions, compositions = normalization(statuses)
+
+    print("""#ifndef URI_IDNA_TABLES_HPP
+#define URI_IDNA_TABLES_HPP
+
+// This file is generated by Uri/tools/generate_idna_tables.py from the IDNA
+// mapping table of UTS #46 (Unicode %s). Do not edit it by hand.
+
+#include <cstdint>
+
+namespace Uri::IdnaTables {
+
+/** This is a range of code points, both ends included */
+struct Range
+{
+  char32_t first;
+  char32_t last;
+};
+
+/**
+ * This is a run of code points mapped by adding the same offset, every
+ * code point or every other one
+ */
+struct Run
+{
+  char32_t first;
+  uint16_t count;
+  uint8_t stride;
+  int32_t delta;
+};
+
+/** This is a code point mapped to many, kept in a slice of another array */
+struct Expansion
+{
+  char32_t code_point;
+  uint16_t offset;
+  uint8_t size;
+};
+
+/** This is a range of code points of the same canonical combining class */
+struct CombiningClass
+{
+  char32_t first;
+  char32_t last;
+  uint8_t value;
+};
+
+/** This is a range of code points of the same joining type */
+struct JoiningType
+{
+  char32_t first;
+  char32_t last;
+  char value;
+};
+
+/** This is a pair of code points that normalization form C composes */
+struct Composition
+{
+  char32_t first;
+  char32_t second;
+  char32_t composite;
+};
+""" % version)
+
+    print("/** These are mapped to nothing */")
+    print("inline constexpr Range IGNORED[] = {")
+    write_entries("{ 0x%X, 0x%X }" % each for each in ranges(lambda c: statuses[c] == IGNORED))
+    print("};\n")
+
+    print("/** These may not be in a domain name */")
+    print("inline constexpr Range DISALLOWED[] = {")
+    write_entries("{ 0x%X, 0x%X }" % each for each in ranges(lambda c: statuses[c] == DISALLOWED))
+    print("};\n")
+
+    print("/** These are the marks, which may not start a label, of the valid code points */")
+    print("inline constexpr Range MARKS[] = {")
+    write_entries("{ 0x%X, 0x%X }" % each
+                  for each in ranges(lambda c: statuses[c] == VALID
+                                     and unicodedata.category(chr(c)).startswith("M")))
+    print("};\n")
+
+    print("/** These are the mappings of code points mapped to one */")
+    print("inline constexpr Run RUNS[] = {")
+    write_entries("{ 0x%X, %d, %d, %d }" % (first, count, stride, delta)
+                  for first, count, delta, stride in runs)
+    print("};\n")
+
+    print("/** These are the mappings of code points mapped to many */")
+    write_expansions("EXPANSIONS", "EXPANDED", expansions)
+
+    print("/**\n * These are the canonical combining classes other than zero of the code\n"
+          " * points that are valid once mapped\n */")
+    print("inline constexpr CombiningClass COMBINING_CLASSES[] = {")
+    write_entries("{ 0x%X, 0x%X, %d }" % tuple(each) for each in classes)
+    print("};\n")
+
+    print("/**\n * These are the full canonical decompositions of the code points that are\n"
+          " * valid once mapped, but for the Hangul syllables\n */")
+    write_expansions("DECOMPOSITIONS", "DECOMPOSED", decompositions)
+
+    print("/** These are the primary composites of code points valid once mapped */")
+    print("inline constexpr Composition COMPOSITIONS[] = {")
+    write_entries("{ 0x%X, 0x%X, 0x%X }" % each for each in compositions)
+    print("};\n")
+
+    print("/**\n * These are the joining types of the code points that are valid once mapped,\n"
+          " * but for those that do not join (U) or cause joining (C)\n */")
+    print("inline constexpr JoiningType JOINING_TYPES[] = {")
+    write_entries("{ 0x%X, 0x%X, '%s' }" % tuple(each) for each in joining_types)
+    print("};\n")
+
+    print("}// namespace Uri::IdnaTables\n")
+    print("#endif// !URI_IDNA_TABLES_HPP")
+
+
+if __name__ == "__main__":
+    main()
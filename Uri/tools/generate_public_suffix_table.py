@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""Writes Uri/src/public_suffix_table.hpp from the Public Suffix List.
+
+The rules are compiled into a DAFSA, a trie of the names written backwards
+in which equal endings are stored once, so the whole list fits in about
+50 KB. Names that are not ASCII are written in their "xn--" form, as hosts
+are after Uri::NormalizeHost. Run it from the root of the repository, with
+the list from https://publicsuffix.org/list/public_suffix_list.dat:
+
+    python3 Uri/tools/generate_public_suffix_table.py public_suffix_list.dat \\
+        > Uri/src/public_suffix_table.hpp
+
+The graph is a sequence of bytes. A node is a rules byte, if rules end at
+it, followed by one entry per child. The root node is at offset 0.
+
+ - The rules byte holds RULES_MARK, NORMAL, WILDCARD and EXCEPTION for the
+   rules that end at the node, and HAS_CHILDREN. A node without a rules byte
+   always has children.
+ - An entry is the offset of the child, written in one to three bytes. The
+   first byte holds LAST_ENTRY for the last entry of the node, the number of
+   bytes that follow, which is never 3 so it tells entries apart from the
+   rules byte, and the high bits of the offset. The offset of the first
+   child is from its entry and that of every other child is from the child
+   before it, which is placed before it in the graph.
+ - A child is the label of the edge to it, with LABEL_END on its last
+   character, followed by its node. Children always come after their
+   parents, and the labels of the children of a node begin with different
+   characters.
+"""
+
+import sys
+
+NORMAL = 0x01
+WILDCARD = 0x02
+EXCEPTION = 0x04
+HAS_CHILDREN = 0x08
+RULES_MARK = 0x60
+LABEL_END = 0x80
+LAST_ENTRY = 0x80
+ENTRY_SIZE_SHIFT = 5
+ENTRY_HIGH_BITS = 5
+WIDTH = 100
+
+
+def read_rules(path):
+    """Returns the rules of the list, keyed by the name written backwards"""
+    rules = {}
+    with open(path, encoding="utf-8") as source:
+        for line in source:
+            words = line.split()
+            if not words or words[0].startswith("//"):
+                continue
+            rule = words[0].lower()
+            kind = NORMAL
+            if rule.startswith("!"):
+                kind, rule = EXCEPTION, rule[1:]
+            elif rule.startswith("*."):
+                kind, rule = WILDCARD, rule[2:]
+            if "*" in rule:
+                raise ValueError("wildcards are only supported as the first label: " + rule)
+            name = ".".join(label.encode("idna").decode("ascii") for label in rule.split("."))
+            rules[name[::-1]] = rules.get(name[::-1], 0) | kind
+    return rules
+
+
+class Node:
+    """This is a node of the trie, which becomes one of the DAFSA"""
+
+    def __init__(self):
+        self.value = 0
+        self.children = {}
+
+
+def build_dafsa(rules):
+    """Builds the trie of the rules and merges its equal subtrees"""
+    root = Node()
+    for key, value in rules.items():
+        node = root
+        for character in key:
+            node = node.children.setdefault(character, Node())
+        node.value |= value
+
+    registry = {}
+
+    def merge(node):
+        node.children = {character: merge(child) for character, child in node.children.items()}
+        signature = (node.value,
+                     tuple(sorted((character, id(child))
+                                  for character, child in node.children.items())))
+        return registry.setdefault(signature, node)
+
+    return merge(root)
+
+
+def build_units(root):
+    """Returns the units of the graph, an edge label and the node it ends at,
+    joining the edges of chains whose nodes have one parent and one child"""
+    parents = {}
+    seen = set()
+    pending = [root]
+    while pending:
+        node = pending.pop()
+        for character, child in node.children.items():
+            parents[(character, id(child))] = parents.get((character, id(child)), 0) + 1
+            if id(child) not in seen:
+                seen.add(id(child))
+                pending.append(child)
+
+    units = {}
+
+    def unit(character, node):
+        key = (character, id(node))
+        if key not in units:
+            label = character
+            while node.value == 0 and len(node.children) == 1:
+                (next_character, child), = node.children.items()
+                if parents[(next_character, id(child))] != 1:
+                    break
+                label += next_character
+                node = child
+            units[key] = (label, node)
+        return units[key]
+
+    return unit
+
+
+def encode_entry(offset, last):
+    """Writes the entry of a child at the given offset from the entry"""
+    for extra in range(3):
+        if offset < 1 << (ENTRY_HIGH_BITS + 8 * extra):
+            first = (LAST_ENTRY if last else 0) | (extra << ENTRY_SIZE_SHIFT)
+            first |= offset >> (8 * extra)
+            return bytes([first]) + offset.to_bytes(3, "big")[3 - extra:]
+    raise ValueError("the graph is too large")
+
+
+def encode(root):
+    """Writes the graph, children first, so offsets are known when needed"""
+    unit = build_units(root)
+    written = []
+    end_offsets = {}
+    total = 0
+
+    def children_of(node):
+        return [unit(character, child) for character, child in sorted(node.children.items())]
+
+    def write_node(node):
+        # Children are written in the order of the graph, so after the first
+        # one every offset is from the previous child and is small when they
+        # are close together
+        targets = sorted((end_offsets[child] for child in children_of(node)), reverse=True)
+        data = b""
+        for index in range(len(targets) - 1, 0, -1):
+            data = encode_entry(targets[index - 1] - targets[index],
+                                index == len(targets) - 1) + data
+        if targets:
+            # The distance from the end of the graph to the first entry
+            # depends on its size, which depends on the distance
+            for size in range(1, 4):
+                entry = encode_entry(total + len(data) + size - targets[0], len(targets) == 1)
+                if len(entry) == size:
+                    break
+            data = entry + data
+        if node.value == 0:
+            return data
+        return bytes([RULES_MARK | node.value | (HAS_CHILDREN if targets else 0)]) + data
+
+    order = []
+    visited = set()
+
+    def visit(label, node):
+        if (label, id(node)) in visited:
+            return
+        visited.add((label, id(node)))
+        for child_label, child in children_of(node):
+            visit(child_label, child)
+        order.append((label, node))
+
+    for label, child in children_of(root):
+        visit(label, child)
+
+    for label, node in order:
+        text = label.encode("ascii")
+        data = text[:-1] + bytes([text[-1] | LABEL_END]) + write_node(node)
+        written.append(data)
+        total += len(data)
+        end_offsets[(label, node)] = total
+
+    written.append(write_node(root))
+    return b"".join(reversed(written))
+
+
+def main():
+    graph = encode(build_dafsa(read_rules(sys.argv[1])))
+
+    print("""#ifndef URI_PUBLIC_SUFFIX_TABLE_HPP
+#define URI_PUBLIC_SUFFIX_TABLE_HPP
+
+// This file is generated by Uri/tools/generate_public_suffix_table.py from
+// the Public Suffix List (https://publicsuffix.org/). Do not edit it by hand.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <cstdint>
+
+namespace Uri::PublicSuffixTable {
+
+/** These are the bits of the rules byte of a node */
+inline constexpr uint8_t RULES_MARK = 0x%02X;
+inline constexpr uint8_t NORMAL = 0x%02X;
+inline constexpr uint8_t WILDCARD = 0x%02X;
+inline constexpr uint8_t EXCEPTION = 0x%02X;
+inline constexpr uint8_t HAS_CHILDREN = 0x%02X;
+
+/** This marks the last character of a label */
+inline constexpr uint8_t LABEL_END = 0x%02X;
+
+/** These are the fields of the first byte of an entry */
+inline constexpr uint8_t LAST_ENTRY = 0x%02X;
+inline constexpr unsigned ENTRY_SIZE_SHIFT = %d;
+inline constexpr uint8_t ENTRY_SIZE_BITS = 0x%02X;
+inline constexpr uint8_t ENTRY_HIGH_BITS = 0x%02X;
+
+/** This is the graph of the rules, described in the generator */
+inline constexpr uint8_t GRAPH[] = {""" % (RULES_MARK, NORMAL, WILDCARD, EXCEPTION, HAS_CHILDREN,
+                                           LABEL_END, LAST_ENTRY, ENTRY_SIZE_SHIFT,
+                                           RULES_MARK, (1 << ENTRY_HIGH_BITS) - 1))
+    line = " "
+    for byte in graph:
+        entry = " 0x%02X," % byte
+        if len(line) + len(entry) > WIDTH:
+            print(line)
+            line = " "
+        line += entry
+    print(line)
+    print("};\n")
+    print("}// namespace Uri::PublicSuffixTable\n")
+    print("#endif// !URI_PUBLIC_SUFFIX_TABLE_HPP")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#ifndef FUZZ_HARNESS_HPP
+#define FUZZ_HARNESS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+namespace FuzzHarness {
+
+/**
+ * This holds the settings of the throughput and complexity mode, read once
+ * from the environment:
+ *
+ *  - FUZZ_REPORT_INTERVAL: seconds between execs/sec reports (0 disables)
+ *  - FUZZ_COMPLEXITY_CHECK: when set to 1, inputs of at least
+ *    FUZZ_COMPLEXITY_MIN_SIZE bytes (default 4096) whose parse takes over
+ *    FUZZ_COMPLEXITY_MIN_MICROS (default 1000) are parsed again at half
+ *    their size; if the full input takes more than FUZZ_COMPLEXITY_RATIO
+ *    (default 3.0) times as long as the half, the input is reported as
+ *    superlinear and the run is aborted so that libFuzzer saves it.
+ */
+struct Settings
+{
+  double report_interval = 0.0;
+  bool complexity_check = false;
+  size_t complexity_min_size = 4096;
+  double complexity_min_micros = 1000.0;
+  double complexity_ratio = 3.0;
+
+  static const Settings &Get()
+  {
+    static const Settings settings = [] {
+      Settings from_environment;
+      const auto read = [](const char *name, double fallback) {
+        const char *value = std::getenv(name);// NOLINT(concurrency-mt-unsafe)
+        return value == nullptr ? fallback : std::strtod(value, nullptr);
+      };
+      from_environment.report_interval = read("FUZZ_REPORT_INTERVAL", 0.0);
+      from_environment.complexity_check = read("FUZZ_COMPLEXITY_CHECK", 0.0) != 0.0;
+      from_environment.complexity_min_size = static_cast<size_t>(
+        read("FUZZ_COMPLEXITY_MIN_SIZE", static_cast<double>(from_environment.complexity_min_size)));
+      from_environment.complexity_min_micros =
+        read("FUZZ_COMPLEXITY_MIN_MICROS", from_environment.complexity_min_micros);
+      from_environment.complexity_ratio = read("FUZZ_COMPLEXITY_RATIO", from_environment.complexity_ratio);
+      return from_environment;
+    }();
+    return settings;
+  }
+};
+
+/**
+ * This measures how long the target takes on the input, in microseconds
+ */
+template<typename Target> double TimeTarget(Target &target, std::string_view input)
+{
+  const auto start = std::chrono::steady_clock::now();
+  target(input);
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+/**
+ * This runs one fuzz input through the target, keeping track of throughput
+ * and checking for superlinear parse times when asked to
+ *
+ * @param[in] data
+ *    This is the input given by libFuzzer
+ *
+ * @param[in] size
+ *    This is the size of the input
+ *
+ * @param[in] target
+ *    This is the code under test, called with the input as a string view.
+ *    It may be called again on a prefix of the input.
+ */
+template<typename Target> int Run(const uint8_t *data, size_t size, Target target)
+{
+  using Clock = std::chrono::steady_clock;
+  static auto interval_start = Clock::now();
+  static uint64_t interval_execs = 0;
+
+  const auto &settings = Settings::Get();
+  const std::string_view input(reinterpret_cast<const char *>(data), size);// NOLINT
+
+  const auto elapsed = TimeTarget(target, input);
+  ++interval_execs;
+
+  if (settings.complexity_check && size >= settings.complexity_min_size
+      && elapsed >= settings.complexity_min_micros) {
+    const auto half_elapsed = TimeTarget(target, input.substr(0, size / 2));
+    if (elapsed > settings.complexity_ratio * half_elapsed) {
+      std::fprintf(stderr,// NOLINT
+        "==superlinear== %zu bytes took %.0f us, the first half took %.0f us\n",
+        size,
+        elapsed,
+        half_elapsed);
+      std::abort();
+    }
+  }
+
+  if (settings.report_interval > 0.0) {
+    const std::chrono::duration<double> since_report = Clock::now() - interval_start;
+    if (since_report.count() >= settings.report_interval) {
+      std::fprintf(stderr,// NOLINT
+        "==throughput== %.0f execs/sec\n",
+        static_cast<double>(interval_execs) / since_report.count());
+      interval_start = Clock::now();
+      interval_execs = 0;
+    }
+  }
+
+  return 0;
+}
+
+}// namespace FuzzHarness
+
+#endif// !FUZZ_HARNESS_HPP
@@ -0,0 +1,26 @@
+#include "fuzz_harness.hpp"
+#include "internet_message.hpp"
+#include "request_line.hpp"
+
+// Parses the input as a raw message and generates it back, then walks it as
+// a buffer of pipelined requests
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+  return FuzzHarness::Run(Data, Size, [](std::string_view input) {
+    InternetMessage::InternetMessage message;
+    if (message.ParseFromRawMessage(std::string(input))) {
+      static_cast<void>(message.GenerateRawMessage());
+    }
+
+    InternetMessage::RequestLine requestLine;
+    while (!input.empty()) {
+      size_t consumed = 0;
+      if (!InternetMessage::ParseRequestLine(input, requestLine, consumed)) { return; }
+      input.remove_prefix(consumed);
+      if (!message.ParseFromBuffer(input, consumed)) { return; }
+      if (consumed > input.size()) { __builtin_trap(); }
+      input.remove_prefix(consumed);
+    }
+  });
+}
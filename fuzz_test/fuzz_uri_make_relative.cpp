@@ -0,0 +1,29 @@
+#include "fuzz_harness.hpp"
+#include "uri.hpp"
+
+#include <cstdlib>
+
+// Splits the input at the first newline into a base URI and a target URI,
+// makes a reference to the target from the base and checks that resolving
+// it, as it is and once written out and parsed back, gives the target
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+  return FuzzHarness::Run(Data, Size, [](std::string_view input) {
+    const auto split = input.find('\n');
+    if (split == std::string_view::npos) { return; }
+
+    Uri::Uri base;
+    Uri::Uri target;
+    if (!base.ParseFromString(std::string(input.substr(0, split)))) { return; }
+    if (!target.ParseFromString(std::string(input.substr(split + 1)))) { return; }
+    if (base.IsRelativeReference() || target.IsRelativeReference()) { return; }
+
+    const auto reference = base.MakeRelative(target);
+    if (base.Resolve(reference) != target) { std::abort(); }
+
+    Uri::Uri reference_from_string;
+    if (!reference_from_string.ParseFromString(reference.GenerateString())) { std::abort(); }
+    if (base.Resolve(reference_from_string) != target) { std::abort(); }
+  });
+}
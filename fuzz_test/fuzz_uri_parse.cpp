@@ -0,0 +1,17 @@
+#include "fuzz_harness.hpp"
+#include "uri.hpp"
+
+// Parses the input as a URI and, when it is valid, checks that the string
+// generated from it parses back to an equal URI
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+  return FuzzHarness::Run(Data, Size, [](std::string_view input) {
+    Uri::Uri uri;
+    if (!uri.ParseFromString(std::string(input))) { return; }
+
+    const auto generated = uri.GenerateString();
+    Uri::Uri round_trip;
+    if (!round_trip.ParseFromString(generated) || round_trip != uri) { __builtin_trap(); }
+  });
+}
@@ -0,0 +1,23 @@
+#include "fuzz_harness.hpp"
+#include "uri.hpp"
+
+// Splits the input at the first newline into a base URI and a relative
+// reference, resolves one against the other and normalizes the paths
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+  return FuzzHarness::Run(Data, Size, [](std::string_view input) {
+    const auto split = input.find('\n');
+    if (split == std::string_view::npos) { return; }
+
+    Uri::Uri base;
+    Uri::Uri relative_reference;
+    if (!base.ParseFromString(std::string(input.substr(0, split)))) { return; }
+    if (!relative_reference.ParseFromString(std::string(input.substr(split + 1)))) { return; }
+
+    auto target = base.Resolve(relative_reference);
+    target.NormalizePath();
+    relative_reference.NormalizePath();
+    static_cast<void>(target.GenerateString());
+  });
+}
@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <CLI/CLI.hpp>
+#include <spdlog/spdlog.h>
+
+#include <internal_use_only/config.hpp>
+#include "uri.hpp"
+
+namespace {
+
+/** This is how much of the input every worker takes on in one round */
+constexpr size_t CHUNK_SIZE = size_t{ 8 } << 20U;
+
+/**
+ * This is a view of a whole file mapped into memory, unmapped when it goes
+ * out of scope
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &path)
+  {
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) { throw std::system_error(errno, std::generic_category(), path); }
+
+    struct stat status
+    {
+    };
+    if (::fstat(file, &status) < 0) {
+      ::close(file);
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    size_ = static_cast<size_t>(status.st_size);
+    if (size_ > 0) {
+      data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+      if (data_ == MAP_FAILED) {
+        ::close(file);
+        throw std::system_error(errno, std::generic_category(), path);
+      }
+      // Pages are read ahead as the workers reach them instead of all up front
+      ::madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+    ::close(file);
+  }
+
+  ~MappedFile()
+  {
+    if (size_ > 0) { ::munmap(data_, size_); }
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile &operator=(MappedFile &&) = delete;
+
+  [[nodiscard]] std::string_view View() const { return { static_cast<const char *>(data_), size_ }; }
+
+private:
+  void *data_ = nullptr;
+  size_t size_ = 0;
+};
+
+/**
+ * This writes the whole buffer to the file descriptor, retrying on short
+ * writes
+ */
+void WriteAll(int file, std::string_view buffer)
+{
+  while (!buffer.empty()) {
+    const auto written = ::write(file, buffer.data(), buffer.size());
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      throw std::system_error(errno, std::generic_category(), "write");
+    }
+    buffer.remove_prefix(static_cast<size_t>(written));
+  }
+}
+
+/**
+ * This returns the position just past the end of the line the given
+ * position is in, so that chunks always hold whole lines
+ */
+size_t NextLineStart(std::string_view input, size_t position)
+{
+  if (position >= input.size()) { return input.size(); }
+  const auto *newline = static_cast<const char *>(
+    std::memchr(input.data() + position, '\n', input.size() - position));
+  return newline == nullptr ? input.size() : static_cast<size_t>(newline - input.data()) + 1;
+}
+
+/**
+ * This is what one worker produces for one chunk of the input
+ */
+struct ChunkOutput
+{
+  std::string canonical;
+  std::string errors;
+  size_t valid_count = 0;
+  size_t invalid_count = 0;
+};
+
+/**
+ * This parses and normalizes every line of the chunk, appending the
+ * canonical forms and error reports to the output buffers
+ *
+ * @param[in] input
+ *    This is the whole input, used to report byte offsets
+ *
+ * @param[in] begin
+ *    This is where the chunk begins, always at the start of a line
+ *
+ * @param[in] end
+ *    This is where the chunk ends, always at the start of a line
+ *
+ * @param[out] output
+ *    This is where the results are written; it is cleared first but keeps
+ *    its capacity between rounds
+ */
+void ProcessChunk(std::string_view input, size_t begin, size_t end, ChunkOutput &output)
+{
+  output.canonical.clear();
+  output.errors.clear();
+  output.valid_count = 0;
+  output.invalid_count = 0;
+
+  Uri::Uri uri;
+  std::string line;
+
+  while (begin < end) {
+    const auto *newline =
+      static_cast<const char *>(std::memchr(input.data() + begin, '\n', end - begin));
+    const auto line_end = newline == nullptr ? end : static_cast<size_t>(newline - input.data());
+
+    auto line_view = input.substr(begin, line_end - begin);
+    if (!line_view.empty() && line_view.back() == '\r') { line_view.remove_suffix(1); }
+
+    if (!line_view.empty()) {
+      line.assign(line_view);
+      if (const auto result = uri.ParseFromString(line)) {
+        output.canonical += uri.GenerateCanonicalString();
+        output.canonical += '\n';
+        ++output.valid_count;
+      } else {
+        output.errors += "offset ";
+        output.errors += std::to_string(begin);
+        output.errors += ": ";
+        output.errors += Uri::ToString(result.error);
+        output.errors += " at byte ";
+        output.errors += std::to_string(result.offset);
+        output.errors += ": ";
+        output.errors += line_view;
+        output.errors += '\n';
+        ++output.invalid_count;
+      }
+    }
+    begin = line_end + 1;
+  }
+}
+
+}// namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main(int argc, const char **argv)
+{
+  try {
+    CLI::App app{ fmt::format(
+      "{} URI corpus ingestion version {}", myproject::cmake::project_name, myproject::cmake::project_version) };
+
+    std::string input_path;
+    app.add_option("input", input_path, "Newline separated URI file to read")->required();
+    std::optional<std::string> output_path;
+    app.add_option("-o,--output", output_path, "File for the canonical URIs (default stdout)");
+    std::optional<std::string> error_path;
+    app.add_option("-e,--errors", error_path, "File for the rejected lines (default stderr)");
+    unsigned int thread_count = std::max(1U, std::thread::hardware_concurrency());
+    app.add_option("-j,--threads", thread_count, "Number of worker threads");
+
+    CLI11_PARSE(app, argc, argv);
+    thread_count = std::max(1U, thread_count);
+
+    const MappedFile mapped_input(input_path);
+    const auto input = mapped_input.View();
+
+    const auto open_output = [](const std::optional<std::string> &path, int fallback) {
+      if (!path) { return fallback; }
+      const int file = ::open(path->c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (file < 0) { throw std::system_error(errno, std::generic_category(), *path); }
+      return file;
+    };
+    const int output_file = open_output(output_path, STDOUT_FILENO);
+    const int error_file = open_output(error_path, STDERR_FILENO);
+
+    std::vector<ChunkOutput> outputs(thread_count);
+    std::vector<size_t> bounds(thread_count + 1);
+    size_t valid_count = 0;
+    size_t invalid_count = 0;
+    size_t position = 0;
+
+    // Every round hands one chunk to each worker; the outputs are written in
+    // input order once the round is done, so the result is deterministic
+    while (position < input.size()) {
+      bounds[0] = position;
+      for (size_t worker = 1; worker <= thread_count; ++worker) {
+        bounds[worker] = NextLineStart(input, bounds[worker - 1] + CHUNK_SIZE - 1);
+      }
+
+      {
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count - 1);
+        for (size_t worker = 1; worker < thread_count; ++worker) {
+          workers.emplace_back(
+            [&, worker] { ProcessChunk(input, bounds[worker], bounds[worker + 1], outputs[worker]); });
+        }
+        ProcessChunk(input, bounds[0], bounds[1], outputs[0]);
+      }
+
+      for (const auto &output : outputs) {
+        WriteAll(output_file, output.canonical);
+        WriteAll(error_file, output.errors);
+        valid_count += output.valid_count;
+        invalid_count += output.invalid_count;
+      }
+      position = bounds[thread_count];
+    }
+
+    if (output_path) { ::close(output_file); }
+    if (error_path) { ::close(error_file); }
+
+    spdlog::info("{} valid URIs, {} rejected", valid_count, invalid_count);
+    return invalid_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &e) {
+    spdlog::error("Unhandled exception in main: {}", e.what());
+    return EXIT_FAILURE;
+  }
+}